@@ -0,0 +1,319 @@
+// Arduino_GFX primitive benchmark on the ST7701 RGB panel (env:esp32s3-gfxbench).
+//
+// A sketch of its own, not the firmware: the panel is set up exactly as
+// main.cpp does it and nothing else runs (no LVGL, WiFi or web server), so
+// the numbers are the driver's alone. Every primitive is timed twice:
+//   - per call, the way a sketch uses it: each call writes its own area back
+//     from the PSRAM cache (us_per_op)
+//   - batched inside one startWrite()/endWrite(): the drawing alone
+//     (batched_us_per_op), then the single writeback of the merged dirty
+//     areas at endWrite() (writeback_us)
+// Each is the best of ROUNDS runs. Positions come from a fixed-seed
+// generator, so runs of different builds draw the same pixels.
+//
+// The JSON report is printed to serial once, with the build id, and again
+// every REPEAT_MS. Compare two builds with scripts/bench_compare.py, the
+// way the UI benchmark's reports are compared.
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+#include "../lib/Arduino_GFX/examples/HelloWorldGfxfont/FreeSansBold10pt7b.h"
+
+// CI sets the build identifier with -DFIRMWARE_VERSION=\"...\"; local builds
+// fall back to the time this file was compiled
+#ifndef FIRMWARE_VERSION
+#define FIRMWARE_VERSION __DATE__ " " __TIME__
+#endif
+
+// Same panel setup as src/main.cpp (direct mode, double buffered)
+#define GFX_BL 38
+#define TFT_WIDTH 480
+#define TFT_HEIGHT 480
+#define PANEL_PCLK_HZ 12000000
+
+Arduino_ESP32RGBPanel *bus = new Arduino_ESP32RGBPanel(
+    39 /* CS */, 48 /* SCK */, 47 /* SDA */,
+    18 /* DE */, 17 /* VSYNC */, 16 /* HSYNC */, 21 /* PCLK */,
+    11 /* R0 */, 12 /* R1 */, 13 /* R2 */, 14 /* R3 */, 0 /* R4 */,
+    8 /* G0 */, 20 /* G1 */, 3 /* G2 */, 46 /* G3 */, 9 /* G4 */, 10 /* G5 */,
+    4 /* B0 */, 5 /* B1 */, 6 /* B2 */, 7 /* B3 */, 15 /* B4 */,
+    false /* useBigEndian */
+);
+
+Arduino_ST7701_RGBPanel *gfx = new Arduino_ST7701_RGBPanel(
+    bus, GFX_NOT_DEFINED /* RST */, 0 /* rotation */,
+    true /* IPS */, TFT_WIDTH /* width */, TFT_HEIGHT /* height */,
+    st7701_type1_init_operations, sizeof(st7701_type1_init_operations),
+    true /* BGR */,
+    10 /* hsync_front_porch */, 8 /* hsync_pulse_width */, 50 /* hsync_back_porch */,
+    10 /* vsync_front_porch */, 8 /* vsync_pulse_width */, 20 /* vsync_back_porch */
+);
+
+static const uint8_t ROUNDS = 3;
+static const uint32_t REPEAT_MS = 60000;
+
+// Bitmap sources: small ones in internal RAM (icons, glyph caches), a
+// full-width band in PSRAM (what an LVGL partial flush hands over)
+static const int16_t BITMAP_SIZE = 64;
+static const int16_t BAND_HEIGHT = 60;
+static uint16_t *bitmap16;
+static uint16_t *bitmapBe16;
+static uint8_t *bitmap24;
+static uint16_t *band16;
+
+static const char *const TEXT = "Living room 23.5C";
+
+// ============================================================================
+// Primitives
+// ============================================================================
+
+static uint32_t rngState;
+
+static inline uint32_t rng()
+{
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+static inline int16_t rx(int16_t span = 0) { return rng() % (TFT_WIDTH - span); }
+static inline int16_t ry(int16_t span = 0) { return rng() % (TFT_HEIGHT - span); }
+static inline uint16_t rcolor() { return (uint16_t)rng(); }
+
+static void opPixel() { gfx->drawPixel(rx(), ry(), rcolor()); }
+static void opHLine() { gfx->drawFastHLine(rx(200), ry(), 200, rcolor()); }
+static void opVLine() { gfx->drawFastVLine(rx(), ry(200), 200, rcolor()); }
+static void opLine() { gfx->drawLine(rx(), ry(), rx(), ry(), rcolor()); }
+static void opFillSmall() { gfx->fillRect(rx(16), ry(16), 16, 16, rcolor()); }
+static void opFillCard() { gfx->fillRect(rx(140), ry(100), 140, 100, rcolor()); }
+static void opFillRows() { gfx->fillRect(0, ry(120), TFT_WIDTH, 120, rcolor()); }
+static void opFillScreen() { gfx->fillScreen(rcolor()); }
+static void opRoundRect() { gfx->fillRoundRect(rx(140), ry(100), 140, 100, 16, rcolor()); }
+static void opCircle() { gfx->fillCircle(rx(100) + 50, ry(100) + 50, 50, rcolor()); }
+static void opBitmap16() { gfx->draw16bitRGBBitmap(rx(BITMAP_SIZE), ry(BITMAP_SIZE), bitmap16, BITMAP_SIZE, BITMAP_SIZE); }
+static void opBitmapBe16() { gfx->draw16bitBeRGBBitmap(rx(BITMAP_SIZE), ry(BITMAP_SIZE), bitmapBe16, BITMAP_SIZE, BITMAP_SIZE); }
+static void opBitmap24() { gfx->draw24bitRGBBitmap(rx(BITMAP_SIZE), ry(BITMAP_SIZE), bitmap24, BITMAP_SIZE, BITMAP_SIZE); }
+static void opBand16() { gfx->draw16bitRGBBitmap(0, ry(BAND_HEIGHT), band16, TFT_WIDTH, BAND_HEIGHT); }
+
+static void opText()
+{
+  gfx->setCursor(rx(240), ry(40) + 20);
+  gfx->setTextColor(rcolor());
+  gfx->print(TEXT);
+}
+
+static void opFillArc()
+{
+  int16_t r = 40 + rng() % 60;
+  gfx->fillArc(rx(200) + 100, ry(200) + 100, r, r - 12, 0, 30 + rng() % 300, rcolor());
+}
+
+static void opDrawArc()
+{
+  int16_t r = 40 + rng() % 60;
+  gfx->drawArc(rx(200) + 100, ry(200) + 100, r, r - 12, 0, 30 + rng() % 300, rcolor());
+}
+
+// Text is set up per font before it runs
+enum FontKind : uint8_t
+{
+  FONT_NONE = 0,
+  FONT_GLCD,
+  FONT_GFX,
+  FONT_U8G2
+};
+
+struct Primitive
+{
+  const char *name;
+  void (*op)();
+  uint32_t ops;
+  uint32_t pixels; // Per op, 0 where it depends on the shape
+  FontKind font;
+};
+
+static const Primitive PRIMITIVES[] = {
+    {"pixel", opPixel, 20000, 1, FONT_NONE},
+    {"hline_200", opHLine, 4000, 200, FONT_NONE},
+    {"vline_200", opVLine, 4000, 200, FONT_NONE},
+    {"line", opLine, 2000, 0, FONT_NONE},
+    {"fill_16x16", opFillSmall, 4000, 16 * 16, FONT_NONE},
+    {"fill_140x100", opFillCard, 500, 140 * 100, FONT_NONE},
+    {"fill_480x120", opFillRows, 100, TFT_WIDTH * 120, FONT_NONE},
+    {"fill_screen", opFillScreen, 20, TFT_WIDTH * TFT_HEIGHT, FONT_NONE},
+    {"round_rect_140x100", opRoundRect, 500, 0, FONT_NONE},
+    {"circle_r50", opCircle, 500, 0, FONT_NONE},
+    {"bitmap16_64", opBitmap16, 1000, BITMAP_SIZE * BITMAP_SIZE, FONT_NONE},
+    {"bitmap16be_64", opBitmapBe16, 1000, BITMAP_SIZE * BITMAP_SIZE, FONT_NONE},
+    {"bitmap24_64", opBitmap24, 1000, BITMAP_SIZE * BITMAP_SIZE, FONT_NONE},
+    {"bitmap16_480x60_psram", opBand16, 100, TFT_WIDTH * BAND_HEIGHT, FONT_NONE},
+    {"text_glcd", opText, 500, 0, FONT_GLCD},
+    {"text_gfxfont", opText, 500, 0, FONT_GFX},
+#if defined(U8G2_FONT_SUPPORT)
+    {"text_u8g2", opText, 500, 0, FONT_U8G2},
+#endif
+    {"fill_arc", opFillArc, 300, 0, FONT_NONE},
+    {"draw_arc", opDrawArc, 300, 0, FONT_NONE},
+};
+static const uint8_t PRIMITIVE_COUNT = sizeof(PRIMITIVES) / sizeof(PRIMITIVES[0]);
+
+struct Result
+{
+  uint32_t us;          // All ops, each writing back its own area
+  uint32_t batchedUs;   // All ops inside one write, without the writeback
+  uint32_t writebackUs; // The endWrite() after them
+};
+
+static Result results[PRIMITIVE_COUNT];
+
+// ============================================================================
+// Run
+// ============================================================================
+
+static void setFont(FontKind font)
+{
+  gfx->setFont((const GFXfont *)NULL);
+  gfx->setTextSize(1);
+  switch (font)
+  {
+  case FONT_GLCD:
+    gfx->setTextSize(2);
+    break;
+  case FONT_GFX:
+    gfx->setFont(&FreeSansBold10pt7b);
+    break;
+#if defined(U8G2_FONT_SUPPORT)
+  case FONT_U8G2:
+    gfx->setFont(u8g2_font_unifont_h_utf8);
+    break;
+#endif
+  default:
+    break;
+  }
+}
+
+static uint32_t timeOps(const Primitive &p)
+{
+  rngState = 0x2545F491;
+  int64_t start = esp_timer_get_time();
+  for (uint32_t i = 0; i < p.ops; i++)
+  {
+    p.op();
+  }
+  return esp_timer_get_time() - start;
+}
+
+static void measure(const Primitive &p, Result &best)
+{
+  best = {UINT32_MAX, UINT32_MAX, UINT32_MAX};
+  setFont(p.font);
+  for (uint8_t round = 0; round < ROUNDS; round++)
+  {
+    gfx->fillScreen(BLACK);
+    best.us = min(best.us, timeOps(p));
+
+    gfx->fillScreen(BLACK);
+    gfx->startWrite();
+    uint32_t drawUs = timeOps(p);
+    int64_t start = esp_timer_get_time();
+    gfx->endWrite();
+    uint32_t writebackUs = esp_timer_get_time() - start;
+    if (drawUs < best.batchedUs)
+    {
+      best.batchedUs = drawUs;
+      best.writebackUs = writebackUs;
+    }
+  }
+  setFont(FONT_NONE);
+}
+
+static void printReport(uint32_t durationMs)
+{
+  Serial.printf("{\"bench\":\"gfx\",\"state\":\"done\",\"build\":{\"id\":\"%s\",\"date\":\"%s %s\",\"sdk\":\"%s\",\"md5\":\"%s\"}",
+                FIRMWARE_VERSION, __DATE__, __TIME__, ESP.getSdkVersion(), ESP.getSketchMD5().c_str());
+  Serial.printf(",\"panel\":{\"width\":%u,\"height\":%u,\"pclk_hz\":%u},\"rounds\":%u,\"duration_ms\":%u",
+                TFT_WIDTH, TFT_HEIGHT, PANEL_PCLK_HZ, ROUNDS, durationMs);
+  Serial.print(",\"primitives\":[");
+  for (uint8_t i = 0; i < PRIMITIVE_COUNT; i++)
+  {
+    const Primitive &p = PRIMITIVES[i];
+    const Result &r = results[i];
+    Serial.printf("%s{\"name\":\"%s\",\"ops\":%u,\"us_per_op\":%.2f,\"batched_us_per_op\":%.2f,\"writeback_us\":%u",
+                  i ? "," : "", p.name, p.ops, (float)r.us / p.ops, (float)r.batchedUs / p.ops, r.writebackUs);
+    if (p.pixels)
+    {
+      // Pixels per microsecond is megapixels per second
+      Serial.printf(",\"pixels_per_op\":%u,\"mpix_per_s\":%.2f", p.pixels, r.us ? (float)p.pixels * p.ops / r.us : 0.0f);
+    }
+    Serial.print("}");
+  }
+  Serial.println("]}");
+}
+
+static void fillSources()
+{
+  bitmap16 = (uint16_t *)heap_caps_malloc(BITMAP_SIZE * BITMAP_SIZE * 2, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  bitmapBe16 = (uint16_t *)heap_caps_malloc(BITMAP_SIZE * BITMAP_SIZE * 2, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  bitmap24 = (uint8_t *)heap_caps_malloc(BITMAP_SIZE * BITMAP_SIZE * 3, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  band16 = (uint16_t *)heap_caps_malloc(TFT_WIDTH * BAND_HEIGHT * 2, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!bitmap16 || !bitmapBe16 || !bitmap24 || !band16)
+  {
+    Serial.println("GfxBench: Failed to allocate bitmaps");
+    while (true)
+    {
+      delay(1000);
+    }
+  }
+
+  for (int32_t i = 0; i < BITMAP_SIZE * BITMAP_SIZE; i++)
+  {
+    uint8_t r = i % BITMAP_SIZE * 4, g = i / BITMAP_SIZE * 4, b = 255 - r;
+    bitmap16[i] = gfx->color565(r, g, b);
+    bitmapBe16[i] = (bitmap16[i] >> 8) | (bitmap16[i] << 8);
+    bitmap24[i * 3] = r;
+    bitmap24[i * 3 + 1] = g;
+    bitmap24[i * 3 + 2] = b;
+  }
+  for (int32_t i = 0; i < TFT_WIDTH * BAND_HEIGHT; i++)
+  {
+    band16[i] = gfx->color565(i % TFT_WIDTH / 2, i / TFT_WIDTH * 4, 128);
+  }
+}
+
+static void run()
+{
+  Serial.printf("GfxBench: %u primitives, %u rounds\n", PRIMITIVE_COUNT, ROUNDS);
+  unsigned long start = millis();
+  for (uint8_t i = 0; i < PRIMITIVE_COUNT; i++)
+  {
+    measure(PRIMITIVES[i], results[i]);
+    Serial.printf("GfxBench: %s: %.2f us/op (%.2f batched, writeback %u us)\n",
+                  PRIMITIVES[i].name, (float)results[i].us / PRIMITIVES[i].ops,
+                  (float)results[i].batchedUs / PRIMITIVES[i].ops, results[i].writebackUs);
+  }
+  gfx->fillScreen(BLACK);
+  printReport(millis() - start);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(500);
+
+  gfx->begin(PANEL_PCLK_HZ);
+  gfx->fillScreen(BLACK);
+  pinMode(GFX_BL, OUTPUT);
+  digitalWrite(GFX_BL, HIGH);
+
+  fillSources();
+  run();
+}
+
+void loop()
+{
+  delay(REPEAT_MS);
+  run();
+}
@@ -0,0 +1,60 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Minimal Arduino core for the native (host) build: enough of String, Print,
+// Serial and the timing/LEDC calls for the UI, theme and config modules to
+// compile unchanged. Not a general-purpose emulation.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <sys/time.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+using std::min;
+using std::max;
+
+#include "WString.h"
+#include "Print.h"
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+// Backlight PWM has nothing to drive on the host
+inline double ledcSetup(uint8_t, double freq, uint8_t) { return freq; }
+inline void ledcAttachPin(uint8_t, uint8_t) {}
+inline void ledcWrite(uint8_t, uint32_t) {}
+
+// Time as the ESP32 core provides it (the host clock is always "synced")
+bool getLocalTime(struct tm* info, uint32_t ms = 5000);
+void configTzTime(const char* tz, const char* server1,
+                  const char* server2 = nullptr, const char* server3 = nullptr);
+
+// Log output goes to stderr so reports on stdout stay machine-readable
+class HostSerial : public Print {
+public:
+    HostSerial() : quiet(false) {}
+
+    void begin(unsigned long) {}
+    void setQuiet(bool enabled) { quiet = enabled; }
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* data, size_t size) override;
+    using Print::write;
+
+private:
+    bool quiet;
+};
+
+extern HostSerial Serial;
+
+#endif // HOST_ARDUINO_H
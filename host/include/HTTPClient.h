@@ -0,0 +1,23 @@
+#ifndef HOST_HTTPCLIENT_H
+#define HOST_HTTPCLIENT_H
+
+#include <Arduino.h>
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_NOT_FOUND 404
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+
+// No network on the host; every request fails to connect
+class HTTPClient {
+public:
+    bool begin(const String&) { return true; }
+    void setTimeout(uint16_t) {}
+    void addHeader(const String&, const String&) {}
+    int GET() { return HTTPC_ERROR_CONNECTION_REFUSED; }
+    int POST(const String&) { return HTTPC_ERROR_CONNECTION_REFUSED; }
+    String getString() { return String(); }
+    void end() {}
+    static String errorToString(int) { return "connection refused"; }
+};
+
+#endif // HOST_HTTPCLIENT_H
@@ -0,0 +1,32 @@
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <Arduino.h>
+
+// NVS replacement: namespaces live in process memory for the run, so a
+// save followed by a load round-trips but nothing survives exit
+class Preferences {
+public:
+    Preferences() : opened(false), readOnly(false) {}
+
+    bool begin(const char* name, bool readOnly = false);
+    void end() { opened = false; }
+
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+
+    size_t putBytes(const char* key, const void* value, size_t len);
+    size_t getBytesLength(const char* key);
+    size_t getBytes(const char* key, void* buf, size_t maxLen);
+
+    size_t putString(const char* key, const String& value);
+    String getString(const char* key, const String& defaultValue = String());
+
+private:
+    std::string ns;
+    bool opened;
+    bool readOnly;
+};
+
+#endif // HOST_PREFERENCES_H
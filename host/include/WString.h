@@ -0,0 +1,116 @@
+#ifndef HOST_WSTRING_H
+#define HOST_WSTRING_H
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string>
+
+// Arduino String on top of std::string. Covers the members this project and
+// ArduinoJson's String adapter use.
+class StringSumHelper;
+
+class String {
+public:
+    String(const char* cstr = "") : s(cstr ? cstr : "") {}
+    String(const char* cstr, size_t length) : s(cstr ? cstr : "", cstr ? length : 0) {}
+    String(const String& other) = default;
+    String(String&& other) = default;
+    explicit String(char c) : s(1, c) {}
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(float value, unsigned int decimals = 2);
+    explicit String(double value, unsigned int decimals = 2);
+
+    String& operator=(const String& other) = default;
+    String& operator=(String&& other) = default;
+    String& operator=(const char* cstr) { s = cstr ? cstr : ""; return *this; }
+
+    bool reserve(unsigned int size) { s.reserve(size); return true; }
+    unsigned int length() const { return s.length(); }
+    bool isEmpty() const { return s.empty(); }
+    const char* c_str() const { return s.c_str(); }
+
+    bool concat(const String& str) { s += str.s; return true; }
+    bool concat(const char* cstr) { if (cstr) s += cstr; return true; }
+    bool concat(const char* cstr, unsigned int length) { if (cstr) s.append(cstr, length); return true; }
+    bool concat(char c) { s += c; return true; }
+    bool concat(unsigned char value) { return concat(String(value)); }
+    bool concat(int value) { return concat(String(value)); }
+    bool concat(unsigned int value) { return concat(String(value)); }
+    bool concat(long value) { return concat(String(value)); }
+    bool concat(unsigned long value) { return concat(String(value)); }
+    bool concat(float value) { return concat(String(value)); }
+    bool concat(double value) { return concat(String(value)); }
+
+    template <typename T>
+    String& operator+=(const T& rhs) { concat(rhs); return *this; }
+
+    friend StringSumHelper& operator+(const StringSumHelper& lhs, const String& rhs);
+    friend StringSumHelper& operator+(const StringSumHelper& lhs, const char* cstr);
+    friend StringSumHelper& operator+(const StringSumHelper& lhs, char c);
+    friend StringSumHelper& operator+(const StringSumHelper& lhs, unsigned char value);
+    friend StringSumHelper& operator+(const StringSumHelper& lhs, int value);
+    friend StringSumHelper& operator+(const StringSumHelper& lhs, unsigned int value);
+    friend StringSumHelper& operator+(const StringSumHelper& lhs, long value);
+    friend StringSumHelper& operator+(const StringSumHelper& lhs, unsigned long value);
+    friend StringSumHelper& operator+(const StringSumHelper& lhs, float value);
+    friend StringSumHelper& operator+(const StringSumHelper& lhs, double value);
+
+    int compareTo(const String& other) const { return s.compare(other.s); }
+    bool equals(const String& other) const { return s == other.s; }
+    bool equals(const char* cstr) const { return s == (cstr ? cstr : ""); }
+    bool equalsIgnoreCase(const String& other) const;
+    bool operator==(const String& rhs) const { return equals(rhs); }
+    bool operator==(const char* cstr) const { return equals(cstr); }
+    bool operator!=(const String& rhs) const { return !equals(rhs); }
+    bool operator!=(const char* cstr) const { return !equals(cstr); }
+    bool operator<(const String& rhs) const { return compareTo(rhs) < 0; }
+    bool startsWith(const String& prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+    bool endsWith(const String& suffix) const;
+
+    char charAt(unsigned int index) const { return index < s.size() ? s[index] : 0; }
+    void setCharAt(unsigned int index, char c) { if (index < s.size()) s[index] = c; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char& operator[](unsigned int index) { return s[index]; }
+
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String& str, unsigned int from = 0) const;
+    int lastIndexOf(char c) const;
+    int lastIndexOf(const String& str) const;
+    String substring(unsigned int beginIndex) const { return substring(beginIndex, s.size()); }
+    String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+    void replace(char find, char replacement);
+    void replace(const String& find, const String& replacement);
+    void remove(unsigned int index) { if (index < s.size()) s.erase(index); }
+    void remove(unsigned int index, unsigned int count) { if (index < s.size()) s.erase(index, count); }
+    void toLowerCase();
+    void toUpperCase();
+    void trim();
+
+    long toInt() const { return atol(s.c_str()); }
+    float toFloat() const { return (float)atof(s.c_str()); }
+    double toDouble() const { return atof(s.c_str()); }
+
+private:
+    std::string s;
+};
+
+class StringSumHelper : public String {
+public:
+    StringSumHelper(const String& str) : String(str) {}
+    StringSumHelper(const char* cstr) : String(cstr) {}
+    StringSumHelper(char c) : String(c) {}
+    StringSumHelper(unsigned char value) : String(value) {}
+    StringSumHelper(int value) : String(value) {}
+    StringSumHelper(unsigned int value) : String(value) {}
+    StringSumHelper(long value) : String(value) {}
+    StringSumHelper(unsigned long value) : String(value) {}
+    StringSumHelper(float value) : String(value) {}
+    StringSumHelper(double value) : String(value) {}
+};
+
+#endif // HOST_WSTRING_H
@@ -0,0 +1,38 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+// Always disconnected: config fetches and NTP syncs bail out early
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+// Event callback types, for headers that declare handlers
+typedef int arduino_event_id_t;
+typedef struct {} arduino_event_info_t;
+
+class IPAddress {
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : octets{a, b, c, d} {}
+    String toString() const;
+
+private:
+    uint8_t octets[4];
+};
+
+class HostWiFi {
+public:
+    wl_status_t status() const { return WL_DISCONNECTED; }
+    IPAddress localIP() const { return IPAddress(); }
+    IPAddress softAPIP() const { return IPAddress(192, 168, 4, 1); }
+    String macAddress() const { return "02:00:00:00:00:01"; }
+};
+
+extern HostWiFi WiFi;
+
+#endif // HOST_WIFI_H
@@ -0,0 +1,16 @@
+#ifndef HOST_WIFICLIENT_H
+#define HOST_WIFICLIENT_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+// No network on the host; a client never connects
+class WiFiClient {
+public:
+    virtual ~WiFiClient() {}
+    virtual int connect(IPAddress, uint16_t, int32_t) { return 0; }
+    virtual uint8_t connected() { return 0; }
+    virtual void stop() {}
+};
+
+#endif // HOST_WIFICLIENT_H
@@ -0,0 +1,13 @@
+#ifndef HOST_WIFICLIENTSECURE_H
+#define HOST_WIFICLIENTSECURE_H
+
+#include <WiFiClient.h>
+
+// No TLS on the host; like WiFiClient it never connects
+class WiFiClientSecure : public WiFiClient {
+public:
+    void setCACert(const char*) {}
+    void setInsecure() {}
+};
+
+#endif // HOST_WIFICLIENTSECURE_H
@@ -0,0 +1,16 @@
+#ifndef HOST_ESP_PARTITION_H
+#define HOST_ESP_PARTITION_H
+
+#include <stdint.h>
+
+// Just the types icon_pack.h names; the host has no flash partitions
+
+typedef uint32_t spi_flash_mmap_handle_t;
+
+typedef struct {
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+} esp_partition_t;
+
+#endif // HOST_ESP_PARTITION_H
@@ -0,0 +1,35 @@
+#include "ambient_light.h"
+
+// Host stand-in: no sensor and no server readings, so the schedule rules
+
+// Global instance
+AmbientLight ambientLight;
+
+AmbientLight::AmbientLight()
+    : wire(nullptr)
+    , address(0)
+    , job(-1)
+    , filteredLogQ8(0)
+    , primed(false)
+    , level(-1)
+    , lastReadingAt(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , submittedLux(0)
+    , submitted(false)
+{
+}
+
+void AmbientLight::begin(TwoWire& bus) {
+    wire = &bus;
+}
+
+void AmbientLight::submitLux(uint32_t lux) {
+}
+
+int16_t AmbientLight::getLevel() const {
+    return -1;
+}
+
+uint32_t AmbientLight::getLux() const {
+    return 0;
+}
@@ -0,0 +1,287 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_timer.h>
+#include <chrono>
+#include <thread>
+#include <ctype.h>
+
+// Global instances
+HostSerial Serial;
+HostWiFi WiFi;
+
+// ============================================================================
+// Timing
+// ============================================================================
+
+unsigned long millis() {
+    return (unsigned long)(esp_timer_get_time() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)esp_timer_get_time();
+}
+
+void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+bool getLocalTime(struct tm* info, uint32_t) {
+    time_t now = time(nullptr);
+    return localtime_r(&now, info) != nullptr;
+}
+
+void configTzTime(const char* tz, const char*, const char*, const char*) {
+    setenv("TZ", tz, 1);
+    tzset();
+}
+
+// ============================================================================
+// Print / Serial
+// ============================================================================
+
+size_t Print::write(const uint8_t* data, size_t size) {
+    size_t n = 0;
+    while (size--) {
+        if (!write(*data++)) {
+            break;
+        }
+        n++;
+    }
+    return n;
+}
+
+size_t Print::printf(const char* format, ...) {
+    char stackBuf[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(stackBuf, sizeof(stackBuf), format, args);
+    va_end(args);
+    if (len < 0) {
+        return 0;
+    }
+    if ((size_t)len < sizeof(stackBuf)) {
+        return write((const uint8_t*)stackBuf, len);
+    }
+
+    std::string heapBuf(len + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&heapBuf[0], heapBuf.size(), format, args);
+    va_end(args);
+    return write((const uint8_t*)heapBuf.data(), len);
+}
+
+size_t HostSerial::write(uint8_t c) {
+    if (!quiet) {
+        fputc(c, stderr);
+    }
+    return 1;
+}
+
+size_t HostSerial::write(const uint8_t* data, size_t size) {
+    if (!quiet) {
+        fwrite(data, 1, size, stderr);
+    }
+    return size;
+}
+
+String IPAddress::toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+    return String(buf);
+}
+
+// ============================================================================
+// String
+// ============================================================================
+
+static std::string formatInteger(unsigned long long value, bool negative, unsigned char base) {
+    if (base < 2 || base > 36) {
+        base = 10;
+    }
+    char buf[72];
+    char* p = buf + sizeof(buf);
+    *--p = '\0';
+    do {
+        unsigned digit = value % base;
+        *--p = digit < 10 ? '0' + digit : 'a' + digit - 10;
+        value /= base;
+    } while (value);
+    if (negative) {
+        *--p = '-';
+    }
+    return p;
+}
+
+// Negative values in a non-decimal base print as two's complement, as on Arduino
+#define SIGNED_TO_STRING(value, base, unsignedType) \
+    ((base) == 10 ? formatInteger((value) < 0 ? -(long long)(value) : (value), (value) < 0, 10) \
+                  : formatInteger((unsignedType)(value), false, (base)))
+
+String::String(unsigned char value, unsigned char base) : s(formatInteger(value, false, base)) {}
+String::String(int value, unsigned char base) : s(SIGNED_TO_STRING(value, base, unsigned int)) {}
+String::String(unsigned int value, unsigned char base) : s(formatInteger(value, false, base)) {}
+String::String(long value, unsigned char base) : s(SIGNED_TO_STRING(value, base, unsigned long)) {}
+String::String(unsigned long value, unsigned char base) : s(formatInteger(value, false, base)) {}
+
+String::String(float value, unsigned int decimals) : String((double)value, decimals) {}
+
+String::String(double value, unsigned int decimals) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, value);
+    s = buf;
+}
+
+StringSumHelper& operator+(const StringSumHelper& lhs, const String& rhs) {
+    StringSumHelper& a = const_cast<StringSumHelper&>(lhs);
+    a.concat(rhs);
+    return a;
+}
+
+StringSumHelper& operator+(const StringSumHelper& lhs, const char* cstr) {
+    StringSumHelper& a = const_cast<StringSumHelper&>(lhs);
+    a.concat(cstr);
+    return a;
+}
+
+StringSumHelper& operator+(const StringSumHelper& lhs, char c) {
+    StringSumHelper& a = const_cast<StringSumHelper&>(lhs);
+    a.concat(c);
+    return a;
+}
+
+StringSumHelper& operator+(const StringSumHelper& lhs, unsigned char value) {
+    StringSumHelper& a = const_cast<StringSumHelper&>(lhs);
+    a.concat(value);
+    return a;
+}
+
+StringSumHelper& operator+(const StringSumHelper& lhs, int value) {
+    StringSumHelper& a = const_cast<StringSumHelper&>(lhs);
+    a.concat(value);
+    return a;
+}
+
+StringSumHelper& operator+(const StringSumHelper& lhs, unsigned int value) {
+    StringSumHelper& a = const_cast<StringSumHelper&>(lhs);
+    a.concat(value);
+    return a;
+}
+
+StringSumHelper& operator+(const StringSumHelper& lhs, long value) {
+    StringSumHelper& a = const_cast<StringSumHelper&>(lhs);
+    a.concat(value);
+    return a;
+}
+
+StringSumHelper& operator+(const StringSumHelper& lhs, unsigned long value) {
+    StringSumHelper& a = const_cast<StringSumHelper&>(lhs);
+    a.concat(value);
+    return a;
+}
+
+StringSumHelper& operator+(const StringSumHelper& lhs, float value) {
+    StringSumHelper& a = const_cast<StringSumHelper&>(lhs);
+    a.concat(value);
+    return a;
+}
+
+StringSumHelper& operator+(const StringSumHelper& lhs, double value) {
+    StringSumHelper& a = const_cast<StringSumHelper&>(lhs);
+    a.concat(value);
+    return a;
+}
+
+bool String::equalsIgnoreCase(const String& other) const {
+    if (s.size() != other.s.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < s.size(); i++) {
+        if (tolower((unsigned char)s[i]) != tolower((unsigned char)other.s[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool String::endsWith(const String& suffix) const {
+    return s.size() >= suffix.s.size() &&
+           s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    size_t pos = s.find(c, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String& str, unsigned int from) const {
+    size_t pos = s.find(str.s, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char c) const {
+    size_t pos = s.rfind(c);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(const String& str) const {
+    size_t pos = s.rfind(str.s);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+    if (beginIndex > endIndex) {
+        std::swap(beginIndex, endIndex);
+    }
+    if (beginIndex >= s.size()) {
+        return String();
+    }
+    if (endIndex > s.size()) {
+        endIndex = s.size();
+    }
+    String out;
+    out.s = s.substr(beginIndex, endIndex - beginIndex);
+    return out;
+}
+
+void String::replace(char find, char replacement) {
+    std::replace(s.begin(), s.end(), find, replacement);
+}
+
+void String::replace(const String& find, const String& replacement) {
+    if (find.s.empty()) {
+        return;
+    }
+    size_t pos = 0;
+    while ((pos = s.find(find.s, pos)) != std::string::npos) {
+        s.replace(pos, find.s.size(), replacement.s);
+        pos += replacement.s.size();
+    }
+}
+
+void String::toLowerCase() {
+    for (char& c : s) {
+        c = tolower((unsigned char)c);
+    }
+}
+
+void String::toUpperCase() {
+    for (char& c : s) {
+        c = toupper((unsigned char)c);
+    }
+}
+
+void String::trim() {
+    size_t first = 0;
+    while (first < s.size() && isspace((unsigned char)s[first])) {
+        first++;
+    }
+    size_t last = s.size();
+    while (last > first && isspace((unsigned char)s[last - 1])) {
+        last--;
+    }
+    s = s.substr(first, last - first);
+}
@@ -0,0 +1,29 @@
+#include "background_anim.h"
+
+// Host stand-in: no uploads, so screens never get a background
+
+// Global instance
+BackgroundAnimation backgroundAnim;
+
+BackgroundAnimation::BackgroundAnimation()
+    : anim(nullptr)
+    , timer(nullptr)
+    , framesShown(0)
+    , framesSkipped(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , state(State::IDLE)
+    , error(nullptr)
+    , staging(nullptr)
+    , size(0)
+    , received(0)
+    , decodeMs(0)
+{
+    memset(images, 0, sizeof(images));
+}
+
+void BackgroundAnimation::attach(lv_obj_t* screen) {
+}
+
+void BackgroundAnimation::writeJson(Print& out) const {
+    out.print("{\"state\":\"idle\",\"received\":0,\"size\":0,\"decode_ms\":0,\"frames_shown\":0,\"frames_skipped\":0}");
+}
@@ -0,0 +1,39 @@
+#include "backlight.h"
+
+// Host stand-in for the LEDC backlight: records the level, drives nothing
+
+// Global instance
+Backlight backlight;
+
+Backlight::Backlight()
+    : lock(nullptr)
+    , channel(0)
+    , ready(false)
+    , level(0)
+    , pendingLevel(0)
+    , pendingFadeMs(0)
+    , pending(false)
+    , fadeEndsAt(0)
+    , fadeJob(-1)
+{
+    memset(gammaDuty, 0, sizeof(gammaDuty));
+}
+
+void Backlight::begin(uint8_t pin, uint8_t ch) {
+    channel = ch;
+    ready = true;
+}
+
+uint32_t Backlight::getDuty() const {
+    return 0;
+}
+
+void Backlight::set(uint8_t brightness, uint32_t fadeMs) {
+    level = brightness > 100 ? 100 : brightness;
+}
+
+void Backlight::wake(uint8_t brightness) {
+    if (level < brightness) {
+        level = brightness;
+    }
+}
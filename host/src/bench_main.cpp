@@ -0,0 +1,358 @@
+// Host microbenchmarks for the config, theme and UI modules (pio run -e native).
+//
+// The firmware's ConfigManager, ThemeEngine and UIManager run unchanged
+// against a headless LVGL display the size of the panel. For every theme and
+// 1..MAX_PAGE_CARDS buttons this measures:
+//   - parseConfigJson() on the generated config (the server's wire schema),
+//     copying and zero-copy
+//   - the first rebuild after the config change, warm rebuilds (pooled
+//     cards) and no-op reconciles, with the object count and LVGL pool use
+//   - style application: ThemeEngine::styleCard() on a scratch card and
+//     UIManager::refreshAllButtons() over the live cards
+//   - rendering one full frame
+// The report is JSON on stdout; firmware logging goes to stderr (-v).
+//
+// Host numbers don't predict device timings, but they track the amount of
+// work per operation, so compare runs from the same machine.
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <esp_timer.h>
+#include <vector>
+#include "config_manager.h"
+#include "theme_engine.h"
+#include "ui_manager.h"
+#include "lvgl_task.h"
+#include "theme_transition.h"
+#include "perf_monitor.h"
+
+#define SCREEN_WIDTH 480
+#define SCREEN_HEIGHT 480
+
+static const uint8_t THEME_COUNT = 4;
+
+static const char* const THEME_NAMES[THEME_COUNT] = {
+    "light_mode",
+    "dark_mode",
+    "neon_cyberpunk",
+    "lcars"
+};
+static const uint8_t THEME_LCARS = 3;
+
+// Same mix as the on-device benchmark: symbol and image icons, every third a fan
+static const char* const BENCH_ICONS[] = {
+    "light", "power", "fan", "bulb", "home", "fan", "moon", "sun", "fan"
+};
+
+// styleCard() is far below a microsecond; time it in batches
+static const uint32_t STYLE_BATCH = 64;
+
+static const uint32_t DEFAULT_ITERATIONS = 100;
+
+// ============================================================================
+// Headless display
+// ============================================================================
+
+static lv_disp_draw_buf_t drawBuf;
+static lv_disp_drv_t dispDrv;
+static lv_color_t* frameBuf;
+static uint32_t flushedPixels;
+
+static void headlessFlush(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t*) {
+    flushedPixels += lv_area_get_size(area);
+    lv_disp_flush_ready(drv);
+}
+
+// Same buffer layout as the panel: one full frame, drawn in place
+static bool setupDisplay() {
+    uint32_t pixels = SCREEN_WIDTH * SCREEN_HEIGHT;
+    frameBuf = (lv_color_t*)malloc(sizeof(lv_color_t) * pixels);
+    if (!frameBuf) {
+        return false;
+    }
+    lv_disp_draw_buf_init(&drawBuf, frameBuf, nullptr, pixels);
+
+    lv_disp_drv_init(&dispDrv);
+    dispDrv.hor_res = SCREEN_WIDTH;
+    dispDrv.ver_res = SCREEN_HEIGHT;
+    dispDrv.flush_cb = headlessFlush;
+    dispDrv.draw_buf = &drawBuf;
+    dispDrv.direct_mode = 1;
+    return lv_disp_drv_register(&dispDrv) != nullptr;
+}
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+static String buildConfig(uint8_t theme, uint8_t buttons) {
+    DynamicJsonDocument doc(4096);
+
+    doc["schema"] = CONFIG_WIRE_SCHEMA;
+    doc["version"] = 1;
+    JsonObject device = doc.createNestedObject("device");
+    device["id"] = "esp32-native";
+    device["name"] = "UI Bench";
+    device["location"] = "Bench";
+
+    // Schedules off so nothing but the config picks the theme
+    JsonObject display = doc.createNestedObject("display");
+    display["brightness"] = 80;
+    display["theme"] = THEME_NAMES[theme];
+    display["dayNightMode"]["enabled"] = false;
+    display["brightnessSchedule"]["enabled"] = false;
+    display["lcars"]["enabled"] = theme == THEME_LCARS;
+
+    JsonArray list = doc.createNestedArray("buttons");
+    for (uint8_t i = 1; i <= buttons; i++) {
+        JsonObject b = list.createNestedObject();
+        b["i"] = i;
+        b["n"] = String("Bench ") + i;
+        b["ic"] = BENCH_ICONS[(i - 1) % (sizeof(BENCH_ICONS) / sizeof(BENCH_ICONS[0]))];
+        if (i % 3 == 0) {
+            b["t"] = "fan";
+            b["ss"] = 3;
+        } else {
+            b["t"] = (i % 2) ? "light" : "switch";
+        }
+    }
+
+    JsonArray scenes = doc.createNestedArray("scenes");
+    JsonObject evening = scenes.createNestedObject();
+    evening["i"] = 1;
+    evening["n"] = "Evening";
+    evening["ic"] = "moon";
+    JsonObject morning = scenes.createNestedObject();
+    morning["i"] = 2;
+    morning["n"] = "Morning";
+    morning["ic"] = "sun";
+
+    doc["server"]["reportingUrl"] = "http://127.0.0.1:3000";
+
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
+
+static uint32_t elapsedUs(int64_t start) {
+    return (uint32_t)(esp_timer_get_time() - start);
+}
+
+static uint32_t countObjects(lv_obj_t* obj) {
+    uint32_t n = 1;
+    uint32_t children = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < children; i++) {
+        n += countObjects(lv_obj_get_child(obj, i));
+    }
+    return n;
+}
+
+static uint32_t renderFullFrame() {
+    lv_obj_invalidate(lv_scr_act());
+    int64_t start = esp_timer_get_time();
+    lv_refr_now(nullptr);
+    return elapsedUs(start);
+}
+
+class StdoutPrint : public Print {
+public:
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+    size_t write(const uint8_t* data, size_t size) override { return fwrite(data, 1, size, stdout); }
+};
+
+static void printSummary(Print& out, const char* name, std::vector<uint32_t>& samples) {
+    PerfSummary s = PerfMonitor::summarizeSamples(samples.data(), samples.size(), samples.size());
+    out.printf("\"%s\":{\"count\":%u,\"min\":%u,\"p50\":%u,\"p95\":%u,\"p99\":%u,\"max\":%u,\"avg\":%u}",
+               name, s.count, s.min, s.p50, s.p95, s.p99, s.max, s.avg);
+}
+
+// ============================================================================
+// Scenarios
+// ============================================================================
+
+static bool runScenario(Print& out, uint8_t theme, uint8_t buttons, uint32_t iterations) {
+    String json = buildConfig(theme, buttons);
+    std::vector<char> scratch(json.length() + 1);
+    std::vector<uint32_t> samples;
+    samples.reserve(iterations);
+
+    out.printf("{\"theme\":\"%s\",\"buttons\":%u,\"config_bytes\":%u,",
+               THEME_NAMES[theme], buttons, json.length());
+
+    // Parse: the last iteration leaves this config applied
+    for (uint32_t i = 0; i < iterations; i++) {
+        int64_t start = esp_timer_get_time();
+        if (!configManager.parseConfigJson(json)) {
+            out.printf("\"error\":\"%s\"}", configManager.getLastParseError());
+            return false;
+        }
+        samples.push_back(elapsedUs(start));
+    }
+    printSummary(out, "parse_us", samples);
+    out.print(",");
+
+    samples.clear();
+    for (uint32_t i = 0; i < iterations; i++) {
+        // Zero-copy parsing writes into its input
+        memcpy(scratch.data(), json.c_str(), json.length() + 1);
+        int64_t start = esp_timer_get_time();
+        if (!configManager.parseConfigJson(scratch.data(), json.length())) {
+            out.printf("\"error\":\"%s\"}", configManager.getLastParseError());
+            return false;
+        }
+        samples.push_back(elapsedUs(start));
+    }
+    printSummary(out, "parse_zero_copy_us", samples);
+
+    // First pass after the config change: reconcile if the layout allows,
+    // otherwise a rebuild that can't reuse the previous theme's cards
+    int64_t start = esp_timer_get_time();
+    bool full = !uiManager.reconcileUI();
+    if (full) {
+        uiManager.rebuildUI();
+    }
+    uint32_t firstUs = elapsedUs(start);
+
+    lv_mem_monitor_t mem;
+    lv_mem_monitor(&mem);
+    out.printf(",\"first\":{\"us\":%u,\"full_rebuild\":%s,\"objects\":%u,"
+               "\"lvgl_used\":%u,\"lvgl_max_used\":%u,\"lvgl_frag_pct\":%u},",
+               firstUs, full ? "true" : "false", countObjects(lv_scr_act()),
+               (unsigned)(mem.total_size - mem.free_size), (unsigned)mem.max_used, mem.frag_pct);
+
+    samples.clear();
+    for (uint32_t i = 0; i < iterations; i++) {
+        start = esp_timer_get_time();
+        uiManager.rebuildUI();
+        samples.push_back(elapsedUs(start));
+    }
+    printSummary(out, "rebuild_us", samples);
+    out.print(",");
+
+    samples.clear();
+    for (uint32_t i = 0; i < iterations; i++) {
+        start = esp_timer_get_time();
+        if (!uiManager.reconcileUI()) {
+            out.print("\"error\":\"reconcile fell back to a rebuild for an unchanged config\"}");
+            return false;
+        }
+        samples.push_back(elapsedUs(start));
+    }
+    printSummary(out, "reconcile_us", samples);
+    out.print(",");
+
+    // Style application
+    lv_obj_t* card = lv_obj_create(lv_scr_act());
+    samples.clear();
+    for (uint32_t i = 0; i < iterations; i++) {
+        start = esp_timer_get_time();
+        for (uint32_t j = 0; j < STYLE_BATCH; j++) {
+            themeEngine.styleCard(card, j & 1, j % MAX_PAGE_CARDS);
+        }
+        samples.push_back((uint32_t)((esp_timer_get_time() - start) * 1000 / STYLE_BATCH));
+    }
+    lv_obj_del(card);
+    printSummary(out, "style_card_ns", samples);
+    out.print(",");
+
+    samples.clear();
+    for (uint32_t i = 0; i < iterations; i++) {
+        start = esp_timer_get_time();
+        uiManager.refreshAllButtons();
+        samples.push_back(elapsedUs(start));
+    }
+    printSummary(out, "refresh_buttons_us", samples);
+    out.print(",");
+
+    samples.clear();
+    flushedPixels = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        samples.push_back(renderFullFrame());
+    }
+    printSummary(out, "render_us", samples);
+    out.printf(",\"flushed_px\":%u}", flushedPixels);
+    return true;
+}
+
+// ============================================================================
+// Entry point
+// ============================================================================
+
+static void usage(const char* argv0) {
+    fprintf(stderr, "usage: %s [-n iterations] [-t theme] [-v]\n", argv0);
+    fprintf(stderr, "  -n  repetitions per measurement (default %u)\n", DEFAULT_ITERATIONS);
+    fprintf(stderr, "  -t  only this theme (light_mode, dark_mode, neon_cyberpunk, lcars)\n");
+    fprintf(stderr, "  -v  show firmware logging on stderr\n");
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = DEFAULT_ITERATIONS;
+    int onlyTheme = -1;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+            iterations = strtoul(argv[++i], nullptr, 10);
+        } else if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+            const char* name = argv[++i];
+            for (uint8_t t = 0; t < THEME_COUNT; t++) {
+                if (!strcmp(name, THEME_NAMES[t])) {
+                    onlyTheme = t;
+                }
+            }
+            if (onlyTheme < 0) {
+                usage(argv[0]);
+                return 2;
+            }
+        } else if (!strcmp(argv[i], "-v")) {
+            verbose = true;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (iterations == 0) {
+        iterations = 1;
+    }
+
+    Serial.setQuiet(!verbose);
+
+    lv_init();
+    if (!setupDisplay()) {
+        fprintf(stderr, "Bench: Failed to allocate the frame buffer\n");
+        return 1;
+    }
+
+    // Same bring-up order as setup(), minus the hardware
+    configManager.begin();
+    themeTransition.setEnabled(false);  // Measured rebuilds don't fade
+    themeEngine.begin();
+    uiManager.begin();
+    uiManager.createUI();
+    lv_refr_now(nullptr);
+    lvglTask.begin();
+
+    StdoutPrint out;
+    out.printf("{\"lvgl\":\"%d.%d.%d\",\"lv_mem_size\":%u,\"screen\":[%d,%d],"
+               "\"iterations\":%u,\"style_batch\":%u,\"scenarios\":[",
+               LVGL_VERSION_MAJOR, LVGL_VERSION_MINOR, LVGL_VERSION_PATCH,
+               (unsigned)LV_MEM_SIZE, SCREEN_WIDTH, SCREEN_HEIGHT, iterations, STYLE_BATCH);
+
+    bool ok = true;
+    bool first = true;
+    for (uint8_t theme = 0; theme < THEME_COUNT && ok; theme++) {
+        if (onlyTheme >= 0 && theme != onlyTheme) {
+            continue;
+        }
+        for (uint8_t buttons = 1; buttons <= MAX_PAGE_CARDS && ok; buttons++) {
+            if (!first) {
+                out.print(",");
+            }
+            first = false;
+            ok = runScenario(out, theme, buttons, iterations);
+        }
+    }
+    out.print("]}\n");
+    fflush(stdout);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,27 @@
+#include "crash_report.h"
+
+// Host stand-in: no core dump and nothing survives a reset
+
+// Global instance
+CrashReport crashReport;
+
+CrashReport::CrashReport()
+    : pending(false)
+    , haveDump(false)
+{
+    report[0] = '\0';
+}
+
+void CrashReport::begin() {
+}
+
+void CrashReport::noteHeap(const HeapSample& sample) {
+}
+
+bool CrashReport::upload(const String& reportingUrl, const String& deviceId) {
+    return false;
+}
+
+void CrashReport::writeJson(Print& out) const {
+    out.print("{\"pending\":false}");
+}
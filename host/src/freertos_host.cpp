@@ -0,0 +1,179 @@
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <esp_timer.h>
+#include <esp_rom_crc.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// ============================================================================
+// Critical sections
+// ============================================================================
+// On the device a critical section masks interrupts on the calling core;
+// one recursive mutex gives the same mutual exclusion between threads.
+
+static std::recursive_mutex& criticalMutex() {
+    static std::recursive_mutex mutex;
+    return mutex;
+}
+
+void hostEnterCritical() {
+    criticalMutex().lock();
+}
+
+void hostExitCritical() {
+    criticalMutex().unlock();
+}
+
+// ============================================================================
+// Tasks
+// ============================================================================
+
+struct HostTask {
+    TaskFunction_t fn;
+    void* parameter;
+    std::mutex mutex;
+    std::condition_variable notified;
+    uint32_t notifyCount;
+};
+
+static thread_local HostTask* currentTask = nullptr;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char*, uint32_t,
+                                   void* parameter, UBaseType_t,
+                                   TaskHandle_t* handle, BaseType_t) {
+    HostTask* task = new HostTask();
+    task->fn = fn;
+    task->parameter = parameter;
+    task->notifyCount = 0;
+    if (handle) {
+        *handle = task;
+    }
+
+    // Tasks never return in this project; the thread lives as long as the process
+    std::thread([task]() {
+        currentTask = task;
+        task->fn(task->parameter);
+    }).detach();
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stackDepth,
+                       void* parameter, UBaseType_t priority, TaskHandle_t* handle) {
+    return xTaskCreatePinnedToCore(fn, name, stackDepth, parameter, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelay(TickType_t ticks) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+void vTaskDelete(TaskHandle_t) {
+    // Only used as vTaskDelete(NULL) at the end of a task; let the thread run out
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)(esp_timer_get_time() / 1000);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return currentTask;
+}
+
+void xTaskNotifyGive(TaskHandle_t handle) {
+    if (!handle) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(handle->mutex);
+    handle->notifyCount++;
+    handle->notified.notify_one();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+    HostTask* task = currentTask;
+    if (!task) {
+        vTaskDelay(ticks == portMAX_DELAY ? 0 : ticks);
+        return 0;
+    }
+
+    std::unique_lock<std::mutex> lock(task->mutex);
+    auto ready = [task]() { return task->notifyCount > 0; };
+    if (ticks == portMAX_DELAY) {
+        task->notified.wait(lock, ready);
+    } else {
+        task->notified.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+    }
+
+    uint32_t count = task->notifyCount;
+    if (count) {
+        task->notifyCount = clearOnExit ? 0 : count - 1;
+    }
+    return count;
+}
+
+// ============================================================================
+// Semaphores (mutexes only)
+// ============================================================================
+
+struct HostSemaphore {
+    std::recursive_timed_mutex mutex;
+};
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return new HostSemaphore();
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+    return new HostSemaphore();
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return nullptr;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {
+    delete sem;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    if (ticks == portMAX_DELAY) {
+        sem->mutex.lock();
+        return pdTRUE;
+    }
+    return sem->mutex.try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    sem->mutex.unlock();
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticks) {
+    return xSemaphoreTake(sem, ticks);
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem) {
+    return xSemaphoreGive(sem);
+}
+
+// ============================================================================
+// ESP-IDF helpers
+// ============================================================================
+
+int64_t esp_timer_get_time() {
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len) {
+    crc = ~crc;
+    while (len--) {
+        crc ^= *buf++;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
@@ -0,0 +1,36 @@
+#include "http_pool.h"
+#include <HTTPClient.h>
+
+// Host stand-in: no network, every request fails to connect
+
+// Global instance
+HttpConnectionPool httpPool;
+
+HttpConnectionPool::HttpConnectionPool()
+    : mutex(nullptr)
+    , caCert(nullptr)
+    , retiredCaCert(nullptr)
+    , resolveMux(portMUX_INITIALIZER_UNLOCKED)
+{
+}
+
+void HttpConnectionPool::begin() {
+}
+
+int HttpConnectionPool::post(const char* url, const char* payload, uint16_t timeoutMs, String* response) {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+}
+
+int HttpConnectionPool::get(const char* url, uint16_t timeoutMs, String* response) {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+}
+
+int HttpConnectionPool::put(const char* url, const char* payload, const char* authorization, uint16_t timeoutMs) {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+}
+
+void HttpConnectionPool::closeAll() {
+}
+
+void HttpConnectionPool::setCACert(const char* pem) {
+}
@@ -0,0 +1,43 @@
+#include "icon_pack.h"
+
+// Host stand-in: no icons partition, so only the built-in icons
+
+// Global instance
+IconPack iconPack;
+
+IconPack::IconPack()
+    : partition(nullptr)
+    , bankSize(0)
+    , activeBank(-1)
+    , retiredBank(-1)
+    , retireAfter(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , state(State::IDLE)
+    , error(nullptr)
+    , staging(nullptr)
+    , size(0)
+    , received(0)
+    , startedAt(0)
+    , installMs(0)
+{
+    memset(banks, 0, sizeof(banks));
+}
+
+void IconPack::begin() {
+}
+
+bool IconPack::releaseRetired(uint32_t generation) {
+    return false;
+}
+
+const lv_img_dsc_t* IconPack::image(IconId id) const {
+    return nullptr;
+}
+
+IconId IconPack::lookup(const char* name) {
+    return IconId::COUNT;
+}
+
+void IconPack::writeJson(Print& out) const {
+    out.print("{\"state\":\"idle\",\"partition\":false}");
+}
@@ -0,0 +1,68 @@
+#include "lvgl_task.h"
+
+// Host stand-in for the LVGL render task: the bench drives lv_timer_handler()
+// on its own thread, so only the lock is real
+
+// Global instance
+LVGLTask lvglTask;
+
+LVGLTask::LVGLTask()
+    : mutex(nullptr)
+    , taskHandle(nullptr)
+    , lastTick(0)
+    , powerSave(false)
+    , darkRequested(false)
+    , darkActive(false)
+    , scanoutStopped(false)
+    , updateMode(false)
+    , scanoutControl(nullptr)
+    , frameCount(nullptr)
+    , frameNotify(nullptr)
+    , lastFrame(0)
+{
+}
+
+void LVGLTask::begin() {
+    if (!mutex) {
+        mutex = xSemaphoreCreateRecursiveMutex();
+    }
+    lastTick = millis();
+}
+
+bool LVGLTask::lock(uint32_t timeoutMs) {
+    if (!mutex) return true;
+
+    TickType_t ticks = (timeoutMs == UINT32_MAX) ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+    return xSemaphoreTakeRecursive(mutex, ticks) == pdTRUE;
+}
+
+void LVGLTask::unlock() {
+    if (mutex) {
+        xSemaphoreGiveRecursive(mutex);
+    }
+}
+
+void LVGLTask::wake() {
+}
+
+void LVGLTask::setPowerSave(bool enabled) {
+    powerSave = enabled;
+}
+
+void LVGLTask::setUpdateMode(bool enabled) {
+    updateMode = enabled;
+}
+
+void LVGLTask::setDarkIdle(bool dark) {
+    darkRequested = dark;
+}
+
+LVGLLock::LVGLLock() {
+    locked = lvglTask.lock();
+}
+
+LVGLLock::~LVGLLock() {
+    if (locked) {
+        lvglTask.unlock();
+    }
+}
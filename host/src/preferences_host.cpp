@@ -0,0 +1,102 @@
+#include <Preferences.h>
+#include <map>
+#include <mutex>
+#include <vector>
+
+// namespace -> key -> value; NVS keeps strings and blobs in the same key
+// space, so one map does too
+typedef std::map<std::string, std::vector<uint8_t>> PrefsNamespace;
+
+static std::mutex storeMutex;
+
+static std::map<std::string, PrefsNamespace>& store() {
+    static std::map<std::string, PrefsNamespace> namespaces;
+    return namespaces;
+}
+
+bool Preferences::begin(const char* name, bool ro) {
+    if (!name || !*name) {
+        return false;
+    }
+    ns = name;
+    readOnly = ro;
+    opened = true;
+    return true;
+}
+
+bool Preferences::clear() {
+    if (!opened || readOnly) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(storeMutex);
+    store()[ns].clear();
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    if (!opened || readOnly) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(storeMutex);
+    return store()[ns].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+    if (!opened) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(storeMutex);
+    return store()[ns].count(key) > 0;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+    if (!opened || readOnly || !key || (!value && len)) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(storeMutex);
+    const uint8_t* bytes = (const uint8_t*)value;
+    store()[ns][key] = std::vector<uint8_t>(bytes, bytes + len);
+    return len;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    if (!opened) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(storeMutex);
+    PrefsNamespace& entries = store()[ns];
+    auto it = entries.find(key);
+    return it == entries.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+    if (!opened) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(storeMutex);
+    PrefsNamespace& entries = store()[ns];
+    auto it = entries.find(key);
+    if (it == entries.end() || it->second.size() > maxLen) {
+        return 0;
+    }
+    memcpy(buf, it->second.data(), it->second.size());
+    return it->second.size();
+}
+
+size_t Preferences::putString(const char* key, const String& value) {
+    // Stored with its terminator, as NVS does
+    return putBytes(key, value.c_str(), value.length() + 1) ? value.length() : 0;
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) {
+    if (!opened) {
+        return defaultValue;
+    }
+    std::lock_guard<std::mutex> lock(storeMutex);
+    PrefsNamespace& entries = store()[ns];
+    auto it = entries.find(key);
+    if (it == entries.end() || it->second.empty()) {
+        return defaultValue;
+    }
+    return String((const char*)it->second.data(), it->second.size() - 1);
+}
@@ -0,0 +1,31 @@
+#include "stall_monitor.h"
+
+// Host stand-in: no monitor task and no backtraces, the marks are no-ops
+
+// Global instance
+StallMonitor stallMonitor;
+
+StallMonitor::StallMonitor()
+    : head(0)
+    , count(0)
+    , total(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+{
+    memset(watches, 0, sizeof(watches));
+}
+
+void StallMonitor::begin() {
+}
+
+void StallMonitor::attach(StallWatch watch) {
+}
+
+void StallMonitor::enter(StallWatch watch, const char* tag) {
+}
+
+void StallMonitor::leave(StallWatch watch) {
+}
+
+void StallMonitor::writeJson(Print& out) const {
+    out.print("{\"total\":0,\"tasks\":[],\"stalls\":[]}");
+}
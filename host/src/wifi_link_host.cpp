@@ -0,0 +1,50 @@
+#include "wifi_link.h"
+
+// Host stand-in: never connects, only tracks the profile the scheduler picks
+
+// Global instance
+WiFiLink wifiLink;
+
+WiFiLink::WiFiLink()
+    : cachedChannel(0)
+    , job(-1)
+    , state(State::IDLE)
+    , attemptDirected(false)
+    , everConnected(false)
+    , apStarted(false)
+    , failures(0)
+    , attemptStartedAt(0)
+    , retryAt(0)
+    , lastConnectMs(0)
+    , lastConnectDirected(false)
+    , reconnects(0)
+    , dim(false)
+    , boost(false)
+    , appliedProfile(WifiProfile::BALANCED)
+    , profileApplied(false)
+    , profileMux(portMUX_INITIALIZER_UNLOCKED)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , gotIp(false)
+    , lost(false)
+    , lostReason(0)
+{
+    memset(cachedBssid, 0, sizeof(cachedBssid));
+}
+
+void WiFiLink::begin() {
+}
+
+const char* WiFiLink::stateName() const {
+    return "idle";
+}
+
+void WiFiLink::setDim(bool isDim) {
+    dim = isDim;
+    applyProfile();
+}
+
+void WiFiLink::applyProfile() {
+    const NetworkConfig& network = configManager.getConfig().network;
+    appliedProfile = dim ? network.dimProfile : network.wifiProfile;
+    profileApplied = true;
+}
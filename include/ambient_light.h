@@ -0,0 +1,75 @@
+#ifndef AMBIENT_LIGHT_H
+#define AMBIENT_LIGHT_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+class TwoWire;
+
+// Adaptive brightness from the room's light level.
+//
+// The level comes from a BH1750 ambient light sensor on the touch
+// controller's I2C bus, if one answers at begin(), or from the server
+// (POST /api/ambient, or an "ambient" WebSocket message). Readings are
+// filtered in the log domain, where the eye works, with integer math only:
+// log2(lux) in Q8 via the leading-zero count, then an exponential moving
+// average with one shift per sample. The filtered value maps linearly onto
+// the configured minBrightness..maxBrightness between 1 lux and luxAtMax.
+//
+// The mapped level only changes once it has moved HYSTERESIS_PCT, so
+// lamp flicker or a passing shadow doesn't keep the fade engine busy.
+// BrightnessScheduler owns the backlight and takes the level as a ceiling
+// on the schedule, or as the brightness when no schedule is enabled.
+class AmbientLight {
+public:
+    AmbientLight();
+
+    // Probe for the sensor (after Wire.begin) and register the sampling job
+    void begin(TwoWire& wire);
+
+    // Any task: a lux reading measured elsewhere, taken as already smoothed
+    void submitLux(uint32_t lux);
+
+    // Brightness the room calls for, -1 when adaptive mode is off or the
+    // last reading is older than STALE_MS
+    int16_t getLevel() const;
+
+    bool hasSensor() const { return address != 0; }
+
+    // Filtered light level, lux (0 before the first reading)
+    uint32_t getLux() const;
+
+    static const uint32_t SAMPLE_INTERVAL_MS = 1000;
+    static const uint32_t STALE_MS = 300000;        // No reading for 5 min: back to the schedule
+    static const uint8_t FILTER_SHIFT = 3;          // EMA weight 1/8, ~8 s time constant
+    static const uint8_t HYSTERESIS_PCT = 4;
+
+private:
+    // Scheduler job: read the sensor or take a submitted value, then
+    // update the level
+    static void onSampleTimer(void* arg);
+
+    bool probe(uint8_t addr);
+    bool readSensor(uint32_t& lux);
+    void feed(uint32_t lux, bool smooth);
+
+    static int32_t log2Q8(uint32_t x);
+
+    TwoWire* wire;
+    uint8_t address;            // 0 without a sensor
+    int8_t job;
+
+    int32_t filteredLogQ8;      // log2(lux + 1) in Q8
+    bool primed;
+    volatile int16_t level;
+    volatile unsigned long lastReadingAt;
+
+    portMUX_TYPE mux;
+    uint32_t submittedLux;
+    bool submitted;
+};
+
+// Global instance
+extern AmbientLight ambientLight;
+
+#endif // AMBIENT_LIGHT_H
@@ -0,0 +1,157 @@
+#ifndef BACKGROUND_ANIM_H
+#define BACKGROUND_ANIM_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <lvgl.h>
+
+class Print;
+
+// An animated (or still photo) screen background, uploaded at runtime
+// (POST /api/background).
+//
+// Decoding an animation for every frame shown (GIF, as in Arduino_GFX's
+// ImgViewerAnimatedGIF example) costs more CPU than the panel can spare next
+// to rendering. The upload is instead decoded once, by the heavy lane, into
+// a frame cache in PSRAM: one RGB565 image that is what LVGL shows, and for
+// every frame the runs of pixels that differ from the frame before it (the
+// first frame's runs lead back from the last, so it loops). Playing a frame
+// is a few memcpy()s into the image and an invalidation of the rows they
+// touched, at most MAX_FPS times a second. Nothing plays while the
+// backlight is off (dark idle) or a firmware update runs.
+//
+// Upload layout, little-endian (scripts/make_background.py builds it):
+//   BackgroundHeader   magic, frame count, size, frame time
+//   per frame          uint32_t length, then a zlib stream of width * height
+//                      RGB565 pixels (lv_color_t.full), row-major
+//
+// A baseline JPEG upload instead becomes a still photo background: the
+// ROM's tjpgd decodes it straight into the shown image, scaled down by up
+// to 1/8 to fit the screen, and nothing runs per frame after that.
+//
+// The image is the bottom child of every screen UIManager builds, centered.
+// A card tile would freeze the background under its card, so tiles are off
+// while an animation is loaded. DELETE /api/background removes it.
+
+static const uint32_t BACKGROUND_MAGIC = 0x4e414742;   // "BGAN"
+static const uint16_t BACKGROUND_VERSION = 1;
+
+struct BackgroundHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t frameCount;
+    uint16_t width;
+    uint16_t height;
+    uint16_t frameMs;           // Time each frame is shown, 0 for as fast as allowed
+    uint16_t reserved;
+};
+
+class BackgroundAnimation {
+public:
+    enum class State : uint8_t { IDLE, RECEIVING, DECODING, DONE, FAILED };
+
+    BackgroundAnimation();
+
+    // AsyncTCP task, first body chunk: stage an upload of size bytes.
+    // False with the reason in error (nothing started) when refused.
+    bool beginUpload(size_t size, const char*& error);
+
+    // AsyncTCP task: the next body chunk, in order
+    void feed(const uint8_t* data, size_t len);
+
+    // The upload connection went away before it was complete
+    void abortUpload();
+
+    // Whole upload staged, ready for the JOB_BACKGROUND decode
+    bool isStaged() const { return state == State::RECEIVING && received == size; }
+    bool isBusy() const { return state == State::RECEIVING || state == State::DECODING; }
+
+    // Heavy lane: decode the staged upload into a frame cache and show it
+    // in place of the current animation
+    bool install();
+
+    // Any task but the LVGL one: stop and free the animation
+    void remove();
+
+    // LVGL task: put the background under screen, which is being built
+    // (nothing without an animation)
+    void attach(lv_obj_t* screen);
+
+    // LVGL task: an animation is loaded (screens built now show it)
+    bool isLoaded() const { return anim != nullptr; }
+
+    // Any task: state, the loaded animation and the last error
+    void writeJson(Print& out) const;
+
+    static const size_t MAX_UPLOAD_BYTES = 2 * 1024 * 1024;
+    static const size_t MAX_CACHE_BYTES = 3 * 1024 * 1024;  // Image and runs
+    static const uint16_t MAX_FRAMES = 240;
+    static const uint8_t MAX_FPS = 12;
+    static const uint32_t MERGE_GAP = 8;        // Unchanged pixels folded into a run rather than ending it
+    static const uint8_t MAX_IMAGES = 2;        // The shown screen and the one being built
+    static const size_t JPEG_WORK_SIZE = 3100;  // tjpgd's workspace
+
+private:
+    // A run in a frame's data: offset and count in pixels, then the pixels,
+    // padded to 4 bytes
+    struct Run {
+        uint32_t offset;
+        uint32_t count;
+    };
+
+    struct Frame {
+        uint8_t* data;              // Runs, nullptr if nothing changes
+        uint32_t size;
+        uint16_t firstRow;          // Rows the runs touch
+        uint16_t lastRow;
+    };
+
+    struct Animation {
+        lv_img_dsc_t dsc;           // The shown frame
+        Frame* frames;
+        uint16_t frameCount;
+        uint16_t current;
+        uint32_t periodMs;
+        size_t bytes;
+    };
+
+    // Why the staged upload can't be decoded, nullptr if it can;
+    // offsets[i] is where frame i's zlib stream starts
+    const char* validate(const BackgroundHeader& header, uint32_t* offsets) const;
+    // Decode the staged upload into next (nullptr until it exists); the
+    // reason on failure, next then is what to free
+    const char* decodeFrames(Animation*& next);
+    const char* decodeJpeg(Animation*& next);
+    bool decodeFrame(uint32_t offset, uint16_t* dst, size_t bytes);
+    static Animation* newAnimation(uint16_t count, uint16_t width, uint16_t height);
+    static bool encodeRuns(const uint16_t* from, const uint16_t* to, uint32_t pixels, uint16_t width,
+                           Frame& frame, uint8_t* scratch, size_t scratchSize);
+    void show(Animation* next);
+    void freeAnimation(Animation* a);
+    void fail(const char* reason);
+    void freeStaging();
+
+    // LVGL task
+    static void onFrameTimer(lv_timer_t* timer);
+    static void onImageDeleted(lv_event_t* e);
+    void step();
+
+    Animation* anim;                // Swapped under the LVGL lock
+    lv_obj_t* images[MAX_IMAGES];
+    lv_timer_t* timer;
+    uint32_t framesShown;
+    uint32_t framesSkipped;         // Due while dark or updating
+
+    portMUX_TYPE mux;
+    volatile State state;
+    const char* error;
+    uint8_t* staging;
+    size_t size;
+    volatile size_t received;
+    uint32_t decodeMs;
+};
+
+// Global instance
+extern BackgroundAnimation backgroundAnim;
+
+#endif // BACKGROUND_ANIM_H
@@ -0,0 +1,67 @@
+#ifndef BACKLIGHT_H
+#define BACKLIGHT_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Backlight PWM on the LEDC peripheral, with transitions run by its hardware
+// fade engine so dimming and waking cost no CPU.
+//
+// Duty is RESOLUTION_BITS wide and follows a gamma curve, so equal brightness
+// steps look equal. This panel's backlight needs about half duty to light at
+// all, so 1-100% maps onto MIN_LIT_DUTY..MAX_DUTY and only 0 is off.
+//
+// IDF 4.4 can't stop a fade in flight: a new target that arrives during one
+// is held and started by a scheduler job once it ends, rather than blocking
+// the caller until then.
+//
+// Reaching 0 puts the render task into dark idle (see lvgl_task.h); any
+// lit target takes it out before the fade starts.
+class Backlight {
+public:
+    Backlight();
+
+    // Configure the LEDC timer/channel and fade engine, backlight off
+    void begin(uint8_t pin, uint8_t channel);
+
+    // Fade to brightness (0-100) over fadeMs (0 = at once). Any task.
+    void set(uint8_t brightness, uint32_t fadeMs = FADE_MS);
+
+    // Touch task, on a press: bring the light up to at least brightness
+    // straight away, ahead of the UI's own wake handling
+    void wake(uint8_t brightness);
+
+    uint8_t getLevel() const { return level; }
+    uint32_t getDuty() const;
+
+    static const uint32_t PWM_FREQ_HZ = 5000;
+    static const uint8_t RESOLUTION_BITS = 12;
+    static const uint32_t MAX_DUTY = (1 << RESOLUTION_BITS) - 1;
+    static const uint32_t MIN_LIT_DUTY = MAX_DUTY / 2;
+    static const uint32_t FADE_MS = 400;
+    static const uint32_t WAKE_FADE_MS = 80;
+
+private:
+    // Scheduler job: start a target that was waiting on a running fade, or
+    // enter dark idle once a fade to 0 has finished
+    static void onFadeDone(void* arg);
+    void apply(uint8_t brightness, uint32_t fadeMs);  // Caller holds lock
+    bool fading(unsigned long now) const;
+
+    uint16_t gammaDuty[101];    // Duty per brightness percent
+    SemaphoreHandle_t lock;
+    uint8_t channel;
+    bool ready;
+    volatile uint8_t level;     // Last applied target
+    uint8_t pendingLevel;
+    uint32_t pendingFadeMs;
+    bool pending;
+    unsigned long fadeEndsAt;
+    int8_t fadeJob;
+};
+
+// Global instance
+extern Backlight backlight;
+
+#endif // BACKLIGHT_H
@@ -0,0 +1,89 @@
+#ifndef BAND_RENDERER_H
+#define BAND_RENDERER_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <atomic>
+
+class Print;
+
+// Splits a frame's pixel work across both cores.
+//
+// LVGL 8 renders on the LVGL task and its drawing code isn't reentrant, so a
+// refresh can't be cut into bands drawn at once. Its last stage can:
+// lv_draw_sw_blend_basic() fills or maps one area of the draw buffer and
+// touches nothing else. As the display's draw context (initDrawCtx), large
+// blends are cut into two horizontal bands by clip area; the LVGL task
+// blends the top band while a worker pinned to core 0 blends the bottom, and
+// both are done before the blend returns, so flushing is unchanged. Full
+// screen fills, shadows, gradients and translucent layers are mostly blend
+// work; masks, glyphs and image decoding stay on the LVGL task. Both cores
+// share the PSRAM bus, so frame-sized blends gain less than twice.
+//
+// The worker runs at the LVGL task's priority next to WiFi. If it hasn't
+// picked up its band by the time the LVGL task finishes its own, the LVGL
+// task takes the band back, so a busy core 0 costs a split no more than the
+// handoff. split() does the same for other row loops (the theme cross-fade).
+//
+// PANEL_BAND_RENDER (build flag, on in env:esp32s3-perf) starts the worker
+// and installs the draw context; without it split() runs on the caller.
+#ifndef PANEL_BAND_RENDER
+#define PANEL_BAND_RENDER 0
+#endif
+
+class BandRenderer {
+public:
+    BandRenderer();
+
+    // Start the worker; before this, split() runs everything on the caller
+    void begin();
+
+    // lv_disp_drv_t::draw_ctx_init: LVGL's software draw context with the
+    // splitting blend (draw_ctx_size stays sizeof(lv_draw_sw_ctx_t))
+    static void initDrawCtx(lv_disp_drv_t* drv, lv_draw_ctx_t* ctx);
+
+    // Call fn(arg, first, end) over rows [0, rows) - the top half on the
+    // caller, the bottom half on the worker - and return when both are done.
+    // The halves run at once, so fn must only write its own rows. One caller
+    // at a time: LVGL task only.
+    typedef void (*RowFn)(void* arg, uint32_t first, uint32_t end);
+    void split(uint32_t rows, RowFn fn, void* arg);
+
+    // Counters
+    void writeJson(Print& out) const;
+
+    static const uint32_t MIN_SPLIT_PX = 8192;       // Smaller blends aren't worth the handoff
+    static const uint32_t WORKER_STACK_SIZE = 3072;
+    static const UBaseType_t WORKER_PRIORITY = 2;    // The LVGL task's
+    static const BaseType_t WORKER_CORE = 0;         // The LVGL task runs on 1
+
+private:
+    static void blend(lv_draw_ctx_t* ctx, const lv_draw_sw_blend_dsc_t* dsc);
+    static void blendRows(void* arg, uint32_t first, uint32_t end);
+    static void workerTask(void* arg);
+
+    // The bottom band in flight: POSTED by split(), claimed as RUNNING by the
+    // worker or back to IDLE by split() if it got there first
+    enum JobState : uint8_t { JOB_IDLE, JOB_POSTED, JOB_RUNNING };
+    std::atomic<uint8_t> jobState;
+    RowFn jobFn;
+    void* jobArg;
+    uint32_t jobFirst;
+    uint32_t jobEnd;
+
+    TaskHandle_t worker;
+    SemaphoreHandle_t jobDone;      // Given by the worker after a band it ran
+
+    uint32_t splits;                // Bands the worker ran
+    uint32_t takenBack;             // Bands the caller ran after all
+    uint32_t small;                 // Blends below MIN_SPLIT_PX
+    uint32_t workerUs;              // Time the worker spent on bands
+};
+
+// Global instance
+extern BandRenderer bandRenderer;
+
+#endif // BAND_RENDERER_H
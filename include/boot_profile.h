@@ -0,0 +1,82 @@
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+class Print;
+
+// Boot-time profile, served at /api/diag/boot.
+//
+// setup() calls mark() after each stage, so a stage runs from the previous
+// mark to its own; the network stages run in the NetBoot task alongside the
+// rest of setup() and are timed with record() instead. Times are
+// esp_timer microseconds, which count from the start of the app (the ROM
+// and second-stage bootloader come before that and aren't seen here).
+//
+// Each boot's record lives in RTC memory and is filled in as stages end, so
+// it survives software resets, panics and watchdogs, and a boot that never
+// finished still shows how far it got. The last HISTORY_SIZE boots are kept;
+// a power cut clears them.
+enum BootStage : uint8_t {
+    BOOT_STAGE_STARTUP = 0,     // App start until setup()
+    BOOT_STAGE_EARLY,           // Serial, scheduler, crash report, PSRAM check
+    BOOT_STAGE_CONFIG,          // configManager.begin (NVS load)
+    BOOT_STAGE_DISPLAY,         // setupDisplay
+    BOOT_STAGE_LVGL,            // setupLVGL
+    BOOT_STAGE_TOUCH,           // setupTouch
+    BOOT_STAGE_THEME,           // themeEngine.begin
+    BOOT_STAGE_UI_BEGIN,        // uiManager.begin
+    BOOT_STAGE_CREATE_UI,       // uiManager.createUI
+    BOOT_STAGE_FIRST_RENDER,    // First lv_timer_handler pass
+    BOOT_STAGE_LVGL_TASK,       // Render task start
+    BOOT_STAGE_NETWORK,         // startNetwork (wifiLink.begin)
+    BOOT_STAGE_SERVICES,        // Device controller through task monitor
+    BOOT_STAGE_WEB_SERVER,      // webServer.begin
+    BOOT_STAGE_WIFI_CONNECT,    // NetBoot: waiting for the first link
+    BOOT_STAGE_MDNS,            // NetBoot: mdnsService.begin and advertise
+    BOOT_STAGE_CONFIG_FETCH,    // NetBoot: tryFetchServerConfig
+    BOOT_STAGE_COUNT
+};
+
+struct BootRecord {
+    uint32_t seq;                           // Boots since the history was cleared
+    uint8_t resetReason;                    // esp_reset_reason_t
+    uint32_t done;                          // BootStage bits recorded
+    uint32_t startUs[BOOT_STAGE_COUNT];
+    uint32_t durationUs[BOOT_STAGE_COUNT];
+};
+
+class BootProfile {
+public:
+    BootProfile();
+
+    // First thing in setup(): open this boot's record and time the startup
+    void begin();
+
+    // setup(): stage ended now, having started at the previous mark
+    void mark(BootStage stage);
+
+    // Other tasks: stage ran from startUs (esp_timer_get_time()) until now
+    void record(BootStage stage, int64_t startUs);
+
+    static const char* stageName(BootStage stage);
+
+    // This boot's stages on one line
+    void printSummary() const;
+
+    // This boot and the ones before it, newest first
+    void writeJson(Print& out) const;
+
+    static const uint8_t HISTORY_SIZE = 8;
+
+private:
+    BootRecord* current;
+    int64_t lastMarkUs;
+    mutable portMUX_TYPE mux;
+};
+
+// Global instance
+extern BootProfile bootProfile;
+
+#endif // BOOT_PROFILE_H
@@ -10,6 +10,30 @@ enum class SchedulerState {
     AWAKE       // Temporarily woken by touch
 };
 
+// One schedule period start, compiled from the config
+struct BrightnessTransition {
+    uint16_t minute;        // Minute of day, 0-1439
+    uint8_t brightness;
+    uint8_t period;         // Index into schedule.periods
+};
+
+// Follows the brightness schedule and the touch-wake timeout.
+//
+// refresh() compiles the periods into a timeline sorted by minute of day,
+// resolving sunrise/sunset anchors through SolarClock (recompiled when the
+// local date changes). The scheduler then only runs as an EventScheduler
+// job, armed for the next period start, the wake timeout, or an hourly
+// recheck for drift, whichever is first. A clock or timezone change, a
+// touch wake and a refresh run it at once.
+//
+// In curve mode the periods are keyframes and brightness ramps linearly
+// between them. Rather than recomputing the ramp on a timer, the job works
+// out when the ramp next crosses a whole percent and sleeps until then;
+// each 1% step is then blended by a short hardware fade.
+//
+// With adaptive brightness on (see ambient_light.h), the room's light level
+// caps the scheduled level, or sets brightness outright when no schedule
+// is enabled.
 class BrightnessScheduler {
 public:
     BrightnessScheduler();
@@ -17,14 +41,13 @@ public:
     // Initialize with schedule config
     void begin();
 
-    // Update function - call from main loop
-    // Returns true if brightness changed
-    bool update();
-
     // Handle touch detection - call from touch callback
     // Returns true if the touch should be consumed (button blocked)
     bool onTouchDetected();
 
+    // Touch task: level a touch wakes the display to (0 = no wake needed)
+    uint8_t getWakeBrightness() const;
+
     // Check if buttons should be blocked (when scheduled brightness is 0%)
     bool shouldBlockButtons() const;
 
@@ -37,6 +60,18 @@ public:
     // Force re-evaluation of schedule (call after config update)
     void refresh();
 
+    // AmbientLight: the light level moved past its hysteresis, or went stale
+    void onAmbientChanged();
+
+    // Config index of the period in effect (-1 if none), as of the last event
+    int8_t getActivePeriod() const { return currentPeriodIndex; }
+
+    // Level the schedule (or curve) calls for, as of the last event
+    uint8_t getScheduledBrightness() const { return currentScheduledBrightness; }
+
+    // Time until the scheduler job next runs, ms
+    unsigned long getNextEventInMs() const;
+
 private:
     SchedulerState state;
     uint8_t currentScheduledBrightness;
@@ -45,16 +80,43 @@ private:
     unsigned long wakeGraceEndTime;  // Block buttons until this time (500ms after wake)
     int8_t currentPeriodIndex;
 
+    BrightnessTransition timeline[MAX_SCHEDULE_PERIODS];
+    uint8_t timelineCount;
+    bool solarAnchored;         // Some period starts on sunrise/sunset
+    int32_t timelineDay;        // SolarClock::dayKey() the anchors were resolved for (-1 if not)
+    bool ambientDriving;        // Unscheduled brightness currently follows the light level
+    int8_t job;
+
     static const unsigned long WAKE_GRACE_PERIOD_MS = 500;
+    static const unsigned long RECHECK_MS = 3600000;   // Longest wait, for RTC drift
+    static const uint32_t GRADUAL_FADE_MS = 1500;     // Curve steps and light-level changes
+
+    // Scheduler job: apply the schedule and arm the next deadline.
+    // Returns true if brightness changed.
+    static void onTimer(void* arg);
+    bool evaluate();
+
+    // Sort the configured periods into the timeline. Solar-anchored ones are
+    // left out until the clock is set and a location is configured.
+    void compileTimeline(const BrightnessScheduleConfig& schedule);
+
+    // Timeline index in effect at a minute of day
+    int8_t findActivePeriod(uint16_t minuteOfDay) const;
+
+    // Seconds from secondsOfDay to the next period start
+    uint32_t secondsToNextTransition(uint32_t secondsOfDay) const;
 
-    // Find which period should be active for the given time
-    int8_t findActivePeriod(uint8_t hour, uint8_t minute) const;
+    // Scheduled brightness at secondsOfDay, with the timeline index in
+    // effect and the seconds until the level next changes
+    uint8_t scheduledLevel(bool curve, uint32_t secondsOfDay, int8_t& index, uint32_t& untilChange) const;
 
-    // Get brightness for a specific period (-1 = use manual brightness)
-    uint8_t getPeriodBrightness(int8_t periodIndex) const;
+    // No schedule: follow the light level, or restore the configured
+    // brightness once it stops. Returns true if brightness changed.
+    bool followAmbient(int16_t ambient, uint8_t configured);
 
-    // Apply brightness to the display
-    void applyBrightness(uint8_t brightness);
+    // Apply brightness to the display; gradual changes (curve steps, light
+    // level) fade slowly and quietly
+    void applyBrightness(uint8_t brightness, bool gradual = false);
 
     // Calculate minutes since midnight
     static uint16_t toMinutesSinceMidnight(uint8_t hour, uint8_t minute);
@@ -0,0 +1,65 @@
+#ifndef CARD_TILE_CACHE_H
+#define CARD_TILE_CACHE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "layout_plan.h"
+
+class Print;
+
+// A shown card's on and off appearance, pre-rendered.
+//
+// Full-refresh frames draw every card from scratch: radius, border, shadow,
+// label glyphs and icon. Most cards only ever change when toggled, so with
+// display.cardTiles set, UIManager renders an idle card once per state with
+// lv_snapshot, flattened onto the screen background into an opaque RGB565
+// tile (in PSRAM), and an image object blits that in its place. The card
+// stays in the tree, transparent, and keeps taking input; it is drawn live
+// again while pressed or animating.
+//
+// Tiles keep the card's shadow out to half the gap to its neighbours, so
+// neighbouring tiles never overlap. They are per slot (buttonCards index),
+// and dropped when the card's content or the theme changes. LVGL task only.
+struct CardTile {
+    lv_img_dsc_t dsc;           // What the image object points at; data is nullptr when empty
+    lv_coord_t margin;          // Shadow kept around the card on each side
+};
+
+class CardTileCache {
+public:
+    CardTileCache();
+
+    // The tile of slot's card in state, or nullptr if there is none
+    const CardTile* get(uint8_t slot, bool state);
+
+    // Render card as it looks now into slot's tile for state, keeping up to
+    // margin pixels around it, flattened onto background; nullptr if there
+    // is no room for it
+    const CardTile* capture(uint8_t slot, bool state, lv_obj_t* card,
+                            lv_coord_t margin, lv_color_t background);
+
+    // Drop slot's tiles (the card changed); nothing may show them any more
+    void invalidate(uint8_t slot);
+
+    // Drop every tile (page, layout or theme change)
+    void clear();
+
+    // Tiles, bytes held and how often a tile was found, made or refused
+    void writeJson(Print& out) const;
+
+    static const size_t MAX_BYTES = 768 * 1024;
+
+private:
+    void drop(CardTile& tile);
+
+    CardTile tiles[MAX_PAGE_CARDS][2];  // [slot][state]
+    size_t bytes;
+    uint32_t hits;
+    uint32_t captures;
+    uint32_t refused;
+};
+
+// Global instance
+extern CardTileCache cardTileCache;
+
+#endif // CARD_TILE_CACHE_H
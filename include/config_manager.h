@@ -3,107 +3,380 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <atomic>
 #include <vector>
+#include "icon_registry.h"
+#include "theme_id.h"
 
 // Maximum number of buttons and scenes
-#define MAX_BUTTONS 9
+#define MAX_BUTTONS 36
 #define MAX_SCENES 2
 #define MAX_SCHEDULE_PERIODS 6
+#define MAX_LCARS_FIELDS 16
+#define MAX_CUSTOM_THEMES 4
+#define MAX_DIRECT_TARGETS 2
+#define MAX_SCENE_ACTIONS (2 * MAX_BUTTONS)
+#define THEME_PALETTE_SIZE 9
+
+// Bytes of string storage per config slot (all names, icons, themes, URLs)
+#define CONFIG_ARENA_SIZE 8192
+
+// Upper bound for the parsed config document (PSRAM); the actual capacity
+// is measured from the input and capped here
+#define CONFIG_DOC_MAX_SIZE (32 * 1024)
+
+// Newest config wire schema the panel reads. A config without "schema" is
+// the long-key form /api/config writes (and backups hold). Schema 2 is what
+// the server sends once the panel reports it (configSchema in /api/ping,
+// ?schema= on its config fetch): the same top level, minus anything the
+// panel doesn't read, with the repeated records in short keys and validated
+// strictly (a bad record rejects the whole config instead of being
+// defaulted):
+//   buttons: {"i":id,"t":type,"n":name,"ic":icon,"s":state,"sub":subtitle,
+//             "ss":speedSteps,"sl":speedLevel,"sc":sceneId,"d":direct,"b":bid}
+//   scenes:  {"i":id,"n":name,"ic":icon,"a":[[buttonId,on,speedLevel?],...]}
+#define CONFIG_WIRE_SCHEMA 2
+
+// ============================================================================
+// Config storage primitives
+// ============================================================================
+
+// Read-only view of a NUL-terminated string owned by a ConfigArena. Cheap to
+// copy; the text stays valid until that arena is reset by the next reload.
+class ConfigString {
+public:
+    ConfigString() : str(""), len(0) {}
+
+    const char* c_str() const { return str; }
+    size_t length() const { return len; }
+
+    bool operator==(const char* other) const { return strcmp(str, other) == 0; }
+    bool operator!=(const char* other) const { return !(*this == other); }
+    bool operator==(const String& other) const { return other == str; }
+    bool operator!=(const String& other) const { return !(*this == other); }
+    bool operator==(const ConfigString& other) const { return len == other.len && strcmp(str, other.str) == 0; }
+
+    // For APIs that take an Arduino String (allocates a copy)
+    operator String() const { return String(str); }
+
+private:
+    friend class ConfigArena;
+    ConfigString(const char* s, uint16_t n) : str(s), len(n) {}
+
+    const char* str;
+    uint16_t len;
+};
+
+// Bump allocator for config strings: one contiguous block, reset wholesale on
+// each reload, so config pushes don't churn or fragment the heap
+class ConfigArena {
+public:
+    ConfigArena() : base(nullptr), capacity(0), used(0), overflowed(false) {}
+
+    // Allocate the backing block (PSRAM when available)
+    bool begin(size_t size);
+
+    // Forget every string (views into this arena become invalid)
+    void reset() { used = 0; overflowed = false; }
+
+    // Copy a string into the arena; returns "" and flags overflow when full
+    ConfigString intern(const char* s);
+    ConfigString intern(const String& s) { return intern(s.c_str()); }
+
+    // Copy text that is drawn on the panel, folded in the same pass for its
+    // fonts: typographic quotes, dashes and ellipses become ASCII, and with
+    // the ASCII-only subset fonts (scripts/make_fonts.py) accented letters
+    // lose their accents and anything else becomes '?'
+    ConfigString internDisplay(const char* s);
+
+    size_t bytesUsed() const { return used; }
+    bool overflow() const { return overflowed; }
+
+private:
+    char* base;
+    size_t capacity;
+    size_t used;
+    bool overflowed;
+};
+
+// std::vector-like array with inline, fixed storage (no heap)
+template <typename T, size_t N>
+class FixedVector {
+public:
+    FixedVector() : count(0) {}
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    static constexpr size_t capacity() { return N; }
+
+    T& operator[](size_t i) { return items[i]; }
+    const T& operator[](size_t i) const { return items[i]; }
+
+    T* begin() { return items; }
+    T* end() { return items + count; }
+    const T* begin() const { return items; }
+    const T* end() const { return items + count; }
+
+    bool push_back(const T& value) {
+        if (count >= N) return false;
+        items[count++] = value;
+        return true;
+    }
+
+    void clear() { count = 0; }
+
+private:
+    T items[N];
+    size_t count;
+};
 
 // Button types
 enum class ButtonType {
     LIGHT,
     SWITCH,
     FAN,
-    SCENE
+    SCENE,
+    SENSOR      // Shows pushed samples (value and history chart); not pressable
 };
 
 // LCARS text field configuration
 struct LCARSTextField {
-    String id;          // Field identifier (e.g., "header_left", "header_right")
-    String value;       // Display text
-    String style;       // Style hint: "title", "label", "data", "status"
+    ConfigString id;          // Field identifier (e.g., "header_left", "header_right")
+    ConfigString value;       // Display text
+    ConfigString style;       // Style hint: "title", "label", "data", "status"
 };
 
 // LCARS-specific UI configuration
 struct LCARSConfig {
     bool enabled;
-    String colorScheme;      // "federation", "medical", "engineering", "tactical"
-    String headerLeft;       // Top left text (e.g., "STARDATE")
-    String headerRight;      // Top right text (e.g., system status)
-    String footerLeft;       // Bottom left text
-    String footerRight;      // Bottom right text
-    String sidebarTop;       // Side panel top text
-    String sidebarBottom;    // Side panel bottom text
-    std::vector<LCARSTextField> customFields;  // Additional custom fields
+    ConfigString colorScheme;      // "federation", "medical", "engineering", "tactical"
+    ConfigString headerLeft;       // Top left text (e.g., "STARDATE")
+    ConfigString headerRight;      // Top right text (e.g., system status)
+    ConfigString footerLeft;       // Bottom left text
+    ConfigString footerRight;      // Bottom right text
+    ConfigString sidebarTop;       // Side panel top text
+    ConfigString sidebarBottom;    // Side panel bottom text
+    FixedVector<LCARSTextField, MAX_LCARS_FIELDS> customFields;  // Additional custom fields
 };
 
 // Button configuration
 struct ButtonConfig {
     uint8_t id;
     ButtonType type;
-    String name;
-    String icon;
+    ConfigString name;
+    ConfigString icon;
+    IconId iconId;      // Resolved from icon when parsed (see icon_registry.h)
     bool state;
-    String subtitle;    // Optional subtitle (e.g., for LCARS: "DECK 7")
+    ConfigString subtitle;  // Optional subtitle (e.g., for LCARS: "DECK 7"); a sensor's unit
     uint8_t speedSteps; // For fans: number of speed steps (0=on/off only, 3=off/low/med/high, etc.)
     uint8_t speedLevel; // Current speed level (0=off, 1-speedSteps for on states)
-    String sceneId;     // For scene buttons: the scene ID to execute
+    ConfigString sceneId;   // For scene buttons: the scene ID to execute
+    uint8_t directTarget;   // Index into DeviceConfig::direct, NO_DIRECT_TARGET = through the server only
+    ConfigString directPath;    // Appended to the target's url
+    uint32_t bindingId;     // Server's id of the accessory it shows ("bid"), 0 = unbound
+};
+
+const uint8_t NO_DIRECT_TARGET = 0xFF;
+
+// Where buttons with direct control send their actions themselves (the
+// server provisions one per plugin that allows it): a PUT of one of the
+// bodies to url + the button's directPath, "{value}" in speedBody being the
+// fan speed level. The server still hears of every action, afterwards.
+struct DirectTargetConfig {
+    ConfigString url;
+    ConfigString auth;          // Authorization header value; never served back by GET /api/config
+    ConfigString onBody;
+    ConfigString offBody;
+    ConfigString speedBody;
+};
+
+// One button change of a scene
+struct SceneAction {
+    uint8_t buttonId;
+    bool state;
+    uint8_t speedLevel;     // NO_SCENE_SPEED unless the button is a fan
 };
 
-// Scene configuration
+const uint8_t NO_SCENE_SPEED = 0xFF;
+
+// Scene configuration. What a scene does to this panel's buttons is
+// compiled at parse time into DeviceConfig::sceneActions (the server sends
+// it as "actions"; without it, "All On"/"All Off" cover every button), so
+// activating one is a table walk, not a server round trip.
 struct SceneConfig {
     uint8_t id;
-    String name;
-    String icon;
+    ConfigString name;
+    ConfigString icon;
+    IconId iconId;
+    uint8_t firstAction;    // Into DeviceConfig::sceneActions
+    uint8_t actionCount;
 };
 
 // Day/Night mode configuration
 struct DayNightConfig {
     bool enabled;
-    String dayTheme;
-    String nightTheme;
+    ConfigString dayTheme;
+    ConfigString nightTheme;
+    ThemeId dayThemeId;     // Resolved from the names when parsed
+    ThemeId nightThemeId;
     uint8_t dayStartHour;
     uint8_t nightStartHour;
+    bool followSun;       // Day is sunrise-sunset at the schedule's location, hours are the fallback
+};
+
+// What a schedule period's start time is measured from
+enum class ScheduleAnchor : uint8_t {
+    CLOCK,      // startHour:startMinute
+    SUNRISE,    // Sunrise + offsetMinutes
+    SUNSET      // Sunset + offsetMinutes
 };
 
-// Brightness schedule period
+// Brightness schedule period (a keyframe in curve mode)
 struct BrightnessSchedulePeriod {
-    String name;
+    ConfigString name;
     uint8_t startHour;    // 0-23
     uint8_t startMinute;  // 0-59
     uint8_t brightness;   // 0-100
+    ScheduleAnchor anchor;
+    int16_t offsetMinutes;  // From the solar event, -720..720
 };
 
 // Brightness schedule configuration
 struct BrightnessScheduleConfig {
     bool enabled;
-    String timezone;              // POSIX timezone string
+    bool curve;                   // Interpolate between periods instead of stepping
+    ConfigString timezone;        // POSIX timezone string
+    float latitude;               // Degrees, NaN when unset (solar anchors and followSun)
+    float longitude;
     uint8_t periodCount;
     BrightnessSchedulePeriod periods[MAX_SCHEDULE_PERIODS];
     uint8_t touchBrightness;      // Wake brightness (default 30)
     uint16_t displayTimeout;      // Seconds before returning to schedule (default 30)
 };
 
+// Adaptive brightness from the room's light level (see ambient_light.h)
+struct AmbientConfig {
+    bool enabled;
+    uint8_t minBrightness;        // At 1 lux and below (default 10)
+    uint8_t maxBrightness;        // At luxAtMax and above (default 100)
+    uint16_t luxAtMax;            // Default 400
+};
+
+// Colors of a custom theme, one per "colors" key
+enum ThemeColorRole : uint8_t {
+    THEME_COLOR_BACKGROUND = 0,
+    THEME_COLOR_CARD,
+    THEME_COLOR_CARD_HOVER,
+    THEME_COLOR_ON,
+    THEME_COLOR_OFF,
+    THEME_COLOR_TEXT,
+    THEME_COLOR_TEXT_SECONDARY,
+    THEME_COLOR_ACCENT,
+    THEME_COLOR_BORDER,
+    THEME_COLOR_SHADOW,
+    THEME_COLOR_COUNT
+};
+
+// Shape parameters of a custom theme, one per "shape" key
+enum ThemeShapeParam : uint8_t {
+    THEME_SHAPE_CARD_RADIUS = 0,
+    THEME_SHAPE_BUTTON_RADIUS,
+    THEME_SHAPE_BORDER_WIDTH,
+    THEME_SHAPE_SHADOW_WIDTH,
+    THEME_SHAPE_SHADOW_OFFSET_Y,
+    THEME_SHAPE_SHADOW_SPREAD,
+    THEME_SHAPE_SHADOW_OPACITY,
+    THEME_SHAPE_COUNT
+};
+
+// Layout flags a custom theme may change ("flags" keys)
+const uint8_t THEME_FLAG_STATUS_TEXT = 0x01;
+const uint8_t THEME_FLAG_GLOWING_BORDERS = 0x02;
+
+// A theme pushed in display.themes: a built-in theme's layout with its own
+// colors, shapes and flags, compiled by ThemeEngine::setCustomThemes().
+// Fields whose mask bit is clear keep the base theme's value.
+struct CustomThemeConfig {
+    ConfigString name;
+    ConfigString base;                      // Built-in theme name
+    uint16_t colorMask;                     // Bit per ThemeColorRole
+    uint16_t paletteMask;                   // Bit per palette entry
+    uint8_t shapeMask;                      // Bit per ThemeShapeParam
+    uint8_t flagMask;                       // THEME_FLAG_* that are set...
+    uint8_t flags;                          // ...and their values
+    uint32_t colors[THEME_COLOR_COUNT];     // 0xRRGGBB
+    uint32_t palette[THEME_PALETTE_SIZE];   // Per-room neon colors, LCARS frame colors
+    uint8_t shapes[THEME_SHAPE_COUNT];
+};
+
+// How the standard themes arrange button cards (LCARS and Cyberpunk keep
+// their own grids)
+enum class CardLayout : uint8_t {
+    GRID,       // Up to 4x3 cards with icon, name and toggle
+    LIST        // Full-width rows, two columns past six buttons
+};
+
+const char* cardLayoutName(CardLayout layout);
+
 // Display configuration
 struct DisplayConfig {
     uint8_t brightness;
-    String theme;
+    ConfigString theme;
+    ThemeId themeId;                       // Resolved from theme when parsed
+    CardLayout cardLayout;
+    bool cardTiles;                        // Draw idle cards from pre-rendered tiles (card_tile_cache.h)
     DayNightConfig dayNight;
     LCARSConfig lcars;                     // LCARS-specific configuration
     BrightnessScheduleConfig schedule;     // Brightness scheduling
+    AmbientConfig ambient;                 // Light-level adaptive brightness
+    FixedVector<CustomThemeConfig, MAX_CUSTOM_THEMES> themes;  // Server-defined themes
 };
 
 // Server configuration
 struct ServerConfig {
-    String reportingUrl; // Full URL for API calls (e.g., "http://192.168.1.100:8080")
+    ConfigString reportingUrl; // Full URL for API calls (e.g., "http://192.168.1.100:8080")
+};
+
+// WiFi power save against action latency (see wifi_link.h)
+enum class WifiProfile : uint8_t {
+    LOW_LATENCY,    // Radio always on
+    BALANCED,       // Modem sleep, awake for every DTIM beacon
+    LOW_POWER       // Modem sleep, awake every WiFiLink::LISTEN_INTERVAL beacons
+};
+
+const char* wifiProfileName(WifiProfile profile);
+
+// Group the server multicasts signed state changes to (see state_multicast.h)
+struct StateMulticastConfig {
+    bool enabled;                 // Set when the server sent a group, port and key
+    uint8_t group[4];             // IPv4 multicast address
+    uint16_t port;
+    uint8_t key[32];              // HMAC-SHA256 key; never served back by GET /api/config
+};
+
+// Panel-to-panel mirroring of presses over ESP-NOW (see peer_mirror.h)
+struct PeerMirrorConfig {
+    bool enabled;                 // Set when the server sent a key
+    uint8_t key[32];              // HMAC-SHA256 key; never served back by GET /api/config
+};
+
+// Network configuration
+struct NetworkConfig {
+    WifiProfile wifiProfile;      // Default balanced
+    WifiProfile dimProfile;       // While the schedule holds the display dim or dark (default balanced)
+    StateMulticastConfig multicast;
+    PeerMirrorConfig peerMirror;
 };
 
 // Device identification
 struct DeviceInfo {
-    String id;
-    String name;
-    String location;
+    ConfigString id;
+    ConfigString name;
+    ConfigString title;         // name folded for the panel's fonts (header)
+    ConfigString location;
 };
 
 // Complete device configuration
@@ -111,9 +384,12 @@ struct DeviceConfig {
     uint8_t version;
     DeviceInfo device;
     DisplayConfig display;
-    std::vector<ButtonConfig> buttons;
-    std::vector<SceneConfig> scenes;
+    FixedVector<ButtonConfig, MAX_BUTTONS> buttons;
+    FixedVector<SceneConfig, MAX_SCENES> scenes;
+    FixedVector<SceneAction, MAX_SCENE_ACTIONS> sceneActions;
+    FixedVector<DirectTargetConfig, MAX_DIRECT_TARGETS> direct;
     ServerConfig server;
+    NetworkConfig network;
 };
 
 class ConfigManager {
@@ -123,30 +399,100 @@ public:
     // Initialize config manager and load from NVS
     void begin();
 
-    // Load configuration from NVS
+    // Load configuration from NVS (migrates a legacy JSON blob to binary)
     bool loadConfig();
 
-    // Save current configuration to NVS
+    // Save current configuration to NVS as a binary blob (blocks on flash)
     bool saveConfig();
 
-    // Parse JSON configuration from server
-    bool parseConfigJson(const String& json);
-
-    // Serialize current config to JSON
-    String toJson();
+    // Config sections, for write-behind bookkeeping
+    enum DirtySection : uint8_t {
+        DIRTY_DEVICE  = 0x01,
+        DIRTY_DISPLAY = 0x02,
+        DIRTY_BUTTONS = 0x04,
+        DIRTY_SCENES  = 0x08,
+        DIRTY_SERVER  = 0x10,
+        DIRTY_ALL     = 0x1F
+    };
+
+    // Schedule a save from the persist task; changes arriving within
+    // PERSIST_DELAY_MS of each other are coalesced into one flash write
+    void markDirty(uint8_t sections = DIRTY_ALL);
+
+    // Write pending changes now (e.g. right before a restart)
+    void flush();
+
+    // Number of flash writes done by the write-behind persister
+    uint32_t getPersistWrites() const { return persistWrites; }
+
+    // Parse JSON configuration from server; keepReportingUrl keeps the
+    // device's local server URL instead of the one in the document
+    bool parseConfigJson(const String& json, bool keepReportingUrl = false);
+
+    // Same, parsing a mutable buffer in place (the buffer is modified)
+    bool parseConfigJson(char* json, size_t len, bool keepReportingUrl = false);
+
+    // Why the last parseConfigJson() or patch failed (nullptr after a
+    // successful parse)
+    const char* getLastParseError() const { return lastParseError; }
+
+    // Partial updates (PATCH /api/config/...): only the keys present in
+    // fields change, and the copy is published like the setters do, without
+    // a full parse. Keys a patch can't take (button type, schedules...) are
+    // refused rather than dropped. "configHash" is the server's hash of its
+    // full config after the edit, kept as getServerConfigHash().
+    enum PatchResult : uint8_t {
+        PATCH_APPLIED,
+        PATCH_NOT_FOUND,    // No button/scene with that id
+        PATCH_INVALID       // getLastParseError() says why
+    };
+    PatchResult patchButton(uint8_t buttonId, JsonObjectConst fields);
+    PatchResult patchScene(uint8_t sceneId, JsonObjectConst fields);
+    PatchResult patchDisplay(JsonObjectConst fields);
+
+    // Serialize current config to JSON; withSecrets keeps credentials
+    // (direct control auth) in, for a copy that is parsed back later
+    String toJson(bool withSecrets = false);
+
+    // Stream the config as JSON into any Print (no intermediate document);
+    // returns the number of bytes written
+    size_t writeJson(Print& out, bool withSecrets = false) const;
+
+    // Exact size of the JSON writeJson() would produce
+    size_t jsonLength(bool withSecrets = false) const;
 
     // Fetch configuration from server (blocking)
     bool fetchConfigFromServer();
 
-    // Get current configuration (read-only)
+    // Get current configuration (read-only). Valid until the next update is
+    // published, so only for a single read; code that keeps a reference or
+    // string pointer across calls should hold a ConfigSnapshot instead
     const DeviceConfig& getConfig() const;
 
-    // Get mutable configuration for updates
-    DeviceConfig& getConfigMutable();
-
-    // Set reporting URL
+    // Setters publish a modified copy; readers never see a partial write.
+    // Never call a setter (button states included) while holding a
+    // ConfigSnapshot: a writer waits for the spare slot's readers, and after
+    // one more publish that can be the holder's own slot. Copy what is
+    // needed out of the snapshot and release it first.
     void setReportingUrl(const String& url);
 
+    // PEM of the CA the reporting server's HTTPS certificate is checked
+    // against ("" for none), kept in NVS apart from the config and handed to
+    // httpPool. Written at once: it only changes when the user confirms.
+    String getServerCa();
+    void setServerCa(const String& pem);
+    void setTheme(const char* theme);
+    void setBrightness(uint8_t brightness);
+
+    // Lookup for icon names outside the built-in set (the uploaded icon
+    // pack, see icon_pack.h), tried before findIcon(); answers
+    // IconId::COUNT for names it doesn't know
+    typedef IconId (*IconLookup)(const char* name);
+    void setIconLookup(IconLookup lookup) { iconLookup = lookup; }
+
+    // Resolve every button and scene icon again, after the lookup changed
+    void refreshIcons();
+
     // Get device ID (MAC-based if not configured)
     String getDeviceId();
 
@@ -156,15 +502,99 @@ public:
     // Reset to default configuration
     void resetToDefaults();
 
-    // Update a single button state
+    // Update a single button state (a one-byte store into the live config,
+    // too frequent to be worth a copy)
     void setButtonState(uint8_t buttonId, bool state);
 
+    // Same for a fan's speed level (and the on state it implies)
+    void setButtonSpeed(uint8_t buttonId, uint8_t speedLevel);
+
     // Get button state
     bool getButtonState(uint8_t buttonId);
 
+    // Bumped on every published change (including button states); used for
+    // ETags and cache invalidation
+    uint32_t getGeneration() const { return generation.load(); }
+
+    // Hash the server sent along with the live config (its "configHash"),
+    // or 0 once anything else has replaced it, and after a restart; button
+    // states don't count. The server asks for it (If-None-Match "h<hash>"
+    // on /api/config) to skip pushing a config we already hold
+    uint32_t getServerConfigHash() const { return serverConfigHash.load(); }
+
+    // O(1) lookup of a button by id (nullptr / -1 if not configured)
+    const ButtonConfig* findButton(uint8_t buttonId) const;
+    int findButtonIndex(uint8_t buttonId) const;
+
+    // Ids of the buttons bound to bindingId (at most max), by binary search
+    // of the live slot's binding table; returns how many
+    int findButtonsByBinding(uint32_t bindingId, uint8_t* buttonIds, int max) const;
+
 private:
-    DeviceConfig config;
+    friend class ConfigSnapshot;
+
+    // Two config slots, each with its own string arena, used RCU-style:
+    // writers build the spare slot and publish it with one atomic index
+    // swap; readers pin the live slot with a reader count, and a writer
+    // waits for the spare's readers to drain before reusing it
+    struct BindingIndexEntry {
+        uint32_t bindingId;
+        uint8_t buttonId;
+    };
+    struct ConfigSlot {
+        DeviceConfig config;
+        ConfigArena arena;
+        uint8_t buttonIndexById[256];   // buttonId -> index into config.buttons
+        BindingIndexEntry bindings[MAX_BUTTONS];    // Bound buttons, by bindingId
+        uint8_t bindingCount;
+    };
+    ConfigSlot slots[2];
+    std::atomic<uint32_t> activeSlot;
+    mutable std::atomic<int32_t> readers[2];
+    SemaphoreHandle_t writeMutex;   // Serializes writers only
+    std::atomic<uint32_t> generation;
+    std::atomic<uint32_t> serverConfigHash;
+    uint32_t pendingConfigHash;     // For commitUpdate() to publish; under writeMutex
     bool configured;
+    const char* lastParseError;
+    IconLookup iconLookup;
+
+    // What a config icon name refers to: the lookup's icon, else a built-in
+    IconId resolveIcon(const char* name) const;
+
+    // Resolve the display's theme names against the built-in themes and its
+    // own display.themes; unknown names get the field's default theme
+    static void resolveThemes(DisplayConfig& display);
+    static ThemeId resolveTheme(const char* name, const DisplayConfig& display, ThemeId fallback);
+
+    DeviceConfig& live() { return slots[activeSlot.load()].config; }
+    const DeviceConfig& live() const { return slots[activeSlot.load()].config; }
+
+    // Reader side: pin the live slot (lock-free) and release it
+    uint32_t pinSnapshot() const;
+    void unpinSnapshot(uint32_t slot) const;
+
+    // Start building the spare slot (holds the writer mutex until
+    // commit/abort); clone=true starts from a copy of the live config
+    ConfigSlot& beginUpdate(bool clone);
+    bool commitUpdate();
+    void abortUpdate();
+    bool commitPatch();     // commitUpdate() that reports an arena overflow
+
+    // Deserialize with the config filter into a document sized for the input
+    // (zeroCopy: strings stay in the caller's mutable buffer)
+    bool parseConfigDoc(const char* json, size_t len, bool zeroCopy, bool keepReportingUrl);
+
+    // Copy a parsed config document into config
+    bool applyConfigDoc(JsonDocument& doc, bool keepReportingUrl);
+
+    // Versioned binary layout used for NVS storage (JSON is wire-only)
+    bool encodeBinary(std::vector<uint8_t>& out) const;
+    bool decodeBinary(const uint8_t* data, size_t len);
+
+    // Rebuild a slot's id and binding lookups after its buttons changed
+    static void rebuildButtonIndex(ConfigSlot& slot);
+    static const uint8_t NO_BUTTON = 0xFF;
 
     // Generate default device ID from MAC address
     String generateDeviceId();
@@ -172,12 +602,44 @@ private:
     // Create default configuration
     void createDefaultConfig();
 
+    // Write-behind persistence
+    static void persistTask(void* parameter);
+    TaskHandle_t persistHandle;
+    portMUX_TYPE dirtyMux;
+    uint8_t dirtySections;
+    unsigned long lastDirtyAt;
+    volatile uint32_t persistWrites;
+
+    static const uint32_t PERSIST_DELAY_MS = 2000;
+
     // NVS namespace
     static const char* NVS_NAMESPACE;
     static const char* NVS_CONFIG_KEY;
+    static const char* NVS_CONFIG_BIN_KEY;
+    static const char* NVS_SERVER_CA_KEY;
 };
 
 // Global instance
 extern ConfigManager configManager;
 
+// Pins the config that is live at construction for the lifetime of the
+// object. Lock-free, so it is safe in the render loop. No ConfigManager
+// setter may be called while one is held (see above).
+class ConfigSnapshot {
+public:
+    explicit ConfigSnapshot(const ConfigManager& manager = configManager)
+        : manager(manager), slot(manager.pinSnapshot()) {}
+    ~ConfigSnapshot() { manager.unpinSnapshot(slot); }
+
+    ConfigSnapshot(const ConfigSnapshot&) = delete;
+    ConfigSnapshot& operator=(const ConfigSnapshot&) = delete;
+
+    const DeviceConfig& operator*() const { return manager.slots[slot].config; }
+    const DeviceConfig* operator->() const { return &manager.slots[slot].config; }
+
+private:
+    const ConfigManager& manager;
+    uint32_t slot;
+};
+
 #endif // CONFIG_MANAGER_H
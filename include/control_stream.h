@@ -0,0 +1,57 @@
+#ifndef CONTROL_STREAM_H
+#define CONTROL_STREAM_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// Live updates from a continuous control (the fan overlay's slider; any
+// dimmer slider should use one too).
+//
+// Sending only on release leaves the accessory behind the finger for the
+// whole drag; sending every step floods the action queue and the server.
+// A stream sends at most one value per interval while the control is
+// dragged: the first move goes out at once, later ones within the
+// interval are held, and the last held one goes out when the interval
+// ends (a timer, so a finger resting mid-drag still gets there). On
+// release the final value is always sent unless it is exactly what went
+// out last. Each send goes through the normal action path, where changes
+// to the same button coalesce until the worker takes them.
+//
+// LVGL task only.
+class ControlStream {
+public:
+    typedef void (*SendFn)(uint8_t id, int value);
+
+    explicit ControlStream(SendFn send, uint32_t intervalMs = INTERVAL_MS);
+
+    // The control now drives id, starting from value (what was sent last)
+    void start(uint8_t id, int value);
+
+    // Dragged to value
+    void update(int value);
+
+    // Released (or tapped) at value: the trailing-edge send
+    void finish(int value);
+
+    // The control went away (overlay closed, rebuild): send anything still
+    // held and stop until the next start()
+    void flush();
+
+    static const uint32_t INTERVAL_MS = 250;
+
+private:
+    static void onTimer(lv_timer_t* timer);
+    void send(int value);
+
+    SendFn sendFn;
+    uint32_t intervalMs;
+    lv_timer_t* timer;          // Created on first use, paused when idle
+    uint8_t id;
+    bool active;                // Between start() and flush()
+    int lastSent;
+    uint32_t lastSentAt;
+    bool pending;
+    int pendingValue;
+};
+
+#endif // CONTROL_STREAM_H
@@ -0,0 +1,63 @@
+#ifndef CRASH_REPORT_H
+#define CRASH_REPORT_H
+
+#include <Arduino.h>
+
+struct HeapSample;
+class Print;
+
+// Crash telemetry from the previous boot, for panels nobody has a serial
+// cable on.
+//
+// A panic (including the interrupt watchdog) leaves an ELF core dump in the
+// coredump partition. At boot begin() reads the reset reason and, if a dump
+// is there, its summary: the crashing task, PC, backtrace and exception
+// cause. The dump holds no heap statistics, so the heap monitor's samples are
+// also mirrored into RTC memory, which survives everything but a power cut;
+// the report carries the last one taken before the reset.
+//
+// Resets with no dump (task watchdog, brownout) are reported too, from the
+// reset reason and the heap snapshot alone. Power-on, software and deep-sleep
+// resets are not crashes and leave nothing to report.
+//
+// The report goes to POST <reportingUrl>/api/devices/<id>/crash after the
+// first successful config fetch; the dump is erased only once the server has
+// accepted it, so a failed upload is retried on the next boot. The same JSON
+// is served at GET /api/diag/crash until then.
+class CrashReport {
+public:
+    CrashReport();
+
+    // Setup, before anything samples the heap: capture the previous boot
+    void begin();
+
+    // Heap monitor sample, kept for the next boot's report
+    void noteHeap(const HeapSample& sample);
+
+    // A report from the previous boot is waiting for the server
+    bool isPending() const { return pending; }
+
+    // NetBoot task: send the report; erase the dump once it is stored.
+    // False if there was nothing to send or the server didn't take it.
+    bool upload(const String& reportingUrl, const String& deviceId);
+
+    // The pending report, or {"pending":false}
+    void writeJson(Print& out) const;
+
+    static const size_t REPORT_SIZE = 1024;
+    static const uint16_t UPLOAD_TIMEOUT_MS = 5000;
+
+private:
+    // From esp_reset_reason(); nullptr for resets that aren't crashes
+    static const char* crashReason(int reason);
+    void buildReport(const char* reason, bool haveDump);
+
+    char report[REPORT_SIZE];
+    volatile bool pending;
+    bool haveDump;
+};
+
+// Global instance
+extern CrashReport crashReport;
+
+#endif // CRASH_REPORT_H
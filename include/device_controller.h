@@ -3,14 +3,50 @@
 
 #include <Arduino.h>
 #include <freertos/FreeRTOS.h>
-#include <freertos/queue.h>
+#include <freertos/task.h>
 #include <freertos/semphr.h>
 #include "config_manager.h"
+#include "metric_histogram.h"
 
-// Async HTTP request structure
-struct HttpRequest {
-    char url[256];
-    char payload[512];
+// Webhooks waiting for an HTTP worker, coalesced per id: a newer press of
+// the same button overwrites the older one, different buttons never collide.
+// The direct lane's table only uses the button fields.
+struct PendingActions {
+    uint32_t buttons[8];        // Bit per buttonId with an unsent change
+    uint32_t buttonStates[8];   // Latest state per buttonId
+    uint32_t hasSpeed[8];       // Bit per buttonId whose change carries a fan speed
+    uint8_t speedLevels[256];   // Latest fan speed per buttonId
+    uint32_t direct[8];         // Bit per buttonId its direct control target carried out
+    uint32_t scenes[8];         // Bit per sceneId pressed since the last send
+    bool replay;                // Send the offline journal
+};
+
+// Requests for the background lane, one bit each; lower bits go first
+enum BackgroundRequest : uint8_t {
+    BG_PROBE = 1 << 0,          // /api/ping connectivity check
+    BG_STATE_REPORT = 1 << 1,   // POST the state document
+    BG_CRASH_REPORT = 1 << 2,   // Upload the previous boot's crash report
+};
+
+// Presses shown on screen before the server has taken them. The card flips
+// at once; if the batch carrying the change can't be delivered after a few
+// tries, or the server reports the plugin refused it, the card goes back to
+// where it was and flashes a failure outline.
+struct UnconfirmedActions {
+    uint32_t buttons[8];        // Bit per buttonId awaiting confirmation
+    uint32_t hasPrior[8];       // Bit per buttonId whose earlier state is known
+    uint32_t priorStates[8];    // State to go back to
+    uint32_t priorIsSpeed[8];   // Bit per buttonId to go back to a fan speed instead
+    uint8_t priorSpeeds[256];   // Fan speed to go back to
+    uint8_t failures[256];      // Failed sends of the current change
+};
+
+// What became of one sent batch
+struct BatchOutcome {
+    bool delivered;             // The server has the batch
+    uint32_t direct[8];         // Bit per buttonId its direct control target carried out
+    uint32_t refused[8];        // Bit per buttonId the server answered but couldn't carry out
+    uint32_t refusedStates[8];  // State of those buttons there
 };
 
 class DeviceController {
@@ -23,54 +59,224 @@ public:
     // Handle button state change (called from UI)
     void onButtonStateChanged(uint8_t buttonId, bool newState);
 
+    // Handle fan speed change (called from UI)
+    void onFanSpeedChanged(uint8_t buttonId, uint8_t speedLevel);
+
     // Handle scene activation (called from UI)
     void onSceneActivated(uint8_t sceneId);
 
     // Set all buttons to a specific state
     void setAllButtons(bool state);
 
-    // Send state update to server
+    // Any task: POST the state document to the server, on the background
+    // lane; skipped if nothing changed since the last report it accepted
     void reportStateToServer();
 
-    // Process incoming state update from server
-    void processServerStateUpdate(const String& json);
+    // Any task: upload a pending crash report, on the background lane
+    void uploadCrashReport();
+
+    // Process incoming state update from server. Parses in place (the buffer
+    // is modified) and keeps only the fields we apply; false if malformed.
+    // msgpack selects MessagePack instead of JSON for the same document shape.
+    // resync is set when a delta doesn't apply to our version (full push needed).
+    bool processServerStateUpdate(char* json, size_t len, bool msgpack = false, bool* resync = nullptr);
+
+    // Apply one button's state from the server (speedLevel -1 for non-fans),
+    // skipping it if it already matches; true if anything changed. Any task.
+    bool applyServerButton(uint8_t id, bool state, int speedLevel);
+
+    // Same, for a state a peer panel mirrored (see peer_mirror.h): shown,
+    // but not taken as confirmed by the server
+    bool applyPeerButton(uint8_t id, bool state, int speedLevel);
+
+    // Server state version last applied (0 until the first versioned push)
+    uint32_t getStateVersion() const { return stateVersion; }
+
+    // Boot, before begin(): the version of the states restored from before
+    // a restart (warm_state.h), so a delta against it applies cleanly
+    void setStateVersion(uint32_t version) { stateVersion = version; }
+
+    // Server state entries dropped at ingest because nothing changed
+    uint32_t getSuppressedUpdates() const { return suppressedUpdates; }
+
+    // Drop UI actions instead of sending them (UI benchmark runs)
+    void setActionsMuted(bool muted) { actionsMuted = muted; }
+
+    // Presses the server didn't confirm and were undone on screen
+    uint32_t getActionRollbacks() const { return actionRollbacks; }
+
+    // Actions sent straight to a direct control target, and those that
+    // went through the server instead because the target failed
+    uint32_t getDirectActions() const { return directActions; }
+    uint32_t getDirectFallbacks() const { return directFallbacks; }
+
+    // Action batches the server got and didn't, and how long each took to
+    // send (for /metrics)
+    uint32_t getBatchesDelivered() const { return batchesDelivered; }
+    uint32_t getBatchesFailed() const { return batchesFailed; }
+    const MetricHistogram& getBatchLatency() const { return batchLatency; }
 
-    // Get device state as JSON for API
+    // Offline journal: actions waiting for the server, actions the server
+    // has taken from it, and actions pushed out of it by newer ones
+    uint8_t getJournaled() const;
+    uint32_t getJournalReplayed() const { return journalReplayed; }
+    uint32_t getJournalDropped() const;
+
+    // Any task: the server may be reachable again, send the journal if
+    // anything is in it
+    void replayJournal();
+
+    // Any task: the state document (GET /api/state, state reports) as JSON
+    // or MessagePack. Served from a snapshot serialized once per change of
+    // the config generation (button states included), state version,
+    // brightness or address; only the uptime is spliced in per call.
     String getStateJson();
+    void writeState(Print& out, bool msgpack);
 
     // Check if server is reachable
     bool isServerConnected();
 
-    // Periodic tasks (call from main loop)
-    void update();
-
-    // HTTP worker task (public for FreeRTOS callback)
+    // HTTP lanes, each its own task so a slow request of one kind never
+    // holds up another (public for FreeRTOS):
+    //   httpWorkerTask: action batches (buttons, scenes, journal) to the server
+    //   directWorkerTask: button actions at their direct control targets
+    //   backgroundWorkerTask: probes, state reports, crash reports
     static void httpWorkerTask(void* parameter);
+    static void directWorkerTask(void* parameter);
+    static void backgroundWorkerTask(void* parameter);
 
 private:
+    // The state document without the uptime, which writeState() puts first
+    void buildStateDoc(JsonDocument& doc, const DeviceConfig& config);
+    // Under snapshotMutex: serialize the snapshot again if its inputs moved
+    void refreshSnapshot();
+
     // Send webhook for button action
     void sendButtonWebhook(uint8_t buttonId, bool state);
 
-    // Send webhook for scene action
-    void sendSceneWebhook(uint8_t sceneId);
+    // Mark work for the HTTP workers and wake them. Buttons with a direct
+    // control target go to the direct lane first.
+    void queueButtonAction(uint8_t buttonId, bool state, int speedLevel = -1);
+    void queueSceneAction(uint8_t sceneId);
+    void queueServerProbe();
+    void queueBackground(uint8_t request);
+    void wakeWorker();
+
+    // Action lane: swap out the pending table / send one batch
+    bool takePending(PendingActions& batch);
+    void flushPending(const PendingActions& batch, BatchOutcome& outcome);
+    int postFromWorker(const char* url, const char* payload, String* response = nullptr,
+                       char* buf = nullptr, size_t len = 0);
+
+    // Direct lane: carry out each button's action at its direct control
+    // target, then hand it to the action lane (marked direct if the target
+    // took it, so the server only records it)
+    bool takeDirect(PendingActions& batch);
+    bool sendDirect(uint8_t buttonId, bool state, int speedLevel);
+
+    // Background lane: one request
+    void runBackground(uint8_t request);
+    void sendStateReport();
+    bool stateReported() const;
+
+    // Offline journal (RTC slow memory, see device_controller.cpp): an
+    // action made while WiFi is down replaces the one of the same button or
+    // scene in it. Every batch carries what's in the journal; the entries
+    // it carried are removed once the server has the batch.
+    void journalAction(uint8_t kind, uint8_t id, bool state, int speedLevel = -1);
+    void journalBatch(const PendingActions& batch);
+    uint32_t addJournal(JsonDocument& doc);
+    void trimJournal(uint32_t throughSeq);
+    uint32_t journalReplayed;
 
-    // HTTP POST helpers
-    bool httpPost(const String& url, const String& payload);
-    void httpPostAsync(const String& url, const String& payload);
+    // Optimistic presses: remember what the card showed before, then settle
+    // each sent batch. settleBatch puts undelivered changes back in the table
+    // (unless retry is false or they're out of tries) and undoes the rest;
+    // it returns how long the worker should wait before the next try.
+    void trackAction(uint8_t buttonId, bool hasPrior, bool priorState, bool priorIsSpeed, uint8_t priorSpeed);
+    uint32_t settleBatch(const PendingActions& batch, const BatchOutcome& outcome, bool retry);
+    void rollbackAction(uint8_t buttonId, bool hasPrior, bool priorState, bool priorIsSpeed, uint8_t priorSpeed);
 
-    // Track server connectivity
-    bool serverConnected;
-    unsigned long lastServerCheck;
+    // Lane-only scratch buffers, so sending doesn't touch the heap
+    char workerUrl[256];
+    char workerDeviceId[64];
+    char workerPayload[1536];   // Room for a full journal next to the live actions
+    char* workerResponse;       // Batch results; an http pool slot in the static build, else a String
+    char directUrl[256];
+    char directBody[192];
+    char directAuth[512];
+    uint32_t directActions;
+    uint32_t directFallbacks;
+    uint32_t batchesDelivered;
+    uint32_t batchesFailed;
+    MetricHistogram batchLatency;
+
+    // Deadline of each kind of request (connect and response each); crash
+    // reports use CrashReport::UPLOAD_TIMEOUT_MS
+    static const uint16_t ACTION_TIMEOUT_MS = 3000;
+    static const uint16_t DIRECT_TIMEOUT_MS = 1500;
+    static const uint16_t PROBE_TIMEOUT_MS = 2000;
+    static const uint16_t REPORT_TIMEOUT_MS = 2000;
+
+    // Sequence number of the last batch sent (lets the server drop retries)
+    uint32_t actionSeq;
+
+    // Last server state version applied
+    volatile uint32_t stateVersion;
+    uint32_t suppressedUpdates;
+
+    // Record the outcome of any exchange with the server
+    void noteServerResult(bool reachable);
+
+    // Track server connectivity (written by the HTTP worker and web callbacks)
+    volatile bool serverConnected;
+    volatile unsigned long lastServerContact;
+    int8_t serverCheckJob;
     static const unsigned long SERVER_CHECK_INTERVAL = 30000;  // 30 seconds
 
-    // Rate limiting for webhooks
-    unsigned long lastWebhookTime;
-    static const unsigned long WEBHOOK_MIN_INTERVAL = 100;  // 100ms between webhooks
+    // Scheduler job: periodic connectivity check
+    static void onServerCheckTimer(void* arg);
 
-    // Async HTTP queue (single worker, prevents socket exhaustion)
-    static const int HTTP_QUEUE_SIZE = 3;
-    QueueHandle_t httpQueue;
+    // Pending tables of the action and direct lanes and the background
+    // lane's requests, all under pendingMux
+    PendingActions pending;
+    PendingActions directPending;
+    uint8_t backgroundPending;
+    portMUX_TYPE pendingMux;
     TaskHandle_t httpWorkerHandle;
+    TaskHandle_t directWorkerHandle;
+    TaskHandle_t backgroundWorkerHandle;
+    uint16_t batchTrace;    // Latency trace riding on the batch being sent (worker only)
+    volatile bool actionsMuted;
+
+    // Unconfirmed presses, and the fan speeds the server last confirmed
+    // (the slider has already moved by the time we hear of a change); both
+    // under pendingMux
+    UnconfirmedActions unconfirmed;
+    uint32_t confirmedFans[8];
+    uint8_t confirmedSpeeds[256];
+    uint32_t actionRollbacks;
+    static const uint8_t MAX_ACTION_RETRIES = 2;
+    static const uint32_t ACTION_RETRY_MS = 500;   // Doubles with each failed try
+
+    // State snapshot and what it was built from, under snapshotMutex. The
+    // MessagePack copy is a fixmap; writeState() bumps its count for the
+    // uptime pair it writes ahead of the rest.
+    SemaphoreHandle_t snapshotMutex;
+    String snapshotJson;
+    uint8_t* snapshotPacked;
+    size_t snapshotPackedLen;
+    bool snapshotValid;
+    uint32_t snapshotGeneration;
+    uint32_t snapshotVersion;
+    uint32_t snapshotIp;
+    uint8_t snapshotBrightness;
+
+    // What the last accepted state report held (config generation covers
+    // button states, stateVersion the server's pushes)
+    bool reportedValid;
+    uint32_t reportedGeneration;
+    uint32_t reportedVersion;
 };
 
 // Global instance
@@ -0,0 +1,90 @@
+#ifndef EVENT_SCHEDULER_H
+#define EVENT_SCHEDULER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+typedef void (*EventJobFn)(void* arg);
+
+// Deadline scheduler for the main loop's periodic and deferred work.
+//
+// Modules register a job once in begin() and then set its next deadline
+// from any task. Deadlines sit in a MAX_JOBS min-heap; run() executes those
+// that are due, in the loop task, and then blocks on a task notification
+// until the earliest remaining one. An earlier deadline set from another
+// task notifies the loop so the block is cut short. Between deadlines the
+// loop task is not runnable at all, instead of waking every
+// LOOP_INTERVAL_MS to check a dozen millis() comparisons.
+//
+// Jobs flagged wallClock also run whenever TimeManager reports that the
+// clock or timezone moved, since their deadlines were derived from it.
+class EventScheduler {
+public:
+    EventScheduler();
+
+    // setup(): jobs run in the calling (loop) task
+    void begin();
+
+    // Register a job (setup only). Returns its id, -1 if the table is full.
+    int8_t add(const char* name, EventJobFn fn, void* arg, bool wallClock = false);
+
+    // Any task: due delayMs from now, replacing a pending deadline
+    void schedule(int8_t id, uint32_t delayMs);
+
+    // Any task: due no later than delayMs from now
+    void scheduleWithin(int8_t id, uint32_t delayMs);
+
+    // Any task: due now
+    void post(int8_t id) { scheduleWithin(id, 0); }
+
+    void cancel(int8_t id);
+
+    // TimeManager: run every wallClock job now
+    void postWallClockChange();
+
+    // ms until the job is due (0 if due, UINT32_MAX if not scheduled)
+    uint32_t remainingMs(int8_t id) const;
+
+    // loop(): run what's due, then sleep until the next deadline or a post
+    void run();
+
+    // Job table with run counts and lateness
+    void writeJson(Print& out) const;
+
+    static const uint8_t MAX_JOBS = 20;
+    static const uint32_t MAX_SLEEP_MS = 60000;     // Longest single block in run()
+
+private:
+    struct Job {
+        const char* name;
+        EventJobFn fn;
+        void* arg;
+        int64_t dueUs;          // esp_timer time
+        int8_t heapPos;         // -1 when not scheduled
+        bool wallClock;
+        uint32_t runs;
+        uint32_t maxLateUs;
+    };
+
+    // All *Locked helpers expect mux held; they return true when the heap
+    // top changed and the loop may need waking
+    bool setDueLocked(int8_t id, int64_t dueUs);
+    void removeLocked(int8_t id);
+    void siftUp(uint8_t pos);
+    void siftDown(uint8_t pos);
+    void place(uint8_t pos, int8_t id);
+    void wakeOwner();
+
+    Job jobs[MAX_JOBS];
+    uint8_t jobCount;
+    int8_t heap[MAX_JOBS];
+    uint8_t heapSize;
+    mutable portMUX_TYPE mux;
+    TaskHandle_t owner;
+};
+
+// Global instance
+extern EventScheduler eventScheduler;
+
+#endif // EVENT_SCHEDULER_H
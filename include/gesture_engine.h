@@ -0,0 +1,97 @@
+#ifndef GESTURE_ENGINE_H
+#define GESTURE_ENGINE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+enum class Gesture : uint8_t {
+    NONE,
+    SWIPE_UP,           // From the bottom edge
+    SWIPE_DOWN,         // From the top edge
+    SWIPE_LEFT,         // From the right edge
+    SWIPE_RIGHT,        // From the left edge
+    LONG_PRESS,
+    TWO_FINGER_TAP,
+    PINCH_IN,
+    PINCH_OUT
+};
+
+// One contact in screen coordinates
+struct TouchPoint {
+    int16_t x;
+    int16_t y;
+};
+
+// Recognizes swipes, long-press, two-finger tap and pinch from the raw GT911
+// points, one sample at a time in the touch task. Integer math only (spans
+// are compared squared, so there's no sqrt) and no allocation.
+//
+// Swipes only start in an EDGE_PX band along the screen border and must
+// cover SWIPE_MIN_PX within SWIPE_MAX_MS, mostly along one axis, so drags
+// on cards and the fan slider are left alone. A second finger makes the
+// touch a two-finger gesture. Swipes and two-finger gestures claim the
+// touch: update() then returns true and the caller cancels LVGL's press so
+// the card under the first finger isn't clicked. A long-press is reported
+// but not claimed, since LVGL may be using the same press.
+//
+// Recognized gestures go into a small ring for the LVGL task to pop.
+class GestureEngine {
+public:
+    GestureEngine();
+
+    // Touch task: feed one sample (count = 0 when released). Returns true
+    // once the current touch belongs to a gesture.
+    bool update(const TouchPoint* points, uint8_t count, unsigned long now);
+
+    // LVGL task: oldest recognized gesture
+    bool pop(Gesture& gesture);
+
+    static const char* name(Gesture gesture);
+
+    uint32_t getRecognized() const { return recognized; }
+
+    static const uint8_t MAX_POINTS = 5;                // GT911 limit
+    static const int16_t EDGE_PX = 40;
+    static const int16_t SWIPE_MIN_PX = 100;
+    static const unsigned long SWIPE_MAX_MS = 500;
+    static const int16_t TAP_SLOP_PX = 16;
+    static const unsigned long LONG_PRESS_MS = 800;
+    static const unsigned long TWO_FINGER_TAP_MS = 400; // First finger down to last finger up
+    static const uint8_t PINCH_OUT_Q4 = 25;             // Span ratio squared, x16: 1.25^2
+    static const uint8_t PINCH_IN_Q4 = 10;              // ~0.8^2
+    static const uint8_t QUEUE_SIZE = 4;
+
+private:
+    enum class Phase : uint8_t {
+        IDLE,
+        ONE,            // Single finger, not yet recognized
+        TWO,            // Two or more fingers, no pinch yet
+        DONE            // Recognized (or ruled out); wait for release
+    };
+
+    void emit(Gesture gesture);
+    void updateOne(const TouchPoint& p, unsigned long now);
+    void updateTwo(const TouchPoint* points, unsigned long now);
+    void release(unsigned long now);
+    static int32_t spanSq(const TouchPoint* points);
+
+    Phase phase;
+    bool claimed;
+    bool moved;                 // Beyond TAP_SLOP_PX since the touch began
+    bool longPressSent;
+    TouchPoint start;           // First finger
+    TouchPoint startCenter;     // Two-finger centroid when the second finger landed
+    int32_t startSpanSq;
+    unsigned long startedAt;
+
+    Gesture queue[QUEUE_SIZE];
+    uint8_t head;
+    uint8_t count;
+    portMUX_TYPE mux;
+    uint32_t recognized;
+};
+
+// Global instance
+extern GestureEngine gestureEngine;
+
+#endif // GESTURE_ENGINE_H
@@ -0,0 +1,106 @@
+#ifndef HEAP_MONITOR_H
+#define HEAP_MONITOR_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+// Heap and PSRAM fragmentation telemetry, served at /api/diag/heap and
+// piggybacked on the server channel's pong.
+//
+// Every SAMPLE_INTERVAL_MS a main-loop job records heap_caps_get_info() for
+// internal SRAM and PSRAM (free, largest free block, low-water mark) and the
+// LVGL allocator's usage into a ring of HISTORY_SIZE samples (one hour).
+//
+// Subsystems that allocate in bursts wrap the work in a HeapTagScope. The
+// scope counts the operation, adds the change in free heap across it to the
+// tag's running totals, and sets the tag's bit in the current sample, so a
+// drop in the largest free block can be lined up with the config push or UI
+// rebuild that preceded it. Other tasks keep allocating meanwhile, so the
+// per-tag deltas are indicative, not exact.
+//
+// The report also carries the PSRAM JSON pools' totals (json_alloc.h) and,
+// in the static memory build, its pools and post-setup heap allocations
+// (static_memory.h).
+enum HeapTag : uint8_t {
+    HEAP_TAG_CONFIG = 0,    // Config parse/apply (pushes, fetches, POST /api/config)
+    HEAP_TAG_WEB,           // AsyncWebServer request bodies
+    HEAP_TAG_HTTP_WORKER,   // Webhook batches sent by the HTTP worker
+    HEAP_TAG_UI_REBUILD,    // UI reconcile/rebuild after a config change
+    HEAP_TAG_COUNT
+};
+
+struct HeapSample {
+    uint32_t uptimeS;
+    uint32_t internalFree;
+    uint32_t internalLargest;
+    uint32_t internalMin;       // Lowest free internal heap since boot
+    uint32_t psramFree;
+    uint32_t psramLargest;
+    uint32_t psramMin;
+    uint32_t lvglUsed;          // Bytes LVGL holds (both pools)
+    uint32_t lvglLargest;       // Largest block LVGL can still get from its pool
+    uint8_t lvglFragPct;
+    uint8_t tags;               // HeapTag bits active since the previous sample
+};
+
+struct HeapTagStats {
+    uint32_t ops;
+    int32_t internalNet;        // Sum of free internal heap lost across ops
+    int32_t psramNet;
+    int32_t lastInternal;       // Same, for the most recent op
+    int32_t lastPsram;
+};
+
+class HeapMonitor {
+public:
+    HeapMonitor();
+
+    // Allocate the history (PSRAM), take the first sample and schedule the rest
+    void begin();
+
+    // HeapTagScope bookkeeping
+    void beginTag(HeapTag tag);
+    void endTag(HeapTag tag, int32_t internalDelta, int32_t psramDelta);
+
+    HeapTagStats getTagStats(HeapTag tag) const;
+    static const char* tagName(HeapTag tag);
+
+    // Whole history, as columns + rows to keep it compact
+    void writeJson(Print& out) const;
+
+    // Latest sample and tag totals as one JSON object, for the pong
+    size_t writeHeartbeat(char* buf, size_t len) const;
+
+    static const unsigned long SAMPLE_INTERVAL_MS = 30000;
+    static const uint16_t HISTORY_SIZE = 120;
+
+private:
+    static void onSampleTimer(void* arg);
+    void takeSample();
+
+    HeapSample* history;
+    uint16_t head;
+    uint16_t count;
+    HeapSample latest;
+    HeapTagStats tagStats[HEAP_TAG_COUNT];
+    uint8_t activeTags;         // Tags seen since the last sample
+    mutable portMUX_TYPE mux;
+    int8_t sampleJob;
+};
+
+// Global instance
+extern HeapMonitor heapMonitor;
+
+// Tags the allocations made while it is in scope
+class HeapTagScope {
+public:
+    explicit HeapTagScope(HeapTag tag);
+    ~HeapTagScope();
+
+private:
+    HeapTag tag;
+    uint32_t internalStart;
+    uint32_t psramStart;
+};
+
+#endif // HEAP_MONITOR_H
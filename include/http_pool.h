@@ -0,0 +1,133 @@
+#ifndef HTTP_POOL_H
+#define HTTP_POOL_H
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <WiFiClientSecure.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+class HTTPClient;
+
+// Keep-alive connection pool for the reporting server (and the direct
+// control targets buttons may call, see DirectTargetConfig).
+//
+// Each slot owns a persistent WiFiClient that HTTPClient reuses across
+// requests to the same host:port, so back-to-back webhooks skip the TCP
+// handshake. Slots idle for longer than IDLE_TIMEOUT are closed before reuse
+// (servers typically drop idle keep-alives after ~5 s and a half-open socket
+// costs a full timeout), and a request that fails on a reused socket is
+// retried once on a fresh connection.
+//
+// https:// URLs are pooled the same way on a WiFiClientSecure, so the TLS
+// handshake (hundreds of ms of CPU on the S3) is paid once per kept-alive
+// connection rather than per request. The reporting server's certificate is
+// checked against the CA set with setCACert() (kept in PSRAM); without one
+// the connection is encrypted but the server isn't verified. URLs that don't
+// parse fall back to a one-shot HTTPClient request.
+//
+// New connections to a host name go to its last resolved address, kept for
+// RESOLVE_TTL_MS, instead of resolving it again (an mDNS .local lookup
+// takes hundreds of ms). A request that fails at the connection level drops
+// the address, so the next one resolves afresh.
+class HttpConnectionPool {
+public:
+    HttpConnectionPool();
+
+    // Create the slot mutex (call once before use)
+    void begin();
+
+    // Perform a request. Returns the HTTP status code, or a negative
+    // HTTPC_ERROR_* code on failure. If response is non-null it receives the body.
+    int post(const char* url, const char* payload, uint16_t timeoutMs, String* response = nullptr);
+    int get(const char* url, uint16_t timeoutMs, String* response = nullptr);
+
+    // POST with the body read into buf (NUL-terminated, cut to len - 1
+    // bytes) instead of a String. Needs no heap when the server sends a
+    // Content-Length; a chunked body still goes through HTTPClient.
+    int post(const char* url, const char* payload, uint16_t timeoutMs, char* buf, size_t len);
+
+    // PUT with an Authorization header (nullptr or "" for none)
+    int put(const char* url, const char* payload, const char* authorization, uint16_t timeoutMs);
+
+    // Close all pooled sockets and forget resolved addresses (e.g. after
+    // the reporting URL changes)
+    void closeAll();
+
+    static const int POOL_SIZE = 3;     // One keep-alive per DeviceController lane
+    static const unsigned long IDLE_TIMEOUT = 4000;  // 4 seconds
+    // Any task: PEM of the CA that signed HTTPS servers' certificates, copied
+    // to PSRAM; nullptr or "" for none. Idle TLS connections are closed.
+    void setCACert(const char* pem);
+    bool hasCACert() const { return caCert != nullptr; }
+
+    static const int RESOLVE_SLOTS = 4;
+    static const unsigned long RESOLVE_TTL_MS = 300000;  // 5 minutes
+
+private:
+    struct Slot {
+        WiFiClient client;
+        WiFiClientSecure tls;
+        bool secure;                // tls is the connection, not client
+        char host[64];
+        uint16_t port;
+        bool busy;
+        unsigned long lastUsed;
+
+        WiFiClient& conn() { return secure ? tls : client; }
+    };
+
+    // Where a response body goes: a String, or a caller's buffer
+    struct Body {
+        String* str;
+        char* buf;
+        size_t len;
+    };
+
+    int request(const char* method, const char* url, const char* payload,
+                const char* authorization, uint16_t timeoutMs, const Body& body);
+    int requestOnce(WiFiClient& client, bool reuse, const char* method, const char* url,
+                    const char* payload, const char* authorization,
+                    uint16_t timeoutMs, const Body& body);
+    static void readBody(HTTPClient& http, const Body& body);
+
+    Slot* acquire(const char* host, uint16_t port, bool secure, bool& reused);
+    void release(Slot* slot);
+
+    static bool parseHostPort(const char* url, char* host, size_t hostLen, uint16_t& port, bool& secure);
+
+    // Point a TLS client at the CA (or none) before it connects
+    void configureTls(WiFiClientSecure& tls, uint16_t timeoutMs);
+
+    // Connect client (a WiFiClientSecure if secure) to host's cached or
+    // freshly resolved address; left unconnected for HTTPClient to resolve
+    // itself if that fails
+    void connectResolved(WiFiClient& client, bool secure, const char* host, uint16_t port,
+                         uint16_t timeoutMs);
+    bool resolve(const char* host, IPAddress& ip);
+    void forget(const char* host);
+
+    struct Resolved {
+        char host[64];
+        IPAddress ip;
+        unsigned long resolvedAt;
+    };
+
+    Slot slots[POOL_SIZE];
+    SemaphoreHandle_t mutex;
+
+    // PSRAM copy of the CA PEM. The one it replaced is freed on the next
+    // change, so a handshake still reading it never sees freed memory.
+    char* volatile caCert;
+    char* retiredCaCert;
+
+    // Spinlock rather than the slot mutex: the config fetch at boot can
+    // run before begin()
+    Resolved resolved[RESOLVE_SLOTS];
+    portMUX_TYPE resolveMux;
+};
+
+// Global instance
+extern HttpConnectionPool httpPool;
+
+#endif // HTTP_POOL_H
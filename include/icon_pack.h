@@ -0,0 +1,152 @@
+#ifndef ICON_PACK_H
+#define ICON_PACK_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <lvgl.h>
+#include <esp_partition.h>
+#include "icon_registry.h"
+
+class Print;
+
+// Icons uploaded at runtime, on top of the compiled-in set (icon_registry.h),
+// so new icons don't need a firmware release.
+//
+// A pack is an image atlas with a name index, kept in the "icons" data
+// partition and read in place through esp_partition_mmap(): LVGL draws the
+// pixels straight from flash, and only an lv_img_dsc_t per icon is in RAM.
+//
+// Layout, little-endian, offsets from the start of the pack:
+//   IconPackHeader   magic, entry count, size and CRC-32 of what follows
+//   IconPackEntry[]  one per icon, sorted by name (strcmp() order)
+//   image data       at each entry's offset, 4-byte aligned: A8 (tinted
+//                    like the built-in icons), RGB565 or RGB565A8 (LVGL's
+//                    TRUE_COLOR_ALPHA, 3 bytes per pixel)
+//
+// The partition is split into two banks. An upload (POST /api/icons, the
+// raw pack) is staged in PSRAM, checked, and written by the heavy lane into
+// the bank not in use, header last, so a power cut mid-write keeps the old
+// pack. Then config icon names are resolved again and the UI rebuilt; the
+// old bank stays mapped until that rebuild has let go of it. A pack with
+// no entries removes the icons. Pack names shadow built-in ones.
+//
+// Tables without the partition (anything flashed before it was added) keep
+// the built-in icons and refuse uploads.
+
+static const uint32_t ICON_PACK_MAGIC = 0x4b504349;    // "ICPK"
+static const uint16_t ICON_PACK_VERSION = 1;
+
+enum IconPackFormat : uint8_t {
+    ICON_PACK_A8 = 0,
+    ICON_PACK_RGB565,
+    ICON_PACK_RGB565A8
+};
+
+struct IconPackHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;             // Entries
+    uint32_t size;              // Bytes after the header
+    uint32_t crc;               // esp_rom_crc32_le(0, ...) of those bytes
+    uint32_t sequence;          // Set by the device, the newer bank wins at boot
+    uint32_t reserved[3];
+};
+
+struct IconPackEntry {
+    char name[20];              // NUL-terminated
+    uint8_t format;             // IconPackFormat
+    uint8_t reserved;
+    uint16_t width;
+    uint16_t height;
+    uint16_t reserved2;
+    uint32_t offset;            // Of the pixels, from the start of the pack
+};
+
+class IconPack {
+public:
+    enum class State : uint8_t { IDLE, RECEIVING, INSTALLING, DONE, FAILED };
+
+    IconPack();
+
+    // Setup, before the config is loaded: map the newest valid bank and
+    // hand the pack's names to ConfigManager
+    void begin();
+
+    // AsyncTCP task, first body chunk: stage an upload of size bytes.
+    // False with the reason in error (nothing started) when refused.
+    bool beginUpload(size_t size, const char*& error);
+
+    // AsyncTCP task: the next body chunk, in order
+    void feed(const uint8_t* data, size_t len);
+
+    // The upload connection went away before the pack was complete
+    void abortUpload();
+
+    // Whole pack staged, ready for the JOB_ICON_PACK install
+    bool isStaged() const { return state == State::RECEIVING && received == size; }
+
+    // Heavy lane: check the staged pack, write it to the spare bank and
+    // switch to it
+    bool install();
+
+    // LVGL task, after a rebuild from config generation: unmap the
+    // replaced bank once no config from before the switch can be on screen.
+    // Returns true if it did.
+    bool releaseRetired(uint32_t generation);
+
+    // The image of a pack icon id, nullptr if the id isn't (or no longer) one
+    const lv_img_dsc_t* image(IconId id) const;
+
+    // ConfigManager::IconLookup for the active pack
+    static IconId lookup(const char* name);
+
+    bool isBusy() const { return state == State::RECEIVING || state == State::INSTALLING; }
+    const char* stateName() const;
+
+    // State, the active pack's icons and the last error
+    void writeJson(Print& out) const;
+
+    // Icons per bank; pack ids are ICON_PACK_FIRST + bank * MAX_ICONS + index
+    static const uint16_t MAX_ICONS = 64;
+    static const uint16_t MAX_ICON_SIZE = 256;         // Pixels per side
+
+private:
+    struct Bank {
+        spi_flash_mmap_handle_t handle;
+        const uint8_t* base;        // The mapped pack, nullptr if none
+        const IconPackEntry* entries;
+        lv_img_dsc_t* images;
+        uint16_t count;
+        uint32_t size;              // Header included
+        uint32_t sequence;
+    };
+
+    // Why a pack of len bytes can't be used, nullptr if it can
+    static const char* validate(const uint8_t* pack, size_t len);
+
+    bool mapBank(int bank);
+    void unmapBank(int bank);
+    void fail(const char* reason);
+    void freeStaging();
+
+    const esp_partition_t* partition;
+    size_t bankSize;
+    Bank banks[2];
+    volatile int8_t activeBank;     // -1 without a pack
+    volatile int8_t retiredBank;    // Replaced, mapped until the UI lets go
+    uint32_t retireAfter;           // Config generation that no longer uses it
+
+    portMUX_TYPE mux;
+    volatile State state;
+    const char* error;
+    uint8_t* staging;
+    size_t size;
+    volatile size_t received;
+    unsigned long startedAt;
+    uint32_t installMs;
+};
+
+// Global instance
+extern IconPack iconPack;
+
+#endif // ICON_PACK_H
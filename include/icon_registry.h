@@ -0,0 +1,142 @@
+#ifndef ICON_REGISTRY_H
+#define ICON_REGISTRY_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Icons a button or scene can name in its config. The name is resolved
+// once when the config is parsed (findIcon()) and kept as an IconId next to
+// it, so building the UI never compares icon strings; UIManager maps the id
+// to its LVGL symbol and image.
+enum class IconId : uint8_t {
+    CHARGE = 0,         // Also what unknown names fall back to
+    LIGHT,
+    BULB,
+    CEILING_LIGHT,
+    MOON,
+    SUN,
+    FAN,
+    POWER,
+    OK,
+    HOME,
+    SETTINGS,
+    WIFI,
+    BELL,
+    EYE,
+    EYE_CLOSE,
+    SLEEP,
+    PLAY,
+    PAUSE,
+    STOP,
+    VOLUME,
+    MUTE,
+    MINUS,
+    PLUS,
+    CLOSE,
+    REFRESH,
+    EDIT,
+    TRASH,
+    TINT,
+    TIMER,
+    GARAGE,
+    DOOR,
+    COUNT
+};
+
+// Ids from here up are icons of the uploaded icon pack (icon_pack.h), not
+// values of the enum
+static const uint8_t ICON_PACK_FIRST = 0x80;
+
+struct IconName {
+    const char* name;
+    IconId id;
+};
+
+namespace icon_registry {
+
+// Every accepted name, sorted by strcmp() order for findIcon()'s binary search
+constexpr IconName NAMES[] = {
+    {"audio", IconId::VOLUME},
+    {"bell", IconId::BELL},
+    {"bolt", IconId::CHARGE},
+    {"bulb", IconId::BULB},
+    {"ceiling-light", IconId::CEILING_LIGHT},
+    {"ceiling_light", IconId::CEILING_LIGHT},
+    {"charge", IconId::CHARGE},
+    {"check", IconId::OK},
+    {"clock", IconId::TIMER},
+    {"close", IconId::CLOSE},
+    {"delete", IconId::TRASH},
+    {"door", IconId::DOOR},
+    {"drop", IconId::TINT},
+    {"edit", IconId::EDIT},
+    {"eye", IconId::EYE},
+    {"eye_close", IconId::EYE_CLOSE},
+    {"fan", IconId::FAN},
+    {"garage", IconId::GARAGE},
+    {"gear", IconId::SETTINGS},
+    {"home", IconId::HOME},
+    {"light", IconId::LIGHT},
+    {"minus", IconId::MINUS},
+    {"moon", IconId::MOON},
+    {"mute", IconId::MUTE},
+    {"notification", IconId::BELL},
+    {"off", IconId::POWER},
+    {"ok", IconId::OK},
+    {"on", IconId::OK},
+    {"pause", IconId::PAUSE},
+    {"pen", IconId::EDIT},
+    {"play", IconId::PLAY},
+    {"plus", IconId::PLUS},
+    {"power", IconId::POWER},
+    {"refresh", IconId::REFRESH},
+    {"schedule", IconId::TIMER},
+    {"settings", IconId::SETTINGS},
+    {"sleep", IconId::SLEEP},
+    {"stop", IconId::STOP},
+    {"sun", IconId::SUN},
+    {"sync", IconId::REFRESH},
+    {"timer", IconId::TIMER},
+    {"tint", IconId::TINT},
+    {"trash", IconId::TRASH},
+    {"ventilation", IconId::FAN},
+    {"volume", IconId::VOLUME},
+    {"water", IconId::TINT},
+    {"wifi", IconId::WIFI},
+    {"x", IconId::CLOSE},
+};
+
+constexpr size_t NAME_COUNT = sizeof(NAMES) / sizeof(NAMES[0]);
+
+// strcmp() for the compile-time check below
+constexpr int compare(const char* a, const char* b) {
+    return (*a != *b || *a == '\0') ? (int)(unsigned char)*a - (int)(unsigned char)*b
+                                    : compare(a + 1, b + 1);
+}
+
+constexpr bool sortedFrom(size_t i) {
+    return i + 1 >= NAME_COUNT || (compare(NAMES[i].name, NAMES[i + 1].name) < 0 && sortedFrom(i + 1));
+}
+
+static_assert(sortedFrom(0), "icon_registry::NAMES must be sorted and free of duplicates");
+
+} // namespace icon_registry
+
+// The icon a config name refers to, IconId::CHARGE for names it doesn't know
+inline IconId findIcon(const char* name) {
+    size_t lo = 0;
+    size_t hi = icon_registry::NAME_COUNT;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        int c = strcmp(name, icon_registry::NAMES[mid].name);
+        if (c == 0) return icon_registry::NAMES[mid].id;
+        if (c < 0) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return IconId::CHARGE;
+}
+
+#endif // ICON_REGISTRY_H
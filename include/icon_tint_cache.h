@@ -0,0 +1,68 @@
+#ifndef ICON_TINT_CACHE_H
+#define ICON_TINT_CACHE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+class Print;
+
+// Pre-tinted copies of the A8 icons, one per (icon, color).
+//
+// An A8 image drawn with img_recolor is decoded a line at a time and
+// recolored pixel by pixel on every draw, for every card, on every full
+// refresh. The copies here are TRUE_COLOR_ALPHA (RGB565 and alpha, in PSRAM),
+// which LVGL blends straight from memory. Cyberpunk's neon grid needs only a
+// handful of them: one per icon and state color.
+//
+// Image objects using a copy hold a reference to it (UIManager::
+// setIconImage() takes and releases them, and drops it when the object is
+// deleted). Unreferenced copies are kept for the next state flip and freed
+// when the theme changes or room is needed. When the cache is full, or the
+// PSRAM budget refuses a copy, acquire() returns nullptr and the caller
+// falls back to recoloring. LVGL task only.
+class IconTintCache {
+public:
+    IconTintCache();
+
+    // The copy of A8 image base in color, with one more reference; nullptr
+    // if base isn't A8 or there is no room for it
+    const lv_img_dsc_t* acquire(const lv_img_dsc_t* base, lv_color_t color);
+
+    // One reference fewer to a copy from acquire(); other sources are ignored
+    void release(const void* src);
+
+    // The image a copy was made from, src itself if it isn't a copy
+    const void* baseOf(const void* src) const;
+
+    // Free every copy nothing refers to (theme change)
+    void trim();
+
+    // Copies, bytes held and how often a draw source was found or made
+    void writeJson(Print& out) const;
+
+    static const uint8_t MAX_ENTRIES = 32;
+    static const size_t MAX_BYTES = 256 * 1024;
+
+private:
+    struct Entry {
+        lv_img_dsc_t dsc;           // What image objects point at; data is nullptr when free
+        const lv_img_dsc_t* base;
+        uint16_t color;             // lv_color_t.full
+        uint16_t refs;
+    };
+
+    Entry* find(const void* src);
+    const Entry* find(const void* src) const;
+    void drop(Entry& entry);
+
+    Entry entries[MAX_ENTRIES];
+    size_t bytes;
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t refused;
+};
+
+// Global instance
+extern IconTintCache iconTintCache;
+
+#endif // ICON_TINT_CACHE_H
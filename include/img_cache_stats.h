@@ -0,0 +1,91 @@
+#ifndef IMG_CACHE_STATS_H
+#define IMG_CACHE_STATS_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+class Print;
+
+// Sizes LVGL's image cache and counts how well it does, per image source,
+// served at /api/diag/img_cache.
+//
+// Every image draw goes through the cache: a hit reuses the decoder
+// descriptor it holds, a miss opens the image again. The built-in decoder
+// is re-registered ahead of the original with a counting open, so decoder
+// opens are exactly the misses. Draws are counted where they end up: an
+// image held in memory (icons as TRUE_COLOR_ALPHA copies, packed images,
+// card tiles) is blitted once per draw from the display's draw context; an
+// image decoded a line at a time (A8 icons drawn with recolor) counts at
+// its first line, and every line it decodes is counted too, since that is
+// the cost the cache can't save.
+//
+// The cache's slots come from LVGL's allocator, which puts anything over
+// LVGL_MEM_SMALL_MAX in its PSRAM arena (so a few dozen slots don't touch
+// the internal SRAM budget). PANEL_IMG_CACHE_SIZE (build flag, see
+// lv_conf.h) is the size at boot; setCacheSize() changes it until the next
+// restart, to try sizes against the hit rate. LVGL task (or the LVGL lock)
+// for everything but writeJson().
+
+class ImageCacheStats {
+public:
+    ImageCacheStats();
+
+    // Setup, once the display is registered and before the LVGL task runs
+    void begin(lv_disp_t* disp);
+
+    // Resize LVGL's cache (entries are dropped and reopened on demand)
+    bool setCacheSize(uint16_t entries);
+    uint16_t getCacheSize() const { return cacheSize; }
+
+    uint32_t getDraws() const { return draws; }
+    uint32_t getOpens() const { return opens; }
+
+    // Forget the counters (the cache itself is kept)
+    void reset();
+
+    // Totals, hit rate and the busiest sources
+    void writeJson(Print& out) const;
+
+    static const uint16_t MAX_CACHE_SIZE = 64;
+    static const uint8_t MAX_SOURCES = 32;
+
+private:
+    struct Source {
+        const void* src;            // What the image was set to (lv_img_dsc_t*)
+        const void* data;           // Pixels a blit reads, nullptr if decoded by line
+        uint16_t width;
+        uint16_t height;
+        uint8_t cf;
+        int16_t lastLine;           // Last line decoded, -1 if none
+        uint32_t opens;
+        uint32_t draws;
+        uint32_t lines;
+        uint32_t lastUse;           // draws when last touched, for reuse
+    };
+
+    Source* find(const void* src);
+    Source* findData(const void* data);
+    Source* add(const void* src);    // Reusing the least recently drawn slot
+
+    static lv_res_t decoderOpen(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+    static lv_res_t decoderReadLine(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+                                    lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf);
+    static void drawImgDecoded(lv_draw_ctx_t* ctx, const lv_draw_img_dsc_t* dsc,
+                               const lv_area_t* coords, const uint8_t* map, lv_img_cf_t cf);
+
+    typedef void (*DrawImgDecodedFn)(lv_draw_ctx_t* ctx, const lv_draw_img_dsc_t* dsc,
+                                     const lv_area_t* coords, const uint8_t* map, lv_img_cf_t cf);
+    DrawImgDecodedFn drawNext;       // The context's own blit
+
+    Source sources[MAX_SOURCES];
+    uint16_t cacheSize;
+    uint32_t draws;
+    uint32_t opens;
+    uint32_t lines;
+    uint32_t untracked;              // Blits of buffers no source owns (canvas, snapshots)
+};
+
+// Global instance
+extern ImageCacheStats imageCacheStats;
+
+#endif // IMG_CACHE_STATS_H
@@ -0,0 +1,333 @@
+// Generated by scripts/embed_index.py from web/index.html - do not edit
+#ifndef INDEX_HTML_GZ_H
+#define INDEX_HTML_GZ_H
+
+#include <Arduino.h>
+
+#define INDEX_HTML_ETAG "\"3eb5cefad7436b49\""
+#define INDEX_HTML_GZ_LEN 5108
+
+const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3c, 0xdb, 0x72, 0xdb, 0xc6,
+    0x92, 0xef, 0xfe, 0x8a, 0x31, 0x8f, 0x63, 0x80, 0x11, 0xef, 0xba, 0x44, 0xa1, 0x48, 0xa5, 0x7c,
+    0x89, 0x4f, 0xbc, 0x1b, 0xc7, 0x2a, 0xcb, 0xda, 0xd4, 0xd6, 0x9e, 0x2d, 0x69, 0x48, 0x0c, 0x44,
+    0x44, 0x20, 0x80, 0x60, 0x40, 0x51, 0x8c, 0xc2, 0x6f, 0x38, 0x55, 0xa7, 0xb6, 0x6a, 0x1f, 0xf7,
+    0xdf, 0xf6, 0x0b, 0xf6, 0x13, 0xb6, 0x7b, 0x66, 0x70, 0x1f, 0x40, 0x14, 0x45, 0xaf, 0x57, 0x0f,
+    0x36, 0x09, 0xcc, 0xf4, 0x74, 0xf7, 0xf4, 0x7d, 0x7a, 0x38, 0x7a, 0xfe, 0xf6, 0xe3, 0x9b, 0xcf,
+    0xff, 0x7a, 0xf6, 0x23, 0x99, 0x45, 0x73, 0xf7, 0xf4, 0xd9, 0x28, 0xfe, 0x8f, 0x51, 0xeb, 0xf4,
+    0x19, 0x81, 0xbf, 0xd1, 0x9c, 0x45, 0x94, 0x4c, 0x67, 0x34, 0xe4, 0x2c, 0x1a, 0x37, 0x2e, 0x3e,
+    0xbf, 0x6b, 0x1f, 0x37, 0xb2, 0xaf, 0x3c, 0x3a, 0x67, 0xe3, 0xc6, 0xad, 0xc3, 0x96, 0x81, 0x1f,
+    0x46, 0x0d, 0x32, 0xf5, 0xbd, 0x88, 0x79, 0x30, 0x74, 0xe9, 0x58, 0xd1, 0x6c, 0x6c, 0xb1, 0x5b,
+    0x67, 0xca, 0xda, 0xe2, 0x4b, 0x8b, 0x38, 0x9e, 0x13, 0x39, 0xd4, 0x6d, 0xf3, 0x29, 0x75, 0xd9,
+    0xb8, 0xdf, 0xe9, 0xc5, 0xa0, 0x22, 0x27, 0x72, 0xd9, 0xe9, 0x8f, 0xe7, 0x67, 0xfb, 0x03, 0xf2,
+    0xd6, 0xe1, 0x81, 0x4b, 0x57, 0xe4, 0x0d, 0x40, 0x0a, 0x7d, 0xd7, 0x65, 0xe1, 0xa8, 0x2b, 0xdf,
+    0xcb, 0xb1, 0x3c, 0x5a, 0xc5, 0x9f, 0xf1, 0xef, 0x5b, 0x72, 0x4f, 0xe6, 0x34, 0xbc, 0x76, 0xbc,
+    0x21, 0xe9, 0x9d, 0x90, 0x80, 0x5a, 0x96, 0xe3, 0x5d, 0x8b, 0xcf, 0x13, 0xff, 0xae, 0xcd, 0x9d,
+    0x3f, 0xc4, 0xd7, 0x89, 0x1f, 0x5a, 0x2c, 0x6c, 0xc3, 0xa3, 0x13, 0xb2, 0x4e, 0x26, 0x4f, 0x7c,
+    0x6b, 0x45, 0xee, 0x93, 0xaf, 0xf8, 0x67, 0xc3, 0xb2, 0x6d, 0x9b, 0xce, 0x1d, 0x77, 0x35, 0x24,
+    0x6d, 0x1a, 0x04, 0x2e, 0x6b, 0xf3, 0x15, 0x8f, 0xd8, 0xbc, 0x45, 0x5e, 0xbb, 0x8e, 0x77, 0xf3,
+    0x81, 0x4e, 0xcf, 0xc5, 0xf7, 0x77, 0x30, 0xb2, 0x45, 0x8c, 0x73, 0x76, 0xed, 0x33, 0x72, 0xf1,
+    0xde, 0x68, 0x91, 0x4f, 0xfe, 0xc4, 0x8f, 0xfc, 0x16, 0xe1, 0xd4, 0xe3, 0x6d, 0xce, 0x42, 0xc7,
+    0x3e, 0xc9, 0xc1, 0x9e, 0xd0, 0xe9, 0xcd, 0x75, 0xe8, 0x2f, 0x3c, 0x6b, 0x48, 0xfe, 0xd2, 0xa7,
+    0x7d, 0x3a, 0x60, 0xf9, 0x01, 0x53, 0xdf, 0xf5, 0x43, 0x78, 0xc7, 0x58, 0xe1, 0xc5, 0xdc, 0xf1,
+    0xda, 0x33, 0xe6, 0x5c, 0xcf, 0xa2, 0x21, 0xe9, 0xf7, 0x7a, 0xb7, 0xb3, 0xfc, 0xeb, 0x84, 0xea,
+    0x41, 0x2f, 0xb8, 0x4b, 0x5f, 0xa5, 0x84, 0x76, 0x70, 0x5f, 0xa8, 0xe3, 0xb1, 0x50, 0xb0, 0xeb,
+    0x4e, 0xee, 0xc8, 0x90, 0x1c, 0xf7, 0x70, 0x42, 0xca, 0x40, 0x42, 0x17, 0x91, 0x9f, 0xe5, 0xd0,
+    0xac, 0x0f, 0x13, 0x62, 0xb4, 0x7a, 0x3d, 0xeb, 0xc0, 0xb6, 0xe3, 0xe1, 0xc0, 0xcc, 0x28, 0xf2,
+    0xe7, 0x6a, 0xd1, 0xdc, 0x62, 0x34, 0xb4, 0x0a, 0x6c, 0xcd, 0x93, 0x7e, 0x34, 0xe8, 0xef, 0x17,
+    0x28, 0x54, 0x1b, 0x14, 0x52, 0xcb, 0x59, 0x70, 0x20, 0x72, 0x90, 0x25, 0xa4, 0x86, 0x46, 0xc1,
+    0x1d, 0x0d, 0x3e, 0x1a, 0xe0, 0x00, 0x35, 0xb8, 0x23, 0xdc, 0x77, 0x1d, 0x0b, 0x68, 0xb1, 0xf7,
+    0x0f, 0x8e, 0x7a, 0x7a, 0x5e, 0x21, 0xfa, 0xb3, 0xc1, 0xc3, 0x84, 0xf7, 0x0f, 0x91, 0x70, 0x21,
+    0x31, 0x20, 0x67, 0x0c, 0x1e, 0x74, 0x06, 0x6c, 0x9e, 0x63, 0x85, 0xe3, 0xd9, 0x7e, 0xfb, 0x3a,
+    0x84, 0x15, 0xef, 0x89, 0x25, 0x25, 0x7b, 0x48, 0xf0, 0xfb, 0x89, 0xf8, 0xb7, 0x0d, 0x72, 0x04,
+    0xcf, 0x22, 0xd6, 0x86, 0xa5, 0x16, 0x73, 0x0f, 0x28, 0x0f, 0x59, 0xc0, 0x68, 0x64, 0xe2, 0x46,
+    0xb4, 0x6d, 0x07, 0x24, 0x0c, 0xf6, 0x1e, 0x76, 0xcc, 0xec, 0x1f, 0x03, 0x59, 0x2d, 0xd2, 0xb7,
+    0xc3, 0x66, 0x13, 0x26, 0xd3, 0x20, 0x5e, 0xbf, 0xb8, 0x9a, 0x03, 0x30, 0x61, 0xb5, 0x1c, 0xc7,
+    0x15, 0xb5, 0x29, 0x13, 0x05, 0x7f, 0x8b, 0x4c, 0x3f, 0xd6, 0x81, 0x73, 0xe9, 0x84, 0xb9, 0x19,
+    0x5e, 0x1c, 0x1f, 0x1f, 0xe7, 0x68, 0xee, 0x75, 0x8e, 0x0f, 0x91, 0xe8, 0x02, 0x6f, 0x0e, 0x74,
+    0xb0, 0x6e, 0xa9, 0xbb, 0x60, 0x00, 0x2b, 0xc7, 0xb2, 0x3e, 0xce, 0x16, 0x4f, 0x96, 0x4a, 0xc2,
+    0x0f, 0x7b, 0xbd, 0xdc, 0xdc, 0x49, 0xe4, 0xd5, 0x89, 0x93, 0xda, 0x1d, 0xad, 0x26, 0xe9, 0xb4,
+    0x2c, 0x96, 0x06, 0xcf, 0xf7, 0x58, 0x85, 0x8c, 0x21, 0x7b, 0xc8, 0xe0, 0x40, 0x2f, 0x47, 0x39,
+    0x7e, 0x95, 0x8d, 0x87, 0xa2, 0x0b, 0xa8, 0xca, 0x63, 0xb4, 0x08, 0x39, 0xa2, 0x14, 0xf8, 0x0e,
+    0x98, 0xc8, 0x50, 0x2b, 0xc1, 0x61, 0xac, 0xe1, 0x0f, 0x48, 0x78, 0x79, 0x40, 0x14, 0x82, 0xcd,
+    0x01, 0xeb, 0xea, 0x83, 0x16, 0xa7, 0xcc, 0x81, 0xcd, 0x19, 0x70, 0xad, 0x8c, 0x03, 0x4b, 0x87,
+    0x33, 0xff, 0x56, 0xd8, 0x83, 0x02, 0x33, 0x27, 0xc7, 0xec, 0xa8, 0xc8, 0x7e, 0xb0, 0x66, 0x60,
+    0x41, 0x2c, 0x1a, 0xae, 0xaa, 0x24, 0x2b, 0x6b, 0xba, 0x2a, 0x27, 0xeb, 0x97, 0xec, 0xd3, 0x03,
+    0xfa, 0x1d, 0x2d, 0xcd, 0xb2, 0xa8, 0x77, 0x5d, 0x1e, 0xcc, 0xbe, 0x3f, 0x38, 0x3c, 0xea, 0x55,
+    0x0c, 0xd6, 0xc3, 0xb7, 0xfa, 0xfb, 0x87, 0x87, 0xf9, 0x29, 0x7c, 0x1a, 0x32, 0xe6, 0xf1, 0x99,
+    0x1f, 0xb5, 0xb3, 0x96, 0x31, 0x62, 0x77, 0x51, 0x9b, 0xba, 0xce, 0x35, 0x70, 0x71, 0xca, 0xc4,
+    0x36, 0xc5, 0xac, 0x8f, 0x7c, 0x9d, 0xc2, 0x69, 0xe1, 0x38, 0xf3, 0xeb, 0x82, 0xb8, 0x66, 0x2c,
+    0x2e, 0x58, 0xef, 0x6f, 0x1e, 0x27, 0x54, 0xb1, 0xb8, 0x0e, 0x36, 0x32, 0x5e, 0x3c, 0xa2, 0xd1,
+    0x82, 0x03, 0x2d, 0x89, 0x2c, 0x03, 0x40, 0xd2, 0x3f, 0xd2, 0xa8, 0xbb, 0x50, 0xd1, 0xc4, 0x28,
+    0x39, 0x1e, 0x78, 0x37, 0xd6, 0x9e, 0xb8, 0xfe, 0xf4, 0xa6, 0x40, 0x75, 0xd1, 0xbe, 0xcb, 0x35,
+    0xda, 0x7c, 0x31, 0x9d, 0x32, 0xce, 0xcb, 0x12, 0x71, 0xd8, 0xdf, 0x1f, 0xa4, 0x12, 0xf1, 0xdd,
+    0xe1, 0xe4, 0xbb, 0xef, 0x8f, 0x75, 0x00, 0x58, 0x18, 0xfa, 0xa5, 0xdd, 0x3a, 0x9c, 0xa2, 0xce,
+    0x66, 0x04, 0x8a, 0x1e, 0x1f, 0x1d, 0xdb, 0xd9, 0xe9, 0x7f, 0xc9, 0x70, 0x3d, 0x21, 0x57, 0x6b,
+    0x9a, 0x33, 0x4b, 0xda, 0x7e, 0x38, 0x6f, 0xe3, 0x22, 0xc1, 0xe3, 0x06, 0xc7, 0xe6, 0x2f, 0xe1,
+    0x93, 0x62, 0x50, 0xce, 0x1c, 0x16, 0xe0, 0xd5, 0x80, 0x73, 0xbc, 0x60, 0x01, 0x36, 0x3d, 0xfb,
+    0x88, 0x33, 0x97, 0x4d, 0xa3, 0x82, 0xc4, 0x54, 0x4a, 0x4b, 0x6a, 0xa2, 0xb6, 0xf1, 0x72, 0x1a,
+    0x79, 0x3b, 0x2a, 0x81, 0xd1, 0xa8, 0xf7, 0x66, 0x51, 0x4a, 0x95, 0xf9, 0xab, 0x61, 0xc5, 0xd0,
+    0xf6, 0xa7, 0x0b, 0xae, 0x63, 0x88, 0x7c, 0x53, 0x60, 0x8b, 0xbf, 0x88, 0x50, 0x4a, 0x75, 0xb6,
+    0x5b, 0x91, 0x55, 0x70, 0xd9, 0x3a, 0x1c, 0x3c, 0x16, 0x2d, 0xfd, 0xf0, 0xa6, 0xed, 0x3a, 0x3c,
+    0x52, 0xe1, 0x50, 0x1c, 0x5b, 0x0d, 0x64, 0x3c, 0x84, 0x56, 0xc4, 0x76, 0xfd, 0x65, 0x1b, 0xf6,
+    0x5b, 0x46, 0x44, 0x0f, 0x49, 0x4c, 0x0c, 0x53, 0x3a, 0xdf, 0x8d, 0x77, 0xec, 0x21, 0x56, 0x3f,
+    0xb4, 0x57, 0x05, 0xb4, 0x4a, 0xb6, 0xa3, 0xd6, 0xe9, 0x24, 0x22, 0x6d, 0xbb, 0xac, 0x30, 0xef,
+    0xb7, 0x05, 0x8f, 0x1c, 0x7b, 0xd5, 0x56, 0xe1, 0xfc, 0x90, 0xf0, 0x80, 0x42, 0x1c, 0x3f, 0x01,
+    0x2a, 0x41, 0xf3, 0xf2, 0x63, 0x85, 0xbd, 0x14, 0x84, 0xf3, 0xc4, 0x6a, 0xd6, 0xb1, 0x1d, 0x47,
+    0x6e, 0xec, 0x08, 0x38, 0xc0, 0xa6, 0x6e, 0x3e, 0x64, 0xe8, 0x75, 0xbe, 0xc7, 0x90, 0x21, 0xa7,
+    0x81, 0x72, 0xca, 0xa8, 0xab, 0xb2, 0x83, 0x51, 0x57, 0xe6, 0x30, 0x23, 0x8c, 0xf0, 0x55, 0xe2,
+    0x60, 0x39, 0xb7, 0x64, 0xea, 0x52, 0xce, 0xc7, 0x8d, 0xc4, 0x56, 0x37, 0xd2, 0x44, 0x62, 0x34,
+    0xeb, 0xd7, 0x64, 0x20, 0xf0, 0xf2, 0x59, 0x3a, 0x34, 0x0b, 0x0a, 0x82, 0xc5, 0x0c, 0x14, 0x09,
+    0x69, 0x70, 0xfa, 0x56, 0x24, 0x3e, 0xe4, 0xbd, 0x87, 0x72, 0x4d, 0xd1, 0x2f, 0x03, 0x8c, 0x41,
+    0x61, 0x5c, 0x06, 0x4c, 0x12, 0x27, 0x36, 0x88, 0x63, 0x8d, 0x1b, 0x2a, 0x6f, 0xc2, 0xa7, 0x05,
+    0xe0, 0xda, 0x89, 0xc8, 0x52, 0xcd, 0x38, 0xed, 0x58, 0x61, 0xd0, 0x1a, 0xa7, 0x3f, 0xfb, 0x14,
+    0xa5, 0xb2, 0xd3, 0xe9, 0x8c, 0xba, 0x30, 0x44, 0xb3, 0x48, 0xf9, 0x71, 0xe1, 0x91, 0xfa, 0xfa,
+    0x18, 0xb6, 0x9c, 0xb3, 0x10, 0xf7, 0x1d, 0x38, 0x6b, 0x3b, 0xd7, 0x8b, 0x70, 0x03, 0xc6, 0xa4,
+    0x76, 0x41, 0xc7, 0x08, 0x41, 0xcc, 0xe9, 0x27, 0x86, 0xc9, 0x27, 0x50, 0x43, 0x2e, 0x3e, 0xfd,
+    0x3c, 0xea, 0xca, 0x87, 0x7a, 0xae, 0x09, 0xf9, 0x00, 0xfe, 0xe6, 0x44, 0x5f, 0x46, 0xd3, 0xa8,
+    0x3c, 0x55, 0x4c, 0x14, 0xb6, 0x8a, 0x44, 0xab, 0x00, 0xe6, 0x62, 0x90, 0x20, 0x77, 0x29, 0x8c,
+    0xd7, 0x6d, 0x2f, 0x42, 0xb7, 0x2d, 0xc6, 0x34, 0x08, 0xc0, 0x9d, 0xb2, 0x99, 0xef, 0x82, 0xde,
+    0x8e, 0x1b, 0xb3, 0x28, 0x0a, 0x86, 0xdd, 0x2e, 0x17, 0x64, 0x0f, 0x45, 0x8a, 0x5c, 0xb1, 0xc2,
+    0x64, 0x01, 0x2a, 0xec, 0xc5, 0x54, 0x43, 0x48, 0xd3, 0x20, 0xbe, 0x37, 0x75, 0x9d, 0xe9, 0xcd,
+    0xb8, 0xc1, 0xe9, 0x2d, 0x4b, 0x68, 0xbc, 0x08, 0x5d, 0xb3, 0xd9, 0x88, 0x09, 0xc9, 0xa4, 0xbe,
+    0xcb, 0x19, 0x88, 0x41, 0x5b, 0x28, 0x2a, 0xda, 0xc7, 0x65, 0x48, 0x03, 0xa0, 0xe7, 0x22, 0xb0,
+    0x20, 0xbd, 0x18, 0x75, 0x25, 0xfc, 0x6d, 0xb6, 0x39, 0xe1, 0x5d, 0x99, 0x64, 0xe9, 0x7d, 0x1b,
+    0xa7, 0x3b, 0x10, 0x8c, 0xc4, 0xa5, 0x57, 0x88, 0x03, 0x2e, 0x5e, 0xf2, 0xfb, 0xa5, 0x95, 0x1f,
+    0x64, 0xe5, 0x94, 0x06, 0xd1, 0x22, 0x64, 0xe9, 0x72, 0xc0, 0xcb, 0xd3, 0x37, 0xf2, 0x21, 0xc9,
+    0x22, 0xa1, 0xe3, 0x57, 0x19, 0x32, 0xc9, 0x85, 0xb7, 0x99, 0x75, 0xb0, 0x22, 0x92, 0x5f, 0xe4,
+    0x5f, 0xe0, 0xc9, 0x93, 0xc1, 0x5a, 0xfe, 0xd2, 0x73, 0x41, 0x73, 0xf3, 0xa0, 0xdf, 0xaa, 0xa7,
+    0x15, 0xe0, 0x33, 0xdc, 0xd7, 0xc5, 0xab, 0x8d, 0x22, 0x6f, 0x33, 0xd6, 0xf1, 0xe9, 0x1b, 0xfb,
+    0xb3, 0x73, 0xcb, 0x88, 0xa4, 0xbd, 0x72, 0x5f, 0x5d, 0x18, 0xf3, 0xd8, 0x1d, 0x4d, 0xe6, 0x45,
+    0xfe, 0xf5, 0xb5, 0xcb, 0x32, 0x3c, 0x92, 0x0f, 0x70, 0x5d, 0x5c, 0x16, 0xf9, 0x73, 0x1e, 0xd1,
+    0x30, 0xda, 0x92, 0x39, 0xa7, 0xa3, 0x29, 0xf5, 0x6e, 0x29, 0x4f, 0x17, 0x94, 0xdf, 0x1b, 0x32,
+    0x44, 0x1b, 0x37, 0x0e, 0x8e, 0x7b, 0x0d, 0x22, 0xe3, 0x07, 0xf5, 0xa5, 0x60, 0x63, 0x30, 0x54,
+    0x41, 0xb2, 0xe4, 0xbc, 0x1d, 0xb0, 0xf4, 0x57, 0xe7, 0x9d, 0xb3, 0x91, 0x09, 0x45, 0x94, 0x97,
+    0x8e, 0xed, 0xc4, 0xbc, 0xcd, 0x1b, 0x8d, 0x7c, 0x30, 0xb3, 0x21, 0xe3, 0x2b, 0x25, 0x93, 0x03,
+    0x79, 0xbf, 0x48, 0x0f, 0xcf, 0x05, 0xcf, 0xe1, 0x3b, 0x89, 0x1f, 0xd4, 0xf0, 0x1e, 0x71, 0xcc,
+    0x06, 0x64, 0x8d, 0x78, 0xb1, 0xfc, 0x43, 0x0d, 0x4f, 0x2b, 0x50, 0x7e, 0xa4, 0xef, 0x38, 0x3f,
+    0x7f, 0xff, 0xb6, 0xda, 0x65, 0xe8, 0xed, 0xbe, 0xe4, 0x29, 0x47, 0x67, 0x9d, 0xb3, 0xf6, 0x8a,
+    0x5c, 0x51, 0x14, 0x6d, 0x6c, 0x66, 0x53, 0x1f, 0x81, 0xe9, 0x19, 0x8c, 0x04, 0xf0, 0xd6, 0x66,
+    0xd8, 0x06, 0x6a, 0x74, 0x06, 0xe3, 0xf4, 0x51, 0x0e, 0xeb, 0x18, 0x2e, 0x31, 0x5d, 0x06, 0x8e,
+    0x86, 0xb0, 0x79, 0x10, 0xad, 0x20, 0xde, 0x0a, 0x89, 0x1f, 0x30, 0x8f, 0xa8, 0x7d, 0xe0, 0xcd,
+    0x0d, 0x28, 0xaa, 0xb5, 0xbc, 0xbe, 0xe7, 0x41, 0x58, 0xff, 0x2b, 0x60, 0x22, 0xe4, 0x03, 0x97,
+    0x7a, 0x89, 0x62, 0x8c, 0x4f, 0xcb, 0x02, 0xb2, 0x85, 0x5e, 0xbc, 0x73, 0xc2, 0xf9, 0x92, 0x82,
+    0x1d, 0x8f, 0x7d, 0x5e, 0x49, 0x29, 0x82, 0x3a, 0x0d, 0xc8, 0x05, 0x94, 0x9a, 0x6d, 0xb8, 0x08,
+    0xd0, 0xc6, 0x02, 0x3f, 0x96, 0xc4, 0x8e, 0x57, 0xba, 0x75, 0x28, 0x89, 0x66, 0x8c, 0x7c, 0xfc,
+    0xfc, 0x8a, 0x2c, 0xc4, 0xaa, 0x44, 0x04, 0xda, 0x36, 0xf0, 0xb7, 0x53, 0x60, 0x57, 0x50, 0x40,
+    0x86, 0x92, 0x59, 0xc8, 0xec, 0x71, 0xa3, 0x2b, 0x27, 0x36, 0xb2, 0x6c, 0x3b, 0xfd, 0x88, 0xac,
+    0x47, 0xa8, 0x31, 0x2d, 0xf4, 0x69, 0xee, 0x55, 0x54, 0xac, 0x35, 0x1c, 0xd1, 0x2b, 0xb8, 0xac,
+    0xa6, 0x64, 0x36, 0x2f, 0x64, 0x1c, 0x6d, 0xa8, 0x8c, 0x6a, 0x71, 0xfb, 0x3e, 0xc9, 0x07, 0x44,
+    0x3e, 0xa9, 0xdc, 0xbe, 0x22, 0xba, 0x23, 0xb0, 0xb1, 0x4e, 0x10, 0xa5, 0xe3, 0x28, 0x5f, 0x79,
+    0x53, 0x62, 0x2f, 0xbc, 0x29, 0xda, 0x31, 0x82, 0x1c, 0x96, 0x20, 0x31, 0x72, 0x36, 0x9b, 0x85,
+    0x54, 0x2a, 0x0a, 0x8b, 0xe5, 0x7a, 0x99, 0x8f, 0x7a, 0x90, 0xc8, 0x01, 0x8a, 0x01, 0x7c, 0x60,
+    0x64, 0x4c, 0xe8, 0x92, 0x3a, 0x11, 0xb1, 0x59, 0x34, 0x9d, 0x99, 0x46, 0x97, 0x06, 0x4e, 0x17,
+    0x23, 0x5f, 0xa3, 0x79, 0x52, 0x31, 0x15, 0x38, 0x4c, 0x93, 0x69, 0x31, 0x9c, 0xce, 0x6f, 0xdc,
+    0xf7, 0x4c, 0x98, 0x53, 0x31, 0x49, 0x14, 0x75, 0xc7, 0xc4, 0x82, 0x2c, 0x75, 0x0e, 0x49, 0x4f,
+    0xe7, 0x9a, 0x45, 0x3f, 0xba, 0x0c, 0x3f, 0xbe, 0x5e, 0xbd, 0xb7, 0x4c, 0x23, 0x13, 0xc2, 0xeb,
+    0x56, 0x76, 0x59, 0x44, 0xf8, 0x74, 0xc6, 0xac, 0x85, 0xcb, 0x7e, 0x8a, 0xe6, 0x2e, 0x80, 0x32,
+    0x8c, 0xf2, 0x30, 0xc7, 0x26, 0x26, 0xa2, 0xd7, 0x89, 0xc7, 0x5e, 0x32, 0x8f, 0x4e, 0x5c, 0x66,
+    0x35, 0x35, 0x8c, 0x48, 0x91, 0x0b, 0x58, 0xe8, 0xf8, 0x16, 0xf2, 0x10, 0x51, 0xc4, 0xf9, 0x90,
+    0x09, 0x86, 0x80, 0xdb, 0xa5, 0x7c, 0x43, 0x7e, 0xd0, 0x4e, 0xc6, 0xbf, 0xab, 0x11, 0x84, 0x90,
+    0x5e, 0xac, 0x28, 0xb1, 0x4e, 0x1c, 0xd0, 0x03, 0xd0, 0x89, 0xff, 0xfe, 0xcf, 0xbf, 0x93, 0x17,
+    0xf7, 0x1a, 0x78, 0x6b, 0xc8, 0xbc, 0x60, 0xd6, 0x29, 0x31, 0xd5, 0xeb, 0x18, 0x5d, 0xeb, 0x72,
+    0x22, 0x8a, 0x9a, 0x1e, 0xe3, 0x7c, 0xfd, 0x4d, 0xf3, 0x8a, 0x0c, 0x2b, 0x17, 0x36, 0x7e, 0xf1,
+    0x09, 0x05, 0x31, 0x00, 0xbb, 0x20, 0x81, 0x6a, 0xd8, 0x81, 0x7f, 0x05, 0xae, 0x5d, 0x6d, 0x96,
+    0xf6, 0xd4, 0xa4, 0x48, 0x75, 0x69, 0x92, 0xca, 0xe3, 0x3e, 0x3b, 0x73, 0x56, 0x91, 0x27, 0x55,
+    0x42, 0x10, 0xc5, 0xee, 0xc6, 0xa9, 0x62, 0x48, 0x04, 0x10, 0x2e, 0x51, 0xd8, 0x19, 0x30, 0x3f,
+    0xbf, 0x25, 0xf8, 0x8a, 0x0c, 0x89, 0xa1, 0x65, 0xbc, 0xdd, 0xa3, 0xd6, 0x01, 0xfa, 0xba, 0x73,
+    0x98, 0x1b, 0x27, 0x6c, 0x82, 0xd7, 0xc6, 0xba, 0x06, 0xa3, 0xba, 0x57, 0x3b, 0x62, 0xcd, 0xb9,
+    0xda, 0x07, 0x72, 0x26, 0x76, 0x6b, 0x6b, 0xf6, 0xa4, 0xb2, 0xfa, 0x30, 0x41, 0x57, 0x65, 0x91,
+    0x58, 0x97, 0x9e, 0xa0, 0x66, 0x76, 0x1c, 0xf0, 0x2b, 0xe1, 0x4f, 0x9f, 0x3f, 0xfc, 0xfc, 0xc5,
+    0x45, 0xe4, 0xcd, 0xcc, 0x09, 0x9e, 0x26, 0x1b, 0x53, 0x80, 0x70, 0x39, 0xf7, 0x2d, 0xe6, 0xae,
+    0xc9, 0x27, 0x76, 0x4b, 0xb2, 0x8f, 0x43, 0x10, 0x40, 0x0e, 0xa6, 0xf1, 0x2b, 0x6f, 0xf6, 0x9b,
+    0xb3, 0x0b, 0xf2, 0x2e, 0x64, 0xbf, 0x2f, 0x98, 0x37, 0x5d, 0x3d, 0x91, 0xda, 0x60, 0x71, 0x69,
+    0x03, 0xa8, 0xcb, 0xf9, 0xec, 0x8f, 0x35, 0xf9, 0xf0, 0xd3, 0x1f, 0x5f, 0x97, 0x32, 0xa0, 0x8a,
+    0x91, 0x9f, 0x18, 0xdd, 0x7e, 0x0f, 0xa5, 0x81, 0x06, 0x92, 0xd8, 0xe5, 0x0c, 0xe0, 0x90, 0x2e,
+    0xe9, 0xf7, 0x06, 0x07, 0xcd, 0x4e, 0xe4, 0xbf, 0x73, 0xee, 0x98, 0x65, 0xf6, 0x9b, 0x6b, 0xf2,
+    0xcf, 0xaf, 0xbf, 0x2e, 0x95, 0x67, 0xe7, 0x9f, 0x5e, 0x7d, 0xd8, 0x05, 0x85, 0x01, 0x0f, 0xe9,
+    0x5c, 0x91, 0xa8, 0xa5, 0xb4, 0x4b, 0xe2, 0xf1, 0x91, 0x1f, 0x51, 0xf7, 0xe1, 0x09, 0x1f, 0xbe,
+    0x32, 0x6b, 0x2e, 0x82, 0xe8, 0x29, 0xd6, 0x5d, 0x16, 0xf8, 0x24, 0x10, 0x49, 0xf7, 0x22, 0x90,
+    0xc6, 0x5e, 0x64, 0x49, 0xbc, 0xf9, 0x95, 0x35, 0xf7, 0xfd, 0x19, 0x79, 0x65, 0x59, 0x10, 0xd5,
+    0xf0, 0xa7, 0xa9, 0x2d, 0xd8, 0x22, 0x2a, 0xe1, 0x6c, 0x49, 0xd0, 0x8b, 0xfb, 0xac, 0xe7, 0x5e,
+    0x7f, 0x51, 0xa2, 0x5f, 0x27, 0x41, 0xc7, 0x13, 0x6d, 0x95, 0x72, 0xd1, 0xd9, 0x20, 0xa6, 0x10,
+    0xe1, 0xc4, 0x01, 0x19, 0x78, 0x75, 0x83, 0x68, 0x5d, 0xb8, 0xe6, 0xc4, 0x9c, 0xcd, 0xc1, 0xa3,
+    0x9b, 0x49, 0x90, 0xd4, 0x8c, 0x5d, 0x3a, 0x86, 0x01, 0xbb, 0xf5, 0xeb, 0x31, 0x32, 0xa2, 0xdb,
+    0x40, 0x36, 0x19, 0x88, 0x6a, 0xbe, 0x47, 0x06, 0x27, 0x5b, 0x30, 0xb6, 0x50, 0x6a, 0xdd, 0x86,
+    0xb7, 0x31, 0x46, 0xe5, 0x8a, 0x3e, 0x66, 0xa1, 0xed, 0x49, 0xc8, 0xe8, 0xcd, 0x90, 0x88, 0xff,
+    0xda, 0xd4, 0x75, 0x4f, 0x92, 0xcd, 0x48, 0x6a, 0x8f, 0x97, 0x8b, 0xd0, 0x25, 0x7f, 0xfe, 0x89,
+    0x11, 0x63, 0x84, 0x01, 0xaf, 0x28, 0x84, 0x30, 0x6b, 0x1b, 0xc6, 0x15, 0x02, 0x8a, 0x35, 0x99,
+    0x52, 0xc8, 0x1a, 0x88, 0xc9, 0x9a, 0x15, 0x89, 0x86, 0xef, 0xb2, 0x8e, 0x38, 0xb7, 0x34, 0x8d,
+    0x77, 0xd4, 0xc1, 0x7d, 0x8f, 0x7c, 0x91, 0xb6, 0x10, 0x19, 0xf0, 0x13, 0xa4, 0x74, 0x68, 0xb4,
+    0x08, 0x2b, 0x04, 0xfd, 0xeb, 0xcc, 0x99, 0x48, 0xf2, 0x31, 0x49, 0x7c, 0x72, 0x56, 0x24, 0xb6,
+    0x1c, 0x05, 0x14, 0x64, 0x68, 0x3f, 0x83, 0x80, 0xe6, 0x03, 0x8d, 0x66, 0x1d, 0xdb, 0xf5, 0x01,
+    0x0b, 0x35, 0x16, 0x2c, 0xeb, 0xfe, 0x51, 0xaf, 0xd7, 0x3c, 0xd1, 0xcc, 0x98, 0xe7, 0x67, 0x24,
+    0x53, 0xbe, 0x91, 0x53, 0x60, 0xea, 0x91, 0x7e, 0x22, 0x87, 0x89, 0xe9, 0xe0, 0xe2, 0xd9, 0x54,
+    0xc8, 0xa2, 0x45, 0xe8, 0x91, 0xab, 0x17, 0xf7, 0xb3, 0xf5, 0x0c, 0xb4, 0x7b, 0xbe, 0x9e, 0xa3,
+    0x8e, 0xaf, 0xf9, 0xd5, 0x89, 0x8e, 0x54, 0x05, 0xd2, 0x65, 0x2c, 0x00, 0xb0, 0x73, 0x80, 0x7d,
+    0x2a, 0x72, 0xe9, 0xb3, 0xd0, 0x9f, 0x3b, 0x9c, 0x99, 0x21, 0x3e, 0xe0, 0x2c, 0xc2, 0x50, 0xdb,
+    0x5f, 0x44, 0x66, 0xd8, 0x82, 0x41, 0xcd, 0x6c, 0xfe, 0xd5, 0xed, 0xa2, 0x9f, 0xbe, 0x5d, 0x11,
+    0xe6, 0x59, 0xe2, 0x40, 0x8b, 0x13, 0xea, 0xf1, 0x25, 0x0b, 0xc9, 0xa0, 0x37, 0x80, 0x8f, 0x16,
+    0x09, 0x17, 0x1e, 0xe4, 0xac, 0x22, 0x23, 0x07, 0x09, 0x67, 0xae, 0xc1, 0x51, 0xa6, 0x6e, 0xf0,
+    0x18, 0xff, 0xb0, 0xb7, 0x4f, 0xe6, 0x0c, 0xc6, 0x67, 0xc1, 0xe1, 0x40, 0x39, 0x80, 0x38, 0x9c,
+    0x70, 0x1a, 0x61, 0x3d, 0x0d, 0xb6, 0x14, 0x61, 0x41, 0x26, 0x1d, 0x3a, 0x8c, 0x43, 0x40, 0x06,
+    0x59, 0x67, 0xfb, 0x95, 0x0d, 0x59, 0x7d, 0x55, 0xd6, 0x1a, 0xe2, 0x90, 0xb7, 0xcc, 0xa5, 0x2b,
+    0x33, 0xce, 0x1e, 0xf5, 0x7b, 0x17, 0x33, 0x73, 0x0c, 0xe8, 0x85, 0x1c, 0x72, 0xdc, 0x28, 0x99,
+    0xd0, 0xc1, 0x03, 0x2b, 0x16, 0x72, 0xcc, 0x23, 0x4d, 0x23, 0xb3, 0xa8, 0xd1, 0x14, 0xa2, 0xde,
+    0x07, 0x91, 0xea, 0x17, 0xb7, 0x49, 0x66, 0xac, 0x82, 0xa7, 0xc9, 0xae, 0x7e, 0x8b, 0x87, 0xc6,
+    0xd9, 0x81, 0x99, 0x3d, 0x28, 0xe0, 0xad, 0x29, 0x86, 0xeb, 0xd1, 0x96, 0x87, 0xec, 0x35, 0xc9,
+    0x6e, 0xa9, 0x32, 0x5f, 0x4c, 0x79, 0xf5, 0x99, 0x3b, 0x26, 0xc1, 0xb5, 0x79, 0x7b, 0x0a, 0xb7,
+    0xab, 0x90, 0x05, 0x36, 0xdc, 0xc3, 0x46, 0x46, 0x33, 0xdf, 0x02, 0x5b, 0x79, 0xf6, 0xf1, 0xfc,
+    0xb3, 0x41, 0xd6, 0x9a, 0xfc, 0x1a, 0xeb, 0x57, 0x26, 0xc2, 0x8f, 0xc4, 0x2e, 0x8e, 0xf1, 0x84,
+    0x24, 0xe1, 0x75, 0x4c, 0xd0, 0x78, 0x2c, 0xe4, 0xe2, 0xe5, 0x4b, 0x35, 0x6a, 0x44, 0x0e, 0x4f,
+    0xe4, 0xc7, 0xbd, 0xbd, 0xaa, 0x04, 0x3b, 0xae, 0x12, 0x94, 0xb7, 0x5c, 0x9f, 0xae, 0x7e, 0x21,
+    0xfa, 0xd6, 0xda, 0x52, 0xc1, 0xf3, 0x84, 0x44, 0xff, 0xa6, 0x8a, 0x00, 0x49, 0x7c, 0x3e, 0x41,
+    0x92, 0x7e, 0x2b, 0xae, 0x83, 0x4b, 0xee, 0x64, 0x9b, 0x34, 0x92, 0x44, 0x78, 0xb2, 0xe0, 0xab,
+    0x96, 0xd8, 0x4d, 0x7a, 0x4d, 0x1d, 0x4f, 0xf9, 0xad, 0xab, 0x2a, 0xd2, 0xd1, 0x42, 0xe8, 0x70,
+    0x7f, 0xb6, 0x25, 0x52, 0xf1, 0x59, 0x4d, 0x2e, 0x11, 0xbe, 0xd2, 0x57, 0x57, 0x54, 0x55, 0xc7,
+    0x5b, 0x80, 0x0f, 0xd9, 0x48, 0x3c, 0x62, 0x19, 0x38, 0xe8, 0x6d, 0x28, 0x04, 0x52, 0xf1, 0x06,
+    0x87, 0xbd, 0x8a, 0xad, 0xcf, 0xd5, 0x95, 0xcc, 0xda, 0xdd, 0x8f, 0xb5, 0xa6, 0x99, 0x94, 0x9d,
+    0x74, 0x00, 0xc5, 0x16, 0x0b, 0x5f, 0x18, 0x80, 0x0d, 0x04, 0x26, 0x34, 0xa5, 0x9f, 0xdc, 0x88,
+    0xc5, 0x71, 0x29, 0x09, 0xc5, 0x5d, 0xc0, 0xa0, 0xb7, 0xe0, 0xc0, 0x30, 0x76, 0x49, 0x9e, 0x00,
+    0xab, 0x23, 0xa1, 0x15, 0x86, 0xe5, 0x7b, 0xcc, 0xd8, 0x91, 0x04, 0xa9, 0x3e, 0xa1, 0x46, 0xe6,
+    0x90, 0x2f, 0x36, 0x3d, 0x16, 0x16, 0x8c, 0x54, 0x81, 0x0b, 0x22, 0x81, 0x8a, 0xd4, 0xa9, 0x59,
+    0x2f, 0x66, 0xc5, 0xb3, 0x36, 0x0d, 0x37, 0x08, 0x73, 0x41, 0x03, 0x77, 0xa9, 0x0f, 0xa9, 0xf3,
+    0x57, 0xa4, 0x10, 0x9e, 0x39, 0x3d, 0xac, 0x42, 0x77, 0xbd, 0x8b, 0x68, 0xa3, 0xbc, 0xe0, 0xc6,
+    0xf1, 0x06, 0xf8, 0x3c, 0x71, 0x20, 0x87, 0x2c, 0x1b, 0x92, 0x8c, 0x10, 0x82, 0x00, 0x82, 0x20,
+    0xcd, 0xc1, 0x43, 0xa1, 0x0f, 0xf1, 0x3d, 0x77, 0x25, 0x9c, 0x63, 0x04, 0x6b, 0x72, 0xf8, 0x44,
+    0x23, 0x6c, 0x02, 0xf7, 0xae, 0x99, 0xd5, 0xca, 0xc2, 0xa2, 0x9c, 0x84, 0x74, 0x49, 0x40, 0x97,
+    0xc0, 0xf3, 0xb6, 0x5d, 0xe6, 0x5d, 0x47, 0x33, 0xf2, 0xe9, 0xaf, 0xaf, 0x0f, 0x8f, 0x0e, 0x09,
+    0x38, 0x24, 0x0c, 0x86, 0xa6, 0xee, 0xc2, 0x62, 0x6a, 0x91, 0x4b, 0xb9, 0x48, 0x67, 0xd6, 0x7c,
+    0x96, 0x55, 0x54, 0x3c, 0x55, 0x3b, 0xf7, 0xa7, 0x37, 0xf0, 0x31, 0x56, 0xd7, 0x72, 0x80, 0x54,
+    0x3c, 0xd5, 0x2b, 0x30, 0x0c, 0x85, 0x3b, 0x85, 0xa3, 0x63, 0x67, 0xfa, 0xb6, 0x33, 0x75, 0x7d,
+    0x08, 0x38, 0x34, 0x72, 0xa2, 0x33, 0x58, 0x05, 0x4d, 0x92, 0x1e, 0x51, 0x9d, 0x09, 0xd6, 0x78,
+    0xc4, 0xcc, 0x51, 0xa1, 0xa1, 0x0d, 0xae, 0xa6, 0xd1, 0x1d, 0xcc, 0x97, 0x23, 0x70, 0x36, 0x76,
+    0x9b, 0xb0, 0x3b, 0xf0, 0xfd, 0x03, 0x4b, 0x3f, 0xe1, 0x61, 0x2f, 0x9c, 0x39, 0x47, 0xd5, 0x83,
+    0x50, 0xd5, 0xfe, 0x87, 0x40, 0x48, 0x5e, 0x17, 0x41, 0x88, 0xad, 0x02, 0x03, 0x71, 0xce, 0x7e,
+    0xd7, 0x9a, 0x55, 0x7c, 0x6f, 0x43, 0xae, 0xaf, 0xcc, 0x69, 0x9e, 0x6d, 0xf9, 0x3d, 0x86, 0xb0,
+    0xef, 0x57, 0x36, 0x91, 0xdf, 0xcd, 0xab, 0x25, 0x1f, 0x76, 0xbb, 0x2f, 0xee, 0x5d, 0x7f, 0x2a,
+    0x0e, 0x33, 0x3b, 0x33, 0x9f, 0x47, 0xeb, 0xb2, 0x6c, 0x5e, 0x15, 0xf1, 0x49, 0x37, 0x74, 0xe2,
+    0x78, 0x34, 0x5c, 0x7d, 0x5e, 0x05, 0xe8, 0x65, 0x0d, 0x08, 0xdc, 0xe8, 0x6a, 0xb2, 0xb0, 0x6d,
+    0x08, 0x9e, 0x2a, 0xa7, 0xf8, 0x9e, 0x38, 0xdd, 0x1a, 0x13, 0x10, 0x25, 0x08, 0x3c, 0xef, 0x15,
+    0x6f, 0x3a, 0xb8, 0x07, 0x6f, 0x64, 0xd7, 0x13, 0xc2, 0x3a, 0x8f, 0xfc, 0xc0, 0x38, 0x89, 0xb7,
+    0x49, 0x64, 0x2e, 0x1d, 0x75, 0x08, 0x29, 0x2b, 0xf6, 0x64, 0x5d, 0xb3, 0x84, 0x10, 0xb4, 0x74,
+    0x8d, 0x1a, 0x99, 0xac, 0x74, 0x54, 0x55, 0x68, 0xd1, 0x30, 0xd2, 0xd4, 0xc7, 0x35, 0xb6, 0xac,
+    0x78, 0xaa, 0x50, 0x87, 0x2f, 0xec, 0x1d, 0xa7, 0xd7, 0x88, 0x31, 0xd3, 0x23, 0x8c, 0x6a, 0x86,
+    0xe7, 0x8b, 0xbe, 0x4d, 0x80, 0x0f, 0xc2, 0xbd, 0xa1, 0xb7, 0x80, 0x0d, 0x02, 0x67, 0x64, 0xd4,
+    0x9f, 0x49, 0xcc, 0x98, 0xeb, 0xe2, 0x71, 0xc4, 0x3f, 0x9d, 0x7f, 0xfc, 0xa5, 0x23, 0xe2, 0x5f,
+    0x53, 0xc2, 0xa8, 0x70, 0x76, 0x8a, 0xe7, 0xe2, 0x98, 0x1d, 0xa6, 0x89, 0xe9, 0xf2, 0x5b, 0xed,
+    0x78, 0x79, 0x14, 0x9f, 0x4c, 0x90, 0x5f, 0x9f, 0x1c, 0x9f, 0x48, 0x12, 0x6e, 0x95, 0xf0, 0xbe,
+    0x05, 0xac, 0x85, 0x19, 0xaa, 0x24, 0x00, 0x19, 0x75, 0x8b, 0xda, 0x75, 0x01, 0x79, 0xca, 0xb1,
+    0x09, 0x59, 0xd6, 0x73, 0x60, 0x54, 0xef, 0xee, 0x70, 0x1f, 0xa3, 0xf9, 0xcc, 0x9b, 0xbe, 0x7c,
+    0x03, 0xff, 0x55, 0x61, 0x23, 0x97, 0xb6, 0x5d, 0x7a, 0x8d, 0x8a, 0x95, 0x99, 0x3a, 0xa8, 0x3c,
+    0xd0, 0x42, 0xb3, 0x9d, 0x1f, 0xbb, 0x5f, 0x39, 0x96, 0x0b, 0x75, 0x4e, 0x86, 0xf6, 0x8f, 0xcc,
+    0x03, 0x0c, 0xf0, 0x16, 0xac, 0x82, 0xaa, 0xd8, 0x04, 0x20, 0xd6, 0x28, 0xb2, 0x18, 0x3c, 0x70,
+    0xf5, 0xdd, 0x4c, 0xde, 0xee, 0x21, 0x45, 0x2f, 0x81, 0x60, 0x1b, 0xfe, 0x9a, 0x38, 0xe6, 0xb9,
+    0x29, 0x49, 0x78, 0x09, 0x6f, 0xaa, 0x04, 0x25, 0x23, 0x8c, 0xe8, 0x88, 0x4c, 0xe3, 0x86, 0xad,
+    0xc0, 0x0c, 0x09, 0x5f, 0xf3, 0xc1, 0xe1, 0x1c, 0x53, 0x33, 0xa2, 0x84, 0xb4, 0x05, 0xde, 0xe7,
+    0x46, 0xc4, 0x71, 0xec, 0x96, 0x41, 0x3c, 0x2a, 0x68, 0x16, 0x41, 0xe9, 0x06, 0xb1, 0x72, 0x6a,
+    0xc7, 0x00, 0x75, 0xcd, 0x11, 0x1f, 0xda, 0x32, 0xdf, 0xb6, 0xe1, 0x7d, 0xbf, 0x57, 0x13, 0x3c,
+    0x7a, 0x05, 0xce, 0x1d, 0xc7, 0x9c, 0x83, 0x37, 0xa7, 0x18, 0x52, 0x7a, 0xed, 0x76, 0xbd, 0x52,
+    0x08, 0x27, 0x90, 0xd9, 0x27, 0x58, 0xb4, 0x09, 0x40, 0x56, 0xa5, 0xa7, 0x82, 0xa3, 0xe0, 0xe5,
+    0x21, 0x7f, 0xd3, 0xbc, 0x1a, 0x54, 0xe9, 0x90, 0x58, 0xc4, 0x65, 0x45, 0x44, 0xe5, 0xac, 0xfd,
+    0xca, 0x8d, 0x16, 0xbd, 0xb6, 0x38, 0x06, 0x12, 0xa4, 0x3a, 0xc8, 0xcb, 0xb8, 0xb4, 0x30, 0x77,
+    0x3c, 0x13, 0x77, 0xa0, 0x95, 0x57, 0xdb, 0x36, 0x12, 0xf8, 0xad, 0xd8, 0x9b, 0x5a, 0x0c, 0x67,
+    0x95, 0x70, 0x94, 0x3a, 0xb7, 0x91, 0x27, 0x1b, 0x00, 0xc2, 0xde, 0xfb, 0x31, 0xfa, 0xd6, 0x0e,
+    0xb8, 0x0e, 0xc8, 0xe5, 0xdf, 0xcf, 0x41, 0x54, 0x50, 0x5d, 0xcd, 0x65, 0x8b, 0xcc, 0x6a, 0xa7,
+    0x62, 0xef, 0x04, 0x88, 0x70, 0x00, 0x4b, 0x57, 0x98, 0xeb, 0x44, 0x0d, 0xe6, 0xd7, 0x42, 0xef,
+    0xff, 0x2d, 0x00, 0x94, 0x0e, 0xfe, 0x1d, 0x67, 0x99, 0x53, 0x72, 0x7a, 0x4a, 0xfa, 0x4a, 0xe8,
+    0xfb, 0x20, 0xf2, 0xa3, 0x11, 0xd9, 0x3f, 0xd9, 0x10, 0x04, 0x6e, 0x6e, 0x06, 0xcc, 0xa1, 0x84,
+    0xb2, 0x2f, 0xa1, 0x0c, 0x1e, 0x01, 0x65, 0x20, 0xa0, 0x4c, 0xb7, 0x45, 0x62, 0x1f, 0xa7, 0x0f,
+    0x0e, 0x2b, 0xb6, 0x7c, 0x5d, 0x9d, 0x94, 0x08, 0xb1, 0x94, 0x66, 0xac, 0x9a, 0x6d, 0x89, 0xda,
+    0x38, 0x18, 0x20, 0xb4, 0x48, 0x20, 0xd3, 0x2e, 0x07, 0x52, 0x2e, 0x90, 0x50, 0xfc, 0x00, 0xe2,
+    0xb6, 0x5f, 0x07, 0x21, 0x13, 0x3d, 0x69, 0x05, 0xda, 0x41, 0x46, 0xd6, 0x0a, 0x75, 0x09, 0x97,
+    0x50, 0xa7, 0x4e, 0x0e, 0x68, 0x70, 0x48, 0x4e, 0x65, 0xd1, 0x00, 0x55, 0x18, 0x64, 0xc3, 0x0c,
+    0xf6, 0xf6, 0x50, 0x34, 0xaa, 0xe1, 0xea, 0x4b, 0xda, 0xb5, 0xb9, 0x47, 0x0e, 0x15, 0xc5, 0x8f,
+    0x00, 0xf8, 0xb1, 0x84, 0x0d, 0x99, 0xc1, 0x47, 0xcc, 0x40, 0xc5, 0xda, 0x2d, 0x0d, 0xb5, 0xb8,
+    0x6b, 0x03, 0x45, 0x6d, 0x05, 0x5a, 0x7a, 0x94, 0x50, 0x3d, 0x00, 0x6a, 0xaa, 0x1b, 0x20, 0x08,
+    0xad, 0x54, 0x53, 0x5b, 0x0f, 0xea, 0x9a, 0x32, 0x0d, 0x2e, 0xf3, 0x36, 0xce, 0x3c, 0x63, 0xe3,
+    0x3f, 0xd8, 0x75, 0x52, 0x29, 0xf2, 0x19, 0xc8, 0x22, 0xf7, 0xf6, 0x64, 0xf0, 0xb9, 0x56, 0x8d,
+    0x38, 0xbc, 0xb9, 0x71, 0x1a, 0x76, 0x52, 0x5b, 0x9a, 0x2d, 0xa6, 0x97, 0xda, 0x12, 0x59, 0x7a,
+    0xfb, 0x67, 0xb3, 0x2a, 0x59, 0x32, 0x5e, 0x13, 0xa8, 0xcb, 0x17, 0x05, 0x4e, 0xa0, 0x61, 0xe3,
+    0xe1, 0x74, 0xdc, 0x28, 0x56, 0x0e, 0x10, 0xbd, 0x1f, 0xa2, 0xf1, 0x8b, 0x7b, 0xd8, 0x49, 0xd6,
+    0xf1, 0x7c, 0xc8, 0x8d, 0xd6, 0x0d, 0x42, 0xdd, 0x68, 0xdc, 0x48, 0xb1, 0xc6, 0x56, 0x1e, 0x91,
+    0x47, 0x8e, 0x1b, 0xd1, 0xcc, 0xe1, 0x18, 0x7e, 0x01, 0x56, 0x0a, 0xb9, 0x74, 0xa5, 0xb1, 0x91,
+    0xb4, 0x48, 0xfd, 0xed, 0x6f, 0x86, 0x3c, 0xbf, 0xc0, 0xe3, 0x0b, 0xf8, 0x72, 0xfa, 0x8b, 0x9f,
+    0x49, 0x38, 0x49, 0x52, 0x3b, 0xc0, 0xbe, 0x26, 0xa3, 0x71, 0x7a, 0x55, 0xcf, 0x43, 0x5d, 0xdf,
+    0x6a, 0xe9, 0xc6, 0x8b, 0x07, 0xa3, 0x3a, 0x69, 0x16, 0x10, 0x32, 0xf4, 0xbf, 0xa5, 0x4a, 0x49,
+    0x0c, 0xca, 0xd8, 0xa4, 0xc2, 0x59, 0xe8, 0x5b, 0xd2, 0x24, 0x8d, 0xe2, 0xf8, 0x20, 0x9c, 0x9b,
+    0xc6, 0x2b, 0xc8, 0xa8, 0x57, 0xfe, 0x82, 0xf0, 0x85, 0xfa, 0xb0, 0xa4, 0x10, 0x6b, 0x43, 0xba,
+    0xad, 0x60, 0x88, 0x7c, 0x58, 0xd6, 0xf8, 0x7f, 0x30, 0xb4, 0x11, 0x4c, 0xb9, 0xc0, 0xa3, 0xa6,
+    0x6e, 0x5a, 0xd3, 0xa3, 0x2e, 0x0b, 0x21, 0x01, 0x54, 0xa5, 0x36, 0x87, 0xc7, 0x4b, 0xcb, 0x6a,
+    0x97, 0xb1, 0x49, 0x82, 0xaf, 0xe9, 0xa7, 0xc2, 0x8e, 0xbb, 0x73, 0xa1, 0x34, 0xbb, 0xeb, 0xa7,
+    0xc2, 0x7e, 0xc2, 0xae, 0x3e, 0xd3, 0x7c, 0x62, 0x5b, 0xd5, 0xc3, 0x59, 0x6e, 0xa6, 0xa3, 0xd5,
+    0x68, 0xd6, 0x74, 0x4c, 0xa9, 0x86, 0xc3, 0xea, 0x56, 0xa9, 0x6d, 0x2d, 0xce, 0x9b, 0x18, 0x30,
+    0x4a, 0x47, 0x7c, 0x1a, 0xc8, 0x1d, 0x6b, 0x9d, 0x74, 0x3f, 0x85, 0xf0, 0x75, 0x4d, 0xac, 0xd7,
+    0xf3, 0x3a, 0x1b, 0x24, 0xfd, 0x42, 0x82, 0x2e, 0xf6, 0x7f, 0xc8, 0x6c, 0x8a, 0x06, 0xc6, 0x6e,
+    0x6b, 0xb7, 0xaf, 0xce, 0xc8, 0x07, 0x80, 0x3e, 0x8c, 0xbb, 0x2d, 0x11, 0xef, 0x86, 0x42, 0x95,
+    0x06, 0x97, 0x02, 0xf7, 0x86, 0xa8, 0x2c, 0xc5, 0x67, 0x69, 0x0f, 0xa2, 0xbd, 0xd3, 0xd2, 0xb2,
+    0xc3, 0x93, 0xbd, 0xfa, 0xc2, 0xa5, 0x33, 0x71, 0x50, 0x27, 0xfa, 0xa7, 0x25, 0x0a, 0x1b, 0x17,
+    0xce, 0x0a, 0x7a, 0x95, 0xef, 0x76, 0xd6, 0x7a, 0x04, 0x71, 0xbb, 0xac, 0x46, 0x8c, 0xb3, 0xfd,
+    0xcd, 0xa5, 0x52, 0x0b, 0x3c, 0x2b, 0x17, 0x1b, 0xc4, 0xcd, 0x43, 0x43, 0x33, 0x32, 0x97, 0xee,
+    0x67, 0xaf, 0xb9, 0xe4, 0xaf, 0x9e, 0x15, 0x1a, 0x5c, 0xb1, 0x43, 0xdb, 0xcb, 0x5e, 0x01, 0x32,
+    0x0a, 0x4a, 0xa9, 0xb7, 0x0e, 0x90, 0x8a, 0xbd, 0x12, 0xa7, 0x6e, 0x98, 0x8c, 0x45, 0xd8, 0x22,
+    0xca, 0x4e, 0x88, 0x68, 0xff, 0x46, 0x60, 0x0d, 0xb2, 0xf0, 0x20, 0x70, 0xc8, 0x18, 0x4b, 0x32,
+    0xa3, 0x1c, 0xb2, 0x36, 0x1b, 0x0c, 0xc0, 0x0c, 0xad, 0xc0, 0xc2, 0x8d, 0x76, 0x5b, 0xae, 0xdf,
+    0x7f, 0xb8, 0x5c, 0x5f, 0x6b, 0xd1, 0x14, 0x48, 0x4c, 0xcf, 0xf1, 0x0c, 0x3f, 0x63, 0xdf, 0x80,
+    0xa6, 0x1f, 0xc0, 0x0b, 0x21, 0xe6, 0xe3, 0xbe, 0x38, 0x9b, 0xcf, 0xbf, 0x34, 0x36, 0xa9, 0xfb,
+    0x97, 0x0c, 0x5f, 0x7d, 0x61, 0x3f, 0x66, 0x64, 0x65, 0x65, 0xbf, 0x78, 0xfc, 0x70, 0xd8, 0xeb,
+    0x6d, 0x7e, 0x3c, 0x24, 0x30, 0xfb, 0xf3, 0x4f, 0x65, 0x72, 0x20, 0xfc, 0xbb, 0x9c, 0x4b, 0xd2,
+    0xe3, 0x4c, 0x5e, 0x21, 0x71, 0xe3, 0x04, 0x01, 0x18, 0xce, 0xea, 0x3c, 0x7d, 0x0b, 0xa9, 0x53,
+    0x17, 0x79, 0xd5, 0xd5, 0x00, 0x5b, 0xe8, 0x64, 0x22, 0x78, 0x8f, 0x2b, 0xcf, 0x54, 0xda, 0xfc,
+    0x02, 0x45, 0x3b, 0xc5, 0x5f, 0x6a, 0xcd, 0x19, 0x9e, 0x2b, 0xa3, 0x6f, 0x2e, 0x9c, 0x84, 0x11,
+    0x08, 0x4e, 0xc2, 0xc8, 0x5d, 0x6d, 0x49, 0x51, 0x35, 0x49, 0x71, 0xff, 0x7d, 0x47, 0x95, 0xd7,
+    0x85, 0xa0, 0x7e, 0x01, 0xc2, 0x20, 0xbe, 0x8b, 0x97, 0x02, 0x75, 0x5b, 0x78, 0xd6, 0xae, 0x28,
+    0x29, 0xe1, 0x94, 0x27, 0x6b, 0x4e, 0x03, 0xd3, 0xc3, 0x02, 0xa8, 0xbe, 0x6f, 0xe3, 0x2a, 0xdb,
+    0x45, 0x92, 0xbd, 0x42, 0x9a, 0xbd, 0x7b, 0x22, 0x2e, 0x0c, 0x2b, 0x7b, 0x6c, 0x1a, 0x2f, 0xee,
+    0x3d, 0x2c, 0x20, 0xa1, 0x57, 0x33, 0x9a, 0x75, 0x3d, 0x2e, 0xc2, 0xd5, 0x64, 0x46, 0x13, 0xf5,
+    0x99, 0x4d, 0x31, 0x06, 0x04, 0x5b, 0xf0, 0x3f, 0xff, 0xf5, 0x1f, 0xff, 0x48, 0x7a, 0x72, 0xc4,
+    0xe8, 0x7a, 0x60, 0x89, 0x9b, 0x13, 0xb7, 0x56, 0x1b, 0x0a, 0x76, 0x12, 0x0d, 0xd4, 0xc1, 0x50,
+    0xfd, 0xad, 0xa5, 0x77, 0xcd, 0xce, 0x6f, 0xbe, 0xe3, 0x99, 0x46, 0x29, 0xfa, 0xab, 0x75, 0x80,
+    0x5f, 0x56, 0x41, 0xeb, 0x5b, 0x59, 0xf2, 0xbb, 0x81, 0x8c, 0x2d, 0x62, 0xf8, 0x40, 0x68, 0x07,
+    0x33, 0x8c, 0x66, 0x47, 0xfe, 0x56, 0xc8, 0x98, 0xe0, 0xd7, 0x93, 0xcd, 0xa6, 0xe7, 0x5d, 0x6a,
+    0xd9, 0x81, 0xe2, 0xad, 0x21, 0xe3, 0xe4, 0x11, 0xa8, 0xc4, 0x37, 0x66, 0x00, 0x98, 0xb8, 0x8d,
+    0x6e, 0x6e, 0xd6, 0x56, 0x91, 0xbd, 0xe9, 0xa2, 0x6f, 0xa8, 0xe0, 0xf5, 0x77, 0x07, 0x4a, 0x7c,
+    0xd0, 0x1d, 0xe6, 0xc4, 0xc8, 0x3d, 0x08, 0x28, 0x43, 0x85, 0x02, 0x56, 0xca, 0x82, 0x9e, 0xeb,
+    0xb6, 0x29, 0x93, 0x92, 0x9c, 0xb9, 0x8c, 0x82, 0xe3, 0x14, 0x97, 0xbb, 0x09, 0x08, 0x07, 0xde,
+    0x9a, 0x32, 0xb6, 0x3b, 0x40, 0x7b, 0x5a, 0xce, 0xa1, 0x78, 0x8b, 0x19, 0x95, 0x56, 0x8d, 0xf2,
+    0x59, 0x56, 0x4b, 0x3b, 0x46, 0x75, 0xda, 0x0c, 0x21, 0x29, 0x33, 0xd4, 0x99, 0x4a, 0x1b, 0xcf,
+    0x8e, 0x8c, 0x21, 0xc6, 0xde, 0x01, 0xd8, 0x14, 0x91, 0x81, 0x76, 0xd1, 0x61, 0x43, 0xa2, 0xa6,
+    0x07, 0x82, 0x17, 0xcb, 0x87, 0xf2, 0x2c, 0x43, 0x9e, 0x7e, 0x38, 0xf6, 0xca, 0xbc, 0x17, 0x3b,
+    0xdb, 0x4a, 0xb7, 0x66, 0xdd, 0x2c, 0x5b, 0xc8, 0x5d, 0xe5, 0x4b, 0xe9, 0xd5, 0x10, 0x99, 0x98,
+    0x54, 0xf6, 0x2a, 0xc8, 0x2d, 0x14, 0x51, 0x2f, 0xa4, 0xd1, 0x16, 0x90, 0xeb, 0x50, 0x17, 0xdb,
+    0x9d, 0x6e, 0x99, 0xd5, 0x51, 0x37, 0x78, 0x20, 0xfd, 0x86, 0x00, 0x20, 0x4e, 0x75, 0x45, 0xff,
+    0x53, 0x9a, 0x2b, 0x60, 0x30, 0x87, 0xc7, 0x1e, 0x4a, 0xbf, 0x3a, 0xc6, 0x63, 0x8f, 0xd8, 0x15,
+    0x0a, 0x3f, 0x62, 0x38, 0x0e, 0x4c, 0x26, 0x7b, 0xd2, 0x07, 0x88, 0xf0, 0xbc, 0xf9, 0x85, 0x42,
+    0x7d, 0x24, 0x4f, 0x84, 0xfa, 0xdb, 0xc6, 0xf8, 0x98, 0x2b, 0xe4, 0x6f, 0x5d, 0xef, 0x2a, 0x7b,
+    0x96, 0xd7, 0xc1, 0xb7, 0x4d, 0x9c, 0x4b, 0xd1, 0x66, 0x95, 0xf2, 0x6b, 0xae, 0xa7, 0x67, 0xec,
+    0x6a, 0xbe, 0xa5, 0xf2, 0x42, 0x75, 0x54, 0x1a, 0xbb, 0xeb, 0x87, 0x0c, 0xb3, 0xad, 0xa2, 0x5b,
+    0x27, 0x5a, 0xa5, 0xab, 0xef, 0x5a, 0x83, 0x8a, 0x0d, 0xa1, 0xe3, 0xad, 0x38, 0xd1, 0x01, 0xe5,
+    0x9d, 0x9b, 0x5b, 0x1e, 0xb8, 0xeb, 0x6e, 0xc3, 0x1b, 0x4d, 0x9d, 0x7d, 0x85, 0xf7, 0x3a, 0x0e,
+    0xea, 0xce, 0x6b, 0x1f, 0x4e, 0x98, 0x81, 0x9f, 0xb2, 0x3a, 0xf4, 0xfb, 0xc2, 0x09, 0x93, 0x9c,
+    0xd9, 0xd8, 0xca, 0x1c, 0xc7, 0xd8, 0x75, 0x84, 0xe6, 0xf3, 0x5f, 0x9d, 0x08, 0xa4, 0x54, 0xfd,
+    0x6c, 0x81, 0x21, 0x0f, 0xee, 0x74, 0x6f, 0xb9, 0x78, 0xbd, 0x5b, 0x92, 0xe6, 0x0b, 0xc9, 0x74,
+    0x30, 0x40, 0x4b, 0x58, 0x88, 0x28, 0x2c, 0xb0, 0xbd, 0x24, 0x5e, 0xf2, 0x49, 0xa4, 0x3e, 0x55,
+    0x5f, 0xff, 0xbf, 0xfa, 0x9c, 0xac, 0x12, 0x0f, 0x85, 0x2a, 0x7c, 0x69, 0xb7, 0xa3, 0x6b, 0xa4,
+    0x1c, 0xf4, 0x7a, 0x8f, 0xa8, 0x5a, 0x19, 0x9b, 0x14, 0xda, 0x12, 0x47, 0x11, 0xf7, 0x25, 0xec,
+    0xc1, 0xbc, 0x4a, 0x09, 0xc8, 0x14, 0xd4, 0xf4, 0xf8, 0x0d, 0x9e, 0x88, 0x5f, 0xd2, 0xb9, 0x5e,
+    0xf8, 0xbd, 0xaa, 0x83, 0x49, 0x2f, 0xf3, 0x03, 0x68, 0xb6, 0x3d, 0xed, 0xf7, 0xbe, 0x3b, 0x11,
+    0x65, 0x42, 0xac, 0x2c, 0x63, 0x43, 0xb2, 0xaa, 0x84, 0xa8, 0x50, 0xf4, 0x41, 0x12, 0x76, 0xc2,
+    0x45, 0xa5, 0x58, 0xc8, 0x43, 0x33, 0xf5, 0xb6, 0xc2, 0xc8, 0x4b, 0x43, 0x0d, 0xda, 0x5d, 0xcf,
+    0xcf, 0x47, 0x78, 0x82, 0xed, 0x70, 0x53, 0xe5, 0x48, 0xb4, 0xf3, 0xe2, 0x89, 0x1e, 0x97, 0xca,
+    0x46, 0x36, 0xd1, 0x74, 0x8f, 0xc2, 0x0b, 0xf3, 0x03, 0x14, 0x0f, 0x74, 0x3b, 0x69, 0x67, 0x59,
+    0xe1, 0x2a, 0xf1, 0x49, 0xee, 0x4d, 0xb6, 0x28, 0x9e, 0x7f, 0x93, 0xf7, 0x36, 0xe9, 0x3b, 0xce,
+    0xa2, 0xf7, 0x18, 0xfe, 0x82, 0xd7, 0x30, 0xf3, 0xb0, 0x5b, 0xf8, 0x83, 0x85, 0xbd, 0x9a, 0xa1,
+    0xe9, 0x62, 0x2d, 0xd1, 0x9c, 0xdd, 0x2b, 0x74, 0xb5, 0xbf, 0x99, 0xb1, 0xa9, 0x6a, 0x65, 0xb8,
+    0x83, 0xd4, 0x05, 0x5d, 0x66, 0x7a, 0xe0, 0x91, 0x26, 0x58, 0xf5, 0x9d, 0xa3, 0x39, 0x9e, 0x75,
+    0x20, 0x64, 0xf3, 0x64, 0x4b, 0x7d, 0xa8, 0x54, 0x59, 0x37, 0x40, 0xaa, 0x7e, 0x55, 0xa3, 0x4f,
+    0xbe, 0x49, 0xb4, 0x4a, 0x79, 0x1e, 0xd3, 0x13, 0x9e, 0x15, 0x90, 0x87, 0x2e, 0x20, 0x6f, 0xdc,
+    0x4a, 0x9a, 0xb6, 0xb1, 0xfe, 0xdf, 0xf4, 0x92, 0x3e, 0xd3, 0x99, 0xd5, 0x51, 0x37, 0xbe, 0xd9,
+    0x3e, 0xea, 0xca, 0xdf, 0x9c, 0x1a, 0x75, 0xe5, 0xaf, 0xe9, 0xfe, 0x2f, 0xaf, 0x28, 0x72, 0x6e,
+    0x65, 0x57, 0x00, 0x00,
+};
+
+#endif // INDEX_HTML_GZ_H
@@ -0,0 +1,41 @@
+#ifndef JSON_ALLOC_H
+#define JSON_ALLOC_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+class Print;
+
+// ArduinoJson pools in PSRAM, for every heap-backed document the firmware
+// builds (config parse and filter, state snapshots, batch results, scans).
+// Internal SRAM stays with WiFi and lwIP, and a large config no longer needs
+// one contiguous block of it.
+//
+// A pool that PSRAM can't hold falls back to internal heap and is counted.
+// Every block carries its size in a small header so the running totals stay
+// exact; they are reported under "json" at /api/diag/heap.
+//
+// Small fixed documents stay StaticJsonDocument on the stack of whoever
+// builds them.
+struct JsonAllocStats {
+    uint32_t current;           // Bytes held by live documents
+    uint32_t peak;
+    uint32_t allocs;
+    uint32_t internalFallbacks; // Pools that went to internal heap
+    uint32_t failures;          // Requests neither heap could serve
+};
+
+struct PsramJsonAllocator {
+    void* allocate(size_t size);
+    void deallocate(void* ptr);
+    void* reallocate(void* ptr, size_t size);
+};
+
+typedef BasicJsonDocument<PsramJsonAllocator> PsramJsonDocument;
+
+JsonAllocStats getJsonAllocStats();
+
+// The stats as one JSON object
+void writeJsonAllocStats(Print& out);
+
+#endif // JSON_ALLOC_H
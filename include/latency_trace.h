@@ -0,0 +1,101 @@
+#ifndef LATENCY_TRACE_H
+#define LATENCY_TRACE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include "metric_histogram.h"
+
+// Touch-to-photon latency harness, served at /api/perf/latency.
+//
+// A card tap opens a trace; the render path, the device controller and the
+// HTTP worker stamp it (esp_timer microseconds) as the press moves through
+// the pipeline:
+//
+//   touch_read -> event_dispatch -> style_update -> flush_done -> vsync
+//                               \-> webhook_enqueue -> http_response
+//
+// Each stage only counts once its predecessor is stamped, so a frame that
+// was already in flight when the tap landed can't pass for its photon.
+// A trace closes when both branches reach their end (or after
+// TRACE_TIMEOUT_US), and its per-stage offsets from touch_read go into
+// small rings that the report summarizes like /api/perf does. Touch to
+// style update, to photon and to HTTP response also go into cumulative
+// histograms for /metrics.
+enum LatencyStage : uint8_t {
+    LAT_TOUCH_READ = 0,     // my_touchpad_read() saw the release that became the click
+    LAT_EVENT_DISPATCH,     // onCardClicked() entered
+    LAT_STYLE_UPDATE,       // Card styles changed for the new state
+    LAT_FLUSH_DONE,         // Last area of the next frame written to the panel framebuffer
+    LAT_VSYNC,              // Panel switched to that frame (direct mode, double buffered)
+    LAT_WEBHOOK_ENQUEUE,    // Action queued for the HTTP worker
+    LAT_HTTP_RESPONSE,      // Worker's POST answered (or batch handed to the server channel)
+    LAT_STAGE_COUNT
+};
+
+class LatencyTrace {
+public:
+    LatencyTrace();
+
+    // Without a swapped second framebuffer, pixels are on glass once flushed
+    void setVsyncStage(bool enabled) { vsyncStage = enabled; }
+
+    // my_touchpad_read(): remember when the touch state last changed;
+    // atUs is when it was sampled (0 = now)
+    void noteTouch(bool pressed, int64_t atUs = 0);
+
+    // onCardClicked(): close any open trace and start a new one
+    void begin();
+
+    // Stamp a stage of the open trace (ISR safe). A non-zero id only stamps
+    // if it is still the open trace.
+    void mark(LatencyStage stage, uint16_t id = 0);
+
+    // Id of the open trace if it has reached stage, else 0 (so work that
+    // completes later can stamp the trace it belonged to)
+    uint16_t openWith(LatencyStage stage);
+
+    String toJson();
+    void reset();
+
+    static const char* stageName(LatencyStage stage);
+
+    // Since boot, for /metrics
+    const MetricHistogram& getActionHistogram() const { return toAction; }
+    const MetricHistogram& getPhotonHistogram() const { return toPhoton; }
+    const MetricHistogram& getResponseHistogram() const { return toResponse; }
+    uint32_t getTraces() const { return traces; }
+    uint32_t getIncomplete() const { return incomplete; }
+
+    static const uint8_t RING_SIZE = 64;
+    static const uint32_t TRACE_TIMEOUT_US = 4000000;
+
+private:
+    struct Ring {
+        uint32_t samples[RING_SIZE];
+        uint8_t head;
+        uint32_t count;
+    };
+
+    void closeLocked(bool complete);
+    void expireLocked(int64_t now);
+
+    Ring rings[LAT_STAGE_COUNT];
+    int64_t stamps[LAT_STAGE_COUNT];
+    uint32_t last[LAT_STAGE_COUNT];     // Offsets of the last closed trace, 0 = not reached
+    MetricHistogram toAction;
+    MetricHistogram toPhoton;
+    MetricHistogram toResponse;
+    mutable portMUX_TYPE mux;
+    int64_t touchEdgeUs;
+    bool touchPressed;
+    bool vsyncStage;
+    volatile uint16_t openId;
+    uint16_t nextId;
+    uint32_t traces;
+    uint32_t incomplete;
+};
+
+// Global instance
+extern LatencyTrace latencyTrace;
+
+#endif // LATENCY_TRACE_H
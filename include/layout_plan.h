@@ -0,0 +1,62 @@
+#ifndef LAYOUT_PLAN_H
+#define LAYOUT_PLAN_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "config_manager.h"
+
+// Cards on one page; buttons past it go on further pages, and only the
+// shown page's cards exist as LVGL objects
+#define MAX_PAGE_CARDS 12
+
+// Which card design a theme builds (see ThemeStyle::isLCARS/isCyberpunk)
+enum class LayoutFamily : uint8_t {
+    STANDARD,
+    CYBERPUNK,
+    LCARS
+};
+
+// Arrangement of the widgets inside a card; cards are only re-bound from
+// the pool to slots of the same shape
+enum CardShape : uint8_t {
+    CARD_SHAPE_REGULAR = 0,     // Icon and toggle on top, name below (LCARS: tall)
+    CARD_SHAPE_COMPACT,         // Dense grids: smaller toggle, wrapped name, no status text (LCARS: short)
+    CARD_SHAPE_ROW              // List rows: icon, name and toggle on one line
+};
+
+struct CardRect {
+    int16_t x, y, w, h;
+};
+
+// Where every button card goes and how it is drawn, for one combination of
+// button count, scene count, card design and CardLayout. Planned once when
+// one of those changes; building the UI only reads it. Every page uses the
+// same slots: button i goes in cards[i % perPage] on page i / perPage.
+struct LayoutPlan {
+    // What it was planned for
+    bool valid;
+    uint8_t buttons;
+    uint8_t scenes;
+    LayoutFamily family;
+    CardLayout mode;
+
+    uint8_t perPage;
+    uint8_t pages;
+    uint8_t cols;
+    uint8_t rows;
+    CardShape shape;
+    const lv_font_t* iconFont;      // Symbol icons
+    int16_t gap;                    // Between neighbouring cards
+    int16_t statusY;                // LCARS: top of the status block below the cards
+    int16_t pagerX, pagerY;         // Center of the page indicator (pages > 1)
+    CardRect cards[MAX_PAGE_CARDS];
+
+    // Re-plan if any input differs; true if it did
+    bool update(uint8_t buttons, uint8_t scenes, LayoutFamily family, CardLayout mode);
+
+    // Buttons on one page, and the pages n buttons take, for a card design
+    static uint8_t pageCapacity(LayoutFamily family);
+    static uint8_t pageCount(uint8_t buttons, LayoutFamily family);
+};
+
+#endif // LAYOUT_PLAN_H
@@ -1,651 +1,42 @@
+// Generated by scripts/make_packed_image.py from assets/lcars_elbow.png
+// 100x100, 2 colors, 244 bytes of runs (20000 unpacked)
+
 #ifndef LCARS_ELBOW_H
 #define LCARS_ELBOW_H
 
-#include <lvgl.h>
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
+#include "packed_image.h"
 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t lcars_elbow_map[] = {
+static const uint16_t lcars_elbow_palette[] = {
+    0xCB20, 0x0000,
+};
 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
-    0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 0x20, 0xCB, 
+static const uint8_t lcars_elbow_runs[] = {
+    0x00, 0x31, 0x01, 0x31, 0x00, 0x31, 0x01, 0x31, 0x00, 0x31, 0x01, 0x31, 0x00, 0x31, 0x01, 0x31,
+    0x00, 0x31, 0x01, 0x31, 0x00, 0x31, 0x01, 0x31, 0x00, 0x31, 0x01, 0x31, 0x00, 0x31, 0x01, 0x31,
+    0x00, 0x32, 0x01, 0x30, 0x00, 0x32, 0x01, 0x30, 0x00, 0x32, 0x01, 0x30, 0x00, 0x32, 0x01, 0x30,
+    0x00, 0x32, 0x01, 0x30, 0x00, 0x33, 0x01, 0x2F, 0x00, 0x33, 0x01, 0x2F, 0x00, 0x33, 0x01, 0x2F,
+    0x00, 0x34, 0x01, 0x2E, 0x00, 0x34, 0x01, 0x2E, 0x00, 0x34, 0x01, 0x2E, 0x00, 0x35, 0x01, 0x2D,
+    0x00, 0x35, 0x01, 0x2D, 0x00, 0x36, 0x01, 0x2C, 0x00, 0x36, 0x01, 0x2C, 0x00, 0x37, 0x01, 0x2B,
+    0x00, 0x37, 0x01, 0x2B, 0x00, 0x38, 0x01, 0x2A, 0x00, 0x38, 0x01, 0x2A, 0x00, 0x39, 0x01, 0x29,
+    0x00, 0x3A, 0x01, 0x28, 0x00, 0x3A, 0x01, 0x28, 0x00, 0x3B, 0x01, 0x27, 0x00, 0x3C, 0x01, 0x26,
+    0x00, 0x3D, 0x01, 0x25, 0x00, 0x3D, 0x01, 0x25, 0x00, 0x3E, 0x01, 0x24, 0x00, 0x3F, 0x01, 0x23,
+    0x00, 0x40, 0x01, 0x22, 0x00, 0x41, 0x01, 0x21, 0x00, 0x42, 0x01, 0x20, 0x00, 0x44, 0x01, 0x1E,
+    0x00, 0x45, 0x01, 0x1D, 0x00, 0x46, 0x01, 0x1C, 0x00, 0x48, 0x01, 0x1A, 0x00, 0x49, 0x01, 0x19,
+    0x00, 0x4B, 0x01, 0x17, 0x00, 0x4D, 0x01, 0x15, 0x00, 0x4F, 0x01, 0x13, 0x00, 0x51, 0x01, 0x11,
+    0x00, 0x54, 0x01, 0x0E, 0x00, 0x57, 0x01, 0x0B, 0x00, 0x5C, 0x01, 0x06, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0x23,
 };
 
-const lv_img_dsc_t lcars_elbow_img = {
-    .header = {
-        .cf = LV_IMG_CF_TRUE_COLOR,
-        .always_zero = 0,
-        .reserved = 0,
-        .w = 100,
-        .h = 100,
-    },
-    .data_size = 20000,
-    .data = lcars_elbow_map,
+static const PackedImage lcars_elbow_img = {
+    100, 100,
+    2,
+    false,
+    lcars_elbow_palette,
+    nullptr,
+    lcars_elbow_runs,
+    sizeof(lcars_elbow_runs),
 };
 
 #endif // LCARS_ELBOW_H
@@ -8,9 +8,24 @@
 #define LV_COLOR_DEPTH 16
 #define LV_COLOR_16_SWAP 0
 
-/* Memory settings */
+/* Memory settings
+ * By default LVGL allocates through lvgl_mem.h: internal SRAM for small
+ * objects (within a budget), a PSRAM arena for large buffers.
+ * Build with -DLVGL_MEM_BUILTIN=1 to use LVGL's fixed internal pool instead. */
+#ifndef LVGL_MEM_BUILTIN
+#define LVGL_MEM_BUILTIN 0
+#endif
+
+#if LVGL_MEM_BUILTIN
 #define LV_MEM_CUSTOM 0
 #define LV_MEM_SIZE (128U * 1024U)
+#else
+#define LV_MEM_CUSTOM 1
+#define LV_MEM_CUSTOM_INCLUDE "lvgl_mem.h"
+#define LV_MEM_CUSTOM_ALLOC lvgl_mem_alloc
+#define LV_MEM_CUSTOM_FREE lvgl_mem_free
+#define LV_MEM_CUSTOM_REALLOC lvgl_mem_realloc
+#endif
 
 /* Display settings */
 #define LV_HOR_RES_MAX 480
@@ -26,23 +41,68 @@
 
 /* Drawing */
 #define LV_DISP_DEF_REFR_PERIOD 30
+
+/* Shadow corner cache: reuses the blurred corner mask while consecutive
+ * objects share shadow_width + radius (all cards of a theme do, and glow
+ * toggles only change spread/colour). Must be >= the largest card/action bar
+ * shadow_width + radius across themes (dark_mode cards: 20 + 16, action bar:
+ * 15 + 30). Costs LV_SHADOW_CACHE_SIZE^2 bytes. */
+#define LV_SHADOW_CACHE_SIZE 48
+
+/* Image cache: decoder descriptors kept open between draws, so a hit skips
+ * reopening the image. Slots are allocated through lvgl_mem.h (the PSRAM
+ * arena once they outgrow LVGL_MEM_SMALL_MAX). Hit rates per image at
+ * /api/diag/img_cache, which can also resize it to try other sizes; 0
+ * compiles the cache out. */
+#ifndef PANEL_IMG_CACHE_SIZE
+#define PANEL_IMG_CACHE_SIZE 16
+#endif
+#define LV_IMG_CACHE_DEF_SIZE PANEL_IMG_CACHE_SIZE
+
+/* Cached radius masks - cards (4/16/20), action bar (30), pills and circles */
+#define LV_CIRCLE_CACHE_SIZE 8
 #define LV_USE_GPU_STM32_DMA2D 0
 
 /* Themes */
 #define LV_USE_THEME_DEFAULT 1
 #define LV_USE_THEME_BASIC 1
 
-/* Fonts - enable commonly used sizes */
-#define LV_FONT_MONTSERRAT_12 1
-#define LV_FONT_MONTSERRAT_14 1
-#define LV_FONT_MONTSERRAT_16 1
-#define LV_FONT_MONTSERRAT_20 1
-#define LV_FONT_MONTSERRAT_24 1
-#define LV_FONT_MONTSERRAT_28 1
-#define LV_FONT_MONTSERRAT_32 1
-#define LV_FONT_MONTSERRAT_48 1
+/* Fonts - the sizes the UI uses. scripts/make_fonts.py can generate ASCII +
+ * used-symbol subsets of them under the same names (src/fonts/); when its
+ * header is present LVGL's full fonts are left out and those declared */
+#if defined(__has_include)
+#if __has_include("panel_fonts_subset.h")
+#include "panel_fonts_subset.h"
+#endif
+#endif
+#ifndef PANEL_FONTS_SUBSET
+#define PANEL_FONTS_SUBSET 0
+#define PANEL_FONTS_LATIN1 1
+#define PANEL_FONTS_COMPRESSED 0
+#endif
+
+#define LV_FONT_MONTSERRAT_12 !PANEL_FONTS_SUBSET
+#define LV_FONT_MONTSERRAT_14 !PANEL_FONTS_SUBSET
+#define LV_FONT_MONTSERRAT_16 !PANEL_FONTS_SUBSET
+#define LV_FONT_MONTSERRAT_20 !PANEL_FONTS_SUBSET
+#define LV_FONT_MONTSERRAT_24 !PANEL_FONTS_SUBSET
+#define LV_FONT_MONTSERRAT_28 !PANEL_FONTS_SUBSET
+#if PANEL_FONTS_SUBSET
+#define LV_FONT_CUSTOM_DECLARE \
+    LV_FONT_DECLARE(lv_font_montserrat_12) LV_FONT_DECLARE(lv_font_montserrat_14) \
+    LV_FONT_DECLARE(lv_font_montserrat_16) LV_FONT_DECLARE(lv_font_montserrat_20) \
+    LV_FONT_DECLARE(lv_font_montserrat_24) LV_FONT_DECLARE(lv_font_montserrat_28)
+#endif
+#define LV_USE_FONT_COMPRESSED PANEL_FONTS_COMPRESSED
 #define LV_FONT_DEFAULT &lv_font_montserrat_16
 
+/* Hot render path in IRAM (PANEL_FAST_RENDER, env:esp32s3-perf): LVGL tags
+ * its blend, fill and memcpy loops LV_ATTRIBUTE_FAST_MEM */
+#if PANEL_FAST_RENDER
+#include "esp_attr.h"
+#define LV_ATTRIBUTE_FAST_MEM IRAM_ATTR
+#endif
+
 /* Text settings */
 #define LV_TXT_ENC LV_TXT_ENC_UTF8
 
@@ -63,6 +123,7 @@
 #define LV_USE_TEXTAREA 1
 #define LV_USE_TABLE 1
 #define LV_USE_SPINNER 1
+#define LV_USE_CHART 1      /* Sensor cards' history */
 
 /* Layout */
 #define LV_USE_ANIMATION 1
@@ -0,0 +1,59 @@
+#ifndef LVGL_MEM_H
+#define LVGL_MEM_H
+
+// LVGL allocator backend (wired in through LV_MEM_CUSTOM in lv_conf.h).
+// Small, hot allocations (objects, styles) come from internal SRAM up to a
+// fixed budget; larger ones (label text, draw/image buffers) and anything
+// over budget come from a PSRAM arena sized at boot from the PSRAM size.
+// This header is included from LVGL's C sources, so keep it C compatible.
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Allocations up to this size prefer internal SRAM
+#ifndef LVGL_MEM_SMALL_MAX
+#define LVGL_MEM_SMALL_MAX 1024
+#endif
+
+// Ceiling for LVGL's share of internal SRAM (the rest is left to WiFi/AsyncTCP)
+#ifndef LVGL_MEM_INTERNAL_BUDGET
+#define LVGL_MEM_INTERNAL_BUDGET (96U * 1024U)
+#endif
+
+// PSRAM arena: 1/LVGL_MEM_PSRAM_DIVISOR of the PSRAM, capped at LVGL_MEM_PSRAM_MAX
+#ifndef LVGL_MEM_PSRAM_DIVISOR
+#define LVGL_MEM_PSRAM_DIVISOR 8
+#endif
+#ifndef LVGL_MEM_PSRAM_MAX
+#define LVGL_MEM_PSRAM_MAX (2U * 1024U * 1024U)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    size_t internalUsed;        // Bytes currently held in internal SRAM
+    size_t internalPeak;
+    size_t psramArenaSize;      // 0 if no PSRAM arena
+    size_t psramUsed;
+    size_t psramPeak;
+    size_t psramLargestFree;    // Largest block still available in the arena
+    uint32_t allocCount;        // Live allocations
+    uint32_t failures;          // Requests that could not be satisfied
+} lvgl_mem_stats_t;
+
+// Create the PSRAM arena (call before lv_init(); done lazily otherwise)
+void lvgl_mem_init(void);
+
+void* lvgl_mem_alloc(size_t size);
+void lvgl_mem_free(void* ptr);
+void* lvgl_mem_realloc(void* ptr, size_t size);
+
+void lvgl_mem_get_stats(lvgl_mem_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LVGL_MEM_H
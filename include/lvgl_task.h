@@ -0,0 +1,108 @@
+#ifndef LVGL_TASK_H
+#define LVGL_TASK_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+// Starts/stops the panel's pixel clock and scanout DMA; false if unsupported
+typedef bool (*ScanoutControlFn)(bool enabled);
+
+// Frames the panel has scanned out so far, and a one-shot wake of task at
+// the next frame done
+typedef uint32_t (*FrameCountFn)();
+typedef void (*FrameNotifyFn)(TaskHandle_t task);
+
+// Runs lv_timer_handler() in its own pinned FreeRTOS task so blocking work in
+// loop() (HTTP, NTP) can't stall rendering or touch. Any code outside that
+// task must hold the lock while touching LVGL objects.
+class LVGLTask {
+public:
+    LVGLTask();
+
+    // Create the lock and start the render task (call once the UI exists)
+    void begin();
+
+    // Take/release the LVGL lock (recursive, safe to nest)
+    bool lock(uint32_t timeoutMs = UINT32_MAX);
+    void unlock();
+
+    bool isRunning() const { return taskHandle != nullptr; }
+
+    // Wake the task early (e.g. a UI command was queued)
+    void wake();
+
+    // Dynamic frequency scaling while the display sits at a dim scheduled level
+    void setPowerSave(bool enabled);
+
+    // Any task: the backlight is fully off (or lit again). While dark the
+    // task stops rendering, scanout and most of the CPU clock, but still
+    // applies UI commands, so lighting up shows the current state within a
+    // single frame.
+    void setDarkIdle(bool dark);
+    bool isDarkIdle() const { return darkActive; }
+
+    // Any task: a firmware update is running. Only lv_timer_handler() runs,
+    // every UPDATE_FRAME_MS, so the OTA screen's progress bar is the one
+    // thing redrawn while flash and TCP want the CPU and PSRAM
+    void setUpdateMode(bool enabled);
+    bool isUpdateMode() const { return updateMode; }
+
+    // Hook for the display driver, used on dark idle transitions
+    void setScanoutControl(ScanoutControlFn fn) { scanoutControl = fn; }
+
+    // Setup, before begin(): refresh in step with scanout. LVGL's refresh
+    // and animation timers are made due at each frame done instead of
+    // running on their own 30 ms period, and a held touch is read on the
+    // same edge, so a frame is rendered right after the previous one went
+    // up and never twice per scanout. While nothing is drawing the task
+    // sleeps as before; PACED_FALLBACK_MS covers a frame done that never
+    // comes (scanout stopped).
+    void setFramePacing(FrameCountFn count, FrameNotifyFn notify);
+    bool isFramePaced() const { return frameCount != nullptr; }
+
+private:
+    static void taskMain(void* parameter);
+    void applyDarkIdle(bool dark);    // Render task only
+    void applyPowerConfig();
+
+    SemaphoreHandle_t mutex;
+    TaskHandle_t taskHandle;
+    unsigned long lastTick;
+    bool powerSave;
+    volatile bool darkRequested;
+    bool darkActive;
+    bool scanoutStopped;
+    volatile bool updateMode;
+    ScanoutControlFn scanoutControl;
+    FrameCountFn frameCount;
+    FrameNotifyFn frameNotify;
+    uint32_t lastFrame;         // Frame count the last paced pass saw
+
+    static const uint32_t TASK_STACK_SIZE = 8192;
+    static const UBaseType_t TASK_PRIORITY = 2;   // Above loop() (1)
+    static const BaseType_t TASK_CORE = 1;        // Leave core 0 for WiFi
+    static const uint32_t MIN_IDLE_MS = 1;
+    static const uint32_t MAX_IDLE_MS = 50;        // Upper bound between frames when static
+    static const uint32_t DARK_IDLE_MS = 1000;     // Only commands and ticks to keep up with
+    static const uint32_t UPDATE_FRAME_MS = 250;   // Progress refresh during a firmware update
+    static const uint32_t PACED_FALLBACK_MS = 100; // Refresh/animation period when paced
+    static const int POWER_SAVE_MIN_MHZ = 80;
+    static const int DARK_IDLE_MIN_MHZ = 40;       // XTAL, once scanout no longer needs the APB
+    static const int MAX_CPU_MHZ = 240;
+};
+
+// Scoped LVGL lock for web/server callbacks
+class LVGLLock {
+public:
+    LVGLLock();
+    ~LVGLLock();
+private:
+    bool locked;
+};
+
+// Global instance
+extern LVGLTask lvglTask;
+
+#endif // LVGL_TASK_H
@@ -3,10 +3,22 @@
 
 #include <Arduino.h>
 
+// mDNS responder and the _esp32display._tcp service.
+//
+// Besides the device's identity, the TXT record carries what a server needs
+// to tell whether its picture of the panel is current without asking over
+// HTTP: the firmware build (fw), a random id drawn at boot (boot, changes on
+// every restart), the config generation (cfg) and the state version last
+// applied (state). A job compares them every TXT_REFRESH_MS and rewrites
+// only the keys that changed; the responder announces the new record, so
+// browsers see it without re-querying.
 class MDNSService {
 public:
     MDNSService();
 
+    // Register the TXT refresh job (setup only)
+    void addJobs();
+
     // Initialize mDNS with device hostname
     bool begin(const String& hostname);
 
@@ -25,9 +37,30 @@ public:
     // Get the full mDNS hostname (hostname.local)
     String getFullHostname() const;
 
+    // Per-boot id advertised as TXT "boot"
+    const char* getBootId() const { return bootId; }
+
+    // Build identifier advertised as TXT "fw"
+    static const char* getFirmwareVersion();
+
+    static const uint32_t TXT_REFRESH_MS = 2000;
+
 private:
+    // Scheduler job: rewrite TXT keys whose values changed
+    static void onTxtTimer(void* arg);
+
+    void updateTxt(bool force);
+
     bool running;
+    volatile bool advertised;
     String hostname;
+    int8_t txtJob;
+    char bootId[9];
+
+    // Values last written to the TXT record
+    String txtName;
+    uint32_t txtConfig;
+    uint32_t txtState;
 
     // Service type for discovery
     static const char* SERVICE_TYPE;
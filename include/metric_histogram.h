@@ -0,0 +1,42 @@
+#ifndef METRIC_HISTOGRAM_H
+#define METRIC_HISTOGRAM_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+class Print;
+
+// Cumulative histogram for /metrics (see metrics_exporter.h): counts per
+// upper bound since boot, plus the sum, the shape Prometheus scrapes and
+// computes rates and quantiles over. Observing is a few compares and adds
+// under a spinlock, cheap enough for the render path.
+//
+// bounds are in the recorded unit, ascending, and must outlive the
+// histogram; values above the last land in the +Inf bucket.
+class MetricHistogram {
+public:
+    MetricHistogram(const uint32_t* bounds, uint8_t boundCount);
+
+    void observe(uint32_t value);
+
+    // The histogram in the text exposition format. scale converts the
+    // recorded unit to the exported one (1e-6 for microseconds as seconds).
+    void write(Print& out, const char* name, const char* help, double scale) const;
+
+    static const uint8_t MAX_BOUNDS = 12;
+
+private:
+    const uint32_t* bounds;
+    uint8_t boundCount;
+    uint32_t buckets[MAX_BOUNDS + 1];   // Not cumulative; the last is +Inf
+    uint64_t sum;
+    mutable portMUX_TYPE mux;
+};
+
+// Bounds shared by the firmware's histograms, in microseconds
+extern const uint32_t FRAME_BOUNDS_US[];        // 1 ms .. 128 ms
+extern const uint8_t FRAME_BOUND_COUNT;
+extern const uint32_t LATENCY_BOUNDS_US[];      // 10 ms .. 5 s
+extern const uint8_t LATENCY_BOUND_COUNT;
+
+#endif // METRIC_HISTOGRAM_H
@@ -0,0 +1,19 @@
+#ifndef METRICS_EXPORTER_H
+#define METRICS_EXPORTER_H
+
+#include <Arduino.h>
+
+class Print;
+
+// The panel's counters and gauges in the Prometheus text exposition
+// format, served at GET /metrics for the fleet's scrapers.
+//
+// Histograms (frame, render and flush time; touch to action, photon and
+// server response; action batch send time) count since boot, so rate() and
+// histogram_quantile() work across scrapes; /api/perf resets don't touch
+// them. Every metric is written straight to the response, one line at a
+// time, with no document or String built first. Names start with panel_,
+// times are seconds and sizes bytes.
+void writeMetrics(Print& out);
+
+#endif // METRICS_EXPORTER_H
@@ -0,0 +1,82 @@
+#ifndef OTA_DELTA_H
+#define OTA_DELTA_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include "stream_inflater.h"
+
+// Binary delta patches for OtaStream.
+//
+// A patch rebuilds a target image from the image in the running slot, so a
+// release that only touched a few modules ships as a small fraction of
+// firmware.bin. The format is bsdiff's, with a zlib body instead of bzip2
+// (the ROM has an inflater):
+//
+//   header (HEADER_SIZE, little-endian, uncompressed)
+//     "ESPD", version, 3 reserved bytes
+//     u32 source size, u32 target size
+//     SHA-256 of the source image, SHA-256 of the target image
+//       (both as the bootloader computes them, without the appended digest)
+//   zlib body: records of
+//     u32 addLen, u32 extraLen, i32 seek
+//     addLen bytes added (mod 256) to the source at the current position
+//     extraLen bytes copied as they are
+//     then the source position moves by seek
+//
+// The add bytes are mostly zeros where code only moved, which is what makes
+// them compress. ota-flash.ts --delta-from old.bin builds patches.
+//
+// Applying needs the inflater's 32 KB window and two small buffers, in
+// PSRAM, whatever the image size. The running slot is only read,
+// so an interrupted patch leaves the panel on its current firmware.
+class OtaDelta {
+public:
+    struct Header {
+        uint32_t sourceSize;
+        uint32_t targetSize;
+        uint8_t sourceSha256[32];
+        uint8_t targetSha256[32];
+    };
+
+    // Receives the rebuilt image in order, in multiples of the flash sector
+    // except for the tail; false stops the patch
+    typedef bool (*SinkFn)(void* ctx, const uint8_t* data, size_t len);
+
+    OtaDelta();
+    ~OtaDelta();
+
+    // The first bytes of an upload start a patch rather than an image
+    // (images start with 0xE9)
+    static bool isPatch(const uint8_t* data, size_t len);
+
+    // False with the reason in error if the header is malformed
+    static bool parseHeader(const uint8_t* data, size_t len, Header& out, const char*& error);
+
+    // Rebuild the target from source and the whole patch (header included)
+    // into sink. False with the reason in error.
+    bool apply(const uint8_t* patch, size_t len, const esp_partition_t* source,
+               SinkFn sink, void* ctx, const char*& error);
+
+    static const size_t HEADER_SIZE = 80;
+    static const uint8_t VERSION = 1;
+    static const size_t OUT_CHUNK = 16 * 1024;     // Flushed to the sink when full
+    static const size_t SOURCE_CHUNK = 4096;
+
+private:
+    struct Workspace;
+
+    // Next n bytes of the inflated body; false on a corrupt or short body
+    bool read(uint8_t* dst, size_t n);
+    bool flush();
+
+    Workspace* work;
+    StreamInflater inflater;
+    const uint8_t* in;
+    size_t inLeft;
+
+    SinkFn sink;
+    void* sinkCtx;
+    size_t outFill;
+};
+
+#endif // OTA_DELTA_H
@@ -0,0 +1,133 @@
+#ifndef OTA_STREAM_H
+#define OTA_STREAM_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <MD5Builder.h>
+
+class Print;
+
+// Streaming firmware update, the fast path next to ElegantOTA's /update.
+//
+// ElegantOTA writes each TCP segment to flash from the AsyncTCP task, so
+// every 4 KB sector erase stops the receive path and the TCP window closes
+// behind it. Here the body (POST /api/ota, raw bytes) is only copied into a
+// PSRAM staging buffer the size of the image; a writer task pinned away from
+// the TCP stack erases the whole OTA partition up front with block erases
+// while the upload is still arriving, then writes the staged image in
+// WRITE_CHUNK pieces, all multiples of the 4 KB flash sector. The receive
+// path never waits on flash.
+//
+// The body may also be a delta patch against the running image (see
+// ota_delta.h), told apart by its first bytes. A patch is staged whole and
+// then applied into the erased slot through the same writer; the rebuilt
+// image must match the patch's target hash on top of the usual checks.
+//
+// A gzip-compressed image (about 60% of the raw size) is decompressed
+// through the same writer while it is still arriving, so the upload shrinks
+// without giving up the overlap. The client passes the uncompressed size,
+// since the partition is erased before the gzip trailer arrives.
+//
+// While an update runs the UI shows only the OTA screen, the render task
+// drops to a progress refresh every few hundred ms, and WiFi power save is
+// held off, since modem sleep between beacons is what throttles a long
+// inbound transfer.
+class OtaStream {
+public:
+    enum class State : uint8_t { IDLE, RECEIVING, WRITING, DONE, FAILED };
+
+    OtaStream();
+
+    // AsyncTCP task, first body chunk: stage an upload of size bytes.
+    // imageSize is the flashed image's size, required for gzip uploads and
+    // 0 if not given. The flashed image's MD5 (32 hex digits) must match
+    // md5, or nullptr to skip the check.
+    // False with the reason in error (nothing started) when refused, and in
+    // status the HTTP code to answer with: 409 busy, 400 bad parameters,
+    // 507 no PSRAM to stage the image (the client falls back to /update),
+    // 500 no OTA partition or no writer task.
+    bool begin(size_t size, size_t imageSize, const char* md5, const char*& error, int& status);
+
+    // AsyncTCP task: the next body chunk, in order
+    void feed(const uint8_t* data, size_t len);
+
+    // The upload connection went away before the image was complete
+    void abortUpload();
+
+    bool isBusy() const { return state == State::RECEIVING || state == State::WRITING; }
+    State getState() const { return state; }
+    const char* stateName() const;
+
+    // Progress, timings and the last error
+    void writeJson(Print& out) const;
+
+    // SHA-256 of the running image as the bootloader computes it, which is
+    // what a patch names as its source (hashed on first use)
+    const uint8_t* runningSha256();
+
+    // OTA screen, slow render pass and no WiFi power save; ElegantOTA
+    // uploads go through these too
+    static void enterUpdateMode();
+    static void leaveUpdateMode();
+
+    static const size_t WRITE_CHUNK = 64 * 1024;       // 16 flash sectors per esp_ota_write
+    static const uint32_t STALL_TIMEOUT_MS = 15000;    // No new data for this long: give up
+    static const uint32_t REBOOT_DELAY_MS = 500;        // Lets the status poll see DONE
+
+private:
+    static void writerTask(void* parameter);
+    void run();
+    void runImage();
+    void runPatch();
+    void runCompressed();
+    // nullptr once received reaches bytes, else why it never will
+    const char* waitFor(size_t bytes);
+
+    bool beginFlash(size_t imageSize);
+    bool writeFlash(const uint8_t* data, size_t len);
+    bool endFlash(const uint8_t* expectedSha256);
+    static bool onPatchOutput(void* ctx, const uint8_t* data, size_t len);
+
+    void fail(const char* reason);
+    void releaseStaging(State outcome);
+    void reportProgress(size_t written);
+    void finish();
+
+    // Guards staging against the writer freeing it under feed()
+    portMUX_TYPE mux;
+    volatile State state;
+    const char* error;
+
+    uint8_t* staging;
+    size_t size;
+    volatile size_t received;
+    size_t written;
+    char expectedMd5[33];
+    volatile bool aborted;
+    TaskHandle_t writer;
+
+    unsigned long startedAt;
+    uint32_t eraseMs;
+    uint32_t receiveMs;
+    uint32_t totalMs;
+    int lastPercent;
+
+    size_t targetSize;          // Image being flashed: the upload, or what it decodes to
+    size_t declaredImageSize;   // ?size=, 0 if not given
+    const char* format;         // "image", "delta" or "gzip"
+    uint32_t otaHandle;
+    MD5Builder md5;
+
+    uint8_t runningHash[32];
+    bool runningHashed;
+
+    static const uint32_t WRITER_STACK_SIZE = 6144;
+    static const UBaseType_t WRITER_PRIORITY = 1;
+    static const BaseType_t WRITER_CORE = 1;            // Core 0 runs WiFi and lwIP
+};
+
+// Global instance
+extern OtaStream otaStream;
+
+#endif // OTA_STREAM_H
@@ -0,0 +1,79 @@
+#ifndef PACKED_IMAGE_H
+#define PACKED_IMAGE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+class Print;
+
+// Palette-indexed, run-length encoded images for large flat-colored
+// decoration (the LCARS elbow), generated by scripts/make_packed_image.py.
+//
+// LVGL's own INDEXED formats are decoded a line at a time on every draw.
+// These are instead unpacked once into a TRUE_COLOR (or TRUE_COLOR_ALPHA)
+// buffer in PSRAM when a layout first shows them, which LVGL then blits
+// like any other image, and kept while something on screen uses them.
+// The flash copy is a few hundred bytes where the raw RGB565 was 20 KB.
+//
+// runs is a sequence of (palette index, run length - 1) byte pairs in
+// row-major order; runs cross row ends.
+struct PackedImage {
+    uint16_t width;
+    uint16_t height;
+    uint16_t paletteSize;
+    bool hasAlpha;                  // palette alpha is used (TRUE_COLOR_ALPHA)
+    const uint16_t* palette;        // RGB565, lv_color_t.full
+    const uint8_t* alpha;           // Per palette entry, nullptr if !hasAlpha
+    const uint8_t* runs;
+    uint32_t runsSize;
+};
+
+// Unpacked copies, refcounted by the objects showing them.
+// LVGL task only.
+class PackedImageCache {
+public:
+    PackedImageCache();
+
+    // Show image on img, unpacking it if nothing holds a copy. The object
+    // keeps a reference until it is deleted. Returns false (and leaves img
+    // empty) if there is no memory or the image is malformed.
+    bool show(lv_obj_t* img, const PackedImage& image);
+
+    // The unpacked copy of image, for an object that draws it itself
+    // (lv_draw_img() from its draw events); owner keeps a reference until
+    // it is deleted. nullptr if there is no memory or the image is malformed.
+    const lv_img_dsc_t* acquire(lv_obj_t* owner, const PackedImage& image);
+
+    // Free every copy no object shows (theme change)
+    void trim();
+
+    // Copies, bytes held and unpack counters
+    void writeJson(Print& out) const;
+
+    static const uint8_t MAX_ENTRIES = 8;
+
+private:
+    struct Entry {
+        lv_img_dsc_t dsc;           // What image objects point at; data is nullptr when free
+        const PackedImage* image;
+        uint16_t refs;
+        bool inPsram;
+    };
+
+    Entry* find(const void* src);
+    Entry* load(const PackedImage& image);     // Unpacking it if needed
+    bool unpack(const PackedImage& image, Entry& entry);
+    void drop(Entry& entry);
+    static void onImageDeleted(lv_event_t* e);
+    static void onOwnerDeleted(lv_event_t* e);
+
+    Entry entries[MAX_ENTRIES];
+    size_t bytes;
+    uint32_t unpacks;
+    uint32_t failures;
+};
+
+// Global instance
+extern PackedImageCache packedImages;
+
+#endif // PACKED_IMAGE_H
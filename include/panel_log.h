@@ -0,0 +1,95 @@
+#ifndef PANEL_LOG_H
+#define PANEL_LOG_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+
+class Print;
+
+// Leveled log output that never waits on the UART.
+//
+// Serial.printf at 115200 baud blocks its caller once the TX FIFO fills
+// (about 11 bytes a millisecond drain), so a UI rebuild or config push that
+// logs as it goes spends much of its time waiting on the wire. LOG_E..LOG_D
+// format the line into a slot of a bounded lock-free ring and return: any
+// task may log, a compare-and-swap claims the slot, and a full ring drops
+// the line (counted) rather than stall. The LogDrain task, just above idle,
+// writes the lines to Serial and into a history served at GET /api/logs,
+// which a client can poll with ?since=<seq> to follow the log over the
+// network.
+//
+// Lines above PANEL_LOG_LEVEL (a build flag; default info) compile away,
+// arguments and all. Until begin(), and on the host build, lines go straight
+// to Serial. The format takes no trailing newline; lines are cut at
+// LINE_SIZE - 1 bytes.
+#define PANEL_LOG_NONE 0
+#define PANEL_LOG_ERROR 1
+#define PANEL_LOG_WARN 2
+#define PANEL_LOG_INFO 3
+#define PANEL_LOG_DEBUG 4
+
+#ifndef PANEL_LOG_LEVEL
+#define PANEL_LOG_LEVEL PANEL_LOG_INFO
+#endif
+
+#define PANEL_LOG_AT(level, fmt, ...) \
+    do { if ((level) <= PANEL_LOG_LEVEL) panelLog.write((level), fmt, ##__VA_ARGS__); } while (0)
+
+#define LOG_E(fmt, ...) PANEL_LOG_AT(PANEL_LOG_ERROR, fmt, ##__VA_ARGS__)
+#define LOG_W(fmt, ...) PANEL_LOG_AT(PANEL_LOG_WARN, fmt, ##__VA_ARGS__)
+#define LOG_I(fmt, ...) PANEL_LOG_AT(PANEL_LOG_INFO, fmt, ##__VA_ARGS__)
+#define LOG_D(fmt, ...) PANEL_LOG_AT(PANEL_LOG_DEBUG, fmt, ##__VA_ARGS__)
+
+class PanelLog {
+public:
+    PanelLog();
+
+    // Allocate the ring and history and start the drain task
+    void begin();
+
+    // Format a line at level (PANEL_LOG_*) and queue it; use the macros
+    void write(uint8_t level, const char* fmt, ...) __attribute__((format(printf, 3, 4)));
+
+    // History lines after since (0: all still kept) as JSON, with the seq
+    // to ask from next time and how many lines the ring has dropped
+    void writeJson(Print& out, uint32_t since) const;
+
+    static const size_t LINE_SIZE = 160;
+    static const uint32_t RING_SLOTS = 64;          // Power of two
+    static const uint16_t HISTORY_LINES = 256;
+    static const unsigned long DRAIN_IDLE_MS = 20;  // Drain task sleep when the ring is empty
+
+private:
+    struct Line {
+        uint32_t seq;           // History: line number since boot (from 1)
+        uint32_t ms;
+        uint8_t level;
+        char text[LINE_SIZE];
+    };
+
+    static void drainTask(void* arg);
+    bool drainOne();
+    void emit(const Line& line);
+
+    // Ring: Vyukov's bounded queue. A slot's sequence is its position when
+    // free and position + 1 once written. The sequences stay in internal
+    // RAM (atomics don't work on PSRAM), the lines may go to PSRAM.
+    std::atomic<uint32_t> slotSeq[RING_SLOTS];
+    Line* slots;
+    std::atomic<uint32_t> enqueuePos;
+    uint32_t dequeuePos;                // Drain task only
+    std::atomic<uint32_t> dropped;
+    uint32_t droppedReported;           // Drain task only
+
+    Line* history;
+    uint32_t lastSeq;
+    mutable portMUX_TYPE mux;           // Guards history and lastSeq
+    TaskHandle_t drainHandle;
+};
+
+// Global instance
+extern PanelLog panelLog;
+
+#endif // PANEL_LOG_H
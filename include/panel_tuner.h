@@ -0,0 +1,137 @@
+#ifndef PANEL_TUNER_H
+#define PANEL_TUNER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+class Print;
+
+// RGB panel timing: pixel clock, active area and porches, in pixel clocks
+// (horizontal) and lines (vertical)
+struct PanelTiming {
+    uint32_t pclkHz;
+    uint16_t width;
+    uint16_t height;
+    uint16_t hsyncPulse;
+    uint16_t hsyncBack;
+    uint16_t hsyncFront;
+    uint16_t vsyncPulse;
+    uint16_t vsyncBack;
+    uint16_t vsyncFront;
+};
+
+// Scanout counters from the panel driver's frame done interrupt
+struct ScanoutHealth {
+    uint32_t frames;
+    uint32_t underruns;         // Frames the DMA FIFO ran dry in
+    uint32_t late;              // Frames off schedule by half a period or more
+};
+
+// Apply timing to the running panel, setting pclkHz to the clock it got;
+// false if the driver can't retime (bounce buffers)
+typedef bool (*PanelRetimeFn)(PanelTiming& timing);
+typedef ScanoutHealth (*ScanoutHealthFn)();
+
+// Finds the fastest pixel clock this panel scans out cleanly at, and keeps
+// it in NVS. Started with POST /api/display/calibrate, progress and results
+// at GET, DELETE goes back to the build's timing.
+//
+// The build's PCLK and porches are picked to be safe on any board; how much
+// faster one runs depends on its PSRAM and the load on it. A calibration
+// run loads PSRAM from both cores and has LVGL redraw the whole screen
+// while it steps through the clocks the LCD divider reaches between
+// MIN_PCLK_HZ and MAX_PCLK_HZ, each with the build's porches and with a
+// longer horizontal back porch (more time to refill the FIFO at each line).
+// Every candidate scans for DWELL_MS and passes with no underrun and no
+// late frame; the fastest refresh that passed is then held for CONFIRM_MS
+// more before it is saved, else the next fastest is tried. WiFi traffic is
+// not generated: start a screen stream alongside to include it.
+//
+// At boot the saved timing is applied if it was found for the build's own
+// default clock (a build with another render mode keeps its own).
+enum TunerState : uint8_t {
+    TUNER_IDLE = 0,
+    TUNER_RUNNING,
+    TUNER_DONE,
+    TUNER_FAILED
+};
+
+class PanelTuner {
+public:
+    PanelTuner();
+
+    // Setup, once the panel runs: the build's timing, the driver hooks, and
+    // the saved timing applied if there is one
+    void begin(const PanelTiming& defaults, PanelRetimeFn retime, ScanoutHealthFn health);
+
+    // Start a calibration run on its own task; false if one is running,
+    // the driver can't retime, or the screen is dark
+    bool start();
+
+    // Forget the saved timing and go back to the build's
+    bool reset();
+
+    TunerState getState() const { return state; }
+    const PanelTiming& getTiming() const { return current; }
+
+    // Timing in use, live scanout counters, and the last run's results
+    void writeJson(Print& out) const;
+
+    static const uint32_t MIN_PCLK_HZ = 8000000;
+    static const uint32_t MAX_PCLK_HZ = 16000000;
+    static const uint32_t PCLK_SOURCE_HZ = 160000000;   // PLL160M, divided by an integer
+    static const uint16_t WIDE_HSYNC_BACK = 40;         // Added back porch of the second set
+    static const uint32_t SETTLE_MS = 200;
+    static const uint32_t DWELL_MS = 2000;
+    static const uint32_t CONFIRM_MS = 6000;
+    static const uint32_t REDRAW_MS = 20;
+    static const size_t LOAD_BLOCK = 64 * 1024;         // Per load task, copied back and forth
+    static const uint8_t MAX_CANDIDATES = 2 * (PCLK_SOURCE_HZ / MIN_PCLK_HZ - PCLK_SOURCE_HZ / MAX_PCLK_HZ + 1);
+
+private:
+    struct Candidate {
+        PanelTiming timing;
+        uint32_t frames;
+        uint32_t underruns;
+        uint32_t late;
+        bool tested;
+        bool stable;
+    };
+
+    static void tunerTask(void* parameter);
+    static void loadTask(void* parameter);
+    void run();
+    bool apply(PanelTiming& timing);
+    // Scan at timing for ms under load; results into c
+    bool measure(Candidate& c, uint32_t ms);
+    bool startLoad();
+    void stopLoad();
+    void save(const PanelTiming& timing);
+    static uint32_t framePeriodUs(const PanelTiming& t);
+
+    PanelTiming defaults;
+    PanelTiming current;
+    PanelRetimeFn retimeFn;
+    ScanoutHealthFn healthFn;
+    bool saved;                 // current came from NVS or a run
+
+    volatile TunerState state;
+    Candidate candidates[MAX_CANDIDATES];
+    uint8_t candidateCount;
+    uint8_t tested;
+    int8_t chosen;              // Candidate saved by the last run, -1 if none
+    unsigned long startedAt;
+    unsigned long durationMs;
+    const char* error;
+
+    uint8_t* loadBuffer;        // PSRAM, 2 x LOAD_BLOCK per load task
+    volatile bool loadRunning;
+    volatile uint8_t loadTasks; // Still running
+    portMUX_TYPE loadMux;
+};
+
+// Global instance
+extern PanelTuner panelTuner;
+
+#endif // PANEL_TUNER_H
@@ -0,0 +1,103 @@
+#ifndef PEER_MIRROR_H
+#define PEER_MIRROR_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include "config_manager.h"
+
+class Print;
+
+// Mirrors presses between panels over ESP-NOW.
+//
+// Two panels showing the same light otherwise only agree once the server
+// has carried out the press and pushed the new state. With "peerMirror" in
+// the config (the server sends a key), every local button action is also
+// broadcast over ESP-NOW, addressed by binding id like state multicast
+// (state_multicast.h), and panels bound to the same accessory show it
+// within milliseconds. Frames use the multicast datagram layout with magic
+// 'P' 'M', signed with the peer key; seq is per sender and boot (epoch).
+//
+// ESP-NOW shares the STA interface and its channel, so only panels on the
+// same channel hear each other, and in modem sleep (the balanced and low_power
+// WiFi profiles) frames can be missed. Mirroring is only a preview:
+// a mirrored state the server hasn't confirmed within RECONCILE_MS (by a
+// push for that button, changed or not) makes the panel ask for a full
+// push, and a press the server refused is mirrored again as rolled back.
+class PeerMirror {
+public:
+    PeerMirror();
+
+    // Start the check job: ESP-NOW comes up once WiFi is connected and the
+    // config has a key
+    void begin();
+
+    // Any task: queue a local action for the next flush (bound buttons only;
+    // the latest per button wins)
+    void mirror(uint8_t buttonId, bool state, int speedLevel);
+
+    // Any task: broadcast what mirror() queued
+    void flush();
+
+    // Any task: the server sent a state for this button; it's reconciled
+    void noteServerState(uint8_t buttonId);
+
+    // Counters
+    void writeJson(Print& out) const;
+
+    static const unsigned long CHECK_INTERVAL = 5000;
+    static const unsigned long RECONCILE_MS = 8000;
+    static const size_t TAG_SIZE = 8;
+    static const int MAX_PEERS = 8;
+    static const int MAX_BUTTONS_PER_BINDING = 8;
+
+private:
+    static void onCheckTimer(void* arg);
+    void check();
+    bool start(const PeerMirrorConfig& config);
+    void stop();
+
+    // WiFi task
+    static void onReceive(const uint8_t* mac, const uint8_t* data, int len);
+    void handleFrame(const uint8_t* mac, const uint8_t* data, size_t len);
+    bool verify(const uint8_t* data, size_t len) const;
+    bool isNewFromPeer(const uint8_t* mac, uint32_t epoch, uint32_t seq);
+
+    struct OutEntry {
+        uint32_t bindingId;
+        uint8_t state;
+        uint8_t speedLevel;
+    };
+    OutEntry outgoing[MAX_BUTTONS];
+    uint8_t outgoingCount;
+    portMUX_TYPE mux;               // outgoing, seq, unreconciled
+
+    struct Peer {
+        uint8_t mac[6];
+        uint32_t epoch;
+        uint32_t seq;
+        unsigned long heard;
+    };
+    Peer peers[MAX_PEERS];          // WiFi task only
+
+    int8_t checkJob;
+    volatile bool running;
+    PeerMirrorConfig active;        // Only changes while not running
+    uint32_t epoch;
+    uint32_t seq;
+
+    // Mirrored in from a peer, not yet heard from the server
+    uint32_t unreconciled[8];
+    unsigned long reconcileDue;
+
+    uint32_t sent;                  // Frames broadcast
+    uint32_t sendErrors;
+    uint32_t received;              // Valid frames
+    uint32_t applied;               // Button changes made
+    uint32_t rejected;              // Malformed, bad tag or repeated
+    uint32_t resyncs;               // Full pushes asked for
+};
+
+// Global instance
+extern PeerMirror peerMirror;
+
+#endif // PEER_MIRROR_H
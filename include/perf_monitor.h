@@ -0,0 +1,94 @@
+#ifndef PERF_MONITOR_H
+#define PERF_MONITOR_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include "metric_histogram.h"
+
+// Lightweight frame timing and loop profiler, served at /api/perf.
+//
+// Each metric keeps its last RING_SIZE samples in a fixed ring buffer;
+// recording is a store under a spinlock, so it is cheap enough for the
+// render path. Percentiles are computed from a copy of the ring only when
+// someone asks for them. Frame, render and flush times also go into
+// cumulative histograms for /metrics, which reset() leaves alone.
+enum PerfMetric : uint8_t {
+    PERF_RENDER_US = 0,     // Refresh time minus flush time, per frame
+    PERF_FLUSH_US,          // Time spent in my_disp_flush(), per frame
+    PERF_INV_AREA_PX,       // Invalidated pixels per frame
+    PERF_TIMER_HANDLER_US,  // lv_timer_handler() duration, per call
+    PERF_LOOP_JITTER_US,    // Lateness of loop() jobs past their deadline
+    PERF_FRAME_US,          // Whole refresh (render + flush), per frame
+    PERF_METRIC_COUNT
+};
+
+struct PerfSummary {
+    uint32_t count;     // Samples recorded since the last reset (may exceed the ring)
+    uint32_t window;    // Samples the percentiles are computed over
+    uint32_t min;
+    uint32_t p50;
+    uint32_t p95;
+    uint32_t p99;
+    uint32_t max;
+    uint32_t avg;
+};
+
+class PerfMonitor {
+public:
+    PerfMonitor();
+
+    void record(PerfMetric metric, uint32_t value);
+
+    // Per-frame flush accounting (render task only): the refresh wrapper
+    // brackets each frame and my_disp_flush() adds to it
+    void beginFrame() { frameFlushUs = 0; }
+    void addFlush(uint32_t us) { frameFlushUs += us; }
+    uint32_t frameFlush() const { return frameFlushUs; }
+
+    // p50/p95/p99 etc. over the current window
+    PerfSummary summarize(PerfMetric metric) const;
+    static const char* metricName(PerfMetric metric);
+
+    // Sorts samples[0..n) in place; count is the lifetime sample count
+    static PerfSummary summarizeSamples(uint32_t* samples, uint32_t n, uint32_t count);
+
+    // Serialize every metric as JSON
+    String toJson() const;
+
+    // Frame time and loop jitter percentiles as one JSON object, for the
+    // pong (the server keeps a history per panel)
+    size_t writeHeartbeat(char* buf, size_t len) const;
+
+    void reset();
+
+    // Histogram for /metrics, nullptr for metrics that don't have one
+    const MetricHistogram* getHistogram(PerfMetric metric) const;
+
+    uint32_t getFrames() const { return frames; }
+    void countFrame() { frames++; }
+
+    static const uint16_t RING_SIZE = 256;
+
+private:
+    struct Ring {
+        uint32_t samples[RING_SIZE];
+        uint16_t head;
+        uint32_t count;
+    };
+
+    MetricHistogram* histogramFor(PerfMetric metric);
+
+    Ring rings[PERF_METRIC_COUNT];
+    MetricHistogram renderTimes;
+    MetricHistogram flushTimes;
+    MetricHistogram frameTimes;
+    mutable portMUX_TYPE mux;
+    uint32_t frameFlushUs;
+    volatile uint32_t frames;
+    unsigned long resetAt;
+};
+
+// Global instance
+extern PerfMonitor perfMonitor;
+
+#endif // PERF_MONITOR_H
@@ -0,0 +1,104 @@
+#ifndef PSRAM_BUDGET_H
+#define PSRAM_BUDGET_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+class Print;
+
+// Plan for the large PSRAM buffers, reported at boot and at /api/diag/psram.
+//
+// The 8 MB PSRAM holds three kinds of buffer:
+//   fixed      panel framebuffers, LVGL draw buffers and LVGL's arena (where
+//              its image and render caches live), and the static build's
+//              pools (static_memory.h), allocated once at boot
+//   transient  OTA and icon pack staging, workspaces: large, rare, must not fail
+//   optional   screenshot captures, the screen stream's frame, overlay
+//              snapshots, tinted icons, unpacked decoration, card
+//              tiles, the animated background, panel calibration load:
+//              nice to have, allocated on demand
+//
+// Optional buffers are refused when they would leave the largest free block
+// under OPTIONAL_HEADROOM, the room an uncompressed OTA image needs, so
+// nothing the panel can live without sits in memory a transient buffer
+// later wants. Clients whose buffers can be dropped without harm (the
+// last captured screenshot) register a reclaimer; a transient or fixed
+// request that doesn't fit, or an optional one short on headroom, calls the
+// reclaimers of lower-priority clients and tries again.
+//
+// Buffers allocated inside libraries (the panel framebuffers) can't be
+// routed through here and are noted with noteExternal() instead.
+enum PsramClient : uint8_t {
+    PSRAM_FRAMEBUFFER = 0,      // Panel framebuffers and LVGL draw buffers
+    PSRAM_LVGL_ARENA,           // lvgl_mem's pool
+    PSRAM_OTA,                  // OtaStream staging, delta and inflate workspaces
+    PSRAM_ICON_PACK,            // IconPack upload staging
+    PSRAM_SCREENSHOT,           // Current capture
+    PSRAM_SCREEN_STREAM,        // Live view frame copy
+    PSRAM_UI_SNAPSHOT,          // Overlay backdrops, theme transition frames
+    PSRAM_ICON_TINT,            // IconTintCache copies
+    PSRAM_PACKED_IMAGE,         // Unpacked decoration images
+    PSRAM_CARD_TILE,            // CardTileCache tiles and their snapshots
+    PSRAM_BACKGROUND,           // Animated background upload and frame cache
+    PSRAM_PANEL_TUNER,          // PanelTuner's PSRAM load buffers, during a calibration
+    PSRAM_STATIC_POOLS,         // StaticMemory's pools (PANEL_STATIC_MEMORY builds)
+    PSRAM_CLIENT_COUNT
+};
+
+enum class PsramPriority : uint8_t { FIXED, TRANSIENT, OPTIONAL };
+
+struct PsramAccount {
+    size_t current;             // Bytes held now
+    size_t peak;
+    uint32_t allocs;
+    uint32_t refused;           // Requests turned down or failed
+    uint32_t reclaimed;         // Times its reclaimer was asked to give memory back
+};
+
+class PsramBudget {
+public:
+    // Frees the client's droppable buffers; true if it let any go
+    typedef bool (*ReclaimFn)();
+
+    PsramBudget();
+
+    // Setup, before the first allocation: note the PSRAM size
+    void begin();
+
+    // A buffer of size bytes for client (aligned if align is non-zero), or
+    // nullptr if the plan has no room for it
+    void* alloc(PsramClient client, size_t size, size_t align = 0);
+
+    // Give back a buffer from alloc() (nullptr is ignored)
+    void release(PsramClient client, void* ptr, size_t size);
+
+    // Account for a library's buffer of size bytes
+    void noteExternal(PsramClient client, size_t size);
+
+    void setReclaimer(PsramClient client, ReclaimFn fn);
+
+    static PsramPriority priority(PsramClient client);
+    static const char* clientName(PsramClient client);
+    PsramAccount getAccount(PsramClient client) const;
+
+    // The plan as it stands: totals, headroom and one line per client
+    void printPlan() const;
+    void writeJson(Print& out) const;
+
+    static const size_t OPTIONAL_HEADROOM = 2 * 1024 * 1024;
+
+private:
+    // Ask clients below prio to let memory go; true if any did
+    bool reclaimBelow(PsramPriority prio);
+    bool hasHeadroom() const;
+
+    size_t psramSize;
+    PsramAccount accounts[PSRAM_CLIENT_COUNT];
+    ReclaimFn reclaimers[PSRAM_CLIENT_COUNT];
+    mutable portMUX_TYPE mux;
+};
+
+// Global instance
+extern PsramBudget psramBudget;
+
+#endif // PSRAM_BUDGET_H
@@ -0,0 +1,113 @@
+#ifndef REQUEST_LANE_H
+#define REQUEST_LANE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+// Heavy request lane for DisplayWebServer.
+//
+// The async web server runs every handler on the single AsyncTCP task, so a
+// blocking screenshot capture, config parse or flash write stalls
+// every other client (including /api/state polls and button actions) until it
+// finishes. (WiFi scans don't block at all; see wifi_scan.h.)
+// Heavy endpoints instead submit a job here and answer 202 straight away; one
+// low-priority worker runs the jobs, and callers poll for the result.
+//
+// At most MAX_IN_FLIGHT jobs are queued or running at once. A job of a kind
+// that is already pending is coalesced into it (a newer config body replaces
+// the queued one), and anything else is refused so the handler can answer
+// 503 with Retry-After.
+//
+// Every accepted submission gets an id, handed back in the 202, so a caller
+// can follow its own job rather than whichever run of that kind came last.
+// A config body replaced while still queued reports JOB_SUPERSEDED. Only
+// the latest outcome per kind is kept, which is enough for a caller polling
+// right after its submission.
+enum HeavyJob : uint8_t {
+    JOB_SCREENSHOT = 0,
+    JOB_APPLY_CONFIG,
+    JOB_ICON_PACK,      // Install the staged upload (icon_pack.h)
+    JOB_BACKGROUND,     // Decode the staged animation (background_anim.h)
+    JOB_COUNT
+};
+
+enum JobState : uint8_t {
+    JOB_IDLE = 0,   // Never run
+    JOB_PENDING,    // Queued behind another job
+    JOB_RUNNING,
+    JOB_DONE,
+    JOB_FAILED,
+    JOB_SUPERSEDED  // Replaced by a newer submission before it ran
+};
+
+enum SubmitResult : uint8_t {
+    SUBMIT_QUEUED = 0,
+    SUBMIT_COALESCED,   // Merged into the pending job of the same kind
+    SUBMIT_BUSY         // Lane saturated, retry later
+};
+
+struct JobStatus {
+    JobState state;             // Pending/running, else the last outcome
+    unsigned long finishedAt;   // millis() of the last completion, 0 if none
+    uint32_t runs;
+    uint32_t id;                // Submission the last completion ran, 0 if none
+    const char* error;          // Why it failed (static string), if known
+};
+
+class HeavyRequestLane {
+public:
+    HeavyRequestLane();
+
+    // Create the worker task (call once before the web server starts)
+    void begin();
+
+    // Queue a job. JOB_APPLY_CONFIG takes ownership of body (a heap buffer
+    // from heap_caps_malloc/malloc) whatever the result; it is freed if the
+    // job is refused. id, if given, receives the submission's id (0 when
+    // refused; a coalesced screenshot and the like share the queued one's).
+    SubmitResult submit(HeavyJob job, char* body = nullptr, size_t length = 0, uint32_t* id = nullptr);
+
+    JobStatus getStatus(HeavyJob job) const;
+    const char* getStateName(HeavyJob job) const;
+    bool isPending(HeavyJob job) const;
+
+    // State of one submission: pending, running, its outcome while it is
+    // the last run of its kind, superseded while it is the last one
+    // replaced; JOB_IDLE once that history has moved on (or id is unknown)
+    JobState getJobState(HeavyJob job, uint32_t id) const;
+    static const char* stateName(JobState state);
+
+    static const uint8_t MAX_IN_FLIGHT = 2;
+    static const uint8_t RETRY_AFTER_S = 2;
+
+private:
+    static void workerTask(void* parameter);
+    bool runJob(HeavyJob job, char* body, size_t length);
+    bool runScreenshot();
+    bool runApplyConfig(char* body, size_t length);
+    bool runIconPack();
+    bool runBackground();
+
+    uint8_t inFlightLocked() const;
+
+    TaskHandle_t workerHandle;
+    mutable portMUX_TYPE mux;
+    JobStatus status[JOB_COUNT];    // Outcome of the last finished run
+    uint8_t pendingMask;            // Bit per HeavyJob waiting for the worker
+    HeavyJob runningJob;            // JOB_COUNT when the worker is idle
+    uint32_t pendingId[JOB_COUNT];  // Submission waiting for the worker, per kind
+    uint32_t supersededId[JOB_COUNT];   // Last one replaced while queued
+    uint32_t runningId;
+    uint32_t nextId;
+
+    // Queued config body, owned by the lane until the job runs
+    char* configBody;
+    size_t configLength;
+};
+
+// Global instance
+extern HeavyRequestLane heavyLane;
+
+#endif // REQUEST_LANE_H
@@ -0,0 +1,68 @@
+#ifndef SCREEN_STREAM_H
+#define SCREEN_STREAM_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// Live view of the panel over a WebSocket at /api/screen/stream.
+//
+// At most MAX_FPS times a second a frame is copied from the render task
+// (same between-frames handshake as screenshots), split into TILE_SIZE
+// square tiles, and only tiles whose hash changed since the last frame are
+// sent. A static screen costs nothing on the wire.
+//
+//   panel -> viewer  text   {"t":"hello","width":480,"height":480,"tile":16,"fps":5}
+//                    binary frame message (little-endian):
+//                      u8 'S', u8 version (1), u8 flags (1 = keyframe, 2 = end of frame),
+//                      u8 tile size, u16 message seq, u16 frame seq, u16 tile count,
+//                      then per tile: u8 tx, u8 ty, u8 encoding, u16 length, payload
+//                    encoding 0 = raw RGB565, 1 = RLE runs of (u8 count-1, u16 RGB565)
+//   viewer -> panel  text   "key"   resend every tile (e.g. after a message seq gap)
+//
+// A frame is split over several messages of at most MAX_MESSAGE_SIZE bytes.
+// When a viewer's send queue is full the tiles that could not go out are
+// marked dirty and retried on the next frame. The frame buffer is allocated
+// on the first viewer and freed after the last one leaves.
+class ScreenStream {
+public:
+    ScreenStream();
+
+    // Register the WebSocket handler (call from route setup) and start the
+    // idle stream task
+    void attach(AsyncWebServer& server);
+
+    static const uint8_t TILE_SIZE = 16;
+    static const uint8_t MAX_FPS = 5;
+    static const uint8_t MAX_VIEWERS = 2;
+    static const size_t MAX_MESSAGE_SIZE = 8192;
+    static const unsigned long KEYFRAME_INTERVAL_MS = 10000;   // Heals hash collisions
+
+private:
+    static void onEvent(AsyncWebSocket* ws, AsyncWebSocketClient* client, AwsEventType type,
+                        void* arg, uint8_t* data, size_t len);
+    static void streamTask(void* parameter);
+
+    bool allocate();
+    void release();
+    void streamFrame(bool keyframe);
+    uint32_t hashTile(int tx, int ty) const;
+    size_t encodeTile(int tx, int ty, uint8_t* out, uint8_t& encoding) const;
+    bool flushMessage(size_t& length, uint16_t tiles, bool keyframe, bool last);
+
+    AsyncWebSocket socket;
+    TaskHandle_t taskHandle;
+    volatile bool keyframeRequested;
+
+    uint16_t* frame;        // Latest frame copy (PSRAM)
+    uint32_t* tileHashes;   // Hash of each tile as last sent
+    uint8_t* message;       // Message being assembled
+    uint16_t messageSeq;
+    uint16_t frameSeq;
+};
+
+// Global instance
+extern ScreenStream screenStream;
+
+#endif // SCREEN_STREAM_H
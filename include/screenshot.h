@@ -2,23 +2,97 @@
 #define SCREENSHOT_H
 
 #include <Arduino.h>
+#include <memory>
 
-// Initialize screenshot storage in PSRAM
-void initScreenshot();
+// A captured frame: a copy of the displayed RGB565 framebuffer in PSRAM.
+// The 24-bit BMP is generated from it on demand while it is being sent, so
+// no BMP-sized buffer is ever held. Shared so a download in progress keeps
+// its frame alive across a new capture or a delete.
+struct ScreenshotFrame {
+    uint16_t* pixels;
 
-// Capture screenshot from LVGL framebuffer and save to PSRAM buffer as BMP
-bool captureScreenshot();
+    ScreenshotFrame() : pixels(nullptr) {}
+    ~ScreenshotFrame();
+};
 
-// Get pointer to screenshot data in PSRAM (BMP format)
-const uint8_t* getScreenshotData();
+typedef std::shared_ptr<const ScreenshotFrame> ScreenshotRef;
 
-// Get size of screenshot data in bytes
+// Snapshot the displayed frame. The copy is made by the LVGL render task
+// between frames, so the image is never torn; the caller blocks until then
+// (up to timeoutMs) and must NOT hold the LVGL lock.
+bool captureScreenshot(uint32_t timeoutMs = 1000);
+
+// Same handshake into a caller-owned buffer of getScreenshotRgb565Size()
+// bytes (used by the live screen stream)
+bool copyDisplayFrame(uint16_t* dst, uint32_t timeoutMs = 1000);
+
+// Reads what the panel is scanning out into dst (SCREEN_WIDTH x
+// SCREEN_HEIGHT RGB565, top-down rows); false if it couldn't. Registered by
+// main.cpp so captures come from the framebuffer itself in every render
+// mode. Without one, the capture guesses LVGL's completed draw buffer,
+// which only works when that is a full frame.
+typedef bool (*FrameReadFn)(uint16_t* dst);
+void setScreenshotFrameReader(FrameReadFn fn);
+
+// Render task hook: services a pending capture. Call between
+// lv_timer_handler() runs with the LVGL lock held.
+void serviceScreenshotCapture();
+
+// Current capture, or null if there is none
+ScreenshotRef getScreenshot();
+
+// Size of the BMP file a capture produces (0 if there is no screenshot)
 size_t getScreenshotSize();
 
-// Check if screenshot exists in buffer
+// Size of the BMP file generated from any frame
+size_t getScreenshotBmpSize();
+
+// Check if a screenshot has been captured
 bool hasScreenshot();
 
-// Mark screenshot as deleted (doesn't free memory, just marks as invalid)
+// Drop the current capture (its memory is freed once no download holds it)
 void deleteScreenshot();
 
+// Write up to maxLen bytes of the frame's BMP file, starting at offset, into
+// dst. Returns the number of bytes written (0 past the end).
+size_t readScreenshotBmp(const ScreenshotFrame& frame, uint8_t* dst, size_t maxLen, size_t offset);
+
+// Raw little-endian RGB565 pixels (top-down rows), same random access
+size_t getScreenshotRgb565Size();
+size_t readScreenshotRgb565(const ScreenshotFrame& frame, uint8_t* dst, size_t maxLen, size_t offset);
+
+// Screenshot dimensions, for formats without a header
+int getScreenshotWidth();
+int getScreenshotHeight();
+
+// Incremental QOI encoder (https://qoiformat.org) over a captured frame.
+// Flat LVGL screens compress to a few percent of the BMP. The output length
+// isn't known up front, so it suits a chunked response: each read() encodes
+// just enough pixels to fill dst and returns 0 once the stream has ended.
+class QoiScreenshotEncoder {
+public:
+    explicit QoiScreenshotEncoder(ScreenshotRef frame);
+
+    size_t read(uint8_t* dst, size_t maxLen);
+
+private:
+    void encodePixel();
+    void emit(uint8_t b) { pending[pendingLen++] = b; }
+
+    ScreenshotRef frame;
+    uint32_t pos;           // Next pixel to encode
+    uint32_t prev;          // Previous pixel as 0xRRGGBB
+    uint32_t index[64];     // QOI color cache (0xRRGGBB; alpha is always 255)
+    bool indexUsed[64];
+    uint8_t run;
+    bool started;
+    bool finished;
+
+    // Encoded bytes that didn't fit the last read (header and end marker
+    // need at most 14)
+    uint8_t pending[16];
+    uint8_t pendingLen;
+    uint8_t pendingOff;
+};
+
 #endif // SCREENSHOT_H
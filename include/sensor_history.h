@@ -0,0 +1,62 @@
+#ifndef SENSOR_HISTORY_H
+#define SENSOR_HISTORY_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+// Recent samples of the sensor buttons (ButtonType::SENSOR), pushed by the
+// server (see server_channel.h) and drawn by their cards as a value and a
+// chart.
+//
+// Each sensor gets a fixed ring of HISTORY_SIZE samples, claimed on its
+// first sample; with every ring taken the one updated longest ago is
+// recycled. Rings are keyed by button id, not by card, so a sensor keeps its
+// history across pages, rebuilds and theme changes.
+//
+// A chart never gets more points than its width has pixels: decimate()
+// reduces the history to min/max pairs per pixel-wide bucket (the extremes
+// a sparkline must not lose), so drawing costs the same however long the
+// history is.
+class SensorHistory {
+public:
+    SensorHistory();
+
+    // Record a sample (any task). False if it was refused (not a number).
+    bool push(uint8_t buttonId, float value);
+
+    // The latest sample; false if the sensor has none yet
+    bool latest(uint8_t buttonId, float& value) const;
+
+    // The history, oldest first, as at most maxPoints chart values scaled
+    // to 0..CHART_RANGE between its lowest and highest sample. Returns how
+    // many were written (0 without samples).
+    uint16_t decimate(uint8_t buttonId, int16_t* out, uint16_t maxPoints) const;
+
+    // Samples refused or dropped with a recycled ring, since boot
+    uint32_t getDropped() const { return dropped; }
+
+    static const uint8_t MAX_SENSORS = 8;
+    static const uint16_t HISTORY_SIZE = 288;    // A day at one sample per 5 minutes
+    static const int16_t CHART_RANGE = 1000;
+
+private:
+    struct Ring {
+        uint8_t buttonId;       // 0 = free
+        uint16_t head;          // Next slot written
+        uint16_t count;
+        uint32_t lastMs;
+        float samples[HISTORY_SIZE];
+    };
+
+    Ring rings[MAX_SENSORS];
+    uint32_t dropped;
+    mutable portMUX_TYPE mux;
+
+    const Ring* find(uint8_t buttonId) const;
+    Ring& claim(uint8_t buttonId);
+};
+
+// Global instance
+extern SensorHistory sensorHistory;
+
+#endif // SENSOR_HISTORY_H
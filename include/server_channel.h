@@ -0,0 +1,85 @@
+#ifndef SERVER_CHANNEL_H
+#define SERVER_CHANNEL_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+// Long-lived WebSocket between the panel and the management server.
+//
+// The server dials in to ws://<panel>/ws and keeps the socket open; both
+// sides then exchange small JSON messages tagged by "t":
+//
+//   server -> panel   {"t":"state","version":9,"base":8,"buttons":[{"id":1,"state":true,"speedLevel":2}],"serverTime":1760000000}
+//                     {"t":"config"}            config changed, re-fetch it
+//                     {"t":"ping","serverTime":1760000000}
+//                                               heartbeat, answered with pong; also
+//                                               sent right after the hello. serverTime
+//                                               (Unix seconds) sets the clock before NTP
+//                     {"t":"fields","fields":{"footer_left":"47635.1"}}
+//                                               live LCARS frame text, see
+//                                               UIManager::postLCARSField()
+//                     {"t":"samples","samples":{"5":21.5,"6":[1180,1240]}}
+//                                               sensor card samples by button id,
+//                                               arrays oldest first, see sensor_history.h
+//   panel -> server   {"t":"hello","deviceId":"...","msgpack":true,"mcast":true}
+//                                               "mcast": receiving state multicast
+//                                               (see state_multicast.h); sent again
+//                                               when that changes
+//                     {"t":"batch","seq":7,"buttons":[{"id":3,"state":true,"speedLevel":2}],"scenes":[2]}
+//                     {"t":"resync"}           state delta didn't apply, send everything
+//                     {"t":"pong","heap":{...},"perf":{...},"wifi":{"rssi":-61,"reconnects":0},"tasks":{...}}
+//                                               latest heap, frame time, link and task
+//                                               samples (see heap_monitor.h,
+//                                               perf_monitor.h, task_monitor.h)
+//
+// Binary frames carry the same messages encoded as MessagePack; the panel
+// advertises support in its hello.
+//
+// Reconnect/backoff lives on the server side (it is the dialing end). While
+// the channel is up the panel skips its HTTP webhooks and /api/ping polling;
+// when it drops everything falls back to plain HTTP.
+class ServerChannel {
+public:
+    ServerChannel();
+
+    // Register the /ws handler (call from route setup, before server.begin())
+    void attach(AsyncWebServer& server);
+
+    // True while a server socket is open and has been heard from recently
+    bool isConnected() const;
+
+    // Send a message to the server; false if there is no usable channel
+    bool send(const char* json);
+
+    // Send the hello again, e.g. when something it advertises changed
+    void announce();
+
+private:
+    static void formatHello(char* out, size_t size);
+
+    static void onEvent(AsyncWebSocket* ws, AsyncWebSocketClient* client, AwsEventType type,
+                        void* arg, uint8_t* data, size_t len);
+    void handleMessage(AsyncWebSocketClient* client, char* data, size_t len, bool msgpack);
+
+    // Pull the config from the server after a "config" notification
+    void refreshConfig();
+
+    // Scheduler jobs: client cleanup and heartbeat timeout; config refresh
+    static void onCleanupTimer(void* arg);
+    static void onConfigChanged(void* arg);
+
+    AsyncWebSocket socket;
+    volatile uint32_t clientId;         // 0 = no server connected
+    volatile unsigned long lastReceive;
+    int8_t cleanupJob;
+    int8_t configJob;               // Posted from the async_tcp task, runs in loop()
+
+    static const unsigned long HEARTBEAT_TIMEOUT = 45000;  // Server pings every 15 s
+    static const unsigned long CLEANUP_INTERVAL = 1000;
+    static const size_t MAX_MESSAGE_SIZE = 1024;
+};
+
+// Global instance
+extern ServerChannel serverChannel;
+
+#endif // SERVER_CHANNEL_H
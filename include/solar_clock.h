@@ -0,0 +1,51 @@
+#ifndef SOLAR_CLOCK_H
+#define SOLAR_CLOCK_H
+
+#include <Arduino.h>
+#include <time.h>
+#include <freertos/FreeRTOS.h>
+
+// Today's sunrise/sunset, in local minutes of day
+struct SunTimes {
+    int32_t day;        // SolarClock::dayKey() of the local date
+    int16_t sunrise;    // -1 when the sun doesn't cross the horizon today
+    int16_t sunset;
+    int8_t polar;       // 0 normal, 1 sun up all day, -1 down all day
+};
+
+// Sunrise and sunset from latitude/longitude, for schedules anchored on
+// them. Uses NOAA's low-precision solar equations (fractional-year series
+// for declination and the equation of time), good to a minute or two
+// outside the polar circles: a handful of trig calls, done once per local
+// date and location and cached.
+class SolarClock {
+public:
+    SolarClock();
+
+    // Sun times for the current local date. False without a location or
+    // before the clock is set.
+    bool today(float latitude, float longitude, SunTimes& out);
+
+    // Config treats NaN coordinates as "no location"
+    static bool hasLocation(float latitude, float longitude);
+
+    // Identifies a local calendar date
+    static int32_t dayKey(const struct tm& local) { return local.tm_year * 400 + local.tm_yday; }
+
+private:
+    // UTC sunrise/sunset for day-of-year yday (0-based) of year. Returns
+    // the polar state; rise and set are only set when it is 0.
+    static int8_t compute(int year, int yday, float latitude, float longitude,
+                          time_t& rise, time_t& set);
+    static int16_t localMinute(time_t at);
+
+    SunTimes cached;
+    float cachedLatitude;
+    float cachedLongitude;
+    portMUX_TYPE mux;
+};
+
+// Global instance
+extern SolarClock solarClock;
+
+#endif // SOLAR_CLOCK_H
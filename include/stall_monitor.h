@@ -0,0 +1,91 @@
+#ifndef STALL_MONITOR_H
+#define STALL_MONITOR_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+class Print;
+
+// Catches the main loop or the LVGL task stuck in one piece of work (a
+// blocking request, a big rebuild, an NVS write) for longer than
+// THRESHOLD_MS, served at /api/diag/stalls.
+//
+// Each watched task marks the start and end of every unit of work with
+// enter()/leave() and names what it is doing (the scheduler job, or the
+// render step); waiting for work doesn't count. A high-priority monitor
+// task checks them every CHECK_INTERVAL_MS. When one has been busy past the
+// threshold it records the tag and the task's backtrace: an IPC call to the
+// task's core takes it off the CPU, so its saved register frame can be
+// walked. The record's duration keeps growing until the work ends. PCs are
+// for addr2line against the ELF the report's hash names.
+enum StallWatch : uint8_t {
+    STALL_LOOP = 0,     // loop(): event scheduler jobs
+    STALL_LVGL,         // LVGL task: lock, render, UI update
+    STALL_WATCH_COUNT
+};
+
+class StallMonitor {
+public:
+    StallMonitor();
+
+    // Start the monitor task (setup). Watched tasks attach themselves.
+    void begin();
+
+    // The calling task is what watch observes (pinned tasks only: the
+    // backtrace is taken on their core)
+    void attach(StallWatch watch);
+
+    // Any watched task: a unit of work starts, is now doing tag (a string
+    // that outlives it), ends
+    void enter(StallWatch watch, const char* tag);
+    void setTag(StallWatch watch, const char* tag) { watches[watch].tag = tag; }
+    void leave(StallWatch watch);
+
+    // Stall records, newest first, and what each task is doing now
+    void writeJson(Print& out) const;
+
+    static const uint32_t THRESHOLD_MS = 1000;
+    static const uint32_t CHECK_INTERVAL_MS = 100;
+    static const uint8_t HISTORY_SIZE = 16;
+    static const uint8_t MAX_FRAMES = 12;
+
+private:
+    struct Watch {
+        TaskHandle_t task;
+        const char* volatile tag;
+        volatile uint32_t sinceMs;  // When the current unit of work started
+        volatile uint32_t seq;      // Units started
+        volatile uint32_t doneSeq;  // Last unit finished
+        volatile uint32_t lastMs;   // How long it took
+        volatile bool busy;
+        uint32_t recordedSeq;       // Unit the open record is about (monitor task)
+        int8_t openRecord;          // -1 if none
+    };
+
+    struct StallRecord {
+        uint32_t atMs;              // Uptime when the work started
+        uint32_t durationMs;        // So far while ongoing
+        const char* tag;
+        uint8_t watch;
+        bool ongoing;
+        uint8_t depth;
+        uint32_t pcs[MAX_FRAMES];
+    };
+
+    static void monitorTask(void* parameter);
+    void check();
+    void capture(Watch& w, StallRecord& record);
+
+    Watch watches[STALL_WATCH_COUNT];
+    StallRecord records[HISTORY_SIZE];
+    uint8_t head;                   // Next slot
+    uint8_t count;
+    uint32_t total;
+    mutable portMUX_TYPE mux;
+};
+
+// Global instance
+extern StallMonitor stallMonitor;
+
+#endif // STALL_MONITOR_H
@@ -0,0 +1,86 @@
+#ifndef STATE_MULTICAST_H
+#define STATE_MULTICAST_H
+
+#include <Arduino.h>
+#include <AsyncUDP.h>
+#include "config_manager.h"
+
+class Print;
+
+// Signed state deltas multicast by the server to every panel at once.
+//
+// An accessory shown on many panels changes once, but a unicast push goes
+// to each panel on its own TCP session. With "multicast" in the config the
+// server also sends each change as one UDP datagram to a group every panel
+// joins, addressed by binding id (the server's id for the accessory, the
+// "bid" of each button bound to it); each panel applies it to its own
+// buttons through ConfigManager::findButtonsByBinding().
+//
+// Datagram (little-endian):
+//   'P' 'S' | version (1) | count | epoch u32 | seq u32 |
+//   count x { bindingId u32 | state u8 | speedLevel u8 (0xFF: none) } |
+//   first 8 bytes of HMAC-SHA256(key, everything before)
+//
+// seq counts datagrams within the server's epoch (redrawn when it
+// restarts); each is sent twice, and a repeat or an older one is dropped.
+// A count of 0 is a heartbeat carrying the last seq sent. A skipped seq
+// means a lost datagram: the panel asks for a full push over the server
+// channel ({"t":"resync"}).
+//
+// The server only counts on multicast for panels whose server channel is
+// open and whose hello says "mcast":true, i.e. this is listening and has
+// heard a valid datagram (or just started); everyone else keeps getting
+// unicast pushes, as do these once datagrams stop arriving.
+class StateMulticast {
+public:
+    StateMulticast();
+
+    // Start the check job: joins the group once WiFi is up and the config
+    // has one, and follows config and address changes
+    void begin();
+
+    // Listening and hearing the server (the hello's "mcast")
+    bool isAdvertised() const { return advertised; }
+
+    // Counters
+    void writeJson(Print& out) const;
+
+    static const unsigned long CHECK_INTERVAL = 5000;
+    static const unsigned long SILENCE_TIMEOUT = 45000;    // Server heartbeats every 15 s
+    static const size_t TAG_SIZE = 8;
+    static const int MAX_BUTTONS_PER_BINDING = 8;
+
+private:
+    static void onCheckTimer(void* arg);
+    void check();
+    void start(const StateMulticastConfig& config);
+    void stop();
+
+    // async_udp task
+    void handlePacket(const uint8_t* data, size_t len);
+    bool verify(const uint8_t* data, size_t len) const;
+
+    AsyncUDP udp;
+    int8_t checkJob;
+    bool listening;
+    bool advertised;
+    StateMulticastConfig active;    // Only changes while not listening
+    uint32_t listenIp;
+    unsigned long listenStart;
+
+    // Written by the async_udp task
+    volatile unsigned long lastValid;
+    uint32_t epoch;                 // 0 until the first datagram
+    uint32_t lastSeq;
+
+    uint32_t received;              // Valid datagrams, repeats included
+    uint32_t applied;               // Button changes made
+    uint32_t repeats;               // Repeated or older seq, dropped
+    uint32_t rejected;              // Malformed or bad tag
+    uint32_t gaps;                  // Lost datagrams noticed (resync asked)
+};
+
+// Global instance
+extern StateMulticast stateMulticast;
+
+#endif // STATE_MULTICAST_H
@@ -0,0 +1,142 @@
+#ifndef STATIC_MEMORY_H
+#define STATIC_MEMORY_H
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+class Print;
+
+// Deterministic memory build (PANEL_STATIC_MEMORY, env:esp32s3-static).
+//
+// Long uptimes fragment the heap one short-lived buffer at a time. In this
+// build the run-time buffers of each subsystem come from fixed pools carved
+// out of one PSRAM block reserved at boot:
+//   json          ArduinoJson pools (json_alloc.h), small and config-sized
+//   http          the HTTP worker's response body (http_pool.h)
+//   web_body      chunked state, patch and server request bodies
+//   config_body   POST /api/config bodies, parsed on the heavy lane
+//   screenshot    capture frames (a download may hold the previous one)
+// LVGL's internal SRAM share becomes a heap of its own, taken at boot
+// (lvgl_mem.cpp), and config strings already live in ConfigArena.
+//
+// A pool is a fixed number of same-size slots, so a slot given back is a
+// slot reusable as it was: nothing fragments. A request a pool can't serve
+// (too big, or every slot taken) goes to the heap and is counted, except
+// screenshots, which are refused instead. Slots are freed with free() like
+// heap blocks; the build wraps free() and hands them back here.
+//
+// setup() ends with seal(). From then on the malloc family (malloc, calloc,
+// realloc, operator new, heap_caps_malloc/calloc/realloc) is counted per
+// task through link-time wrappers (platformio.ini) and reported at
+// /api/diag/heap under "static", with the first caller on each task to
+// track down what is left. The firmware's own tasks should stay at zero;
+// WiFi, lwIP and AsyncTCP allocate per packet and request on theirs.
+//
+// In other builds the pools are empty, alloc() returns nullptr and nothing
+// is counted.
+#ifndef PANEL_STATIC_MEMORY
+#define PANEL_STATIC_MEMORY 0
+#endif
+
+enum StaticPool : uint8_t {
+    STATIC_POOL_JSON_SMALL = 0, // Documents up to STATIC_JSON_SMALL_SLOT (results, scans, samples)
+    STATIC_POOL_JSON_LARGE,     // Config and patch documents
+    STATIC_POOL_HTTP,           // HTTP worker response body
+    STATIC_POOL_WEB_BODY,       // Chunked request bodies up to MAX_SERVER_PAYLOAD_SIZE
+    STATIC_POOL_CONFIG_BODY,    // POST /api/config bodies
+    STATIC_POOL_SCREENSHOT,     // Capture frames
+    STATIC_POOL_COUNT
+};
+
+// JSON pools (and their block header) up to this size take a small slot
+#define STATIC_JSON_SMALL_SLOT (4 * 1024 + 64)
+
+// The HTTP worker's response buffer
+#define STATIC_HTTP_SLOT (4 * 1024)
+
+struct StaticPoolStats {
+    uint32_t slotSize;
+    uint8_t slots;
+    uint8_t used;
+    uint8_t peak;
+    uint32_t allocs;
+    uint32_t overflows;         // Requests it couldn't serve: too big, or every slot taken
+};
+
+class StaticMemory {
+public:
+    StaticMemory();
+
+    // Setup, right after psramBudget.begin(): reserve every pool
+    void begin();
+
+    // End of setup(): heap allocations from here on are counted
+    void seal();
+
+    // A slot of pool for size bytes, or nullptr (counted as an overflow)
+    // if the pool can't serve it. Any task.
+    void* alloc(StaticPool pool, size_t size);
+
+    // Give a slot back; false if ptr isn't one
+    bool release(void* ptr);
+
+    // Bytes usable at ptr if it is a slot, else 0
+    size_t slotSize(const void* ptr) const;
+    uint32_t poolSlotSize(StaticPool pool) const;
+
+    // Called by the malloc wrappers for every heap request
+    void noteHeapAlloc(size_t size, void* caller);
+
+    bool isSealed() const { return sealed; }
+    uint32_t getHeapAllocsAfterSeal() const { return heapAllocs; }
+    StaticPoolStats getPoolStats(StaticPool pool) const;
+    static const char* poolName(StaticPool pool);
+
+    // Pools and the post-setup heap count as one JSON object
+    void writeJson(Print& out) const;
+
+    static const uint8_t MAX_TASKS = 16;
+
+private:
+    struct Pool {
+        uint8_t* base;
+        uint32_t freeMask;      // Bit per free slot
+        StaticPoolStats stats;
+    };
+
+    // Heap requests after seal(), per task that made them
+    struct TaskAllocs {
+        TaskHandle_t task;
+        char name[16];
+        uint32_t allocs;
+        uint32_t bytes;
+        void* firstCaller;
+    };
+
+    int poolOf(const void* ptr) const;
+
+    Pool pools[STATIC_POOL_COUNT];
+    uint8_t* block;
+    size_t blockSize;
+    volatile bool sealed;
+    uint32_t sealedAtMs;
+    uint32_t heapAllocs;
+    uint32_t heapBytes;
+    uint32_t isrAllocs;
+    uint32_t untrackedAllocs;   // Tasks past MAX_TASKS
+    TaskAllocs tasks[MAX_TASKS];
+    uint8_t taskCount;
+    mutable portMUX_TYPE mux;
+};
+
+// Global instance
+extern StaticMemory staticMemory;
+
+// A buffer for pool in the static build, falling back to the heap (caps)
+// when the pool can't serve it; the heap alone in other builds. free()
+// gives it back either way.
+void* poolMalloc(StaticPool pool, size_t size, uint32_t caps = MALLOC_CAP_DEFAULT);
+
+#endif // STATIC_MEMORY_H
@@ -0,0 +1,45 @@
+#ifndef STREAM_INFLATER_H
+#define STREAM_INFLATER_H
+
+#include <Arduino.h>
+
+// Incremental zlib/deflate decoder on the ROM's tinfl, for OTA uploads.
+//
+// Output goes to the inflater's own 32 KB circular window (deflate never
+// refers further back), so memory stays fixed however large the stream is;
+// callers copy it out with read(). Input may arrive in pieces: with
+// moreInput set, running out of input just means "call again later".
+// The window and decoder state live in one PSRAM block.
+class StreamInflater {
+public:
+    StreamInflater();
+    ~StreamInflater();
+
+    // zlibHeader: the stream starts with a zlib header (else raw deflate,
+    // as inside gzip). False if the workspace can't be allocated.
+    bool begin(bool zlibHeader);
+
+    // Copy up to n bytes of output to dst, consuming from in/inLeft (both
+    // advanced). Returns the bytes copied, fewer than n once the input runs
+    // out or the stream ends; -1 if the stream is corrupt.
+    int read(const uint8_t*& in, size_t& inLeft, bool moreInput, uint8_t* dst, size_t n);
+
+    // The final deflate block has been decoded and read
+    bool isDone() const { return inflateDone && availLen == 0; }
+
+    // Bytes to skip past a gzip header at data (0 if it isn't one, or is
+    // still incomplete within len)
+    static size_t gzipHeaderSize(const uint8_t* data, size_t len);
+
+private:
+    struct Workspace;
+
+    Workspace* work;
+    uint32_t flags;
+    size_t dictPos;
+    size_t availStart;
+    size_t availLen;
+    bool inflateDone;
+};
+
+#endif // STREAM_INFLATER_H
@@ -0,0 +1,72 @@
+#ifndef TASK_MONITOR_H
+#define TASK_MONITOR_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// Per-task CPU use, stack headroom and core affinity, served at
+// /api/diag/tasks and piggybacked on the server channel's pong.
+//
+// Every SAMPLE_INTERVAL_MS a main-loop job snapshots all tasks with
+// uxTaskGetSystemState(). CPU% is each task's run time over the last
+// interval as a share of one core; a core's load is 100% minus its idle
+// task's share. Stack headroom is FreeRTOS's high-water mark (bytes never
+// touched since the task started), so a small number means a stack close
+// to overflowing at some point.
+//
+// Run-time counters need CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS, which the
+// prebuilt Arduino core leaves off; without it CPU and load read as null and
+// only stacks/affinity are reported (sdkconfig.defaults turns it on for
+// builds that compile the IDF).
+struct TaskStat {
+    char name[configMAX_TASK_NAME_LEN];
+    TaskHandle_t handle;
+    uint32_t stackFree;         // High-water mark, bytes
+    uint32_t runTime;           // Run-time counter at the sample (0 without stats)
+    uint16_t cpuPermille;       // Share of one core over the last interval
+    int8_t core;                // Pinned core, -1 for no affinity
+    uint8_t priority;
+    uint8_t state;              // eTaskState
+};
+
+class TaskMonitor {
+public:
+    TaskMonitor();
+
+    // Allocate the snapshot buffers, take the first sample and schedule the rest
+    void begin();
+
+    bool hasRunTimeStats() const;
+
+    // All tasks from the latest sample
+    void writeJson(Print& out) const;
+
+    // Core loads and a compact row per task, for the pong
+    size_t writeHeartbeat(char* buf, size_t len) const;
+
+    static const unsigned long SAMPLE_INTERVAL_MS = 5000;
+    static const uint8_t MAX_TASKS = 32;
+
+private:
+    static void onSampleTimer(void* arg);
+    void takeSample();
+
+    TaskStatus_t* status;       // uxTaskGetSystemState() scratch
+    TaskStat* tasks;            // Latest sample (run-time deltas are taken against it)
+    TaskStat* spare;            // Next sample is built here, then swapped in
+    uint8_t taskCount;
+    uint16_t coreLoadPermille[portNUM_PROCESSORS];
+    uint32_t totalRunTime;      // Run-time clock at the latest sample
+    uint32_t windowMs;          // Interval the CPU figures cover
+    uint32_t sampledAt;         // Uptime of the latest sample, s
+    bool overflowed;            // More than MAX_TASKS tasks at the last attempt
+    mutable portMUX_TYPE mux;
+    unsigned long lastSample;
+    int8_t sampleJob;
+};
+
+// Global instance
+extern TaskMonitor taskMonitor;
+
+#endif // TASK_MONITOR_H
@@ -3,13 +3,26 @@
 
 #include <Arduino.h>
 #include <lvgl.h>
+#include "theme_id.h"
+
+struct CustomThemeConfig;
+
+// What the LCARS layout draws in each of its theme's neonColors
+enum LCARSColorRole : uint8_t {
+    LCARS_FRAME = 0,        // Sidebar, elbow and bars (orange)
+    LCARS_SCENE,            // Scene buttons (tan)
+    LCARS_ACTIVE,           // Cards that are on (purple)
+    LCARS_STANDBY,          // Cards that are off (light purple)
+    LCARS_ACCENT,           // Blue accents
+    LCARS_STANDBY_TEXT      // Text on cards that are off (yellow)
+};
 
-// Available themes
-enum class ThemeId {
-    LIGHT_MODE,
-    NEON_CYBERPUNK,
-    DARK_CLEAN,
-    LCARS
+// Likewise for the Cyberpunk decoration, which shares the per-room palette
+enum CyberpunkColorRole : uint8_t {
+    CYBERPUNK_CYAN = 0,
+    CYBERPUNK_PINK,
+    CYBERPUNK_YELLOW,
+    CYBERPUNK_GREEN
 };
 
 // Theme color palette
@@ -63,6 +76,23 @@ struct ThemeDefinition {
     ThemeStyle style;
 };
 
+// Shared LVGL styles for the current theme. Objects reference these instead
+// of carrying their own local style properties; rebuilt when the theme changes.
+struct ThemeStyles {
+    lv_style_t screen;
+    lv_style_t card;
+    lv_style_t cardGlow[9];     // Per-room "on" border/glow (glowing themes only)
+    lv_style_t buttonPrimary;
+    lv_style_t buttonSecondary;
+    lv_style_t switchMain;
+    lv_style_t switchIndicator;
+    lv_style_t switchKnob;
+    lv_style_t labelPrimary;
+    lv_style_t labelSecondary;
+    lv_style_t header;
+    lv_style_t actionBar;
+};
+
 class ThemeEngine {
 public:
     ThemeEngine();
@@ -70,9 +100,6 @@ public:
     // Initialize the theme engine
     void begin();
 
-    // Set current theme by name
-    bool setTheme(const String& themeName);
-
     // Set current theme by ID
     void setTheme(ThemeId id);
 
@@ -127,10 +154,52 @@ public:
     // Check if current theme is Cyberpunk style (centered icons, no toggles)
     bool isCyberpunk() const;
 
+    // True if two themes build the same widget tree and differ only in styling,
+    // so one can be swapped for the other without rebuilding the UI
+    bool sharesLayout(ThemeId a, ThemeId b) const;
+
+    // Compile the config's custom themes into the CUSTOM_* slots (LVGL task,
+    // before the theme is resolved). Unchanged descriptors keep their
+    // definition, so the styles are only recompiled when the theme on
+    // screen actually changed.
+    void setCustomThemes(const CustomThemeConfig* themes, size_t count);
+
+    // Bumped whenever theme id is redefined (always 0 for built-in themes)
+    uint32_t getRevision(ThemeId id) const;
+
+    // True for the compiled-in theme names ("dark_mode", "lcars", ...)
+    static bool isBuiltinTheme(const char* name);
+    static bool findBuiltinTheme(const char* name, ThemeId& id);
+
+    static const uint8_t CUSTOM_THEME_SLOTS = 4;
+
 
 private:
     ThemeId currentTheme;
 
+    // Shared styles and the theme (and its revision) they were built for
+    ThemeStyles styles;
+    bool stylesInitialized;
+    ThemeId stylesTheme;
+    uint32_t stylesRevision;
+
+    // Compiled display.themes; an unused slot resolves to the default theme
+    struct CustomTheme {
+        bool used;
+        char name[24];
+        uint32_t source;            // Hash of the descriptor it was compiled from
+        uint32_t revision;
+        ThemeDefinition definition;
+    };
+    CustomTheme customThemes[CUSTOM_THEME_SLOTS];
+
+    static const ThemeDefinition* getBuiltinByName(const char* name);
+    static uint32_t hashDescriptor(const CustomThemeConfig& theme);
+    static void compileDescriptor(const CustomThemeConfig& theme, ThemeDefinition& out);
+
+    // (Re)build the shared styles if the theme changed since the last build
+    void ensureStyles();
+
     // Theme definitions
     static ThemeDefinition lightModeTheme;
     static ThemeDefinition neonCyberpunkTheme;
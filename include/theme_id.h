@@ -0,0 +1,18 @@
+#ifndef THEME_ID_H
+#define THEME_ID_H
+
+// Available themes. Theme names in the config are resolved to these when it
+// is parsed (ConfigManager::resolveTheme()), so the schedulers and the UI
+// switch themes without comparing name strings.
+enum class ThemeId {
+    LIGHT_MODE,
+    NEON_CYBERPUNK,
+    DARK_CLEAN,
+    LCARS,
+    CUSTOM_0,       // display.themes, by position (see ThemeEngine::setCustomThemes())
+    CUSTOM_1,
+    CUSTOM_2,
+    CUSTOM_3
+};
+
+#endif // THEME_ID_H
@@ -4,6 +4,15 @@
 #include <Arduino.h>
 #include "config_manager.h"
 
+// Switches between the day and night themes.
+//
+// The day/night start hours are compiled into two minute-of-day boundaries
+// when the config loads; the scheduler then only runs as an EventScheduler
+// job armed for the next boundary (or an hourly recheck), and at once when
+// the clock or timezone changes. With followSun the boundaries are today's
+// sunrise and sunset at the brightness schedule's location instead, redone
+// when the local date changes; the start hours still apply until the clock
+// is set or if no location is configured.
 class ThemeScheduler {
 public:
     ThemeScheduler();
@@ -11,10 +20,6 @@ public:
     // Initialize the theme scheduler
     void begin();
 
-    // Update function - call from main loop
-    // Returns true if theme changed
-    bool update();
-
     // Force re-evaluation (call after config update)
     void refresh();
 
@@ -22,16 +27,37 @@ public:
     bool isEnabled() const;
 
 private:
-    String currentAppliedTheme;
+    ThemeId currentAppliedTheme;
+    bool themeApplied;          // currentAppliedTheme is valid
     bool wasNightTime;
     bool initialized;
 
-    // Determine if current hour falls in night period
-    bool isDayTime(uint8_t hour) const;
+    uint16_t dayStartMinute;
+    uint16_t nightStartMinute;
+    bool nightAllDay;           // followSun, polar night
+    bool sunAnchored;           // Boundaries came from SolarClock
+    int32_t boundaryDay;        // SolarClock::dayKey() they were computed for
+    int8_t job;
+
+    static const unsigned long RECHECK_MS = 3600000;   // Longest wait, for RTC drift
+
+    // Scheduler job: switch theme if a boundary passed, arm the next one.
+    // Returns true if theme changed.
+    static void onTimer(void* arg);
+    bool evaluate();
+
+    // Take the day/night boundaries from the config, or from the sun
+    void compileBoundaries(const DisplayConfig& display);
+
+    // Determine if a minute of day falls in the day period
+    bool isDayTime(uint16_t minuteOfDay) const;
+
+    // Seconds from secondsOfDay to the next day/night boundary
+    uint32_t secondsToNextBoundary(uint32_t secondsOfDay) const;
 
-    // Apply theme change
+    // Apply theme change (themeName is only logged)
     // triggerRebuild: if false, just sets theme without requesting UI rebuild
-    void applyTheme(const String& themeName, bool triggerRebuild = true);
+    void applyTheme(ThemeId theme, const char* themeName, bool triggerRebuild = true);
 };
 
 // Global instance
@@ -0,0 +1,96 @@
+#ifndef THEME_TRANSITION_H
+#define THEME_TRANSITION_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+class Print;
+
+// Cross-fade from one theme to the next, so a theme switch doesn't show as
+// the screen blanking and repainting.
+//
+// capture() snapshots the screen before the theme changes and covers the
+// display with that frame on the top layer, which hides whatever the
+// rebuild does underneath. start() then snapshots the rebuilt screen and
+// fades from the old frame to the new one over FADE_MS. Each step blends
+// the two frames into a third buffer that the cover shows. While the cover
+// is up, LVGL draws only that one opaque image, and the buffers are freed
+// when the fade ends, so steady-state rendering is unchanged. The blend is
+// split across both cores by bandRenderer when it runs.
+//
+// The frames are PSRAM_UI_SNAPSHOT buffers (450 KB each at 480x480). If
+// there is no room for the second and third, the old frame alone fades out
+// over the live screen using image opacity. Without room for any, the
+// theme changes with no transition. LVGL task only.
+class ThemeTransition {
+public:
+    ThemeTransition();
+
+    // Any task: turn transitions off (the UI benchmark times raw rebuilds)
+    void setEnabled(bool enabled) { this->enabled = enabled; }
+
+    // Snapshot scr and cover the display with it; false if transitions are
+    // off, one is already running or there is no memory
+    bool capture(lv_obj_t* scr);
+
+    // scr shows the new theme: fade to it from the captured frame
+    void start(lv_obj_t* scr);
+
+    // Remove the cover and free the frames at once (e.g. the OTA screen)
+    void cancel();
+
+    // Fade to the live screen if no start() followed a capture in time
+    void poll();
+
+    bool isCaptured() const { return state == CAPTURED; }
+    bool isActive() const { return state != IDLE; }
+
+    // Counters and the cost of the last blend step
+    void writeJson(Print& out) const;
+
+    static const uint32_t FADE_MS = 300;
+    static const uint32_t CAPTURE_TIMEOUT_MS = 1000;
+
+private:
+    enum State : uint8_t { IDLE, CAPTURED, FADING };
+
+    struct Frame {
+        lv_img_dsc_t dsc;
+        uint8_t* buf;               // PSRAM, nullptr when not held
+    };
+
+    bool snapshot(lv_obj_t* scr, Frame& frame);
+    void releaseFrame(Frame& frame);
+    void finish();
+    void blend(uint8_t level);
+    static void blendRows(void* arg, uint32_t first, uint32_t end);
+
+    static void onBlendStep(void* var, int32_t level);
+    static void onOpacityStep(void* var, int32_t opa);
+    static void onFadeDone(lv_anim_t* a);
+
+    volatile bool enabled;
+    State state;
+    lv_obj_t* cover;                // Full-screen image on lv_layer_top()
+    Frame from;
+    Frame to;
+    Frame mix;                      // What the cover shows while blending
+    uint32_t frameSize;
+    unsigned long capturedAt;
+    uint8_t level;                  // Last blended step, 0..BLEND_LEVELS
+    uint8_t blendLevel;             // Step being blended, for blendRows
+
+    uint32_t fades;
+    uint32_t opacityFades;          // No room for the blend buffers
+    uint32_t skipped;               // No room for the first frame
+    uint32_t timeouts;
+    uint32_t lastBlendUs;
+
+    static const uint8_t BLEND_LEVELS = 32;
+    static const uint32_t BLEND_CHUNK_PX = 480;     // Unit the blend is split in (a row)
+};
+
+// Global instance
+extern ThemeTransition themeTransition;
+
+#endif // THEME_TRANSITION_H
@@ -2,6 +2,8 @@
 #define TIME_MANAGER_H
 
 #include <Arduino.h>
+#include <time.h>
+#include <freertos/FreeRTOS.h>
 
 class TimeManager {
 public:
@@ -20,11 +22,19 @@ public:
     uint8_t getCurrentHour() const;    // 0-23
     uint8_t getCurrentMinute() const;  // 0-59
 
-    // Set time from server-provided Unix timestamp (faster than NTP)
-    void setTimeFromServer(uint32_t unixTimestamp);
+    // Local seconds since midnight (0 before the clock is set)
+    uint32_t getSecondsOfDay() const;
+
+    // Broken-down local time for now, converted (TZ rules and all) only
+    // when now leaves the cached minute. Any task.
+    void getLocalNow(struct tm& out) const;
 
-    // Update function - call periodically to re-sync NTP
-    void update();
+    // Any task: set time from a server-provided Unix timestamp (config
+    // fetches, state pushes and channel pings carry one), so the schedules
+    // are right from the first response instead of after NTP. Once synced
+    // the clock is only stepped if it is more than SERVER_TIME_TOLERANCE_S
+    // off; implausible timestamps are ignored.
+    void setTimeFromServer(uint32_t unixTimestamp);
 
     // Force an NTP sync
     void forceSync();
@@ -32,17 +42,39 @@ public:
 private:
     String currentTimezone;
     bool synced;
-    unsigned long lastSyncAttempt;
     unsigned long lastSuccessfulSync;
+    int8_t syncJob;
 
     static const unsigned long SYNC_INTERVAL_MS = 3600000;  // 1 hour
     static const unsigned long SYNC_RETRY_MS = 60000;       // 1 minute retry on failure
+    static const uint16_t MINUTES_PER_DAY = 1440;
+    static const uint32_t SERVER_TIME_TOLERANCE_S = 2;       // Request latency, second truncation
+    static const uint32_t MIN_SERVER_TIME = 1700000000;     // Sanity check: after Nov 2023
     static const char* NTP_SERVER1;
     static const char* NTP_SERVER2;
     static const char* NTP_SERVER3;
 
+    // Scheduler job: sync check, re-armed hourly once synced
+    static void onSyncTimer(void* arg);
+
+    // Scheduler job at each local minute boundary: refresh the cache and
+    // tell the wall-clock jobs if local time did not simply advance (DST)
+    static void onMinuteTimer(void* arg);
+
     void attemptSync();
     bool checkSyncStatus();
+
+    // The schedulers' deadlines were derived from the old clock
+    void noteClockChanged();
+
+    void armMinuteTimer();
+
+    // Local time at cachedMinuteStart, with tm_sec zeroed
+    mutable struct tm cachedMinute;
+    mutable time_t cachedMinuteStart;       // -1 when stale
+    mutable portMUX_TYPE cacheMux;
+    uint16_t tickedMinuteOfDay;             // At the last minute timer
+    int8_t minuteJob;
 };
 
 // Global instance
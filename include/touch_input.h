@@ -0,0 +1,125 @@
+#ifndef TOUCH_INPUT_H
+#define TOUCH_INPUT_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "gesture_engine.h"
+
+// One sampled change of the touch state, in screen coordinates
+struct TouchEvent {
+    int64_t timeUs;             // esp_timer time of the sample
+    int16_t x;
+    int16_t y;
+    bool pressed;
+    bool cancel;                // A gesture took over this touch; LVGL drops its press
+};
+
+// Reads the controller once: the number of contacts (0 = released), with up
+// to max points in screen coordinates, primary first. Only ever called from
+// the sampling task.
+typedef uint8_t (*TouchSampleFn)(TouchPoint* points, uint8_t max);
+
+// Samples the GT911 from its own task so a slow frame can't delay or drop
+// touches, and hands LVGL the result as a queue of timestamped events.
+//
+// The sampling task runs above the LVGL task and reads the controller every
+// ACTIVE_PERIOD_MS while a finger is down. Each press, release and move is
+// pushed into a ring of QUEUE_SIZE events; the LVGL read callback pops one
+// per call and sets continue_reading while more are queued, so a tap that
+// started and ended during a long rebuild is still replayed as a press and
+// a release instead of vanishing. If LVGL falls far enough behind to fill
+// the ring, consecutive moves are merged first; presses and releases are
+// only dropped (oldest first) once nothing else is left to merge.
+//
+// Every sample, with all its contacts, also goes through the gesture engine.
+// When a gesture claims the touch the next event carries cancel, so the
+// press LVGL is tracking ends without a click.
+//
+// With the controller's INT line wired (TOUCH_INT >= 0) the idle task
+// sleeps until the line toggles, with a slow safety poll for a missed
+// edge. Without INT the panel is polled at a rate that follows activity:
+// RECENT_PERIOD_MS for a while after the last touch (taps tend to come in
+// runs), IDLE_PERIOD_MS otherwise. Either way a new event wakes the LVGL
+// task and makes the read timer due at once.
+class TouchInput {
+public:
+    TouchInput();
+
+    // Call after the indev is registered and the controller initialized;
+    // starts the sampling task
+    void begin(lv_indev_t* indev, int intPin, TouchSampleFn sample);
+
+    // Read callback: next queued event, or the last delivered state when
+    // none is queued. more = further events are waiting.
+    void next(TouchEvent& event, bool& more);
+
+    // LVGL task, before lv_timer_handler(): run the read now if events are
+    // queued, and pace the read timer to the touch activity
+    void service();
+
+    // LVGL task, paced refresh (see LVGLTask::setFramePacing): a frame is
+    // about to render, so a held touch is read now and the frame shows
+    // where the finger is
+    void alignToFrame();
+    // A finger is down, or was until a moment ago (scroll throw, taps)
+    bool isTracking() const;
+
+    bool usesInterrupt() const { return intPin >= 0; }
+    // Any task: millis() of the last sample with a finger down, 0 if none yet
+    unsigned long getLastTouchAt() const { return sampledTouchAt; }
+    uint32_t getSamples() const { return samples; }
+    uint32_t getEvents() const { return events; }
+    uint32_t getMerged() const { return merged; }
+    uint32_t getDropped() const { return dropped; }
+
+    static const uint32_t ACTIVE_PERIOD_MS = 10;        // GT911 reports at ~100 Hz
+    static const uint32_t RECENT_PERIOD_MS = 20;
+    static const uint32_t IDLE_PERIOD_MS = 50;
+    static const unsigned long RECENT_WINDOW_MS = 1500;
+    static const unsigned long SAFETY_POLL_MS = 1000;   // INT mode, without an edge
+    static const uint8_t QUEUE_SIZE = 32;               // ~320 ms of drag at the active rate
+
+    static const uint32_t TASK_STACK_SIZE = 3072;
+    static const UBaseType_t TASK_PRIORITY = 3;         // Above the LVGL task (2)
+    static const BaseType_t TASK_CORE = 1;              // Wire stays off the WiFi core
+
+private:
+    static void taskMain(void* arg);
+    static void IRAM_ATTR onInterrupt(void* arg);
+    void push(const TouchEvent& event);
+    bool isRecent(unsigned long touchAt, unsigned long now) const;
+    void setPeriod(uint32_t period);
+
+    TaskHandle_t taskHandle;
+    TouchSampleFn sampleFn;
+    lv_timer_t* readTimer;
+    int intPin;
+
+    // Ring, shared between the sampling task and the LVGL task
+    TouchEvent queue[QUEUE_SIZE];
+    uint8_t head;
+    uint8_t count;
+    portMUX_TYPE mux;
+
+    // Sampling task
+    TouchEvent sampled;         // Last state pushed
+    bool sampledClaimed;        // Gesture engine owns the current touch
+    unsigned long sampledTouchAt;
+
+    // LVGL task
+    TouchEvent delivered;       // Last state handed to LVGL
+    unsigned long deliveredTouchAt;
+    uint32_t periodMs;
+
+    uint32_t samples;
+    uint32_t events;
+    uint32_t merged;
+    uint32_t dropped;
+};
+
+// Global instance
+extern TouchInput touchInput;
+
+#endif // TOUCH_INPUT_H
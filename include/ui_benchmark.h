@@ -0,0 +1,98 @@
+#ifndef UI_BENCHMARK_H
+#define UI_BENCHMARK_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "perf_monitor.h"
+#include "config_manager.h"
+#include "layout_plan.h"
+
+// On-device UI benchmark over the project's own layouts.
+//
+// For every theme (light, dark, cyberpunk, LCARS) and 1..MAX_PAGE_CARDS
+// buttons (more only add pages that aren't built), a generated config is applied and the UI rebuilt exactly as a
+// config push would, then a fixed script runs against the live widgets:
+// every light/switch card is tapped twice, every fan card opens its
+// overlay, drags the slider up and back down and closes it, and finally a
+// no-op rebuild exercises the reconcile path. Each scenario reports frames,
+// FPS while scripted, frame/render/flush percentiles from PerfMonitor,
+// rebuild times and heap deltas.
+//
+// Started with POST /api/bench (report at GET /api/bench) or, in the
+// esp32s3-bench build env, on boot with the report printed to serial.
+// UI actions are not sent to the server during a run, and the previous
+// config is re-applied at the end, so a config pushed mid-run is lost.
+// A full run takes about two minutes.
+enum BenchState : uint8_t {
+    BENCH_IDLE = 0,
+    BENCH_RUNNING,
+    BENCH_DONE,
+    BENCH_FAILED
+};
+
+class UIBenchmark {
+public:
+    UIBenchmark();
+
+    // Start a run on its own task; false if one is already running
+    bool start(bool printReport = false);
+
+    BenchState getState() const { return state; }
+
+    // Status, and the report once a run has finished
+    void writeJson(Print& out) const;
+
+    static const uint8_t THEME_COUNT = 4;
+    static const uint8_t MAX_SCENARIOS = THEME_COUNT * MAX_PAGE_CARDS;
+    static const uint32_t STEP_MS = 120;            // Between scripted inputs
+    static const uint32_t SETTLE_MS = 400;          // After a rebuild, before measuring
+    static const uint32_t REBUILD_TIMEOUT_MS = 5000;
+
+private:
+    struct Scenario {
+        uint8_t theme;
+        uint8_t buttons;
+        bool rebuilt;               // Config apply led to a full rebuild (vs. reconcile)
+        uint32_t applyUs;           // Config parse -> UI updated, end to end
+        uint32_t rebuildUs;         // The UI pass alone
+        uint32_t reconcileUs;       // UI pass for the same config again
+        uint32_t scriptMs;
+        uint32_t frames;
+        uint16_t inputs;
+        PerfSummary frame;
+        PerfSummary render;
+        PerfSummary flush;
+        int32_t internalDelta;      // Free heap lost over the scenario
+        int32_t psramDelta;
+        uint32_t internalLargest;   // Largest free internal block afterwards
+    };
+
+    static void benchTask(void* parameter);
+    void run();
+    bool runScenario(uint8_t theme, uint8_t buttons, Scenario& result);
+    // Parse json (nullptr: keep the config) and wait for the UI pass
+    bool applyConfig(const String* json, uint32_t& totalUs, uint32_t& passUs, bool& full);
+    uint16_t runScript();
+    String buildConfig(uint8_t theme, uint8_t buttons) const;
+
+    volatile BenchState state;
+    bool printReport;
+    TaskHandle_t taskHandle;
+    Scenario* scenarios;            // PSRAM, kept for the last report
+    uint8_t scenarioCount;
+    uint8_t scenarioTotal;
+    unsigned long startedAt;
+    unsigned long durationMs;
+    uint32_t internalBefore;
+    uint32_t internalAfter;
+    uint32_t psramBefore;
+    uint32_t psramAfter;
+    char sketchMd5[33];
+    const char* error;
+};
+
+// Global instance
+extern UIBenchmark uiBenchmark;
+
+#endif // UI_BENCHMARK_H
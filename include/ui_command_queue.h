@@ -0,0 +1,57 @@
+#ifndef UI_COMMAND_QUEUE_H
+#define UI_COMMAND_QUEUE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+// UI changes requested from other tasks (web server, HTTP worker, schedulers),
+// applied by the LVGL task once per frame
+enum class UICommandType : uint8_t {
+    BUTTON_STATE,   // buttonId, value = 0/1
+    FAN_SPEED,      // buttonId, value = speed level
+    ACTION_FAILED,  // buttonId (the server didn't take a press)
+    BRIGHTNESS,     // value = 0-100
+    THEME,          // value = ThemeId, flag = rebuild afterwards
+    LCARS_FIELD,    // buttonId = LCARSField (the text is kept by UIManager)
+    SENSOR_SAMPLE,  // buttonId (the samples are kept by SensorHistory)
+    REBUILD
+};
+
+struct UICommand {
+    UICommandType type;
+    uint8_t buttonId;
+    uint8_t value;
+    bool flag;
+};
+
+// Fixed-capacity, allocation-free multi-producer ring. Posting a command that
+// targets the same thing as one still queued (same button or LCARS field, or
+// any brightness/theme/rebuild) overwrites it in place, so bursts cost one slot.
+class UICommandQueue {
+public:
+    UICommandQueue();
+
+    // Queue a command (any task). Returns false if the ring is full.
+    bool post(const UICommand& cmd);
+
+    // Pop the oldest command (consumer task only)
+    bool pop(UICommand& cmd);
+
+    bool isEmpty() const { return count == 0; }
+
+    // Commands refused because the ring was full
+    uint32_t getDropped() const { return dropped; }
+
+    static const uint8_t CAPACITY = 32;
+
+private:
+    UICommand items[CAPACITY];
+    uint8_t head;
+    volatile uint8_t count;
+    uint32_t dropped;
+    portMUX_TYPE mux;
+
+    static bool sameTarget(const UICommand& a, const UICommand& b);
+};
+
+#endif // UI_COMMAND_QUEUE_H
@@ -5,10 +5,15 @@
 #include <lvgl.h>
 #include "config_manager.h"
 #include "theme_engine.h"
+#include "layout_plan.h"
+#include "card_tile_cache.h"
+#include "ui_command_queue.h"
+#include "control_stream.h"
 
 // Callback function type for button/scene press events
 typedef void (*UIButtonCallback)(uint8_t buttonId, bool newState);
 typedef void (*UISceneCallback)(uint8_t sceneId);
+typedef void (*UIFanSpeedCallback)(uint8_t buttonId, uint8_t speedLevel);
 
 // UI element tracking for a button card
 struct UIButtonCard {
@@ -24,12 +29,40 @@ struct UIButtonCard {
     bool isSceneButton;    // True if this is a scene-type button
     String sceneId;        // Scene ID for scene-type buttons
     bool iconIsImage;      // True if icon is lv_img, false if lv_label
+    uint8_t poolKind;      // Widget-tree shape, used to match pooled cards
+    lv_obj_t* chart;       // Sensor cards' history chart (stateLabel shows the value)
 };
 
+// Parts of the fan overlay that differ from its model (FanOverlayState::dirty)
+enum FanOverlayDirty : uint8_t {
+    FAN_DIRTY_STATUS = 1 << 0,  // Speed name
+    FAN_DIRTY_SLIDER = 1 << 1,  // Range and value, unless the finger moved it
+    FAN_DIRTY_LIT    = 1 << 2,  // Slider indicator colour (off/on)
+    FAN_DIRTY_ICON   = 1 << 3,  // Static off icon, or spinning at the level's rate
+    FAN_DIRTY_ALL    = 0x0F
+};
+
+// Pre-rotated fan icons: the icon has three blades, so frames cover 120 degrees
+static const uint8_t FAN_SPIN_FRAMES = 12;
+static const uint16_t FAN_SPIN_SPAN_DEG = 120;
+
 // Fan speed overlay state
 struct FanOverlayState {
     bool visible;
     int cardIndex;
+    // What the overlay shows; applyFanOverlay() writes only the dirty parts,
+    // so a push repeating the shown level touches (and redraws) nothing
+    uint8_t level;
+    uint8_t steps;
+    uint8_t dirty;
+    // Spinning icon: frames of the lit icon, rotated and tinted once, then
+    // cycled by fanSpinTimer (never a per-frame transform or restyle)
+    bool spinning;
+    uint8_t spinFrame;
+    lv_img_dsc_t spinFrames[FAN_SPIN_FRAMES];
+    uint8_t* spinBuf;           // PSRAM, only held while the overlay is open
+    uint32_t spinSize;
+    uint16_t spinColor;         // lv_color_t.full the frames were tinted with
     lv_obj_t* overlay;
     lv_obj_t* panel;
     lv_obj_t* titleLabel;
@@ -38,12 +71,30 @@ struct FanOverlayState {
     lv_obj_t* sliderTrack;
     lv_obj_t* fanIcon;
     lv_obj_t* closeBtn;
+    lv_obj_t* backdrop;         // Pre-dimmed snapshot of the screen behind the overlay
+    lv_img_dsc_t backdropDsc;
+    uint8_t* backdropBuf;       // PSRAM, only held while the overlay is open
+    uint32_t backdropSize;
+};
+
+// LCARS frame labels the server can update live ({"t":"fields"}, see
+// server_channel.h), in UIManager::LCARS_FIELD_IDS order
+enum LCARSField : uint8_t {
+    LCARS_HEADER_LEFT = 0,      // "LCARS" title box
+    LCARS_HEADER_RIGHT,         // "HOME CTRL" box
+    LCARS_FOOTER_LEFT,          // Stardate box
+    LCARS_FOOTER_RIGHT,         // Deck/section box
+    LCARS_SIDEBAR_TOP,          // Sidebar numbers
+    LCARS_SIDEBAR_BOTTOM,
+    LCARS_FIELD_COUNT
 };
 
 // Server change confirmation state
 struct ServerChangeState {
     bool pending;
     String newReportingUrl;
+    bool changeCa;              // newCaCert replaces the stored CA ("" removes it)
+    String newCaCert;
     lv_obj_t* overlay;
     lv_obj_t* panel;
     lv_obj_t* titleLabel;
@@ -58,6 +109,24 @@ struct UISceneButton {
     uint8_t sceneId;
     lv_obj_t* button;
     lv_obj_t* label;
+    lv_obj_t* icon;        // Image icon (standard themes only), nullptr otherwise
+};
+
+// What the live widget tree was built from. Config changes that leave this
+// untouched are patched in place instead of rebuilding the screen.
+struct UILayoutSignature {
+    bool valid;
+    ThemeId theme;
+    uint32_t themeRevision;     // Custom themes can change under the same id
+    uint8_t numButtons;
+    uint8_t numScenes;
+    uint8_t pages;
+    CardLayout cardLayout;
+    bool cardTiles;
+    bool background;            // An animated background was loaded (background_anim.h)
+    ButtonType buttonTypes[MAX_BUTTONS];
+    bool buttonImageIcons[MAX_BUTTONS];
+    bool sceneImageIcons[MAX_SCENES];
 };
 
 class UIManager {
@@ -70,18 +139,53 @@ public:
     // Create the complete UI based on current config
     void createUI();
 
-    // Rebuild UI (e.g., after config change or theme change)
+    // Rebuild UI (e.g., after config change or theme change). The new
+    // screen is built off-screen a stage at a time by update() and loaded
+    // once complete; a rebuild already under way starts over.
     void rebuildUI();
 
+    // Patch the live UI to match the current config; returns false if the
+    // layout changed and a full rebuild is required
+    bool reconcileUI();
+
     // Request a deferred UI rebuild (thread-safe, for use from web server callbacks)
     void requestRebuild();
 
-    // Check if rebuild is needed and perform it (call from main loop)
+    // Queue UI changes from other tasks (thread-safe, applied by the LVGL task)
+    void postButtonState(uint8_t buttonId, bool state);
+    void postFanSpeed(uint8_t buttonId, uint8_t speedLevel);
+    void postActionFailed(uint8_t buttonId);
+    void postBrightness(uint8_t brightness);
+    void postTheme(ThemeId id, bool rebuild);
+    // Posts lost to a full command queue
+    uint32_t getCommandsDropped() const { return commandQueue.getDropped(); }
+
+    // Live text for an LCARS frame label (id as in LCARS_FIELD_IDS; any
+    // task). Only that label is relabelled, no rebuild; the value is kept
+    // for screens built later and "" brings back the built-in text. False
+    // for an unknown id.
+    bool postLCARSField(const char* id, const char* value);
+    static const uint8_t LCARS_FIELD_LEN = 32;     // Including the terminator
+    static const char* const LCARS_FIELD_IDS[LCARS_FIELD_COUNT];
+
+    // A sample for a sensor button (any task): kept in sensorHistory, and
+    // its card, if shown, redraws its value and chart. False if the button
+    // isn't a sensor or the value isn't a number.
+    bool postSensorSample(uint8_t buttonId, float value);
+
+    // Apply queued commands and any pending rebuild (call from the LVGL task)
     void update();
 
-    // Update a single button's visual state
+    // Update a single button's visual state (only its config state when
+    // the button is on another page)
     void updateButtonState(uint8_t buttonId, bool state);
 
+    // Show another page of button cards (ignored if there is no such page);
+    // side swipes and the page indicator call this
+    void showPage(uint8_t page);
+    uint8_t getPage() const { return currentPage; }
+    uint8_t getPageCount() const { return plan.pages; }
+
     // Update all button visuals (e.g., after theme change)
     void refreshAllButtons();
 
@@ -91,20 +195,32 @@ public:
     // Set the callback for scene activation events
     void setSceneCallback(UISceneCallback callback);
 
-    // Set brightness (0-100)
+    // Set the callback for fan speed changes (falls back to the button callback)
+    void setFanSpeedCallback(UIFanSpeedCallback callback);
+
+    // Set brightness (0-100), with the backlight's default fade or over fadeMs
     void setBrightness(uint8_t brightness);
+    void setBrightness(uint8_t brightness, uint32_t fadeMs);
 
     // Get current brightness
     uint8_t getBrightness() const;
 
     // Get LVGL symbol for icon name
-    static const char* getIconSymbol(const String& iconName);
+    static const char* getIconSymbol(IconId icon);
 
     // Check if icon uses an image instead of a symbol
-    static bool isImageIcon(const String& iconName);
+    static bool isImageIcon(IconId icon);
 
     // Get the image descriptor for an image-based icon
-    static const lv_img_dsc_t* getIconImage(const String& iconName);
+    static const lv_img_dsc_t* getIconImage(IconId icon);
+
+    // Show image src on img in color: a pre-tinted copy for A8 icons
+    // (icon_tint_cache.h), img_recolor when there is no room for one, color
+    // images as they are. src may be a copy already.
+    static void setIconImage(lv_obj_t* img, const void* src, lv_color_t color);
+
+    // Recolor the icon img shows
+    static void setIconColor(lv_obj_t* img, lv_color_t color);
 
     // Fan speed control
     void showFanOverlay(int cardIndex);
@@ -112,8 +228,18 @@ public:
     void setFanSpeed(uint8_t buttonId, uint8_t speedLevel);
     uint8_t getFanSpeed(uint8_t buttonId) const;
 
+    // State updates dropped because they matched what's already shown
+    uint32_t getSuppressedUpdates() const { return suppressedUpdates; }
+
+    // Completed reconcile/rebuild passes, and how long the last one took
+    uint32_t getRebuildCount() const { return rebuildCount; }
+    uint32_t getLastRebuildUs() const { return lastRebuildUs; }
+    bool wasLastRebuildFull() const { return lastRebuildFull; }
+
     // Server change confirmation
-    void showServerChangeConfirmation(const String& newReportingUrl);
+    // caCert: PEM to trust for the server's HTTPS, "" to drop the stored
+    // one, nullptr to leave it as is
+    void showServerChangeConfirmation(const String& newReportingUrl, const char* caCert = nullptr);
     void hideServerChangeConfirmation();
     bool isServerChangePending() const;
     String getPendingReportingUrl() const;
@@ -121,29 +247,149 @@ public:
     // OTA update screen
     void showOTAScreen();
     void updateOTAProgress(int percent);
+    // Back to the main screen after a failed update
+    void hideOTAScreen();
 
 private:
+    // Scripts taps, slider drags and overlays against the live widgets
+    friend class UIBenchmark;
+    // Names the screen's subtrees for the object tree report
+    friend class UITreeDiag;
+
     // UI elements
     lv_obj_t* screen;
     lv_obj_t* header;
     lv_obj_t* contentArea;
     lv_obj_t* actionBar;
-
-    // Button and scene tracking
-    UIButtonCard buttonCards[MAX_BUTTONS];
+    lv_obj_t* headerTitle;      // Standard header labels (nullptr for other layouts)
+    lv_obj_t* headerSubtitle;
+    lv_obj_t* lcarsCountLabel;  // LCARS "active systems" counter
+    lv_obj_t* lcarsFrame;       // Paints the static LCARS frame, parent of its labels
+    const lv_img_dsc_t* lcarsElbow;  // Unpacked elbow the frame draws, nullptr without memory
+    lv_obj_t* lcarsFieldLabels[LCARS_FIELD_COUNT];
+    lv_obj_t* ipLabel;          // Cyberpunk data bar address
+
+    // Layout the current widget tree was built from
+    UILayoutSignature layout;
+    void recordLayout();
+    static bool cardUsesImage(const ButtonConfig& config);
+
+    // Parked card trees, re-bound to new configs instead of being recreated
+    UIButtonCard cardPool[MAX_PAGE_CARDS];
+    uint8_t cardPoolCount;
+    lv_obj_t* cardPoolParent;   // Off-screen parent holding parked cards
+    static uint8_t cardKind(const ButtonConfig& config, const LayoutPlan& slots);
+    bool acquirePooledCard(int index, const ButtonConfig& config, uint8_t kind,
+                           int x, int y, int w, int h);
+    void releaseCard(UIButtonCard& card);
+    void trimCardPool();
+
+    // In-place patching used by reconcileUI()
+    void patchButtonCard(int index, const ButtonConfig& config, bool restyle);
+    void patchSceneButton(int index, const SceneConfig& config, bool restyle);
+    void replaceButtonCards(const DeviceConfig& config, uint8_t count);
+    bool applyCardName(UIButtonCard& card, const char* name, int cardWidth);  // True if the text changed
+    String sceneLabelText(const SceneConfig& config) const;
+
+    // Button and scene tracking. Only the shown page has cards: slot i holds
+    // config.buttons[firstOnPage() + i]; the config keeps every button's state.
+    UIButtonCard buttonCards[MAX_PAGE_CARDS];
+    uint8_t cardIndexById[256];     // buttonId -> buttonCards slot (0xFF if not shown)
+    void rebuildCardIndex();
+    UIButtonCard* findCard(uint8_t buttonId);
+    const UIButtonCard* findCard(uint8_t buttonId) const;
     UISceneButton sceneButtons[MAX_SCENES];
     uint8_t numButtons;
+    uint8_t numCards;               // Cards on the shown page
     uint8_t numScenes;
+    uint8_t currentPage;
+    int firstOnPage() const { return currentPage * plan.perPage; }
+
+    // Page indicator dots (only with more than one page)
+    lv_obj_t* pager;
+    void createPager();
+    void updatePager();
+    static void onPagerClicked(lv_event_t* e);
+
+    // Idle cards drawn from pre-rendered tiles (card_tile_cache.h): the image
+    // object standing in for each slot's card, and the cards waiting to
+    // settle before they are tiled. Pressed or animating cards draw live.
+    bool tilesOn;                   // display.cardTiles, except on Cyberpunk or over an animated background
+    lv_obj_t* cardTiles[MAX_PAGE_CARDS];
+    uint16_t tilePending;           // Bit per slot
+    lv_timer_t* tileTimer;
+    bool cardShowsTile(int index) const;
+    bool showCardTile(int index);
+    void placeCardTile(int index, const CardTile& tile);
+    void showCardLive(int index);
+    void scheduleCardTile(int index);
+    void settleCardTiles();
+    void dropCardTiles(int index);
+
+    // Fading red outline on a card whose press the server didn't take
+    void flagActionFailed(uint8_t buttonId);
+    static const uint32_t ACTION_FAILED_HOLD_MS = 400;
+    static const uint32_t ACTION_FAILED_FADE_MS = 1200;
+
+    // Scene card press flash: one plain rectangle laid over the card and
+    // faded in a few steps at a capped rate. Each step redraws only the
+    // card's area, and the card itself (and its tile) is never restyled.
+    lv_obj_t* pressFlash;
+    lv_timer_t* pressFlashTimer;
+    uint8_t pressFlashStep;
+    void flashCard(int index, lv_color_t color);
+    static void onPressFlashTimer(lv_timer_t* timer);
+    static const uint32_t PRESS_FLASH_STEP_MS = 50;    // 20 fps
+    static const uint8_t PRESS_FLASH_HOLD_STEPS = 2;   // At full strength
+    static const uint8_t PRESS_FLASH_FADE_STEPS = 4;
+    void clearCardTiles();
+    void bindCardPress(int index);
+    static void onCardPress(lv_event_t* e);
+    static void onTileTimer(lv_timer_t* timer);
 
     // Callbacks
     UIButtonCallback buttonCallback;
     UISceneCallback sceneCallback;
+    UIFanSpeedCallback fanSpeedCallback;
 
     // Current brightness
     uint8_t currentBrightness;
+    uint32_t suppressedUpdates;
 
     // Flag for deferred UI rebuild (set from web server, processed in main loop)
     volatile bool needsRebuild;
+    volatile uint32_t rebuildCount;
+    uint32_t lastRebuildUs;
+    bool lastRebuildFull;
+    uint32_t rebuildGeneration;     // Config generation the pending rebuild started from
+
+    // Staged rebuild: the next screen is built off-screen over several LVGL
+    // passes (frame, then BUILD_CARDS_PER_PASS cards a pass, then decor) so
+    // touch and rendering keep running, and loaded only once complete
+    enum class BuildStage : uint8_t { IDLE, FRAME, CARDS, DECOR };
+    BuildStage buildStage;
+    lv_obj_t* liveScreen;           // Still shown while screen is built
+    lv_obj_t* buildShield;          // Swallows taps on liveScreen, whose cards no longer match buttonCards
+    UIButtonCard retiredCards[MAX_PAGE_CARDS];  // liveScreen's cards, pooled at the swap
+    uint8_t numRetired;
+    static const uint8_t BUILD_CARDS_PER_PASS = 2;
+    bool isBuilding() const { return buildStage != BuildStage::IDLE; }
+    void beginScreen();             // Theme, screen style, counts and plan for a new build
+    bool buildStep(int cardBudget); // True once the build is complete
+    void abandonBuild();
+    void swapBuiltScreen();
+    void finishRebuild();
+    ThemeId tintTheme;              // Theme the cached icon and decoration copies were made for
+    uint32_t tintRevision;
+
+    // Cover the screen with its current frame before the theme changes, to
+    // fade from once the new theme is built (theme_transition.h)
+    void beginThemeTransition();
+
+    // Commands posted from other tasks, drained once per frame
+    UICommandQueue commandQueue;
+    void postCommand(const UICommand& cmd);
+    void processCommands();
 
     // PWM channel for backlight
     static const uint8_t BACKLIGHT_PWM_CHANNEL = 0;
@@ -151,31 +397,70 @@ private:
 
     // Create individual UI components
     void createHeader();
-    void createButtonGrid();
+    void createButtonGrid(const DeviceConfig& config);  // The shown page's cards, any theme
+    void createGridCard(const DeviceConfig& config, int index);
     void createActionBar();
 
-    // Create LCARS-specific layout
-    void createLCARSLayout();
-    void createLCARSCard(int index, const ButtonConfig& config, int x, int y, int w, int h);
+    // Create LCARS-specific layout: the frame and section title above the
+    // cards, then the status section, scenes and footer below them
+    void createLCARSFrame();
+    void createLCARSStatus();
+    void createLCARSCard(int index, const ButtonConfig& config);
+
+    // Sensor cards (any theme): value and history chart, not pressable and
+    // never tiled. refreshSensorCard() redraws only the value and chart.
+    void createSensorCard(int index, const ButtonConfig& config);
+    void layoutSensorCard(UIButtonCard& card);
+    void styleSensorCard(UIButtonCard& card);
+    void refreshSensorCard(UIButtonCard& card);
+    static const uint16_t SENSOR_CHART_MAX_POINTS = 256;
+    static void onLCARSFrameDraw(lv_event_t* e);
+    static void onLCARSFrameHitTest(lv_event_t* e);
+
+    // Live LCARS field text, "" for the built-in text; written by any task
+    // under lcarsFieldMux, applied to the labels by the LVGL task
+    char lcarsFieldText[LCARS_FIELD_COUNT][LCARS_FIELD_LEN];
+    portMUX_TYPE lcarsFieldMux;
+    lv_obj_t* createLCARSFieldLabel(lv_obj_t* parent, LCARSField field);
+    void applyLCARSField(uint8_t field);
 
     // Cyberpunk decorations (grid lines, data bar, accent elements)
     void createCyberpunkDecorations();
 
+    // Static Cyberpunk decor is drawn directly instead of built from objects
+    static void onCyberpunkBackgroundDraw(lv_event_t* e);
+    static void onCyberpunkCardDraw(lv_event_t* e);
+
 
     // Fan overlay functions
     void createFanOverlay();
-    void updateFanOverlayVisuals();
+    void setFanOverlayLevel(uint8_t level, bool fromSlider);
+    void applyFanOverlay();
+    bool captureFanBackdrop();
+    void releaseFanBackdrop();
+    bool buildFanSpinFrames(lv_color_t color);
+    void updateFanSpin(lv_color_t litColor);
+    void stopFanSpin(lv_color_t offColor);
+    void releaseFanSpin();
+    static void onFanSpinTimer(lv_timer_t* timer);
+    lv_timer_t* fanSpinTimer;   // Paused while the icon is still
+    // One frame (10 degrees) per FAN_SPIN_STEP_MS at the top speed, slower
+    // below it: 25 icon-sized redraws a second at most
+    static const uint32_t FAN_SPIN_STEP_MS = 40;
     static void onFanSliderChanged(lv_event_t* e);
     static void onFanOverlayClose(lv_event_t* e);
+    static void sendFanSpeed(uint8_t buttonId, int speedLevel);
 
     // Fan overlay state
     FanOverlayState fanOverlay;
+    ControlStream fanStream;    // Slider levels sent while dragging
 
     // Server change confirmation state
     ServerChangeState serverChangeState;
 
     // OTA update screen state
     lv_obj_t* otaScreen;
+    lv_obj_t* otaProgressBar;
     lv_obj_t* otaProgressLabel;
 
     // Server change confirmation UI
@@ -183,8 +468,8 @@ private:
     static void onServerChangeAccept(lv_event_t* e);
     static void onServerChangeReject(lv_event_t* e);
 
-    // Create a single button card
-    void createButtonCard(int index, const ButtonConfig& config, int gridX, int gridY);
+    // Create a single button card in its plan slot
+    void createButtonCard(int index, const ButtonConfig& config);
 
     // Create a scene button in the action bar
     void createSceneButton(int index, const SceneConfig& config, bool isLeft);
@@ -192,14 +477,16 @@ private:
     // Update visual state of a card
     void updateCardVisual(UIButtonCard& card);
 
-    // Calculate grid layout based on button count
-    void calculateGridLayout(int numButtons, int& cols, int& rows,
-                            int& cardWidth, int& cardHeight, int& gap);
+    // Card positions and sizes for the current counts, theme family and
+    // display.layout, re-planned only when one of them changes
+    LayoutPlan plan;
+    void updateLayoutPlan();
 
     // Event handlers (static for LVGL callbacks)
     static void onToggleChanged(lv_event_t* e);
     static void onCardClicked(lv_event_t* e);
     static void onSceneClicked(lv_event_t* e);
+    static void onTintedIconDeleted(lv_event_t* e);
 
     // Setup PWM for backlight
     void setupBacklightPWM();
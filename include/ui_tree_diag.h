@@ -0,0 +1,48 @@
+#ifndef UI_TREE_DIAG_H
+#define UI_TREE_DIAG_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+class Print;
+
+// What the active screen is made of, per top-level subtree, served at
+// /api/diag/ui_tree: the header, each card (and its tile), the action bar,
+// the LCARS frame, decorations, overlays and the parked card pool.
+//
+// For each subtree it counts the objects, their local styles and style
+// properties, and estimates the LVGL heap they hold: each object's
+// instance, its child and event lists, its style list, local style values
+// and label text, plus an allocator overhead per block. Images' pixels are
+// not LVGL heap (they live in the PSRAM budget) and aren't counted.
+//
+// Draw time is measured by rendering each visible subtree alone into an
+// off-screen snapshot (LVGL's draw code, without the flush), so a subtree's
+// cost is comparable across themes and layouts. That holds the LVGL lock
+// for a frame or two; withDraw false reports only the counts.
+class UITreeDiag {
+public:
+    // Walk the active screen (takes the LVGL lock)
+    void writeJson(Print& out, bool withDraw);
+
+private:
+    struct Totals {
+        uint32_t objects;
+        uint32_t localStyles;
+        uint32_t styleProps;
+        uint32_t heapBytes;
+    };
+
+    static void measure(lv_obj_t* obj, Totals& totals);
+    static int32_t drawUs(lv_obj_t* obj);   // -1 if it couldn't be drawn
+    void writeSubtree(Print& out, lv_obj_t* obj, const char* role, int id, bool withDraw, bool& first);
+    const char* roleOf(lv_obj_t* obj, int& id) const;
+
+    static const uint32_t ALLOC_OVERHEAD = 8;       // Per heap block (TLSF header, alignment)
+    static const uint32_t EVENT_DSC_BYTES = 12;     // Callback, filter, user data
+};
+
+// Global instance
+extern UITreeDiag uiTreeDiag;
+
+#endif // UI_TREE_DIAG_H
@@ -0,0 +1,66 @@
+#ifndef WARM_STATE_H
+#define WARM_STATE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+// What the panel showed, kept in RTC slow memory across a software restart
+// (POST /api/restart, OTA reboot, panic, watchdog) so the first frame after
+// it is already right.
+//
+// The NVS config is only written back on a debounce and the server's
+// first push needs WiFi and a round trip, so without this the panel comes
+// back with stale buttons and the wrong day/night theme (the clock isn't
+// set yet) and corrects itself seconds later. The snapshot holds the state
+// version, every button's state and fan level, the brightness and the
+// shown theme, under a CRC: a power cut (or a restart in the middle of a
+// write) leaves something that fails it and is ignored.
+//
+// A main-loop job rewrites the snapshot when any of it changed, at most
+// SAVE_INTERVAL_MS behind, and a shutdown handler writes it once more on
+// an intentional restart.
+class WarmState {
+public:
+    WarmState();
+
+    // setup(), right after configManager.begin(): put a snapshot left by a
+    // restart into the live config (button states, fan levels) and the
+    // device controller (state version). False if there is none.
+    bool restore();
+
+    // setup(), after uiManager.begin() and before createUI(): the restored
+    // brightness and theme
+    void restoreDisplay();
+
+    // setup(), once the services are up: keep the snapshot current
+    void begin();
+
+    // Any task: write the snapshot now (skipped if nothing changed)
+    void save();
+
+    bool wasRestored() const { return restored; }
+
+    static const uint32_t SAVE_INTERVAL_MS = 500;
+
+private:
+    static void onSaveTimer(void* arg);
+    static void onShutdown();
+
+    int8_t job;
+    bool restored;
+    uint8_t restoredBrightness;
+    uint8_t restoredTheme;
+
+    // What the snapshot was last written from
+    uint32_t savedGeneration;
+    uint32_t savedVersion;
+    uint8_t savedBrightness;
+    uint8_t savedTheme;
+    bool saved;
+    portMUX_TYPE mux;
+};
+
+// Global instance
+extern WarmState warmState;
+
+#endif // WARM_STATE_H
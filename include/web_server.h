@@ -8,6 +8,18 @@
 // Maximum JSON payload size for API requests
 #define MAX_JSON_PAYLOAD_SIZE 1024
 
+// Largest config document accepted on /api/config
+#define MAX_CONFIG_PAYLOAD_SIZE (64 * 1024)
+
+// Largest partial config update (PATCH /api/config/...)
+#define MAX_PATCH_PAYLOAD_SIZE 4096
+
+// Largest state push accepted on /api/state and /api/state/buttons
+#define MAX_STATE_PAYLOAD_SIZE 4096
+
+// Largest server change request (URL plus CA PEM) on /api/server
+#define MAX_SERVER_PAYLOAD_SIZE 8192
+
 class DisplayWebServer {
 public:
     DisplayWebServer();
@@ -23,7 +35,6 @@ private:
 
     void setupRoutes();
     void setupOTA();
-    String getIndexPage();
 };
 
 extern DisplayWebServer webServer;
@@ -0,0 +1,110 @@
+#ifndef WIFI_LINK_H
+#define WIFI_LINK_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <freertos/FreeRTOS.h>
+#include "config_manager.h"
+
+// Station link with a directed fast path and its own reconnect schedule.
+//
+// The BSSID and channel of the last access point that gave us an address
+// are kept in NVS next to the credentials. Connecting with both skips the
+// all-channel scan, which is most of the association time, and is what a
+// room full of panels rebooting after a power blip hammers the APs with.
+// If the directed attempt fails (AP replaced, channel moved) the next one
+// scans.
+//
+// Reconnects are driven by WiFi events and a scheduler job, never by
+// waiting: failed attempts back off exponentially from RETRY_MIN_MS to
+// RETRY_MAX_MS, each delay drawn from its upper half so panels that dropped
+// together don't retry together. If nothing connects after boot, the
+// configuration AP comes up beside the station, which keeps retrying.
+//
+// Power save follows the config's WiFi profile, or its dim profile while
+// the brightness schedule holds the display dim or dark. Traffic here is
+// small bursts: webhooks out, state pushes and a ping every 15 s in.
+// Modem sleep only delays what comes in, by up to one DTIM period in the
+// balanced profile. In the low-power profile the delay is up to
+// LISTEN_INTERVAL beacons, about a second, which is well inside the
+// server's heartbeat timeout. Sends wake the radio at once in every
+// profile.
+class WiFiLink {
+public:
+    enum class State : uint8_t { IDLE, CONNECTING, CONNECTED, BACKOFF };
+
+    WiFiLink();
+
+    // Load credentials and the cached AP, start connecting (doesn't wait).
+    // Without credentials only the configuration AP starts.
+    void begin();
+
+    // Any task
+    bool isConnected() const { return state == State::CONNECTED; }
+    bool isAccessPointUp() const { return apStarted; }
+    const char* stateName() const;
+
+    uint32_t getLastConnectMs() const { return lastConnectMs; }
+    bool lastConnectWasDirected() const { return lastConnectDirected; }
+    uint32_t getReconnects() const { return reconnects; }
+
+    // Any task: pick the dim profile over the normal one
+    void setDim(bool dim);
+    // Any task: hold power save off (firmware update), over either profile
+    void setBoost(bool boost);
+    // Re-read the profiles after a config change
+    void applyProfile();
+    WifiProfile getProfile() const { return appliedProfile; }
+
+    static const uint32_t DIRECTED_TIMEOUT_MS = 4000;
+    static const uint32_t SCAN_TIMEOUT_MS = 10000;
+    static const uint32_t RETRY_MIN_MS = 1000;
+    static const uint32_t RETRY_MAX_MS = 60000;
+    static const uint16_t LISTEN_INTERVAL = 10;     // Beacons (~1 s), used by the low-power profile
+
+private:
+    // Arduino event task: note what happened, the job acts on it
+    static void onEvent(arduino_event_id_t event, arduino_event_info_t info);
+    // Scheduler job: attempt timeouts, retries and event handling
+    static void onLinkTimer(void* arg);
+
+    void startAttempt();
+    void attemptFailed(uint8_t reason);
+    void connected();
+    void rememberAccessPoint();
+    void startAccessPoint();
+
+    String ssid;
+    String password;
+    uint8_t cachedBssid[6];
+    uint8_t cachedChannel;      // 0 = nothing cached
+    int8_t job;
+
+    volatile State state;
+    bool attemptDirected;
+    bool everConnected;
+    volatile bool apStarted;
+    uint8_t failures;           // Since the last successful connect
+    unsigned long attemptStartedAt;
+    unsigned long retryAt;
+    uint32_t lastConnectMs;
+    bool lastConnectDirected;
+    uint32_t reconnects;
+
+    volatile bool dim;
+    volatile bool boost;
+    WifiProfile appliedProfile;
+    bool profileApplied;
+    portMUX_TYPE profileMux;
+
+    // Set by onEvent, taken by the job
+    portMUX_TYPE mux;
+    bool gotIp;
+    bool lost;
+    uint8_t lostReason;
+};
+
+// Global instance
+extern WiFiLink wifiLink;
+
+#endif // WIFI_LINK_H
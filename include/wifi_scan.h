@@ -0,0 +1,68 @@
+#ifndef WIFI_SCAN_H
+#define WIFI_SCAN_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Background WiFi scan behind GET /api/wifi/scan.
+//
+// A scan takes seconds and takes the radio off the STA's channel for most
+// of it, so state pushes and the server socket stall while it runs. The
+// endpoint never waits for one: it answers at once with the last result,
+// its age and whether a scan is running, and at most asks for a new one.
+// The scan itself is started without blocking from a scheduler job, which
+// polls for completion; each channel is listened to for SCAN_DWELL_MS
+// instead of the default 300 ms, so the STA is away for shorter stretches.
+//
+// A new scan starts only when the result is older than FRESH_MS (or the
+// caller asks for a refresh), never within MIN_INTERVAL_MS of the last
+// one, and not at all while someone is using the panel (a touch in the
+// last UI_QUIET_MS) or a firmware update runs; the answer then says why
+// ("skipped") and keeps the old result.
+class WifiScanner {
+public:
+    WifiScanner();
+
+    // Register the scan job (setup only)
+    void begin();
+
+    // Any task: start a scan if the result is stale (or refresh is set) and
+    // nothing holds it off
+    void request(bool refresh);
+
+    // Any task: {"networks":[...],"age_ms":n|null,"scanning":b,"skipped":s|null}
+    void writeJson(String& out);
+
+    static const unsigned long FRESH_MS = 60000;
+    static const unsigned long MIN_INTERVAL_MS = 10000;
+    static const unsigned long UI_QUIET_MS = 15000;
+    static const unsigned long POLL_MS = 250;
+    static const unsigned long SCAN_TIMEOUT_MS = 10000;
+    static const uint32_t SCAN_DWELL_MS = 120;
+    static const int MAX_NETWORKS = 20;
+
+private:
+    static void onScanTimer(void* arg);
+    void run();
+    void start();
+    void finish(int count);
+    // Why a scan can't start now, nullptr if it can
+    const char* blocker() const;
+
+    int8_t scanJob;
+    volatile bool wanted;
+    volatile bool scanning;
+    unsigned long startedAt;        // 0 before the first scan
+
+    // Guards the fields below; writeJson() copies networks under it
+    SemaphoreHandle_t mutex;
+    String networks;                // JSON array of the last result
+    unsigned long scannedAt;        // 0 until a scan completes
+    const char* skipped;            // Last request held off, until a scan starts
+};
+
+// Global instance
+extern WifiScanner wifiScanner;
+
+#endif // WIFI_SCAN_H
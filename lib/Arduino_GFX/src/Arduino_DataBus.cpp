@@ -42,6 +42,20 @@ void Arduino_DataBus::writeC8D16D16Split(uint8_t c, uint16_t d1, uint16_t d2)
   write(_data16.lsb);
 }
 
+void Arduino_DataBus::writePixelsAsync(uint16_t *data, uint32_t len)
+{
+  writePixels(data, len);
+}
+
+bool Arduino_DataBus::isAsyncBusy()
+{
+  return false;
+}
+
+void Arduino_DataBus::waitAsync()
+{
+}
+
 void Arduino_DataBus::sendCommand(uint8_t c)
 {
   beginWrite();
@@ -110,6 +124,7 @@ void Arduino_DataBus::batchOperation(const uint8_t *operations, size_t len)
       endWrite();
       break;
     case DELAY:
+      flushWrites();
       delay(operations[++i]);
       break;
     default:
@@ -261,6 +261,15 @@ public:
   virtual void writeRepeat(uint16_t p, uint32_t len) = 0;
   virtual void writePixels(uint16_t *data, uint32_t len) = 0;
 
+  // Asynchronous pixel writes. writePixelsAsync() may return while the tail of
+  // the transfer is still going out, so the caller can render the next block
+  // meanwhile; data is copied to the bus's own DMA buffers and can be reused
+  // once it returns. Every other call on the bus, endWrite() included, waits
+  // for the transfer first. Buses without DMA send synchronously.
+  virtual void writePixelsAsync(uint16_t *data, uint32_t len);
+  virtual bool isAsyncBusy();
+  virtual void waitAsync();
+
   void sendCommand(uint8_t c);
   void sendCommand16(uint16_t c);
   void sendData(uint8_t d);
@@ -268,6 +277,10 @@ public:
 
   void batchOperation(const uint8_t *operations, size_t len);
 
+  // Send writes the bus holds back until endWrite(); batchOperation() calls
+  // it before a DELAY so the delay falls where the sequence puts it
+  virtual void flushWrites() {}
+
 #if !defined(LITTLE_FOOT_PRINT)
   virtual void writeBytes(uint8_t *data, uint32_t len) = 0;
   virtual void writePattern(uint8_t *data, uint8_t len, uint32_t repeat) = 0;
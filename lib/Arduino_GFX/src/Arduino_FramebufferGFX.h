@@ -0,0 +1,798 @@
+#include "Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_FRAMEBUFFERGFX_H_
+#define _ARDUINO_FRAMEBUFFERGFX_H_
+
+#include "Arduino_GFX.h"
+
+// Drawing for displays backed by a whole-screen RGB565 framebuffer in RAM.
+//
+// DISPLAY is the class deriving from this one. Every primitive here writes
+// the framebuffer directly with stride arithmetic, clips once per call and
+// reports the area it changed through DISPLAY::addDirty(x1, y1, x2, y2)
+// (inclusive corners in screen coordinates, already clipped). Calls into
+// DISPLAY are resolved at compile time, so nothing inside a primitive goes
+// through a virtual call.
+//
+// Screen pixel (x, y) lives at origin + x * xstep + y * ystep in the
+// framebuffer, row-major with a stride of _width unless DISPLAY calls
+// mapFramebuffer() after a rotation. With a rotated mapping screen rows run
+// down framebuffer columns; fills then go along whichever axis is
+// contiguous and images are copied in strips, see blit().
+//
+// DISPLAY may also declare its own static fillRow(), copyRow(),
+// copyRowSwapped() and blendRow() to replace the plain loops below.
+template <class DISPLAY>
+class Arduino_FramebufferGFX : public Arduino_GFX
+{
+public:
+  Arduino_FramebufferGFX(int16_t w, int16_t h)
+      : Arduino_GFX(w, h), _framebuffer(NULL), _fb_origin(0), _fb_xstep(1), _fb_ystep(w) {}
+
+  uint16_t *getFramebuffer()
+  {
+    return _framebuffer;
+  }
+
+  void setRotation(uint8_t r) override
+  {
+    Arduino_GFX::setRotation(r);
+    mapFramebuffer(0, 1, _width);
+  }
+
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override
+  {
+    *pixelAt(x, y) = color;
+    display()->addDirty(x, y, x, y);
+  }
+
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override
+  {
+    if (!_ordered_in_range(x, 0, _max_x) || !h)
+    {
+      return;
+    }
+    if (h < 0)
+    {
+      y += h + 1;
+      h = -h;
+    }
+    int16_t y2 = y + h - 1;
+    if ((y > _max_y) || (y2 < 0))
+    {
+      return;
+    }
+    if (y < 0)
+    {
+      y = 0;
+    }
+    if (y2 > _max_y)
+    {
+      y2 = _max_y;
+    }
+
+    display()->addDirty(x, y, x, y2);
+    fillRun(pixelAt(x, y), _fb_ystep, y2 - y + 1, color);
+  }
+
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+  {
+    if (!_ordered_in_range(y, 0, _max_y) || !w)
+    {
+      return;
+    }
+    if (w < 0)
+    {
+      x += w + 1;
+      w = -w;
+    }
+    int16_t x2 = x + w - 1;
+    if ((x > _max_x) || (x2 < 0))
+    {
+      return;
+    }
+    if (x < 0)
+    {
+      x = 0;
+    }
+    if (x2 > _max_x)
+    {
+      x2 = _max_x;
+    }
+
+    display()->addDirty(x, y, x2, y);
+    fillRun(pixelAt(x, y), _fb_xstep, x2 - x + 1, color);
+  }
+
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+  {
+    if ((w <= 0) || (h <= 0))
+    {
+      return;
+    }
+    display()->addDirty(x, y, x + w - 1, y + h - 1);
+    if (_fb_xstep == 1)
+    {
+      uint16_t *row = pixelAt(x, y);
+      while (h--)
+      {
+        DISPLAY::fillRow(row, color, w);
+        row += _fb_ystep;
+      }
+    }
+    else
+    {
+      // Screen columns are the contiguous runs
+      for (int16_t i = 0; i < w; i++)
+      {
+        fillRun(pixelAt(x + i, y), _fb_ystep, h, color);
+      }
+    }
+  }
+
+  void writeSpans(const GFXspan *spans, uint16_t count, uint16_t color) override
+  {
+    // One dirty area for the batch; spans come from a single shape
+    int16_t x1 = _max_x, y1 = _max_y, x2 = -1, y2 = -1;
+    while (count--)
+    {
+      int16_t x = spans->x;
+      int16_t y = spans->y;
+      int16_t xe = x + spans->w - 1;
+      ++spans;
+      if (!_ordered_in_range(y, 0, _max_y))
+      {
+        continue;
+      }
+      if (x < 0)
+      {
+        x = 0;
+      }
+      if (xe > _max_x)
+      {
+        xe = _max_x;
+      }
+      if (x > xe)
+      {
+        continue;
+      }
+
+      fillRun(pixelAt(x, y), _fb_xstep, xe - x + 1, color);
+      x1 = min(x1, x);
+      y1 = min(y1, y);
+      x2 = max(x2, xe);
+      y2 = max(y2, y);
+    }
+    if (x2 >= x1)
+    {
+      display()->addDirty(x1, y1, x2, y2);
+    }
+  }
+
+  void writePixelAlpha(int16_t x, int16_t y, uint16_t color, uint8_t alpha) override
+  {
+    if (alpha && _ordered_in_range(x, 0, _max_x) && _ordered_in_range(y, 0, _max_y))
+    {
+      uint16_t *fb = pixelAt(x, y);
+      *fb = blend565(color, *fb, alpha);
+      display()->addDirty(x, y, x, y);
+    }
+  }
+
+  void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override
+  {
+    if (x0 == x1)
+    {
+      Arduino_FramebufferGFX::writeFastVLine(x0, min(y0, y1), _diff(y1, y0) + 1, color);
+    }
+    else if (y0 == y1)
+    {
+      Arduino_FramebufferGFX::writeFastHLine(min(x0, x1), y0, _diff(x1, x0) + 1, color);
+    }
+    else
+    {
+      Arduino_FramebufferGFX::writeSlashLine(x0, y0, x1, y1, color);
+    }
+  }
+
+  // Same pixels as Arduino_GFX::writeSlashLine(), walked as a framebuffer
+  // pointer; only a line crossing the screen edge checks each pixel
+  void writeSlashLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override
+  {
+    int16_t bx1 = min(x0, x1), bx2 = max(x0, x1);
+    int16_t by1 = min(y0, y1), by2 = max(y0, y1);
+    if ((bx2 < 0) || (by2 < 0) || (bx1 > _max_x) || (by1 > _max_y))
+    {
+      return;
+    }
+    bool inside = (bx1 >= 0) && (by1 >= 0) && (bx2 <= _max_x) && (by2 <= _max_y);
+
+    bool steep = _diff(y1, y0) > _diff(x1, x0);
+    if (steep)
+    {
+      _swap_int16_t(x0, y0);
+      _swap_int16_t(x1, y1);
+    }
+    if (x0 > x1)
+    {
+      _swap_int16_t(x0, x1);
+      _swap_int16_t(y0, y1);
+    }
+
+    int16_t dx = x1 - x0;
+    int16_t dy = _diff(y1, y0);
+    int16_t err = dx >> 1;
+    int16_t step = (y0 < y1) ? 1 : -1;
+
+    if (inside)
+    {
+      // One pixel along the major axis per step, one along the minor each
+      // time err wraps
+      int32_t major = steep ? _fb_ystep : _fb_xstep;
+      int32_t minor = step * (steep ? _fb_xstep : _fb_ystep);
+      uint16_t *fb = steep ? pixelAt(y0, x0) : pixelAt(x0, y0);
+      if (((major == 1) || (major == -1)) && (dx >= LINE_RUN_MIN * dy))
+      {
+        // Near the framebuffer's row direction: every run between minor
+        // steps is contiguous memory, filled in one go
+        int16_t len = 0;
+        for (; x0 <= x1; x0++)
+        {
+          len++;
+          err -= dy;
+          if ((err < 0) || (x0 == x1))
+          {
+            DISPLAY::fillRow((major > 0) ? fb : fb - (len - 1), color, len);
+            fb += major * len;
+            if (err < 0)
+            {
+              err += dx;
+              fb += minor;
+            }
+            len = 0;
+          }
+        }
+      }
+      else
+      {
+        for (; x0 <= x1; x0++)
+        {
+          *fb = color;
+          fb += major;
+          err -= dy;
+          if (err < 0)
+          {
+            err += dx;
+            fb += minor;
+          }
+        }
+      }
+    }
+    else
+    {
+      for (; x0 <= x1; x0++)
+      {
+        int16_t px = steep ? y0 : x0;
+        int16_t py = steep ? x0 : y0;
+        if (_ordered_in_range(px, 0, _max_x) && _ordered_in_range(py, 0, _max_y))
+        {
+          *pixelAt(px, py) = color;
+        }
+        err -= dy;
+        if (err < 0)
+        {
+          err += dx;
+          y0 += step;
+        }
+      }
+    }
+    display()->addDirty(max(bx1, (int16_t)0), max(by1, (int16_t)0), min(bx2, _max_x), min(by2, _max_y));
+  }
+
+  using Arduino_GFX::drawBitmap;
+  using Arduino_GFX::drawGrayscaleBitmap;
+  using Arduino_GFX::draw16bitRGBBitmap;
+  using Arduino_GFX::draw24bitRGBBitmap;
+
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg) override
+  {
+    int16_t bw = (w + 7) / 8; // Bitmap scanline pad = whole byte
+    blit(x, y, w, h, [=](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           const uint8_t *src = &bitmap[j * bw];
+           for (; n > 0; n--, i++, dst += step)
+           {
+             *dst = (pgm_read_byte(&src[i >> 3]) & (0x80 >> (i & 7))) ? color : bg;
+           } });
+  }
+
+  // Arduino_Canvas_Mono::flush() lands here: contiguous rows expand a
+  // source byte at a time through monoQuads()
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) override
+  {
+    int16_t bw = (w + 7) / 8;
+    alignas(4) uint16_t quads[16][4];
+    monoQuads(quads, color, bg);
+    blit(x, y, w, h, [=, &quads](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           const uint8_t *src = &bitmap[j * bw];
+           if (step == 1)
+           {
+             expandMonoRow(dst, src, i, n, quads, color, bg);
+             return;
+           }
+           for (; n > 0; n--, i++, dst += step)
+           {
+             *dst = (src[i >> 3] & (0x80 >> (i & 7))) ? color : bg;
+           } });
+  }
+
+  void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h) override
+  {
+    blit(x, y, w, h, [=](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           const uint8_t *src = &bitmap[((int32_t)j * w) + i];
+           for (; n > 0; n--, dst += step)
+           {
+             uint8_t v = pgm_read_byte(src++);
+             *dst = color565(v, v, v);
+           } });
+  }
+
+  void drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h) override
+  {
+    blit(x, y, w, h, [=](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           const uint8_t *src = &bitmap[((int32_t)j * w) + i];
+           for (; n > 0; n--, dst += step)
+           {
+             uint8_t v = *src++;
+             *dst = color565(v, v, v);
+           } });
+  }
+
+  void drawIndexedBitmap(int16_t x, int16_t y, uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h) override
+  {
+    blit(x, y, w, h, [=](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           const uint8_t *src = &bitmap[((int32_t)j * w) + i];
+           for (; n > 0; n--, dst += step)
+           {
+             *dst = color_index[*src++];
+           } });
+  }
+
+  void draw3bitRGBBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h) override
+  {
+    // Two pixels a byte, high bits first, rows not padded; contiguous rows
+    // expand a byte (both pixels) at a time through pixelPairs3bit()
+    uint32_t pairs[64];
+    pixelPairs3bit(pairs);
+    blit(x, y, w, h, [=, &pairs](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           int32_t p = ((int32_t)j * w) + i;
+           if (step == 1)
+           {
+             expand3bitRow(dst, bitmap, p, n, pairs);
+             return;
+           }
+           for (; n > 0; n--, p++, dst += step)
+           {
+             uint32_t pair = pairs[bitmap[p >> 1] & 0x3F];
+             *dst = (p & 1) ? (pair >> 16) : pair;
+           } });
+  }
+
+  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, uint8_t *mask, int16_t w, int16_t h) override
+  {
+    int16_t bw = (w + 7) / 8;
+    blit(x, y, w, h, [=](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           const uint16_t *src = &bitmap[(int32_t)j * w];
+           const uint8_t *m = &mask[j * bw];
+           for (; n > 0; n--, i++, dst += step)
+           {
+             if (m[i >> 3] & (0x80 >> (i & 7)))
+             {
+               *dst = src[i];
+             }
+           } });
+  }
+
+  void draw16bitRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) override
+  {
+    blit(x, y, w, h, [=](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           const uint16_t *src = &bitmap[((int32_t)j * w) + i];
+           for (; n > 0; n--, dst += step)
+           {
+             *dst = pgm_read_word(src++);
+           } });
+  }
+
+  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override
+  {
+    blit(x, y, w, h, [=](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           const uint16_t *src = &bitmap[((int32_t)j * w) + i];
+           if (step == 1)
+           {
+             DISPLAY::copyRow(dst, src, n);
+             return;
+           }
+           for (; n > 0; n--, dst += step)
+           {
+             *dst = *src++;
+           } });
+  }
+
+  void draw16bitBeRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override
+  {
+    blit(x, y, w, h, [=](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           const uint16_t *src = &bitmap[((int32_t)j * w) + i];
+           if (step == 1)
+           {
+             DISPLAY::copyRowSwapped(dst, src, n);
+             return;
+           }
+           for (; n > 0; n--, dst += step, src++)
+           {
+             MSB_16_SET(*dst, *src);
+           } });
+  }
+
+  void draw24bitRGBBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h) override
+  {
+    blit(x, y, w, h, [=](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           const uint8_t *src = &bitmap[(((int32_t)j * w) + i) * 3];
+           for (; n > 0; n--, src += 3, dst += step)
+           {
+             *dst = color565(pgm_read_byte(&src[0]), pgm_read_byte(&src[1]), pgm_read_byte(&src[2]));
+           } });
+  }
+
+  void draw24bitRGBBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h) override
+  {
+    blit(x, y, w, h, [=](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           const uint8_t *src = &bitmap[(((int32_t)j * w) + i) * 3];
+           for (; n > 0; n--, src += 3, dst += step)
+           {
+             *dst = color565(src[0], src[1], src[2]);
+           } });
+  }
+
+  void draw16bitRGBBitmapWithTranColor(int16_t x, int16_t y, uint16_t *bitmap, uint16_t transparent_color, int16_t w, int16_t h) override
+  {
+    blit(x, y, w, h, [=](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           const uint16_t *src = &bitmap[((int32_t)j * w) + i];
+           for (; n > 0; n--, dst += step)
+           {
+             uint16_t c = *src++;
+             if (c != transparent_color)
+             {
+               *dst = c;
+             }
+           } });
+  }
+
+  void drawAlphaBitmap(int16_t x, int16_t y, const uint16_t bitmap[], const uint8_t alpha[], int16_t w, int16_t h) override
+  {
+    blit(x, y, w, h, [=](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         {
+           int32_t offset = ((int32_t)j * w) + i;
+           DISPLAY::blendRow(dst, step, &bitmap[offset], &alpha[offset], n); });
+  }
+
+  void drawA8Mask(int16_t x, int16_t y, const uint8_t mask[], int16_t w, int16_t h, uint16_t color) override
+  {
+    blit(x, y, w, h, [=](uint16_t *dst, int32_t step, int16_t i, int16_t n, int16_t j)
+         { DISPLAY::blendRow(dst, step, color, &mask[((int32_t)j * w) + i], n); });
+  }
+
+  // Fill n pixels with one color
+  static void fillRow(uint16_t *dst, uint16_t color, int32_t n)
+  {
+    if ((((uint32_t)(uintptr_t)dst) & 3) && n)
+    {
+      *dst++ = color;
+      n--;
+    }
+    uint32_t c2 = ((uint32_t)color << 16) | color;
+    uint32_t *dst2 = (uint32_t *)dst;
+    for (int32_t i = n >> 1; i > 0; i--)
+    {
+      *dst2++ = c2;
+    }
+    if (n & 1)
+    {
+      *(uint16_t *)dst2 = color;
+    }
+  }
+
+  // Copy n pixels
+  static void copyRow(uint16_t *dst, const uint16_t *src, int32_t n)
+  {
+    memcpy(dst, src, n * 2);
+  }
+
+  // Copy n pixels, swapping the bytes of each (big endian source)
+  static void copyRowSwapped(uint16_t *dst, const uint16_t *src, int32_t n)
+  {
+    if (((((uint32_t)(uintptr_t)dst) ^ ((uint32_t)(uintptr_t)src)) & 3) == 0)
+    {
+      if ((((uint32_t)(uintptr_t)dst) & 3) && n)
+      {
+        MSB_16_SET(*dst, *src);
+        dst++;
+        src++;
+        n--;
+      }
+      uint32_t *dst2 = (uint32_t *)dst;
+      const uint32_t *src2 = (const uint32_t *)src;
+      for (int32_t i = n >> 1; i > 0; i--)
+      {
+        uint32_t v = *src2++;
+        *dst2++ = ((v & 0x00FF00FF) << 8) | ((v >> 8) & 0x00FF00FF);
+      }
+      dst = (uint16_t *)dst2;
+      src = (const uint16_t *)src2;
+      n &= 1;
+    }
+    while (n--)
+    {
+      MSB_16_SET(*dst, *src);
+      dst++;
+      src++;
+    }
+  }
+
+  // Blend n pixels of src over the pixels step apart from dst, each at its
+  // alpha / 255
+  static void blendRow(uint16_t *dst, int32_t step, const uint16_t *src, const uint8_t *alpha, int32_t n)
+  {
+    for (; n > 0; n--, dst += step, src++)
+    {
+      uint8_t a = pgm_read_byte(alpha++);
+      if (a == 255)
+      {
+        *dst = pgm_read_word(src);
+      }
+      else if (a)
+      {
+        *dst = blend565(pgm_read_word(src), *dst, a);
+      }
+    }
+  }
+
+  // Blend one color over n pixels step apart, each at its alpha / 255
+  static void blendRow(uint16_t *dst, int32_t step, uint16_t color, const uint8_t *alpha, int32_t n)
+  {
+    for (; n > 0; n--, dst += step)
+    {
+      uint8_t a = pgm_read_byte(alpha++);
+      if (a == 255)
+      {
+        *dst = color;
+      }
+      else if (a)
+      {
+        *dst = blend565(color, *dst, a);
+      }
+    }
+  }
+
+protected:
+  // Image columns copied per pass when screen rows run down the
+  // framebuffer's columns: that many framebuffer rows are written side by
+  // side, each one sequentially, instead of one pixel in every row
+  static const int16_t BLIT_STRIP = 32;
+
+  // Lines at least this many times longer along the framebuffer's rows than
+  // across them are drawn as fillRow() runs; steeper ones pixel by pixel
+  static const int16_t LINE_RUN_MIN = 4;
+
+  // 1-bit rows, MSB first: quads[v] is the 4 pixels of nibble v, so each
+  // source byte becomes 8 pixels without a bit test per pixel
+  static void monoQuads(uint16_t quads[16][4], uint16_t color, uint16_t bg)
+  {
+    for (uint8_t v = 0; v < 16; v++)
+    {
+      for (uint8_t k = 0; k < 4; k++)
+      {
+        quads[v][k] = (v & (0x8 >> k)) ? color : bg;
+      }
+    }
+  }
+
+  // n pixels from bit i of src, written contiguously from dst
+  static void expandMonoRow(uint16_t *dst, const uint8_t *src, int16_t i, int16_t n,
+                            const uint16_t quads[16][4], uint16_t color, uint16_t bg)
+  {
+    for (; (n > 0) && (i & 7); n--, i++)
+    {
+      *dst++ = (src[i >> 3] & (0x80 >> (i & 7))) ? color : bg;
+    }
+    const uint8_t *s = &src[i >> 3];
+    if ((((uint32_t)(uintptr_t)dst) & 3) == 0)
+    {
+      uint32_t *dst2 = (uint32_t *)dst;
+      for (; n >= 8; n -= 8, i += 8)
+      {
+        const uint32_t *hi = (const uint32_t *)quads[*s >> 4];
+        const uint32_t *lo = (const uint32_t *)quads[*s++ & 0xF];
+        dst2[0] = hi[0];
+        dst2[1] = hi[1];
+        dst2[2] = lo[0];
+        dst2[3] = lo[1];
+        dst2 += 4;
+      }
+      dst = (uint16_t *)dst2;
+    }
+    else
+    {
+      for (; n >= 8; n -= 8, i += 8, dst += 8)
+      {
+        const uint16_t *hi = quads[*s >> 4];
+        const uint16_t *lo = quads[*s++ & 0xF];
+        dst[0] = hi[0];
+        dst[1] = hi[1];
+        dst[2] = hi[2];
+        dst[3] = hi[3];
+        dst[4] = lo[0];
+        dst[5] = lo[1];
+        dst[6] = lo[2];
+        dst[7] = lo[3];
+      }
+    }
+    for (; n > 0; n--, i++)
+    {
+      *dst++ = (src[i >> 3] & (0x80 >> (i & 7))) ? color : bg;
+    }
+  }
+
+  // 3-bit RGB bytes: pairs[b] holds both pixels of byte b, the first (bits
+  // 5..3) in the low half so it lands at the lower address
+  static void pixelPairs3bit(uint32_t pairs[64])
+  {
+    uint16_t colors[8];
+    for (uint8_t c = 0; c < 8; c++)
+    {
+      colors[c] = (((c & 0b100) ? RED : 0) |
+                   ((c & 0b010) ? GREEN : 0) |
+                   ((c & 0b001) ? BLUE : 0));
+    }
+    for (uint8_t b = 0; b < 64; b++)
+    {
+      pairs[b] = colors[b >> 3] | ((uint32_t)colors[b & 7] << 16);
+    }
+  }
+
+  // n pixels from pixel p of bitmap, written contiguously from dst
+  static void expand3bitRow(uint16_t *dst, const uint8_t *bitmap, int32_t p, int16_t n, const uint32_t pairs[64])
+  {
+    if ((p & 1) && (n > 0))
+    {
+      *dst++ = pairs[bitmap[p >> 1] & 0x3F] >> 16;
+      p++;
+      n--;
+    }
+    const uint8_t *s = &bitmap[p >> 1];
+    if ((((uint32_t)(uintptr_t)dst) & 3) == 0)
+    {
+      uint32_t *dst2 = (uint32_t *)dst;
+      for (; n >= 2; n -= 2)
+      {
+        *dst2++ = pairs[*s++ & 0x3F];
+      }
+      dst = (uint16_t *)dst2;
+    }
+    else
+    {
+      for (; n >= 2; n -= 2, dst += 2)
+      {
+        uint32_t pair = pairs[*s++ & 0x3F];
+        dst[0] = pair;
+        dst[1] = pair >> 16;
+      }
+    }
+    if (n > 0)
+    {
+      *dst = pairs[*s & 0x3F];
+    }
+  }
+
+  DISPLAY *display()
+  {
+    return static_cast<DISPLAY *>(this);
+  }
+
+  // Where screen pixel (x, y) is, see the class comment
+  void mapFramebuffer(int32_t origin, int32_t xstep, int32_t ystep)
+  {
+    _fb_origin = origin;
+    _fb_xstep = xstep;
+    _fb_ystep = ystep;
+  }
+
+  uint16_t *pixelAt(int16_t x, int16_t y)
+  {
+    return _framebuffer + _fb_origin + (x * _fb_xstep) + (y * _fb_ystep);
+  }
+
+  // Fill n pixels step apart from p
+  void fillRun(uint16_t *p, int32_t step, int32_t n, uint16_t color)
+  {
+    if (step == 1)
+    {
+      DISPLAY::fillRow(p, color, n);
+    }
+    else if (step == -1)
+    {
+      DISPLAY::fillRow(p - (n - 1), color, n);
+    }
+    else
+    {
+      while (n--)
+      {
+        *p = color;
+        p += step;
+      }
+    }
+  }
+
+  // Clip a w x h image at (x, y) to the screen once, then hand the visible
+  // part to row(dst, step, i, n, j): n pixels from image column i of row j,
+  // written from dst on, step apart. Row-major framebuffers get whole rows,
+  // rotated ones strips of BLIT_STRIP columns. One dirty area for the lot.
+  template <class ROW>
+  void blit(int16_t x, int16_t y, int16_t w, int16_t h, ROW row)
+  {
+    int32_t i0 = (x < 0) ? -x : 0;
+    int32_t j0 = (y < 0) ? -y : 0;
+    int32_t i1 = min((int32_t)w, (int32_t)_width - x);
+    int32_t j1 = min((int32_t)h, (int32_t)_height - y);
+    if ((i0 >= i1) || (j0 >= j1))
+    {
+      return;
+    }
+
+    if (_fb_xstep == 1)
+    {
+      int16_t n = i1 - i0;
+      uint16_t *dst = pixelAt(x + i0, y + j0);
+      for (int32_t j = j0; j < j1; j++)
+      {
+        row(dst, 1, (int16_t)i0, n, (int16_t)j);
+        dst += _fb_ystep;
+      }
+    }
+    else
+    {
+      for (int32_t i = i0; i < i1; i += BLIT_STRIP)
+      {
+        int16_t n = min((int32_t)BLIT_STRIP, i1 - i);
+        uint16_t *dst = pixelAt(x + i, y + j0);
+        for (int32_t j = j0; j < j1; j++)
+        {
+          row(dst, _fb_xstep, (int16_t)i, n, (int16_t)j);
+          dst += _fb_ystep;
+        }
+      }
+    }
+    display()->addDirty(x + i0, y + j0, x + i1 - 1, y + j1 - 1);
+  }
+
+  uint16_t *_framebuffer;
+  int32_t _fb_origin;
+  int32_t _fb_xstep;
+  int32_t _fb_ystep;
+};
+
+#endif // _ARDUINO_FRAMEBUFFERGFX_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
@@ -84,6 +84,10 @@ void Arduino_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
 /**************************************************************************/
 /*!
   @brief  Write a line.  Bresenham's algorithm - thx wikpedia
+    Pixels on the same row (or column, for steep lines) go out as one
+    writeFastHLine() / writeFastVLine() run instead of one writePixel()
+    each, which clip them and take a single address window on most
+    displays.
   @param  x0      Start point x coordinate
   @param  y0      Start point y coordinate
   @param  x1      End point x coordinate
@@ -94,6 +98,11 @@ void Arduino_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
 void Arduino_GFX::writeSlashLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
                                  uint16_t color)
 {
+  if ((max(x0, x1) < 0) || (max(y0, y1) < 0) || (min(x0, x1) > _max_x) || (min(y0, y1) > _max_y))
+  {
+    return;
+  }
+
   bool steep = _diff(y1, y0) > _diff(x1, x0);
   if (steep)
   {
@@ -111,22 +120,40 @@ void Arduino_GFX::writeSlashLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
   int16_t dy = _diff(y1, y0);
   int16_t err = dx >> 1;
   int16_t step = (y0 < y1) ? 1 : -1;
+  int16_t xs = x0;
 
   for (; x0 <= x1; x0++)
   {
-    if (steep)
-    {
-      writePixel(y0, x0, color);
-    }
-    else
-    {
-      writePixel(x0, y0, color);
-    }
     err -= dy;
-    if (err < 0)
+    if ((err < 0) || (x0 == x1))
     {
-      err += dx;
-      y0 += step;
+      // Run xs..x0 along the major axis ends here
+      int16_t len = x0 - xs + 1;
+      if (len == 1)
+      {
+        if (steep)
+        {
+          writePixel(y0, x0, color);
+        }
+        else
+        {
+          writePixel(x0, y0, color);
+        }
+      }
+      else if (steep)
+      {
+        writeFastVLine(y0, xs, len, color);
+      }
+      else
+      {
+        writeFastHLine(xs, y0, len, color);
+      }
+      if (err < 0)
+      {
+        err += dx;
+        y0 += step;
+      }
+      xs = x0 + 1;
     }
   }
 }
@@ -271,6 +298,59 @@ void Arduino_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
   }
 }
 
+/**************************************************************************/
+/*!
+  @brief  Fill a batch of rows, each clipped to the display. Framebuffer
+    displays override this to fill memory directly.
+  @param  spans   Rows to fill
+  @param  count   Number of rows
+  @param  color   16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void Arduino_GFX::writeSpans(const GFXspan *spans, uint16_t count, uint16_t color)
+{
+  while (count--)
+  {
+    int16_t x = spans->x;
+    int16_t y = spans->y;
+    int16_t x2 = x + spans->w - 1;
+    ++spans;
+    if (_ordered_in_range(y, 0, _max_y) && (x <= x2))
+    {
+      if (x < 0)
+      {
+        x = 0;
+      }
+      if (x2 > _max_x)
+      {
+        x2 = _max_x;
+      }
+      if (x <= x2)
+      {
+        writeFillRectPreclipped(x, y, x2 - x + 1, 1, color);
+      }
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Blend a color over a pixel. Displays without a framebuffer to
+    read back draw the pixel when alpha is at least half.
+  @param  x       x coordinate
+  @param  y       y coordinate
+  @param  color   16-bit 5-6-5 Color to blend
+  @param  alpha   Coverage, 0 to 255
+*/
+/**************************************************************************/
+void Arduino_GFX::writePixelAlpha(int16_t x, int16_t y, uint16_t color, uint8_t alpha)
+{
+  if (alpha >= 128)
+  {
+    writePixel(x, y, color);
+  }
+}
+
 /**************************************************************************/
 /*!
   @brief  Write a rectangle completely with one color, overwrite in subclasses if startWrite is defined!
@@ -490,6 +570,75 @@ void Arduino_GFX::drawEllipseHelper(int32_t x, int32_t y,
   } while (rx2 * yt <= ry2 * xt);
 }
 
+// Integer square root, rounded down
+static int32_t gfxSqrt(uint32_t v)
+{
+  uint32_t r = 0;
+  uint32_t bit = 1UL << 30;
+  while (bit > v)
+  {
+    bit >>= 2;
+  }
+  while (bit)
+  {
+    if (v >= r + bit)
+    {
+      v -= r + bit;
+      r = (r >> 1) + bit;
+    }
+    else
+    {
+      r >>= 1;
+    }
+    bit >>= 2;
+  }
+  return r;
+}
+
+// Collects the rows of a filled shape and hands them to writeSpans()
+// GFX_SPAN_BATCH at a time, the rest when it goes out of scope
+class GFXspanBatch
+{
+public:
+  GFXspanBatch(Arduino_GFX *gfx, uint16_t color) : _gfx(gfx), _color(color) {}
+  ~GFXspanBatch() { flush(); }
+
+  void add(int16_t x, int16_t y, int16_t w)
+  {
+    if (w > 0)
+    {
+      _spans[_count++] = {x, y, w};
+      if (_count == GFX_SPAN_BATCH)
+      {
+        flush();
+      }
+    }
+  }
+
+  void addRect(int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    while (h-- > 0)
+    {
+      add(x, y++, w);
+    }
+  }
+
+  void flush()
+  {
+    if (_count)
+    {
+      _gfx->writeSpans(_spans, _count, _color);
+      _count = 0;
+    }
+  }
+
+private:
+  Arduino_GFX *_gfx;
+  uint16_t _color;
+  GFXspan _spans[GFX_SPAN_BATCH];
+  uint16_t _count = 0;
+};
+
 /**************************************************************************/
 /*!
   @brief  Draw a circle with filled color
@@ -542,8 +691,9 @@ void Arduino_GFX::fillEllipseHelper(int32_t x, int32_t y,
   int32_t rx2 = (int32_t)rx * rx;
   int32_t ry2 = (int32_t)ry * ry;
   int32_t s;
+  GFXspanBatch spans(this, color);
 
-  writeFastHLine(x - rx, y, (rx << 1) + 1, color);
+  spans.add(x - rx, y, (rx << 1) + 1);
   i = 0;
   yt = 0;
   xt = rx;
@@ -556,11 +706,11 @@ void Arduino_GFX::fillEllipseHelper(int32_t x, int32_t y,
     }
     if (corners & 1)
     {
-      writeFillRect(x - xt, y - yt, (xt << 1) + 1 + delta, yt - i, color);
+      spans.addRect(x - xt, y - yt, (xt << 1) + 1 + delta, yt - i);
     }
     if (corners & 2)
     {
-      writeFillRect(x - xt, y + i + 1, (xt << 1) + 1 + delta, yt - i, color);
+      spans.addRect(x - xt, y + i + 1, (xt << 1) + 1 + delta, yt - i);
     }
     i = yt;
     s -= (--xt) * ry2 << 2;
@@ -577,11 +727,11 @@ void Arduino_GFX::fillEllipseHelper(int32_t x, int32_t y,
     }
     if (corners & 1)
     {
-      writeFastHLine(x - xt, y - yt, (xt << 1) + 1 + delta, color);
+      spans.add(x - xt, y - yt, (xt << 1) + 1 + delta);
     }
     if (corners & 2)
     {
-      writeFastHLine(x - xt, y + yt, (xt << 1) + 1 + delta, color);
+      spans.add(x - xt, y + yt, (xt << 1) + 1 + delta);
     }
     s -= (--yt) * rx2 << 2;
   } while (ry2 * xt <= rx2 * yt);
@@ -716,6 +866,79 @@ void Arduino_GFX::fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float st
   endWrite();
 }
 
+#if defined(GFX_FIXED_POINT_ARC)
+// sin() of 0..90 degrees, Q14
+static const uint16_t _arc_sin_table[91] PROGMEM = {
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384};
+
+#define ARC_ANGLE_UNIT 256 // angles in 1/256 degree
+#define ARC_FULL_CIRCLE (360 * ARC_ANGLE_UNIT)
+
+// sin() of an angle in ARC_ANGLE_UNITs, Q14, interpolated between table entries
+static int32_t arcSin(int32_t a)
+{
+  a %= ARC_FULL_CIRCLE;
+  if (a < 0)
+  {
+    a += ARC_FULL_CIRCLE;
+  }
+  bool neg = a >= (ARC_FULL_CIRCLE / 2);
+  if (neg)
+  {
+    a -= ARC_FULL_CIRCLE / 2;
+  }
+  if (a > (ARC_FULL_CIRCLE / 4))
+  {
+    a = (ARC_FULL_CIRCLE / 2) - a;
+  }
+  int32_t i = a / ARC_ANGLE_UNIT;
+  int32_t f = a % ARC_ANGLE_UNIT;
+  int32_t s0 = pgm_read_word(&_arc_sin_table[i]);
+  int32_t s1 = (i < 90) ? pgm_read_word(&_arc_sin_table[i + 1]) : s0;
+  int32_t v = s0 + (((s1 - s0) * f) / ARC_ANGLE_UNIT);
+  return neg ? -v : v;
+}
+
+static int32_t arcFloorDiv(int32_t a, int32_t b) // b > 0
+{
+  return (a >= 0) ? (a / b) : -((-a + b - 1) / b);
+}
+
+// Narrow [lo, hi] to the x with s * x <= k; lo > hi when nothing is left
+static void arcClip(int32_t s, int32_t k, int32_t &lo, int32_t &hi)
+{
+  if (s > 0)
+  {
+    int32_t x = arcFloorDiv(k, s);
+    if (x < hi)
+    {
+      hi = x;
+    }
+  }
+  else if (s < 0)
+  {
+    int32_t x = -arcFloorDiv(k, -s); // ceil(k / s)
+    if (x > lo)
+    {
+      lo = x;
+    }
+  }
+  else if (k < 0)
+  {
+    hi = lo - 1;
+  }
+}
+#endif // defined(GFX_FIXED_POINT_ARC)
+
 /**************************************************************************/
 /*!
   @brief  Arc drawer with fill
@@ -728,6 +951,128 @@ void Arduino_GFX::fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float st
   @param  color   16-bit 5-6-5 Color to fill with
 */
 /**************************************************************************/
+#if defined(GFX_FIXED_POINT_ARC)
+void Arduino_GFX::fillArcHelper(int16_t cx, int16_t cy, int16_t oradius, int16_t iradius, float start, float end, uint16_t color)
+{
+  // The arc runs clockwise from start to end. Pixel p is clockwise of the
+  // direction (c, s) when c * p.y - s * p.x >= 0, so along a row every bound
+  // is a single x and each row comes down to at most four spans.
+  int32_t a0 = (int32_t)(start * ARC_ANGLE_UNIT);
+  int32_t a1 = (int32_t)(end * ARC_ANGLE_UNIT);
+  int32_t sweep = a1 - a0;
+  bool full = sweep >= ARC_FULL_CIRCLE;
+  bool radial = (sweep == 0); // start == end: the radius at that angle
+  if (sweep < 0)
+  {
+    sweep += ARC_FULL_CIRCLE;
+  }
+  bool wide = sweep > (ARC_FULL_CIRCLE / 2);
+
+  int32_t sc = arcSin(a0 + (ARC_FULL_CIRCLE / 4));
+  int32_t ss = arcSin(a0);
+  int32_t ec = arcSin(a1 + (ARC_FULL_CIRCLE / 4));
+  int32_t es = arcSin(a1);
+
+  --iradius;
+  int32_t ir2 = iradius * iradius + iradius;
+  int32_t or2 = oradius * oradius + oradius;
+
+  for (int32_t y = -oradius; y <= oradius; ++y)
+  {
+    int32_t y2 = y * y;
+    if (y2 >= or2)
+    {
+      continue;
+    }
+
+    // ring: ir2 <= x * x + y * y < or2
+    int32_t xo = gfxSqrt(or2 - 1 - y2);
+    int32_t ring[2][2];
+    uint8_t ringCount = 0;
+    if (y2 >= ir2)
+    {
+      ring[0][0] = -xo;
+      ring[0][1] = xo;
+      ringCount = 1;
+    }
+    else
+    {
+      int32_t xi = gfxSqrt(ir2 - 1 - y2);
+      if (xi >= xo)
+      {
+        continue;
+      }
+      ring[0][0] = -xo;
+      ring[0][1] = -xi - 1;
+      ring[1][0] = xi + 1;
+      ring[1][1] = xo;
+      ringCount = 2;
+    }
+
+    // angle
+    int32_t span[2][2];
+    uint8_t spanCount = 0;
+    if (full)
+    {
+      span[0][0] = -xo;
+      span[0][1] = xo;
+      spanCount = 1;
+    }
+    else if (radial)
+    {
+      // within half a pixel of the line, on the start side of the center
+      span[0][0] = -xo;
+      span[0][1] = xo;
+      arcClip(ss, sc * y + 8192, span[0][0], span[0][1]);
+      arcClip(-ss, 8192 - sc * y, span[0][0], span[0][1]);
+      arcClip(-sc, ss * y, span[0][0], span[0][1]);
+      spanCount = 1;
+    }
+    else
+    {
+      // clockwise of start and counter-clockwise of end: both up to half a
+      // circle, either one beyond that
+      int32_t slo = -xo, shi = xo;
+      int32_t elo = -xo, ehi = xo;
+      arcClip(ss, sc * y, slo, shi);
+      arcClip(-es, -ec * y, elo, ehi);
+      if (!wide)
+      {
+        span[0][0] = (slo > elo) ? slo : elo;
+        span[0][1] = (shi < ehi) ? shi : ehi;
+        spanCount = 1;
+      }
+      else if ((slo <= ehi + 1) && (elo <= shi + 1) && (slo <= shi) && (elo <= ehi))
+      {
+        span[0][0] = (slo < elo) ? slo : elo;
+        span[0][1] = (shi > ehi) ? shi : ehi;
+        spanCount = 1;
+      }
+      else
+      {
+        span[0][0] = slo;
+        span[0][1] = shi;
+        span[1][0] = elo;
+        span[1][1] = ehi;
+        spanCount = 2;
+      }
+    }
+
+    for (uint8_t i = 0; i < spanCount; ++i)
+    {
+      for (uint8_t j = 0; j < ringCount; ++j)
+      {
+        int32_t lo = (span[i][0] > ring[j][0]) ? span[i][0] : ring[j][0];
+        int32_t hi = (span[i][1] < ring[j][1]) ? span[i][1] : ring[j][1];
+        if (lo <= hi)
+        {
+          writeFastHLine(cx + lo, cy + y, hi - lo + 1, color);
+        }
+      }
+    }
+  }
+}
+#else  // !defined(GFX_FIXED_POINT_ARC)
 void Arduino_GFX::fillArcHelper(int16_t cx, int16_t cy, int16_t oradius, int16_t iradius, float start, float end, uint16_t color)
 {
   if ((start == 90.0) || (start == 180.0) || (start == 270.0) || (start == 360.0))
@@ -821,6 +1166,7 @@ void Arduino_GFX::fillArcHelper(int16_t cx, int16_t cy, int16_t oradius, int16_t
     } while (++x <= xe);
   } while (++y <= ye);
 }
+#endif // !defined(GFX_FIXED_POINT_ARC)
 
 /**************************************************************************/
 /*!
@@ -900,6 +1246,91 @@ void Arduino_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w,
   endWrite();
 }
 
+/**************************************************************************/
+/*!
+  @brief  Draw a circle with filled color and anti-aliased edge
+  @param  x       Center-point x coordinate
+  @param  y       Center-point y coordinate
+  @param  r       Radius of circle
+  @param  color   16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void Arduino_GFX::fillSmoothCircle(int16_t x, int16_t y, int16_t r, uint16_t color)
+{
+  fillSmoothRoundRect(x - r, y - r, (r << 1) + 1, (r << 1) + 1, r, color);
+}
+
+/**************************************************************************/
+/*!
+  @brief  Draw a rounded rectangle with fill color and anti-aliased corners.
+    Edge pixels are blended into what is already there on framebuffer
+    displays, see writePixelAlpha().
+  @param  x       Top left corner x coordinate
+  @param  y       Top left corner y coordinate
+  @param  w       Width in pixels
+  @param  h       Height in pixels
+  @param  r       Radius of corner rounding
+  @param  color   16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void Arduino_GFX::fillSmoothRoundRect(int16_t x, int16_t y, int16_t w,
+                                      int16_t h, int16_t r, uint16_t color)
+{
+  if ((w <= 0) || (h <= 0))
+  {
+    return;
+  }
+  int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
+  if (r > max_radius)
+    r = max_radius;
+  if (r < 0)
+    r = 0;
+
+  startWrite();
+  writeFillRect(x, y + r, w, h - (r << 1), color);
+  if (r)
+  {
+    // A pixel at distance d from its corner's center is covered r + 1 - d,
+    // so it is solid up to r and blended out to r + 1
+    int32_t left = x + r;
+    int32_t right = x + w - 1 - r;
+    int32_t top = y + r;
+    int32_t bottom = y + h - 1 - r;
+    int32_t r2 = (int32_t)r * r;
+    int32_t outer2 = (int32_t)(r + 1) * (r + 1);
+    GFXspanBatch spans(this, color);
+    for (int32_t dy = 1; dy <= r; dy++)
+    {
+      int32_t dy2 = dy * dy;
+      int32_t xi = gfxSqrt(r2 - dy2);
+      int32_t xo = gfxSqrt(outer2 - 1 - dy2);
+
+      spans.add(left - xi, top - dy, right - left + (xi << 1) + 1);
+      spans.add(left - xi, bottom + dy, right - left + (xi << 1) + 1);
+
+      for (int32_t dx = xi + 1; dx <= xo; dx++)
+      {
+        // distance in 1/64 pixel
+        int32_t d = gfxSqrt((uint32_t)(dx * dx + dy2) << 12);
+        int32_t alpha = ((((int32_t)(r + 1) << 6) - d) * 255) >> 6;
+        if (alpha <= 0)
+        {
+          continue;
+        }
+        if (alpha > 255)
+        {
+          alpha = 255;
+        }
+        writePixelAlpha(left - dx, top - dy, color, alpha);
+        writePixelAlpha(right + dx, top - dy, color, alpha);
+        writePixelAlpha(left - dx, bottom + dy, color, alpha);
+        writePixelAlpha(right + dx, bottom + dy, color, alpha);
+      }
+    }
+  }
+  endWrite();
+}
+
 /**************************************************************************/
 /*!
   @brief  Draw a triangle with no fill color
@@ -1742,51 +2173,159 @@ void Arduino_GFX::draw24bitRGBBitmap(int16_t x, int16_t y,
   endWrite();
 }
 
-#if defined(U8G2_FONT_SUPPORT)
-uint16_t Arduino_GFX::u8g2_font_get_word(const uint8_t *font, uint8_t offset)
-{
-  uint16_t pos;
-  font += offset;
-  pos = pgm_read_byte(font);
-  font++;
-  pos <<= 8;
-  pos += pgm_read_byte(font);
-
-  return pos;
-}
-
-uint8_t Arduino_GFX::u8g2_font_decode_get_unsigned_bits(uint8_t cnt)
+/**************************************************************************/
+/*!
+  @brief  Draw a 16-bit image (RGB 5/6/5) at the specified (x,y) position,
+    skipping every pixel of the transparent color (color keyed images).
+  @param  x                  Top left corner x coordinate
+  @param  y                  Top left corner y coordinate
+  @param  bitmap             byte array with 16-bit color bitmap
+  @param  transparent_color  16-bit 5-6-5 Color left undrawn
+  @param  w                  Width of bitmap in pixels
+  @param  h                  Height of bitmap in pixels
+*/
+/**************************************************************************/
+void Arduino_GFX::draw16bitRGBBitmapWithTranColor(int16_t x, int16_t y,
+                                                  uint16_t *bitmap, uint16_t transparent_color, int16_t w, int16_t h)
 {
-  uint8_t val;
-  uint8_t bit_pos = _u8g2_decode_bit_pos;
-  uint8_t bit_pos_plus_cnt;
-
-  val = pgm_read_byte(_u8g2_decode_ptr);
-
-  val >>= bit_pos;
-  bit_pos_plus_cnt = bit_pos;
-  bit_pos_plus_cnt += cnt;
-  if (bit_pos_plus_cnt >= 8)
+  int32_t offset = 0;
+  uint16_t color;
+  startWrite();
+  for (int16_t j = 0; j < h; j++, y++)
   {
-    uint8_t s = 8;
-    s -= bit_pos;
-    _u8g2_decode_ptr++;
-    val |= pgm_read_byte(_u8g2_decode_ptr) << (s);
-    bit_pos_plus_cnt -= 8;
+    for (int16_t i = 0; i < w; i++)
+    {
+      color = bitmap[offset++];
+      if (color != transparent_color)
+      {
+        writePixel(x + i, y, color);
+      }
+    }
   }
-  val &= (1U << cnt) - 1;
-
-  _u8g2_decode_bit_pos = bit_pos_plus_cnt;
-
-  return val;
+  endWrite();
 }
 
-int8_t Arduino_GFX::u8g2_font_decode_get_signed_bits(uint8_t cnt)
-{
-  int8_t v, d;
-  v = (int8_t)u8g2_font_decode_get_unsigned_bits(cnt);
-  d = 1;
-  cnt--;
+/**************************************************************************/
+/*!
+  @brief  Blend a 16-bit image (RGB 5/6/5) with an 8-bit alpha plane (A8,
+    one byte per pixel, 0 = clear, 255 = opaque) over the specified (x,y)
+    position. Displays without a framebuffer to read back draw the pixels
+    that are at least half opaque, see writePixelAlpha().
+  @param  x       Top left corner x coordinate
+  @param  y       Top left corner y coordinate
+  @param  bitmap  array with 16-bit color bitmap
+  @param  alpha   byte array with 8-bit alpha bitmap
+  @param  w       Width of bitmap in pixels
+  @param  h       Height of bitmap in pixels
+*/
+/**************************************************************************/
+void Arduino_GFX::drawAlphaBitmap(int16_t x, int16_t y,
+                                  const uint16_t bitmap[], const uint8_t alpha[], int16_t w, int16_t h)
+{
+  int32_t offset = 0;
+  uint8_t a;
+  startWrite();
+  for (int16_t j = 0; j < h; j++, y++)
+  {
+    for (int16_t i = 0; i < w; i++, offset++)
+    {
+      a = pgm_read_byte(&alpha[offset]);
+      if (a == 255)
+      {
+        writePixel(x + i, y, pgm_read_word(&bitmap[offset]));
+      }
+      else if (a)
+      {
+        writePixelAlpha(x + i, y, pgm_read_word(&bitmap[offset]), a);
+      }
+    }
+  }
+  endWrite();
+}
+
+/**************************************************************************/
+/*!
+  @brief  Blend one color through an 8-bit alpha mask (A8, one byte per
+    pixel, 0 = clear, 255 = opaque) over the specified (x,y) position, e.g.
+    a recolorable icon. Displays without a framebuffer to read back draw
+    the pixels that are at least half opaque, see writePixelAlpha().
+  @param  x       Top left corner x coordinate
+  @param  y       Top left corner y coordinate
+  @param  mask    byte array with 8-bit alpha bitmap
+  @param  w       Width of bitmap in pixels
+  @param  h       Height of bitmap in pixels
+  @param  color   16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void Arduino_GFX::drawA8Mask(int16_t x, int16_t y,
+                             const uint8_t mask[], int16_t w, int16_t h, uint16_t color)
+{
+  int32_t offset = 0;
+  uint8_t a;
+  startWrite();
+  for (int16_t j = 0; j < h; j++, y++)
+  {
+    for (int16_t i = 0; i < w; i++)
+    {
+      a = pgm_read_byte(&mask[offset++]);
+      if (a == 255)
+      {
+        writePixel(x + i, y, color);
+      }
+      else if (a)
+      {
+        writePixelAlpha(x + i, y, color, a);
+      }
+    }
+  }
+  endWrite();
+}
+
+#if defined(U8G2_FONT_SUPPORT)
+uint16_t Arduino_GFX::u8g2_font_get_word(const uint8_t *font, uint8_t offset)
+{
+  uint16_t pos;
+  font += offset;
+  pos = pgm_read_byte(font);
+  font++;
+  pos <<= 8;
+  pos += pgm_read_byte(font);
+
+  return pos;
+}
+
+uint8_t Arduino_GFX::u8g2_font_decode_get_unsigned_bits(uint8_t cnt)
+{
+  uint8_t val;
+  uint8_t bit_pos = _u8g2_decode_bit_pos;
+  uint8_t bit_pos_plus_cnt;
+
+  val = pgm_read_byte(_u8g2_decode_ptr);
+
+  val >>= bit_pos;
+  bit_pos_plus_cnt = bit_pos;
+  bit_pos_plus_cnt += cnt;
+  if (bit_pos_plus_cnt >= 8)
+  {
+    uint8_t s = 8;
+    s -= bit_pos;
+    _u8g2_decode_ptr++;
+    val |= pgm_read_byte(_u8g2_decode_ptr) << (s);
+    bit_pos_plus_cnt -= 8;
+  }
+  val &= (1U << cnt) - 1;
+
+  _u8g2_decode_bit_pos = bit_pos_plus_cnt;
+
+  return val;
+}
+
+int8_t Arduino_GFX::u8g2_font_decode_get_signed_bits(uint8_t cnt)
+{
+  int8_t v, d;
+  v = (int8_t)u8g2_font_decode_get_unsigned_bits(cnt);
+  d = 1;
+  cnt--;
   d <<= cnt;
   v -= d;
 
@@ -1871,6 +2410,336 @@ void Arduino_GFX::u8g2_font_decode_len(uint8_t len, uint8_t is_foreground, uint1
   _u8g2_dx = lx;
   _u8g2_dy = ly;
 }
+
+/**************************************************************************/
+/*!
+  @brief  Decode the current glyph into a bitmap instead of drawing it
+  @param  bitmap  One bit per pixel, MSB first, rows padded to whole bytes
+*/
+/**************************************************************************/
+void Arduino_GFX::u8g2_font_decode_bitmap(uint8_t *bitmap)
+{
+  uint8_t stride = (_u8g2_char_width + 7) >> 3;
+  memset(bitmap, 0, stride * _u8g2_char_height);
+
+  /* same run walk as u8g2_font_decode_len(), setting the foreground bits */
+  uint8_t lx = 0;
+  uint8_t ly = 0;
+  for (;;)
+  {
+    uint8_t a = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_0);
+    uint8_t b = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_1);
+    do
+    {
+      for (uint8_t run = 0; run < 2; run++)
+      {
+        uint8_t cnt = run ? b : a;
+        for (;;)
+        {
+          uint8_t rem = _u8g2_char_width - lx;
+          uint8_t current = (cnt < rem) ? cnt : rem;
+          if (run && (ly < _u8g2_char_height))
+          {
+            uint8_t *row = bitmap + (ly * stride);
+            for (uint8_t i = lx; i < lx + current; i++)
+            {
+              row[i >> 3] |= 0x80 >> (i & 7);
+            }
+          }
+          if (cnt < rem)
+            break;
+          cnt -= rem;
+          lx = 0;
+          ly++;
+        }
+        lx += cnt;
+      }
+    } while (u8g2_font_decode_get_unsigned_bits(1) != 0);
+
+    if (ly >= _u8g2_char_height)
+      break;
+  }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Index the current font's glyphs by encoding, so write() can
+          binary search for them instead of walking the glyph lists; fonts
+          whose glyphs aren't sorted keep the walk
+*/
+/**************************************************************************/
+void Arduino_GFX::u8g2_font_build_index()
+{
+  free(_u8g2_index);
+  _u8g2_index = NULL;
+  _u8g2_index_cnt = 0;
+  _u8g2_index_font = u8g2Font;
+
+  // count the glyphs on the first pass, record them on the second
+  uint32_t cnt = 0;
+  for (uint8_t pass = 0; pass < 2; pass++)
+  {
+    cnt = 0;
+    const uint8_t *font = u8g2Font + 23; // U8G2_FONT_DATA_STRUCT_SIZE
+    while (pgm_read_byte(font + 1) != 0)
+    {
+      if (pass)
+      {
+        _u8g2_index[cnt].encoding = pgm_read_byte(font);
+        _u8g2_index[cnt].offset = (font + 2) - u8g2Font;
+      }
+      cnt++;
+      font += pgm_read_byte(font + 1);
+    }
+#ifdef U8G2_WITH_UNICODE
+    /* the first lookup table entry jumps to the first unicode glyph */
+    font = u8g2Font + 23 + _u8g2_start_pos_unicode;
+    font += u8g2_font_get_word(font, 0);
+    while ((u8g2_font_get_word(font, 0) != 0) && (pgm_read_byte(font + 2) != 0))
+    {
+      if (pass)
+      {
+        _u8g2_index[cnt].encoding = u8g2_font_get_word(font, 0);
+        _u8g2_index[cnt].offset = (font + 3) - u8g2Font;
+      }
+      cnt++;
+      font += pgm_read_byte(font + 2);
+    }
+#endif
+
+    if (pass == 0)
+    {
+      if (cnt == 0)
+      {
+        return;
+      }
+#if defined(ESP32)
+      if (psramFound())
+      {
+        _u8g2_index = (U8g2GlyphIndex *)ps_malloc(cnt * sizeof(U8g2GlyphIndex));
+      }
+      else
+#endif
+      {
+        _u8g2_index = (U8g2GlyphIndex *)malloc(cnt * sizeof(U8g2GlyphIndex));
+      }
+      if (!_u8g2_index)
+      {
+        return;
+      }
+    }
+  }
+
+  for (uint32_t i = 1; i < cnt; i++)
+  {
+    if (_u8g2_index[i].encoding <= _u8g2_index[i - 1].encoding)
+    {
+      free(_u8g2_index);
+      _u8g2_index = NULL;
+      return;
+    }
+  }
+  _u8g2_index_cnt = cnt;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Find a glyph in the current font
+  @param  encoding  Character code, unicode if above 255
+  @returns The glyph's data past its encoding and size, or NULL
+*/
+/**************************************************************************/
+const uint8_t *Arduino_GFX::u8g2_font_find_glyph(uint16_t encoding)
+{
+#ifdef U8G2_WITH_UNICODE
+  if ((encoding > 255) && _u8g2_unicode_index)
+  {
+    /* glyphs are in encoding order: step from the block's first one */
+    const uint8_t *font = u8g2Font + pgm_read_dword(&_u8g2_unicode_index[(encoding - 0x100) >> 4]);
+    for (;;)
+    {
+      uint16_t e = u8g2_font_get_word(font, 0);
+      if (e == encoding)
+      {
+        return font + 3; /* skip encoding and glyph size */
+      }
+      if ((e == 0) || (e > encoding))
+      {
+        return NULL;
+      }
+      font += pgm_read_byte(font + 2);
+    }
+  }
+#endif
+
+  if (_u8g2_index && (_u8g2_index_font == u8g2Font))
+  {
+    uint32_t lo = 0;
+    uint32_t hi = _u8g2_index_cnt;
+    while (lo < hi)
+    {
+      uint32_t mid = (lo + hi) >> 1;
+      if (_u8g2_index[mid].encoding < encoding)
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+    if ((lo < _u8g2_index_cnt) && (_u8g2_index[lo].encoding == encoding))
+    {
+      return u8g2Font + _u8g2_index[lo].offset;
+    }
+    return NULL;
+  }
+
+  const uint8_t *font = u8g2Font;
+  const uint8_t *glyph_data = NULL;
+
+  // extract from u8g2_font_get_glyph_data()
+  font += 23; // U8G2_FONT_DATA_STRUCT_SIZE
+  if (encoding <= 255)
+  {
+    if (encoding >= 'a')
+    {
+      font += _u8g2_start_pos_lower_a;
+    }
+    else if (encoding >= 'A')
+    {
+      font += _u8g2_start_pos_upper_A;
+    }
+
+    for (;;)
+    {
+      if (pgm_read_byte(font + 1) == 0)
+        break;
+      if (pgm_read_byte(font) == encoding)
+      {
+        glyph_data = font + 2; /* skip encoding and glyph size */
+      }
+      font += pgm_read_byte(font + 1);
+    }
+  }
+#ifdef U8G2_WITH_UNICODE
+  else
+  {
+    uint16_t e;
+    font += _u8g2_start_pos_unicode;
+    const uint8_t *unicode_lookup_table = font;
+
+    /* issue 596: search for the glyph start in the unicode lookup table */
+    do
+    {
+      font += u8g2_font_get_word(unicode_lookup_table, 0);
+      e = u8g2_font_get_word(unicode_lookup_table, 2);
+      unicode_lookup_table += 4;
+    } while (e < encoding);
+
+    for (;;)
+    {
+      e = u8g2_font_get_word(font, 0);
+
+      if (e == 0)
+        break;
+
+      if (e == encoding)
+      {
+        glyph_data = font + 3; /* skip encoding and glyph size */
+        break;
+      }
+      font += pgm_read_byte(font + 2);
+    }
+  }
+#endif
+
+  return glyph_data;
+}
+
+#if U8G2_GLYPH_CACHE_SLOTS > 0
+/**************************************************************************/
+/*!
+  @brief  Look a glyph of the current font up in the glyph cache
+  @param  encoding  Character code
+  @returns The cached glyph, now the most recently used, or NULL
+*/
+/**************************************************************************/
+U8g2GlyphCacheEntry *Arduino_GFX::u8g2_glyph_cache_find(uint16_t encoding)
+{
+  if (!_u8g2_cache)
+  {
+    return NULL;
+  }
+  for (uint16_t i = 0; i < U8G2_GLYPH_CACHE_SLOTS; i++)
+  {
+    U8g2GlyphCacheEntry *entry = &_u8g2_cache[i];
+    if ((entry->font == u8g2Font) && (entry->encoding == encoding))
+    {
+      entry->last_use = ++_u8g2_cache_tick;
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Decode the current glyph into the least recently used cache entry,
+          allocating the cache in PSRAM the first time
+  @param  encoding  Character code
+  @returns The new entry, or NULL if the glyph is too big or there is no
+           cache
+*/
+/**************************************************************************/
+U8g2GlyphCacheEntry *Arduino_GFX::u8g2_glyph_cache_add(uint16_t encoding)
+{
+  if ((((_u8g2_char_width + 7) >> 3) * _u8g2_char_height) > U8G2_GLYPH_CACHE_BYTES)
+  {
+    return NULL;
+  }
+  if (!_u8g2_cache)
+  {
+    if (_u8g2_cache_failed)
+    {
+      return NULL;
+    }
+#if defined(ESP32)
+    if (psramFound())
+    {
+      _u8g2_cache = (U8g2GlyphCacheEntry *)ps_calloc(U8G2_GLYPH_CACHE_SLOTS, sizeof(U8g2GlyphCacheEntry));
+    }
+#else
+    _u8g2_cache = (U8g2GlyphCacheEntry *)calloc(U8G2_GLYPH_CACHE_SLOTS, sizeof(U8g2GlyphCacheEntry));
+#endif
+    if (!_u8g2_cache)
+    {
+      _u8g2_cache_failed = true;
+      return NULL;
+    }
+  }
+
+  U8g2GlyphCacheEntry *entry = &_u8g2_cache[0];
+  for (uint16_t i = 1; (i < U8G2_GLYPH_CACHE_SLOTS) && entry->font; i++)
+  {
+    if (!_u8g2_cache[i].font || (_u8g2_cache[i].last_use < entry->last_use))
+    {
+      entry = &_u8g2_cache[i];
+    }
+  }
+
+  entry->font = u8g2Font;
+  entry->encoding = encoding;
+  entry->width = _u8g2_char_width;
+  entry->height = _u8g2_char_height;
+  entry->x = _u8g2_char_x;
+  entry->y = _u8g2_char_y;
+  entry->delta_x = _u8g2_delta_x;
+  entry->last_use = ++_u8g2_cache_tick;
+  u8g2_font_decode_bitmap(entry->bitmap);
+  return entry;
+}
+#endif // U8G2_GLYPH_CACHE_SLOTS > 0
 #endif // defined(U8G2_FONT_SUPPORT)
 
 // TEXT- AND CHARACTER-HANDLING FUNCTIONS ----------------------------------
@@ -1968,6 +2837,54 @@ void Arduino_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 #if defined(U8G2_FONT_SUPPORT)
       if (u8g2Font)
   {
+#if U8G2_GLYPH_CACHE_SLOTS > 0
+    if ((_u8g2_decode_ptr) && (_u8g2_char_width > 0) && (!_u8g2_cached_glyph))
+    {
+      _u8g2_cached_glyph = u8g2_glyph_cache_add(_encoding);
+    }
+    if (_u8g2_cached_glyph)
+    {
+      const U8g2GlyphCacheEntry *glyph = _u8g2_cached_glyph;
+      uint8_t stride = (glyph->width + 7) >> 3;
+      int16_t x0 = x + (glyph->x * textsize_x);
+      int16_t y0 = y - ((glyph->height + glyph->y) * textsize_y);
+
+      startWrite();
+      {
+        GFXspanBatch fg_spans(this, color);
+        GFXspanBatch bg_spans(this, bg);
+        const uint8_t *row = glyph->bitmap;
+        for (uint8_t yy = 0; yy < glyph->height; yy++, row += stride)
+        {
+          uint8_t xx = 0;
+          while (xx < glyph->width)
+          {
+            bool on = row[xx >> 3] & (0x80 >> (xx & 7));
+            uint8_t start = xx;
+            while ((++xx < glyph->width) && (((row[xx >> 3] & (0x80 >> (xx & 7))) != 0) == on))
+            {
+            }
+            if ((!on) && (bg == color))
+            {
+              continue;
+            }
+            if (textsize_x == 1 && textsize_y == 1)
+            {
+              (on ? fg_spans : bg_spans).add(x0 + start, y0 + yy, xx - start);
+            }
+            else
+            {
+              writeFillRect(x0 + (start * textsize_x), y0 + (yy * textsize_y),
+                            ((xx - start) * textsize_x) - text_pixel_margin,
+                            textsize_y - text_pixel_margin, on ? color : bg);
+            }
+          }
+        }
+      }
+      endWrite();
+    }
+    else
+#endif // U8G2_GLYPH_CACHE_SLOTS > 0
     if ((_u8g2_decode_ptr) && (_u8g2_char_width > 0))
     {
       uint8_t a, b;
@@ -2109,6 +3026,9 @@ size_t Arduino_GFX::write(uint8_t c)
       if (u8g2Font)
   {
     _u8g2_decode_ptr = 0;
+#if U8G2_GLYPH_CACHE_SLOTS > 0
+    _u8g2_cached_glyph = NULL;
+#endif
 
     if (_enableUTF8Print)
     {
@@ -2164,76 +3084,33 @@ size_t Arduino_GFX::write(uint8_t c)
       }
       else if (_encoding != '\r')
       { // Ignore carriage returns
-        uint8_t *font = u8g2Font;
-        const uint8_t *glyph_data = 0;
+        const uint8_t *glyph_data = u8g2_font_find_glyph(_encoding);
 
-        // extract from u8g2_font_get_glyph_data()
-        font += 23; // U8G2_FONT_DATA_STRUCT_SIZE
-        if (_encoding <= 255)
+        if (glyph_data)
         {
-          if (_encoding >= 'a')
-          {
-            font += _u8g2_start_pos_lower_a;
-          }
-          else if (_encoding >= 'A')
-          {
-            font += _u8g2_start_pos_upper_A;
-          }
-
-          for (;;)
+          // u8g2_font_decode_glyph
+          _u8g2_decode_ptr = glyph_data;
+#if U8G2_GLYPH_CACHE_SLOTS > 0
+          _u8g2_cached_glyph = u8g2_glyph_cache_find(_encoding);
+          if (_u8g2_cached_glyph)
           {
-            if (pgm_read_byte(font + 1) == 0)
-              break;
-            if (pgm_read_byte(font) == _encoding)
-            {
-              glyph_data = font + 2; /* skip encoding and glyph size */
-            }
-            font += pgm_read_byte(font + 1);
+            _u8g2_char_width = _u8g2_cached_glyph->width;
+            _u8g2_char_height = _u8g2_cached_glyph->height;
+            _u8g2_char_x = _u8g2_cached_glyph->x;
+            _u8g2_char_y = _u8g2_cached_glyph->y;
+            _u8g2_delta_x = _u8g2_cached_glyph->delta_x;
           }
-        }
-#ifdef U8G2_WITH_UNICODE
-        else
-        {
-          uint16_t e;
-          font += _u8g2_start_pos_unicode;
-          const uint8_t *unicode_lookup_table = font;
-
-          /* issue 596: search for the glyph start in the unicode lookup table */
-          do
-          {
-            font += u8g2_font_get_word(unicode_lookup_table, 0);
-            e = u8g2_font_get_word(unicode_lookup_table, 2);
-            unicode_lookup_table += 4;
-          } while (e < _encoding);
-
-          for (;;)
+          else
+#endif // U8G2_GLYPH_CACHE_SLOTS > 0
           {
-            e = u8g2_font_get_word(font, 0);
+            _u8g2_decode_bit_pos = 0;
 
-            if (e == 0)
-              break;
-
-            if (e == _encoding)
-            {
-              glyph_data = font + 3; /* skip encoding and glyph size */
-              break;
-            }
-            font += pgm_read_byte(font + 2);
+            _u8g2_char_width = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_char_width);
+            _u8g2_char_height = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_char_height);
+            _u8g2_char_x = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_char_x);
+            _u8g2_char_y = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_char_y);
+            _u8g2_delta_x = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_delta_x);
           }
-        }
-#endif
-
-        if (glyph_data)
-        {
-          // u8g2_font_decode_glyph
-          _u8g2_decode_ptr = glyph_data;
-          _u8g2_decode_bit_pos = 0;
-
-          _u8g2_char_width = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_char_width);
-          _u8g2_char_height = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_char_height);
-          _u8g2_char_x = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_char_x);
-          _u8g2_char_y = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_char_y);
-          _u8g2_delta_x = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_delta_x);
           // log_d("c: %c, _encoding: %d, _u8g2_char_width: %d, _u8g2_char_height: %d, _u8g2_char_x: %d, _u8g2_char_y: %d, _u8g2_delta_x: %d",
           //       c, _encoding, _u8g2_char_width, _u8g2_char_height, _u8g2_char_x, _u8g2_char_y, _u8g2_delta_x);
 
@@ -2366,10 +3243,19 @@ void Arduino_GFX::flush()
 #endif // !defined(ATTINY_CORE)
 
 #if defined(U8G2_FONT_SUPPORT)
-void Arduino_GFX::setFont(const uint8_t *font)
+/**************************************************************************/
+/*!
+  @brief  Set a u8g2 font to display with print()
+  @param  font           u8g2 font data
+  @param  unicode_index  The font's generated index (font/<font>_index.h),
+                         or NULL to index it in RAM
+*/
+/**************************************************************************/
+void Arduino_GFX::setFont(const uint8_t *font, const uint32_t *unicode_index)
 {
   gfxFont = NULL;
   u8g2Font = (uint8_t *)font;
+  _u8g2_unicode_index = unicode_index;
 
   // extract from u8g2_read_font_info()
   /* offset 0 */
@@ -2414,6 +3300,13 @@ void Arduino_GFX::setFont(const uint8_t *font)
   _u8g2_first_char = pgm_read_byte(font + 23);
   // log_d("_u8g2_start_pos_upper_A: %d, _u8g2_start_pos_lower_a: %d, _u8g2_start_pos_unicode: %d, _u8g2_first_char: %d",
   //       _u8g2_start_pos_upper_A, _u8g2_start_pos_lower_a, _u8g2_start_pos_unicode, _u8g2_first_char);
+
+  // setFont() is often called before every string; index each font once,
+  // and not at all if it comes with an index
+  if ((!unicode_index) && (font != _u8g2_index_font))
+  {
+    u8g2_font_build_index();
+  }
 }
 
 void Arduino_GFX::setUTF8Print(bool isEnable)
@@ -2634,6 +3527,350 @@ void Arduino_GFX::getTextBounds(const __FlashStringHelper *str,
   }
 }
 
+#if !defined(ATTINY_CORE)
+/**************************************************************************/
+/*!
+  @brief  Text layout for a display
+  @param  gfx         The display to lay out and draw on
+  @param  max_glyphs  Longest string the layout will hold, in glyphs
+*/
+/**************************************************************************/
+GFXtextLayout::GFXtextLayout(Arduino_GFX *gfx, uint16_t max_glyphs)
+    : _gfx(gfx),
+      _glyphs((GFXtextGlyph *)malloc(max_glyphs * sizeof(GFXtextGlyph))),
+      _max_glyphs(_glyphs ? max_glyphs : 0)
+{
+}
+
+GFXtextLayout::~GFXtextLayout()
+{
+  free(_glyphs);
+}
+
+/**************************************************************************/
+/*!
+  @brief  Lay a string out with the display's current font, text size and
+          wrap setting, ready to draw()
+  @param  str The ascii string
+  @param  x   Where it will be drawn, for wrapping at the right edge
+  @returns false if the string didn't fit in max_glyphs (the glyphs that
+           did are kept) or the font is a u8g2 one
+*/
+/**************************************************************************/
+bool GFXtextLayout::setText(const char *str, int16_t x)
+{
+  _count = 0;
+  _ink_x1 = _ink_y1 = _box_x1 = _box_y1 = INT16_MAX;
+  _ink_x2 = _ink_y2 = _box_x2 = _box_y2 = INT16_MIN;
+#if defined(U8G2_FONT_SUPPORT)
+  if (_gfx->u8g2Font)
+  {
+    return false;
+  }
+#endif // defined(U8G2_FONT_SUPPORT)
+
+  _font = _gfx->gfxFont;
+  _tsx = _gfx->textsize_x;
+  _tsy = _gfx->textsize_y;
+  _margin = _gfx->text_pixel_margin;
+
+  uint8_t first = 0, last = 0, line_h = 8, baseline = 0;
+  if (_font)
+  {
+    first = pgm_read_byte(&_font->first);
+    last = pgm_read_byte(&_font->last);
+    line_h = pgm_read_byte(&_font->yAdvance);
+    baseline = line_h * 2 / 3; // as drawChar()
+  }
+
+  int16_t pen_x = 0, pen_y = 0;
+  uint8_t c;
+  while ((c = *str++))
+  {
+    if (c == '\n')
+    {
+      pen_x = 0;
+      pen_y += _tsy * line_h;
+      continue;
+    }
+    if (c == '\r')
+    {
+      continue;
+    }
+    if (_count == _max_glyphs)
+    {
+      return false;
+    }
+
+    GFXtextGlyph *g = &_glyphs[_count];
+    int16_t advance;
+    if (_font)
+    {
+      if ((c < first) || (c > last))
+      {
+        continue;
+      }
+      GFXglyph *glyph = pgm_read_glyph_ptr(_font, c - first);
+      uint8_t xa = pgm_read_byte(&glyph->xAdvance);
+      g->bitmap = pgm_read_word(&glyph->bitmapOffset);
+      g->w = pgm_read_byte(&glyph->width);
+      g->h = pgm_read_byte(&glyph->height);
+      g->xo = pgm_read_byte(&glyph->xOffset);
+      g->yo = pgm_read_byte(&glyph->yOffset);
+      g->cell_w = (xa < g->w) ? g->w : xa;
+      advance = xa * _tsx;
+    }
+    else
+    {
+      g->bitmap = c;
+      g->w = 5;
+      g->h = 8;
+      g->xo = g->yo = 0;
+      g->cell_w = 6;
+      advance = 6 * _tsx;
+    }
+
+    if (_gfx->wrap && (pen_x > 0) && ((x + pen_x + advance - 1) > _gfx->_max_x))
+    {
+      pen_x = 0;
+      pen_y += _tsy * line_h;
+    }
+    g->x = pen_x;
+    g->y = pen_y;
+
+    int16_t cell_x1 = pen_x;
+    int16_t cell_y1 = pen_y - (baseline * _tsy);
+    int16_t cell_x2 = cell_x1 + (g->cell_w * _tsx) - 1;
+    int16_t cell_y2 = cell_y1 + (line_h * _tsy) - 1;
+    int16_t ink_x1, ink_y1, ink_x2, ink_y2;
+    if (_font)
+    {
+      ink_x1 = pen_x + (g->xo * _tsx);
+      ink_y1 = pen_y + (g->yo * _tsy);
+      ink_x2 = ink_x1 + (g->w * _tsx) - 1;
+      ink_y2 = ink_y1 + (g->h * _tsy) - 1;
+    }
+    else // the whole cell, as charBounds()
+    {
+      ink_x1 = cell_x1;
+      ink_y1 = cell_y1;
+      ink_x2 = cell_x2;
+      ink_y2 = cell_y2;
+    }
+    if (g->w && g->h)
+    {
+      _ink_x1 = min(_ink_x1, ink_x1);
+      _ink_y1 = min(_ink_y1, ink_y1);
+      _ink_x2 = max(_ink_x2, ink_x2);
+      _ink_y2 = max(_ink_y2, ink_y2);
+    }
+    _box_x1 = min(_box_x1, min(cell_x1, ink_x1));
+    _box_y1 = min(_box_y1, min(cell_y1, ink_y1));
+    _box_x2 = max(_box_x2, max(cell_x2, ink_x2));
+    _box_y2 = max(_box_y2, max(cell_y2, ink_y2));
+
+    pen_x += advance;
+    _count++;
+  }
+  return true;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Bounds of the laid out string drawn at x, y, as getTextBounds()
+  @param  x   The cursor X
+  @param  y   The cursor Y
+  @param  x1  The boundary X coordinate, set by function
+  @param  y1  The boundary Y coordinate, set by function
+  @param  w   The boundary width, set by function
+  @param  h   The boundary height, set by function
+*/
+/**************************************************************************/
+void GFXtextLayout::getBounds(int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+{
+  *x1 = x;
+  *y1 = y;
+  *w = *h = 0;
+  if (_ink_x2 >= _ink_x1)
+  {
+    *x1 = x + _ink_x1;
+    *w = _ink_x2 - _ink_x1 + 1;
+  }
+  if (_ink_y2 >= _ink_y1)
+  {
+    *y1 = y + _ink_y1;
+    *h = _ink_y2 - _ink_y1 + 1;
+  }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Draw the laid out string
+  @param  x       The cursor X, as setCursor() before print()
+  @param  y       The cursor Y
+  @param  color   16-bit 5-6-5 Color to draw the text with
+  @param  bg      16-bit 5-6-5 Color to fill background with (if same as color, no background)
+*/
+/**************************************************************************/
+void GFXtextLayout::draw(int16_t x, int16_t y, uint16_t color, uint16_t bg)
+{
+  if (!_count)
+  {
+    return;
+  }
+
+  int16_t x1 = x + _box_x1, y1 = y + _box_y1;
+  int16_t x2 = x + _box_x2, y2 = y + _box_y2;
+  if ((x1 > _gfx->_max_x) || (y1 > _gfx->_max_y) || (x2 < 0) || (y2 < 0))
+  {
+    return;
+  }
+  _inside = (x1 >= 0) && (y1 >= 0) && (x2 <= _gfx->_max_x) && (y2 <= _gfx->_max_y);
+
+  _gfx->startWrite();
+  {
+    GFXspanBatch fg_spans(_gfx, color);
+    GFXspanBatch bg_spans(_gfx, bg);
+    for (uint16_t i = 0; i < _count; i++)
+    {
+      drawGlyph(&_glyphs[i], x, y, color, bg, &fg_spans, &bg_spans);
+    }
+  }
+  _gfx->endWrite();
+}
+
+void GFXtextLayout::fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if (_inside)
+  {
+    _gfx->writeFillRectPreclipped(x, y, w, h, color);
+  }
+  else
+  {
+    _gfx->writeFillRect(x, y, w, h, color);
+  }
+}
+
+// len pixels from bitmap column start of the row at x, y, scaled
+void GFXtextLayout::drawRun(int16_t x, int16_t y, uint8_t start, uint8_t len, uint16_t color, GFXspanBatch *spans)
+{
+  if ((_tsx == 1) && (_tsy == 1))
+  {
+    spans->add(x + start, y, len);
+  }
+  else if (_margin == 0)
+  {
+    fill(x + (start * _tsx), y, len * _tsx, _tsy, color);
+  }
+  else
+  {
+    for (uint8_t i = start; i < start + len; i++)
+    {
+      fill(x + (i * _tsx), y, _tsx - _margin, _tsy - _margin, color);
+    }
+  }
+}
+
+void GFXtextLayout::drawGlyph(const GFXtextGlyph *g, int16_t x, int16_t y, uint16_t color, uint16_t bg,
+                              GFXspanBatch *fg_spans, GFXspanBatch *bg_spans)
+{
+  int16_t pen_x = x + g->x;
+  int16_t pen_y = y + g->y;
+
+  if (_font)
+  {
+    if (bg != color)
+    {
+      // Over whatever the previous glyph left in its neighbour's cell, as drawChar()
+      fg_spans->flush();
+      uint8_t line_h = pgm_read_byte(&_font->yAdvance);
+      fill(pen_x, pen_y - ((line_h * 2 / 3) * _tsy), g->cell_w * _tsx, line_h * _tsy, bg);
+    }
+
+    const uint8_t *bitmap = pgm_read_bitmap_ptr(_font) + g->bitmap;
+    int16_t gx = pen_x + (g->xo * _tsx);
+    int16_t gy = pen_y + (g->yo * _tsy);
+    uint8_t bits = 0, bit = 0;
+    for (uint8_t yy = 0; yy < g->h; yy++, gy += _tsy)
+    {
+      uint8_t start = 0, len = 0;
+      for (uint8_t xx = 0; xx < g->w; xx++)
+      {
+        if (!(bit++ & 7))
+        {
+          bits = pgm_read_byte(bitmap++);
+        }
+        if (bits & 0x80)
+        {
+          if (!len)
+          {
+            start = xx;
+          }
+          len++;
+        }
+        else if (len)
+        {
+          drawRun(gx, gy, start, len, color, fg_spans);
+          len = 0;
+        }
+        bits <<= 1;
+      }
+      if (len)
+      {
+        drawRun(gx, gy, start, len, color, fg_spans);
+      }
+    }
+  }
+  else // glcdfont, 5 columns and a blank one
+  {
+    uint8_t lines[6];
+    for (uint8_t i = 0; i < 5; i++)
+    {
+      lines[i] = pgm_read_byte(&font[g->bitmap * 5 + i]);
+    }
+    lines[5] = 0;
+
+    int16_t gy = pen_y;
+    for (uint8_t j = 0; j < 8; j++, gy += _tsy)
+    {
+      uint8_t i = 0;
+      while (i < 6)
+      {
+        bool on = (lines[i] >> j) & 1;
+        uint8_t start = i;
+        while ((++i < 6) && ((bool)((lines[i] >> j) & 1) == on))
+        {
+        }
+        if (on)
+        {
+          drawRun(pen_x, gy, start, i - start, color, fg_spans);
+          if ((_margin > 0) && ((_tsx > 1) || (_tsy > 1)))
+          {
+            // drawChar() fills the margins with bg even without a background
+            for (uint8_t k = start; k < i; k++)
+            {
+              fill(pen_x + ((k + 1) * _tsx) - _margin, gy, _margin, _tsy, bg);
+              fill(pen_x + (k * _tsx), gy + _tsy - _margin, _tsx - _margin, _margin, bg);
+            }
+          }
+        }
+        else if (bg != color)
+        {
+          if ((_tsx == 1) && (_tsy == 1))
+          {
+            bg_spans->add(pen_x + start, gy, i - start);
+          }
+          else
+          {
+            fill(pen_x + (start * _tsx), gy, (i - start) * _tsx, _tsy, bg);
+          }
+        }
+      }
+    }
+  }
+}
+#endif // !defined(ATTINY_CORE)
+
 /**************************************************************************/
 /*!
   @brief  Invert the display (ideally using built-in hardware command)
@@ -18,6 +18,12 @@
 #define DEGTORAD 0.017453292519943295769236907684886F
 #endif
 
+// fillArc() and drawArc() rasterize spans with integer math and a sine table;
+// define GFX_FLOAT_ARC to use the original floating point per-pixel helper
+#if !defined(GFX_FLOAT_ARC)
+#define GFX_FIXED_POINT_ARC
+#endif
+
 #if __has_include(<U8g2lib.h>)
 #include <U8g2lib.h>
 #define U8G2_FONT_SUPPORT
@@ -25,6 +31,9 @@
 #include "font/u8g2_font_unifont_t_chinese.h"
 #include "font/u8g2_font_unifont_t_chinese4.h"
 #include "font/u8g2_font_unifont_t_cjk.h"
+#include "font/u8g2_font_unifont_t_chinese_index.h"
+#include "font/u8g2_font_unifont_t_chinese4_index.h"
+#include "font/u8g2_font_unifont_t_cjk_index.h"
 #endif
 
 // Color definitions
@@ -106,6 +115,69 @@
 #define _in_range(v, a, b) ((a > b) ? _ordered_in_range(v, b, a) : _ordered_in_range(v, a, b))
 #endif
 
+// One row of a filled shape, see writeSpans()
+typedef struct
+{
+  int16_t x, y, w;
+} GFXspan;
+
+// Spans a shape collects before handing them to writeSpans()
+#define GFX_SPAN_BATCH 32
+
+#if !defined(ATTINY_CORE)
+// One glyph of a GFXtextLayout, relative to the layout's origin
+typedef struct
+{
+  int16_t x, y;    // Pen position, where write() would drawChar() it
+  uint16_t bitmap; // GFXfont bitmap offset, or glcdfont character
+  uint8_t w, h;    // Bitmap size
+  int8_t xo, yo;   // Bitmap offset from the pen
+  uint8_t cell_w;  // Background cell width before scaling
+} GFXtextGlyph;
+
+class GFXtextLayout;
+class GFXspanBatch;
+#endif // !defined(ATTINY_CORE)
+
+#if defined(U8G2_FONT_SUPPORT)
+// u8g2 glyphs drawChar() has decoded are kept as bitmaps in an LRU of
+// U8G2_GLYPH_CACHE_SLOTS entries in PSRAM; define it as 0 to decode every time
+#if !defined(U8G2_GLYPH_CACHE_SLOTS)
+#if defined(ESP32)
+#define U8G2_GLYPH_CACHE_SLOTS 64
+#else
+#define U8G2_GLYPH_CACHE_SLOTS 0
+#endif
+#endif
+
+// Bitmap bytes per cache entry; larger glyphs are decoded every time
+#if !defined(U8G2_GLYPH_CACHE_BYTES)
+#define U8G2_GLYPH_CACHE_BYTES 512 // 64 x 64 pixels
+#endif
+
+// Entries in a font's generated unicode index (scripts/u8g2_font_index.py):
+// where the first glyph of each 16 codepoints from 0x100 up starts
+#define U8G2_UNICODE_INDEX_BLOCKS ((0x10000 - 0x100) >> 4)
+
+// Where a glyph's data starts in its font, see setFont(const uint8_t *)
+typedef struct
+{
+  uint32_t offset;
+  uint16_t encoding;
+} U8g2GlyphIndex;
+
+// One decoded glyph, one bit per pixel, rows padded to whole bytes
+typedef struct
+{
+  const uint8_t *font;
+  uint16_t encoding;
+  uint8_t width, height;
+  int8_t x, y, delta_x;
+  uint32_t last_use;
+  uint8_t bitmap[U8G2_GLYPH_CACHE_BYTES];
+} U8g2GlyphCacheEntry;
+#endif // defined(U8G2_FONT_SUPPORT)
+
 #if !defined(ATTINY_CORE)
 INLINE GFXglyph *pgm_read_glyph_ptr(const GFXfont *gfxFont, uint8_t c)
 {
@@ -155,6 +227,11 @@ public:
   virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
   virtual void endWrite(void);
+  // Fill a batch of rows, clipping each; framebuffer displays fill them in place
+  virtual void writeSpans(const GFXspan *spans, uint16_t count, uint16_t color);
+  // Blend color over pixel (x, y) at alpha / 255; displays that can't read
+  // back their pixels draw it when alpha is 128 or more
+  virtual void writePixelAlpha(int16_t x, int16_t y, uint16_t color, uint8_t alpha);
 
   // CONTROL API
   // These MAY be overridden by the subclass to provide device-specific
@@ -183,6 +260,8 @@ public:
   void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
   void drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h, int16_t radius, uint16_t color);
   void fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h, int16_t radius, uint16_t color);
+  void fillSmoothCircle(int16_t x, int16_t y, int16_t r, uint16_t color);
+  void fillSmoothRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t radius, uint16_t color);
   void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
   void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color);
   void drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
@@ -201,12 +280,19 @@ public:
 #if !defined(ATTINY_CORE)
   void setFont(const GFXfont *f = NULL);
 #if defined(U8G2_FONT_SUPPORT)
-  void setFont(const uint8_t *font);
+  void setFont(const uint8_t *font, const uint32_t *unicode_index = NULL);
   void setUTF8Print(bool isEnable);
   uint16_t u8g2_font_get_word(const uint8_t *font, uint8_t offset);
   uint8_t u8g2_font_decode_get_unsigned_bits(uint8_t cnt);
   int8_t u8g2_font_decode_get_signed_bits(uint8_t cnt);
   void u8g2_font_decode_len(uint8_t len, uint8_t is_foreground, uint16_t color, uint16_t bg);
+  void u8g2_font_decode_bitmap(uint8_t *bitmap);
+  void u8g2_font_build_index();
+  const uint8_t *u8g2_font_find_glyph(uint16_t encoding);
+#if U8G2_GLYPH_CACHE_SLOTS > 0
+  U8g2GlyphCacheEntry *u8g2_glyph_cache_find(uint16_t encoding);
+  U8g2GlyphCacheEntry *u8g2_glyph_cache_add(uint16_t encoding);
+#endif
 #endif // defined(U8G2_FONT_SUPPORT)
   virtual void flush(void);
 #endif // !defined(ATTINY_CORE)
@@ -235,6 +321,9 @@ public:
   void draw16bitBeRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h);
   void draw24bitRGBBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h);
   void draw24bitRGBBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h);
+  void draw16bitRGBBitmapWithTranColor(int16_t x, int16_t y, uint16_t *bitmap, uint16_t transparent_color, int16_t w, int16_t h);
+  void drawAlphaBitmap(int16_t x, int16_t y, const uint16_t bitmap[], const uint8_t alpha[], int16_t w, int16_t h);
+  void drawA8Mask(int16_t x, int16_t y, const uint8_t mask[], int16_t w, int16_t h, uint16_t color);
   void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg);
 #else  // !defined(LITTLE_FOOT_PRINT)
   virtual void writeSlashLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
@@ -250,6 +339,9 @@ public:
   virtual void draw16bitBeRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h);
   virtual void draw24bitRGBBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h);
   virtual void draw24bitRGBBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h);
+  virtual void draw16bitRGBBitmapWithTranColor(int16_t x, int16_t y, uint16_t *bitmap, uint16_t transparent_color, int16_t w, int16_t h);
+  virtual void drawAlphaBitmap(int16_t x, int16_t y, const uint16_t bitmap[], const uint8_t alpha[], int16_t w, int16_t h);
+  virtual void drawA8Mask(int16_t x, int16_t y, const uint8_t mask[], int16_t w, int16_t h, uint16_t color);
   virtual void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg);
 #endif // !defined(LITTLE_FOOT_PRINT)
 
@@ -357,7 +449,26 @@ public:
     return ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
   }
 
+  /*!
+    @brief   Blend two '565' colors, all channels at once
+    @param   fg     Color on top
+    @param   bg     Color underneath
+    @param   alpha  Weight of fg (0 = bg only, 255 = fg only)
+    @return  Blended 16-bit color value (565 format).
+  */
+  static uint16_t blend565(uint16_t fg, uint16_t bg, uint8_t alpha)
+  {
+    uint32_t a = (alpha + 4) >> 3; // 0..32
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+    uint32_t r = ((((f - b) * a) >> 5) + b) & 0x07E0F81F;
+    return (uint16_t)(r | (r >> 16));
+  }
+
 protected:
+#if !defined(ATTINY_CORE)
+  friend class GFXtextLayout;
+#endif
   void charBounds(char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy);
   int16_t
       _width,   ///< Display width as modified by current rotation
@@ -414,6 +525,20 @@ protected:
 
   const uint8_t *_u8g2_decode_ptr;
   uint8_t _u8g2_decode_bit_pos;
+
+  const uint32_t *_u8g2_unicode_index = NULL; // U8G2_UNICODE_INDEX_BLOCKS offsets in flash
+
+  // Sorted by encoding, built by setFont() for _u8g2_index_font
+  U8g2GlyphIndex *_u8g2_index = NULL;
+  const uint8_t *_u8g2_index_font = NULL;
+  uint32_t _u8g2_index_cnt = 0;
+
+#if U8G2_GLYPH_CACHE_SLOTS > 0
+  U8g2GlyphCacheEntry *_u8g2_cache = NULL;
+  U8g2GlyphCacheEntry *_u8g2_cached_glyph = NULL; // The glyph write() is drawing, if cached
+  uint32_t _u8g2_cache_tick = 0;
+  bool _u8g2_cache_failed = false;
+#endif
 #endif // defined(U8G2_FONT_SUPPORT)
 
 #if defined(LITTLE_FOOT_PRINT)
@@ -423,4 +548,47 @@ protected:
 #endif        // defined(LITTLE_FOOT_PRINT)
 };
 
+#if !defined(ATTINY_CORE)
+/// A string laid out once with a display's current font, text size and wrap
+/// setting, then drawn as often as needed without measuring it again: one
+/// bounds check and one startWrite()/endWrite() per draw. Each line,
+/// wrapped ones included, starts at the layout's x. u8g2 fonts aren't
+/// supported.
+class GFXtextLayout
+{
+public:
+  GFXtextLayout(Arduino_GFX *gfx, uint16_t max_glyphs = 32);
+  ~GFXtextLayout();
+  GFXtextLayout(const GFXtextLayout &) = delete;
+  GFXtextLayout &operator=(const GFXtextLayout &) = delete;
+
+  bool setText(const char *str, int16_t x = 0);
+  void getBounds(int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h);
+  void draw(int16_t x, int16_t y, uint16_t color, uint16_t bg);
+  void draw(int16_t x, int16_t y, uint16_t color) { draw(x, y, color, color); }
+  uint16_t count() { return _count; }
+
+private:
+  void drawGlyph(const GFXtextGlyph *g, int16_t x, int16_t y, uint16_t color, uint16_t bg,
+                 GFXspanBatch *fg_spans, GFXspanBatch *bg_spans);
+  void drawRun(int16_t x, int16_t y, uint8_t start, uint8_t len, uint16_t color, GFXspanBatch *spans);
+  void fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+  Arduino_GFX *_gfx;
+  GFXtextGlyph *_glyphs;
+  uint16_t _max_glyphs;
+  uint16_t _count = 0;
+
+  // Font and size the glyphs were laid out with
+  const GFXfont *_font = NULL;
+  uint8_t _tsx = 1, _tsy = 1, _margin = 0;
+
+  // Ink bounds, as getTextBounds() reports them, and everything draw()
+  // touches, background cells included; inclusive, relative to the origin
+  int16_t _ink_x1, _ink_y1, _ink_x2, _ink_y2;
+  int16_t _box_x1, _box_y1, _box_x2, _box_y2;
+  bool _inside; // The current draw() is entirely on screen
+};
+#endif // !defined(ATTINY_CORE)
+
 #endif // _ARDUINO_GFX_H_
@@ -246,69 +246,6 @@ void Arduino_TFT::pushColor(uint16_t color)
   _bus->endWrite();
 }
 
-/**************************************************************************/
-/*!
-   @brief    Write a line.  Bresenham's algorithm - thx wikpedia
-    @param    x0  Start point x coordinate
-    @param    y0  Start point y coordinate
-    @param    x1  End point x coordinate
-    @param    y1  End point y coordinate
-    @param    color 16-bit 5-6-5 Color to draw with
-*/
-/**************************************************************************/
-void Arduino_TFT::writeSlashLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
-                                 uint16_t color)
-{
-  int16_t dx;
-  int16_t dy;
-  int16_t err;
-  int16_t xs;
-  int16_t step;
-  int16_t len;
-
-  bool steep = _diff(y1, y0) > _diff(x1, x0);
-  if (steep)
-  {
-    _swap_int16_t(x0, y0);
-    _swap_int16_t(x1, y1);
-  }
-
-  if (x0 > x1)
-  {
-    _swap_int16_t(x0, x1);
-    _swap_int16_t(y0, y1);
-  }
-
-  dx = x1 - x0;
-  dy = _diff(y1, y0);
-  err = dx >> 1;
-  xs = x0;
-  step = (y0 < y1) ? 1 : -1;
-  len = 0;
-
-  while (x0 <= x1)
-  {
-    x0++;
-    len++;
-    err -= dy;
-    if ((err < 0) || ((x0 > x1) && len))
-    {
-      if (steep)
-      {
-        writeFillRectPreclipped(y0, xs, 1, len, color);
-      }
-      else
-      {
-        writeFillRectPreclipped(xs, y0, len, 1, color);
-      }
-      err += dx;
-      y0 += step;
-      len = 0;
-      xs = x0;
-    }
-  }
-}
-
 // TFT tuned BITMAP / XBITMAP / GRAYSCALE / RGB BITMAP FUNCTIONS ---------------------
 
 /**************************************************************************/
@@ -6,7 +6,7 @@
 
 Arduino_Canvas::Arduino_Canvas(
     int16_t w, int16_t h, Arduino_G *output, int16_t output_x, int16_t output_y)
-    : Arduino_GFX(w, h), _output(output), _output_x(output_x), _output_y(output_y)
+    : Arduino_FramebufferGFX<Arduino_Canvas>(w, h), _output(output), _output_x(output_x), _output_y(output_y)
 {
 }
 
@@ -40,211 +40,125 @@ void Arduino_Canvas::begin(int32_t speed)
     {
         Serial.println(F("_framebuffer allocation failed."));
     }
-}
 
-void Arduino_Canvas::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
-{
-    _framebuffer[((int32_t)y * _width) + x] = color;
+    // Nothing on the output matches the canvas yet
+    _dirty_count = 0;
+    addDirty(0, 0, _max_x, _max_y);
 }
 
-void Arduino_Canvas::writeFastVLine(int16_t x, int16_t y,
-                                    int16_t h, uint16_t color)
+void Arduino_Canvas::markDirty(int16_t x, int16_t y, int16_t w, int16_t h)
 {
-    if (_ordered_in_range(x, 0, _max_x) && h)
-    { // X on screen, nonzero height
-        if (h < 0)
-        {               // If negative height...
-            y += h + 1; //   Move Y to top edge
-            h = -h;     //   Use positive height
-        }
-        if (y <= _max_y)
-        { // Not off bottom
-            int16_t y2 = y + h - 1;
-            if (y2 >= 0)
-            { // Not off top
-                // Line partly or fully overlaps screen
-                if (y < 0)
-                {
-                    y = 0;
-                    h = y2 + 1;
-                } // Clip top
-                if (y2 > _max_y)
-                {
-                    h = _max_y - y + 1;
-                } // Clip bottom
-
-                uint16_t *fb = _framebuffer + ((int32_t)y * _width) + x;
-                while (h--)
-                {
-                    *fb = color;
-                    fb += _width;
-                }
-            }
-        }
+    int16_t x2 = x + w - 1;
+    int16_t y2 = y + h - 1;
+    if ((w <= 0) || (h <= 0) || (x2 < 0) || (y2 < 0) || (x > _max_x) || (y > _max_y))
+    {
+        return;
     }
+    addDirty(max(x, (int16_t)0), max(y, (int16_t)0), min(x2, _max_x), min(y2, _max_y));
 }
 
-void Arduino_Canvas::writeFastHLine(int16_t x, int16_t y,
-                                    int16_t w, uint16_t color)
+void Arduino_Canvas::addDirty(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
 {
-    if (_ordered_in_range(y, 0, _max_y) && w)
-    { // Y on screen, nonzero width
-        if (w < 0)
-        {               // If negative width...
-            x += w + 1; //   Move X to left edge
-            w = -w;     //   Use positive width
+    // Hot path: pixels and lines landing in the area that just grew
+    if (_dirty_count)
+    {
+        const DirtyRect &last = _dirty[_dirty_last];
+        if ((x1 >= last.x1) && (x2 <= last.x2) && (y1 >= last.y1) && (y2 <= last.y2))
+        {
+            return;
         }
-        if (x <= _max_x)
-        { // Not off right
-            int16_t x2 = x + w - 1;
-            if (x2 >= 0)
-            { // Not off left
-                // Line partly or fully overlaps screen
-                if (x < 0)
-                {
-                    x = 0;
-                    w = x2 + 1;
-                } // Clip left
-                if (x2 > _max_x)
-                {
-                    w = _max_x - x + 1;
-                } // Clip right
+    }
 
-                uint16_t *fb = _framebuffer + ((int32_t)y * _width) + x;
-                while (w--)
-                {
-                    *(fb++) = color;
-                }
+    // Grow an area this one touches or nearly touches; if there is none
+    // and no room for another, the one whose bounding box grows least
+    uint8_t target = _dirty_count;
+    int32_t best_growth = INT32_MAX;
+    for (uint8_t i = 0; i < _dirty_count; i++)
+    {
+        const DirtyRect &r = _dirty[i];
+        if ((x1 <= r.x2 + DIRTY_MERGE_GAP) && (x2 >= r.x1 - DIRTY_MERGE_GAP) &&
+            (y1 <= r.y2 + DIRTY_MERGE_GAP) && (y2 >= r.y1 - DIRTY_MERGE_GAP))
+        {
+            target = i;
+            break;
+        }
+        if (_dirty_count == MAX_DIRTY_RECTS)
+        {
+            int32_t area = (int32_t)(r.x2 - r.x1 + 1) * (r.y2 - r.y1 + 1);
+            int32_t merged = (int32_t)(max(r.x2, x2) - min(r.x1, x1) + 1) *
+                             (max(r.y2, y2) - min(r.y1, y1) + 1);
+            if (merged - area < best_growth)
+            {
+                best_growth = merged - area;
+                target = i;
             }
         }
     }
-}
 
-void Arduino_Canvas::writeFillRectPreclipped(int16_t x, int16_t y,
-                                             int16_t w, int16_t h, uint16_t color)
-{
-    uint16_t *row = _framebuffer;
-    row += y * _width;
-    row += x;
-    for (int j = 0; j < h; j++)
+    DirtyRect &r = _dirty[target];
+    if (target == _dirty_count)
     {
-        for (int i = 0; i < w; i++)
-        {
-            row[i] = color;
-        }
-        row += _width;
+        r.x1 = x1;
+        r.y1 = y1;
+        r.x2 = x2;
+        r.y2 = y2;
+        _dirty_count++;
+    }
+    else
+    {
+        r.x1 = min(r.x1, x1);
+        r.y1 = min(r.y1, y1);
+        r.x2 = max(r.x2, x2);
+        r.y2 = max(r.y2, y2);
     }
+    _dirty_last = target;
 }
 
-void Arduino_Canvas::draw16bitRGBBitmap(int16_t x, int16_t y,
-                                        uint16_t *bitmap, int16_t w, int16_t h)
+void Arduino_Canvas::flushRect(const DirtyRect &r)
 {
-    if (
-        ((x + w - 1) < 0) || // Outside left
-        ((y + h - 1) < 0) || // Outside top
-        (x > _max_x) ||      // Outside right
-        (y > _max_y)         // Outside bottom
-    )
+    int16_t w = r.x2 - r.x1 + 1;
+    int16_t h = r.y2 - r.y1 + 1;
+    uint16_t *src = _framebuffer + ((int32_t)r.y1 * _width) + r.x1;
+
+    if (w == _width)
     {
+        // Whole rows are contiguous in the framebuffer
+        _output->draw16bitRGBBitmap(_output_x, _output_y + r.y1, src, w, h);
         return;
     }
-    else
+    for (int16_t j = 0; j < h; j++)
     {
-        int16_t xskip = 0;
-        if ((y + h - 1) > _max_y)
-        {
-            h -= (y + h - 1) - _max_y;
-        }
-        if (y < 0)
-        {
-            bitmap -= y * w;
-            h += y;
-            y = 0;
-        }
-        if ((x + w - 1) > _max_x)
-        {
-            xskip = (x + w - 1) - _max_x;
-            w -= xskip;
-        }
-        if (x < 0)
-        {
-            bitmap -= x;
-            xskip -= x;
-            w += x;
-            x = 0;
-        }
-        uint16_t *row = _framebuffer;
-        row += y * _width;
-        row += x;
-        for (int j = 0; j < h; j++)
-        {
-            for (int i = 0; i < w; i++)
-            {
-                row[i] = *bitmap++;
-            }
-            bitmap += xskip;
-            row += _width;
-        }
+        _output->draw16bitRGBBitmap(_output_x + r.x1, _output_y + r.y1 + j, src, w, 1);
+        src += _width;
     }
 }
 
-void Arduino_Canvas::draw16bitBeRGBBitmap(int16_t x, int16_t y,
-                                          uint16_t *bitmap, int16_t w, int16_t h)
+void Arduino_Canvas::flush()
 {
-    if (
-        ((x + w - 1) < 0) || // Outside left
-        ((y + h - 1) < 0) || // Outside top
-        (x > _max_x) ||      // Outside right
-        (y > _max_y)         // Outside bottom
-    )
+    if (!_dirty_count)
     {
         return;
     }
+
+    // Past half the canvas, one transfer of everything beats a window per row
+    int32_t total = 0;
+    for (uint8_t i = 0; i < _dirty_count; i++)
+    {
+        const DirtyRect &r = _dirty[i];
+        total += (int32_t)(r.x2 - r.x1 + 1) * (r.y2 - r.y1 + 1);
+    }
+    if (total * 2 > (int32_t)_width * _height)
+    {
+        _output->draw16bitRGBBitmap(_output_x, _output_y, _framebuffer, _width, _height);
+    }
     else
     {
-        int16_t xskip = 0;
-        if ((y + h - 1) > _max_y)
+        for (uint8_t i = 0; i < _dirty_count; i++)
         {
-            h -= (y + h - 1) - _max_y;
-        }
-        if (y < 0)
-        {
-            bitmap -= y * w;
-            h += y;
-            y = 0;
-        }
-        if ((x + w - 1) > _max_x)
-        {
-            xskip = (x + w - 1) - _max_x;
-            w -= xskip;
-        }
-        if (x < 0)
-        {
-            bitmap -= x;
-            xskip -= x;
-            w += x;
-            x = 0;
-        }
-        uint16_t *row = _framebuffer;
-        row += y * _width;
-        row += x;
-        uint16_t color;
-        for (int j = 0; j < h; j++)
-        {
-            for (int i = 0; i < w; i++)
-            {
-                color = *bitmap++;
-                MSB_16_SET(row[i], color);
-            }
-            bitmap += xskip;
-            row += _width;
+            flushRect(_dirty[i]);
         }
     }
-}
-
-void Arduino_Canvas::flush()
-{
-    _output->draw16bitRGBBitmap(_output_x, _output_y, _framebuffer, _width, _height);
+    _dirty_count = 0;
 }
 
 #endif // !defined(LITTLE_FOOT_PRINT)
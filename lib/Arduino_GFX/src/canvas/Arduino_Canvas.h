@@ -5,27 +5,44 @@
 #define _ARDUINO_CANVAS_H_
 
 #include "../Arduino_GFX.h"
+#include "../Arduino_FramebufferGFX.h"
 
-class Arduino_Canvas : public Arduino_GFX
+class Arduino_Canvas : public Arduino_FramebufferGFX<Arduino_Canvas>
 {
 public:
   Arduino_Canvas(int16_t w, int16_t h, Arduino_G *output, int16_t output_x = 0, int16_t output_y = 0);
 
   void begin(int32_t speed = GFX_NOT_DEFINED) override;
-  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
-  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
-  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
-  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
-  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
-  void draw16bitBeRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
   void flush(void) override;
 
+  // Mark an area as changed, for code that writes the framebuffer directly;
+  // flush() only pushes what has been marked since the last flush
+  void markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+
 protected:
-  uint16_t *_framebuffer;
   Arduino_G *_output;
   int16_t _output_x, _output_y;
 
 private:
+  friend class Arduino_FramebufferGFX<Arduino_Canvas>;
+
+  // Inclusive corners, already clipped to the canvas
+  struct DirtyRect
+  {
+    int16_t x1, y1, x2, y2;
+  };
+
+  // Separate areas are kept apart up to this many, then merged
+  static const uint8_t MAX_DIRTY_RECTS = 4;
+  // Areas closer than this are merged rather than pushed separately
+  static const int16_t DIRTY_MERGE_GAP = 8;
+
+  void addDirty(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+  void flushRect(const DirtyRect &r);
+
+  DirtyRect _dirty[MAX_DIRTY_RECTS];
+  uint8_t _dirty_count = 0;
+  uint8_t _dirty_last = 0; // Most recently grown, checked first
 };
 
 #endif // _ARDUINO_CANVAS_H_
@@ -127,26 +127,56 @@ void Arduino_Canvas_Indexed::flush()
 
 uint8_t Arduino_Canvas_Indexed::get_color_index(uint16_t color)
 {
+    if (_last_valid && (color == _last_color))
+    {
+        return _last_index;
+    }
+    uint16_t raw = color;
     color &= _color_mask;
-    for (uint8_t i = 0; i < _indexed_size; i++)
+
+    // Fibonacci hash, linear probing; the table is never more than half full
+    uint16_t slot = (uint16_t)(color * 40503u) >> (16 - COLOR_HASH_BITS);
+    while (_color_hash[slot])
     {
+        uint8_t i = _color_hash[slot] - 1;
         if (_color_index[i] == color)
         {
+            _last_color = raw;
+            _last_index = i;
+            _last_valid = true;
             return i;
         }
+        slot = (slot + 1) & (COLOR_HASH_SIZE - 1);
     }
+
     if (_indexed_size == (COLOR_IDX_SIZE - 1)) // overflowed
     {
+        uint8_t level = _current_mask_level;
         raise_mask_level();
+        if (_current_mask_level != level)
+        {
+            // Palette and table were rebuilt under the coarser mask
+            return get_color_index(raw);
+        }
     }
     _color_index[_indexed_size] = color;
+    _color_hash[slot] = _indexed_size + 1;
     // Serial.print("color_index[");
     // Serial.print(_indexed_size);
     // Serial.print("] = ");
     // Serial.println(color);
+    _last_color = raw;
+    _last_index = _indexed_size;
+    _last_valid = true;
     return _indexed_size++;
 }
 
+void Arduino_Canvas_Indexed::clear_color_hash()
+{
+    memset(_color_hash, 0, sizeof(_color_hash));
+    _last_valid = false;
+}
+
 uint16_t Arduino_Canvas_Indexed::get_index_color(uint8_t idx)
 {
     return _color_index[idx];
@@ -158,22 +188,30 @@ void Arduino_Canvas_Indexed::raise_mask_level()
     {
         int32_t buffer_size = _width * _height;
         uint8_t old_indexed_size = _indexed_size;
-        uint8_t new_color;
+        uint8_t remap[COLOR_IDX_SIZE];
+        for (uint16_t i = 0; i < COLOR_IDX_SIZE; i++)
+        {
+            remap[i] = i;
+        }
         _indexed_size = 0;
         _color_mask = mask_level_list[++_current_mask_level];
+        clear_color_hash();
         Serial.print("Raised mask level: ");
         Serial.println(_current_mask_level);
 
-        // update _framebuffer color index, it is a time consuming job
-        for (uint8_t old_color = 0; old_color < old_indexed_size; old_color++)
+        // Coarser colors merge, so new indices never exceed old ones and the
+        // entries still to be read aren't overwritten
+        for (uint16_t old_color = 0; old_color < old_indexed_size; old_color++)
+        {
+            remap[old_color] = get_color_index(_color_index[old_color]);
+        }
+
+        // update _framebuffer color index in one pass
+        if (_framebuffer)
         {
-            new_color = get_color_index(_color_index[old_color]);
             for (int32_t i = 0; i < buffer_size; i++)
             {
-                if (_framebuffer[i] == old_color)
-                {
-                    _framebuffer[i] = new_color;
-                }
+                _framebuffer[i] = remap[_framebuffer[i]];
             }
         }
     }
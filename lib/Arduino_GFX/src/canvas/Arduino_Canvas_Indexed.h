@@ -7,6 +7,10 @@
 #include "../Arduino_GFX.h"
 
 #define COLOR_IDX_SIZE 256
+// Open-addressing table from masked color to palette index, twice the
+// palette size so probes stay short; must be a power of two
+#define COLOR_HASH_BITS 9
+#define COLOR_HASH_SIZE (1 << COLOR_HASH_BITS)
 
 class Arduino_Canvas_Indexed : public Arduino_GFX
 {
@@ -31,6 +35,12 @@ protected:
   uint8_t _indexed_size = 0;
   uint8_t _current_mask_level;
   uint16_t _color_mask;
+  // Palette index + 1 per hash slot, 0 for empty
+  uint16_t _color_hash[COLOR_HASH_SIZE] = {0};
+  // Last color looked up: runs of the same color skip the table
+  uint16_t _last_color;
+  uint8_t _last_index;
+  bool _last_valid = false;
 #define MAXMASKLEVEL 3
   uint16_t mask_level_list[MAXMASKLEVEL] = {
       0b1111111111111111, // 16-bit, 65536 colors
@@ -39,6 +49,7 @@ protected:
   };
 
 private:
+  void clear_color_hash();
 };
 
 #endif // _ARDUINO_CANVAS_INDEXED_H_
@@ -46,9 +46,15 @@ void Arduino_Canvas_Mono::writePixelPreclipped(int16_t x, int16_t y, uint16_t co
     }
 }
 
+void Arduino_Canvas_Mono::setOutputColors(uint16_t color, uint16_t bg)
+{
+    _output_color = color;
+    _output_bg = bg;
+}
+
 void Arduino_Canvas_Mono::flush()
 {
-    _output->drawBitmap(_output_x, _output_y, _framebuffer, _width, _height, WHITE, BLACK);
+    _output->drawBitmap(_output_x, _output_y, _framebuffer, _width, _height, _output_color, _output_bg);
 }
 
 #endif // !defined(LITTLE_FOOT_PRINT)
@@ -15,10 +15,16 @@ public:
   void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
   void flush(void) override;
 
+  // Colors set and clear bits become on the output (white on black by
+  // default); framebuffer outputs expand them a byte at a time
+  void setOutputColors(uint16_t color, uint16_t bg);
+
 protected:
   uint8_t *_framebuffer;
   Arduino_G *_output;
   int16_t _output_x, _output_y;
+  uint16_t _output_color = WHITE;
+  uint16_t _output_bg = BLACK;
 
 private:
 };
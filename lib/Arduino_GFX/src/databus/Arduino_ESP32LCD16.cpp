@@ -148,32 +148,38 @@ void Arduino_ESP32LCD16::beginWrite()
 void Arduino_ESP32LCD16::endWrite()
 {
   WAIT_LCD_NOT_BUSY;
+  _async_busy = false;
 
   CS_HIGH();
 }
 
 void Arduino_ESP32LCD16::writeCommand(uint8_t c)
 {
+  WAIT_ASYNC();
   WRITECOMMAND16(c);
 }
 
 void Arduino_ESP32LCD16::writeCommand16(uint16_t c)
 {
+  WAIT_ASYNC();
   WRITECOMMAND16(c);
 }
 
 void Arduino_ESP32LCD16::write(uint8_t d)
 {
+  WAIT_ASYNC();
   WRITE16(d);
 }
 
 void Arduino_ESP32LCD16::write16(uint16_t d)
 {
+  WAIT_ASYNC();
   WRITE16(d);
 }
 
 void Arduino_ESP32LCD16::writeRepeat(uint16_t p, uint32_t len)
 {
+  WAIT_ASYNC();
   if (len < USE_DMA_THRESHOLD)
   {
     while (len--)
@@ -225,6 +231,7 @@ void Arduino_ESP32LCD16::writeRepeat(uint16_t p, uint32_t len)
 
 void Arduino_ESP32LCD16::writePixels(uint16_t *data, uint32_t len)
 {
+  WAIT_ASYNC();
   uint32_t xferLen, l;
 
   while (len > USE_DMA_THRESHOLD) // While pixels remain
@@ -262,20 +269,119 @@ void Arduino_ESP32LCD16::writePixels(uint16_t *data, uint32_t len)
   }
 }
 
+bool Arduino_ESP32LCD16::allocAsyncBuffers()
+{
+  if (_async_buf[1])
+  {
+    return true;
+  }
+  if (_async_failed)
+  {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    _async_buf[i] = (uint16_t *)heap_caps_malloc(LCD_MAX_PIXELS_AT_ONCE * 2, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    _async_desc[i] = (dma_descriptor_t *)heap_caps_malloc(sizeof(dma_descriptor_t), MALLOC_CAP_DMA);
+    if ((!_async_buf[i]) || (!_async_desc[i]))
+    {
+      // no internal DMA memory to spare: stay synchronous
+      for (uint8_t j = 0; j <= i; j++)
+      {
+        heap_caps_free(_async_buf[j]);
+        heap_caps_free(_async_desc[j]);
+        _async_buf[j] = nullptr;
+        _async_desc[j] = nullptr;
+      }
+      _async_failed = true;
+      return false;
+    }
+  }
+  return true;
+}
+
+void Arduino_ESP32LCD16::writePixelsAsync(uint16_t *data, uint32_t len)
+{
+  if (!allocAsyncBuffers())
+  {
+    writePixels(data, len);
+    return;
+  }
+
+  uint32_t xferLen, l, head;
+
+  while (len > USE_DMA_THRESHOLD) // While pixels remain
+  {
+    xferLen = (len < LCD_MAX_PIXELS_AT_ONCE) ? len : LCD_MAX_PIXELS_AT_ONCE; // How many this pass?
+    head = data[0] | ((uint32_t)data[1] << 16);
+
+    // fill the idle buffer while the previous pass is still on the bus
+    l = xferLen - 2;
+    memcpy(_async_buf[_async_idx], data + 2, l * 2);
+
+    l <<= 1;
+    dma_descriptor_t *desc = _async_desc[_async_idx];
+    *(uint32_t *)desc = ((l + 3) & (~3)) | l << 12 | 0xC0000000;
+    desc->buffer = _async_buf[_async_idx];
+    desc->next = nullptr;
+
+    WAIT_LCD_NOT_BUSY;
+    gdma_start(_dma_chan, (intptr_t)(desc));
+    LCD_CAM.lcd_misc.val = LCD_CAM_LCD_CD_IDLE_EDGE;
+    LCD_CAM.lcd_cmd_val.val = head;
+
+    uint32_t wait = _fast_wait;
+    while (wait--)
+    {
+      __asm__ __volatile__("nop");
+    }
+
+    LCD_CAM.lcd_user.val = LCD_CAM_LCD_ALWAYS_OUT_EN | LCD_CAM_LCD_2BYTE_EN | LCD_CAM_LCD_CMD_2_CYCLE_EN | LCD_CAM_LCD_DOUT | LCD_CAM_LCD_CMD | LCD_CAM_LCD_UPDATE_REG | LCD_CAM_LCD_START;
+    _async_busy = true;
+    _async_idx ^= 1;
+
+    data += xferLen;
+    len -= xferLen;
+  }
+
+  while (len--)
+  {
+    WRITE16(*data++);
+  }
+}
+
+bool Arduino_ESP32LCD16::isAsyncBusy()
+{
+  if (_async_busy && !(LCD_CAM.lcd_user.val & LCD_CAM_LCD_START))
+  {
+    _async_busy = false;
+  }
+  return _async_busy;
+}
+
+void Arduino_ESP32LCD16::waitAsync()
+{
+  WAIT_ASYNC();
+}
+
 void Arduino_ESP32LCD16::writeC8D8(uint8_t c, uint8_t d)
 {
+  WAIT_ASYNC();
   WRITECOMMAND16(c);
   WRITE16(d);
 }
 
 void Arduino_ESP32LCD16::writeC8D16(uint8_t c, uint16_t d)
 {
+  WAIT_ASYNC();
   WRITECOMMAND16(c);
   WRITE16(d);
 }
 
 void Arduino_ESP32LCD16::writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2)
 {
+  WAIT_ASYNC();
   WRITECOMMAND16(c);
   WRITE16(d1);
   WRITE16(d2);
@@ -283,6 +389,7 @@ void Arduino_ESP32LCD16::writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2)
 
 void Arduino_ESP32LCD16::writeC8D16D16Split(uint8_t c, uint16_t d1, uint16_t d2)
 {
+  WAIT_ASYNC();
   WRITECOMMAND16(c);
 
   _data16.value = d1;
@@ -296,6 +403,7 @@ void Arduino_ESP32LCD16::writeC8D16D16Split(uint8_t c, uint16_t d1, uint16_t d2)
 
 void Arduino_ESP32LCD16::writeBytes(uint8_t *data, uint32_t len)
 {
+  WAIT_ASYNC();
   uint32_t xferLen, l;
 
   while (len > (USE_DMA_THRESHOLD * 2)) // While pixels remain
@@ -353,6 +461,7 @@ void Arduino_ESP32LCD16::writeBytes(uint8_t *data, uint32_t len)
 
 void Arduino_ESP32LCD16::writePattern(uint8_t *data, uint8_t len, uint32_t repeat)
 {
+  WAIT_ASYNC();
   while (repeat--)
   {
     writeBytes(data, len);
@@ -361,6 +470,7 @@ void Arduino_ESP32LCD16::writePattern(uint8_t *data, uint8_t len, uint32_t repea
 
 void Arduino_ESP32LCD16::writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_t len)
 {
+  WAIT_ASYNC();
   uint32_t xferLen, l;
   uint32_t p;
 
@@ -405,6 +515,7 @@ void Arduino_ESP32LCD16::writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32
 
 void Arduino_ESP32LCD16::writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, uint32_t len)
 {
+  WAIT_ASYNC();
   len <<= 1; // double length
   uint32_t xferLen, l;
   uint32_t p;
@@ -448,6 +559,15 @@ void Arduino_ESP32LCD16::writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx,
   }
 }
 
+INLINE void Arduino_ESP32LCD16::WAIT_ASYNC(void)
+{
+  if (_async_busy)
+  {
+    WAIT_LCD_NOT_BUSY;
+    _async_busy = false;
+  }
+}
+
 INLINE void Arduino_ESP32LCD16::WRITECOMMAND16(uint16_t c)
 {
   LCD_CAM.lcd_misc.val = LCD_CAM_LCD_CD_IDLE_EDGE | LCD_CAM_LCD_CD_CMD_SET;
@@ -29,6 +29,9 @@ public:
   void write16(uint16_t) override;
   void writeRepeat(uint16_t p, uint32_t len) override;
   void writePixels(uint16_t *data, uint32_t len) override;
+  void writePixelsAsync(uint16_t *data, uint32_t len) override;
+  bool isAsyncBusy() override;
+  void waitAsync() override;
 
   void writeC8D8(uint8_t c, uint8_t d) override;
   void writeC8D16(uint8_t c, uint16_t d) override;
@@ -42,6 +45,8 @@ public:
 
 protected:
 private:
+  bool allocAsyncBuffers();
+  INLINE void WAIT_ASYNC(void);
   INLINE void WRITECOMMAND16(uint16_t c);
   INLINE void WRITE16(uint16_t d);
   INLINE void WRITE32(uint32_t d);
@@ -61,6 +66,14 @@ private:
   dma_descriptor_t *_dmadesc = nullptr;
   gdma_channel_handle_t _dma_chan;
 
+  // writePixelsAsync() ping-pong buffers in internal RAM: one is filled while
+  // the other goes out
+  uint16_t *_async_buf[2] = {nullptr, nullptr};
+  dma_descriptor_t *_async_desc[2] = {nullptr, nullptr};
+  uint8_t _async_idx = 0;
+  bool _async_busy = false;
+  bool _async_failed = false;
+
   union
   {
     uint32_t value;
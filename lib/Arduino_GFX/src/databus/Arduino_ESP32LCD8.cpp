@@ -112,6 +112,8 @@ void Arduino_ESP32LCD8::begin(int32_t speed, int8_t dataMode)
     div_b = 0;
     div_n += 1;
   }
+  int wait = 24 - (div_n * clkcnt);
+  _fast_wait = (wait < 0) ? 0 : wait;
 
   lcd_cam_lcd_clock_reg_t lcd_clock;
   lcd_clock.lcd_clkcnt_n = std::max(1u, clkcnt - 1);
@@ -125,6 +127,8 @@ void Arduino_ESP32LCD8::begin(int32_t speed, int8_t dataMode)
   lcd_clock.clk_en = true;
 
   LCD_CAM.lcd_clock.val = lcd_clock.val;
+
+  _dma_chan = _i80_bus->dma_chan;
 }
 
 void Arduino_ESP32LCD8::beginWrite()
@@ -139,32 +143,38 @@ void Arduino_ESP32LCD8::beginWrite()
 void Arduino_ESP32LCD8::endWrite()
 {
   WAIT_LCD_NOT_BUSY;
+  _async_busy = false;
 
   CS_HIGH();
 }
 
 void Arduino_ESP32LCD8::writeCommand(uint8_t c)
 {
+  WAIT_ASYNC();
   WRITECOMMAND(c);
 }
 
 void Arduino_ESP32LCD8::writeCommand16(uint16_t c)
 {
+  WAIT_ASYNC();
   WRITECOMMAND16(c);
 }
 
 void Arduino_ESP32LCD8::write(uint8_t d)
 {
+  WAIT_ASYNC();
   WRITE(d);
 }
 
 void Arduino_ESP32LCD8::write16(uint16_t d)
 {
+  WAIT_ASYNC();
   WRITE16(d);
 }
 
 void Arduino_ESP32LCD8::writeRepeat(uint16_t p, uint32_t len)
 {
+  WAIT_ASYNC();
   while (len--)
   {
     WRITE16(p);
@@ -173,6 +183,7 @@ void Arduino_ESP32LCD8::writeRepeat(uint16_t p, uint32_t len)
 
 void Arduino_ESP32LCD8::writePixels(uint16_t *data, uint32_t len)
 {
+  WAIT_ASYNC();
   LCD_CAM.lcd_misc.val = LCD_CAM_LCD_CD_IDLE_EDGE;
   while (len--)
   {
@@ -186,8 +197,108 @@ void Arduino_ESP32LCD8::writePixels(uint16_t *data, uint32_t len)
   }
 }
 
+bool Arduino_ESP32LCD8::allocAsyncBuffers()
+{
+  if (_async_buf[1])
+  {
+    return true;
+  }
+  if (_async_failed)
+  {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    _async_buf[i] = (uint16_t *)heap_caps_malloc(LCD8_MAX_PIXELS_AT_ONCE * 2, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    _async_desc[i] = (dma_descriptor_t *)heap_caps_malloc(sizeof(dma_descriptor_t), MALLOC_CAP_DMA);
+    if ((!_async_buf[i]) || (!_async_desc[i]))
+    {
+      // no internal DMA memory to spare: stay synchronous
+      for (uint8_t j = 0; j <= i; j++)
+      {
+        heap_caps_free(_async_buf[j]);
+        heap_caps_free(_async_desc[j]);
+        _async_buf[j] = nullptr;
+        _async_desc[j] = nullptr;
+      }
+      _async_failed = true;
+      return false;
+    }
+  }
+  return true;
+}
+
+void Arduino_ESP32LCD8::writePixelsAsync(uint16_t *data, uint32_t len)
+{
+  if (!allocAsyncBuffers())
+  {
+    writePixels(data, len);
+    return;
+  }
+
+  uint32_t xferLen, l;
+
+  while (len >= LCD8_ASYNC_THRESHOLD) // While pixels remain
+  {
+    xferLen = (len < LCD8_MAX_PIXELS_AT_ONCE) ? len : LCD8_MAX_PIXELS_AT_ONCE; // How many this pass?
+
+    // fill the idle buffer, high byte first, while the previous pass is
+    // still on the bus
+    uint16_t *buf = _async_buf[_async_idx];
+    for (uint32_t i = 0; i < xferLen; ++i)
+    {
+      MSB_16_SET(buf[i], data[i]);
+    }
+
+    l = xferLen << 1;
+    dma_descriptor_t *desc = _async_desc[_async_idx];
+    *(uint32_t *)desc = ((l + 3) & (~3)) | l << 12 | 0xC0000000;
+    desc->buffer = buf;
+    desc->next = nullptr;
+
+    // data phase only: the whole pass comes from DMA
+    WAIT_LCD_NOT_BUSY;
+    gdma_start(_dma_chan, (intptr_t)(desc));
+    LCD_CAM.lcd_misc.val = LCD_CAM_LCD_CD_IDLE_EDGE;
+
+    uint32_t wait = _fast_wait;
+    while (wait--)
+    {
+      __asm__ __volatile__("nop");
+    }
+
+    LCD_CAM.lcd_user.val = LCD_CAM_LCD_ALWAYS_OUT_EN | LCD_CAM_LCD_DOUT | LCD_CAM_LCD_UPDATE_REG | LCD_CAM_LCD_START;
+    _async_busy = true;
+    _async_idx ^= 1;
+
+    data += xferLen;
+    len -= xferLen;
+  }
+
+  if (len)
+  {
+    writePixels(data, len);
+  }
+}
+
+bool Arduino_ESP32LCD8::isAsyncBusy()
+{
+  if (_async_busy && !(LCD_CAM.lcd_user.val & LCD_CAM_LCD_START))
+  {
+    _async_busy = false;
+  }
+  return _async_busy;
+}
+
+void Arduino_ESP32LCD8::waitAsync()
+{
+  WAIT_ASYNC();
+}
+
 void Arduino_ESP32LCD8::writeBytes(uint8_t *data, uint32_t len)
 {
+  WAIT_ASYNC();
   LCD_CAM.lcd_misc.val = LCD_CAM_LCD_CD_IDLE_EDGE;
   while (len--)
   {
@@ -199,6 +310,7 @@ void Arduino_ESP32LCD8::writeBytes(uint8_t *data, uint32_t len)
 
 void Arduino_ESP32LCD8::writePattern(uint8_t *data, uint8_t len, uint32_t repeat)
 {
+  WAIT_ASYNC();
   while (repeat--)
   {
     writeBytes(data, len);
@@ -207,6 +319,7 @@ void Arduino_ESP32LCD8::writePattern(uint8_t *data, uint8_t len, uint32_t repeat
 
 void Arduino_ESP32LCD8::writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_t len)
 {
+  WAIT_ASYNC();
   while (len--)
   {
     WRITE16(idx[*data++]);
@@ -215,6 +328,7 @@ void Arduino_ESP32LCD8::writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_
 
 void Arduino_ESP32LCD8::writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, uint32_t len)
 {
+  WAIT_ASYNC();
   while (len--)
   {
     WRITE16(idx[*data]);
@@ -222,6 +336,15 @@ void Arduino_ESP32LCD8::writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, u
   }
 }
 
+INLINE void Arduino_ESP32LCD8::WAIT_ASYNC(void)
+{
+  if (_async_busy)
+  {
+    WAIT_LCD_NOT_BUSY;
+    _async_busy = false;
+  }
+}
+
 INLINE void Arduino_ESP32LCD8::WRITECOMMAND(uint8_t c)
 {
   LCD_CAM.lcd_misc.val = LCD_CAM_LCD_CD_IDLE_EDGE | LCD_CAM_LCD_CD_CMD_SET;
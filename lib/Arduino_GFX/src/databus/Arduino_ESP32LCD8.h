@@ -9,6 +9,9 @@
 #ifndef _ARDUINO_ESP32LCD8_H_
 #define _ARDUINO_ESP32LCD8_H_
 
+#define LCD8_MAX_PIXELS_AT_ONCE 2046
+#define LCD8_ASYNC_THRESHOLD 16
+
 class Arduino_ESP32LCD8 : public Arduino_DataBus
 {
 public:
@@ -25,6 +28,9 @@ public:
   void write16(uint16_t) override;
   void writeRepeat(uint16_t p, uint32_t len) override;
   void writePixels(uint16_t *data, uint32_t len) override;
+  void writePixelsAsync(uint16_t *data, uint32_t len) override;
+  bool isAsyncBusy() override;
+  void waitAsync() override;
 
   void writeBytes(uint8_t *data, uint32_t len) override;
   void writePattern(uint8_t *data, uint8_t len, uint32_t repeat) override;
@@ -33,6 +39,8 @@ public:
   void writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, uint32_t len) override;
 
 protected:
+  bool allocAsyncBuffers();
+  INLINE void WAIT_ASYNC(void);
   INLINE void WRITECOMMAND(uint8_t c);
   INLINE void WRITECOMMAND16(uint16_t c);
   INLINE void WRITE(uint8_t d);
@@ -48,7 +56,17 @@ private:
   PORTreg_t _csPortClr; ///< PORT register CLEAR
   uint32_t _csPinMask;  ///< Bitmask
 
+  uint32_t _fast_wait;
   esp_lcd_i80_bus_handle_t _i80_bus = nullptr;
+  gdma_channel_handle_t _dma_chan;
+
+  // writePixelsAsync() ping-pong buffers in internal RAM: one is filled while
+  // the other goes out
+  uint16_t *_async_buf[2] = {nullptr, nullptr};
+  dma_descriptor_t *_async_desc[2] = {nullptr, nullptr};
+  uint8_t _async_idx = 0;
+  bool _async_busy = false;
+  bool _async_failed = false;
 };
 
 #endif // _ARDUINO_ESP32LCD8_H_
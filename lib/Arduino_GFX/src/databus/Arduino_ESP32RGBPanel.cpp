@@ -8,13 +8,13 @@ Arduino_ESP32RGBPanel::Arduino_ESP32RGBPanel(
     int8_t r0, int8_t r1, int8_t r2, int8_t r3, int8_t r4,
     int8_t g0, int8_t g1, int8_t g2, int8_t g3, int8_t g4, int8_t g5,
     int8_t b0, int8_t b1, int8_t b2, int8_t b3, int8_t b4,
-    bool useBigEndian)
+    bool useBigEndian, size_t bounce_buffer_size_px)
     : _cs(cs), _sck(sck), _sda(sda),
       _de(de), _vsync(vsync), _hsync(hsync), _pclk(pclk),
       _r0(r0), _r1(r1), _r2(r2), _r3(r3), _r4(r4),
       _g0(g0), _g1(g1), _g2(g2), _g3(g3), _g4(g4), _g5(g5),
       _b0(b0), _b1(b1), _b2(b2), _b3(b3), _b4(b4),
-      _useBigEndian(useBigEndian)
+      _useBigEndian(useBigEndian), _bounce_buffer_size_px(bounce_buffer_size_px)
 {
 }
 
@@ -34,6 +34,12 @@ void Arduino_ESP32RGBPanel::begin(int32_t speed, int8_t dataMode)
   }
   UNUSED(dataMode);
 
+  // Started once; a second begin() (panel reinit) keeps the device
+  if ((_spiDev == NULL) && (_spiHost != GFX_NOT_DEFINED))
+  {
+    beginCommandSPI();
+  }
+
   if (_cs != GFX_NOT_DEFINED)
   {
     pinMode(_cs, OUTPUT);
@@ -51,39 +57,109 @@ void Arduino_ESP32RGBPanel::begin(int32_t speed, int8_t dataMode)
     _csPortSet = (PORTreg_t)&GPIO.out_w1ts;
     _csPortClr = (PORTreg_t)&GPIO.out_w1tc;
   }
-  if (_sck != GFX_NOT_DEFINED)
+  // With the hardware bus SPI owns SCK and SDA; only CS stays a GPIO
+  if (_spiDev == NULL)
   {
-    pinMode(_sck, OUTPUT);
-    digitalWrite(_sck, LOW);
+    if (_sck != GFX_NOT_DEFINED)
+    {
+      pinMode(_sck, OUTPUT);
+      digitalWrite(_sck, LOW);
+    }
+    if (_sck >= 32)
+    {
+      _sckPinMask = digitalPinToBitMask(_sck);
+      _sckPortSet = (PORTreg_t)&GPIO.out1_w1ts.val;
+      _sckPortClr = (PORTreg_t)&GPIO.out1_w1tc.val;
+    }
+    else
+    {
+      _sckPinMask = digitalPinToBitMask(_sck);
+      _sckPortSet = (PORTreg_t)&GPIO.out_w1ts;
+      _sckPortClr = (PORTreg_t)&GPIO.out_w1tc;
+    }
+    if (_sda != GFX_NOT_DEFINED)
+    {
+      pinMode(_sda, OUTPUT);
+      digitalWrite(_sda, LOW);
+    }
+    if (_sda >= 32)
+    {
+      _sdaPinMask = digitalPinToBitMask(_sda);
+      _sdaPortSet = (PORTreg_t)&GPIO.out1_w1ts.val;
+      _sdaPortClr = (PORTreg_t)&GPIO.out1_w1tc.val;
+    }
+    else
+    {
+      _sdaPinMask = digitalPinToBitMask(_sda);
+      _sdaPortSet = (PORTreg_t)&GPIO.out_w1ts;
+      _sdaPortClr = (PORTreg_t)&GPIO.out_w1tc;
+    }
   }
-  if (_sck >= 32)
+}
+
+bool Arduino_ESP32RGBPanel::beginCommandSPI()
+{
+  spi_bus_config_t buscfg = {};
+  buscfg.mosi_io_num = _sda;
+  buscfg.miso_io_num = -1;
+  buscfg.sclk_io_num = _sck;
+  buscfg.quadwp_io_num = -1;
+  buscfg.quadhd_io_num = -1;
+  buscfg.max_transfer_sz = sizeof(_spiBuf);
+  if (spi_bus_initialize((spi_host_device_t)_spiHost, &buscfg, SPI_DMA_DISABLED) != ESP_OK)
   {
-    _sckPinMask = digitalPinToBitMask(_sck);
-    _sckPortSet = (PORTreg_t)&GPIO.out1_w1ts.val;
-    _sckPortClr = (PORTreg_t)&GPIO.out1_w1tc.val;
+    return false;
   }
-  else
+
+  spi_device_interface_config_t devcfg = {};
+  devcfg.mode = 0;                    // Sampled on the rising edge, like the bit-bang path
+  devcfg.clock_speed_hz = 10000000;   // ST7701 write cycle is 66 ns minimum
+  devcfg.spics_io_num = -1;
+  devcfg.queue_size = 1;
+  if (spi_bus_add_device((spi_host_device_t)_spiHost, &devcfg, &_spiDev) != ESP_OK)
   {
-    _sckPinMask = digitalPinToBitMask(_sck);
-    _sckPortSet = (PORTreg_t)&GPIO.out_w1ts;
-    _sckPortClr = (PORTreg_t)&GPIO.out_w1tc;
+    spi_bus_free((spi_host_device_t)_spiHost);
+    _spiDev = NULL;
+    return false;
   }
-  if (_sda != GFX_NOT_DEFINED)
+  _spiBits = 0;
+  _spiBuf[0] = 0;
+  return true;
+}
+
+void Arduino_ESP32RGBPanel::write9(uint16_t word)
+{
+  if (_spiBits + 9 > sizeof(_spiBuf) * 8)
   {
-    pinMode(_sda, OUTPUT);
-    digitalWrite(_sda, LOW);
+    flushCommandSPI();
   }
-  if (_sda >= 32)
+  // 9 bits at any bit offset span two bytes; the second is always fresh
+  uint16_t idx = _spiBits >> 3;
+  uint16_t w = word << (7 - (_spiBits & 7));
+  _spiBuf[idx] |= w >> 8;
+  _spiBuf[idx + 1] = w & 0xFF;
+  _spiBits += 9;
+}
+
+void Arduino_ESP32RGBPanel::flushCommandSPI()
+{
+  if (_spiBits == 0)
   {
-    _sdaPinMask = digitalPinToBitMask(_sda);
-    _sdaPortSet = (PORTreg_t)&GPIO.out1_w1ts.val;
-    _sdaPortClr = (PORTreg_t)&GPIO.out1_w1tc.val;
+    return;
   }
-  else
+  spi_transaction_t t = {};
+  t.length = _spiBits;
+  t.tx_buffer = _spiBuf;
+  spi_device_polling_transmit(_spiDev, &t);
+  _spiBits = 0;
+  _spiBuf[0] = 0;
+}
+
+void Arduino_ESP32RGBPanel::flushWrites()
+{
+  if (_spiDev)
   {
-    _sdaPinMask = digitalPinToBitMask(_sda);
-    _sdaPortSet = (PORTreg_t)&GPIO.out_w1ts;
-    _sdaPortClr = (PORTreg_t)&GPIO.out_w1tc;
+    flushCommandSPI();
   }
 }
 
@@ -94,11 +170,18 @@ void Arduino_ESP32RGBPanel::beginWrite()
 
 void Arduino_ESP32RGBPanel::endWrite()
 {
+  flushWrites();
   CS_HIGH();
 }
 
 void Arduino_ESP32RGBPanel::writeCommand(uint8_t c)
 {
+  if (_spiDev)
+  {
+    write9(c);
+    return;
+  }
+
   // D/C bit, command
   SDA_LOW();
   SCK_HIGH();
@@ -128,6 +211,12 @@ void Arduino_ESP32RGBPanel::writeCommand16(uint16_t)
 
 void Arduino_ESP32RGBPanel::write(uint8_t d)
 {
+  if (_spiDev)
+  {
+    write9(0x100 | d);
+    return;
+  }
+
   // D/C bit, data
   SDA_HIGH();
   SCK_HIGH();
@@ -249,6 +338,26 @@ uint16_t *Arduino_ESP32RGBPanel::getFrameBuffer(
   _panel_config->flags.relax_on_idle = 0;
   _panel_config->flags.fb_in_psram = 1;             // allocate frame buffer in PSRAM
 
+  // Bounce buffers: scanout reads small internal SRAM buffers refilled from
+  // the PSRAM framebuffer in the LCD ISR, so PSRAM load can't starve the DMA
+  if (_bounce_buffer_size_px)
+  {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 4, 4)
+    _panel_config->bounce_buffer_size_px = _bounce_buffer_size_px;
+#else
+    Serial.println(F("RGB panel bounce buffers need ESP-IDF 4.4.4+, scanning PSRAM directly."));
+    _bounce_buffer_size_px = 0;
+#endif
+  }
+
+  // Frame done fires once per VSYNC in stream mode, used for buffer swaps
+  if (!_vsyncSem)
+  {
+    _vsyncSem = xSemaphoreCreateBinary();
+  }
+  _panel_config->on_frame_trans_done = onFrameTransDone;
+  _panel_config->user_ctx = this;
+
   ESP_ERROR_CHECK(esp_lcd_new_rgb_panel(_panel_config, &_panel_handle));
   ESP_ERROR_CHECK(esp_lcd_panel_reset(_panel_handle));
   ESP_ERROR_CHECK(esp_lcd_panel_init(_panel_handle));
@@ -257,10 +366,222 @@ uint16_t *Arduino_ESP32RGBPanel::getFrameBuffer(
   ESP_ERROR_CHECK(_panel_handle->draw_bitmap(_panel_handle, 0, 0, 1, 1, &color));
 
   _rgb_panel = __containerof(_panel_handle, esp_rgb_panel_t, base);
+  gdma_get_channel_id(_rgb_panel->dma_chan, &_dmaChannel);
+  updateFramePeriod();
 
   return (uint16_t *)_rgb_panel->fb;
 }
 
+uint16_t *Arduino_ESP32RGBPanel::allocBackBuffer()
+{
+  if (!_rgb_panel)
+  {
+    return NULL;
+  }
+
+  uint8_t *fb = (uint8_t *)heap_caps_aligned_alloc(_rgb_panel->psram_trans_align, _rgb_panel->fb_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (fb)
+  {
+    // Start from the current frame so the first swap doesn't flash
+    memcpy(fb, _rgb_panel->fb, _rgb_panel->fb_size);
+    Cache_WriteBack_Addr((uint32_t)fb, _rgb_panel->fb_size);
+  }
+  return (uint16_t *)fb;
+}
+
+void Arduino_ESP32RGBPanel::presentFrameBuffer(uint16_t *fb)
+{
+  if ((!_rgb_panel) || (!fb) || ((uint8_t *)fb == _rgb_panel->fb))
+  {
+    return;
+  }
+
+  // The swap itself happens in the frame done ISR, between two frames
+  _fbPending = fb;
+  while (_fbPending)
+  {
+    if (!waitVSync(100))
+    {
+      break; // panel not running, swap lands whenever it restarts
+    }
+  }
+}
+
+bool Arduino_ESP32RGBPanel::waitVSync(uint32_t timeout_ms)
+{
+  if (!_vsyncSem)
+  {
+    return false;
+  }
+  xSemaphoreTake(_vsyncSem, 0); // drop a stale edge
+  return xSemaphoreTake(_vsyncSem, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+}
+
+bool Arduino_ESP32RGBPanel::readFrameBuffer(uint16_t *dst)
+{
+  if ((!_rgb_panel) || (!dst))
+  {
+    return false;
+  }
+
+  // Pinned under the ISR's lock, so the buffer read here stays the front
+  // one until the copy is done
+  portENTER_CRITICAL(&_fbMux);
+  _fbPinned = true;
+  uint8_t *fb = _rgb_panel->fb;
+  portEXIT_CRITICAL(&_fbMux);
+
+  size_t size = _rgb_panel->fb_size;
+  // CPU writes still in the cache go out first, then the lines are dropped
+  // so the copy sees what the DMA scans
+  Cache_WriteBack_Addr((uint32_t)fb, size);
+  Cache_Invalidate_Addr((uint32_t)fb, size);
+  memcpy(dst, fb, size);
+
+  portENTER_CRITICAL(&_fbMux);
+  _fbPinned = false;
+  portEXIT_CRITICAL(&_fbMux);
+  return true;
+}
+
+bool Arduino_ESP32RGBPanel::setScanout(bool enabled)
+{
+  if ((!_rgb_panel) || _bounce_buffer_size_px)
+  {
+    return false; // the driver's bounce-buffer refill can't be restarted from here
+  }
+
+  esp_rgb_panel_t *rgb_panel = _rgb_panel;
+  if (!enabled)
+  {
+    lcd_ll_stop(rgb_panel->hal.dev);
+    gdma_stop(rgb_panel->dma_chan);
+#if CONFIG_PM_ENABLE
+    if (rgb_panel->pm_lock)
+    {
+      esp_pm_lock_release(rgb_panel->pm_lock);
+    }
+#endif
+    return true;
+  }
+
+#if CONFIG_PM_ENABLE
+  if (rgb_panel->pm_lock)
+  {
+    esp_pm_lock_acquire(rgb_panel->pm_lock);
+  }
+#endif
+  // Same sequence esp_lcd uses to start a transfer: empty FIFOs, DMA from the
+  // first descriptor (swaps re-point the chain, so that's the current fb)
+  gdma_reset(rgb_panel->dma_chan);
+  lcd_ll_fifo_reset(rgb_panel->hal.dev);
+  gdma_start(rgb_panel->dma_chan, (intptr_t)rgb_panel->dma_nodes);
+  esp_rom_delay_us(1); // enough for the DMA to reach the LCD FIFO
+  _lastFrameUs = 0;    // the restart isn't a late frame
+  lcd_ll_start(rgb_panel->hal.dev);
+  return true;
+}
+
+bool Arduino_ESP32RGBPanel::setTiming(uint32_t pclk_hz,
+                                      uint16_t hsync_pulse_width, uint16_t hsync_back_porch, uint16_t hsync_front_porch,
+                                      uint16_t vsync_pulse_width, uint16_t vsync_back_porch, uint16_t vsync_front_porch)
+{
+  if ((!_rgb_panel) || _bounce_buffer_size_px || (!pclk_hz))
+  {
+    return false;
+  }
+
+  esp_rgb_panel_t *rgb_panel = _rgb_panel;
+  uint32_t prescale = (rgb_panel->resolution_hz + pclk_hz - 1) / pclk_hz;
+  if ((prescale == 0) || (prescale > LCD_LL_CLOCK_PRESCALE_MAX))
+  {
+    return false;
+  }
+
+  setScanout(false);
+  lcd_ll_set_pixel_clock_prescale(rgb_panel->hal.dev, prescale);
+  lcd_ll_set_horizontal_timing(rgb_panel->hal.dev, hsync_pulse_width, hsync_back_porch,
+                               rgb_panel->timings.h_res, hsync_front_porch);
+  lcd_ll_set_vertical_timing(rgb_panel->hal.dev, vsync_pulse_width, vsync_back_porch,
+                             rgb_panel->timings.v_res, vsync_front_porch);
+  rgb_panel->timings.pclk_hz = rgb_panel->resolution_hz / prescale;
+  rgb_panel->timings.hsync_pulse_width = hsync_pulse_width;
+  rgb_panel->timings.hsync_back_porch = hsync_back_porch;
+  rgb_panel->timings.hsync_front_porch = hsync_front_porch;
+  rgb_panel->timings.vsync_pulse_width = vsync_pulse_width;
+  rgb_panel->timings.vsync_back_porch = vsync_back_porch;
+  rgb_panel->timings.vsync_front_porch = vsync_front_porch;
+  updateFramePeriod();
+  return setScanout(true);
+}
+
+void Arduino_ESP32RGBPanel::updateFramePeriod()
+{
+  const esp_lcd_rgb_timing_t &t = _rgb_panel->timings;
+  _framePeriodUs = (uint64_t)(t.h_res + t.hsync_pulse_width + t.hsync_back_porch + t.hsync_front_porch) *
+                   (t.v_res + t.vsync_pulse_width + t.vsync_back_porch + t.vsync_front_porch) * 1000000 /
+                   t.pclk_hz;
+}
+
+IRAM_ATTR bool Arduino_ESP32RGBPanel::onFrameTransDone(esp_lcd_panel_handle_t panel, esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx)
+{
+  Arduino_ESP32RGBPanel *self = (Arduino_ESP32RGBPanel *)user_ctx;
+  BaseType_t need_yield = pdFALSE;
+
+  portENTER_CRITICAL_ISR(&self->_fbMux);
+  uint16_t *next = self->_fbPinned ? NULL : self->_fbPending;
+  if (next && self->_rgb_panel)
+  {
+    esp_rgb_panel_t *rgb_panel = self->_rgb_panel;
+    if (!self->_bounce_buffer_size_px)
+    {
+      // Re-point the circular DMA chain at the new framebuffer
+      intptr_t offset = (uint8_t *)next - rgb_panel->fb;
+      for (size_t i = 0; i < rgb_panel->num_dma_nodes; i++)
+      {
+        rgb_panel->dma_nodes[i].buffer = (uint8_t *)rgb_panel->dma_nodes[i].buffer + offset;
+      }
+    }
+    // With bounce buffers the DMA only sees SRAM, the refill ISR copies from fb
+    rgb_panel->fb = (uint8_t *)next;
+    self->_fbPending = NULL;
+  }
+  portEXIT_CRITICAL_ISR(&self->_fbMux);
+
+  self->_frameCount++;
+
+  // The FIFO flags latch whether or not their interrupt is enabled
+  if (self->_dmaChannel >= 0)
+  {
+    auto &out = GDMA.channel[self->_dmaChannel].out;
+    if (out.int_raw.outfifo_udf_l1 || out.int_raw.outfifo_udf_l3)
+    {
+      out.int_clr.outfifo_udf_l1 = 1;
+      out.int_clr.outfifo_udf_l3 = 1;
+      self->_underrunFrames++;
+    }
+  }
+  int64_t now = esp_timer_get_time();
+  if (self->_lastFrameUs && self->_framePeriodUs)
+  {
+    int64_t off = now - self->_lastFrameUs - self->_framePeriodUs;
+    if ((off > (int64_t)(self->_framePeriodUs / 2)) || (-off > (int64_t)(self->_framePeriodUs / 2)))
+    {
+      self->_lateFrames++;
+    }
+  }
+  self->_lastFrameUs = now;
+  TaskHandle_t waiter = self->_frameWaiter;
+  if (waiter)
+  {
+    self->_frameWaiter = NULL;
+    vTaskNotifyGiveFromISR(waiter, &need_yield);
+  }
+
+  xSemaphoreGiveFromISR(self->_vsyncSem, &need_yield);
+  return need_yield == pdTRUE;
+}
+
 INLINE void Arduino_ESP32RGBPanel::CS_HIGH(void)
 {
   *_csPortSet = _csPinMask;
@@ -7,17 +7,26 @@
 
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_rgb.h"
+#include "driver/spi_master.h"
 #include "esp_lcd_panel_vendor.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_interface.h"
 #include "esp_private/gdma.h"
 #include "esp_pm.h"
+#include "esp_idf_version.h"
 #include "hal/dma_types.h"
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
 #include "hal/lcd_hal.h"
 #include "hal/lcd_ll.h"
+#include "soc/gdma_struct.h"
 
 #include "esp32s3/rom/cache.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
 // This function is located in ROM (also see esp_rom/${target}/ld/${target}.rom.ld)
 extern int Cache_WriteBack_Addr(uint32_t addr, uint32_t size);
 
@@ -62,7 +71,7 @@ public:
       int8_t r0, int8_t r1, int8_t r2, int8_t r3, int8_t r4,
       int8_t g0, int8_t g1, int8_t g2, int8_t g3, int8_t g4, int8_t g5,
       int8_t b0, int8_t b1, int8_t b2, int8_t b3, int8_t b4,
-      bool useBigEndian = false);
+      bool useBigEndian = false, size_t bounce_buffer_size_px = 0);
 
   void begin(int32_t speed = GFX_NOT_DEFINED, int8_t dataMode = GFX_NOT_DEFINED) override;
   void beginWrite() override;
@@ -76,6 +85,14 @@ public:
 
   void writeBytes(uint8_t *data, uint32_t len) override;
   void writePattern(uint8_t *data, uint8_t len, uint32_t repeat) override;
+  void flushWrites() override;
+
+  // SPI host for the 3-wire 9-bit command bus, before begin(); the
+  // default is SPI2. GFX_NOT_DEFINED, or a host that fails to start,
+  // bit-bangs the GPIOs instead. The host stays claimed by the IDF SPI
+  // driver, so an Arduino_ESP32SPI display goes on the other one (HSPI).
+  void setCommandSPIHost(int8_t host) { _spiHost = host; }
+  bool isCommandSPIHardware() const { return _spiDev != NULL; }
 
   uint16_t *getFrameBuffer(
       uint16_t w, uint16_t h,
@@ -83,8 +100,54 @@ public:
       uint16_t vsync_pulse_width = 10, uint16_t vsync_back_porch = 16, uint16_t vsync_front_porch = 4, uint16_t vsync_polarity = 1,
       uint16_t pclk_active_neg = 0, int32_t prefer_speed = GFX_NOT_DEFINED);
 
+  // Double buffering: allocate a second framebuffer and swap scanout at VSYNC
+  uint16_t *allocBackBuffer();
+  void presentFrameBuffer(uint16_t *fb);
+  bool waitVSync(uint32_t timeout_ms = 50);
+
+  // Frame pacing: frames scanned out so far, the scanout period from the
+  // timings and pixel clock, and a one-shot task notification at the next
+  // frame done (a later call replaces an unfired one)
+  uint32_t getFrameCount() const { return _frameCount; }
+  uint32_t getFramePeriodUs() const { return _framePeriodUs; }
+  void notifyNextFrame(TaskHandle_t task) { _frameWaiter = task; }
+
+  // The framebuffer being scanned out (the front one when double buffered)
+  uint16_t *getScanoutBuffer() { return _rgb_panel ? (uint16_t *)_rgb_panel->fb : NULL; }
+  size_t getFrameBufferSize() { return _rgb_panel ? _rgb_panel->fb_size : 0; }
+
+  // Copy the scanned-out framebuffer into dst (getFrameBufferSize() bytes):
+  // a swap presented meanwhile is held until the copy ends, and the copy
+  // reads PSRAM behind the cache, so pixels GDMA wrote there are included.
+  // One reader at a time; single buffered, the caller keeps drawing out of
+  // the way (LVGL between frames).
+  bool readFrameBuffer(uint16_t *dst);
+
+  // Stop/restart PCLK, syncs and framebuffer DMA. Restart begins a fresh
+  // frame from the top. Not available with bounce buffers (returns false).
+  bool setScanout(bool enabled);
+
+  // Reprogram the pixel clock and porches of the running panel: scanout
+  // stops, takes the new timing and restarts from the top of a frame. The
+  // clock is the nearest the peripheral divider reaches at or below pclk_hz
+  // (getPixelClock()). Not available with bounce buffers (returns false).
+  bool setTiming(uint32_t pclk_hz,
+                 uint16_t hsync_pulse_width, uint16_t hsync_back_porch, uint16_t hsync_front_porch,
+                 uint16_t vsync_pulse_width, uint16_t vsync_back_porch, uint16_t vsync_front_porch);
+  uint32_t getPixelClock() const { return _rgb_panel ? _rgb_panel->timings.pclk_hz : 0; }
+  const esp_lcd_rgb_timing_t *getTimings() const { return _rgb_panel ? &_rgb_panel->timings : NULL; }
+
+  // Scanout health, counted in the frame done ISR: frames during which the
+  // DMA FIFO feeding the LCD ran dry (PSRAM couldn't keep up, the picture
+  // shifts), and frames that ended more than half a period off schedule
+  uint32_t getUnderrunFrames() const { return _underrunFrames; }
+  uint32_t getLateFrames() const { return _lateFrames; }
+
 protected:
 private:
+  static bool onFrameTransDone(esp_lcd_panel_handle_t panel, esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx);
+  void updateFramePeriod();
+
   INLINE void CS_HIGH(void);
   INLINE void CS_LOW(void);
   INLINE void SCK_HIGH(void);
@@ -92,6 +155,13 @@ private:
   INLINE void SDA_HIGH(void);
   INLINE void SDA_LOW(void);
 
+  // Hardware command bus: 9-bit words (D/C bit, then the byte) packed MSB
+  // first and sent in polled transactions of up to 64 bytes; CS stays a
+  // GPIO held low for the whole beginWrite()..endWrite()
+  bool beginCommandSPI();
+  void write9(uint16_t word);
+  void flushCommandSPI();
+
   int32_t _speed;
   int8_t _dataMode;
   int8_t _cs, _sck, _sda;
@@ -100,9 +170,22 @@ private:
   int8_t _g0, _g1, _g2, _g3, _g4, _g5;
   int8_t _b0, _b1, _b2, _b3, _b4;
   bool _useBigEndian;
+  size_t _bounce_buffer_size_px; // 0 = DMA scans the PSRAM framebuffer directly
 
   esp_lcd_panel_handle_t _panel_handle = NULL;
-  esp_rgb_panel_t *_rgb_panel;
+  esp_rgb_panel_t *_rgb_panel = NULL;
+
+  SemaphoreHandle_t _vsyncSem = NULL;
+  uint16_t *volatile _fbPending = NULL; // framebuffer to switch to at next frame done
+  bool _fbPinned = false;               // readFrameBuffer() running, swaps wait
+  portMUX_TYPE _fbMux = portMUX_INITIALIZER_UNLOCKED;
+  volatile uint32_t _frameCount = 0;
+  TaskHandle_t volatile _frameWaiter = NULL;
+  uint32_t _framePeriodUs = 0;
+  int _dmaChannel = -1;
+  int64_t _lastFrameUs = 0;
+  volatile uint32_t _underrunFrames = 0;
+  volatile uint32_t _lateFrames = 0;
 
   PORTreg_t _csPortSet;  ///< PORT register for chip select SET
   PORTreg_t _csPortClr;  ///< PORT register for chip select CLEAR
@@ -113,6 +196,11 @@ private:
   uint32_t _csPinMask;   ///< Bitmask for chip select
   uint32_t _sckPinMask;  ///< Bitmask for SCK
   uint32_t _sdaPinMask;  ///< Bitmask for SCK
+
+  int8_t _spiHost = SPI2_HOST;
+  spi_device_handle_t _spiDev = NULL;
+  uint16_t _spiBits = 0;
+  uint8_t _spiBuf[64] __attribute__((aligned(4)));
 };
 
 #endif // _ARDUINO_ESP32RGBPANEL_H_
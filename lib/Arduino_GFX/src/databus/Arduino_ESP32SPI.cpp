@@ -62,6 +62,9 @@ static spi_t _spi_bus_array[] = {
 };
 #endif // CONFIG_DISABLE_HAL_LOCKS
 
+// Devices queued for each bus in beginWrite(), see yieldBus()
+static uint32_t _spi_bus_waiting[sizeof(_spi_bus_array) / sizeof(_spi_bus_array[0])] = {0};
+
 Arduino_ESP32SPI::Arduino_ESP32SPI(int8_t dc /* = GFX_NOT_DEFINED */, int8_t cs /* = GFX_NOT_DEFINED */, int8_t sck /* = GFX_NOT_DEFINED */, int8_t mosi /* = GFX_NOT_DEFINED */, int8_t miso /* = GFX_NOT_DEFINED */, uint8_t spi_num /* = VSPI for ESP32, FSPI for S2 & C3 */, bool is_shared_interface /* = true */)
     : _dc(dc), _spi_num(spi_num), _is_shared_interface(is_shared_interface)
 {
@@ -311,7 +314,7 @@ void Arduino_ESP32SPI::beginWrite()
 
   if (_is_shared_interface)
   {
-    spiTransaction(_spi, _div, _dataMode, _bitOrder);
+    acquireBus();
   }
 
   if (_dc != GFX_NOT_DEFINED)
@@ -323,21 +326,58 @@ void Arduino_ESP32SPI::beginWrite()
 
 void Arduino_ESP32SPI::endWrite()
 {
+  WAIT_ASYNC();
   if (_data_buf_bit_idx > 0)
   {
     flush_data_buf();
   }
 
+  // Deselect before the next device on the bus can take it
+  CS_HIGH();
+
   if (_is_shared_interface)
   {
     spiEndTransaction(_spi);
   }
+}
+
+void Arduino_ESP32SPI::acquireBus()
+{
+  __atomic_add_fetch(&_spi_bus_waiting[_spi_num], 1, __ATOMIC_RELAXED);
+  spiTransaction(_spi, _div, _dataMode, _bitOrder);
+  __atomic_sub_fetch(&_spi_bus_waiting[_spi_num], 1, __ATOMIC_RELAXED);
+  _bus_held_at = micros();
+}
+
+// Shared bus: a long pixel stream that has held the bus for SPI_BUS_SLICE_US
+// while another device waits steps off between chunks and takes it back
+// after that device's transaction, so a big redraw on one display doesn't
+// hold up the others for its whole length. The controller keeps its memory
+// write position while deselected, the stream resumes where it was.
+// Only called where DC is high and data_buf is refilled every chunk.
+void Arduino_ESP32SPI::yieldBus()
+{
+  if (!_is_shared_interface || !_spi_bus_waiting[_spi_num] || ((micros() - _bus_held_at) < SPI_BUS_SLICE_US))
+  {
+    return;
+  }
 
+  WAIT_ASYNC();
   CS_HIGH();
+  spiEndTransaction(_spi);
+  // The waiter may be a lower priority task on this core
+  vTaskDelay(1);
+  acquireBus();
+  if (_dc != GFX_NOT_DEFINED)
+  {
+    DC_HIGH();
+  }
+  CS_LOW();
 }
 
 void Arduino_ESP32SPI::writeCommand(uint8_t c)
 {
+  WAIT_ASYNC();
   if (_dc < 0) // 9-bit SPI
   {
     WRITE9BIT(c);
@@ -370,6 +410,7 @@ void Arduino_ESP32SPI::writeCommand(uint8_t c)
 
 void Arduino_ESP32SPI::writeCommand16(uint16_t c)
 {
+  WAIT_ASYNC();
   if (_dc < 0) // 9-bit SPI
   {
     _data16.value = c;
@@ -431,6 +472,7 @@ void Arduino_ESP32SPI::write16(uint16_t d)
 
 void Arduino_ESP32SPI::writeRepeat(uint16_t p, uint32_t len)
 {
+  WAIT_ASYNC();
   if (_data_buf_bit_idx > 0)
   {
     flush_data_buf();
@@ -563,6 +605,7 @@ void Arduino_ESP32SPI::writeRepeat(uint16_t p, uint32_t len)
 
 void Arduino_ESP32SPI::writePixels(uint16_t *data, uint32_t len)
 {
+  WAIT_ASYNC();
   if (_dc < 0) // 9-bit SPI
   {
     while (len--)
@@ -580,12 +623,13 @@ void Arduino_ESP32SPI::writePixels(uint16_t *data, uint32_t len)
         flush_data_buf();
       }
 
-      MOSI_BIT_LEN = 511;
-#if CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32
-      MISO_BIT_LEN = 0;
-#endif
       while (len >= 32)
       {
+        yieldBus();
+        MOSI_BIT_LEN = 511;
+#if CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32
+        MISO_BIT_LEN = 0;
+#endif
         for (uint8_t i = 0; i < 16; i++)
         {
           p1 = *data++;
@@ -640,8 +684,126 @@ void Arduino_ESP32SPI::writePixels(uint16_t *data, uint32_t len)
   }
 }
 
+#if CONFIG_IDF_TARGET_ESP32S3
+bool Arduino_ESP32SPI::allocAsyncBuffers()
+{
+  if (_async_chan)
+  {
+    return true;
+  }
+  if (_async_failed)
+  {
+    return false;
+  }
+
+  bool ok = true;
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    _async_buf[i] = (uint16_t *)heap_caps_malloc(SPI_ASYNC_PIXELS_AT_ONCE * 2, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    _async_desc[i] = (dma_descriptor_t *)heap_caps_malloc(sizeof(dma_descriptor_t), MALLOC_CAP_DMA);
+    ok = ok && _async_buf[i] && _async_desc[i];
+  }
+
+  gdma_channel_alloc_config_t dma_config = {};
+  dma_config.direction = GDMA_CHANNEL_DIRECTION_TX;
+  if (ok && (gdma_new_channel(&dma_config, &_async_chan) == ESP_OK))
+  {
+    // FSPI is GP-SPI2, HSPI is GP-SPI3
+    if (gdma_connect(_async_chan, GDMA_MAKE_TRIGGER(GDMA_TRIG_PERIPH_SPI, (_spi_num == FSPI) ? 2 : 3)) == ESP_OK)
+    {
+      return true;
+    }
+    gdma_del_channel(_async_chan);
+  }
+
+  // no DMA channel or internal memory to spare: stay synchronous
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    heap_caps_free(_async_buf[i]);
+    heap_caps_free(_async_desc[i]);
+    _async_buf[i] = nullptr;
+    _async_desc[i] = nullptr;
+  }
+  _async_chan = nullptr;
+  _async_failed = true;
+  return false;
+}
+
+void Arduino_ESP32SPI::writePixelsAsync(uint16_t *data, uint32_t len)
+{
+  if ((_dc < 0) || (len < SPI_MAX_PIXELS_AT_ONCE) || !allocAsyncBuffers()) // 9-bit SPI or too short for DMA
+  {
+    writePixels(data, len);
+    return;
+  }
+
+  if (_data_buf_bit_idx > 0)
+  {
+    flush_data_buf();
+  }
+
+  uint32_t xferLen, l;
+
+  while (len >= SPI_MAX_PIXELS_AT_ONCE)
+  {
+    yieldBus();
+    xferLen = (len < SPI_ASYNC_PIXELS_AT_ONCE) ? len : SPI_ASYNC_PIXELS_AT_ONCE; // How many this pass?
+
+    // fill the idle buffer, high byte first, while the previous pass is
+    // still on the bus
+    uint16_t *buf = _async_buf[_async_idx];
+    for (uint32_t i = 0; i < xferLen; ++i)
+    {
+      MSB_16_SET(buf[i], data[i]);
+    }
+
+    l = xferLen << 1;
+    dma_descriptor_t *desc = _async_desc[_async_idx];
+    *(uint32_t *)desc = ((l + 3) & (~3)) | l << 12 | 0xC0000000;
+    desc->buffer = buf;
+    desc->next = nullptr;
+
+    WAIT_SPI_NOT_BUSY;
+    MOSI_BIT_LEN = (l << 3) - 1;
+    _spi->dev->dma_conf.dma_afifo_rst = 1;
+    _spi->dev->dma_conf.dma_afifo_rst = 0;
+    gdma_start(_async_chan, (intptr_t)(desc));
+    _spi->dev->dma_conf.dma_tx_ena = 1;
+    _spi->dev->cmd.update = 1;
+    while (_spi->dev->cmd.update)
+      ;
+    _spi->dev->cmd.usr = 1;
+    _async_busy = true;
+    _async_idx ^= 1;
+
+    data += xferLen;
+    len -= xferLen;
+  }
+
+  if (len)
+  {
+    writePixels(data, len);
+  }
+}
+
+bool Arduino_ESP32SPI::isAsyncBusy()
+{
+  if (_async_busy && !_spi->dev->cmd.usr)
+  {
+    WAIT_ASYNC();
+  }
+  return _async_busy;
+}
+
+void Arduino_ESP32SPI::waitAsync()
+{
+  WAIT_ASYNC();
+}
+#endif // CONFIG_IDF_TARGET_ESP32S3
+
 void Arduino_ESP32SPI::writeC8D8(uint8_t c, uint8_t d)
 {
+  WAIT_ASYNC();
   if (_dc < 0) // 9-bit SPI
   {
     WRITE9BIT(c);
@@ -688,6 +850,7 @@ void Arduino_ESP32SPI::writeC8D8(uint8_t c, uint8_t d)
 
 void Arduino_ESP32SPI::writeC8D16(uint8_t c, uint16_t d)
 {
+  WAIT_ASYNC();
   if (_dc < 0) // 9-bit SPI
   {
     WRITE9BIT(c);
@@ -736,6 +899,7 @@ void Arduino_ESP32SPI::writeC8D16(uint8_t c, uint16_t d)
 
 void Arduino_ESP32SPI::writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2)
 {
+  WAIT_ASYNC();
   if (_dc < 0) // 9-bit SPI
   {
     WRITE9BIT(c);
@@ -787,6 +951,7 @@ void Arduino_ESP32SPI::writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2)
 
 void Arduino_ESP32SPI::writeBytes(uint8_t *data, uint32_t len)
 {
+  WAIT_ASYNC();
   if (_dc < 0) // 9-bit SPI
   {
     while (len--)
@@ -862,6 +1027,7 @@ void Arduino_ESP32SPI::writeBytes(uint8_t *data, uint32_t len)
 
 void Arduino_ESP32SPI::writePattern(uint8_t *data, uint8_t len, uint32_t repeat)
 {
+  WAIT_ASYNC();
   while (repeat--)
   {
     writeBytes(data, len);
@@ -870,6 +1036,7 @@ void Arduino_ESP32SPI::writePattern(uint8_t *data, uint8_t len, uint32_t repeat)
 
 void Arduino_ESP32SPI::writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_t len)
 {
+  WAIT_ASYNC();
   if (_dc < 0) // 9-bit SPI
   {
     while (len--)
@@ -887,12 +1054,13 @@ void Arduino_ESP32SPI::writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_t
         flush_data_buf();
       }
 
-      MOSI_BIT_LEN = 511;
-#if CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32
-      MISO_BIT_LEN = 0;
-#endif
       while (len >= 32)
       {
+        yieldBus();
+        MOSI_BIT_LEN = 511;
+#if CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32
+        MISO_BIT_LEN = 0;
+#endif
         for (uint8_t i = 0; i < 16; i++)
         {
           p1 = idx[*data++];
@@ -949,6 +1117,7 @@ void Arduino_ESP32SPI::writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_t
 
 void Arduino_ESP32SPI::writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, uint32_t len)
 {
+  WAIT_ASYNC();
   uint16_t p;
   if (_dc < 0) // 9-bit SPI
   {
@@ -1032,6 +1201,7 @@ void Arduino_ESP32SPI::writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, ui
 
 void Arduino_ESP32SPI::flush_data_buf()
 {
+  WAIT_ASYNC();
   MOSI_BIT_LEN = _data_buf_bit_idx - 1;
 #if CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32
   MISO_BIT_LEN = 0;
@@ -1052,6 +1222,19 @@ void Arduino_ESP32SPI::flush_data_buf()
   _data_buf_bit_idx = 0;
 }
 
+INLINE void Arduino_ESP32SPI::WAIT_ASYNC(void)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+  if (_async_busy)
+  {
+    WAIT_SPI_NOT_BUSY;
+    // back to CPU-fed transfers from data_buf
+    _spi->dev->dma_conf.dma_tx_ena = 0;
+    _async_busy = false;
+  }
+#endif
+}
+
 INLINE void Arduino_ESP32SPI::WRITE8BIT(uint8_t d)
 {
   uint16_t idx = _data_buf_bit_idx >> 3;
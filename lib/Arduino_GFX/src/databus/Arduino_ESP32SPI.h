@@ -21,6 +21,10 @@
 #endif
 
 #define SPI_MAX_PIXELS_AT_ONCE 32
+#define SPI_ASYNC_PIXELS_AT_ONCE 2040
+// Shared bus: longest a pixel stream holds the bus while another device
+// waits for it, see Arduino_ESP32SPI::yieldBus()
+#define SPI_BUS_SLICE_US 2000
 
 #if (CONFIG_IDF_TARGET_ESP32)
 #define MOSI_BIT_LEN _spi->dev->mosi_dlen.usr_mosi_dbitlen
@@ -53,6 +57,11 @@ public:
   void write16(uint16_t) override;
   void writeRepeat(uint16_t p, uint32_t len) override;
   void writePixels(uint16_t *data, uint32_t len) override;
+#if CONFIG_IDF_TARGET_ESP32S3
+  void writePixelsAsync(uint16_t *data, uint32_t len) override;
+  bool isAsyncBusy() override;
+  void waitAsync() override;
+#endif
 
   void writeC8D8(uint8_t c, uint8_t d) override;
   void writeC8D16(uint8_t c, uint16_t d) override;
@@ -65,6 +74,12 @@ public:
 
 protected:
   void flush_data_buf();
+  void acquireBus();
+  void yieldBus();
+#if CONFIG_IDF_TARGET_ESP32S3
+  bool allocAsyncBuffers();
+#endif
+  INLINE void WAIT_ASYNC(void);
   INLINE void WRITE8BIT(uint8_t d);
   INLINE void WRITE9BIT(uint32_t d);
   INLINE void DC_HIGH(void);
@@ -78,6 +93,7 @@ private:
   uint8_t _spi_num;
   bool _is_shared_interface;
   uint32_t _div = 0;
+  unsigned long _bus_held_at = 0;
 
   PORTreg_t _dcPortSet; ///< PORT register for data/command SET
   PORTreg_t _dcPortClr; ///< PORT register for data/command CLEAR
@@ -94,6 +110,17 @@ private:
     uint32_t _buffer32[SPI_MAX_PIXELS_AT_ONCE / 2];
   };
   uint16_t _data_buf_bit_idx = 0;
+
+#if CONFIG_IDF_TARGET_ESP32S3
+  // writePixelsAsync() GDMA channel and ping-pong buffers in internal RAM:
+  // one is filled while the other goes out
+  gdma_channel_handle_t _async_chan = nullptr;
+  uint16_t *_async_buf[2] = {nullptr, nullptr};
+  dma_descriptor_t *_async_desc[2] = {nullptr, nullptr};
+  uint8_t _async_idx = 0;
+  bool _async_busy = false;
+  bool _async_failed = false;
+#endif
 };
 
 #endif // _ARDUINO_ESP32SPI_H_
@@ -5,6 +5,115 @@
 #include "../Arduino_GFX.h"
 #include "Arduino_ST7701_RGBPanel.h"
 
+// ESP32-S3 PIE 128-bit vector kernels for the framebuffer copy/fill loops,
+// define ST7701_NO_PIE to fall back to the plain 16/32-bit loops
+#ifndef ST7701_NO_PIE
+#define ST7701_USE_PIE
+#endif
+
+// The row kernels every framebuffer draw ends in; define ST7701_IRAM_ROWS to
+// run them from IRAM, clear of flash cache misses while the RGB DMA and
+// WiFi compete for the cache (env:esp32s3-perf)
+#ifdef ST7701_IRAM_ROWS
+#define ST7701_FAST_MEM IRAM_ATTR
+#else
+#define ST7701_FAST_MEM
+#endif
+
+// Copy n RGB565 pixels
+ST7701_FAST_MEM void Arduino_ST7701_RGBPanel::copyRow(uint16_t *dst, const uint16_t *src, int32_t n)
+{
+#ifdef ST7701_USE_PIE
+  if (((((uint32_t)dst) ^ ((uint32_t)src)) & 15) == 0)
+  {
+    while ((((uint32_t)dst) & 15) && n)
+    {
+      *dst++ = *src++;
+      n--;
+    }
+    int32_t blocks = n >> 3; // 8 pixels per 128-bit vector
+    if (blocks)
+    {
+      asm volatile(
+          "1:\n"
+          "ee.vld.128.ip q0, %0, 16\n"
+          "ee.vst.128.ip q0, %1, 16\n"
+          "addi %2, %2, -1\n"
+          "bnez %2, 1b\n"
+          : "+r"(src), "+r"(dst), "+r"(blocks)
+          :
+          : "memory");
+      n &= 7;
+    }
+  }
+#endif
+  if (((((uint32_t)dst) ^ ((uint32_t)src)) & 3) == 0)
+  {
+    if ((((uint32_t)dst) & 3) && n)
+    {
+      *dst++ = *src++;
+      n--;
+    }
+    uint32_t *dst2 = (uint32_t *)dst;
+    const uint32_t *src2 = (const uint32_t *)src;
+    for (int32_t i = n >> 1; i > 0; i--)
+    {
+      *dst2++ = *src2++;
+    }
+    dst = (uint16_t *)dst2;
+    src = (const uint16_t *)src2;
+    n &= 1;
+  }
+  while (n--)
+  {
+    *dst++ = *src++;
+  }
+}
+
+// Fill n pixels with one color
+ST7701_FAST_MEM void Arduino_ST7701_RGBPanel::fillRow(uint16_t *dst, uint16_t color, int32_t n)
+{
+#ifdef ST7701_USE_PIE
+  while ((((uint32_t)dst) & 15) && n)
+  {
+    *dst++ = color;
+    n--;
+  }
+  int32_t blocks = n >> 3;
+  if (blocks)
+  {
+    asm volatile(
+        "ee.vldbc.16 q0, %3\n" // broadcast color to all 8 lanes
+        "1:\n"
+        "ee.vst.128.ip q0, %0, 16\n"
+        "addi %1, %1, -1\n"
+        "bnez %1, 1b\n"
+        : "+r"(dst), "+r"(blocks)
+        : "m"(color), "r"(&color)
+        : "memory");
+    n &= 7;
+  }
+#else
+  if ((((uint32_t)dst) & 3) && n)
+  {
+    *dst++ = color;
+    n--;
+  }
+  uint32_t c2 = ((uint32_t)color << 16) | color;
+  uint32_t *dst2 = (uint32_t *)dst;
+  for (int32_t i = n >> 1; i > 0; i--)
+  {
+    *dst2++ = c2;
+  }
+  dst = (uint16_t *)dst2;
+  n &= 1;
+#endif
+  while (n--)
+  {
+    *dst++ = color;
+  }
+}
+
 Arduino_ST7701_RGBPanel::Arduino_ST7701_RGBPanel(
     Arduino_ESP32RGBPanel *bus, int8_t rst, uint8_t r,
     bool ips, int16_t w, int16_t h,
@@ -12,7 +121,7 @@ Arduino_ST7701_RGBPanel::Arduino_ST7701_RGBPanel(
     bool bgr,
     uint16_t hsync_front_porch, uint16_t hsync_pulse_width, uint16_t hsync_back_porch,
     uint16_t vsync_front_porch, uint16_t vsync_pulse_width, uint16_t vsync_back_porch)
-    : Arduino_GFX(w, h), _bus(bus), _rst(rst), _ips(ips),
+    : Arduino_FramebufferGFX<Arduino_ST7701_RGBPanel>(w, h), _bus(bus), _rst(rst), _ips(ips),
       _init_operations(init_operations), _init_operations_len(init_operations_len),
       _bgr(bgr),
       _hsync_front_porch(hsync_front_porch), _hsync_pulse_width(hsync_pulse_width), _hsync_back_porch(hsync_back_porch),
@@ -47,244 +156,306 @@ void Arduino_ST7701_RGBPanel::begin(int32_t speed)
   invertDisplay(false);
   setRotation(_rotation);
 
-  _framebuffer = _bus->getFrameBuffer(_width, _height,
+  _framebuffer = _bus->getFrameBuffer(WIDTH, HEIGHT,
                                       _hsync_pulse_width, _hsync_back_porch, _hsync_front_porch, 1,
                                       _vsync_pulse_width, _vsync_back_porch, _vsync_front_porch, 1);
 }
 
-void Arduino_ST7701_RGBPanel::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
+// Primitives between startWrite() and endWrite() only record dirty areas,
+// the cache is written back once when the outermost endWrite() is reached
+void Arduino_ST7701_RGBPanel::startWrite()
 {
-  uint16_t *fb = _framebuffer;
-  fb += (int32_t)y * _width;
-  fb += x;
-  *fb = color;
-  Cache_WriteBack_Addr((uint32_t)fb, 2);
+  _writeDepth++;
 }
 
-void Arduino_ST7701_RGBPanel::writeFastVLine(int16_t x, int16_t y,
-                                             int16_t h, uint16_t color)
+void Arduino_ST7701_RGBPanel::endWrite()
 {
-  if (_ordered_in_range(x, 0, _max_x) && h)
-  { // X on screen, nonzero height
-    if (h < 0)
-    {             // If negative height...
-      y += h + 1; //   Move Y to top edge
-      h = -h;     //   Use positive height
-    }
-    if (y <= _max_y)
-    { // Not off bottom
-      int16_t y2 = y + h - 1;
-      if (y2 >= 0)
-      { // Not off top
-        // Line partly or fully overlaps screen
-        if (y < 0)
-        {
-          y = 0;
-          h = y2 + 1;
-        } // Clip top
-        if (y2 > _max_y)
-        {
-          h = _max_y - y + 1;
-        } // Clip bottom
-
-        uint16_t *fb = _framebuffer + ((int32_t)y * _width) + x;
-        while (h--)
-        {
-          *fb = color;
-          Cache_WriteBack_Addr((uint32_t)fb, 2);
-          fb += _width;
-        }
-      }
+  if (_writeDepth && (--_writeDepth == 0))
+  {
+    for (uint8_t i = 0; i < _dirtyCount; i++)
+    {
+      DirtyRect *d = &_dirty[i];
+      writeBackRect(_framebuffer, d->x1, d->y1, d->x2 - d->x1 + 1, d->y2 - d->y1 + 1);
     }
+    _dirtyCount = 0;
   }
 }
 
-void Arduino_ST7701_RGBPanel::writeFastHLine(int16_t x, int16_t y,
-                                             int16_t w, uint16_t color)
+// Screen corners to framebuffer (panel) corners, see mapFramebuffer() in setRotation()
+void Arduino_ST7701_RGBPanel::toPanel(int16_t &x1, int16_t &y1, int16_t &x2, int16_t &y2)
 {
-  if (_ordered_in_range(y, 0, _max_y) && w)
-  { // Y on screen, nonzero width
-    if (w < 0)
-    {             // If negative width...
-      x += w + 1; //   Move X to left edge
-      w = -w;     //   Use positive width
-    }
-    if (x <= _max_x)
-    { // Not off right
-      int16_t x2 = x + w - 1;
-      if (x2 >= 0)
-      { // Not off left
-        // Line partly or fully overlaps screen
-        if (x < 0)
-        {
-          x = 0;
-          w = x2 + 1;
-        } // Clip left
-        if (x2 > _max_x)
-        {
-          w = _max_x - x + 1;
-        } // Clip right
-
-        uint16_t *fb = _framebuffer + ((int32_t)y * _width) + x;
-        uint32_t cachePos = (uint32_t)fb;
-        int16_t writeSize = w * 2;
-        while (w--)
-        {
-          *(fb++) = color;
-        }
-        Cache_WriteBack_Addr(cachePos, writeSize);
-      }
-    }
+  if (_rotation == 1)
+  {
+    int16_t t = x1;
+    x1 = WIDTH - 1 - y2;
+    y2 = x2;
+    x2 = WIDTH - 1 - y1;
+    y1 = t;
+  }
+  else if (_rotation == 3)
+  {
+    int16_t t = x1;
+    x1 = y1;
+    y1 = HEIGHT - 1 - x2;
+    x2 = y2;
+    y2 = HEIGHT - 1 - t;
   }
 }
 
-void Arduino_ST7701_RGBPanel::writeFillRectPreclipped(int16_t x, int16_t y,
-                                                      int16_t w, int16_t h, uint16_t color)
+// Takes screen coordinates, the list and the write-back work in framebuffer ones
+void Arduino_ST7701_RGBPanel::addDirty(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
 {
-  uint16_t *row = _framebuffer;
-  row += y * _width;
-  uint32_t cachePos = (uint32_t)row;
-  row += x;
-  for (int j = 0; j < h; j++)
+  toPanel(x1, y1, x2, y2);
+
+  if (!_writeDepth)
   {
-    for (int i = 0; i < w; i++)
+    writeBackRect(_framebuffer, x1, y1, x2 - x1 + 1, y2 - y1 + 1);
+    return;
+  }
+
+  // Grow an overlapping or touching rectangle
+  for (uint8_t i = 0; i < _dirtyCount; i++)
+  {
+    DirtyRect *d = &_dirty[i];
+    if ((x1 <= d->x2 + 1) && (x2 + 1 >= d->x1) && (y1 <= d->y2 + 1) && (y2 + 1 >= d->y1))
     {
-      row[i] = color;
+      d->x1 = min(d->x1, x1);
+      d->y1 = min(d->y1, y1);
+      d->x2 = max(d->x2, x2);
+      d->y2 = max(d->y2, y2);
+      return;
     }
-    row += _width;
   }
-  Cache_WriteBack_Addr(cachePos, _width * h * 2);
+
+  if (_dirtyCount < ST7701_MAX_DIRTY_RECTS)
+  {
+    _dirty[_dirtyCount++] = {x1, y1, x2, y2};
+  }
+  else
+  {
+    // List full, fold into the last entry
+    DirtyRect *d = &_dirty[_dirtyCount - 1];
+    d->x1 = min(d->x1, x1);
+    d->y1 = min(d->y1, y1);
+    d->x2 = max(d->x2, x2);
+    d->y2 = max(d->y2, y2);
+  }
 }
 
-void Arduino_ST7701_RGBPanel::draw16bitRGBBitmap(int16_t x, int16_t y,
-                                                 uint16_t *bitmap, int16_t w, int16_t h)
+void Arduino_ST7701_RGBPanel::writeBackRect(uint16_t *fb, int16_t x, int16_t y, int16_t w, int16_t h)
 {
-  if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
-  )
+  if ((w <= 0) || (h <= 0))
   {
     return;
   }
+
+  fb += ((int32_t)y * WIDTH) + x;
+  if ((w << 1) >= WIDTH)
+  {
+    // Wide area, one contiguous span costs less than per-row calls
+    writeBackSpan((uint32_t)fb, (((int32_t)(h - 1) * WIDTH) + w) * 2);
+  }
   else
   {
-    int16_t xskip = 0;
-    if ((y + h - 1) > _max_y)
-    {
-      h -= (y + h - 1) - _max_y;
-    }
-    if (y < 0)
-    {
-      bitmap -= y * w;
-      h += y;
-      y = 0;
-    }
-    if ((x + w - 1) > _max_x)
+    // Narrow area, only write back the touched part of each row
+    while (h--)
     {
-      xskip = (x + w - 1) - _max_x;
-      w -= xskip;
+      writeBackSpan((uint32_t)fb, w * 2);
+      fb += WIDTH;
     }
-    if (x < 0)
+  }
+}
+
+void Arduino_ST7701_RGBPanel::writeBackSpan(uint32_t addr, uint32_t len)
+{
+  uint32_t start = addr & ~(uint32_t)(ST7701_CACHE_LINE - 1);
+  uint32_t end = (addr + len + ST7701_CACHE_LINE - 1) & ~(uint32_t)(ST7701_CACHE_LINE - 1);
+  Cache_WriteBack_Addr(start, end - start);
+}
+
+// GDMA copy of whole framebuffer rows, returns false if the area can't be done
+// this way (caller falls back to draw16bitRGBBitmap). done_cb fires from the
+// DMA ISR once the pixels are in the framebuffer.
+bool Arduino_ST7701_RGBPanel::draw16bitRGBBitmapAsync(int16_t x, int16_t y,
+                                                      uint16_t *bitmap, int16_t w, int16_t h,
+                                                      st7701_async_done_cb_t done_cb, void *user_ctx)
+{
+  // Only whole rows map onto one contiguous framebuffer span
+  if ((_rotation & 1) || (x != 0) || (w != _width) || (y < 0) || (h <= 0) || ((y + h - 1) > _max_y))
+  {
+    return false;
+  }
+
+  uint16_t *dst = _framebuffer + ((int32_t)y * _width);
+  size_t len = (size_t)w * h * 2;
+  if ((((uint32_t)dst) & (ST7701_CACHE_LINE - 1)) || (((uint32_t)bitmap) & (ST7701_CACHE_LINE - 1)) || (len & (ST7701_CACHE_LINE - 1)))
+  {
+    return false;
+  }
+
+  if (!installAsyncMemcpy())
+  {
+    return false;
+  }
+
+  // DMA reads PSRAM directly, so the rendered pixels must leave the cache first
+  Cache_WriteBack_Addr((uint32_t)bitmap, len);
+
+  _asyncDoneCb = done_cb;
+  _asyncDoneCtx = user_ctx;
+  _asyncBusy = true;
+  if (esp_async_memcpy(_asyncMemcpy, dst, bitmap, len, onAsyncCopyDone, this) != ESP_OK)
+  {
+    _asyncBusy = false;
+    return false;
+  }
+  return true;
+}
+
+bool Arduino_ST7701_RGBPanel::readFrame(uint16_t *dst, uint32_t timeout_ms)
+{
+  uint32_t start = millis();
+  while (_asyncBusy)
+  {
+    if (millis() - start > timeout_ms)
     {
-      bitmap -= x;
-      xskip -= x;
-      w += x;
-      x = 0;
+      return false;
     }
-    uint16_t *row = _framebuffer;
-    row += y * _width;
-    uint32_t cachePos = (uint32_t)row;
-    row += x;
-    if (((_width & 1) == 0) && ((xskip & 1) == 0) && ((w & 1) == 0))
-    {
-      uint32_t *row2 = (uint32_t *)row;
-      uint32_t *bitmap2 = (uint32_t *)bitmap;
-      int16_t _width2 = _width >> 1;
-      int16_t xskip2 = xskip >> 1;
-      int16_t w2 = w >> 1;
+    vTaskDelay(1);
+  }
+  return _bus->readFrameBuffer(dst);
+}
 
-      for (int16_t j = 0; j < h; j++)
-      {
-        for (int16_t i = 0; i < w2; i++)
-        {
-          row2[i] = *bitmap2++;
-        }
-        bitmap2 += xskip2;
-        row2 += _width2;
-      }
-    }
-    else
+// Large fills of whole framebuffer rows go to GDMA as well: a few rows of the
+// color in internal RAM are copied down the area while the task blocks on
+// the copies instead of storing every pixel. The area skips the cache, its
+// lines are dropped so nothing stale is written back over it later.
+void Arduino_ST7701_RGBPanel::writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if ((w > 0) && (h > 0))
+  {
+    int16_t x1 = x, y1 = y, x2 = x + w - 1, y2 = y + h - 1;
+    toPanel(x1, y1, x2, y2);
+    if ((x1 == 0) && (x2 == WIDTH - 1) && fillRowsDMA(y1, y2 - y1 + 1, color))
     {
-      for (int j = 0; j < h; j++)
-      {
-        for (int i = 0; i < w; i++)
-        {
-          row[i] = *bitmap++;
-        }
-        bitmap += xskip;
-        row += _width;
-      }
+      return;
     }
-    Cache_WriteBack_Addr(cachePos, _width * h * 2);
   }
+  Arduino_FramebufferGFX<Arduino_ST7701_RGBPanel>::writeFillRectPreclipped(x, y, w, h, color);
 }
 
-void Arduino_ST7701_RGBPanel::draw16bitBeRGBBitmap(int16_t x, int16_t y,
-                                                   uint16_t *bitmap, int16_t w, int16_t h)
+// Returns false if nothing was filled (too few rows or no DMA), the caller
+// then fills on the CPU
+bool Arduino_ST7701_RGBPanel::fillRowsDMA(int16_t y, int16_t h, uint16_t color)
 {
-  if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
-  )
+  const size_t rowBytes = (size_t)WIDTH * 2;
+  if ((h < ST7701_DMA_FILL_MIN_ROWS) || (rowBytes & (ST7701_CACHE_LINE - 1)) || (((uint32_t)_framebuffer) & (ST7701_CACHE_LINE - 1)))
   {
-    return;
+    return false;
   }
-  else
+  if (!installAsyncMemcpy())
+  {
+    return false;
+  }
+  if (!_fillPattern)
   {
-    int16_t xskip = 0;
-    if ((y + h - 1) > _max_y)
+    _fillPattern = (uint16_t *)heap_caps_aligned_alloc(ST7701_CACHE_LINE, rowBytes * ST7701_DMA_FILL_ROWS, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    _fillDone = xSemaphoreCreateCounting(ST7701_DMA_FILL_INFLIGHT, 0);
+    if (!_fillPattern || !_fillDone)
     {
-      h -= (y + h - 1) - _max_y;
+      // Tried again next time, the CPU path does the same job meanwhile
+      heap_caps_free(_fillPattern);
+      _fillPattern = NULL;
+      if (_fillDone)
+      {
+        vSemaphoreDelete(_fillDone);
+        _fillDone = NULL;
+      }
+      return false;
     }
-    if (y < 0)
+  }
+  fillRow(_fillPattern, color, (int32_t)WIDTH * ST7701_DMA_FILL_ROWS);
+
+  uint8_t *dst = (uint8_t *)(_framebuffer + ((int32_t)y * WIDTH));
+  size_t len = rowBytes * h;
+  // Dirty lines written back during or after the copy would land on top of it
+  Cache_Invalidate_Addr((uint32_t)dst, len);
+
+  uint8_t inflight = 0;
+  int16_t done = 0;
+  while (done < h)
+  {
+    int16_t n = min((int16_t)ST7701_DMA_FILL_ROWS, (int16_t)(h - done));
+    if (inflight == ST7701_DMA_FILL_INFLIGHT)
     {
-      bitmap -= y * w;
-      h += y;
-      y = 0;
+      xSemaphoreTake(_fillDone, portMAX_DELAY);
+      inflight--;
     }
-    if ((x + w - 1) > _max_x)
+    if (esp_async_memcpy(_asyncMemcpy, dst + (rowBytes * done), _fillPattern, rowBytes * n, onAsyncFillDone, _fillDone) != ESP_OK)
     {
-      xskip = (x + w - 1) - _max_x;
-      w -= xskip;
+      if (inflight)
+      {
+        // Out of descriptors (shared with draw16bitRGBBitmapAsync), wait for one
+        xSemaphoreTake(_fillDone, portMAX_DELAY);
+        inflight--;
+        continue;
+      }
+      break;
     }
-    if (x < 0)
+    inflight++;
+    done += n;
+  }
+  while (inflight--)
+  {
+    xSemaphoreTake(_fillDone, portMAX_DELAY);
+  }
+  Cache_Invalidate_Addr((uint32_t)dst, len);
+
+  if (done < h)
+  {
+    // DMA refused the rest, finish it on the CPU
+    uint16_t *row = _framebuffer + ((int32_t)(y + done) * WIDTH);
+    for (int16_t i = done; i < h; i++)
     {
-      bitmap -= x;
-      xskip -= x;
-      w += x;
-      x = 0;
+      fillRow(row, color, WIDTH);
+      row += WIDTH;
     }
-    uint16_t *row = _framebuffer;
-    row += y * _width;
-    uint32_t cachePos = (uint32_t)row;
-    row += x;
-    uint16_t color;
-    for (int j = 0; j < h; j++)
+    writeBackRect(_framebuffer, 0, y + done, WIDTH, h - done);
+  }
+  return true;
+}
+
+bool Arduino_ST7701_RGBPanel::installAsyncMemcpy()
+{
+  if (!_asyncMemcpy)
+  {
+    async_memcpy_config_t config = ASYNC_MEMCPY_DEFAULT_CONFIG();
+    config.psram_trans_align = ST7701_CACHE_LINE;
+    if (esp_async_memcpy_install(&config, &_asyncMemcpy) != ESP_OK)
     {
-      for (int i = 0; i < w; i++)
-      {
-        color = *bitmap++;
-        MSB_16_SET(row[i], color);
-      }
-      bitmap += xskip;
-      row += _width;
+      _asyncMemcpy = NULL;
+      return false;
     }
-    Cache_WriteBack_Addr(cachePos, _width * h * 2);
   }
+  return true;
+}
+
+IRAM_ATTR bool Arduino_ST7701_RGBPanel::onAsyncFillDone(async_memcpy_t mcp_hdl, async_memcpy_event_t *event, void *cb_args)
+{
+  BaseType_t woken = pdFALSE;
+  xSemaphoreGiveFromISR((SemaphoreHandle_t)cb_args, &woken);
+  return woken == pdTRUE;
+}
+
+IRAM_ATTR bool Arduino_ST7701_RGBPanel::onAsyncCopyDone(async_memcpy_t mcp_hdl, async_memcpy_event_t *event, void *cb_args)
+{
+  Arduino_ST7701_RGBPanel *self = (Arduino_ST7701_RGBPanel *)cb_args;
+  self->_asyncBusy = false;
+  if (self->_asyncDoneCb)
+  {
+    self->_asyncDoneCb(self->_asyncDoneCtx);
+  }
+  return false;
 }
 
 /**************************************************************************/
@@ -295,13 +466,10 @@ void Arduino_ST7701_RGBPanel::draw16bitBeRGBBitmap(int16_t x, int16_t y,
 /**************************************************************************/
 void Arduino_ST7701_RGBPanel::setRotation(uint8_t r)
 {
-  Arduino_GFX::setRotation(r);
+  Arduino_FramebufferGFX<Arduino_ST7701_RGBPanel>::setRotation(r);
   _bus->beginWrite();
   switch (_rotation)
   {
-  case 1:
-    // not implemented
-    break;
   case 2:
     // Y direction
     _bus->writeCommand(0xFF);
@@ -322,10 +490,7 @@ void Arduino_ST7701_RGBPanel::setRotation(uint8_t r)
     _bus->writeCommand(0x36);
     _bus->write(_bgr ? 0x10 : 0x18);
     break;
-  case 3:
-    // not implemented
-    break;
-  default: // case 0:
+  default: // case 0, 1, 3:
     // Y direction
     _bus->writeCommand(0xFF);
     _bus->write(0x77);
@@ -347,6 +512,16 @@ void Arduino_ST7701_RGBPanel::setRotation(uint8_t r)
     break;
   }
   _bus->endWrite();
+
+  // The panel can only mirror, quarter turns are done in the framebuffer
+  if (_rotation == 1)
+  {
+    mapFramebuffer(WIDTH - 1, WIDTH, -1);
+  }
+  else if (_rotation == 3)
+  {
+    mapFramebuffer((int32_t)(HEIGHT - 1) * WIDTH, -WIDTH, 1);
+  }
 }
 
 void Arduino_ST7701_RGBPanel::invertDisplay(bool i)
@@ -354,9 +529,16 @@ void Arduino_ST7701_RGBPanel::invertDisplay(bool i)
   _bus->sendCommand(_ips ? (i ? 0x21 : 0x20) : (i ? 0x20 : 0x21));
 }
 
-uint16_t *Arduino_ST7701_RGBPanel::getFramebuffer()
+// Write back the cached rows of an area drawn directly into the framebuffer
+void Arduino_ST7701_RGBPanel::flushFramebuffer(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  flushFramebuffer(_framebuffer, x, y, w, h);
+}
+
+// Same, for any panel-sized buffer (e.g. the back buffer when double buffered)
+void Arduino_ST7701_RGBPanel::flushFramebuffer(uint16_t *fb, int16_t x, int16_t y, int16_t w, int16_t h)
 {
-  return _framebuffer;
+  writeBackRect(fb, x, y, w, h);
 }
 
 #endif // #if defined(ESP32) && (CONFIG_IDF_TARGET_ESP32S3)
@@ -6,11 +6,22 @@
 #define _ARDUINO_ST7701_RGBPANEL_H_
 
 #include "../Arduino_GFX.h"
+#include "../Arduino_FramebufferGFX.h"
 #include "../databus/Arduino_ESP32RGBPanel.h"
+#include "esp_async_memcpy.h"
 
 #define ST7701_TFTWIDTH 480
 #define ST7701_TFTHEIGHT 864
 
+#define ST7701_CACHE_LINE 64         // PSRAM cache writeback granularity (bytes)
+#define ST7701_MAX_DIRTY_RECTS 8     // dirty rectangles tracked between startWrite() and endWrite()
+#define ST7701_DMA_FILL_MIN_ROWS 64  // whole-row fills from this height up go through GDMA
+#define ST7701_DMA_FILL_ROWS 4       // rows of the fill color kept in internal RAM as the DMA source
+#define ST7701_DMA_FILL_INFLIGHT 4   // fill copies queued at once
+
+// Completion callback for draw16bitRGBBitmapAsync(), runs in ISR context
+typedef void (*st7701_async_done_cb_t)(void *user_ctx);
+
 static const uint8_t st7701_type1_init_operations[] = {
     BEGIN_WRITE,
     WRITE_COMMAND_8, 0xFF,
@@ -830,7 +841,7 @@ static const uint8_t st7701_type6_init_operations[] = {
 
     END_WRITE};
 
-class Arduino_ST7701_RGBPanel : public Arduino_GFX
+class Arduino_ST7701_RGBPanel : public Arduino_FramebufferGFX<Arduino_ST7701_RGBPanel>
 {
 public:
     Arduino_ST7701_RGBPanel(
@@ -843,20 +854,46 @@ public:
         uint16_t vsync_front_porch = 4, uint16_t vsync_pulse_width = 10, uint16_t vsync_back_porch = 16);
 
     void begin(int32_t speed = GFX_NOT_DEFINED) override;
-    void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
-    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
-    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void startWrite() override;
+    void endWrite() override;
     void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
-    void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
-    void draw16bitBeRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
+    // Unrotated or 180 degrees only, returns false in rotations 1 and 3
+    bool draw16bitRGBBitmapAsync(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h,
+                                 st7701_async_done_cb_t done_cb, void *user_ctx);
 
     void setRotation(uint8_t r) override;
     void invertDisplay(bool) override;
 
-    uint16_t *getFramebuffer();
+    // Copy what the panel shows into dst (WIDTH x HEIGHT pixels, panel
+    // layout): waits for async framebuffer copies still in flight, then
+    // reads the scanned-out buffer, see Arduino_ESP32RGBPanel::readFrameBuffer()
+    bool readFrame(uint16_t *dst, uint32_t timeout_ms = 50);
+
+    // Panel coordinates: the framebuffer keeps the panel's layout in every rotation
+    void flushFramebuffer(int16_t x, int16_t y, int16_t w, int16_t h);
+    void flushFramebuffer(uint16_t *fb, int16_t x, int16_t y, int16_t w, int16_t h);
+
+    // PIE kernels for the framebuffer drawing, see Arduino_FramebufferGFX
+    static void fillRow(uint16_t *dst, uint16_t color, int32_t n);
+    static void copyRow(uint16_t *dst, const uint16_t *src, int32_t n);
 
 protected:
-    uint16_t *_framebuffer;
+    friend class Arduino_FramebufferGFX<Arduino_ST7701_RGBPanel>;
+
+    void toPanel(int16_t &x1, int16_t &y1, int16_t &x2, int16_t &y2);
+    void addDirty(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+    void writeBackRect(uint16_t *fb, int16_t x, int16_t y, int16_t w, int16_t h);
+    void writeBackSpan(uint32_t addr, uint32_t len);
+    bool installAsyncMemcpy();
+    bool fillRowsDMA(int16_t y, int16_t h, uint16_t color);
+    static bool onAsyncCopyDone(async_memcpy_t mcp_hdl, async_memcpy_event_t *event, void *cb_args);
+    static bool onAsyncFillDone(async_memcpy_t mcp_hdl, async_memcpy_event_t *event, void *cb_args);
+
+    struct DirtyRect
+    {
+        int16_t x1, y1, x2, y2;
+    };
+
     Arduino_ESP32RGBPanel *_bus;
     int8_t _rst;
     bool _ips;
@@ -870,6 +907,17 @@ protected:
     uint16_t _vsync_pulse_width;
     uint16_t _vsync_back_porch;
 
+    DirtyRect _dirty[ST7701_MAX_DIRTY_RECTS];
+    uint8_t _dirtyCount = 0;
+    uint8_t _writeDepth = 0;
+
+    async_memcpy_t _asyncMemcpy = NULL;
+    st7701_async_done_cb_t _asyncDoneCb = NULL;
+    void *_asyncDoneCtx = NULL;
+    volatile bool _asyncBusy = false;
+    uint16_t *_fillPattern = NULL;
+    SemaphoreHandle_t _fillDone = NULL;
+
 private:
 };
 
@@ -0,0 +1,521 @@
+// Generated by scripts/u8g2_font_index.py from u8g2_font_unifont_t_chinese4.h - do not edit
+// 7103 unicode glyphs, see Arduino_GFX::setFont(const uint8_t *, const uint32_t *)
+#ifndef _U8G2_FONT_UNIFONT_T_CHINESE4_INDEX_H_
+#define _U8G2_FONT_UNIFONT_T_CHINESE4_INDEX_H_
+
+#ifdef U8G2_USE_LARGE_FONTS
+const uint32_t u8g2_font_unifont_t_chinese4_index[4080] PROGMEM = {
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612, 0x000612,
+    0x000612, 0x000798, 0x00097f, 0x000adf, 0x000c8c, 0x000e87, 0x0010a5, 0x0012eb,
+    0x001585, 0x0016fc, 0x0018f0, 0x001aec, 0x001cef, 0x001f2b, 0x002162, 0x00238e,
+    0x0025ec, 0x00284d, 0x002a92, 0x002cff, 0x002f6e, 0x0031f2, 0x003478, 0x003702,
+    0x00395a, 0x003a98, 0x003bb1, 0x003ce5, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9, 0x003ea9,
+    0x003ea9, 0x003fc4, 0x0041a3, 0x0042c0, 0x004412, 0x004551, 0x0046bf, 0x004746,
+    0x0047ef, 0x0048f5, 0x004a28, 0x004bb4, 0x004c28, 0x004ddd, 0x004f73, 0x00503f,
+    0x005183, 0x005248, 0x0053c6, 0x0054a0, 0x0055b7, 0x0056ac, 0x005868, 0x005939,
+    0x005a35, 0x005b59, 0x005bcf, 0x005d26, 0x005da3, 0x005ea1, 0x005fed, 0x0060f6,
+    0x0061c0, 0x0062f4, 0x006456, 0x0065e8, 0x00666c, 0x006776, 0x006803, 0x006833,
+    0x00697b, 0x0069f3, 0x006a9f, 0x006b93, 0x006c9b, 0x006cee, 0x006da6, 0x006e57,
+    0x006f0f, 0x006ff5, 0x0070d8, 0x007130, 0x0071e5, 0x0073a2, 0x0074b4, 0x0075f6,
+    0x0077ad, 0x0078a3, 0x0079a8, 0x007a8e, 0x007bd3, 0x007d1b, 0x007dd2, 0x007ea6,
+    0x00801a, 0x008135, 0x008286, 0x0083d9, 0x0084fa, 0x00867b, 0x008785, 0x008855,
+    0x00895e, 0x008a49, 0x008b0a, 0x008c5a, 0x008d2a, 0x008dfa, 0x008f7a, 0x009005,
+    0x0090f1, 0x0091db, 0x0092b6, 0x00936a, 0x00943d, 0x0095a4, 0x0096f7, 0x009853,
+    0x009a03, 0x009b0b, 0x009bd2, 0x009cb2, 0x009d21, 0x009e6d, 0x009faf, 0x00a191,
+    0x00a31e, 0x00a4c3, 0x00a63b, 0x00a7cc, 0x00a967, 0x00aa69, 0x00ab39, 0x00ab90,
+    0x00acfa, 0x00ae22, 0x00af31, 0x00b060, 0x00b138, 0x00b2d2, 0x00b358, 0x00b4ab,
+    0x00b52a, 0x00b5d3, 0x00b628, 0x00b73c, 0x00b819, 0x00b8e5, 0x00b9cf, 0x00baea,
+    0x00bbc6, 0x00bd19, 0x00be25, 0x00bebd, 0x00bfae, 0x00c05e, 0x00c13c, 0x00c288,
+    0x00c31f, 0x00c424, 0x00c504, 0x00c587, 0x00c706, 0x00c733, 0x00c7be, 0x00c95e,
+    0x00ca17, 0x00cb05, 0x00cb64, 0x00cc28, 0x00cce5, 0x00ce2d, 0x00ceb9, 0x00cf6b,
+    0x00d038, 0x00d0fe, 0x00d1b7, 0x00d272, 0x00d32c, 0x00d427, 0x00d543, 0x00d650,
+    0x00d6a4, 0x00d73f, 0x00d78c, 0x00d883, 0x00d883, 0x00d936, 0x00d98b, 0x00d9e1,
+    0x00da5c, 0x00daf1, 0x00db1d, 0x00dbc5, 0x00dc7c, 0x00dcd7, 0x00ddd2, 0x00de5a,
+    0x00deda, 0x00df87, 0x00e060, 0x00e0de, 0x00e135, 0x00e1bb, 0x00e2f7, 0x00e414,
+    0x00e4fa, 0x00e593, 0x00e6b7, 0x00e855, 0x00e95d, 0x00ea5e, 0x00eb92, 0x00eca3,
+    0x00eda6, 0x00ef30, 0x00f030, 0x00f12e, 0x00f1d5, 0x00f28d, 0x00f3e3, 0x00f4ed,
+    0x00f545, 0x00f61c, 0x00f72f, 0x00f7eb, 0x00f86e, 0x00f950, 0x00f97f, 0x00fa05,
+    0x00fab4, 0x00fab4, 0x00fb3c, 0x00fb3c, 0x00fc2a, 0x00fce9, 0x00fd75, 0x00fe3a,
+    0x00fe9b, 0x00ff2c, 0x00ff61, 0x00ffc6, 0x01004c, 0x01007c, 0x010224, 0x0102e4,
+    0x01043b, 0x010573, 0x010698, 0x01080b, 0x010980, 0x010a62, 0x010b48, 0x010d00,
+    0x010e2d, 0x010fe8, 0x0110b7, 0x01112e, 0x0112c2, 0x011487, 0x011542, 0x011660,
+    0x0116d5, 0x011740, 0x011827, 0x0118c2, 0x011957, 0x011957, 0x011983, 0x011a5c,
+    0x011b07, 0x011ba2, 0x011c65, 0x011cea, 0x011cea, 0x011d15, 0x011d40, 0x011d64,
+    0x011d64, 0x011db9, 0x011de7, 0x011de7, 0x011e6c, 0x011eca, 0x011fa1, 0x0120d9,
+    0x0121c1, 0x0122c8, 0x012415, 0x0124e6, 0x0125b3, 0x012631, 0x01270d, 0x012793,
+    0x01292f, 0x0129fa, 0x012bce, 0x012c98, 0x012d60, 0x012e3d, 0x012f22, 0x012fd8,
+    0x0130aa, 0x0131d8, 0x013300, 0x013423, 0x01352b, 0x0135d3, 0x0136bb, 0x013807,
+    0x013928, 0x013aa6, 0x013bd8, 0x013cef, 0x013dae, 0x013e74, 0x013f38, 0x013fba,
+    0x014060, 0x014106, 0x0141fc, 0x01431d, 0x01436e, 0x014417, 0x0144b7, 0x014699,
+    0x01476b, 0x014845, 0x0148f1, 0x0149f3, 0x014b51, 0x014c0b, 0x014d10, 0x014e9f,
+    0x01500a, 0x015113, 0x0151e9, 0x015279, 0x015302, 0x01543f, 0x015521, 0x01562f,
+    0x015714, 0x0157c7, 0x015883, 0x01599d, 0x015a28, 0x015b47, 0x015b76, 0x015bd0,
+    0x015d8c, 0x015eb5, 0x01602e, 0x0160df, 0x01622e, 0x01635e, 0x016445, 0x01659a,
+    0x0166ca, 0x01676d, 0x0168e3, 0x016a4a, 0x016b40, 0x016d15, 0x016f08, 0x0170ec,
+    0x017235, 0x017334, 0x0173df, 0x017574, 0x0175f1, 0x017744, 0x0177eb, 0x017955,
+    0x017a5e, 0x017bc0, 0x017cb9, 0x017e5b, 0x017ef0, 0x017fca, 0x0180a8, 0x0181ba,
+    0x018217, 0x018327, 0x018428, 0x0184be, 0x01856f, 0x018636, 0x018726, 0x0187a5,
+    0x01881f, 0x018882, 0x0189c5, 0x018b08, 0x018c21, 0x018db1, 0x018e65, 0x018ef4,
+    0x019050, 0x0190e0, 0x0191d9, 0x0192ea, 0x0193c1, 0x01947a, 0x0195e5, 0x019698,
+    0x0197aa, 0x019882, 0x019980, 0x019afa, 0x019bcd, 0x019cd4, 0x019d35, 0x019e76,
+    0x019f0b, 0x019fe7, 0x01a049, 0x01a12b, 0x01a175, 0x01a263, 0x01a343, 0x01a40b,
+    0x01a4e0, 0x01a592, 0x01a611, 0x01a6b9, 0x01a714, 0x01a769, 0x01a7f1, 0x01a855,
+    0x01a9be, 0x01aab1, 0x01abb4, 0x01ad1f, 0x01ade6, 0x01aef5, 0x01afef, 0x01b0dd,
+    0x01b1f2, 0x01b2c9, 0x01b3bd, 0x01b496, 0x01b50b, 0x01b55f, 0x01b68f, 0x01b75b,
+    0x01b834, 0x01b90f, 0x01b9c1, 0x01ba47, 0x01bb1a, 0x01bc37, 0x01bce2, 0x01bdc1,
+    0x01be16, 0x01bec8, 0x01bf9f, 0x01c09e, 0x01c152, 0x01c21b, 0x01c325, 0x01c3d3,
+    0x01c4b1, 0x01c52f, 0x01c55d, 0x01c595, 0x01c5f1, 0x01c619, 0x01c6cf, 0x01c77c,
+    0x01c82f, 0x01c8c6, 0x01c982, 0x01ca36, 0x01cab7, 0x01cb70, 0x01cbf9, 0x01cc2a,
+    0x01cc7f, 0x01cd32, 0x01cde3, 0x01ce63, 0x01cf76, 0x01d005, 0x01d091, 0x01d118,
+    0x01d14b, 0x01d1a9, 0x01d231, 0x01d28f, 0x01d31a, 0x01d377, 0x01d43c, 0x01d472,
+    0x01d4a6, 0x01d50c, 0x01d53e, 0x01d608, 0x01d6b7, 0x01d741, 0x01d7cc, 0x01d90c,
+    0x01da2d, 0x01db06, 0x01db61, 0x01dbe5, 0x01dd1f, 0x01de35, 0x01df53, 0x01dfcc,
+    0x01dffe, 0x01e027, 0x01e144, 0x01e2ad, 0x01e349, 0x01e406, 0x01e535, 0x01e603,
+    0x01e6fa, 0x01e7ec, 0x01e8da, 0x01e9f6, 0x01eb6f, 0x01ec68, 0x01ed2c, 0x01ee21,
+    0x01ef3f, 0x01efc1, 0x01f06f, 0x01f0c1, 0x01f1e6, 0x01f344, 0x01f3f7, 0x01f4c5,
+    0x01f543, 0x01f639, 0x01f6e2, 0x01f877, 0x01f923, 0x01fa45, 0x01fb47, 0x01fc46,
+    0x01fd75, 0x01fdcc, 0x01ff09, 0x0200ba, 0x020195, 0x02021b, 0x0202cc, 0x020345,
+    0x02039c, 0x02042f, 0x020502, 0x0205d9, 0x02065a, 0x020766, 0x020838, 0x02097e,
+    0x020a31, 0x020ad7, 0x020b55, 0x020cb4, 0x020dc7, 0x020df6, 0x020ee3, 0x020f99,
+    0x021048, 0x021125, 0x021187, 0x021203, 0x02128d, 0x02134f, 0x021403, 0x021507,
+    0x02159a, 0x02164e, 0x02175d, 0x02178e, 0x0217ef, 0x02181d, 0x02187f, 0x021955,
+    0x021a89, 0x021b09, 0x021b85, 0x021c62, 0x021d37, 0x021e07, 0x021ebd, 0x021f9e,
+    0x021fed, 0x02203e, 0x0220c2, 0x022107, 0x02215d, 0x0221e2, 0x02226b, 0x0223a0,
+    0x0223d2, 0x022451, 0x0224da, 0x022535, 0x0225b7, 0x022699, 0x0227a8, 0x0228c5,
+    0x022928, 0x02298a, 0x0229ea, 0x022a89, 0x022c2d, 0x022cdb, 0x022dfc, 0x022efd,
+    0x023002, 0x023083, 0x023105, 0x0231b5, 0x02320c, 0x0232db, 0x023391, 0x023492,
+    0x0235c7, 0x0235f5, 0x0236ca, 0x0237d1, 0x0238c0, 0x02394d, 0x0239a8, 0x0239d9,
+    0x023b28, 0x023be4, 0x023c5d, 0x023cf1, 0x023dc0, 0x023e3d, 0x023e3d, 0x023ec5,
+    0x023eeb, 0x023ff1, 0x02401e, 0x024090, 0x0241af, 0x0241da, 0x02430a, 0x0243e9,
+    0x024413, 0x02446c, 0x024494, 0x024548, 0x024592, 0x0245f2, 0x024610, 0x0246fc,
+    0x024758, 0x0247b4, 0x024873, 0x024997, 0x024ab6, 0x024b27, 0x024be7, 0x024ca5,
+    0x024d40, 0x024e15, 0x024f0c, 0x024fdb, 0x0250f7, 0x025176, 0x025297, 0x025318,
+    0x025433, 0x02550f, 0x02555f, 0x0256c6, 0x025755, 0x0257d1, 0x02585c, 0x025975,
+    0x025a95, 0x025b82, 0x025c07, 0x025c2d, 0x025d1a, 0x025e4c, 0x02600e, 0x026147,
+    0x026238, 0x0262a7, 0x0262cb, 0x02637b, 0x026480, 0x026503, 0x0265b5, 0x02670e,
+    0x026794, 0x026881, 0x026940, 0x026a7f, 0x026b6f, 0x026ba1, 0x026c8a, 0x026dd9,
+    0x026e81, 0x026f3a, 0x026fec, 0x02706f, 0x027150, 0x0271d1, 0x02722d, 0x0272d5,
+    0x02730f, 0x0273b8, 0x02746b, 0x0274bf, 0x0275d4, 0x027682, 0x02770b, 0x027791,
+    0x027825, 0x027883, 0x0278b3, 0x027969, 0x0279d2, 0x027ad2, 0x027c15, 0x027cb2,
+    0x027d66, 0x027e91, 0x027e91, 0x027f4a, 0x028031, 0x028150, 0x0281ef, 0x0282ed,
+    0x028397, 0x02849f, 0x028546, 0x0285a2, 0x0286da, 0x0287bd, 0x0287eb, 0x0288a4,
+    0x028975, 0x028a3e, 0x028ba8, 0x028c9a, 0x028cf1, 0x028dc0, 0x028e59, 0x028f1f,
+    0x028fde, 0x02902c, 0x0290f0, 0x029191, 0x0291c0, 0x02928f, 0x0293ad, 0x0293d9,
+    0x029489, 0x029511, 0x0295b7, 0x029661, 0x0296b5, 0x0297b6, 0x02983e, 0x0298ef,
+    0x029975, 0x0299c6, 0x029a16, 0x029aeb, 0x029bc5, 0x029c47, 0x029ca0, 0x029d60,
+    0x029e0b, 0x029e38, 0x029ee1, 0x029f8b, 0x02a093, 0x02a0c4, 0x02a1d1, 0x02a28f,
+    0x02a307, 0x02a48a, 0x02a5e6, 0x02a706, 0x02a7ba, 0x02a897, 0x02a91a, 0x02aa04,
+    0x02aa8b, 0x02aaee, 0x02aba0, 0x02ac34, 0x02ae33, 0x02ae88, 0x02af71, 0x02b084,
+    0x02b0e3, 0x02b139, 0x02b198, 0x02b225, 0x02b312, 0x02b3d7, 0x02b492, 0x02b573,
+    0x02b5fc, 0x02b683, 0x02b721, 0x02b8aa, 0x02ba67, 0x02bc1a, 0x02be15, 0x02bf1d,
+    0x02c0c5, 0x02c1c2, 0x02c30b, 0x02c3d1, 0x02c4d6, 0x02c52f, 0x02c639, 0x02c6d1,
+    0x02c797, 0x02c887, 0x02c903, 0x02c9d7, 0x02cacb, 0x02cb78, 0x02cc4b, 0x02ccd0,
+    0x02cdd8, 0x02cee3, 0x02d00d, 0x02d00d, 0x02d0f8, 0x02d1e8, 0x02d2ba, 0x02d31c,
+    0x02d4a2, 0x02d5f4, 0x02d6cf, 0x02d870, 0x02d965, 0x02da85, 0x02db5e, 0x02dc3f,
+    0x02dd96, 0x02ded8, 0x02dfc8, 0x02e075, 0x02e128, 0x02e1e4, 0x02e2a9, 0x02e35d,
+    0x02e526, 0x02e5e0, 0x02e69b, 0x02e730, 0x02e823, 0x02e9a4, 0x02ea41, 0x02eb4a,
+    0x02ec32, 0x02edb9, 0x02eee5, 0x02efd2, 0x02f0e4, 0x02f110, 0x02f170, 0x02f1ea,
+    0x02f2d8, 0x02f344, 0x02f3f6, 0x02f4aa, 0x02f565, 0x02f5e1, 0x02f725, 0x02f7af,
+    0x02f7f4, 0x02f8fb, 0x02f921, 0x02f995, 0x02faa0, 0x02fb6b, 0x02fbe0, 0x02fccf,
+    0x02fd75, 0x02fdea, 0x02fe9c, 0x02ff0c, 0x02fffc, 0x0300be, 0x0300e1, 0x030150,
+    0x030242, 0x030349, 0x030371, 0x03043d, 0x0304f7, 0x03051b, 0x03056a, 0x030654,
+    0x0306c8, 0x030718, 0x0307b9, 0x0307b9, 0x030856, 0x030918, 0x03096a, 0x0309b9,
+    0x0309e3, 0x0309e3, 0x030aaa, 0x030b7a, 0x030bd2, 0x030c6b, 0x030c91, 0x030d32,
+    0x030d85, 0x030dd6, 0x030e70, 0x030eec, 0x030f14, 0x030f98, 0x03101a, 0x0310c5,
+    0x03114a, 0x0311f8, 0x031277, 0x0312a5, 0x031306, 0x031357, 0x0314cd, 0x03151d,
+    0x0315c4, 0x0316a5, 0x0316f5, 0x0317ca, 0x031856, 0x03192a, 0x0319de, 0x031a61,
+    0x031af0, 0x031bc0, 0x031cd7, 0x031d60, 0x031dec, 0x031eaa, 0x031f38, 0x031fc8,
+    0x03205b, 0x0320f3, 0x032150, 0x0321a7, 0x032235, 0x0322ec, 0x03234c, 0x0323ac,
+    0x032430, 0x03248f, 0x03251a, 0x0325a6, 0x03265e, 0x032705, 0x032811, 0x032939,
+    0x032987, 0x032a85, 0x032b2e, 0x032b88, 0x032bb7, 0x032c5f, 0x032d88, 0x032e10,
+    0x032edc, 0x032f32, 0x032feb, 0x033077, 0x033137, 0x033160, 0x0331b7, 0x03327c,
+    0x0332cf, 0x03338e, 0x0333e5, 0x033477, 0x0334fe, 0x03364e, 0x033672, 0x0336ce,
+    0x033736, 0x03383f, 0x0339bc, 0x033a64, 0x033b2b, 0x033b83, 0x033c54, 0x033dde,
+    0x033ed3, 0x033fc7, 0x0340a2, 0x03420c, 0x0342bf, 0x0343c3, 0x034449, 0x03452e,
+    0x03460a, 0x03471e, 0x0347da, 0x034860, 0x03488c, 0x034952, 0x0349dd, 0x034a5a,
+    0x034b0a, 0x034b60, 0x034c1f, 0x034d8b, 0x034f60, 0x0350ba, 0x0351c9, 0x035322,
+    0x0354d6, 0x035664, 0x035713, 0x035856, 0x03590d, 0x0359fe, 0x035a9d, 0x035b6f,
+    0x035bc1, 0x035ca2, 0x035d10, 0x035e88, 0x03601c, 0x036189, 0x036263, 0x0363c6,
+    0x036478, 0x036557, 0x03667f, 0x036905, 0x036b0b, 0x036c6b, 0x036dc2, 0x036f5c,
+    0x03705b, 0x03710f, 0x037199, 0x0371f6, 0x037278, 0x03735f, 0x037455, 0x037540,
+    0x03762b, 0x037689, 0x037718, 0x0377cc, 0x037892, 0x0379aa, 0x0379d4, 0x037ad2,
+    0x037b95, 0x037d0b, 0x037d41, 0x037e2d, 0x037e8e, 0x037f58, 0x03800b, 0x03800b,
+    0x0380bf, 0x03814d, 0x0382c7, 0x038374, 0x038428, 0x038548, 0x0385a6, 0x038703,
+    0x0387e3, 0x0388d3, 0x038a92, 0x038c0b, 0x038cf0, 0x038e26, 0x038fb6, 0x0390b9,
+    0x0391bc, 0x039366, 0x039560, 0x039602, 0x039732, 0x039895, 0x039a42, 0x039b79,
+    0x039d09, 0x039e48, 0x039edf, 0x039fb4, 0x03a064, 0x03a0e8, 0x03a115, 0x03a193,
+    0x03a1ef, 0x03a258, 0x03a2b8, 0x03a315, 0x03a39f, 0x03a46f, 0x03a4f6, 0x03a5e1,
+    0x03a6d8, 0x03a79a, 0x03a829, 0x03a8bf, 0x03a8ee, 0x03aa88, 0x03ab7e, 0x03abfb,
+    0x03ac29, 0x03ac84, 0x03ad34, 0x03ad67, 0x03ae40, 0x03ae9c, 0x03af1a, 0x03af47,
+    0x03afca, 0x03b024, 0x03b0d7, 0x03b109, 0x03b1cb, 0x03b226, 0x03b256, 0x03b2bf,
+    0x03b31d, 0x03b34a, 0x03b3d3, 0x03b4e5, 0x03b547, 0x03b5d6, 0x03b606, 0x03b665,
+    0x03b6f4, 0x03b751, 0x03b7b0, 0x03b809, 0x03b83c, 0x03b8ca, 0x03ba09, 0x03ba91,
+    0x03babe, 0x03baea, 0x03bb19, 0x03bb4e, 0x03bc3e, 0x03bc69, 0x03bcc9, 0x03bd2b,
+    0x03be43, 0x03be9d, 0x03bf74, 0x03c0ae, 0x03c161, 0x03c1ed, 0x03c2ac, 0x03c2d9,
+    0x03c3bb, 0x03c50c, 0x03c595, 0x03c6db, 0x03c769, 0x03c7c9, 0x03c858, 0x03c858,
+    0x03c902, 0x03c9e6, 0x03cab1, 0x03cbd4, 0x03cc29, 0x03cd00, 0x03cdb4, 0x03ceca,
+    0x03d01f, 0x03d0c4, 0x03d166, 0x03d1e5, 0x03d340, 0x03d4a1, 0x03d558, 0x03d68d,
+    0x03d81e, 0x03d96a, 0x03dab4, 0x03db50, 0x03dc64, 0x03de48, 0x03df6f, 0x03e044,
+    0x03e149, 0x03e26a, 0x03e32d, 0x03e381, 0x03e457, 0x03e4d6, 0x03e5da, 0x03e6cb,
+    0x03e755, 0x03e805, 0x03e82f, 0x03e8f0, 0x03e8f0, 0x03e9d1, 0x03ea28, 0x03eaa7,
+    0x03eb83, 0x03ecbc, 0x03edbe, 0x03ee43, 0x03ef24, 0x03f007, 0x03f0c2, 0x03f151,
+    0x03f33d, 0x03f4bc, 0x03f608, 0x03f6c5, 0x03f7b0, 0x03f80e, 0x03f8ae, 0x03f9c5,
+    0x03faad, 0x03fb8c, 0x03fc9d, 0x03fcfc, 0x03fdc9, 0x03fdfb, 0x03fec5, 0x03ff51,
+    0x0400bf, 0x0401fd, 0x040274, 0x040347, 0x0403d8, 0x040405, 0x040575, 0x0405d8,
+    0x040639, 0x040698, 0x0406f6, 0x040720, 0x0407b2, 0x040833, 0x04091e, 0x040a24,
+    0x040bbf, 0x040ccc, 0x040d62, 0x040e0e, 0x040ec7, 0x040ef5, 0x040fae, 0x04104d,
+    0x041074, 0x0410fa, 0x04114e, 0x0411f5, 0x04126a, 0x041354, 0x0413d1, 0x0413f7,
+    0x041424, 0x041424, 0x041458, 0x0414dd, 0x0414dd, 0x041531, 0x041531, 0x04158a,
+    0x0415be, 0x0415ef, 0x04161d, 0x04167c, 0x041708, 0x041733, 0x0417c6, 0x0417c6,
+    0x04183e, 0x041896, 0x0418c5, 0x041952, 0x041983, 0x0419e5, 0x041a42, 0x041a95,
+    0x041b1a, 0x041b78, 0x041bff, 0x041c8a, 0x041ceb, 0x041ceb, 0x041d4e, 0x041e0e,
+    0x041e43, 0x041e73, 0x041e73, 0x041e9e, 0x041ed1, 0x041f00, 0x041f5c, 0x041f89,
+    0x041fe5, 0x041fe5, 0x042063, 0x042177, 0x042235, 0x042325, 0x042325, 0x042387,
+    0x04246e, 0x0424c1, 0x0425a1, 0x042616, 0x0426f7, 0x0427b6, 0x0428f6, 0x04297a,
+    0x0429de, 0x042a3e, 0x042abd, 0x042b1a, 0x042b9c, 0x042bf1, 0x042ca5, 0x042d9a,
+    0x042e24, 0x042e86, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c, 0x042f5c,
+    0x042f5c, 0x0431e8, 0x0434cd, 0x04378f, 0x043a49, 0x043d06, 0x043fb4, 0x044240,
+    0x0444dd, 0x044790, 0x044a49, 0x044cf4, 0x044fb4, 0x04527d, 0x04552b, 0x0457c9,
+    0x045a8b, 0x045d3e, 0x045feb, 0x0462d2, 0x046564, 0x0467f5, 0x046a80, 0x046d36,
+    0x046fd5, 0x0472ce, 0x047591, 0x04783e, 0x047b1b, 0x047e41, 0x048122, 0x0483be,
+    0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668,
+    0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668,
+    0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668,
+    0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668,
+    0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668,
+    0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668,
+    0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668,
+    0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668, 0x048668,
+    0x048668, 0x0487b2, 0x04890e, 0x048ac7, 0x048c46, 0x048d41, 0x048e2e, 0x048e42,
+    0x048e42, 0x048e42, 0x048e42, 0x048e42, 0x048e42, 0x048e42, 0x048e42, 0x048e42,
+};
+#endif /* U8G2_USE_LARGE_FONTS */
+
+#endif // _U8G2_FONT_UNIFONT_T_CHINESE4_INDEX_H_
@@ -0,0 +1,521 @@
+// Generated by scripts/u8g2_font_index.py from u8g2_font_unifont_t_chinese.h - do not edit
+// 22049 unicode glyphs, see Arduino_GFX::setFont(const uint8_t *, const uint32_t *)
+#ifndef _U8G2_FONT_UNIFONT_T_CHINESE_INDEX_H_
+#define _U8G2_FONT_UNIFONT_T_CHINESE_INDEX_H_
+
+#ifdef U8G2_USE_LARGE_FONTS
+const uint32_t u8g2_font_unifont_t_chinese_index[4080] PROGMEM = {
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862, 0x000862,
+    0x000862, 0x0009e8, 0x000bcf, 0x000d2f, 0x000edc, 0x0010d7, 0x0012f5, 0x00153b,
+    0x0017d5, 0x00194c, 0x001b40, 0x001d3c, 0x001f3f, 0x00217b, 0x0023b2, 0x0025de,
+    0x00283c, 0x002a9d, 0x002ce2, 0x002f4f, 0x0031be, 0x003442, 0x0036c8, 0x003952,
+    0x003baa, 0x003ce8, 0x003e01, 0x003f35, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9, 0x0040f9,
+    0x0040f9, 0x0042cf, 0x0044f1, 0x0046f8, 0x004920, 0x004b38, 0x004d65, 0x004fb6,
+    0x005259, 0x005476, 0x00567b, 0x005888, 0x005aea, 0x005d65, 0x005fd9, 0x00626b,
+    0x0064f8, 0x006794, 0x006a33, 0x006cf4, 0x006f89, 0x00723f, 0x0074c5, 0x00776f,
+    0x007a19, 0x007cc4, 0x007f74, 0x00821e, 0x0084d7, 0x00878a, 0x008a24, 0x008cea,
+    0x008fad, 0x009281, 0x009542, 0x00980d, 0x009acb, 0x009d9f, 0x00a08d, 0x00a373,
+    0x00a65e, 0x00a92f, 0x00ac0a, 0x00af09, 0x00b1d7, 0x00b4a7, 0x00b792, 0x00ba73,
+    0x00bd71, 0x00c070, 0x00c350, 0x00c666, 0x00c96b, 0x00cbc2, 0x00ce5e, 0x00d0cd,
+    0x00d321, 0x00d555, 0x00d782, 0x00d9c5, 0x00dc54, 0x00def6, 0x00e1b6, 0x00e451,
+    0x00e6ae, 0x00e8f5, 0x00eb88, 0x00ee3a, 0x00f0ef, 0x00f39f, 0x00f66d, 0x00f929,
+    0x00fbf7, 0x00ff05, 0x0101f2, 0x010499, 0x010739, 0x0109fd, 0x010cc7, 0x010fce,
+    0x011281, 0x0114f7, 0x011767, 0x0119cd, 0x011c23, 0x011e67, 0x0120a4, 0x0122e2,
+    0x01259a, 0x012819, 0x012ab8, 0x012d7f, 0x013004, 0x01326d, 0x0134fb, 0x01372d,
+    0x013971, 0x013ba8, 0x013e11, 0x0140a1, 0x014330, 0x0145a1, 0x014848, 0x014b01,
+    0x014d90, 0x015038, 0x0152f8, 0x015586, 0x01583b, 0x015aeb, 0x015da6, 0x016055,
+    0x01630b, 0x0165bc, 0x016877, 0x016b48, 0x016e20, 0x0170d2, 0x0173ac, 0x01768e,
+    0x017976, 0x017c31, 0x017f1b, 0x0181d3, 0x018499, 0x018779, 0x018a5f, 0x018d42,
+    0x019041, 0x019332, 0x01961a, 0x01990b, 0x019bf0, 0x019ef2, 0x01a1dd, 0x01a4d5,
+    0x01a7c2, 0x01aaab, 0x01ad96, 0x01b0af, 0x01b3bd, 0x01b6bb, 0x01b931, 0x01bb5c,
+    0x01bd89, 0x01bfeb, 0x01c266, 0x01c4d3, 0x01c76e, 0x01c9ff, 0x01cc74, 0x01cf04,
+    0x01d1b1, 0x01d460, 0x01d6f2, 0x01d98a, 0x01dc3f, 0x01dee1, 0x01e195, 0x01e460,
+    0x01e6ff, 0x01e99f, 0x01ec60, 0x01ef36, 0x01f205, 0x01f4b8, 0x01f77a, 0x01fa47,
+    0x01fd18, 0x01fff1, 0x0202c2, 0x020598, 0x020875, 0x020b49, 0x020e2a, 0x0210f3,
+    0x02136b, 0x0215ce, 0x021878, 0x021ae4, 0x021d54, 0x021fbb, 0x02223a, 0x0224d8,
+    0x022784, 0x022a3f, 0x022ce7, 0x022fbb, 0x02326d, 0x023540, 0x02380d, 0x023ae0,
+    0x023dbd, 0x02409b, 0x024379, 0x024662, 0x024950, 0x024c42, 0x024f33, 0x02522e,
+    0x02552e, 0x02582d, 0x025b20, 0x025e2e, 0x026125, 0x026425, 0x02672b, 0x026a31,
+    0x026d42, 0x027052, 0x027366, 0x02766d, 0x02798c, 0x027cd9, 0x027f0b, 0x02818b,
+    0x028445, 0x028672, 0x0288ba, 0x028b23, 0x028d8e, 0x029009, 0x029286, 0x029513,
+    0x02979a, 0x029a2a, 0x029c79, 0x029f40, 0x02a1f8, 0x02a45d, 0x02a6dc, 0x02a996,
+    0x02abe1, 0x02ae66, 0x02b0da, 0x02b357, 0x02b5d9, 0x02b857, 0x02bae6, 0x02bdb4,
+    0x02c069, 0x02c305, 0x02c5a7, 0x02c846, 0x02cb0c, 0x02cdd5, 0x02d06f, 0x02d326,
+    0x02d5f7, 0x02d8d6, 0x02dbb8, 0x02de81, 0x02e164, 0x02e475, 0x02e71d, 0x02e964,
+    0x02ebc4, 0x02ee25, 0x02f08b, 0x02f318, 0x02f5f4, 0x02f8b6, 0x02fb89, 0x02fe68,
+    0x0300dc, 0x03036c, 0x030619, 0x0308bb, 0x030b5d, 0x030e3b, 0x031119, 0x03140b,
+    0x0316c7, 0x031921, 0x031b7f, 0x031e37, 0x0320f5, 0x0323c9, 0x032627, 0x0328be,
+    0x032b5b, 0x032e0f, 0x0330da, 0x0333b4, 0x0336be, 0x033942, 0x033bce, 0x033e7a,
+    0x03412c, 0x0343ee, 0x03469d, 0x034956, 0x034c1b, 0x034ed4, 0x035196, 0x03545b,
+    0x035718, 0x0359e2, 0x035ca2, 0x035f5f, 0x03622d, 0x036505, 0x0367db, 0x036aa3,
+    0x036d88, 0x037057, 0x037328, 0x03761e, 0x0378f0, 0x037bcc, 0x037eb2, 0x03819d,
+    0x03849a, 0x038790, 0x038a76, 0x038d63, 0x03907a, 0x03937b, 0x039688, 0x0399a4,
+    0x039cc1, 0x039fa9, 0x03a253, 0x03a54e, 0x03a7e4, 0x03aa5b, 0x03acd7, 0x03af81,
+    0x03b245, 0x03b4ea, 0x03b78e, 0x03ba61, 0x03bd12, 0x03bfc1, 0x03c245, 0x03c518,
+    0x03c7be, 0x03ca79, 0x03cd3a, 0x03d00b, 0x03d2c5, 0x03d57d, 0x03d838, 0x03db20,
+    0x03ddf2, 0x03e0d4, 0x03e399, 0x03e663, 0x03e94c, 0x03ec26, 0x03ef03, 0x03f1e7,
+    0x03f4d2, 0x03f7ba, 0x03fa98, 0x03fd8d, 0x040077, 0x04037d, 0x040674, 0x04096c,
+    0x040c46, 0x040f37, 0x04122b, 0x041521, 0x041817, 0x041afe, 0x041dff, 0x0420f3,
+    0x042416, 0x04272e, 0x042a55, 0x042d61, 0x043019, 0x0432f4, 0x0435e1, 0x0438d1,
+    0x043bc7, 0x043e7b, 0x044148, 0x044415, 0x0446f2, 0x0449b8, 0x044cdc, 0x044f30,
+    0x04517d, 0x0453e7, 0x045663, 0x0458d7, 0x045b67, 0x045def, 0x04609f, 0x04635b,
+    0x046618, 0x0468f4, 0x046bc2, 0x046e92, 0x047176, 0x047438, 0x047725, 0x047a35,
+    0x047c70, 0x047f3a, 0x048218, 0x0484d2, 0x048751, 0x0489dc, 0x048c7e, 0x048f0f,
+    0x0491a7, 0x049455, 0x0496fa, 0x0499a8, 0x049c4d, 0x049f11, 0x04a197, 0x04a451,
+    0x04a704, 0x04a9c5, 0x04ac84, 0x04af53, 0x04b20f, 0x04b4b6, 0x04b765, 0x04ba2f,
+    0x04bcfa, 0x04bfcc, 0x04c2a2, 0x04c55d, 0x04c830, 0x04cae0, 0x04cdae, 0x04d09b,
+    0x04d360, 0x04d618, 0x04d8f0, 0x04dbe6, 0x04ded2, 0x04e1b6, 0x04e4a2, 0x04e783,
+    0x04ea52, 0x04ed54, 0x04f042, 0x04f32a, 0x04f608, 0x04f8e3, 0x04fbc0, 0x04feab,
+    0x05019e, 0x0504a8, 0x050789, 0x050a77, 0x050d5c, 0x051053, 0x05133f, 0x051632,
+    0x05194d, 0x051c4c, 0x051f46, 0x052247, 0x052542, 0x052856, 0x052b60, 0x052e7f,
+    0x0531a0, 0x0534d1, 0x0537e5, 0x053aa5, 0x053d83, 0x054076, 0x054373, 0x054601,
+    0x0548aa, 0x054b61, 0x054e3a, 0x055128, 0x0553fc, 0x0556a1, 0x055925, 0x055bc2,
+    0x055e9b, 0x05616f, 0x0563fa, 0x056684, 0x0568ed, 0x056b7b, 0x056dec, 0x05708d,
+    0x057329, 0x0575c3, 0x05783f, 0x057aec, 0x057d83, 0x058036, 0x0582d0, 0x058569,
+    0x058804, 0x058abe, 0x058d72, 0x05901f, 0x0592b5, 0x059578, 0x059838, 0x059acb,
+    0x059d8b, 0x05a029, 0x05a2d3, 0x05a590, 0x05a851, 0x05aafb, 0x05adbd, 0x05b06e,
+    0x05b328, 0x05b5e2, 0x05b8a3, 0x05bb4b, 0x05be04, 0x05c0be, 0x05c38f, 0x05c64f,
+    0x05c913, 0x05cbeb, 0x05cea1, 0x05d171, 0x05d42e, 0x05d6f7, 0x05d9bc, 0x05dca2,
+    0x05df8b, 0x05e258, 0x05e52d, 0x05e802, 0x05eae1, 0x05edc1, 0x05f0a1, 0x05f36a,
+    0x05f640, 0x05f91e, 0x05fbfd, 0x05fece, 0x0601c3, 0x0604c2, 0x060795, 0x060a65,
+    0x060d5b, 0x06105a, 0x061357, 0x06165e, 0x061960, 0x061c85, 0x061f9f, 0x062273,
+    0x0624f8, 0x0627b0, 0x062a60, 0x062d34, 0x062ff1, 0x0632af, 0x06358a, 0x063860,
+    0x063b42, 0x063dfb, 0x0640e5, 0x0643bf, 0x0646ab, 0x06499c, 0x064c7d, 0x064f59,
+    0x065275, 0x065559, 0x06584b, 0x065b47, 0x065e46, 0x066143, 0x06643c, 0x066743,
+    0x066a54, 0x066d78, 0x0670ab, 0x067395, 0x067601, 0x0678f5, 0x067b97, 0x067e66,
+    0x068134, 0x068410, 0x068709, 0x0689eb, 0x068caa, 0x068f54, 0x06923c, 0x06950d,
+    0x0697e1, 0x069aa9, 0x069d7d, 0x06a062, 0x06a35c, 0x06a64e, 0x06a943, 0x06ac4b,
+    0x06af4f, 0x06b1f1, 0x06b47f, 0x06b708, 0x06b99e, 0x06bc30, 0x06befc, 0x06c1af,
+    0x06c461, 0x06c716, 0x06c9ca, 0x06cc60, 0x06cf0c, 0x06d1c8, 0x06d481, 0x06d740,
+    0x06da0b, 0x06dcdc, 0x06df9e, 0x06e276, 0x06e543, 0x06e839, 0x06eb33, 0x06ee19,
+    0x06f0f7, 0x06f3d6, 0x06f6a7, 0x06f90d, 0x06fb1b, 0x06fdae, 0x070020, 0x07029e,
+    0x07052c, 0x0707ec, 0x070a78, 0x070d2d, 0x070fc4, 0x071281, 0x07152b, 0x0717e8,
+    0x071aa4, 0x071d6a, 0x07201f, 0x0722f6, 0x0725df, 0x0728d0, 0x072bdb, 0x072eda,
+    0x073172, 0x0733fc, 0x0736d0, 0x0739cf, 0x073ce2, 0x073f4f, 0x0741dc, 0x074474,
+    0x0746f8, 0x074996, 0x074c37, 0x074ef8, 0x0751b1, 0x07547d, 0x075759, 0x075a26,
+    0x075d06, 0x076001, 0x076306, 0x076607, 0x076900, 0x076c22, 0x076f24, 0x0771d7,
+    0x077481, 0x077741, 0x077a0c, 0x077cda, 0x077f9f, 0x07826f, 0x078550, 0x078813,
+    0x078b08, 0x078de0, 0x0790b0, 0x07939f, 0x079688, 0x07996f, 0x079c6b, 0x079f62,
+    0x07a25c, 0x07a56b, 0x07a86a, 0x07ab69, 0x07ae48, 0x07b0f1, 0x07b38e, 0x07b647,
+    0x07b919, 0x07bbeb, 0x07bed8, 0x07c1d8, 0x07c47c, 0x07c70f, 0x07c9b9, 0x07cc73,
+    0x07cf37, 0x07d1ed, 0x07d4b6, 0x07d799, 0x07da6c, 0x07dd53, 0x07e035, 0x07e33a,
+    0x07e5bc, 0x07e83e, 0x07ead7, 0x07ed81, 0x07f043, 0x07f2e2, 0x07f575, 0x07f817,
+    0x07fad6, 0x07fd59, 0x07ffe5, 0x080283, 0x080524, 0x0807cb, 0x080a69, 0x080d0e,
+    0x080fae, 0x08126f, 0x08150e, 0x0817b4, 0x081a77, 0x081d2d, 0x081fee, 0x0822bc,
+    0x082587, 0x082853, 0x082b23, 0x082dee, 0x0830d2, 0x0833b4, 0x08369b, 0x08399b,
+    0x083c5c, 0x083f20, 0x0841db, 0x0844a0, 0x084777, 0x084a70, 0x084d61, 0x08506e,
+    0x08532f, 0x0855e3, 0x0858a2, 0x085b5c, 0x085e1f, 0x0860ea, 0x0863bc, 0x0866a3,
+    0x08696b, 0x086c4f, 0x086f21, 0x08720a, 0x0874fd, 0x0877f2, 0x087ae4, 0x087ddc,
+    0x0880d9, 0x0883d4, 0x0886cb, 0x0889c8, 0x088cb8, 0x088fc4, 0x0892c3, 0x0895b2,
+    0x0898c2, 0x089bd0, 0x089ec1, 0x08a179, 0x08a433, 0x08a6eb, 0x08a9c6, 0x08ac8f,
+    0x08af83, 0x08b27c, 0x08b56e, 0x08b857, 0x08bb2c, 0x08be10, 0x08c042, 0x08c2a1,
+    0x08c521, 0x08c7b7, 0x08ca56, 0x08cd12, 0x08cfe5, 0x08d2b0, 0x08d58b, 0x08d864,
+    0x08db47, 0x08ddad, 0x08e05f, 0x08e355, 0x08e5fd, 0x08e8e3, 0x08eba9, 0x08eebb,
+    0x08f196, 0x08f443, 0x08f6ef, 0x08f9a7, 0x08fc6a, 0x08ff43, 0x090216, 0x0904ed,
+    0x0907de, 0x090ac9, 0x090dbb, 0x09109d, 0x09138c, 0x0916a0, 0x0919ba, 0x091cbd,
+    0x091ff5, 0x0922e9, 0x0925ff, 0x092912, 0x092c3e, 0x092f67, 0x093298, 0x09353e,
+    0x0937ed, 0x093a68, 0x093d43, 0x094034, 0x094322, 0x094627, 0x09493b, 0x094c4c,
+    0x094eec, 0x095130, 0x09537a, 0x0955c3, 0x09580d, 0x095a70, 0x095cb4, 0x095f17,
+    0x09616a, 0x0963d4, 0x096638, 0x096899, 0x096b12, 0x096d8b, 0x097004, 0x097276,
+    0x0974f5, 0x097763, 0x0979c3, 0x097c2b, 0x097eaf, 0x098138, 0x0983b4, 0x098640,
+    0x0988c0, 0x098b2c, 0x098db4, 0x099053, 0x0992ce, 0x099553, 0x0997e4, 0x099a71,
+    0x099cf7, 0x099f82, 0x09a21e, 0x09a4b9, 0x09a74d, 0x09a9cc, 0x09ac6d, 0x09af14,
+    0x09b1bb, 0x09b467, 0x09b6f2, 0x09b9a5, 0x09bc5a, 0x09befb, 0x09c19e, 0x09c433,
+    0x09c6e6, 0x09c999, 0x09cc41, 0x09cede, 0x09d188, 0x09d43c, 0x09d6f2, 0x09d9bb,
+    0x09dc7a, 0x09df40, 0x09e208, 0x09e4d8, 0x09e7b5, 0x09ea9c, 0x09ed55, 0x09f04d,
+    0x09f307, 0x09f5c8, 0x09f893, 0x09fb76, 0x09fe63, 0x0a011d, 0x0a03fd, 0x0a06dd,
+    0x0a09cc, 0x0a0c9a, 0x0a0f87, 0x0a1281, 0x0a156e, 0x0a1868, 0x0a1b6a, 0x0a1e69,
+    0x0a2160, 0x0a2475, 0x0a2783, 0x0a2a82, 0x0a2d67, 0x0a3055, 0x0a3349, 0x0a3651,
+    0x0a3946, 0x0a3c42, 0x0a3f36, 0x0a4238, 0x0a4558, 0x0a4815, 0x0a4b0a, 0x0a4db4,
+    0x0a5046, 0x0a5306, 0x0a55cf, 0x0a587e, 0x0a5b47, 0x0a5df4, 0x0a60b2, 0x0a63a4,
+    0x0a6665, 0x0a693f, 0x0a6c26, 0x0a6f0c, 0x0a7204, 0x0a750e, 0x0a7802, 0x0a7b08,
+    0x0a7e29, 0x0a80a2, 0x0a8371, 0x0a8667, 0x0a899e, 0x0a8c6a, 0x0a8f61, 0x0a9259,
+    0x0a9578, 0x0a980b, 0x0a9abb, 0x0a9d8c, 0x0aa03f, 0x0aa325, 0x0aa5e6, 0x0aa8ae,
+    0x0aab7e, 0x0aae34, 0x0ab10f, 0x0ab3e8, 0x0ab6c4, 0x0ab997, 0x0abc71, 0x0abf44,
+    0x0ac21b, 0x0ac4f3, 0x0ac7eb, 0x0acad4, 0x0acdd4, 0x0ad0ec, 0x0ad3e9, 0x0ad6e2,
+    0x0ad9cb, 0x0adcc0, 0x0adfbc, 0x0ae221, 0x0ae4c7, 0x0ae779, 0x0aea41, 0x0aecff,
+    0x0aefbf, 0x0af279, 0x0af54c, 0x0af81e, 0x0afafc, 0x0afdc4, 0x0b0092, 0x0b035d,
+    0x0b0639, 0x0b091a, 0x0b0c00, 0x0b0e83, 0x0b112a, 0x0b13d7, 0x0b16b2, 0x0b197d,
+    0x0b1c6c, 0x0b1f46, 0x0b222c, 0x0b24cf, 0x0b277f, 0x0b2a46, 0x0b2d31, 0x0b301f,
+    0x0b32d7, 0x0b35b8, 0x0b38a9, 0x0b3bad, 0x0b3e8a, 0x0b4170, 0x0b446a, 0x0b4748,
+    0x0b4a30, 0x0b4d21, 0x0b5019, 0x0b5316, 0x0b5628, 0x0b592d, 0x0b5c45, 0x0b5f6d,
+    0x0b6282, 0x0b6592, 0x0b68d8, 0x0b6c12, 0x0b6f13, 0x0b7202, 0x0b74e1, 0x0b77c3,
+    0x0b7a9a, 0x0b7d6c, 0x0b8064, 0x0b8332, 0x0b8637, 0x0b8936, 0x0b8c3c, 0x0b8f22,
+    0x0b9206, 0x0b9503, 0x0b97e7, 0x0b9acc, 0x0b9d36, 0x0b9fa5, 0x0ba223, 0x0ba4c6,
+    0x0ba77e, 0x0baa39, 0x0bacdc, 0x0baf8d, 0x0bb23e, 0x0bb504, 0x0bb7c0, 0x0bba8d,
+    0x0bbd4f, 0x0bc037, 0x0bc2bf, 0x0bc57f, 0x0bc857, 0x0bcb2b, 0x0bce0a, 0x0bd0e5,
+    0x0bd3d7, 0x0bd6f1, 0x0bd9f6, 0x0bdd06, 0x0be004, 0x0be2f8, 0x0be5ed, 0x0be8fd,
+    0x0bec20, 0x0bef4d, 0x0bf26c, 0x0bf57e, 0x0bf890, 0x0bfb4b, 0x0bfde6, 0x0c00a6,
+    0x0c0382, 0x0c0666, 0x0c094c, 0x0c0c37, 0x0c0f18, 0x0c11e2, 0x0c14c9, 0x0c179f,
+    0x0c1a7d, 0x0c1d61, 0x0c2035, 0x0c2322, 0x0c2613, 0x0c28ef, 0x0c2bdd, 0x0c2ede,
+    0x0c31bf, 0x0c34b0, 0x0c3798, 0x0c3a78, 0x0c3d5d, 0x0c4057, 0x0c4355, 0x0c465e,
+    0x0c496a, 0x0c4c6c, 0x0c4f81, 0x0c527d, 0x0c558c, 0x0c5893, 0x0c5b94, 0x0c5e97,
+    0x0c61b2, 0x0c64ca, 0x0c67d2, 0x0c6af5, 0x0c6dff, 0x0c7102, 0x0c7417, 0x0c7742,
+    0x0c7a4e, 0x0c7d11, 0x0c7fdb, 0x0c82a7, 0x0c8585, 0x0c8876, 0x0c8b5a, 0x0c8e39,
+    0x0c910b, 0x0c9415, 0x0c9706, 0x0c99f4, 0x0c9cef, 0x0c9fe8, 0x0ca2f1, 0x0ca5fb,
+    0x0ca8d5, 0x0cab3c, 0x0cadca, 0x0cb06a, 0x0cb31e, 0x0cb5d0, 0x0cb89f, 0x0cbb27,
+    0x0cbd8f, 0x0cc025, 0x0cc2b6, 0x0cc573, 0x0cc833, 0x0ccb08, 0x0ccdeb, 0x0cd0c2,
+    0x0cd38e, 0x0cd688, 0x0cd96f, 0x0cdc81, 0x0cdf5e, 0x0ce230, 0x0ce534, 0x0ce7fe,
+    0x0cea71, 0x0cecda, 0x0cef91, 0x0cf24e, 0x0cf522, 0x0cf7f9, 0x0cfac4, 0x0cfd7f,
+    0x0d006d, 0x0d034d, 0x0d0633, 0x0d0943, 0x0d0c4d, 0x0d0f3a, 0x0d123b, 0x0d1516,
+    0x0d1800, 0x0d1a9a, 0x0d1d66, 0x0d204b, 0x0d2332, 0x0d2618, 0x0d2905, 0x0d2c19,
+    0x0d2ef4, 0x0d31f5, 0x0d34ee, 0x0d37da, 0x0d3aec, 0x0d3e04, 0x0d40e7, 0x0d43b2,
+    0x0d46a0, 0x0d498e, 0x0d4c80, 0x0d4f8b, 0x0d52a6, 0x0d55ae, 0x0d58c6, 0x0d5b8e,
+    0x0d5e5e, 0x0d6139, 0x0d6414, 0x0d6701, 0x0d69ec, 0x0d6ce1, 0x0d6fd6, 0x0d72e1,
+    0x0d75d9, 0x0d78dc, 0x0d7be2, 0x0d7eea, 0x0d8202, 0x0d84f9, 0x0d8811, 0x0d8b06,
+    0x0d8ddb, 0x0d90c2, 0x0d93c0, 0x0d969c, 0x0d99a8, 0x0d9cca, 0x0d9fbf, 0x0da23e,
+    0x0da4db, 0x0da7a2, 0x0daa66, 0x0dad35, 0x0db016, 0x0db312, 0x0db5fb, 0x0db8e2,
+    0x0dbbca, 0x0dbec3, 0x0dc1b5, 0x0dc4a3, 0x0dc7ad, 0x0dcaab, 0x0dcdaa, 0x0dd08c,
+    0x0dd394, 0x0dd6bf, 0x0dd9c8, 0x0ddcd6, 0x0ddfca, 0x0de2df, 0x0de5e6, 0x0de8f5,
+    0x0debeb, 0x0deedd, 0x0df1cc, 0x0df4df, 0x0df7ed, 0x0dfb00, 0x0dfe27, 0x0e010d,
+    0x0e0410, 0x0e06fb, 0x0e09ec, 0x0e0cf1, 0x0e0ff0, 0x0e12f0, 0x0e15f8, 0x0e1910,
+    0x0e1c1d, 0x0e1f36, 0x0e224a, 0x0e255a, 0x0e2865, 0x0e2b6f, 0x0e2e78, 0x0e318a,
+    0x0e34a3, 0x0e37c4, 0x0e3ac0, 0x0e3da9, 0x0e409c, 0x0e43b8, 0x0e46e3, 0x0e4a04,
+    0x0e4d00, 0x0e4fbc, 0x0e5287, 0x0e5555, 0x0e583f, 0x0e5afc, 0x0e5dde, 0x0e60df,
+    0x0e63d9, 0x0e66a6, 0x0e6987, 0x0e6c89, 0x0e6fa4, 0x0e72bd, 0x0e75c0, 0x0e78dd,
+    0x0e7c05, 0x0e7f2c, 0x0e820e, 0x0e8520, 0x0e874c, 0x0e8a1e, 0x0e8d32, 0x0e905e,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d, 0x0e937d,
+    0x0e937d, 0x0e9609, 0x0e98ee, 0x0e9bb0, 0x0e9e6a, 0x0ea127, 0x0ea3d5, 0x0ea661,
+    0x0ea8fe, 0x0eabb1, 0x0eae6a, 0x0eb115, 0x0eb3d5, 0x0eb69e, 0x0eb94c, 0x0ebbea,
+    0x0ebeac, 0x0ec15f, 0x0ec40c, 0x0ec6f3, 0x0ec985, 0x0ecc16, 0x0ecea1, 0x0ed157,
+    0x0ed3f6, 0x0ed6ef, 0x0ed9b2, 0x0edc5f, 0x0edf3c, 0x0ee262, 0x0ee543, 0x0ee7df,
+    0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89,
+    0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89,
+    0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89,
+    0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89,
+    0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89,
+    0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89,
+    0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89,
+    0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89, 0x0eea89,
+    0x0eea89, 0x0eebd3, 0x0eed2f, 0x0eeee8, 0x0ef067, 0x0ef162, 0x0ef24f, 0x0ef263,
+    0x0ef263, 0x0ef263, 0x0ef263, 0x0ef263, 0x0ef263, 0x0ef263, 0x0ef263, 0x0ef263,
+};
+#endif /* U8G2_USE_LARGE_FONTS */
+
+#endif // _U8G2_FONT_UNIFONT_T_CHINESE_INDEX_H_
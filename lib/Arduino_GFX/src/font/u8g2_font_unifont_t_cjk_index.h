@@ -0,0 +1,521 @@
+// Generated by scripts/u8g2_font_index.py from u8g2_font_unifont_t_cjk.h - do not edit
+// 41268 unicode glyphs, see Arduino_GFX::setFont(const uint8_t *, const uint32_t *)
+#ifndef _U8G2_FONT_UNIFONT_T_CJK_INDEX_H_
+#define _U8G2_FONT_UNIFONT_T_CJK_INDEX_H_
+
+#ifdef U8G2_USE_LARGE_FONTS
+const uint32_t u8g2_font_unifont_t_cjk_index[4080] PROGMEM = {
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a, 0x000b5a,
+    0x000b5a, 0x000c2e, 0x000d3f, 0x000e6e, 0x000f75, 0x00107a, 0x0011a1, 0x001297,
+    0x0013d2, 0x001523, 0x001648, 0x001747, 0x00183c, 0x001952, 0x001a8b, 0x001b9b,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad, 0x001cad,
+    0x001cad, 0x001e33, 0x00201a, 0x00217a, 0x002327, 0x002522, 0x002740, 0x002986,
+    0x002c20, 0x002d97, 0x002f8b, 0x003187, 0x00338a, 0x0035c6, 0x0037fd, 0x003a29,
+    0x003c87, 0x003ee8, 0x00412d, 0x00439a, 0x004609, 0x00488d, 0x004b13, 0x004b13,
+    0x004b13, 0x004c51, 0x004d6a, 0x004e9e, 0x005062, 0x00520f, 0x0053fa, 0x0055cf,
+    0x0057df, 0x0059b1, 0x005b31, 0x005ca0, 0x005e67, 0x006007, 0x0061b1, 0x00631a,
+    0x006494, 0x006677, 0x006808, 0x0069a3, 0x006b61, 0x006cf6, 0x006e8d, 0x00702f,
+    0x007226, 0x007429, 0x007526, 0x0076f6, 0x007855, 0x0079db, 0x007af9, 0x007d5b,
+    0x007e56, 0x0080ac, 0x00834b, 0x0085b8, 0x008867, 0x008b1e, 0x008dac, 0x009022,
+    0x0092d0, 0x009530, 0x0097e1, 0x009a5c, 0x009cfd, 0x009f55, 0x00a18a, 0x00a3b6,
+    0x00a607, 0x00a82f, 0x00aa88, 0x00acc1, 0x00aee6, 0x00b106, 0x00b354, 0x00b669,
+    0x00b8fb, 0x00bb36, 0x00bd7b, 0x00bfe6, 0x00c20c, 0x00c436, 0x00c664, 0x00c8ff,
+    0x00cc25, 0x00ce64, 0x00d0e2, 0x00d396, 0x00d651, 0x00d913, 0x00dbe6, 0x00dec0,
+    0x00e1b7, 0x00e4b9, 0x00e7cb, 0x00eacf, 0x00ed61, 0x00efec, 0x00f294, 0x00f578,
+    0x00f87f, 0x00fb9b, 0x00fe72, 0x010151, 0x0103da, 0x010674, 0x010924, 0x010bbd,
+    0x010e50, 0x01111e, 0x0113d5, 0x0116bc, 0x01198a, 0x011c76, 0x011f56, 0x01224c,
+    0x01255b, 0x012871, 0x012b6b, 0x012e0d, 0x0130b8, 0x013377, 0x01364b, 0x013933,
+    0x013c34, 0x013eee, 0x014176, 0x01444e, 0x014727, 0x014a09, 0x014ce1, 0x014ff1,
+    0x0152fa, 0x0155f5, 0x015904, 0x015c17, 0x015f1c, 0x0161b2, 0x01642e, 0x0166d8,
+    0x01699c, 0x016c85, 0x016f26, 0x017165, 0x0173d9, 0x01768f, 0x01792f, 0x017be1,
+    0x017eae, 0x018180, 0x018474, 0x018735, 0x0189d5, 0x018cac, 0x018f8a, 0x01929c,
+    0x01954a, 0x019818, 0x019b13, 0x019dda, 0x01a0a6, 0x01a368, 0x01a645, 0x01a934,
+    0x01abff, 0x01aeb8, 0x01b16c, 0x01b449, 0x01b723, 0x01ba17, 0x01bd04, 0x01bfe4,
+    0x01c2e1, 0x01c5d7, 0x01c8e8, 0x01cc02, 0x01cee6, 0x01d192, 0x01d485, 0x01d759,
+    0x01da3a, 0x01dd1e, 0x01e027, 0x01e33b, 0x01e639, 0x01e94b, 0x01ec43, 0x01ef6e,
+    0x01f286, 0x01f577, 0x01f86e, 0x01fb70, 0x01fe33, 0x02011b, 0x020394, 0x020617,
+    0x0208f1, 0x020bad, 0x020ec3, 0x0211d5, 0x0214dc, 0x021791, 0x021a4a, 0x021d42,
+    0x02202e, 0x022310, 0x022606, 0x0228f7, 0x022bff, 0x022f0a, 0x023211, 0x023524,
+    0x023832, 0x023b59, 0x023e76, 0x024161, 0x02444e, 0x024756, 0x024a1b, 0x024d10,
+    0x025002, 0x0252da, 0x02558e, 0x025866, 0x025b1b, 0x025db5, 0x026068, 0x026327,
+    0x0265f8, 0x0268c4, 0x026b92, 0x026e86, 0x02717c, 0x027482, 0x02777c, 0x027a67,
+    0x027d75, 0x028092, 0x0283c0, 0x028674, 0x028943, 0x028c1c, 0x028f0f, 0x0291f8,
+    0x0294fa, 0x029810, 0x029ad8, 0x029dbe, 0x02a093, 0x02a398, 0x02a69b, 0x02a96b,
+    0x02ac59, 0x02af6e, 0x02b284, 0x02b560, 0x02b7fd, 0x02baaa, 0x02bd7d, 0x02c05f,
+    0x02c342, 0x02c653, 0x02c95a, 0x02cc42, 0x02cf4e, 0x02d25f, 0x02d50f, 0x02d7fc,
+    0x02dab8, 0x02dd88, 0x02e05d, 0x02e33a, 0x02e63b, 0x02e93b, 0x02ec34, 0x02ef26,
+    0x02f220, 0x02f4d6, 0x02f775, 0x02fa4c, 0x02fd24, 0x02fff8, 0x0302d9, 0x0305fc,
+    0x030908, 0x030c2b, 0x030eec, 0x0311c9, 0x0314b6, 0x0317ac, 0x031ab9, 0x031dc2,
+    0x0320db, 0x0323b3, 0x0326b7, 0x032993, 0x032c56, 0x032f1e, 0x0331ee, 0x0334d9,
+    0x0337c6, 0x033ae4, 0x033d78, 0x03403a, 0x034308, 0x0345d2, 0x034888, 0x034b1e,
+    0x034dc7, 0x035085, 0x035356, 0x03562b, 0x03590d, 0x035bff, 0x035eec, 0x0361ff,
+    0x0364ea, 0x0367d9, 0x036acd, 0x036dcc, 0x0370a7, 0x03736a, 0x037644, 0x037926,
+    0x037c17, 0x037f1a, 0x038204, 0x038525, 0x038818, 0x038aed, 0x038d42, 0x03900c,
+    0x0392ef, 0x0395d5, 0x0398c9, 0x039ba4, 0x039e9d, 0x03a198, 0x03a48b, 0x03a783,
+    0x03aa85, 0x03ad9b, 0x03b0b9, 0x03b3e0, 0x03b714, 0x03ba66, 0x03bd3a, 0x03c039,
+    0x03c36f, 0x03c6ad, 0x03c908, 0x03cb68, 0x03cdee, 0x03d06b, 0x03d2f2, 0x03d57b,
+    0x03d813, 0x03da9b, 0x03dd47, 0x03dffb, 0x03e2c5, 0x03e58a, 0x03e846, 0x03eb2e,
+    0x03ee24, 0x03f114, 0x03f40e, 0x03f6c4, 0x03f9b4, 0x03fcbd, 0x03ffb0, 0x0402bb,
+    0x0405cd, 0x0408e4, 0x040bc2, 0x040e8e, 0x041168, 0x041473, 0x041775, 0x041a93,
+    0x041d68, 0x042090, 0x0423b1, 0x0426cf, 0x04299e, 0x042ca2, 0x042f63, 0x04324b,
+    0x043544, 0x043842, 0x043b56, 0x043e3c, 0x04412e, 0x044429, 0x044750, 0x044a47,
+    0x044d32, 0x045063, 0x045353, 0x045631, 0x045940, 0x045c57, 0x045f41, 0x04623a,
+    0x046534, 0x046843, 0x046b61, 0x046e8a, 0x0471c2, 0x0474b9, 0x0477ac, 0x047aa3,
+    0x047dd1, 0x04808d, 0x048343, 0x04861f, 0x0488f9, 0x048bfc, 0x048f15, 0x049243,
+    0x049555, 0x049895, 0x049bb7, 0x049ebd, 0x04a1bd, 0x04a4cb, 0x04a7da, 0x04ab0d,
+    0x04ae19, 0x04b107, 0x04b392, 0x04b635, 0x04b8dc, 0x04bbbe, 0x04beb1, 0x04c1cf,
+    0x04c4d1, 0x04c7bc, 0x04ca71, 0x04cd3e, 0x04d035, 0x04d338, 0x04d633, 0x04d921,
+    0x04dc46, 0x04df89, 0x04e28d, 0x04e588, 0x04e86c, 0x04eb73, 0x04ee7c, 0x04f1a4,
+    0x04f4bc, 0x04f7f4, 0x04fb21, 0x04fe1a, 0x050125, 0x050443, 0x05077b, 0x050ab9,
+    0x050dbd, 0x0510b8, 0x0513d6, 0x0516f5, 0x051a26, 0x051d36, 0x052056, 0x052342,
+    0x0525e1, 0x05289f, 0x052b98, 0x052ea9, 0x053191, 0x05348b, 0x05379f, 0x053ab6,
+    0x053dde, 0x0540ec, 0x054407, 0x054713, 0x054a07, 0x054d1e, 0x055015, 0x055337,
+    0x055649, 0x055962, 0x055c6d, 0x055f66, 0x056263, 0x05657f, 0x05686b, 0x056b5d,
+    0x056e5e, 0x05717f, 0x0574b3, 0x0577f6, 0x057ae7, 0x057ae7, 0x057ae7, 0x057ae7,
+    0x057ae7, 0x057cbd, 0x057edf, 0x0580e6, 0x05830e, 0x058526, 0x058753, 0x0589a4,
+    0x058c47, 0x058e64, 0x059069, 0x059276, 0x0594d8, 0x059753, 0x0599c7, 0x059c59,
+    0x059ee6, 0x05a182, 0x05a421, 0x05a6e2, 0x05a977, 0x05ac2d, 0x05aeb3, 0x05b15d,
+    0x05b407, 0x05b6b2, 0x05b962, 0x05bc0c, 0x05bec5, 0x05c178, 0x05c412, 0x05c6d8,
+    0x05c99b, 0x05cc6f, 0x05cf30, 0x05d1fb, 0x05d4b9, 0x05d78d, 0x05da7b, 0x05dd61,
+    0x05e04c, 0x05e31d, 0x05e5f8, 0x05e8f7, 0x05ebc5, 0x05ee95, 0x05f180, 0x05f461,
+    0x05f75f, 0x05fa5e, 0x05fd3e, 0x060054, 0x060359, 0x0605b0, 0x06084c, 0x060abb,
+    0x060d0f, 0x060f43, 0x061170, 0x0613b3, 0x061642, 0x0618e4, 0x061ba4, 0x061e3f,
+    0x06209c, 0x0622e3, 0x062576, 0x062828, 0x062add, 0x062d8d, 0x06305b, 0x063317,
+    0x0635e5, 0x0638f3, 0x063be0, 0x063e87, 0x064127, 0x0643eb, 0x0646b5, 0x0649bc,
+    0x064c6f, 0x064ee5, 0x065155, 0x0653bb, 0x065611, 0x065855, 0x065a92, 0x065cd0,
+    0x065f88, 0x066207, 0x0664a6, 0x06676d, 0x0669f2, 0x066c5b, 0x066ee9, 0x06711b,
+    0x06735f, 0x067596, 0x0677ff, 0x067a8f, 0x067d1e, 0x067f8f, 0x068236, 0x0684ef,
+    0x06877e, 0x068a26, 0x068ce6, 0x068f74, 0x069229, 0x0694d9, 0x069794, 0x069a43,
+    0x069cf9, 0x069faa, 0x06a265, 0x06a536, 0x06a80e, 0x06aac0, 0x06ad9a, 0x06b07c,
+    0x06b364, 0x06b61f, 0x06b909, 0x06bbc1, 0x06be87, 0x06c167, 0x06c44d, 0x06c730,
+    0x06ca2f, 0x06cd20, 0x06d008, 0x06d2f9, 0x06d5de, 0x06d8e0, 0x06dbcb, 0x06dec3,
+    0x06e1b0, 0x06e499, 0x06e784, 0x06ea9d, 0x06edab, 0x06f0a9, 0x06f31f, 0x06f54a,
+    0x06f777, 0x06f9d9, 0x06fc54, 0x06fec1, 0x07015c, 0x0703ed, 0x070662, 0x0708f2,
+    0x070b9f, 0x070e4e, 0x0710e0, 0x071378, 0x07162d, 0x0718cf, 0x071b83, 0x071e4e,
+    0x0720ed, 0x07238d, 0x07264e, 0x072924, 0x072bf3, 0x072ea6, 0x073168, 0x073435,
+    0x073706, 0x0739df, 0x073cb0, 0x073f86, 0x074263, 0x074537, 0x074818, 0x074ae1,
+    0x074d59, 0x074fbc, 0x075266, 0x0754d2, 0x075742, 0x0759a9, 0x075c28, 0x075ec6,
+    0x076172, 0x07642d, 0x0766d5, 0x0769a9, 0x076c5b, 0x076f2e, 0x0771fb, 0x0774ce,
+    0x0777ab, 0x077a89, 0x077d67, 0x078050, 0x07833e, 0x078630, 0x078921, 0x078c1c,
+    0x078f1c, 0x07921b, 0x07950e, 0x07981c, 0x079b13, 0x079e13, 0x07a119, 0x07a41f,
+    0x07a730, 0x07aa40, 0x07ad54, 0x07b05b, 0x07b37a, 0x07b6c7, 0x07b8f9, 0x07bb79,
+    0x07be33, 0x07c060, 0x07c2a8, 0x07c511, 0x07c77c, 0x07c9f7, 0x07cc74, 0x07cf01,
+    0x07d188, 0x07d418, 0x07d667, 0x07d92e, 0x07dbe6, 0x07de4b, 0x07e0ca, 0x07e384,
+    0x07e5cf, 0x07e854, 0x07eac8, 0x07ed45, 0x07efc7, 0x07f245, 0x07f4d4, 0x07f7a2,
+    0x07fa57, 0x07fcf3, 0x07ff95, 0x080234, 0x0804fa, 0x0807c3, 0x080a5d, 0x080d14,
+    0x080fe5, 0x0812c4, 0x0815a6, 0x08186f, 0x081b52, 0x081e63, 0x08210b, 0x082352,
+    0x0825b2, 0x082813, 0x082a79, 0x082d06, 0x082fe2, 0x0832a4, 0x083577, 0x083856,
+    0x083aca, 0x083d5a, 0x084007, 0x0842a9, 0x08454b, 0x084829, 0x084b07, 0x084df9,
+    0x0850b5, 0x08530f, 0x08556d, 0x085825, 0x085ae3, 0x085db7, 0x086015, 0x0862ac,
+    0x086549, 0x0867fd, 0x086ac8, 0x086da2, 0x0870ac, 0x087330, 0x0875bc, 0x087868,
+    0x087b1a, 0x087ddc, 0x08808b, 0x088344, 0x088609, 0x0888c2, 0x088b84, 0x088e49,
+    0x089106, 0x0893d0, 0x089690, 0x08994d, 0x089c1b, 0x089ef3, 0x08a1c9, 0x08a491,
+    0x08a776, 0x08aa45, 0x08ad16, 0x08b00c, 0x08b2de, 0x08b5ba, 0x08b8a0, 0x08bb8b,
+    0x08be88, 0x08c17e, 0x08c464, 0x08c751, 0x08ca68, 0x08cd69, 0x08d076, 0x08d392,
+    0x08d6af, 0x08d997, 0x08dc41, 0x08df3c, 0x08e1d2, 0x08e449, 0x08e6c5, 0x08e96f,
+    0x08ec33, 0x08eed8, 0x08f17c, 0x08f44f, 0x08f700, 0x08f9af, 0x08fc33, 0x08ff06,
+    0x0901ac, 0x090467, 0x090728, 0x0909f9, 0x090cb3, 0x090f6b, 0x091226, 0x09150e,
+    0x0917e0, 0x091ac2, 0x091d87, 0x092051, 0x09233a, 0x092614, 0x0928f1, 0x092bd5,
+    0x092ec0, 0x0931a8, 0x093486, 0x09377b, 0x093a65, 0x093d6b, 0x094062, 0x09435a,
+    0x094634, 0x094925, 0x094c19, 0x094f0f, 0x095205, 0x0954ec, 0x0957ed, 0x095ae1,
+    0x095e04, 0x09611c, 0x096443, 0x09674f, 0x096a07, 0x096ce2, 0x096fcf, 0x0972bf,
+    0x0975b5, 0x097869, 0x097b36, 0x097e03, 0x0980e0, 0x0983a6, 0x0986ca, 0x09891e,
+    0x098b6b, 0x098dd5, 0x099051, 0x0992c5, 0x099555, 0x0997dd, 0x099a8d, 0x099d49,
+    0x09a006, 0x09a2e2, 0x09a5b0, 0x09a880, 0x09ab64, 0x09ae26, 0x09b113, 0x09b423,
+    0x09b65e, 0x09b928, 0x09bc06, 0x09bec0, 0x09c13f, 0x09c3ca, 0x09c66c, 0x09c8fd,
+    0x09cb95, 0x09ce43, 0x09d0e8, 0x09d396, 0x09d63b, 0x09d8ff, 0x09db85, 0x09de3f,
+    0x09e0f2, 0x09e3b3, 0x09e672, 0x09e941, 0x09ebfd, 0x09eea4, 0x09f153, 0x09f41d,
+    0x09f6e8, 0x09f9ba, 0x09fc90, 0x09ff4b, 0x0a021e, 0x0a04ce, 0x0a079c, 0x0a0a89,
+    0x0a0d4e, 0x0a1006, 0x0a12de, 0x0a15d4, 0x0a18c0, 0x0a1ba4, 0x0a1e90, 0x0a2171,
+    0x0a2440, 0x0a2742, 0x0a2a30, 0x0a2d18, 0x0a2ff6, 0x0a32d1, 0x0a35ae, 0x0a3899,
+    0x0a3b8c, 0x0a3e96, 0x0a4177, 0x0a4465, 0x0a474a, 0x0a4a41, 0x0a4d2d, 0x0a5020,
+    0x0a533b, 0x0a563a, 0x0a5934, 0x0a5c35, 0x0a5f30, 0x0a6244, 0x0a654e, 0x0a686d,
+    0x0a6b8e, 0x0a6ebf, 0x0a71d3, 0x0a7493, 0x0a7771, 0x0a7a64, 0x0a7d61, 0x0a7fef,
+    0x0a8298, 0x0a854f, 0x0a8828, 0x0a8b16, 0x0a8dea, 0x0a908f, 0x0a9313, 0x0a95b0,
+    0x0a9889, 0x0a9b5d, 0x0a9de8, 0x0aa072, 0x0aa2db, 0x0aa569, 0x0aa7da, 0x0aaa7b,
+    0x0aad17, 0x0aafb1, 0x0ab22d, 0x0ab4da, 0x0ab771, 0x0aba24, 0x0abcbe, 0x0abf57,
+    0x0ac1f2, 0x0ac4ac, 0x0ac760, 0x0aca0d, 0x0acca3, 0x0acf66, 0x0ad226, 0x0ad4b9,
+    0x0ad779, 0x0ada17, 0x0adcc1, 0x0adf7e, 0x0ae23f, 0x0ae4e9, 0x0ae7ab, 0x0aea5c,
+    0x0aed16, 0x0aefd0, 0x0af291, 0x0af539, 0x0af7f2, 0x0afaac, 0x0afd7d, 0x0b003d,
+    0x0b0301, 0x0b05d9, 0x0b088f, 0x0b0b5f, 0x0b0e1c, 0x0b10e5, 0x0b13aa, 0x0b1690,
+    0x0b1979, 0x0b1c46, 0x0b1f1b, 0x0b21f0, 0x0b24cf, 0x0b27af, 0x0b2a8f, 0x0b2d58,
+    0x0b302e, 0x0b330c, 0x0b35eb, 0x0b38bc, 0x0b3bb1, 0x0b3eb0, 0x0b4183, 0x0b4453,
+    0x0b4749, 0x0b4a48, 0x0b4d45, 0x0b504c, 0x0b534e, 0x0b5673, 0x0b598d, 0x0b5c61,
+    0x0b5ee6, 0x0b619e, 0x0b644e, 0x0b6722, 0x0b69df, 0x0b6c9d, 0x0b6f78, 0x0b724e,
+    0x0b7530, 0x0b77e9, 0x0b7ad3, 0x0b7dad, 0x0b8099, 0x0b838a, 0x0b866b, 0x0b8947,
+    0x0b8c63, 0x0b8f47, 0x0b9239, 0x0b9535, 0x0b9834, 0x0b9b31, 0x0b9e2a, 0x0ba131,
+    0x0ba442, 0x0ba766, 0x0baa99, 0x0bad83, 0x0bafef, 0x0bb2e3, 0x0bb585, 0x0bb854,
+    0x0bbb22, 0x0bbdfe, 0x0bc0f7, 0x0bc3d9, 0x0bc698, 0x0bc942, 0x0bcc2a, 0x0bcefb,
+    0x0bd1cf, 0x0bd497, 0x0bd76b, 0x0bda50, 0x0bdd4a, 0x0be03c, 0x0be331, 0x0be639,
+    0x0be93d, 0x0bebdf, 0x0bee6d, 0x0bf0f6, 0x0bf38c, 0x0bf61e, 0x0bf8ea, 0x0bfb9d,
+    0x0bfe4f, 0x0c0104, 0x0c03b8, 0x0c064e, 0x0c08fa, 0x0c0bb6, 0x0c0e6f, 0x0c112e,
+    0x0c13f9, 0x0c16ca, 0x0c198c, 0x0c1c64, 0x0c1f31, 0x0c2227, 0x0c2521, 0x0c2807,
+    0x0c2ae5, 0x0c2dc4, 0x0c3095, 0x0c32fb, 0x0c3509, 0x0c379c, 0x0c3a0e, 0x0c3c8c,
+    0x0c3f1a, 0x0c41da, 0x0c4466, 0x0c471b, 0x0c49b2, 0x0c4c6f, 0x0c4f19, 0x0c51d6,
+    0x0c5492, 0x0c5758, 0x0c5a0d, 0x0c5ce4, 0x0c5fcd, 0x0c62be, 0x0c65c9, 0x0c68c8,
+    0x0c6b60, 0x0c6dea, 0x0c70be, 0x0c73bd, 0x0c76d0, 0x0c793d, 0x0c7bca, 0x0c7e62,
+    0x0c80e6, 0x0c8384, 0x0c8625, 0x0c88e6, 0x0c8b9f, 0x0c8e6b, 0x0c9147, 0x0c9414,
+    0x0c96f4, 0x0c99ef, 0x0c9cf4, 0x0c9ff5, 0x0ca2ee, 0x0ca610, 0x0ca912, 0x0cabc5,
+    0x0cae6f, 0x0cb12f, 0x0cb3fa, 0x0cb6c8, 0x0cb98d, 0x0cbc5d, 0x0cbf3e, 0x0cc201,
+    0x0cc4f6, 0x0cc7ce, 0x0cca9e, 0x0ccd8d, 0x0cd076, 0x0cd35d, 0x0cd659, 0x0cd950,
+    0x0cdc4a, 0x0cdf59, 0x0ce258, 0x0ce557, 0x0ce836, 0x0ceadf, 0x0ced7c, 0x0cf035,
+    0x0cf307, 0x0cf5d9, 0x0cf8c6, 0x0cfbc6, 0x0cfe6a, 0x0d00fd, 0x0d03a7, 0x0d0661,
+    0x0d0925, 0x0d0bdb, 0x0d0ea4, 0x0d1187, 0x0d145a, 0x0d1741, 0x0d1a23, 0x0d1d28,
+    0x0d1faa, 0x0d222c, 0x0d24c5, 0x0d276f, 0x0d2a31, 0x0d2cd0, 0x0d2f63, 0x0d3205,
+    0x0d34c4, 0x0d3747, 0x0d39d3, 0x0d3c71, 0x0d3f12, 0x0d41b9, 0x0d4457, 0x0d46fc,
+    0x0d499c, 0x0d4c5d, 0x0d4efc, 0x0d51a2, 0x0d5465, 0x0d571b, 0x0d59dc, 0x0d5caa,
+    0x0d5f75, 0x0d6241, 0x0d6511, 0x0d67dc, 0x0d6ac0, 0x0d6da2, 0x0d7089, 0x0d7389,
+    0x0d764a, 0x0d790e, 0x0d7bc9, 0x0d7e8e, 0x0d8165, 0x0d845e, 0x0d874f, 0x0d8a5c,
+    0x0d8d1d, 0x0d8fd1, 0x0d9290, 0x0d954a, 0x0d980d, 0x0d9ad8, 0x0d9daa, 0x0da091,
+    0x0da359, 0x0da63d, 0x0da90f, 0x0dabf8, 0x0daeeb, 0x0db1e0, 0x0db4d2, 0x0db7ca,
+    0x0dbac7, 0x0dbdc2, 0x0dc0b9, 0x0dc3b6, 0x0dc6a6, 0x0dc9b2, 0x0dccb1, 0x0dcfa0,
+    0x0dd2b0, 0x0dd5be, 0x0dd8af, 0x0ddb67, 0x0dde21, 0x0de0d9, 0x0de3b4, 0x0de67d,
+    0x0de971, 0x0dec6a, 0x0def5c, 0x0df245, 0x0df51a, 0x0df7fe, 0x0dfa30, 0x0dfc8f,
+    0x0dff0f, 0x0e01a5, 0x0e0444, 0x0e0700, 0x0e09d3, 0x0e0c9e, 0x0e0f79, 0x0e1252,
+    0x0e1535, 0x0e179b, 0x0e1a4d, 0x0e1d43, 0x0e1feb, 0x0e22d1, 0x0e2597, 0x0e28a9,
+    0x0e2b84, 0x0e2e31, 0x0e30dd, 0x0e3395, 0x0e3658, 0x0e3931, 0x0e3c04, 0x0e3edb,
+    0x0e41cc, 0x0e44b7, 0x0e47a9, 0x0e4a8b, 0x0e4d7a, 0x0e508e, 0x0e53a8, 0x0e56ab,
+    0x0e59e3, 0x0e5cd7, 0x0e5fed, 0x0e6300, 0x0e662c, 0x0e6955, 0x0e6c86, 0x0e6f2c,
+    0x0e71db, 0x0e7456, 0x0e7731, 0x0e7a22, 0x0e7d10, 0x0e8015, 0x0e8329, 0x0e863a,
+    0x0e88da, 0x0e8b1e, 0x0e8d68, 0x0e8fb1, 0x0e91fb, 0x0e945e, 0x0e96a2, 0x0e9905,
+    0x0e9b58, 0x0e9dc2, 0x0ea026, 0x0ea287, 0x0ea500, 0x0ea779, 0x0ea9f2, 0x0eac64,
+    0x0eaee3, 0x0eb151, 0x0eb3b1, 0x0eb619, 0x0eb89d, 0x0ebb26, 0x0ebda2, 0x0ec02e,
+    0x0ec2ae, 0x0ec51a, 0x0ec7a2, 0x0eca41, 0x0eccbc, 0x0ecf41, 0x0ed1d2, 0x0ed45f,
+    0x0ed6e5, 0x0ed970, 0x0edc0c, 0x0edea7, 0x0ee13b, 0x0ee3ba, 0x0ee65b, 0x0ee902,
+    0x0eeba9, 0x0eee55, 0x0ef0e0, 0x0ef393, 0x0ef648, 0x0ef8e9, 0x0efb8c, 0x0efe21,
+    0x0f00d4, 0x0f0387, 0x0f062f, 0x0f08cc, 0x0f0b76, 0x0f0e2a, 0x0f10e0, 0x0f13a9,
+    0x0f1668, 0x0f192e, 0x0f1bf6, 0x0f1ec6, 0x0f21a3, 0x0f248a, 0x0f2743, 0x0f2a3b,
+    0x0f2cf5, 0x0f2fb6, 0x0f3281, 0x0f3564, 0x0f3851, 0x0f3b0b, 0x0f3deb, 0x0f40cb,
+    0x0f43ba, 0x0f4688, 0x0f4975, 0x0f4c6f, 0x0f4f5c, 0x0f5256, 0x0f5558, 0x0f5857,
+    0x0f5b4e, 0x0f5e63, 0x0f6171, 0x0f6470, 0x0f6755, 0x0f6a43, 0x0f6d37, 0x0f703f,
+    0x0f7334, 0x0f7630, 0x0f7924, 0x0f7c26, 0x0f7f46, 0x0f8203, 0x0f84f8, 0x0f87a2,
+    0x0f8a34, 0x0f8cf4, 0x0f8fbd, 0x0f926c, 0x0f9535, 0x0f97e2, 0x0f9aa0, 0x0f9d92,
+    0x0fa053, 0x0fa32d, 0x0fa614, 0x0fa8fa, 0x0fabf2, 0x0faefc, 0x0fb1f0, 0x0fb4f6,
+    0x0fb817, 0x0fba90, 0x0fbd5f, 0x0fc055, 0x0fc38c, 0x0fc658, 0x0fc94f, 0x0fcc47,
+    0x0fcf66, 0x0fd1f9, 0x0fd4a9, 0x0fd77a, 0x0fda2d, 0x0fdd13, 0x0fdfd4, 0x0fe29c,
+    0x0fe56c, 0x0fe822, 0x0feafd, 0x0fedd6, 0x0ff0b2, 0x0ff385, 0x0ff65f, 0x0ff932,
+    0x0ffc09, 0x0ffee1, 0x1001d9, 0x1004c2, 0x1007c2, 0x100ada, 0x100dd7, 0x1010d0,
+    0x1013b9, 0x1016ae, 0x1019aa, 0x101c0f, 0x101eb5, 0x102167, 0x10242f, 0x1026ed,
+    0x1029ad, 0x102c67, 0x102f3a, 0x10320c, 0x1034ea, 0x1037b2, 0x103a80, 0x103d4b,
+    0x104027, 0x104308, 0x1045ee, 0x104871, 0x104b18, 0x104dc5, 0x1050a0, 0x10536b,
+    0x10565a, 0x105934, 0x105c1a, 0x105ebd, 0x10616d, 0x106434, 0x10671f, 0x106a0d,
+    0x106cc5, 0x106fa6, 0x107297, 0x10759b, 0x107878, 0x107b5e, 0x107e58, 0x108136,
+    0x10841e, 0x10870f, 0x108a07, 0x108d04, 0x109016, 0x10931b, 0x109633, 0x10995b,
+    0x109c70, 0x109f80, 0x10a2c6, 0x10a600, 0x10a901, 0x10abf0, 0x10aecf, 0x10b1b1,
+    0x10b488, 0x10b75a, 0x10ba52, 0x10bd20, 0x10c025, 0x10c324, 0x10c62a, 0x10c910,
+    0x10cbf4, 0x10cef1, 0x10d1d5, 0x10d4ba, 0x10d724, 0x10d993, 0x10dc11, 0x10deb4,
+    0x10e16c, 0x10e427, 0x10e6ca, 0x10e97b, 0x10ec2c, 0x10eef2, 0x10f1ae, 0x10f47b,
+    0x10f73d, 0x10fa25, 0x10fcad, 0x10ff6d, 0x110245, 0x110519, 0x1107f8, 0x110ad3,
+    0x110dc5, 0x1110df, 0x1113e4, 0x1116f4, 0x1119f2, 0x111ce6, 0x111fdb, 0x1122eb,
+    0x11260e, 0x11293b, 0x112c5a, 0x112f6c, 0x11327e, 0x113539, 0x1137d4, 0x113a94,
+    0x113d70, 0x114054, 0x11433a, 0x114625, 0x114906, 0x114bd0, 0x114eb7, 0x11518d,
+    0x11546b, 0x11574f, 0x115a23, 0x115d10, 0x116001, 0x1162dd, 0x1165cb, 0x1168cc,
+    0x116bad, 0x116e9e, 0x117186, 0x117466, 0x11774b, 0x117a45, 0x117d43, 0x11804c,
+    0x118358, 0x11865a, 0x11896f, 0x118c6b, 0x118f7a, 0x119281, 0x119582, 0x119885,
+    0x119ba0, 0x119eb8, 0x11a1c0, 0x11a4e3, 0x11a7ed, 0x11aaf0, 0x11ae05, 0x11b130,
+    0x11b43c, 0x11b6ff, 0x11b9c9, 0x11bc95, 0x11bf73, 0x11c264, 0x11c548, 0x11c827,
+    0x11caf9, 0x11ce03, 0x11d0f4, 0x11d3e2, 0x11d6dd, 0x11d9d6, 0x11dcdf, 0x11dfe9,
+    0x11e2c3, 0x11e52a, 0x11e7b8, 0x11ea58, 0x11ed0c, 0x11efbe, 0x11f28d, 0x11f515,
+    0x11f77d, 0x11fa13, 0x11fca4, 0x11ff61, 0x120221, 0x1204f6, 0x1207d9, 0x120ab0,
+    0x120d7c, 0x121076, 0x12135d, 0x12166f, 0x12194c, 0x121c1e, 0x121f22, 0x1221ec,
+    0x12245f, 0x1226c8, 0x12297f, 0x122c3c, 0x122f10, 0x1231e7, 0x1234b2, 0x12376d,
+    0x123a5b, 0x123d3b, 0x124021, 0x124331, 0x12463b, 0x124928, 0x124c29, 0x124f04,
+    0x1251ee, 0x125488, 0x125754, 0x125a39, 0x125d20, 0x126006, 0x1262f3, 0x126607,
+    0x1268e2, 0x126be3, 0x126edc, 0x1271c8, 0x1274da, 0x1277f2, 0x127ad5, 0x127da0,
+    0x12808e, 0x12837c, 0x12866e, 0x128979, 0x128c94, 0x128f9c, 0x1292b4, 0x12957c,
+    0x12984c, 0x129b27, 0x129e02, 0x12a0ef, 0x12a3da, 0x12a6cf, 0x12a9c4, 0x12accf,
+    0x12afc7, 0x12b2ca, 0x12b5d0, 0x12b8d8, 0x12bbf0, 0x12bee7, 0x12c1ff, 0x12c4f4,
+    0x12c7c9, 0x12cab0, 0x12cdae, 0x12d08a, 0x12d396, 0x12d6b8, 0x12d9ad, 0x12dc2c,
+    0x12dec9, 0x12e190, 0x12e454, 0x12e723, 0x12ea04, 0x12ed00, 0x12efe9, 0x12f2d0,
+    0x12f5b8, 0x12f8b1, 0x12fba3, 0x12fe91, 0x13019b, 0x130499, 0x130798, 0x130a7a,
+    0x130d82, 0x1310ad, 0x1313b6, 0x1316c4, 0x1319b8, 0x131ccd, 0x131fd4, 0x1322e3,
+    0x1325d9, 0x1328cb, 0x132bba, 0x132ecd, 0x1331db, 0x1334ee, 0x133815, 0x133afb,
+    0x133dfe, 0x1340e9, 0x1343da, 0x1346df, 0x1349de, 0x134cde, 0x134fe6, 0x1352fe,
+    0x13560b, 0x135924, 0x135c38, 0x135f48, 0x136253, 0x13655d, 0x136866, 0x136b78,
+    0x136e91, 0x1371b2, 0x1374ae, 0x137797, 0x137a8a, 0x137da6, 0x1380d1, 0x1383f2,
+    0x1386ee, 0x1389aa, 0x138c75, 0x138f43, 0x13922d, 0x1394ea, 0x1397cc, 0x139acd,
+    0x139dc7, 0x13a094, 0x13a375, 0x13a677, 0x13a992, 0x13acab, 0x13afae, 0x13b2cb,
+    0x13b5f3, 0x13b91a, 0x13bbfc, 0x13bf0e, 0x13c13a, 0x13c40c, 0x13c720, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c,
+    0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13ca4c, 0x13cb69,
+    0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7,
+    0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7,
+    0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7,
+    0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7,
+    0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7, 0x13ccc7,
+    0x13ccc7, 0x13ced2, 0x13d0c3, 0x13d2e8, 0x13d4e4, 0x13d6f6, 0x13d8fe, 0x13db0f,
+    0x13dcea, 0x13deca, 0x13e0f9, 0x13e2e4, 0x13e4c6, 0x13e6cd, 0x13e8ee, 0x13ead5,
+    0x13ecbe, 0x13ef01, 0x13f12c, 0x13f36b, 0x13f588, 0x13f7a4, 0x13f982, 0x13fb48,
+    0x13fd2c, 0x13ff17, 0x140146, 0x14039f, 0x140613, 0x140827, 0x140a0c, 0x140c00,
+    0x140dc2, 0x140f9a, 0x14119d, 0x1413b9, 0x141595, 0x14177b, 0x1419ce, 0x141c0f,
+    0x141e79, 0x1420bb, 0x142306, 0x142565, 0x14279e, 0x1429b3, 0x142bd8, 0x142e43,
+    0x14306a, 0x143286, 0x1434f0, 0x14371e, 0x143918, 0x143b33, 0x143db5, 0x144028,
+    0x144294, 0x1444d2, 0x1446dc, 0x1448d7, 0x144aa2, 0x144c93, 0x144eb7, 0x1450fe,
+    0x14539f, 0x145605, 0x145846, 0x145a44, 0x145c40, 0x145e08, 0x145fd0, 0x1461fe,
+    0x146404, 0x146619, 0x14681f, 0x146a4d, 0x146c82, 0x146ebc, 0x1470e8, 0x147301,
+    0x14754b, 0x147752, 0x147957, 0x147b72, 0x147da6, 0x147fae, 0x1481a7, 0x1483e2,
+    0x1485d1, 0x1487b5, 0x1489d7, 0x148c19, 0x148e76, 0x14909b, 0x1492cd, 0x1494c4,
+    0x1496b5, 0x149885, 0x149a5c, 0x149ca2, 0x149edd, 0x14a170, 0x14a3a6, 0x14a5d8,
+    0x14a7c6, 0x14a9ae, 0x14ab5f, 0x14ad14, 0x14af48, 0x14b146, 0x14b343, 0x14b551,
+    0x14b773, 0x14b9c8, 0x14bbf6, 0x14be1f, 0x14c037, 0x14c27e, 0x14c47f, 0x14c681,
+    0x14c8cb, 0x14cae1, 0x14ccea, 0x14cef1, 0x14d136, 0x14d31d, 0x14d4f5, 0x14d72d,
+    0x14d94c, 0x14dba1, 0x14ddbc, 0x14dfee, 0x14e1de, 0x14e3c3, 0x14e5a2, 0x14e782,
+    0x14e9db, 0x14ec3a, 0x14eec9, 0x14f0fe, 0x14f32c, 0x14f51d, 0x14f6e7, 0x14f8a8,
+    0x14fa7d, 0x14fcb3, 0x14feac, 0x1500a4, 0x1502d0, 0x1504ec, 0x150748, 0x150970,
+    0x150b9d, 0x150dd4, 0x151014, 0x15121d, 0x15141e, 0x15167c, 0x151895, 0x151aa0,
+    0x151cd5, 0x151f28, 0x15213e, 0x152340, 0x152546, 0x15273f, 0x15295a, 0x152b55,
+    0x152d52, 0x152f76, 0x15317a, 0x15339d, 0x1535a3, 0x1537d6, 0x153a31, 0x153caa,
+    0x153ec0, 0x1540b7, 0x1542e3, 0x1544cf, 0x1546c6, 0x1548bf, 0x154ac0, 0x154cbf,
+    0x154eac, 0x1550d6, 0x1552f9, 0x15554a, 0x155761, 0x15596a, 0x155b8d, 0x155d8d,
+    0x155f9c, 0x1561b1, 0x1563fa, 0x1565ea, 0x1567d0, 0x156a16, 0x156c2c, 0x156e2f,
+    0x157045, 0x1572ac, 0x15750c, 0x157770, 0x1579c0, 0x157bdb, 0x157de6, 0x157fc6,
+    0x1581c7, 0x1583e4, 0x158620, 0x1588a2, 0x158ae7, 0x158d17, 0x158f0c, 0x159118,
+    0x1592e3, 0x1594ab, 0x1596fa, 0x159915, 0x159b1d, 0x159d23, 0x159f61, 0x15a1a5,
+    0x15a3f9, 0x15a62b, 0x15a847, 0x15aa9a, 0x15aca5, 0x15aeb8, 0x15b0ef, 0x15b347,
+    0x15b552, 0x15b74c, 0x15b9ad, 0x15bbc4, 0x15bde7, 0x15c019, 0x15c255, 0x15c4ad,
+    0x15c6d1, 0x15c915, 0x15cb2c, 0x15cd5b, 0x15cf63, 0x15d178, 0x15d3d0, 0x15d615,
+    0x15d89a, 0x15dad8, 0x15dd12, 0x15df2e, 0x15e151, 0x15e33f, 0x15e52a, 0x15e76d,
+    0x15e973, 0x15eb7d, 0x15ed90, 0x15efb3, 0x15f20d, 0x15f43f, 0x15f660, 0x15f870,
+    0x15faac, 0x15fca8, 0x15feaa, 0x160107, 0x16032a, 0x160528, 0x16072f, 0x160985,
+    0x160b99, 0x160dae, 0x161001, 0x16123a, 0x16148d, 0x1616b4, 0x1618f4, 0x161b13,
+    0x161d33, 0x161f4e, 0x162162, 0x1623c8, 0x162625, 0x1628a3, 0x162ae1, 0x162d19,
+    0x162f45, 0x163147, 0x163341, 0x16353f, 0x163780, 0x16397d, 0x163b75, 0x163db4,
+    0x163fd4, 0x164218, 0x16442d, 0x164650, 0x164878, 0x164aa4, 0x164cbb, 0x164eba,
+    0x1650f5, 0x1652fa, 0x165509, 0x16574d, 0x1659a8, 0x165bba, 0x165dbf, 0x166002,
+    0x16622d, 0x166471, 0x16669c, 0x1668d0, 0x166af0, 0x166cf0, 0x166f05, 0x16711d,
+    0x167385, 0x1675f1, 0x167865, 0x167aab, 0x167cca, 0x167eec, 0x1680d4, 0x1682cc,
+    0x1684eb, 0x168723, 0x168933, 0x168b18, 0x168cf3, 0x168edc, 0x16910b, 0x1692f7,
+    0x1694d4, 0x16970d, 0x169904, 0x169ad4, 0x169cc0, 0x169efb, 0x16a0e0, 0x16a2a9,
+    0x16a4ea, 0x16a6f2, 0x16a906, 0x16aafb, 0x16acff, 0x16af1e, 0x16b14b, 0x16b340,
+    0x16b51a, 0x16b744, 0x16b93c, 0x16bb4f, 0x16bd49, 0x16bf53, 0x16c1c7, 0x16c3f5,
+    0x16c5f5, 0x16c7dd, 0x16c9fe, 0x16cbe1, 0x16cdc8, 0x16cfbd, 0x16d182, 0x16d354,
+    0x16d534, 0x16d754, 0x16d98d, 0x16dbc8, 0x16de01, 0x16e020, 0x16e265, 0x16e46d,
+    0x16e66e, 0x16e899, 0x16eadb, 0x16ecea, 0x16eee8, 0x16f13e, 0x16f349, 0x16f551,
+    0x16f75f, 0x16f96b, 0x16fbac, 0x16fdad, 0x16ffa4, 0x170185, 0x170396, 0x170594,
+    0x17079c, 0x1709b9, 0x170bca, 0x170e35, 0x171048, 0x171249, 0x17144e, 0x171669,
+    0x171861, 0x171a48, 0x171c3f, 0x171e1f, 0x172020, 0x17221e, 0x172428, 0x172670,
+    0x172895, 0x172ab9, 0x172cd0, 0x172f0d, 0x173100, 0x1732ef, 0x173536, 0x17375a,
+    0x17395e, 0x173b6b, 0x173dbb, 0x173fc1, 0x1741c6, 0x174405, 0x17462c, 0x174878,
+    0x174a91, 0x174cb3, 0x174ec8, 0x1750e0, 0x1752ea, 0x1754eb, 0x17573b, 0x17598a,
+    0x175bfe, 0x175e28, 0x17604c, 0x176268, 0x17645d, 0x176651, 0x176843, 0x176a6d,
+    0x176c58, 0x176e3b, 0x17703e, 0x17722d, 0x17747b, 0x17768b, 0x17789b, 0x177ac1,
+    0x177cf7, 0x177ee0, 0x1780c7, 0x17831e, 0x178525, 0x17871b, 0x178946, 0x178b88,
+    0x178d7f, 0x178f70, 0x179197, 0x1793b6, 0x1795fc, 0x179803, 0x179a03, 0x179c12,
+    0x179e06, 0x17a01b, 0x17a219, 0x17a444, 0x17a69e, 0x17a91a, 0x17ab28, 0x17ad15,
+    0x17af37, 0x17b10d, 0x17b2e4, 0x17b4d4, 0x17b6d9, 0x17b8c0, 0x17baa1, 0x17bcc6,
+    0x17beea, 0x17c13e, 0x17c365, 0x17c589, 0x17c7d6, 0x17c9f8, 0x17cbfb, 0x17ce11,
+    0x17d06d, 0x17d27f, 0x17d47e, 0x17d6e1, 0x17d91a, 0x17db55, 0x17dd7c, 0x17dfbe,
+    0x17e204, 0x17e44a, 0x17e672, 0x17e87d, 0x17ead1, 0x17ecf6, 0x17ef2e, 0x17f15f,
+    0x17f3a0, 0x17f62c, 0x17f874, 0x17faa9, 0x17fcc4, 0x17ff0f, 0x18011f, 0x18032f,
+    0x180559, 0x18075a, 0x18095e, 0x180b58, 0x180d80, 0x180fac, 0x1811df, 0x18140b,
+    0x18161f, 0x18185f, 0x181a62, 0x181c60, 0x181e8c, 0x1820ca, 0x1822dd, 0x1824e4,
+    0x182732, 0x18293f, 0x182b52, 0x182d5a, 0x182f60, 0x1831a6, 0x1833ab, 0x1835aa,
+    0x1837a0, 0x1839c8, 0x183bc9, 0x183dce, 0x183ffc, 0x184220, 0x1844a5, 0x1846ce,
+    0x1848e2, 0x184aea, 0x184cfd, 0x184ee8, 0x1850c2, 0x1852c1, 0x1854a4, 0x1856af,
+    0x1858cc, 0x185afe, 0x185d4b, 0x185f71, 0x1861a6, 0x1863c2, 0x186605, 0x1867f2,
+    0x1869de, 0x186c36, 0x186e52, 0x187049, 0x18724f, 0x1874a9, 0x187699, 0x18787e,
+    0x187adb, 0x187d1d, 0x187f76, 0x1881a3, 0x1883e7, 0x1885cf, 0x1887a7, 0x188990,
+    0x188b7d, 0x188de8, 0x18904c, 0x1892da, 0x189522, 0x18975f, 0x189957, 0x189b2a,
+    0x189d05, 0x189ef2, 0x18a136, 0x18a325, 0x18a510, 0x18a73f, 0x18a95b, 0x18abbc,
+    0x18ade5, 0x18b004, 0x18b227, 0x18b45d, 0x18b66c, 0x18b875, 0x18bad7, 0x18bcee,
+    0x18beeb, 0x18c117, 0x18c358, 0x18c551, 0x18c751, 0x18c9bb, 0x18cc10, 0x18ce77,
+    0x18d093, 0x18d2aa, 0x18d4b1, 0x18d696, 0x18d899, 0x18da9d, 0x18dcde, 0x18df30,
+    0x18e19d, 0x18e3c7, 0x18e5be, 0x18e7ca, 0x18e99a, 0x18eb71, 0x18ed73, 0x18ef93,
+    0x18f19b, 0x18f396, 0x18f5d7, 0x18f802, 0x18fa45, 0x18fc66, 0x18fe90, 0x1900d6,
+    0x1902e1, 0x1904e9, 0x1906f9, 0x190948, 0x190b4a, 0x190d49, 0x190f9f, 0x1911ad,
+    0x1913c4, 0x1915cd, 0x191800, 0x191a44, 0x191c8c, 0x191ebe, 0x1920c9, 0x1922ed,
+    0x1924e4, 0x1926fb, 0x192929, 0x192b72, 0x192e11, 0x193071, 0x1932ab, 0x1934ba,
+    0x1936e0, 0x1938c2, 0x193aa2, 0x193cd4, 0x193ede, 0x1940e8, 0x1942dc, 0x194506,
+    0x194736, 0x194963, 0x194b8f, 0x194da1, 0x194fe2, 0x1951ee, 0x195401, 0x19562e,
+    0x195862, 0x195a74, 0x195c7a, 0x195ece, 0x1960f0, 0x196333, 0x19655f, 0x196788,
+    0x1969d8, 0x196bf2, 0x196e0d, 0x197028, 0x197280, 0x1974ab, 0x1976e0, 0x197917,
+    0x197b3e, 0x197dbb, 0x197fe8, 0x198202, 0x19842c, 0x19866f, 0x198886, 0x198a8c,
+    0x198ca7, 0x198ea2, 0x1990b5, 0x199131, 0x19930f, 0x1994f2, 0x199668, 0x1997df,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d, 0x19998d,
+    0x19998d, 0x199c19, 0x199efe, 0x19a1c0, 0x19a47a, 0x19a737, 0x19a9e5, 0x19ac71,
+    0x19af0e, 0x19b1c1, 0x19b47a, 0x19b725, 0x19b9e5, 0x19bcae, 0x19bf5c, 0x19c1fa,
+    0x19c4bc, 0x19c76f, 0x19ca1c, 0x19cd03, 0x19cf95, 0x19d226, 0x19d4b1, 0x19d767,
+    0x19da06, 0x19dcff, 0x19dfc2, 0x19e26f, 0x19e54c, 0x19e872, 0x19eb53, 0x19edef,
+    0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099,
+    0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099,
+    0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099,
+    0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099,
+    0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099,
+    0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f099,
+    0x19f099, 0x19f099, 0x19f099, 0x19f099, 0x19f16d, 0x19f240, 0x19f240, 0x19f240,
+    0x19f240, 0x19f240, 0x19f240, 0x19f240, 0x19f240, 0x19f240, 0x19f240, 0x19f240,
+    0x19f240, 0x19f38a, 0x19f4e6, 0x19f69f, 0x19f81e, 0x19f919, 0x19fa06, 0x19fadf,
+    0x19fbf8, 0x19fd0c, 0x19fe0e, 0x19fedb, 0x19ffc3, 0x1a00f2, 0x1a026f, 0x1a039c,
+};
+#endif /* U8G2_USE_LARGE_FONTS */
+
+#endif // _U8G2_FONT_UNIFONT_T_CJK_INDEX_H_
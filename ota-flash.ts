@@ -5,17 +5,44 @@
  * Discovers ESP32 display devices via mDNS and flashes firmware via OTA.
  *
  * Usage:
- *   bun ota-flash.ts [--all] [--firmware <path>]
+ *   bun ota-flash.ts [--all] [--firmware <path>] [--parallel <n>] [--canary <n>] [--soak <s>]
  *
  * Options:
  *   --all         Flash all discovered devices without prompting
  *   --ip          Flash a specific device by IP address (skips mDNS discovery)
  *   --firmware    Path to firmware.bin (default: .pio/build/esp32s3/firmware.bin)
+ *   --parallel    Devices flashed at once (default: 3)
+ *   --delta-from  Build the image a patch is made against (e.g. the last release)
+ *   --canary      Devices flashed and verified before the rest (default: 1)
+ *   --soak        Seconds a flashed device must stay up before its health check (default: 30)
+ *   --max-failures       Failed devices tolerated before the rollout halts (default: 0)
+ *   --max-frame-regress  Allowed rise in frame time p95, percent (default: 25)
+ *   --no-verify   Skip the post-reboot health check
+ *
+ * Panels with the streaming endpoint (POST /api/ota) get the raw image in
+ * one request and flash it from PSRAM; older firmware, or a panel short of
+ * PSRAM, falls back to ElegantOTA's /ota/start + /ota/upload.
+ *
+ * Panels that list "gzip" in /api/info's ota_formats get the image
+ * gzip-compressed and decompress it while it arrives.
+ *
+ * With --delta-from, a panel whose running image (app_sha256 in /api/info)
+ * is that build gets a binary patch instead of the whole image; the rest
+ * get the full image. Panels already running the image are skipped.
+ *
+ * Rollouts to several devices are staged: the canaries go first, and only
+ * when every one of them comes back healthy are the rest flashed, --parallel
+ * at a time. A device is healthy when, after the soak, it is still on the
+ * boot it came up with (no crash loop), runs the new image, and its free
+ * heap and frame time p95 (/api/info, /api/perf) haven't regressed past the
+ * thresholds against what it showed before the update. Past --max-failures
+ * failed devices no new ones are started.
  *
  * Examples:
  *   bun ota-flash.ts              # Interactive device selection
  *   bun ota-flash.ts --all        # Flash all discovered devices
  *   bun ota-flash.ts --ip 10.0.1.44  # Flash specific device by IP
+ *   bun ota-flash.ts --all --parallel 8 --canary 2   # Fleet rollout
  *   bun ota-flash.ts -f custom.bin --all
  */
 
@@ -24,6 +51,7 @@ import * as fs from 'fs';
 import * as path from 'path';
 import * as crypto from 'crypto';
 import * as readline from 'readline';
+import * as zlib from 'zlib';
 
 interface DiscoveredDevice {
   id: string;
@@ -34,13 +62,37 @@ interface DiscoveredDevice {
 
 const DEFAULT_FIRMWARE_PATH = '.pio/build/esp32s3/firmware.bin';
 const DISCOVERY_TIMEOUT_MS = 5000;
+const DEFAULT_PARALLEL = 3;
+const DEFAULT_CANARY = 1;
+const DEFAULT_SOAK_S = 30;
+const DEFAULT_MAX_FRAME_REGRESS_PCT = 25;
+const MAX_HEAP_DROP_PCT = 20;          // Free internal heap lost to the update
+const MIN_PERF_FRAMES = 20;            // Frames /api/perf needs before its p95 means anything
+
+// Post-update health thresholds
+interface HealthPolicy {
+  soakMs: number;
+  maxFrameRegressPct: number;
+  maxHeapDropPct: number;
+}
 
 // Parse command line arguments
-function parseArgs(): { flashAll: boolean; firmwarePath: string; ip: string | null } {
+function parseArgs(): { flashAll: boolean; firmwarePath: string; ip: string | null; parallel: number; deltaFrom: string | null;
+                        canary: number; maxFailures: number; verify: boolean; policy: HealthPolicy } {
   const args = process.argv.slice(2);
   let flashAll = false;
   let firmwarePath = DEFAULT_FIRMWARE_PATH;
   let ip: string | null = null;
+  let parallel = DEFAULT_PARALLEL;
+  let deltaFrom: string | null = null;
+  let canary = DEFAULT_CANARY;
+  let maxFailures = 0;
+  let verify = true;
+  const policy: HealthPolicy = {
+    soakMs: DEFAULT_SOAK_S * 1000,
+    maxFrameRegressPct: DEFAULT_MAX_FRAME_REGRESS_PCT,
+    maxHeapDropPct: MAX_HEAP_DROP_PCT
+  };
 
   for (let i = 0; i < args.length; i++) {
     if (args[i] === '--all' || args[i] === '-a') {
@@ -49,10 +101,24 @@ function parseArgs(): { flashAll: boolean; firmwarePath: string; ip: string | nu
       firmwarePath = args[++i];
     } else if (args[i] === '--ip' || args[i] === '-i') {
       ip = args[++i];
+    } else if (args[i] === '--parallel' || args[i] === '-p') {
+      parallel = Math.max(1, parseInt(args[++i], 10) || 1);
+    } else if (args[i] === '--delta-from' || args[i] === '-d') {
+      deltaFrom = args[++i];
+    } else if (args[i] === '--canary' || args[i] === '-c') {
+      canary = Math.max(0, parseInt(args[++i], 10) || 0);
+    } else if (args[i] === '--soak' || args[i] === '-s') {
+      policy.soakMs = Math.max(0, parseInt(args[++i], 10) || 0) * 1000;
+    } else if (args[i] === '--max-failures') {
+      maxFailures = Math.max(0, parseInt(args[++i], 10) || 0);
+    } else if (args[i] === '--max-frame-regress') {
+      policy.maxFrameRegressPct = Math.max(0, parseFloat(args[++i]) || 0);
+    } else if (args[i] === '--no-verify') {
+      verify = false;
     }
   }
 
-  return { flashAll, firmwarePath, ip };
+  return { flashAll, firmwarePath, ip, parallel, deltaFrom, canary, maxFailures, verify, policy };
 }
 
 // Calculate MD5 hash of file
@@ -61,6 +127,107 @@ function calculateMD5(filePath: string): string {
   return crypto.createHash('md5').update(fileBuffer).digest('hex');
 }
 
+// ============================================================================
+// Delta patches (format in include/ota_delta.h)
+// ============================================================================
+
+const DELTA_HEADER_SIZE = 80;
+const DELTA_MIN_MATCH = 16;
+const DELTA_HASH_BITS = 22;
+const DELTA_MAX_CANDIDATES = 32;
+
+// SHA-256 the bootloader computes for an image: everything before the
+// digest esptool appends. Null if the image carries no appended digest.
+function imageSha256(image: Buffer): Buffer | null {
+  if (image.length <= 32) return null;
+  const digest = crypto.createHash('sha256').update(image.subarray(0, image.length - 32)).digest();
+  return digest.equals(image.subarray(image.length - 32)) ? digest : null;
+}
+
+function hash8(buf: Buffer, i: number): number {
+  // 8 bytes folded into DELTA_HASH_BITS
+  let h = (buf.readUInt32LE(i) ^ Math.imul(buf.readUInt32LE(i + 4), 0x9e3779b1)) >>> 0;
+  h = Math.imul(h ^ (h >>> 15), 0x85ebca6b) >>> 0;
+  return h >>> (32 - DELTA_HASH_BITS);
+}
+
+// bsdiff-style diff: exact seeds from a hash index of the old image, each
+// extended forward while at least half the bytes still match, so code that
+// only moved (shifted addresses) becomes add bytes that are mostly zero
+function buildDelta(oldImage: Buffer, newImage: Buffer): Buffer {
+  const head = new Int32Array(1 << DELTA_HASH_BITS).fill(-1);
+  const chain = new Int32Array(oldImage.length);
+  for (let i = 0; i + 8 <= oldImage.length; i++) {
+    const h = hash8(oldImage, i);
+    chain[i] = head[h];
+    head[h] = i;
+  }
+
+  const records: Buffer[] = [];
+  let lastNew = 0;
+  let lastOld = 0;
+
+  // Emit [lastNew, end): add bytes against the old image at lastOld while
+  // they pay off, the rest as extra, then seek to nextOld
+  const emit = (end: number, nextOld: number) => {
+    let score = 0, best = 0, addLen = 0;
+    for (let i = 0; lastNew + i < end && lastOld + i < oldImage.length; i++) {
+      if (oldImage[lastOld + i] === newImage[lastNew + i]) score++;
+      if (score * 2 - (i + 1) > best * 2 - addLen) {
+        best = score;
+        addLen = i + 1;
+      }
+    }
+    const extraLen = end - lastNew - addLen;
+    const control = Buffer.alloc(12);
+    control.writeUInt32LE(addLen, 0);
+    control.writeUInt32LE(extraLen, 4);
+    control.writeInt32LE(nextOld - (lastOld + addLen), 8);
+
+    const add = Buffer.alloc(addLen);
+    for (let i = 0; i < addLen; i++) {
+      add[i] = (newImage[lastNew + i] - oldImage[lastOld + i]) & 0xff;
+    }
+    records.push(control, add, newImage.subarray(lastNew + addLen, end));
+    lastNew = end;
+    lastOld = nextOld;
+  };
+
+  let p = 0;
+  while (p + 8 <= newImage.length) {
+    let bestLen = 0, bestOld = -1;
+    let candidates = 0;
+    for (let o = head[hash8(newImage, p)]; o >= 0 && candidates < DELTA_MAX_CANDIDATES; o = chain[o], candidates++) {
+      let len = 0;
+      while (p + len < newImage.length && o + len < oldImage.length && newImage[p + len] === oldImage[o + len]) len++;
+      if (len > bestLen) {
+        bestLen = len;
+        bestOld = o;
+      }
+    }
+
+    if (bestLen < DELTA_MIN_MATCH) {
+      p++;
+      continue;
+    }
+    // Same alignment as the record being built: it already covers this
+    if (bestOld - p !== lastOld - lastNew) {
+      emit(p, bestOld);
+    }
+    p += bestLen;
+  }
+  emit(newImage.length, lastOld);
+
+  const header = Buffer.alloc(DELTA_HEADER_SIZE);
+  header.write('ESPD', 0, 'ascii');
+  header[4] = 1;
+  header.writeUInt32LE(oldImage.length, 8);
+  header.writeUInt32LE(newImage.length, 12);
+  imageSha256(oldImage)!.copy(header, 16);
+  imageSha256(newImage)!.copy(header, 48);
+  return Buffer.concat([header, zlib.deflateSync(Buffer.concat(records), { level: 9 })]);
+}
+
 // Discover devices via mDNS
 async function discoverDevices(): Promise<DiscoveredDevice[]> {
   return new Promise((resolve) => {
@@ -141,8 +308,22 @@ async function selectDevices(devices: DiscoveredDevice[]): Promise<DiscoveredDev
   });
 }
 
-// Poll device until it reboots (uptime < threshold)
-async function waitForReboot(ip: string, timeoutMs: number = 60000): Promise<boolean> {
+// Fetch /api/info, null when the device doesn't answer
+async function fetchInfo(ip: string): Promise<any | null> {
+  try {
+    const controller = new AbortController();
+    const timeoutId = setTimeout(() => controller.abort(), 2000);
+    const response = await fetch(`http://${ip}/api/info`, { signal: controller.signal });
+    clearTimeout(timeoutId);
+    return response.ok ? await response.json() : null;
+  } catch {
+    return null;
+  }
+}
+
+// Poll device until it reboots (new boot id, or uptime < threshold on
+// firmware that doesn't report one)
+async function waitForReboot(ip: string, bootId: string | null, timeoutMs: number = 60000): Promise<boolean> {
   const startTime = Date.now();
   const pollInterval = 1000;
   const uptimeThreshold = 15; // Device considered rebooted if uptime < 15s
@@ -151,23 +332,13 @@ async function waitForReboot(ip: string, timeoutMs: number = 60000): Promise<boo
   await new Promise(r => setTimeout(r, 2000));
 
   while (Date.now() - startTime < timeoutMs) {
-    try {
-      const controller = new AbortController();
-      const timeoutId = setTimeout(() => controller.abort(), 2000);
-
-      const response = await fetch(`http://${ip}/api/info`, {
-        signal: controller.signal
-      });
-      clearTimeout(timeoutId);
-
-      if (response.ok) {
-        const data = await response.json();
-        if (data.uptime_seconds < uptimeThreshold) {
-          return true; // Device has rebooted
-        }
+    const data = await fetchInfo(ip);
+    if (data) {
+      if (bootId && data.boot_id) {
+        if (data.boot_id !== bootId) return true;
+      } else if (data.uptime_seconds < uptimeThreshold) {
+        return true; // Device has rebooted
       }
-    } catch {
-      // Device not responding yet, keep polling
     }
 
     await new Promise(r => setTimeout(r, pollInterval));
@@ -176,26 +347,175 @@ async function waitForReboot(ip: string, timeoutMs: number = 60000): Promise<boo
   return false; // Timeout
 }
 
-// Flash firmware to a single device
-async function flashDevice(device: DiscoveredDevice, firmwarePath: string, md5Hash: string): Promise<boolean> {
+// Fetch /api/perf, null when the device doesn't answer
+async function fetchPerf(ip: string): Promise<any | null> {
+  try {
+    const controller = new AbortController();
+    const timeoutId = setTimeout(() => controller.abort(), 2000);
+    const response = await fetch(`http://${ip}/api/perf`, { signal: controller.signal });
+    clearTimeout(timeoutId);
+    return response.ok ? await response.json() : null;
+  } catch {
+    return null;
+  }
+}
+
+// What a device's health is judged on
+interface HealthSample {
+  bootId: string | null;
+  appSha256: string | null;
+  freeHeap: number;
+  frameP95: number | null;   // Null until enough frames were rendered
+}
+
+async function sampleHealth(ip: string): Promise<HealthSample | null> {
+  const info = await fetchInfo(ip);
+  if (!info) return null;
+  const perf = await fetchPerf(ip);
+  const frame = perf?.metrics?.frame_us;
+  return {
+    bootId: info.boot_id ?? null,
+    appSha256: info.app_sha256 ?? null,
+    freeHeap: info.free_heap ?? 0,
+    frameP95: frame && frame.count >= MIN_PERF_FRAMES ? frame.p95 : null
+  };
+}
+
+// After the reboot: the device must stay on one boot through the soak, run
+// the new image, and not have lost heap or frame time against before
+async function verifyHealth(device: DiscoveredDevice, before: HealthSample | null, expectedSha: string | null,
+                            policy: HealthPolicy, log: (msg: string) => void): Promise<boolean> {
+  let first = await sampleHealth(device.ip);
+  // ElegantOTA reports success before the device restarts
+  if (first && before?.bootId && first.bootId === before.bootId) {
+    first = await waitForReboot(device.ip, before.bootId) ? await sampleHealth(device.ip) : null;
+  }
+  if (!first) {
+    log(`❌ Not answering after the reboot`);
+    return false;
+  }
+
+  log(`Soaking for ${policy.soakMs / 1000}s...`);
+  const soakEnd = Date.now() + policy.soakMs;
+  while (Date.now() < soakEnd) {
+    await new Promise(r => setTimeout(r, Math.min(5000, Math.max(0, soakEnd - Date.now()))));
+    const sample = await sampleHealth(device.ip);
+    if (sample?.bootId && first.bootId && sample.bootId !== first.bootId) {
+      log(`❌ Rebooted again during the soak (crash?)`);
+      return false;
+    }
+  }
+  const after = await sampleHealth(device.ip);
+  if (!after) {
+    log(`❌ Stopped answering during the soak`);
+    return false;
+  }
+
+  const problems: string[] = [];
+  if (expectedSha && after.appSha256 && after.appSha256 !== expectedSha) {
+    problems.push('still running the old image (rolled back?)');
+  }
+  if (before && before.freeHeap > 0) {
+    const dropPct = (before.freeHeap - after.freeHeap) * 100 / before.freeHeap;
+    if (dropPct > policy.maxHeapDropPct) {
+      problems.push(`free heap ${before.freeHeap} -> ${after.freeHeap} (-${dropPct.toFixed(0)}%)`);
+    }
+  }
+  if (before?.frameP95 && after.frameP95 !== null) {
+    const risePct = (after.frameP95 - before.frameP95) * 100 / before.frameP95;
+    if (risePct > policy.maxFrameRegressPct) {
+      problems.push(`frame p95 ${before.frameP95} -> ${after.frameP95} us (+${risePct.toFixed(0)}%)`);
+    }
+  }
+
+  if (problems.length > 0) {
+    log(`❌ Unhealthy: ${problems.join(', ')}`);
+    return false;
+  }
+  const frameNote = after.frameP95 !== null ? `, frame p95 ${after.frameP95} us` : '';
+  log(`💚 Healthy: free heap ${after.freeHeap}${frameNote}`);
+  return true;
+}
+
+// Streaming update: one raw POST (image, patch or gzip), the panel flashes
+// from PSRAM and reboots. 'unsupported' when the panel can't take it this way.
+async function flashDeviceStream(device: DiscoveredDevice, body: Buffer, md5Hash: string, imageSize: number,
+                                 bootId: string | null, log: (msg: string) => void): Promise<boolean | 'unsupported'> {
+  const baseUrl = `http://${device.ip}`;
+  const started = Date.now();
+
+  log(`Streaming ${(body.length / 1024).toFixed(0)} KB...`);
+  let response: Response;
+  try {
+    response = await fetch(`${baseUrl}/api/ota?md5=${md5Hash}&size=${imageSize}`, {
+      method: 'POST',
+      headers: { 'Content-Type': 'application/octet-stream' },
+      body
+    });
+  } catch (error: any) {
+    log(`❌ Upload failed: ${error.message}`);
+    return false;
+  }
+
+  // Older firmware (no route) or not enough PSRAM to stage the image
+  if (response.status === 404 || response.status === 507) {
+    const body = await response.json().catch(() => ({})) as { error?: string };
+    log(`Streaming update unavailable${body.error ? ` (${body.error})` : ''}, using ElegantOTA`);
+    return 'unsupported';
+  }
+  if (response.status !== 202) {
+    const body = await response.json().catch(() => ({})) as { error?: string };
+    log(`❌ Device refused the image: ${response.status}${body.error ? ` ${body.error}` : ''}`);
+    return false;
+  }
+  log(`Uploaded in ${((Date.now() - started) / 1000).toFixed(1)}s, flashing...`);
+
+  // The writer keeps going after the 202; a failure shows up here
+  while (Date.now() - started < 120000) {
+    try {
+      const status = await fetch(`${baseUrl}/api/ota`).then(r => r.json()) as { state: string; error?: string; total_ms?: number };
+      if (status.state === 'failed') {
+        log(`❌ Flash failed: ${status.error ?? 'unknown error'}`);
+        return false;
+      }
+      if (status.state === 'done') {
+        log(`Flashed in ${((status.total_ms ?? 0) / 1000).toFixed(1)}s, rebooting...`);
+        break;
+      }
+    } catch {
+      break; // Already rebooting
+    }
+    await new Promise(r => setTimeout(r, 500));
+  }
+
+  if (await waitForReboot(device.ip, bootId)) {
+    log(`✅ Flash successful! Device rebooted.`);
+    return true;
+  }
+  log(`❌ Timeout waiting for device to reboot`);
+  return false;
+}
+
+// ElegantOTA multipart upload
+async function flashDeviceElegant(device: DiscoveredDevice, firmware: Buffer, md5Hash: string,
+                                  bootId: string | null, log: (msg: string) => void): Promise<boolean> {
   const baseUrl = `http://${device.ip}`;
 
   try {
     // Step 1: Start OTA update
-    console.log(`   Starting OTA on ${device.name}...`);
+    log(`Starting OTA on ${device.name}...`);
     const startUrl = `${baseUrl}/ota/start?mode=fr&hash=${md5Hash}`;
     const startResponse = await fetch(startUrl);
 
     if (!startResponse.ok) {
-      console.error(`   ❌ Failed to start OTA: ${startResponse.status}`);
+      log(`❌ Failed to start OTA: ${startResponse.status}`);
       return false;
     }
 
     // Step 2: Upload firmware
-    console.log(`   Uploading firmware...`);
-    const firmwareBuffer = fs.readFileSync(firmwarePath);
+    log(`Uploading firmware...`);
     const formData = new FormData();
-    formData.append('file', new Blob([firmwareBuffer]), 'firmware.bin');
+    formData.append('file', new Blob([firmware]), 'firmware.bin');
 
     // Race between upload completing and detecting device reboot
     const uploadPromise = fetch(`${baseUrl}/ota/upload`, {
@@ -203,7 +523,7 @@ async function flashDevice(device: DiscoveredDevice, firmwarePath: string, md5Ha
       body: formData
     }).then(response => ({ type: 'upload' as const, response }));
 
-    const rebootPromise = waitForReboot(device.ip).then(rebooted => ({
+    const rebootPromise = waitForReboot(device.ip, bootId).then(rebooted => ({
       type: 'reboot' as const,
       rebooted
     }));
@@ -212,31 +532,76 @@ async function flashDevice(device: DiscoveredDevice, firmwarePath: string, md5Ha
 
     if (result.type === 'upload') {
       if (!result.response.ok) {
-        console.error(`   ❌ Failed to upload firmware: ${result.response.status}`);
+        log(`❌ Failed to upload firmware: ${result.response.status}`);
         return false;
       }
-      console.log(`   ✅ Flash successful! Device will reboot.`);
+      log(`✅ Flash successful! Device will reboot.`);
       return true;
     } else {
       // Reboot detected
       if (result.rebooted) {
-        console.log(`   ✅ Flash successful! Device rebooted.`);
+        log(`✅ Flash successful! Device rebooted.`);
         return true;
       } else {
-        console.error(`   ❌ Timeout waiting for device to reboot`);
+        log(`❌ Timeout waiting for device to reboot`);
         return false;
       }
     }
 
   } catch (error: any) {
-    console.error(`   ❌ Error: ${error.message}`);
+    log(`❌ Error: ${error.message}`);
     return false;
   }
 }
 
+// A patch and the running image it applies to
+interface DeltaPlan {
+  sourceSha256: string;
+  patch: Buffer;
+}
+
+// Flash firmware to a single device, then check its health unless policy is null
+async function flashDevice(device: DiscoveredDevice, firmware: Buffer, compressed: Buffer, md5Hash: string,
+                           tagged: boolean, delta: DeltaPlan | null, imageSha: string | null,
+                           policy: HealthPolicy | null): Promise<boolean> {
+  const log = (msg: string) => console.log(tagged ? `   [${device.name}] ${msg}` : `   ${msg}`);
+
+  const before = policy ? await sampleHealth(device.ip) : null;
+  const flashed = await flashImage(device, firmware, compressed, md5Hash, delta, log);
+  if (!flashed || !policy) {
+    return flashed;
+  }
+  return verifyHealth(device, before, imageSha, policy, log);
+}
+
+// Send the smallest body the device takes: patch, gzip, raw stream, ElegantOTA
+async function flashImage(device: DiscoveredDevice, firmware: Buffer, compressed: Buffer, md5Hash: string,
+                          delta: DeltaPlan | null, log: (msg: string) => void): Promise<boolean> {
+  const info = await fetchInfo(device.ip);
+  const bootId: string | null = info?.boot_id ?? null;
+
+  // The patch only fits panels running the build it was made from
+  if (delta && info?.app_sha256 === delta.sourceSha256) {
+    log(`Running the delta source, sending a ${(delta.patch.length / 1024).toFixed(0)} KB patch`);
+    const patched = await flashDeviceStream(device, delta.patch, md5Hash, firmware.length, bootId, log);
+    if (patched !== 'unsupported') {
+      return patched;
+    }
+  }
+
+  // Panels that decompress on the fly get the gzip image
+  const formats: string[] = info?.ota_formats ?? [];
+  const body = formats.includes('gzip') ? compressed : firmware;
+  const streamed = await flashDeviceStream(device, body, md5Hash, firmware.length, bootId, log);
+  if (streamed !== 'unsupported') {
+    return streamed;
+  }
+  return flashDeviceElegant(device, firmware, md5Hash, bootId, log);
+}
+
 // Main entry point
 async function main(): Promise<void> {
-  const { flashAll, firmwarePath, ip } = parseArgs();
+  const { flashAll, firmwarePath, ip, parallel, deltaFrom, canary, maxFailures, verify, policy } = parseArgs();
 
   // Check firmware exists
   const absoluteFirmwarePath = path.isAbsolute(firmwarePath)
@@ -254,7 +619,26 @@ async function main(): Promise<void> {
   const fileSize = fs.statSync(absoluteFirmwarePath).size;
   console.log(`📦 Firmware: ${path.basename(absoluteFirmwarePath)}`);
   console.log(`   Size: ${(fileSize / 1024).toFixed(1)} KB`);
-  console.log(`   MD5: ${md5Hash}\n`);
+  console.log(`   MD5: ${md5Hash}`);
+
+  const firmware = fs.readFileSync(absoluteFirmwarePath);
+  const compressed = zlib.gzipSync(firmware, { level: 9 });
+  console.log(`   Compressed: ${(compressed.length / 1024).toFixed(1)} KB ` +
+              `(${(compressed.length * 100 / firmware.length).toFixed(0)}%)\n`);
+  let delta: DeltaPlan | null = null;
+  if (deltaFrom) {
+    const source = fs.readFileSync(deltaFrom);
+    const sourceSha = imageSha256(source);
+    if (!sourceSha || !imageSha256(firmware)) {
+      console.error('❌ --delta-from needs images with an appended SHA-256 (esptool default)');
+      process.exit(1);
+    }
+    const started = Date.now();
+    const patch = buildDelta(source, firmware);
+    delta = { sourceSha256: sourceSha.toString('hex'), patch };
+    console.log(`🧩 Delta from ${path.basename(deltaFrom)}: ${(patch.length / 1024).toFixed(1)} KB ` +
+                `(${(patch.length * 100 / firmware.length).toFixed(1)}% of the image, built in ${Date.now() - started} ms)\n`);
+  }
 
   // Resolve target devices
   let selectedDevices: DiscoveredDevice[];
@@ -287,31 +671,84 @@ async function main(): Promise<void> {
     process.exit(0);
   }
 
-  // Flash selected devices
-  console.log(`\n🚀 Flashing ${selectedDevices.length} device(s)...\n`);
+  // Panels already on this image need nothing
+  const imageSha = imageSha256(firmware)?.toString('hex') ?? null;
+  if (imageSha) {
+    const running = await Promise.all(selectedDevices.map(d => fetchInfo(d.ip)));
+    const current = selectedDevices.filter((_, i) => running[i]?.app_sha256 === imageSha);
+    if (current.length > 0) {
+      console.log(`\n⏭️  Already running this image: ${current.map(d => d.name).join(', ')}`);
+      selectedDevices = selectedDevices.filter(d => !current.includes(d));
+    }
+    if (selectedDevices.length === 0) {
+      console.log('Nothing to flash.');
+      process.exit(0);
+    }
+  }
 
+  const healthPolicy = verify ? policy : null;
   let successCount = 0;
   let failCount = 0;
-
-  for (const device of selectedDevices) {
-    console.log(`\n📡 ${device.name} (${device.ip})`);
-    const success = await flashDevice(device, absoluteFirmwarePath, md5Hash);
-
-    if (success) {
-      successCount++;
-    } else {
-      failCount++;
+  let halted = false;
+  let canaryFailed = false;
+
+  // Flash devices, a few at a time; each one mostly waits on its own radio
+  // and flash, not on ours. Stops starting new ones once the rollout halts.
+  const flashWave = async (devices: DiscoveredDevice[], width: number) => {
+    const workers = Math.min(width, devices.length);
+    let next = 0;
+    const worker = async () => {
+      while (!halted && next < devices.length) {
+        const device = devices[next++];
+        console.log(`\n📡 ${device.name} (${device.ip})`);
+        const success = await flashDevice(device, firmware, compressed, md5Hash, workers > 1, delta,
+                                          imageSha, healthPolicy);
+
+        if (success) {
+          successCount++;
+        } else {
+          failCount++;
+          if (failCount > maxFailures) {
+            halted = true;
+          }
+        }
+      }
+    };
+    await Promise.all(Array.from({ length: workers }, worker));
+  };
+
+  // Canaries first, all of them healthy before anyone else gets the image
+  const canaryCount = selectedDevices.length > 1 ? Math.min(canary, selectedDevices.length - 1) : 0;
+  const canaries = selectedDevices.slice(0, canaryCount);
+  const rest = selectedDevices.slice(canaryCount);
+  const started = Date.now();
+
+  if (canaries.length > 0) {
+    console.log(`\n🐤 Canary: ${canaries.map(d => d.name).join(', ')}\n`);
+    await flashWave(canaries, canaries.length);
+    if (failCount > 0) {
+      halted = true;
+      canaryFailed = true;
     }
+  }
 
-    // Small delay between devices
-    if (selectedDevices.indexOf(device) < selectedDevices.length - 1) {
-      await new Promise(r => setTimeout(r, 1000));
-    }
+  if (!halted) {
+    const workers = Math.min(parallel, rest.length);
+    console.log(`\n🚀 Flashing ${rest.length} device(s), ${workers} at a time...\n`);
+    await flashWave(rest, parallel);
   }
 
   // Summary
+  const skipped = selectedDevices.length - successCount - failCount;
   console.log('\n' + '='.repeat(40));
-  console.log(`📊 Results: ${successCount} succeeded, ${failCount} failed`);
+  console.log(`📊 Results: ${successCount} succeeded, ${failCount} failed` +
+              (skipped > 0 ? `, ${skipped} not flashed` : '') +
+              ` in ${((Date.now() - started) / 1000).toFixed(0)}s`);
+  if (halted) {
+    console.log(canaryFailed
+      ? '🛑 Halted: the canary failed, the rest keep their firmware'
+      : `🛑 Halted after ${failCount} failure(s)`);
+  }
 
   if (failCount > 0) {
     process.exit(1);
@@ -0,0 +1,155 @@
+"""Compare two UI benchmark reports and fail if the candidate is slower.
+
+    python3 scripts/bench_compare.py baseline.json candidate.json
+    python3 scripts/bench_compare.py baseline.json http://<panel-ip>/api/bench
+
+A report is the JSON from GET /api/bench, or the line the *-bench build envs
+print to serial when the boot run finishes. Scenarios are matched by theme
+and button count. For each metric the median ratio (candidate / baseline)
+over the matched scenarios is printed. The exit code is 1 when a metric got
+worse by more than --max-regress, or when render p95 didn't improve by at
+least --min-gain (e.g. --min-gain 5 to require a 5% faster renderer from
+env:esp32s3-perf).
+
+Reports from env:esp32s3-gfxbench (bench/gfx_bench.cpp) are matched by
+primitive instead. Each primitive's per-call, batched and writeback times
+are compared; --max-regress applies to every primitive and --min-gain to the
+median per-call change.
+"""
+
+import argparse
+import json
+import statistics
+import sys
+import urllib.request
+
+# (label, getter, lower is better)
+METRICS = (
+    ("render p50", lambda s: s["render_us"]["p50"], True),
+    ("render p95", lambda s: s["render_us"]["p95"], True),
+    ("flush p95", lambda s: s["flush_us"]["p95"], True),
+    ("frame p95", lambda s: s["frame_us"]["p95"], True),
+    ("fps", lambda s: s["fps"], False),
+    ("rebuild", lambda s: s["rebuild_us"], True),
+)
+
+
+def load(source: str):
+    if source.startswith("http://") or source.startswith("https://"):
+        with urllib.request.urlopen(source, timeout=10) as response:
+            report = json.load(response)
+    else:
+        with open(source, encoding="utf-8") as f:
+            report = json.load(f)
+    if report.get("state") != "done":
+        raise SystemExit(f"{source}: benchmark state is {report.get('state')!r}, not done")
+    return report
+
+
+def scenarios(report):
+    return {(s["theme"], s["buttons"]): s for s in report.get("scenarios", [])}
+
+
+# (label, key) per primitive, all times: lower is better
+GFX_METRICS = (
+    ("per call", "us_per_op"),
+    ("batched", "batched_us_per_op"),
+    ("writeback", "writeback_us"),
+)
+
+
+def compare_gfx(base_report, cand_report, args) -> bool:
+    base = {p["name"]: p for p in base_report["primitives"]}
+    cand = {p["name"]: p for p in cand_report["primitives"]}
+    names = [n for n in base if n in cand]
+    if not names:
+        raise SystemExit("no primitives in common")
+
+    failed = False
+    gains = []
+    print(f"{len(names)} primitives in common ({base_report['build']['id']} -> {cand_report['build']['id']})")
+    print(f"  {'':<24}" + "".join(f"{label:>11}" for label, _ in GFX_METRICS))
+    for name in names:
+        cells = []
+        for label, key in GFX_METRICS:
+            b, c = base[name][key], cand[name][key]
+            if b <= 0:
+                cells.append(f"{'-':>11}")
+                continue
+            gain = (1.0 - c / b) * 100.0
+            if key == "us_per_op":
+                gains.append(gain)
+            mark = ""
+            if gain < -args.max_regress:
+                mark = "!"
+                failed = True
+            cells.append(f"{gain:+9.1f}%{mark or ' '}")
+        print(f"  {name:<24}" + "".join(cells))
+
+    median = statistics.median(gains) if gains else 0.0
+    verdict = "ok"
+    if median < args.min_gain:
+        verdict = f"below --min-gain {args.min_gain:g}%"
+        failed = True
+    print(f"  median per call {median:+.1f}%  {verdict}")
+    if failed:
+        print("  ! regressed by more than --max-regress")
+    return failed
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("candidate")
+    parser.add_argument("--max-regress", type=float, default=5.0,
+                        help="worst allowed median change against a metric, percent (default 5)")
+    parser.add_argument("--min-gain", type=float, default=0.0,
+                        help="required median render p95 improvement, percent (default 0)")
+    args = parser.parse_args(argv)
+
+    base_report = load(args.baseline)
+    cand_report = load(args.candidate)
+    if ("primitives" in base_report) != ("primitives" in cand_report):
+        raise SystemExit("one report is from the GFX benchmark, the other from the UI benchmark")
+    if "primitives" in base_report:
+        sys.exit(1 if compare_gfx(base_report, cand_report, args) else 0)
+
+    base = scenarios(base_report)
+    cand = scenarios(cand_report)
+    keys = sorted(set(base) & set(cand))
+    if not keys:
+        raise SystemExit("no scenarios in common")
+
+    failed = False
+    print(f"{len(keys)} scenarios in common")
+    for label, get, lower_better in METRICS:
+        ratios = []
+        for key in keys:
+            b, c = get(base[key]), get(cand[key])
+            if b > 0:
+                ratios.append(c / b)
+        if not ratios:
+            continue
+        ratio = statistics.median(ratios)
+        # Positive: better
+        gain = (1.0 - ratio if lower_better else ratio - 1.0) * 100.0
+        verdict = "ok"
+        if gain < -args.max_regress:
+            verdict = "REGRESSED"
+            failed = True
+        if label == "render p95" and gain < args.min_gain:
+            verdict = f"below --min-gain {args.min_gain:g}%"
+            failed = True
+        print(f"  {label:<11} {gain:+6.1f}%  {verdict}")
+
+    # IRAM placement comes out of the internal heap
+    before = base_report.get("heap", {}).get("internal_before")
+    after = cand_report.get("heap", {}).get("internal_before")
+    if before is not None and after is not None:
+        print(f"  internal heap at start: {after} bytes free ({after - before:+d})")
+
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -0,0 +1,61 @@
+"""Gzip web/index.html into include/index_html_gz.h for the panel's web UI.
+
+Runs as a PlatformIO pre-build script (extra_scripts = pre:...) and can also
+be run by hand: python3 scripts/embed_index.py
+The header is only rewritten when the page changes, so it doesn't force a
+rebuild of web_server.cpp on every build.
+"""
+
+import gzip
+import hashlib
+import os
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env["PROJECT_DIR"]  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE = os.path.join(PROJECT_DIR, "web", "index.html")
+TARGET = os.path.join(PROJECT_DIR, "include", "index_html_gz.h")
+
+
+def render(html: bytes) -> str:
+    # mtime=0 keeps the output (and so the ETag) stable across builds
+    data = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(html).hexdigest()[:16]
+
+    lines = [
+        "// Generated by scripts/embed_index.py from web/index.html - do not edit",
+        "#ifndef INDEX_HTML_GZ_H",
+        "#define INDEX_HTML_GZ_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        f'#define INDEX_HTML_ETAG "\\"{etag}\\""',
+        f"#define INDEX_HTML_GZ_LEN {len(data)}",
+        "",
+        "const uint8_t INDEX_HTML_GZ[] PROGMEM = {",
+    ]
+    for i in range(0, len(data), 16):
+        chunk = ", ".join(f"0x{b:02x}" for b in data[i:i + 16])
+        lines.append(f"    {chunk},")
+    lines += ["};", "", "#endif // INDEX_HTML_GZ_H", ""]
+    return "\n".join(lines)
+
+
+def main():
+    with open(SOURCE, "rb") as f:
+        header = render(f.read())
+
+    if os.path.exists(TARGET):
+        with open(TARGET, "r") as f:
+            if f.read() == header:
+                return
+
+    with open(TARGET, "w") as f:
+        f.write(header)
+    print(f"embed_index: wrote {os.path.relpath(TARGET, PROJECT_DIR)}")
+
+
+main()
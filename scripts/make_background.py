@@ -0,0 +1,83 @@
+"""Build an animated background for POST /api/background from a GIF (or any
+animated image Pillow reads).
+
+    python3 scripts/make_background.py -o background.bin rain.gif
+    curl --data-binary @background.bin http://<panel>/api/background
+
+Every frame is flattened to opaque RGB565 and zlib-compressed on its own;
+the panel decodes them once into its frame cache (include/background_anim.h)
+and plays them at the GIF's frame time, capped at MAX_FPS. Images larger
+than the screen are scaled down to fit. Needs Pillow (pip install pillow).
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+MAGIC = 0x4E414742  # "BGAN"
+VERSION = 1
+SCREEN = (480, 480)
+MAX_FRAMES = 240  # BackgroundAnimation::MAX_FRAMES
+MAX_UPLOAD_BYTES = 2 * 1024 * 1024  # BackgroundAnimation::MAX_UPLOAD_BYTES
+
+
+def rgb565(img) -> bytes:
+    # LV_COLOR_16_SWAP is 0: native little-endian pixels
+    out = bytearray()
+    for r, g, b in img.getdata():
+        out += struct.pack("<H", ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+    return bytes(out)
+
+
+def frames(path: str, background):
+    """(size, [(rgb565 bytes, duration ms)]) for every frame of the image."""
+    from PIL import Image, ImageSequence
+
+    img = Image.open(path)
+    scale = min(1.0, SCREEN[0] / img.width, SCREEN[1] / img.height)
+    size = (max(1, int(img.width * scale)), max(1, int(img.height * scale)))
+
+    out = []
+    for frame in ImageSequence.Iterator(img):
+        rgba = frame.convert("RGBA")
+        if rgba.size != size:
+            rgba = rgba.resize(size, Image.LANCZOS)
+        flat = Image.new("RGBA", size, background)
+        flat.alpha_composite(rgba)
+        out.append((rgb565(flat.convert("RGB")), frame.info.get("duration", 0)))
+    return size, out
+
+
+def build(size, frame_list, frame_ms: int) -> bytes:
+    if len(frame_list) > MAX_FRAMES:
+        raise ValueError(f"{len(frame_list)} frames, the panel takes {MAX_FRAMES}")
+    body = bytearray()
+    for px, _ in frame_list:
+        packed = zlib.compress(px, 9)
+        body += struct.pack("<I", len(packed)) + packed
+    header = struct.pack("<IHHHHHH", MAGIC, VERSION, len(frame_list), size[0], size[1], frame_ms, 0)
+    return header + bytes(body)
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("image")
+    parser.add_argument("-o", "--output", required=True)
+    parser.add_argument("--frame-ms", type=int, help="time per frame (default: the image's first frame duration)")
+    parser.add_argument("--background", default="#000000", help="color under transparent pixels")
+    args = parser.parse_args(argv)
+
+    size, frame_list = frames(args.image, args.background)
+    frame_ms = args.frame_ms if args.frame_ms is not None else frame_list[0][1]
+    data = build(size, frame_list, min(frame_ms, 0xFFFF))
+    if len(data) > MAX_UPLOAD_BYTES:
+        sys.exit(f"make_background: {len(data)} bytes, the panel takes {MAX_UPLOAD_BYTES}")
+
+    with open(args.output, "wb") as f:
+        f.write(data)
+    print(f"make_background: {args.output}, {len(frame_list)} frames of {size[0]}x{size[1]}, {len(data)} bytes")
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
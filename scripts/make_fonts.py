@@ -0,0 +1,163 @@
+"""Generate the panel's subset fonts (src/fonts/, include/panel_fonts_subset.h).
+
+    python3 scripts/make_fonts.py [--compress] [--latin1]
+    python3 scripts/make_fonts.py --remove
+
+LVGL's built-in Montserrat fonts carry every glyph of Latin-1 plus LVGL's
+whole symbol set at each size. The panel draws ASCII text and a few dozen
+symbols, so this builds each size the UI uses from just those: printable
+ASCII (plus Latin-1 with --latin1) from Montserrat, and from Font Awesome
+every symbol the firmware names (LV_SYMBOL_* and literal "\\xEF..." escapes
+in src/ and include/), the lightbulb included. The fonts keep LVGL's names
+(lv_font_montserrat_<size>), so no code changes; lv_conf.h sees the
+generated header, turns LVGL's own fonts off and declares these instead.
+Names outside the subset are folded when the config is parsed
+(ConfigArena::internDisplay() in config_manager.cpp).
+
+--compress stores glyphs RLE-compressed (about a third smaller, decoded on
+every draw); lv_conf.h turns LV_USE_FONT_COMPRESSED on to match. Re-run after
+using a new symbol. --remove deletes the generated files, going back to
+LVGL's fonts.
+
+Needs Node for lv_font_conv (run through npx) and the TTF/WOFF files LVGL
+ships in scripts/built_in_font/ (from .pio/libdeps after a build, or pass
+--font-dir).
+"""
+
+import argparse
+import glob
+import os
+import re
+import subprocess
+import sys
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+FONT_OUT_DIR = os.path.join(PROJECT_DIR, "src", "fonts")
+HEADER = os.path.join(PROJECT_DIR, "include", "panel_fonts_subset.h")
+
+# Sizes the UI uses; keep in step with the LV_FONT_MONTSERRAT_* list in lv_conf.h
+SIZES = (12, 14, 16, 20, 24, 28)
+
+TEXT_FONT = "Montserrat-Medium.ttf"
+SYMBOL_FONT = "FontAwesome5-Solid+Brands+Regular.woff"
+ASCII = (0x20, 0x7E)
+LATIN1 = (0xA0, 0xFF)
+
+
+def find_font_dir(explicit):
+    if explicit:
+        return explicit
+    pattern = os.path.join(PROJECT_DIR, ".pio", "libdeps", "*", "lvgl", "scripts", "built_in_font")
+    for path in sorted(glob.glob(pattern)):
+        if os.path.exists(os.path.join(path, TEXT_FONT)):
+            return path
+    raise SystemExit("LVGL's built_in_font directory not found; build once or pass --font-dir")
+
+
+def symbol_table(font_dir):
+    """LV_SYMBOL_* name -> codepoint, from the lv_symbol_def.h next to the fonts."""
+    path = os.path.join(font_dir, "..", "..", "src", "font", "lv_symbol_def.h")
+    table = {}
+    with open(path, encoding="utf-8") as f:
+        for m in re.finditer(r'#define\s+(LV_SYMBOL_\w+)\s+"((?:\\x[0-9A-Fa-f]{2})+)"', f.read()):
+            table[m.group(1)] = decode_escapes(m.group(2))
+    return table
+
+
+def decode_escapes(escapes):
+    data = bytes(int(h, 16) for h in re.findall(r"\\x([0-9A-Fa-f]{2})", escapes))
+    return ord(data.decode("utf-8"))
+
+
+def used_symbols(table):
+    """Codepoints of the symbols the firmware sources use."""
+    used = set()
+    for path in glob.glob(os.path.join(PROJECT_DIR, "src", "*.cpp")) + \
+            glob.glob(os.path.join(PROJECT_DIR, "include", "*.h")):
+        with open(path, encoding="utf-8", errors="replace") as f:
+            text = f.read()
+        for name in re.findall(r"\bLV_SYMBOL_\w+", text):
+            if name in table:
+                used.add(table[name])
+        # Literal Font Awesome glyphs (private use area, 3-byte UTF-8)
+        for escapes in re.findall(r'"((?:\\x[Ee][Ff](?:\\x[0-9A-Fa-f]{2}){2})+)', text):
+            for one in re.findall(r"(?:\\x[0-9A-Fa-f]{2}){3}", escapes):
+                used.add(decode_escapes(one))
+    return sorted(used)
+
+
+def convert(font_dir, size, ranges, symbols, compress):
+    name = f"lv_font_montserrat_{size}"
+    out = os.path.join(FONT_OUT_DIR, name + ".c")
+    cmd = ["npx", "--yes", "lv_font_conv",
+           "--bpp", "4", "--size", str(size), "--format", "lvgl",
+           "--lv-include", "lvgl.h", "--lv-font-name", name, "-o", out,
+           "--font", os.path.join(font_dir, TEXT_FONT)]
+    for lo, hi in ranges:
+        cmd += ["-r", f"0x{lo:X}-0x{hi:X}"]
+    cmd += ["--font", os.path.join(font_dir, SYMBOL_FONT),
+            "-r", ",".join(f"0x{cp:X}" for cp in symbols)]
+    if not compress:
+        cmd.append("--no-compress")
+    subprocess.run(cmd, check=True)
+    return out
+
+
+def render_header(ranges, symbols, compress):
+    lines = [
+        "// Generated by scripts/make_fonts.py - do not edit",
+        "#ifndef PANEL_FONTS_SUBSET_H",
+        "#define PANEL_FONTS_SUBSET_H",
+        "",
+        "// Glyphs: " + ", ".join(f"U+{lo:04X}-U+{hi:04X}" for lo, hi in ranges),
+        "// Symbols: " + " ".join(f"U+{cp:04X}" for cp in symbols),
+        "// Sizes: " + " ".join(str(s) for s in SIZES),
+        "#define PANEL_FONTS_SUBSET 1",
+        f"#define PANEL_FONTS_LATIN1 {1 if len(ranges) > 1 else 0}",
+        f"#define PANEL_FONTS_COMPRESSED {1 if compress else 0}",
+        "",
+        "#endif // PANEL_FONTS_SUBSET_H",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def remove():
+    for size in SIZES:
+        path = os.path.join(FONT_OUT_DIR, f"lv_font_montserrat_{size}.c")
+        if os.path.exists(path):
+            os.remove(path)
+    if os.path.exists(HEADER):
+        os.remove(HEADER)
+    print("Removed the subset fonts; LVGL's built-in fonts are used again")
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--compress", action="store_true", help="RLE-compress the glyph bitmaps")
+    parser.add_argument("--latin1", action="store_true", help="keep Latin-1 letters (U+00A0-U+00FF)")
+    parser.add_argument("--font-dir", help="LVGL's scripts/built_in_font directory")
+    parser.add_argument("--remove", action="store_true", help="delete the generated fonts")
+    args = parser.parse_args(argv)
+
+    if args.remove:
+        remove()
+        return
+
+    font_dir = find_font_dir(args.font_dir)
+    symbols = used_symbols(symbol_table(font_dir))
+    ranges = [ASCII] + ([LATIN1] if args.latin1 else [])
+
+    os.makedirs(FONT_OUT_DIR, exist_ok=True)
+    total = 0
+    for size in SIZES:
+        out = convert(font_dir, size, ranges, symbols, args.compress)
+        total += os.path.getsize(out)
+    with open(HEADER, "w", encoding="utf-8") as f:
+        f.write(render_header(ranges, symbols, args.compress))
+
+    print(f"{len(SIZES)} fonts, {len(symbols)} symbols, {total} bytes of C source in {FONT_OUT_DIR}")
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -0,0 +1,110 @@
+"""Build an icon pack for POST /api/icons from a set of images.
+
+    python3 scripts/make_icon_pack.py -o icons.bin garage.png pool-pump.png
+    curl --data-binary @icons.bin http://<panel>/api/icons
+
+Each image becomes an icon named after its file (lowercase letters, digits,
+'-' and '_'), which config buttons and scenes use as their "icon". The
+format is the one in include/icon_pack.h:
+  a8        alpha only (the image's alpha, or its luminance without one),
+            tinted with the theme's icon color like the built-in icons
+  rgb565    opaque color
+  rgb565a8  color with alpha, 3 bytes per pixel
+Needs Pillow (pip install pillow). With no images it writes an empty pack,
+which removes the uploaded icons.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+MAGIC = 0x4B504349  # "ICPK"
+VERSION = 1
+HEADER_SIZE = 32
+ENTRY_SIZE = 32
+NAME_SIZE = 20
+MAX_ICONS = 64  # IconPack::MAX_ICONS
+MAX_ICON_SIZE = 256  # IconPack::MAX_ICON_SIZE
+FORMATS = {"a8": 0, "rgb565": 1, "rgb565a8": 2}
+
+
+def rgb565(r: int, g: int, b: int) -> bytes:
+    # LV_COLOR_16_SWAP is 0: native little-endian pixels
+    return struct.pack("<H", ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+
+
+def pixels(path: str, fmt: str, size):
+    from PIL import Image
+
+    img = Image.open(path)
+    if size:
+        img = img.resize((size, size), Image.LANCZOS)
+    if img.width > MAX_ICON_SIZE or img.height > MAX_ICON_SIZE:
+        raise ValueError(f"{path}: larger than {MAX_ICON_SIZE}x{MAX_ICON_SIZE}")
+
+    rgba = img.convert("RGBA")
+    if fmt == "a8":
+        has_alpha = "A" in img.getbands() or "transparency" in img.info
+        source = rgba.getchannel("A") if has_alpha else img.convert("L")
+        return img.width, img.height, source.tobytes()
+
+    out = bytearray()
+    for r, g, b, a in rgba.getdata():
+        out += rgb565(r, g, b)
+        if fmt == "rgb565a8":
+            out.append(a)
+    return img.width, img.height, bytes(out)
+
+
+def build(images, fmt: str) -> bytes:
+    """images: (name, width, height, pixel bytes), any order."""
+    images = sorted(images, key=lambda i: i[0].encode())
+    if len(images) > MAX_ICONS:
+        raise ValueError(f"{len(images)} icons, a pack holds {MAX_ICONS}")
+
+    index = bytearray()
+    data = bytearray()
+    offset = HEADER_SIZE + ENTRY_SIZE * len(images)
+    for name, width, height, px in images:
+        index += struct.pack("<20sBBHHHI", name.encode(), FORMATS[fmt], 0, width, height, 0,
+                             offset + len(data))
+        data += px
+        data += b"\0" * (-len(data) % 4)  # Every image starts 4-byte aligned
+
+    body = bytes(index + data)
+    header = struct.pack("<IHHIII12x", MAGIC, VERSION, len(images), len(body),
+                         zlib.crc32(body) & 0xFFFFFFFF, 0)
+    return header + body
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("images", nargs="*")
+    parser.add_argument("-o", "--output", required=True)
+    parser.add_argument("-f", "--format", choices=sorted(FORMATS), default="a8")
+    parser.add_argument("-s", "--size", type=int, help="scale every icon to SIZE x SIZE")
+    args = parser.parse_args(argv)
+
+    images = []
+    for path in args.images:
+        name = os.path.splitext(os.path.basename(path))[0].lower()
+        if not re.fullmatch(r"[a-z0-9_-]+", name) or len(name) >= NAME_SIZE:
+            sys.exit(f"make_icon_pack: bad icon name '{name}' (a-z, 0-9, '-', '_', under {NAME_SIZE} chars)")
+        width, height, px = pixels(path, args.format, args.size)
+        images.append((name, width, height, px))
+
+    names = [i[0] for i in images]
+    if len(set(names)) != len(names):
+        sys.exit("make_icon_pack: two images have the same name")
+
+    pack = build(images, args.format)
+    with open(args.output, "wb") as f:
+        f.write(pack)
+    print(f"make_icon_pack: {args.output}, {len(images)} icons, {len(pack)} bytes")
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -0,0 +1,127 @@
+"""Convert a flat-colored PNG into a PackedImage header (include/packed_image.h).
+
+    python3 scripts/make_packed_image.py assets/lcars_elbow.png -o include/lcars_elbow.h
+
+The image is reduced to its distinct colors (at most 256, after rounding to
+RGB565) and stored as runs of palette indices, which suits hard-edged
+decoration: the 100x100 LCARS elbow is 244 bytes instead of 20 KB of RGB565.
+Pixels with partial alpha keep it (TRUE_COLOR_ALPHA once unpacked).
+Anti-aliased or photographic images have too many colors and runs for this;
+use LVGL's image converter for those. Needs Pillow (pip install pillow).
+"""
+
+import argparse
+import os
+import re
+import sys
+
+MAX_PALETTE = 256
+MAX_RUN = 256
+
+
+def rgb565(r: int, g: int, b: int) -> int:
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def load(path: str):
+    """(width, height, [(rgb565, alpha)] row-major) from an image file."""
+    from PIL import Image
+
+    img = Image.open(path).convert("RGBA")
+    px = [(rgb565(r, g, b), a) for r, g, b, a in img.getdata()]
+    return img.width, img.height, px
+
+
+def pack(px):
+    """Palette and (index, length - 1) run bytes for pixels [(rgb565, alpha)]."""
+    palette = []
+    lookup = {}
+    runs = bytearray()
+    i = 0
+    while i < len(px):
+        value = px[i]
+        if value not in lookup:
+            if len(palette) == MAX_PALETTE:
+                raise ValueError(f"more than {MAX_PALETTE} colors")
+            lookup[value] = len(palette)
+            palette.append(value)
+        n = 1
+        while i + n < len(px) and px[i + n] == value and n < MAX_RUN:
+            n += 1
+        runs += bytes((lookup[value], n - 1))
+        i += n
+    return palette, bytes(runs)
+
+
+def render(name: str, width: int, height: int, px, source: str) -> str:
+    palette, runs = pack(px)
+    has_alpha = any(a != 255 for _, a in palette)
+    guard = name.upper() + "_H"
+
+    lines = [
+        f"// Generated by scripts/make_packed_image.py from {source}",
+        f"// {width}x{height}, {len(palette)} colors, {len(runs)} bytes of runs"
+        f" ({width * height * (3 if has_alpha else 2)} unpacked)",
+        "",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        '#include "packed_image.h"',
+        "",
+        f"static const uint16_t {name}_palette[] = {{",
+        "    " + ", ".join(f"0x{c:04X}" for c, _ in palette) + ",",
+        "};",
+        "",
+    ]
+    if has_alpha:
+        lines += [
+            f"static const uint8_t {name}_alpha[] = {{",
+            "    " + ", ".join(f"0x{a:02X}" for _, a in palette) + ",",
+            "};",
+            "",
+        ]
+    lines.append(f"static const uint8_t {name}_runs[] = {{")
+    for i in range(0, len(runs), 16):
+        lines.append("    " + ", ".join(f"0x{b:02X}" for b in runs[i:i + 16]) + ",")
+    lines += [
+        "};",
+        "",
+        f"static const PackedImage {name}_img = {{",
+        f"    {width}, {height},",
+        f"    {len(palette)},",
+        f"    {'true' if has_alpha else 'false'},",
+        f"    {name}_palette,",
+        f"    {name + '_alpha' if has_alpha else 'nullptr'},",
+        f"    {name}_runs,",
+        f"    sizeof({name}_runs),",
+        "};",
+        "",
+        f"#endif // {guard}",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("image")
+    parser.add_argument("-o", "--output", required=True)
+    parser.add_argument("-n", "--name", help="C name (default: the image's file name)")
+    args = parser.parse_args(argv)
+
+    name = args.name or os.path.splitext(os.path.basename(args.image))[0]
+    if not re.fullmatch(r"[a-z_][a-z0-9_]*", name):
+        sys.exit(f"make_packed_image: bad C name '{name}'")
+
+    width, height, px = load(args.image)
+    try:
+        header = render(name, width, height, px, args.image)
+    except ValueError as e:
+        sys.exit(f"make_packed_image: {args.image}: {e}")
+    with open(args.output, "w") as f:
+        f.write(header)
+    print(f"make_packed_image: {args.output}, {width}x{height}")
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -0,0 +1,41 @@
+"""Build the rendering modules at -O2 in env:esp32s3-perf.
+
+Runs as a PlatformIO pre-build script (extra_scripts = pre:...). The
+Arduino core builds everything at -Os; the sources that make up a frame
+(LVGL's software renderer and the color/area/memory helpers it calls in its
+inner loops, the ST7701 framebuffer drawing and the display flush) are
+rebuilt at -O2 instead, which unrolls and inlines the pixel loops for a few
+KB of flash. Everything else stays at -Os.
+"""
+
+Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+
+# Path fragments of the sources to optimize for speed
+HOT_SOURCES = (
+    "lvgl/src/draw/sw/",
+    "lvgl/src/draw/lv_draw_rect.c",
+    "lvgl/src/draw/lv_draw_label.c",
+    "lvgl/src/draw/lv_draw_img.c",
+    "lvgl/src/misc/lv_color.c",
+    "lvgl/src/misc/lv_area.c",
+    "lvgl/src/misc/lv_mem.c",
+    "lvgl/src/core/lv_refr.c",
+    "Arduino_GFX/src/display/Arduino_ST7701_RGBPanel.cpp",
+    "Arduino_GFX/src/databus/Arduino_ESP32RGBPanel.cpp",
+    "src/main.cpp",
+    "src/band_renderer.cpp",
+    "src/theme_transition.cpp",
+)
+
+SIZE_FLAGS = ("-Os", "-Og", "-O1")
+
+
+def optimize_hot(env, node):
+    path = node.srcnode().get_abspath().replace("\\", "/")
+    if not any(hot in path for hot in HOT_SOURCES):
+        return node
+    flags = [f for f in env["CCFLAGS"] if f not in SIZE_FLAGS] + ["-O2"]
+    return env.Object(node, CCFLAGS=flags)
+
+
+env.AddBuildMiddleware(optimize_hot)  # noqa: F821
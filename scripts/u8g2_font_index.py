@@ -0,0 +1,138 @@
+"""Generate the unicode glyph index for a u8g2 font header.
+
+Run by hand after adding or regenerating a font:
+    python3 scripts/u8g2_font_index.py lib/Arduino_GFX/src/font/u8g2_font_unifont_t_chinese.h
+With no arguments it indexes every bundled unifont font.
+
+For each font header <name>.h this writes <name>_index.h next to it, a table
+of U8G2_UNICODE_INDEX_BLOCKS flash offsets: entry i is where the first glyph
+with an encoding of at least 0x100 + i * 16 starts (or the list's terminator
+if there is none). Arduino_GFX::setFont(font, index) then finds a codepoint
+by jumping to its block and stepping over at most 15 glyphs, instead of
+walking the font's unicode jump table and glyph list from the start.
+
+Fonts whose unicode glyphs aren't stored in encoding order can't be indexed
+this way and are skipped (u8g2_font_unifont_h_utf8 is one); they keep the
+glyph walk.
+"""
+
+import glob
+import os
+import re
+import sys
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+FONT_DIR = os.path.join(PROJECT_DIR, "lib", "Arduino_GFX", "src", "font")
+
+FONT_DATA_STRUCT_SIZE = 23
+FIRST_UNICODE = 0x100
+BLOCK_SHIFT = 4
+BLOCKS = (0x10000 - FIRST_UNICODE) >> BLOCK_SHIFT  # U8G2_UNICODE_INDEX_BLOCKS
+
+
+def parse_font(text: str):
+    """The font's name and bytes from the C string literal in its header."""
+    m = re.search(r"const uint8_t (\w+)\[(\d+)\][^=]*=\s*(.*?);\s*$", text, re.S | re.M)
+    if not m:
+        raise ValueError("no u8g2 font array found")
+    name, size, body = m.group(1), int(m.group(2)), m.group(3)
+
+    data = bytearray()
+    for literal in re.findall(r'"((?:[^"\\]|\\.)*)"', body.replace("\\\n", ""), re.S):
+        i = 0
+        while i < len(literal):
+            c = literal[i]
+            if c != "\\":
+                data.append(ord(c))
+                i += 1
+                continue
+            nxt = literal[i + 1]
+            if nxt in "01234567":
+                j = i + 1
+                while j < len(literal) and j < i + 4 and literal[j] in "01234567":
+                    j += 1
+                data.append(int(literal[i + 1:j], 8))
+                i = j
+            else:
+                data.append({"n": 10, "t": 9, "r": 13, "a": 7, "b": 8, "f": 12, "v": 11}.get(nxt, ord(nxt)))
+                i += 2
+    data.append(0)  # the literal's terminating NUL is part of the array
+
+    if len(data) != size:
+        raise ValueError(f"{name}: decoded {len(data)} bytes, array is {size}")
+    return name, bytes(data)
+
+
+def word(data: bytes, pos: int) -> int:
+    return (data[pos] << 8) | data[pos + 1]
+
+
+def build_index(data: bytes):
+    """Offsets of the first glyph at or past the start of each block."""
+    # The first lookup table entry jumps from the table to the first glyph
+    table = FONT_DATA_STRUCT_SIZE + word(data, 21)
+    pos = table + word(data, table)
+
+    glyphs = []
+    while word(data, pos) != 0 and data[pos + 2] != 0:
+        glyphs.append((word(data, pos), pos))
+        pos += data[pos + 2]
+    end = pos
+
+    encodings = [e for e, _ in glyphs]
+    if encodings != sorted(set(encodings)):
+        raise ValueError("unicode glyphs are not sorted by encoding")
+
+    index = []
+    g = 0
+    for block in range(BLOCKS):
+        start = FIRST_UNICODE + (block << BLOCK_SHIFT)
+        while g < len(glyphs) and glyphs[g][0] < start:
+            g += 1
+        index.append(glyphs[g][1] if g < len(glyphs) else end)
+    return index, len(glyphs)
+
+
+def render(header: str, name: str, index, glyph_count: int) -> str:
+    guard = f"_{name.upper()}_INDEX_H_"
+    lines = [
+        f"// Generated by scripts/u8g2_font_index.py from {header} - do not edit",
+        f"// {glyph_count} unicode glyphs, see Arduino_GFX::setFont(const uint8_t *, const uint32_t *)",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        "#ifdef U8G2_USE_LARGE_FONTS",
+        f"const uint32_t {name}_index[{len(index)}] PROGMEM = {{",
+    ]
+    for i in range(0, len(index), 8):
+        lines.append("    " + ", ".join(f"0x{v:06x}" for v in index[i:i + 8]) + ",")
+    lines += [
+        "};",
+        "#endif /* U8G2_USE_LARGE_FONTS */",
+        "",
+        f"#endif // {guard}",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def main(paths):
+    if not paths:
+        paths = sorted(p for p in glob.glob(os.path.join(FONT_DIR, "u8g2_font_unifont_*.h"))
+                       if not p.endswith("_index.h"))
+    for path in paths:
+        with open(path, encoding="latin-1") as f:
+            name, data = parse_font(f.read())
+        try:
+            index, glyph_count = build_index(data)
+        except ValueError as e:
+            print(f"u8g2_font_index: skipped {name}: {e}")
+            continue
+        target = os.path.splitext(path)[0] + "_index.h"
+        with open(target, "w") as f:
+            f.write(render(os.path.basename(path), name, index, glyph_count))
+        print(f"u8g2_font_index: {os.path.basename(target)}, {glyph_count} glyphs")
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -0,0 +1,479 @@
+#!/usr/bin/env bun
+/**
+ * Fleet Sync Simulator
+ *
+ * Runs the server's state sync against virtual panels, for load-testing
+ * changes to stateSyncService.ts without a wall of hardware.
+ *
+ * Usage:
+ *   bun bench/fleet-sim.ts [--panels <n>] [--accessories <m>] [...]
+ *
+ * Options:
+ *   --panels       Virtual panels (default: 20)
+ *   --buttons      Buttons per panel (default: 6)
+ *   --accessories  Accessories the mock plugin exposes (default: 40)
+ *   --latency      Panel response latency in ms (default: 20)
+ *   --jitter       Random extra latency in ms, up to (default: 10)
+ *   --loss         Fraction of requests a panel drops (default: 0)
+ *   --rate         Accessory changes per second, fleet-wide (default: 5)
+ *   --actions      Button presses per second, fleet-wide (default: 1)
+ *   --poll         Mock plugin polling interval in ms (default: 2000)
+ *   --events       Mock plugin pushes changes as they happen, like Homebridge's socket
+ *   --no-batch     Mock plugin has no getDeviceStates(), only per-device polls
+ *   --duration     Seconds to run (default: 30)
+ *   --verbose      Keep the server's own logging
+ *
+ * Each virtual panel is an HTTP server on 127.0.0.1 speaking the firmware's
+ * contract: /api/ping, /api/config, /api/state and /api/state/buttons (with
+ * the {version, base} delta check, answering resync on a mismatch). Button
+ * presses go to /api/action/* on an in-process copy of the actions router,
+ * as a panel's would. Panel j's button k is bound to accessory
+ * (j * buttons + k) % accessories, so panels share accessories once
+ * panels * buttons exceeds it.
+ *
+ * Everything runs against a scratch data directory; server/data is not
+ * touched. Panels are reached over HTTP only (no WebSocket channel) and
+ * get JSON rather than MessagePack.
+ *
+ * Reports propagation latency (accessory change or press to every bound
+ * panel showing it), pushes and bytes per panel, resyncs, pings, changes
+ * that never arrived, and the process's CPU time.
+ *
+ * Examples:
+ *   bun bench/fleet-sim.ts --panels 200 --accessories 300
+ *   bun bench/fleet-sim.ts --panels 100 --loss 0.05 --events
+ */
+
+import * as fs from 'fs';
+import * as os from 'os';
+import * as path from 'path';
+import * as http from 'http';
+import { AddressInfo } from 'net';
+
+interface SimOptions {
+  panels: number;
+  buttons: number;
+  accessories: number;
+  latency: number;
+  jitter: number;
+  loss: number;
+  rate: number;
+  actions: number;
+  poll: number;
+  events: boolean;
+  batch: boolean;
+  duration: number;
+  verbose: boolean;
+}
+
+// Parse command line arguments
+function parseArgs(): SimOptions {
+  const args = process.argv.slice(2);
+  const options: SimOptions = {
+    panels: 20,
+    buttons: 6,
+    accessories: 40,
+    latency: 20,
+    jitter: 10,
+    loss: 0,
+    rate: 5,
+    actions: 1,
+    poll: 2000,
+    events: false,
+    batch: true,
+    duration: 30,
+    verbose: false
+  };
+
+  for (let i = 0; i < args.length; i++) {
+    const next = () => parseFloat(args[++i]);
+    switch (args[i]) {
+      case '--panels': options.panels = Math.max(1, Math.floor(next())); break;
+      case '--buttons': options.buttons = Math.max(1, Math.floor(next())); break;
+      case '--accessories': options.accessories = Math.max(1, Math.floor(next())); break;
+      case '--latency': options.latency = Math.max(0, next()); break;
+      case '--jitter': options.jitter = Math.max(0, next()); break;
+      case '--loss': options.loss = Math.min(1, Math.max(0, next())); break;
+      case '--rate': options.rate = Math.max(0, next()); break;
+      case '--actions': options.actions = Math.max(0, next()); break;
+      case '--poll': options.poll = Math.max(100, next()); break;
+      case '--events': options.events = true; break;
+      case '--no-batch': options.batch = false; break;
+      case '--duration': options.duration = Math.max(1, next()); break;
+      case '--verbose': options.verbose = true; break;
+    }
+  }
+
+  return options;
+}
+
+const options = parseArgs();
+const print = console.log.bind(console);
+if (!options.verbose) {
+  console.log = () => {};
+}
+
+// The server's modules read DATA_DIR when first loaded
+const dataDir = fs.mkdtempSync(path.join(os.tmpdir(), 'fleet-sim-'));
+process.env.DATA_DIR = dataDir;
+
+const db = await import('../src/db');
+const { pluginManager } = await import('../src/plugins/pluginManager');
+const stateSync = await import('../src/services/stateSyncService');
+const deviceService = await import('../src/services/deviceService');
+const { default: actionsRouter } = await import('../src/routes/actions');
+const { default: express } = await import('express');
+type Plugin = import('../src/plugins/types').Plugin;
+type DeviceState = import('../src/plugins/types').DeviceState;
+type ActionContext = import('../src/plugins/types').ActionContext;
+type ActionResult = import('../src/plugins/types').ActionResult;
+
+const PLUGIN_ID = 'fleet-sim';
+
+// ============================================================================
+// Measurements
+// ============================================================================
+
+const latencies: number[] = [];
+const actionLatencies: number[] = [];
+let changes = 0;
+let presses = 0;
+let superseded = 0;
+
+// Per panel button: the state it should come to show and since when
+const expected: Map<string, { state: boolean; at: number }> = new Map();
+
+function percentile(values: number[], p: number): number {
+  if (values.length === 0) return 0;
+  const sorted = [...values].sort((a, b) => a - b);
+  return sorted[Math.min(sorted.length - 1, Math.floor(p * sorted.length))];
+}
+
+// ============================================================================
+// Virtual panels
+// ============================================================================
+
+interface VirtualPanel {
+  id: string;
+  server: http.Server;
+  port: number;
+  version: number;
+  buttons: Map<number, boolean>;
+  bindings: Map<number, string>;  // buttonId -> accessory ID
+  pushes: number;
+  pushedButtons: number;
+  bytes: number;
+  resyncs: number;
+  pings: number;
+  configs: number;
+  dropped: number;
+}
+
+const panels: VirtualPanel[] = [];
+const bindingsByAccessory: Map<string, Array<{ panel: VirtualPanel; buttonId: number }>> = new Map();
+
+function accessoryId(index: number): string {
+  return `sim-acc-${index}`;
+}
+
+function readBody(req: http.IncomingMessage): Promise<string> {
+  return new Promise(resolve => {
+    let body = '';
+    req.on('data', chunk => { body += chunk; });
+    req.on('end', () => resolve(body));
+  });
+}
+
+function reply(res: http.ServerResponse, body: unknown): void {
+  res.writeHead(200, { 'Content-Type': 'application/json' });
+  res.end(JSON.stringify(body));
+}
+
+// Apply a state push the way the firmware does: a delta whose base is not
+// the version held is refused with resync, and nothing is applied
+function handleStatePush(panel: VirtualPanel, raw: string, res: http.ServerResponse): void {
+  const message = JSON.parse(raw) as { version: number; base?: number; buttons: Array<{ id: number; state: boolean }> };
+  panel.pushes++;
+  panel.bytes += raw.length;
+
+  if (message.base !== undefined && message.base !== panel.version) {
+    panel.resyncs++;
+    reply(res, { success: true, resync: true });
+    return;
+  }
+
+  const now = Date.now();
+  for (const button of message.buttons) {
+    panel.pushedButtons++;
+    panel.buttons.set(button.id, button.state);
+    const key = `${panel.id}:${button.id}`;
+    const want = expected.get(key);
+    if (want && want.state === button.state) {
+      latencies.push(now - want.at);
+      expected.delete(key);
+    }
+  }
+  panel.version = message.version;
+  reply(res, { success: true });
+}
+
+async function handlePanelRequest(panel: VirtualPanel, req: http.IncomingMessage, res: http.ServerResponse): Promise<void> {
+  const body = await readBody(req);
+  await new Promise(resolve => setTimeout(resolve, options.latency + Math.random() * options.jitter));
+
+  if (Math.random() < options.loss) {
+    panel.dropped++;
+    req.socket.destroy();
+    return;
+  }
+
+  const url = (req.url || '').split('?')[0];
+  if (url === '/api/ping') {
+    panel.pings++;
+    reply(res, { ok: true, msgpack: false });
+  } else if (url === '/api/config' && req.method === 'POST') {
+    panel.configs++;
+    reply(res, { success: true });
+  } else if (url === '/api/state/buttons' && req.method === 'POST') {
+    handleStatePush(panel, body, res);
+  } else if (url === '/api/state') {
+    reply(res, { buttons: Array.from(panel.buttons, ([id, state]) => ({ id, state })) });
+  } else {
+    res.writeHead(404);
+    res.end();
+  }
+}
+
+async function startPanel(index: number): Promise<VirtualPanel> {
+  const panel: VirtualPanel = {
+    id: `sim-panel-${index}`,
+    server: http.createServer(),
+    port: 0,
+    version: 0,
+    buttons: new Map(),
+    bindings: new Map(),
+    pushes: 0,
+    pushedButtons: 0,
+    bytes: 0,
+    resyncs: 0,
+    pings: 0,
+    configs: 0,
+    dropped: 0
+  };
+  panel.server.on('request', (req, res) => {
+    handlePanelRequest(panel, req, res).catch(() => req.socket.destroy());
+  });
+  await new Promise<void>(resolve => panel.server.listen(0, '127.0.0.1', resolve));
+  panel.port = (panel.server.address() as AddressInfo).port;
+
+  for (let k = 0; k < options.buttons; k++) {
+    const buttonId = k + 1;
+    const accessory = accessoryId((index * options.buttons + k) % options.accessories);
+    panel.buttons.set(buttonId, false);
+    panel.bindings.set(buttonId, accessory);
+    if (!bindingsByAccessory.has(accessory)) bindingsByAccessory.set(accessory, []);
+    bindingsByAccessory.get(accessory)!.push({ panel, buttonId });
+  }
+  return panel;
+}
+
+function adoptPanel(panel: VirtualPanel): void {
+  const name = `Sim Panel ${panel.id.split('-').pop()}`;
+  const config = db.createDefaultConfig(panel.id, name, '127.0.0.1');
+  config.buttons = Array.from(panel.bindings, ([buttonId, accessory]) => ({
+    id: buttonId,
+    type: 'light' as const,
+    name: accessory,
+    icon: 'charge',
+    state: false,
+    binding: { pluginId: PLUGIN_ID, externalDeviceId: accessory, deviceType: 'light', metadata: {} }
+  }));
+
+  db.upsertDevice({
+    id: panel.id,
+    mac: '',
+    ip: `127.0.0.1:${panel.port}`,
+    name,
+    location: 'Simulator',
+    config,
+    lastSeen: Date.now(),
+    online: true,
+    adopted: true
+  });
+}
+
+// ============================================================================
+// Mock plugin
+// ============================================================================
+
+const accessories: Map<string, DeviceState> = new Map();
+
+// Change an accessory; every bound panel not already showing it should follow
+function changeAccessory(id: string, state: boolean): void {
+  accessories.set(id, { state });
+  const at = Date.now();
+  for (const { panel, buttonId } of bindingsByAccessory.get(id) || []) {
+    const key = `${panel.id}:${buttonId}`;
+    if (panel.buttons.get(buttonId) === state) {
+      expected.delete(key);
+      continue;
+    }
+    if (expected.has(key)) superseded++;
+    expected.set(key, { state, at });
+  }
+  if (options.events) {
+    stateSync.pushExternalDeviceState(PLUGIN_ID, id, state).catch(() => {});
+  }
+}
+
+const mockPlugin: Plugin = {
+  id: PLUGIN_ID,
+  name: 'Fleet Simulator',
+  type: 'device-provider',
+  pollingInterval: options.poll,
+
+  async initialize() {},
+  async shutdown() {},
+
+  async discoverDevices() {
+    return Array.from(accessories.keys(), id => ({
+      id,
+      name: id,
+      type: 'light' as const,
+      capabilities: { on: true },
+      metadata: {}
+    }));
+  },
+
+  async executeAction(ctx: ActionContext): Promise<ActionResult> {
+    changeAccessory(ctx.binding.externalDeviceId, ctx.newState);
+    return { success: true, newState: ctx.newState };
+  },
+
+  async getDeviceState(externalDeviceId: string) {
+    return accessories.get(externalDeviceId) || null;
+  }
+};
+if (options.batch) {
+  mockPlugin.getDeviceStates = async (ids: string[]) => {
+    const states: Map<string, DeviceState> = new Map();
+    for (const id of ids) {
+      const state = accessories.get(id);
+      if (state) states.set(id, state);
+    }
+    return states;
+  };
+}
+
+// ============================================================================
+// Run
+// ============================================================================
+
+// A panel presses a button: it shows the new state at once and reports it
+async function pressButton(serverUrl: string): Promise<void> {
+  const panel = panels[Math.floor(Math.random() * panels.length)];
+  const buttonId = 1 + Math.floor(Math.random() * options.buttons);
+  const state = !panel.buttons.get(buttonId);
+  panel.buttons.set(buttonId, state);
+  expected.delete(`${panel.id}:${buttonId}`);
+  presses++;
+
+  const start = Date.now();
+  try {
+    await fetch(`${serverUrl}/api/action/light/${buttonId}`, {
+      method: 'POST',
+      headers: { 'Content-Type': 'application/json' },
+      body: JSON.stringify({ deviceId: panel.id, state, timestamp: start })
+    });
+    actionLatencies.push(Date.now() - start);
+  } catch (error) {
+    print(`Action from ${panel.id} failed:`, error);
+  }
+}
+
+async function main(): Promise<void> {
+  print(`Fleet sim: ${options.panels} panels x ${options.buttons} buttons, ${options.accessories} accessories, ` +
+        `${options.latency}+${options.jitter}ms latency, ${(options.loss * 100).toFixed(1)}% loss, ` +
+        `${options.events ? 'events' : `polling every ${options.poll}ms`}${options.batch ? '' : ', no batch'}`);
+
+  for (let i = 0; i < options.accessories; i++) {
+    accessories.set(accessoryId(i), { state: false });
+  }
+  pluginManager.registerPlugin(mockPlugin);
+  await pluginManager.setPluginConfig(PLUGIN_ID, { enabled: true });
+
+  for (let i = 0; i < options.panels; i++) {
+    const panel = await startPanel(i);
+    panels.push(panel);
+    adoptPanel(panel);
+  }
+
+  // The actions router, as the panels' reporting URL would reach it
+  const app = express();
+  app.use(express.json());
+  app.use('/api/action', actionsRouter);
+  const actionServer = app.listen(0, '127.0.0.1');
+  await new Promise(resolve => actionServer.once('listening', resolve));
+  const serverUrl = `http://127.0.0.1:${(actionServer.address() as AddressInfo).port}`;
+
+  // Initial sync pushes everything; measure only what follows it
+  stateSync.startStatePolling();
+  deviceService.startHealthChecks(10000);
+  await new Promise(resolve => setTimeout(resolve, 2000));
+  for (const panel of panels) {
+    panel.pushes = panel.pushedButtons = panel.bytes = panel.resyncs = panel.pings = panel.configs = panel.dropped = 0;
+  }
+
+  const cpuStart = process.cpuUsage();
+  const wallStart = Date.now();
+  const timers: Array<ReturnType<typeof setInterval>> = [];
+  if (options.rate > 0) {
+    timers.push(setInterval(() => {
+      const id = accessoryId(Math.floor(Math.random() * options.accessories));
+      changes++;
+      changeAccessory(id, !accessories.get(id)!.state);
+    }, 1000 / options.rate));
+  }
+  if (options.actions > 0) {
+    timers.push(setInterval(() => { pressButton(serverUrl); }, 1000 / options.actions));
+  }
+
+  await new Promise(resolve => setTimeout(resolve, options.duration * 1000));
+  timers.forEach(clearInterval);
+
+  // Let the last changes land: a poll interval and a heartbeat's worth of slack
+  await new Promise(resolve => setTimeout(resolve, (options.events ? 0 : options.poll) + 2000));
+  const wall = Date.now() - wallStart;
+  const cpu = process.cpuUsage(cpuStart);
+
+  const sum = (field: keyof VirtualPanel) => panels.reduce((total, panel) => total + (panel[field] as number), 0);
+  const pushes = sum('pushes');
+  const cpuMs = (cpu.user + cpu.system) / 1000;
+
+  print('');
+  print(`Changes:      ${changes} accessory changes, ${presses} button presses, ${superseded} superseded before delivery`);
+  print(`Propagation:  ${latencies.length} deliveries, p50 ${percentile(latencies, 0.5)}ms, ` +
+        `p95 ${percentile(latencies, 0.95)}ms, p99 ${percentile(latencies, 0.99)}ms, max ${percentile(latencies, 1)}ms`);
+  print(`Undelivered:  ${expected.size} panel buttons never came to show their accessory's state`);
+  print(`Actions:      p50 ${percentile(actionLatencies, 0.5)}ms, p95 ${percentile(actionLatencies, 0.95)}ms round trip`);
+  print(`Pushes:       ${pushes} (${(pushes / panels.length).toFixed(1)} per panel), ${sum('pushedButtons')} buttons, ` +
+        `${(sum('bytes') / 1024).toFixed(1)} KB, ${sum('resyncs')} resyncs`);
+  print(`Other:        ${sum('pings')} pings, ${sum('configs')} config pushes, ${sum('dropped')} requests dropped`);
+  print(`CPU:          ${cpuMs.toFixed(0)}ms over ${(wall / 1000).toFixed(1)}s (${(cpuMs / wall * 100).toFixed(1)}%), ` +
+        `RSS ${(process.memoryUsage().rss / 1024 / 1024).toFixed(0)} MB`);
+
+  stateSync.stopStatePolling();
+  deviceService.stopHealthChecks();
+  actionServer.close();
+  for (const panel of panels) {
+    panel.server.close();
+  }
+  fs.rmSync(dataDir, { recursive: true, force: true });
+  process.exit(0);
+}
+
+main().catch(error => {
+  console.error('Fleet sim failed:', error);
+  fs.rmSync(dataDir, { recursive: true, force: true });
+  process.exit(1);
+});
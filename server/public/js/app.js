@@ -5,6 +5,7 @@ import { loadDiscoveredDevices } from './discovery.js';
 import { loadPlugins, waitForPluginsAndSelect, selectedPlugin } from './plugins.js';
 import { loadGlobalScenes, waitForScenesAndSelect, selectedScene } from './scenes.js';
 import { loadGlobalSettings } from './settings.js';
+import { loadFleetHealth } from './health.js';
 
 // Register route handlers
 registerRouteHandler('device', waitForDevicesAndSelect);
@@ -14,6 +15,7 @@ registerRouteHandler('discover', loadDiscoveredDevices);
 registerRouteHandler('plugin', waitForPluginsAndSelect);
 registerRouteHandler('pluginsTab', loadPlugins);
 registerRouteHandler('settings', loadGlobalSettings);
+registerRouteHandler('health', loadFleetHealth);
 
 // Tab click handlers with URL updates
 document.querySelectorAll('.tab').forEach(tab => {
@@ -34,6 +36,8 @@ document.querySelectorAll('.tab').forEach(tab => {
       }
     } else if (tabName === 'discover') {
       navigateTo('/discover');
+    } else if (tabName === 'health') {
+      navigateTo('/health');
     } else if (tabName === 'plugins') {
       if (selectedPlugin) {
         navigateTo(`/plugins/${encodeURIComponent(selectedPlugin.id)}`);
@@ -134,6 +134,12 @@ function updateFanSpeedSteps(index, steps) {
   }
 }
 
+function updateSensorUnit(index, unit) {
+  if (selectedDevice && selectedDevice.config.buttons[index]) {
+    selectedDevice.config.buttons[index].subtitle = unit || undefined;
+  }
+}
+
 function updateButtonSceneId(index, sceneId) {
   if (selectedDevice && selectedDevice.config.buttons[index]) {
     if (sceneId) {
@@ -160,8 +166,8 @@ function updateButtonSceneId(index, sceneId) {
 
 export function addButton() {
   if (!selectedDevice) return;
-  if (selectedDevice.config.buttons.length >= 9) {
-    showToast('Maximum 9 buttons allowed', 'error');
+  if (selectedDevice.config.buttons.length >= 36) {
+    showToast('Maximum 36 buttons allowed', 'error');
     return;
   }
 
@@ -202,7 +208,7 @@ function getStatusText(btn) {
 }
 
 function getStatusClass(btn) {
-  if (btn.type === 'scene') return 'scene';
+  if (btn.type === 'scene' || btn.type === 'sensor') return 'scene';
   if (!btn.state) return 'off';
   if (btn.type === 'fan') return 'fan-on';
   return 'on';
@@ -266,17 +272,22 @@ export function renderButtonList() {
          ondragleave="handleButtonDragLeave(event)"
          ondrop="handleButtonDrop(event, ${i})"
          ondragend="handleButtonDragEnd(event)"
-         style="grid-template-columns: 24px 50px 1fr 80px ${btn.type === 'scene' ? '150px' : '80px'} ${btn.type === 'fan' ? '70px' : ''} ${btn.type !== 'scene' ? 'auto' : ''} 36px;">
+         style="grid-template-columns: 24px 50px 1fr 80px ${btn.type === 'scene' ? '150px' : '80px'} ${btn.type === 'fan' || btn.type === 'sensor' ? '70px' : ''} ${btn.type !== 'scene' && btn.type !== 'sensor' ? 'auto' : ''} 36px;">
       <div class="drag-handle" title="Drag to reorder">⋮⋮</div>
+      ${btn.type === 'sensor' ? `
+      <div class="button-status scene" title="Sensor: fed by POST /api/devices/:id/sensors/samples">~</div>
+      ` : `
       <div class="button-status ${getStatusClass(btn)}" onclick="${btn.type === 'scene' ? '' : `toggleButtonState(${i})`}" title="${btn.type === 'scene' ? 'Scene button' : 'Click to toggle'}">
         ${btn.type === 'scene' ? '▶' : getStatusText(btn)}
       </div>
+      `}
       <input type="text" value="${btn.name}" onchange="updateButtonName(${i}, this.value)" placeholder="Button name">
       <select onchange="updateButtonType(${i}, this.value); renderButtonList();">
         <option value="light" ${btn.type === 'light' ? 'selected' : ''}>Light</option>
         <option value="switch" ${btn.type === 'switch' ? 'selected' : ''}>Switch</option>
         <option value="fan" ${btn.type === 'fan' ? 'selected' : ''}>Fan</option>
         <option value="scene" ${btn.type === 'scene' ? 'selected' : ''}>Scene</option>
+        <option value="sensor" ${btn.type === 'sensor' ? 'selected' : ''}>Sensor</option>
       </select>
       ${btn.type === 'scene' ? `
       <select onchange="updateButtonSceneId(${i}, this.value)">
@@ -313,7 +324,10 @@ export function renderButtonList() {
         <option value="5" ${(btn.speedSteps || 0) === 5 ? 'selected' : ''}>5 Speed</option>
       </select>
       ` : ''}
-      ${btn.type !== 'scene' ? `
+      ${btn.type === 'sensor' ? `
+      <input type="text" value="${btn.subtitle || ''}" onchange="updateSensorUnit(${i}, this.value)" placeholder="Unit" title="Shown after the value, e.g. °C or ' W'">
+      ` : ''}
+      ${btn.type !== 'scene' && btn.type !== 'sensor' ? `
       <div class="binding-indicator ${btn.binding ? '' : 'unbound'}" onclick="openImportModal(${btn.id})" title="${btn.binding ? 'Click to change binding' : 'Click to bind external device'}">
         ${btn.binding ? '🔗 Bound' : '+ Bind'}
       </div>
@@ -1070,8 +1084,8 @@ export async function confirmCreateButton() {
     return;
   }
 
-  if (selectedDevice.config.buttons.length >= 9) {
-    showToast('Maximum 9 buttons allowed', 'error');
+  if (selectedDevice.config.buttons.length >= 36) {
+    showToast('Maximum 36 buttons allowed', 'error');
     return;
   }
 
@@ -1137,6 +1151,7 @@ window.updateButtonName = updateButtonName;
 window.updateButtonType = updateButtonType;
 window.updateButtonIcon = updateButtonIcon;
 window.updateFanSpeedSteps = updateFanSpeedSteps;
+window.updateSensorUnit = updateSensorUnit;
 window.updateButtonSceneId = updateButtonSceneId;
 window.toggleButtonState = toggleButtonState;
 window.handleButtonDragStart = handleButtonDragStart;
@@ -0,0 +1,97 @@
+// Fleet health module (telemetry from the panels' heartbeats)
+import { showToast } from './utils.js';
+
+// Columns shown, with how to print them and which way is bad
+const METRICS = [
+  { key: 'frame_p95_us', label: 'Frame p95', format: v => `${(v / 1000).toFixed(1)} ms`, bad: (v, t) => v > t.frameP95Us },
+  { key: 'render_p95_us', label: 'Render p95', format: v => `${(v / 1000).toFixed(1)} ms` },
+  { key: 'jitter_p95_us', label: 'Loop jitter p95', format: v => `${(v / 1000).toFixed(1)} ms` },
+  { key: 'rssi', label: 'RSSI', format: v => `${v} dBm`, bad: (v, t) => v < t.rssiDbm },
+  { key: 'internal_free', label: 'Internal free', format: v => `${Math.round(v / 1024)} KB` },
+  { key: 'internal_largest', label: 'Largest block', format: v => `${Math.round(v / 1024)} KB`, bad: (v, t) => v < t.internalLargestBytes },
+  { key: 'psram_free', label: 'PSRAM free', format: v => `${Math.round(v / 1024)} KB` },
+  { key: 'lvgl_frag_pct', label: 'LVGL frag', format: v => `${v}%`, bad: (v, t) => v > t.lvglFragPct }
+];
+
+function cell(metric, value, thresholds) {
+  if (value === null || value === undefined) return '<td>-</td>';
+  const bad = metric.bad && metric.bad(value, thresholds);
+  return `<td class="${bad ? 'bad' : ''}">${metric.format(value)}</td>`;
+}
+
+function renderFleet(data) {
+  const container = document.getElementById('health-fleet');
+  if (Object.keys(data.fleet).length === 0) {
+    container.innerHTML = '<div class="empty-state">No heartbeats yet. Panels report over their WebSocket channel every few seconds.</div>';
+    return;
+  }
+
+  const rows = METRICS.filter(m => data.fleet[m.key]).map(m => {
+    const stats = data.fleet[m.key];
+    return `
+      <tr>
+        <td>${m.label}</td>
+        <td>${stats.panels}</td>
+        ${cell(m, stats.min, data.thresholds)}
+        ${cell(m, stats.p50, data.thresholds)}
+        ${cell(m, stats.p95, data.thresholds)}
+        ${cell(m, stats.max, data.thresholds)}
+      </tr>
+    `;
+  }).join('');
+
+  container.innerHTML = `
+    <table class="health-table">
+      <tr><th>Metric</th><th>Panels</th><th>Min</th><th>p50</th><th>p95</th><th>Max</th></tr>
+      ${rows}
+    </table>
+  `;
+}
+
+function renderPanels(data) {
+  const container = document.getElementById('health-panels');
+  if (data.panels.length === 0) {
+    container.innerHTML = '<div class="empty-state">No telemetry from any display</div>';
+    return;
+  }
+
+  // Panels with alerts first, then by name
+  const panels = [...data.panels].sort((a, b) =>
+    (b.alerts.length - a.alerts.length) || a.name.localeCompare(b.name));
+
+  const rows = panels.map(panel => {
+    const alerts = panel.alerts.length
+      ? panel.alerts.map(a => `<span class="health-alert" title="${a.message}">${a.kind.replace(/_/g, ' ')}</span>`).join('')
+      : '<span class="health-ok">OK</span>';
+    return `
+      <tr style="cursor: pointer;" onclick="navigateTo('/display/${encodeURIComponent(panel.deviceId)}')">
+        <td>${panel.name}</td>
+        ${METRICS.map(m => cell(m, panel.recent[m.key], data.thresholds)).join('')}
+        <td>${alerts}</td>
+      </tr>
+    `;
+  }).join('');
+
+  container.innerHTML = `
+    <table class="health-table">
+      <tr><th>Display</th>${METRICS.map(m => `<th>${m.label}</th>`).join('')}<th>Alerts</th></tr>
+      ${rows}
+    </table>
+  `;
+}
+
+export async function loadFleetHealth() {
+  try {
+    const response = await fetch('/api/devices/telemetry');
+    const data = await response.json();
+    document.getElementById('health-window').textContent = Math.round(data.windowMs / 60000);
+    renderFleet(data);
+    renderPanels(data);
+  } catch (error) {
+    console.error('Failed to load telemetry:', error);
+    showToast('Failed to load telemetry', 'error');
+  }
+}
+
+// Make functions available globally for inline handlers
+window.loadFleetHealth = loadFleetHealth;
@@ -55,6 +55,13 @@ export function handleRoute() {
       }
       break;
 
+    case 'health':
+      switchTab('health');
+      if (routeHandlers.health) {
+        routeHandlers.health();
+      }
+      break;
+
     case 'plugins':
       switchTab('plugins');
       if (parts[1] && routeHandlers.plugin) {
@@ -84,6 +91,7 @@ export function switchTab(tabName) {
   document.getElementById('tab-devices').classList.toggle('hidden', tabName !== 'devices');
   document.getElementById('tab-scenes').classList.toggle('hidden', tabName !== 'scenes');
   document.getElementById('tab-discover').classList.toggle('hidden', tabName !== 'discover');
+  document.getElementById('tab-health').classList.toggle('hidden', tabName !== 'health');
   document.getElementById('tab-plugins').classList.toggle('hidden', tabName !== 'plugins');
   document.getElementById('tab-settings').classList.toggle('hidden', tabName !== 'settings');
 }
@@ -2,11 +2,12 @@ import * as fs from 'fs';
 import * as path from 'path';
 import { ButtonBinding } from '../plugins/types';
 
-// Data directory path
-const DATA_DIR = path.join(__dirname, '../../data');
+// Data directory path (DATA_DIR overrides, e.g. for the fleet simulator)
+const DATA_DIR = process.env.DATA_DIR || path.join(__dirname, '../../data');
 const DEVICES_FILE = path.join(DATA_DIR, 'devices.json');
 const SCENES_FILE = path.join(DATA_DIR, 'scenes.json');
 const SETTINGS_FILE = path.join(DATA_DIR, 'settings.json');
+const CRASHES_FILE = path.join(DATA_DIR, 'crashes.json');
 
 // Re-export ButtonBinding for convenience
 export { ButtonBinding } from '../plugins/types';
@@ -73,11 +74,11 @@ export interface ThemeScheduleConfig {
 // Button configuration
 export interface ButtonConfig {
   id: number;
-  type: 'light' | 'switch' | 'fan' | 'scene';
+  type: 'light' | 'switch' | 'fan' | 'scene' | 'sensor';
   name: string;
   icon: string;
   state: boolean;
-  subtitle?: string;  // For LCARS
+  subtitle?: string;  // For LCARS; a sensor's unit
   speedSteps?: number;  // For fans
   speedLevel?: number;  // Current fan speed (0-100)
   // Plugin binding for external device control
@@ -124,6 +125,8 @@ export interface DisplayConfig {
   theme: 'light_mode' | 'neon_cyberpunk' | 'dark_mode' | 'lcars';
   dayNightMode: DayNightConfig;
   lcars: LCARSConfig;
+  layout?: 'grid' | 'list';  // Card arrangement for the standard themes (panel default: grid)
+  cardTiles?: boolean;  // Draw idle cards from pre-rendered tiles (panel default: false)
   brightnessSchedule?: BrightnessScheduleConfig;
   useGlobalSchedule?: boolean;  // If true, use global brightness schedule instead of device-specific
   useGlobalThemeSchedule?: boolean;  // If true, use global theme schedule instead of device-specific
@@ -133,6 +136,11 @@ export interface DisplayConfig {
 export interface GlobalSettings {
   brightnessSchedule: BrightnessScheduleConfig;
   themeSchedule: ThemeScheduleConfig;
+  directControl?: boolean;  // Panels call plugins that allow it themselves (default: false)
+  stateMulticast?: boolean; // State changes multicast to panels by binding id (default: false)
+  multicastKey?: string;    // Signing key for those, hex (drawn when first needed)
+  peerMirror?: boolean;     // Panels mirror presses to each other over ESP-NOW (default: false)
+  peerMirrorKey?: string;   // Signing key for those, hex (drawn when first needed)
   updatedAt: number;
 }
 
@@ -185,6 +193,87 @@ export interface DiscoveredDevice {
 let devices: Map<string, Device> = new Map();
 let discoveredDevices: Map<string, DiscoveredDevice> = new Map();
 
+// A button of an adopted panel bound to an external device
+export interface BoundButton {
+  deviceId: string;
+  buttonId: number;
+}
+
+// Everything bound to one external device
+export interface BindingTarget {
+  pluginId: string;
+  externalDeviceId: string;
+  binding: ButtonBinding;       // The first button's binding, to query the plugin with
+  buttons: BoundButton[];
+}
+
+// pluginId -> externalDeviceId -> bound buttons, kept in step with
+// upsertDevice()/deleteDevice() so state sync never rescans every button
+let bindingIndex: Map<string, Map<string, BindingTarget>> = new Map();
+let indexedTargets: Map<string, BindingTarget[]> = new Map();   // deviceId -> targets it appears in
+
+function indexDevice(device: Device): void {
+  if (!device.adopted || !device.config?.buttons) return;
+  const own: BindingTarget[] = [];
+  for (const button of device.config.buttons) {
+    const binding = button.binding;
+    if (!binding?.pluginId) continue;
+
+    let targets = bindingIndex.get(binding.pluginId);
+    if (!targets) {
+      targets = new Map();
+      bindingIndex.set(binding.pluginId, targets);
+    }
+    let target = targets.get(binding.externalDeviceId);
+    if (!target) {
+      target = { pluginId: binding.pluginId, externalDeviceId: binding.externalDeviceId, binding, buttons: [] };
+      targets.set(binding.externalDeviceId, target);
+    }
+    target.buttons.push({ deviceId: device.id, buttonId: button.id });
+    if (!own.includes(target)) own.push(target);
+  }
+  if (own.length > 0) indexedTargets.set(device.id, own);
+}
+
+function unindexDevice(deviceId: string): void {
+  for (const target of indexedTargets.get(deviceId) || []) {
+    const { pluginId, externalDeviceId } = target;
+    target.buttons = target.buttons.filter(b => b.deviceId !== deviceId);
+    if (target.buttons.length === 0) {
+      const targets = bindingIndex.get(pluginId);
+      targets?.delete(externalDeviceId);
+      if (targets?.size === 0) bindingIndex.delete(pluginId);
+      continue;
+    }
+    // The binding may have been the removed panel's
+    const first = devices.get(target.buttons[0].deviceId)?.config.buttons.find(b => b.id === target.buttons[0].buttonId);
+    if (first?.binding) target.binding = first.binding;
+  }
+  indexedTargets.delete(deviceId);
+}
+
+function rebuildBindingIndex(): void {
+  bindingIndex = new Map();
+  indexedTargets = new Map();
+  for (const device of devices.values()) {
+    indexDevice(device);
+  }
+}
+
+// Plugins with at least one bound button
+export function getBoundPluginIds(): string[] {
+  return Array.from(bindingIndex.keys());
+}
+
+// External devices of a plugin with the buttons bound to each
+export function getBindingTargets(pluginId: string): BindingTarget[] {
+  return Array.from(bindingIndex.get(pluginId)?.values() || []);
+}
+
+export function getBindingTarget(pluginId: string, externalDeviceId: string): BindingTarget | undefined {
+  return bindingIndex.get(pluginId)?.get(externalDeviceId);
+}
+
 // Load devices from file
 export function loadDevices(): void {
   try {
@@ -224,8 +313,11 @@ export function loadDevices(): void {
         }
       }
 
+      for (const device of devices.values()) {
+        updatePersisted(device);
+      }
       if (migrated) {
-        saveDevices();
+        scheduleSave();
         console.log('Saved updated devices');
       }
 
@@ -235,25 +327,86 @@ export function loadDevices(): void {
     console.error('Failed to load devices:', error);
     devices = new Map();
   }
+  rebuildBindingIndex();
+}
+
+// Persisted form of each device (pretty-printed, without transient button
+// state), so a save only re-serializes devices that changed and a change
+// to button state alone is not written at all
+const persistedDevices: Map<string, string> = new Map();
+const SAVE_DELAY = 1000;
+let devicesDirty = false;
+let saveTimer: ReturnType<typeof setTimeout> | null = null;
+let saving = false;
+
+function persistedForm(device: Device): string {
+  // Remove transient state from buttons - will be refreshed from plugins on startup
+  const buttons = device.config?.buttons?.map(({ state, speedLevel, ...button }) => button);
+  const copy = buttons ? { ...device, config: { ...device.config, buttons } } : device;
+  return JSON.stringify(copy, null, 2);
+}
+
+// Note a device's new persisted form; false if it has not changed
+function updatePersisted(device: Device): boolean {
+  const json = persistedForm(device);
+  if (persistedDevices.get(device.id) === json) return false;
+  persistedDevices.set(device.id, json);
+  return true;
+}
+
+function devicesFileContent(): string {
+  const entries = Array.from(persistedDevices, ([id, json]) =>
+    `  ${JSON.stringify(id)}: ${json.replace(/\n/g, '\n  ')}`);
+  return entries.length ? `{\n${entries.join(',\n')}\n}` : '{}';
+}
+
+async function writeDevicesFile(): Promise<void> {
+  saveTimer = null;
+  if (saving) return;  // Rescheduled when the write in flight finishes
+  saving = true;
+  devicesDirty = false;
+  try {
+    // Write then rename, so a crash mid-write never leaves a truncated file
+    const tmp = `${DEVICES_FILE}.tmp`;
+    await fs.promises.writeFile(tmp, devicesFileContent());
+    await fs.promises.rename(tmp, DEVICES_FILE);
+  } catch (error) {
+    console.error('Failed to save devices:', error);
+    devicesDirty = true;
+  } finally {
+    saving = false;
+  }
+  if (devicesDirty) scheduleSave();
+}
+
+function scheduleSave(): void {
+  devicesDirty = true;
+  if (saveTimer || saving) return;
+  saveTimer = setTimeout(writeDevicesFile, SAVE_DELAY);
 }
 
-// Save devices to file (excluding transient button state)
+// Save devices to file (excluding transient button state). Changes are
+// coalesced and written in the background about a second later
 export function saveDevices(): void {
+  let changed = false;
+  for (const device of devices.values()) {
+    if (updatePersisted(device)) changed = true;
+  }
+  if (changed) scheduleSave();
+}
+
+// Write any pending device changes now (on shutdown)
+export function flushDevices(): void {
+  if (!devicesDirty) return;
+  if (saveTimer) {
+    clearTimeout(saveTimer);
+    saveTimer = null;
+  }
   try {
-    // Create a deep copy with button states stripped out
-    const dataToSave: Record<string, any> = {};
-    for (const [id, device] of devices) {
-      const deviceCopy = JSON.parse(JSON.stringify(device));
-      // Remove transient state from buttons - will be refreshed from plugins on startup
-      if (deviceCopy.config?.buttons) {
-        for (const button of deviceCopy.config.buttons) {
-          delete button.state;
-          delete button.speedLevel;
-        }
-      }
-      dataToSave[id] = deviceCopy;
-    }
-    fs.writeFileSync(DEVICES_FILE, JSON.stringify(dataToSave, null, 2));
+    const tmp = `${DEVICES_FILE}.tmp`;
+    fs.writeFileSync(tmp, devicesFileContent());
+    fs.renameSync(tmp, DEVICES_FILE);
+    devicesDirty = false;
   } catch (error) {
     console.error('Failed to save devices:', error);
   }
@@ -271,14 +424,17 @@ export function getDevice(id: string): Device | undefined {
 
 // Add or update device
 export function upsertDevice(device: Device): void {
+  unindexDevice(device.id);
   devices.set(device.id, device);
-  saveDevices();
+  indexDevice(device);
+  if (updatePersisted(device)) scheduleSave();
 }
 
 // Delete device
 export function deleteDevice(id: string): boolean {
+  unindexDevice(id);
   const result = devices.delete(id);
-  if (result) saveDevices();
+  if (result && persistedDevices.delete(id)) scheduleSave();
   return result;
 }
 
@@ -361,6 +517,10 @@ export function createDefaultConfig(deviceId: string, name: string, ip: string):
 
 let globalScenes: Map<string, GlobalScene> = new Map();
 
+// Bumped on every change to the global scenes; panel configs carry actions
+// compiled from them, so cached payloads are stale once it moves
+let globalScenesRevision = 0;
+
 // Load global scenes from file
 export function loadGlobalScenes(): void {
   try {
@@ -368,6 +528,7 @@ export function loadGlobalScenes(): void {
       const data = fs.readFileSync(SCENES_FILE, 'utf-8');
       const parsed = JSON.parse(data);
       globalScenes = new Map(Object.entries(parsed));
+      globalScenesRevision++;
       console.log(`Loaded ${globalScenes.size} global scenes from storage`);
     }
   } catch (error) {
@@ -399,16 +560,25 @@ export function getGlobalScene(id: string): GlobalScene | undefined {
 // Create or update global scene
 export function upsertGlobalScene(scene: GlobalScene): void {
   globalScenes.set(scene.id, scene);
+  globalScenesRevision++;
   saveGlobalScenes();
 }
 
 // Delete global scene
 export function deleteGlobalScene(id: string): boolean {
   const result = globalScenes.delete(id);
-  if (result) saveGlobalScenes();
+  if (result) {
+    globalScenesRevision++;
+    saveGlobalScenes();
+  }
   return result;
 }
 
+// Revision of the global scenes, for caches built from them
+export function getGlobalScenesRevision(): number {
+  return globalScenesRevision;
+}
+
 // Generate unique scene ID
 export function generateSceneId(): string {
   return 'scene-' + Date.now().toString(36) + Math.random().toString(36).substr(2, 5);
@@ -514,7 +684,76 @@ export function getEffectiveThemeSchedule(device: Device): ThemeScheduleConfig |
   return device.config?.display?.dayNightMode;
 }
 
+// ============================================================================
+// Crash Reports
+// ============================================================================
+
+// Previous-boot crash summary a panel uploads after its first config fetch
+// (device side: include/crash_report.h)
+export interface CrashReport {
+  receivedAt: number;
+  resetReason: string;      // panic, int_wdt, task_wdt, wdt, brownout
+  firmware?: string;
+  uptimeS?: number;         // How long the crashed boot had run
+  heap?: Record<string, number>;
+  dump?: {
+    task: string;
+    pc: string;
+    cause: number;
+    vaddr: string;
+    elfSha256: string;
+    backtrace: string[];
+    btCorrupted: boolean;
+  } | null;
+}
+
+const CRASH_HISTORY_SIZE = 20;  // Kept per device, newest last
+
+let crashReports: Map<string, CrashReport[]> = new Map();
+
+// Load crash reports from file
+export function loadCrashReports(): void {
+  try {
+    if (fs.existsSync(CRASHES_FILE)) {
+      const data = fs.readFileSync(CRASHES_FILE, 'utf-8');
+      crashReports = new Map(Object.entries(JSON.parse(data)));
+    }
+  } catch (error) {
+    console.error('Failed to load crash reports:', error);
+    crashReports = new Map();
+  }
+}
+
+// Save crash reports to file
+export function saveCrashReports(): void {
+  try {
+    fs.writeFileSync(CRASHES_FILE, JSON.stringify(Object.fromEntries(crashReports), null, 2));
+  } catch (error) {
+    console.error('Failed to save crash reports:', error);
+  }
+}
+
+// Crash reports for a device, oldest first
+export function getCrashReports(deviceId: string): CrashReport[] {
+  return crashReports.get(deviceId) ?? [];
+}
+
+// Record a crash report, dropping the oldest past CRASH_HISTORY_SIZE
+export function addCrashReport(deviceId: string, report: CrashReport): void {
+  let history = crashReports.get(deviceId);
+  if (!history) {
+    history = [];
+    crashReports.set(deviceId, history);
+  }
+  history.push(report);
+  if (history.length > CRASH_HISTORY_SIZE) {
+    history.splice(0, history.length - CRASH_HISTORY_SIZE);
+  }
+  saveCrashReports();
+}
+
 // Initialize
 loadDevices();
 loadGlobalScenes();
 loadGlobalSettings();
+loadCrashReports();
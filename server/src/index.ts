@@ -11,7 +11,11 @@ import settingsRouter from './routes/settings';
 import { startDiscovery } from './services/discoveryService';
 import { startHealthChecks, stopHealthChecks, syncReportingUrls } from './services/deviceService';
 import { startStatePolling, stopStatePolling } from './services/stateSyncService';
+import { startDeviceSockets, stopDeviceSockets } from './services/deviceSocketService';
+import { startStateMulticast, stopStateMulticast } from './services/multicastService';
+import { startTelemetry, stopTelemetry } from './services/telemetryService';
 import { pluginManager } from './plugins/pluginManager';
+import { flushDevices } from './db';
 
 // Import plugins
 import homebridgePlugin from './plugins/homebridge';
@@ -66,6 +70,15 @@ async function start() {
     // Start mDNS discovery
     startDiscovery();
 
+    // Telemetry history, fed by the panels' pongs
+    startTelemetry();
+
+    // Open persistent WebSocket channels to adopted panels
+    startDeviceSockets();
+
+    // Heartbeat the state multicast group (when the setting is on)
+    startStateMulticast();
+
     // Start periodic health checks (every 60 seconds)
     startHealthChecks(60000);
 
@@ -82,7 +95,11 @@ process.on('SIGINT', async () => {
   console.log('\nShutting down...');
   stopStatePolling();
   stopHealthChecks();
+  stopDeviceSockets();
+  stopStateMulticast();
+  stopTelemetry();
   await pluginManager.shutdown();
+  flushDevices();
   process.exit(0);
 });
 
@@ -90,7 +107,11 @@ process.on('SIGTERM', async () => {
   console.log('\nShutting down...');
   stopStatePolling();
   stopHealthChecks();
+  stopDeviceSockets();
+  stopStateMulticast();
+  stopTelemetry();
   await pluginManager.shutdown();
+  flushDevices();
   process.exit(0);
 });
 
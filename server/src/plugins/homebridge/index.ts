@@ -4,8 +4,11 @@ import {
   ImportableDevice,
   ActionContext,
   ActionResult,
-  DeviceState
+  DeviceState,
+  DirectControl
 } from '../types';
+import { pushExternalDeviceState } from '../../services/stateSyncService';
+import { refreshDirectControl } from '../../services/deviceService';
 
 // Homebridge accessory from API
 interface HomebridgeAccessory {
@@ -67,17 +70,58 @@ interface HomebridgeLayout {
   rooms: HomebridgeRoom[];
 }
 
+// A snapshot of every accessory's state is reused for this long, so one poll
+// tick (and single lookups during it) costs a single request
+const SNAPSHOT_MAX_AGE = 2000;
+
+// State changes arrive over the Homebridge UI's socket.io "/accessories"
+// namespace as they happen (characteristics with ev: true). Polling stays on
+// as a backstop, slowed down while the socket is up.
+const POLL_INTERVAL = 15000;             // Without events
+const BACKSTOP_POLL_INTERVAL = 120000;    // While events arrive
+const EVENTS_RECONNECT_MIN_DELAY = 1000;
+const EVENTS_RECONNECT_MAX_DELAY = 60000;
+const EVENTS_NAMESPACE = '/accessories';
+
+// Bun ships a browser-compatible WebSocket client; tsconfig only pulls in
+// ES2020 typings, so describe the subset used here.
+interface SocketLike {
+  send(data: string): void;
+  close(): void;
+  onopen: (() => void) | null;
+  onmessage: ((event: { data: unknown }) => void) | null;
+  onclose: (() => void) | null;
+  onerror: ((event: unknown) => void) | null;
+}
+const WebSocketClient: new (url: string) => SocketLike = (globalThis as any).WebSocket;
+
 class HomebridgePlugin implements Plugin {
   id = 'homebridge';
   name = 'Homebridge';
   type: 'device-provider' = 'device-provider';
   description = 'Import and control devices from Homebridge';
-  pollingInterval = 15000;  // Poll Homebridge devices every 15 seconds
+
+  // Poll every 15 seconds, or only as a backstop while events arrive
+  get pollingInterval(): number {
+    return this.eventsReady ? BACKSTOP_POLL_INTERVAL : POLL_INTERVAL;
+  }
 
   private token: string | null = null;
   private tokenExpiry: number = 0;
+  private tokenRequest: Promise<string> | null = null;
+  private snapshot: { at: number; states: Map<string, DeviceState> } | null = null;
+  private snapshotRequest: Promise<Map<string, DeviceState>> | null = null;
   private config: PluginConfig | null = null;
 
+  // Event socket
+  private events: SocketLike | null = null;
+  private eventsReady = false;          // Subscribed and receiving
+  private eventsStopped = true;
+  private eventsRetryDelay = EVENTS_RECONNECT_MIN_DELAY;
+  private eventsRetryTimer: NodeJS.Timeout | null = null;
+  private eventsWatchdog: NodeJS.Timeout | null = null;
+  private eventsPingWindow = 0;         // Engine.IO ping interval + timeout
+
   async initialize(config: PluginConfig): Promise<void> {
     this.config = config;
 
@@ -90,17 +134,165 @@ class HomebridgePlugin implements Plugin {
       throw new Error('Homebridge username and password are required');
     }
 
-    // Clear cached token on re-initialization
+    // Clear cached token and states on re-initialization
     this.token = null;
     this.tokenExpiry = 0;
+    this.snapshot = null;
+
+    this.stopEvents();
+    this.eventsStopped = false;
+    this.connectEvents();
   }
 
   async shutdown(): Promise<void> {
+    this.stopEvents();
     this.token = null;
     this.tokenExpiry = 0;
     this.config = null;
   }
 
+  // Open the event socket (retried with backoff until shutdown)
+  private async connectEvents(): Promise<void> {
+    if (this.eventsStopped || this.events) return;
+    if (!WebSocketClient) {
+      console.log('Homebridge: No WebSocket client in this runtime, polling only');
+      return;
+    }
+
+    let socket: SocketLike;
+    try {
+      const token = await this.getToken();
+      if (this.eventsStopped || this.events) return;
+      const url = `${this.getBaseUrl().replace(/^http/, 'ws')}/socket.io/?token=${encodeURIComponent(token)}&EIO=4&transport=websocket`;
+      socket = new WebSocketClient(url);
+    } catch (error: any) {
+      console.log(`Homebridge: Event socket unavailable (${error.message}), polling only`);
+      this.scheduleEventsReconnect();
+      return;
+    }
+    this.events = socket;
+
+    socket.onmessage = (event) => {
+      if (typeof event.data === 'string') {
+        this.onEventPacket(socket, event.data);
+      }
+    };
+    socket.onclose = () => {
+      if (this.events !== socket) return;
+      this.events = null;
+      if (this.eventsReady) {
+        console.log('Homebridge: Event socket closed, polling every 15s until it is back');
+      }
+      this.eventsReady = false;
+      this.clearEventsWatchdog();
+      this.scheduleEventsReconnect();
+    };
+    socket.onerror = () => {
+      socket.close();
+    };
+  }
+
+  // One Engine.IO packet: type digit, then for messages a Socket.IO packet
+  private onEventPacket(socket: SocketLike, packet: string): void {
+    this.armEventsWatchdog(socket);
+
+    switch (packet[0]) {
+      case '0': {
+        // Engine.IO open: join the accessories namespace
+        const open = JSON.parse(packet.slice(1)) as { pingInterval: number; pingTimeout: number };
+        this.eventsPingWindow = open.pingInterval + open.pingTimeout;
+        this.armEventsWatchdog(socket);
+        socket.send(`40${EVENTS_NAMESPACE},`);
+        return;
+      }
+      case '2':
+        socket.send('3');   // Pong
+        return;
+      case '4':
+        break;
+      default:
+        return;
+    }
+
+    const prefix = packet.slice(1, 2);
+    const body = packet.slice(2);
+    if (!body.startsWith(`${EVENTS_NAMESPACE},`)) return;
+    const payload = body.slice(EVENTS_NAMESPACE.length + 1);
+
+    if (prefix === '0') {
+      // Namespace joined: the reply to this is every accessory, later only changed ones
+      socket.send(`42${EVENTS_NAMESPACE},["get-accessories"]`);
+      this.eventsReady = true;
+      this.eventsRetryDelay = EVENTS_RECONNECT_MIN_DELAY;
+      console.log('Homebridge: Subscribed to accessory events, polling every 120s as a backstop');
+    } else if (prefix === '4') {
+      console.log(`Homebridge: Event subscription refused: ${payload}`);
+      this.token = null;  // Most likely an expired token; log in again on retry
+      socket.close();
+    } else if (prefix === '2') {
+      // Optional ack id before the JSON array
+      const [name, data] = JSON.parse(payload.replace(/^\d+/, '')) as [string, unknown];
+      if (name === 'accessories-data' && Array.isArray(data)) {
+        this.onAccessoriesData(data as HomebridgeAccessory[]);
+      } else if (name === 'accessories-reload-required') {
+        socket.send(`42${EVENTS_NAMESPACE},["get-accessories"]`);
+      }
+    }
+  }
+
+  // Accessories whose characteristics changed: feed them to the panels that show them
+  private onAccessoriesData(accessories: HomebridgeAccessory[]): void {
+    for (const accessory of accessories) {
+      if (!accessory.uniqueId || !accessory.serviceCharacteristics) continue;
+      const state = this.accessoryState(accessory);
+
+      // Keep a fresh snapshot fresh; a stale one is refetched by the next poll anyway
+      this.snapshot?.states.set(accessory.uniqueId, state);
+
+      pushExternalDeviceState(this.id, accessory.uniqueId, state.state, state.speedLevel).catch(error => {
+        console.error(`Homebridge: Error pushing event for ${accessory.uniqueId}:`, error);
+      });
+    }
+  }
+
+  // Close the socket when Engine.IO pings stop arriving
+  private armEventsWatchdog(socket: SocketLike): void {
+    this.clearEventsWatchdog();
+    if (this.eventsPingWindow > 0) {
+      this.eventsWatchdog = setTimeout(() => socket.close(), this.eventsPingWindow);
+    }
+  }
+
+  private clearEventsWatchdog(): void {
+    if (this.eventsWatchdog) {
+      clearTimeout(this.eventsWatchdog);
+      this.eventsWatchdog = null;
+    }
+  }
+
+  private scheduleEventsReconnect(): void {
+    if (this.eventsStopped || this.eventsRetryTimer) return;
+    const delay = this.eventsRetryDelay;
+    this.eventsRetryDelay = Math.min(delay * 2, EVENTS_RECONNECT_MAX_DELAY);
+    this.eventsRetryTimer = setTimeout(() => {
+      this.eventsRetryTimer = null;
+      this.connectEvents();
+    }, delay);
+  }
+
+  private stopEvents(): void {
+    this.eventsStopped = true;
+    this.eventsReady = false;
+    if (this.eventsRetryTimer) {
+      clearTimeout(this.eventsRetryTimer);
+      this.eventsRetryTimer = null;
+    }
+    this.clearEventsWatchdog();
+    const socket = this.events;
+    this.events = null;
+    socket?.close();
+  }
+
   // Get base URL from config
   private getBaseUrl(): string {
     if (!this.config?.settings.serverUrl) {
@@ -121,6 +313,16 @@ class HomebridgePlugin implements Plugin {
       return this.token;
     }
 
+    // Parallel state polls share one login
+    if (!this.tokenRequest) {
+      this.tokenRequest = this.login().finally(() => {
+        this.tokenRequest = null;
+      });
+    }
+    return this.tokenRequest;
+  }
+
+  private async login(): Promise<string> {
     const baseUrl = this.getBaseUrl();
     const { username, password } = this.config!.settings;
 
@@ -143,6 +345,9 @@ class HomebridgePlugin implements Plugin {
     this.tokenExpiry = Date.now() + (data.expires_in * 1000);
 
     console.log('Homebridge: Authenticated successfully');
+
+    // Panels controlling accessories directly need the new token
+    refreshDirectControl(this.id);
     return this.token!;
   }
 
@@ -323,6 +528,21 @@ class HomebridgePlugin implements Plugin {
     }
   }
 
+  // Panels can make the same PUT executeAction does, with our token, for as
+  // long as it is valid; they fall back to the server once it isn't
+  getDirectControl(): DirectControl | null {
+    if (!this.token || Date.now() >= this.tokenExpiry || !this.config?.settings.serverUrl) {
+      return null;
+    }
+    return {
+      url: `${this.getBaseUrl()}/api/accessories/`,
+      authorization: `Bearer ${this.token}`,
+      onBody: JSON.stringify({ characteristicType: 'On', value: 1 }),
+      offBody: JSON.stringify({ characteristicType: 'On', value: 0 }),
+      speedBody: '{"characteristicType":"RotationSpeed","value":{value}}'
+    };
+  }
+
   // Test connection to Homebridge
   async testConnection(): Promise<{ success: boolean; message: string }> {
     try {
@@ -356,8 +576,85 @@ class HomebridgePlugin implements Plugin {
     }
   }
 
+  // On/off and fan speed from an accessory's characteristics
+  private accessoryState(accessory: HomebridgeAccessory): DeviceState {
+    const onChar = accessory.serviceCharacteristics?.find(c => c.type === 'On');
+    const speedChar = accessory.serviceCharacteristics?.find(c => c.type === 'RotationSpeed');
+
+    // Handle various value formats from Homebridge
+    let state = false;
+    if (onChar?.value !== undefined) {
+      state = onChar.value === 1 || onChar.value === true || onChar.value === '1' || onChar.value === 'true';
+    }
+    const speedLevel = speedChar?.value as number | undefined;
+
+    return {
+      state,
+      speedLevel
+    };
+  }
+
+  // States of every accessory, from one GET /api/accessories shared by
+  // concurrent callers and reused while fresh
+  private async getStateSnapshot(): Promise<Map<string, DeviceState>> {
+    if (this.snapshot && Date.now() - this.snapshot.at < SNAPSHOT_MAX_AGE) {
+      return this.snapshot.states;
+    }
+    if (!this.snapshotRequest) {
+      this.snapshotRequest = this.fetchStateSnapshot().finally(() => {
+        this.snapshotRequest = null;
+      });
+    }
+    return this.snapshotRequest;
+  }
+
+  private async fetchStateSnapshot(): Promise<Map<string, DeviceState>> {
+    const baseUrl = this.getBaseUrl();
+    const token = await this.getToken();
+
+    const response = await fetch(`${baseUrl}/api/accessories`, {
+      headers: {
+        'Authorization': `Bearer ${token}`
+      }
+    });
+
+    if (!response.ok) {
+      throw new Error(`Failed to fetch accessories: ${response.status}`);
+    }
+
+    const accessories = await response.json() as HomebridgeAccessory[];
+    const states = new Map<string, DeviceState>();
+    for (const accessory of accessories) {
+      states.set(accessory.uniqueId, this.accessoryState(accessory));
+    }
+
+    this.snapshot = { at: Date.now(), states };
+    return states;
+  }
+
+  // Fetch the states of many devices with one request
+  async getDeviceStates(externalDeviceIds: string[]): Promise<Map<string, DeviceState>> {
+    const snapshot = await this.getStateSnapshot();
+    const states = new Map<string, DeviceState>();
+    for (const id of externalDeviceIds) {
+      const state = snapshot.get(id);
+      if (state) {
+        states.set(id, state);
+      } else {
+        console.log(`Homebridge: No accessory ${id.substring(0, 12)} in snapshot`);
+      }
+    }
+    return states;
+  }
+
   // Fetch current state of a device from Homebridge
   async getDeviceState(externalDeviceId: string): Promise<DeviceState | null> {
+    // A fresh snapshot from this poll tick answers without a request
+    if (this.snapshot && Date.now() - this.snapshot.at < SNAPSHOT_MAX_AGE) {
+      const cached = this.snapshot.states.get(externalDeviceId);
+      if (cached) return cached;
+    }
+
     try {
       const baseUrl = this.getBaseUrl();
       const token = await this.getToken();
@@ -375,24 +672,11 @@ class HomebridgePlugin implements Plugin {
 
       const accessory = await response.json() as HomebridgeAccessory;
 
-      // Extract On characteristic value
-      const onChar = accessory.serviceCharacteristics?.find(c => c.type === 'On');
-      const speedChar = accessory.serviceCharacteristics?.find(c => c.type === 'RotationSpeed');
-
       // Log raw value for debugging
+      const onChar = accessory.serviceCharacteristics?.find(c => c.type === 'On');
       console.log(`Homebridge: Device ${accessory.serviceName || externalDeviceId.substring(0, 12)} On.value=${onChar?.value} (type: ${typeof onChar?.value})`);
 
-      // Handle various value formats from Homebridge
-      let state = false;
-      if (onChar?.value !== undefined) {
-        state = onChar.value === 1 || onChar.value === true || onChar.value === '1' || onChar.value === 'true';
-      }
-      const speedLevel = speedChar?.value as number | undefined;
-
-      return {
-        state,
-        speedLevel
-      };
+      return this.accessoryState(accessory);
     } catch (error: any) {
       console.error(`Homebridge: Error fetching state for ${externalDeviceId}:`, error.message);
       return null;
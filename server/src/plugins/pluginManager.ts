@@ -8,11 +8,12 @@ import {
   ActionContext,
   ActionResult,
   ButtonBinding,
-  DeviceState
+  DeviceState,
+  DirectControl
 } from './types';
 
-// Data directory path
-const DATA_DIR = path.join(__dirname, '../../data');
+// Data directory path (DATA_DIR overrides, e.g. for the fleet simulator)
+const DATA_DIR = process.env.DATA_DIR || path.join(__dirname, '../../data');
 const PLUGINS_FILE = path.join(DATA_DIR, 'plugins.json');
 
 // Ensure data directory exists
@@ -178,6 +179,14 @@ class PluginManager {
     return { success: false, error: 'Plugin does not support action execution' };
   }
 
+  // Direct control target of an enabled plugin, if it offers one
+  getDirectControl(pluginId: string): DirectControl | null {
+    const plugin = this.plugins.get(pluginId);
+    const config = this.configs.get(pluginId);
+    if (!plugin?.getDirectControl || !config?.enabled) return null;
+    return plugin.getDirectControl();
+  }
+
   // Get plugin configuration
   getPluginConfig(pluginId: string): PluginConfig | undefined {
     return this.configs.get(pluginId);
@@ -284,6 +293,26 @@ class PluginManager {
       return null;
     }
   }
+
+  // Get many device states of one plugin at once; null if the plugin has no batch API
+  async getDeviceStates(pluginId: string, externalDeviceIds: string[]): Promise<Map<string, DeviceState> | null> {
+    const plugin = this.plugins.get(pluginId);
+    if (!plugin?.getDeviceStates) {
+      return null;
+    }
+
+    const config = this.configs.get(pluginId);
+    if (!config?.enabled) {
+      return new Map();
+    }
+
+    try {
+      return await plugin.getDeviceStates(externalDeviceIds);
+    } catch (error: any) {
+      console.error(`Error getting device states from ${pluginId}:`, error.message);
+      return new Map();
+    }
+  }
 }
 
 // Singleton instance
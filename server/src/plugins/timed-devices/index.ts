@@ -6,9 +6,9 @@ import {
   ActionResult,
   DeviceState
 } from '../types';
-import { scheduler, ScheduledJob, ActionExecutor } from './scheduler';
+import { scheduler, ScheduledJob, ActionExecutor, SchedulerStats } from './scheduler';
 import { pluginManager } from '../pluginManager';
-import { pushExternalDeviceState } from '../../services/stateSyncService';
+import { pushExternalDeviceState, pushExternalDeviceStates } from '../../services/stateSyncService';
 
 // Timed device configuration stored in plugin settings
 export interface TimedDeviceConfig {
@@ -75,10 +75,14 @@ class TimedDevicesPlugin implements Plugin {
     scheduler.setActionExecutor(executor);
 
     // Set up state pusher to update all panels when scheduled jobs execute
-    scheduler.setStatePusher(async (pluginId, externalDeviceId, newState) => {
-      await pushExternalDeviceState(pluginId, externalDeviceId, newState);
+    // (jobs falling due together share one fan-out)
+    scheduler.setStatePusher(async changes => {
+      await pushExternalDeviceStates(changes);
     });
 
+    // Jobs that were pending when the server last stopped
+    scheduler.restore();
+
     console.log(`[TimedDevices] Initialized with ${this.getTimedDevices().length} timed device(s)`);
   }
 
@@ -359,6 +363,11 @@ class TimedDevicesPlugin implements Plugin {
     return scheduler.cancelJob(jobId);
   }
 
+  // Pending count, batches and how late jobs ran
+  getSchedulerStats(): SchedulerStats {
+    return scheduler.getStats();
+  }
+
   // Discover devices from other plugins for selection
   async discoverSourceDevices(): Promise<Array<ImportableDevice & { pluginId: string; pluginName: string }>> {
     const allDevices: Array<ImportableDevice & { pluginId: string; pluginName: string }> = [];
@@ -1,4 +1,15 @@
 // Scheduler for timed device actions
+//
+// Pending jobs sit in a min-heap on executeAt behind a single timer, armed
+// for the earliest one. When it fires, every job due within BATCH_WINDOW_MS
+// runs together: their actions go out a few at a time and the resulting
+// states reach the panels in one fan-out (one multicast, at most one push
+// per panel). Pending jobs are saved to DATA_DIR/timed-jobs.json, so a
+// restart picks them up again and runs any that fell due while it was down.
+// How late each job ran against its executeAt is kept for getStats().
+
+import * as fs from 'fs';
+import * as path from 'path';
 
 export interface ScheduledJob {
   id: string;
@@ -14,6 +25,7 @@ export interface ScheduledJob {
   }>;
   status: 'pending' | 'executing' | 'completed' | 'failed' | 'cancelled';
   error?: string;
+  startedAt?: number;        // When it actually ran
   completedAt?: number;
 }
 
@@ -23,18 +35,43 @@ export type ActionExecutor = (
   newState: boolean
 ) => Promise<{ success: boolean; error?: string }>;
 
+// The new states of the devices a batch of jobs switched
 export type StatePusher = (
-  pluginId: string,
-  externalDeviceId: string,
-  newState: boolean
+  changes: Array<{ pluginId: string; externalDeviceId: string; state: boolean }>
 ) => Promise<void>;
 
+export interface SchedulerStats {
+  pending: number;
+  nextDueIn: number | null;  // ms until the earliest pending job
+  batches: number;
+  jobsRun: number;
+  lag: { last: number; p50: number; p95: number; max: number };  // ms late, over recent jobs
+}
+
+// Data directory path (DATA_DIR overrides, e.g. for the fleet simulator)
+const DATA_DIR = process.env.DATA_DIR || path.join(__dirname, '../../../data');
+const JOBS_FILE = path.join(DATA_DIR, 'timed-jobs.json');
+
+const BATCH_WINDOW_MS = 50;          // Jobs this close to the first due one run with it
+const MAX_TIMER_MS = 2147483647;     // setTimeout's limit (~24.8 days)
+const ACTION_CONCURRENCY = 8;        // Device actions in flight per batch
+const COMPLETED_RETENTION_MS = 60000;  // Finished jobs stay visible this long
+const LAG_SAMPLES = 200;
+const SAVE_DELAY_MS = 500;
+
 class Scheduler {
   private jobs: Map<string, ScheduledJob> = new Map();
-  private timers: Map<string, NodeJS.Timeout> = new Map();
+  private heap: ScheduledJob[] = [];   // Pending jobs by executeAt (cancelled ones are skipped when popped)
+  private timer: NodeJS.Timeout | null = null;
+  private timerAt = 0;
+  private saveTimer: NodeJS.Timeout | null = null;
   private jobCounter: number = 0;
   private actionExecutor: ActionExecutor | null = null;
   private statePusher: StatePusher | null = null;
+  private running = false;
+  private batches = 0;
+  private jobsRun = 0;
+  private lagSamples: number[] = [];
 
   setActionExecutor(executor: ActionExecutor): void {
     this.actionExecutor = executor;
@@ -44,6 +81,34 @@ class Scheduler {
     this.statePusher = pusher;
   }
 
+  // Load the jobs saved before a restart (once the executor is set)
+  restore(): void {
+    let saved: ScheduledJob[] = [];
+    try {
+      if (fs.existsSync(JOBS_FILE)) {
+        saved = JSON.parse(fs.readFileSync(JOBS_FILE, 'utf-8'));
+      }
+    } catch (error) {
+      console.error('[TimedDevices] Failed to load saved jobs:', error);
+      return;
+    }
+
+    const now = Date.now();
+    let overdue = 0;
+    for (const job of saved) {
+      if (this.jobs.has(job.id)) continue;
+      // A job cut short by the restart runs again: it only sets states
+      job.status = 'pending';
+      this.jobs.set(job.id, job);
+      this.push(job);
+      if (job.executeAt <= now) overdue++;
+    }
+    if (saved.length > 0) {
+      console.log(`[TimedDevices] Restored ${saved.length} pending job(s), ${overdue} overdue`);
+    }
+    this.arm();
+  }
+
   scheduleJob(
     timedDeviceId: string,
     timedDeviceName: string,
@@ -66,80 +131,190 @@ class Scheduler {
     };
 
     this.jobs.set(id, job);
-
-    // Schedule the execution
-    const timer = setTimeout(() => this.executeJob(id), delayMs);
-    this.timers.set(id, timer);
+    this.push(job);
+    this.arm();
+    this.scheduleSave();
 
     console.log(`[TimedDevices] Scheduled job ${id}: ${action} in ${Math.round(delayMs / 1000)}s for ${targetDevices.length} device(s)`);
 
     return job;
   }
 
-  private async executeJob(jobId: string): Promise<void> {
-    const job = this.jobs.get(jobId);
-    if (!job) return;
+  // ============================================================================
+  // Heap
+  // ============================================================================
+
+  private push(job: ScheduledJob): void {
+    const heap = this.heap;
+    heap.push(job);
+    let i = heap.length - 1;
+    while (i > 0) {
+      const parent = (i - 1) >> 1;
+      if (heap[parent].executeAt <= heap[i].executeAt) break;
+      [heap[parent], heap[i]] = [heap[i], heap[parent]];
+      i = parent;
+    }
+  }
 
-    if (job.status === 'cancelled') {
-      this.cleanup(jobId);
+  private pop(): ScheduledJob | undefined {
+    const heap = this.heap;
+    const top = heap[0];
+    const last = heap.pop();
+    if (heap.length > 0 && last) {
+      heap[0] = last;
+      let i = 0;
+      for (;;) {
+        const left = 2 * i + 1;
+        const right = left + 1;
+        let smallest = i;
+        if (left < heap.length && heap[left].executeAt < heap[smallest].executeAt) smallest = left;
+        if (right < heap.length && heap[right].executeAt < heap[smallest].executeAt) smallest = right;
+        if (smallest === i) break;
+        [heap[smallest], heap[i]] = [heap[i], heap[smallest]];
+        i = smallest;
+      }
+    }
+    return top;
+  }
+
+  // Earliest job still pending, dropping cancelled ones off the top
+  private peek(): ScheduledJob | undefined {
+    while (this.heap.length > 0 && this.heap[0].status !== 'pending') {
+      this.pop();
+    }
+    return this.heap[0];
+  }
+
+  // ============================================================================
+  // Timer
+  // ============================================================================
+
+  // Point the one timer at the earliest pending job
+  private arm(): void {
+    if (this.running) return;  // Re-armed when the batch finishes
+    const next = this.peek();
+    if (!next) {
+      if (this.timer) clearTimeout(this.timer);
+      this.timer = null;
       return;
     }
+    if (this.timer && this.timerAt === next.executeAt) return;
+    if (this.timer) clearTimeout(this.timer);
+    const delay = Math.min(Math.max(0, next.executeAt - Date.now()), MAX_TIMER_MS);
+    this.timerAt = next.executeAt;
+    this.timer = setTimeout(() => {
+      this.timer = null;
+      this.runDue().catch(error => {
+        console.error('[TimedDevices] Batch failed:', error);
+      });
+    }, delay);
+  }
 
-    job.status = 'executing';
-    console.log(`[TimedDevices] Executing job ${jobId}: ${job.action} on ${job.targetDevices.length} device(s)`);
+  private async runDue(): Promise<void> {
+    this.running = true;
+    try {
+      // Everything due now or within the window, including jobs that came
+      // due while the previous batch ran
+      for (;;) {
+        const horizon = Date.now() + BATCH_WINDOW_MS;
+        const batch: ScheduledJob[] = [];
+        for (let next = this.peek(); next && next.executeAt <= horizon; next = this.peek()) {
+          batch.push(this.pop()!);
+        }
+        if (batch.length === 0) break;
+        await this.executeBatch(batch);
+      }
+    } finally {
+      this.running = false;
+      this.prune();
+      this.scheduleSave();
+      this.arm();
+    }
+  }
+
+  private async executeBatch(batch: ScheduledJob[]): Promise<void> {
+    const started = Date.now();
+    this.batches++;
+    for (const job of batch) {
+      job.status = 'executing';
+      job.startedAt = started;
+      this.recordLag(Math.max(0, started - job.executeAt));
+    }
+    console.log(`[TimedDevices] Executing ${batch.length} job(s): ${batch.map(job => `${job.id} ${job.action}`).join(', ')}`);
 
     if (!this.actionExecutor) {
-      job.status = 'failed';
-      job.error = 'No action executor configured';
-      job.completedAt = Date.now();
+      for (const job of batch) {
+        job.status = 'failed';
+        job.error = 'No action executor configured';
+        job.completedAt = Date.now();
+      }
       return;
     }
 
-    const newState = job.action === 'turn_on';
-    const errors: string[] = [];
+    // Every target of every job, a few actions at a time
+    const actions = batch.flatMap(job => job.targetDevices.map(device => ({ job, device })));
+    const errors: Map<ScheduledJob, string[]> = new Map();
+    const changes: Map<string, { pluginId: string; externalDeviceId: string; state: boolean }> = new Map();
+    let next = 0;
+    const worker = async () => {
+      while (next < actions.length) {
+        const { job, device } = actions[next++];
+        const newState = job.action === 'turn_on';
+        try {
+          const result = await this.actionExecutor!(device.pluginId, device.externalDeviceId, newState);
+          if (result.success) {
+            // The last job to touch a device wins, as it would have run last
+            changes.set(`${device.pluginId}\0${device.externalDeviceId}`,
+                        { pluginId: device.pluginId, externalDeviceId: device.externalDeviceId, state: newState });
+          } else {
+            errors.set(job, [...(errors.get(job) ?? []), `${device.deviceName}: ${result.error || 'Unknown error'}`]);
+          }
+        } catch (err: any) {
+          errors.set(job, [...(errors.get(job) ?? []), `${device.deviceName}: ${err.message}`]);
+        }
+      }
+    };
+    await Promise.all(Array.from({ length: Math.max(1, Math.min(ACTION_CONCURRENCY, actions.length)) }, worker));
 
-    for (const device of job.targetDevices) {
+    // Push state updates to all panels with buttons for these devices, at once
+    if (this.statePusher && changes.size > 0) {
       try {
-        const result = await this.actionExecutor(device.pluginId, device.externalDeviceId, newState);
-        if (!result.success) {
-          errors.push(`${device.deviceName}: ${result.error || 'Unknown error'}`);
-        } else if (this.statePusher) {
-          // Push state update to all panels with buttons for this device
-          await this.statePusher(device.pluginId, device.externalDeviceId, newState);
-        }
+        await this.statePusher([...changes.values()]);
       } catch (err: any) {
-        errors.push(`${device.deviceName}: ${err.message}`);
+        console.error(`[TimedDevices] State push failed: ${err.message}`);
       }
     }
 
-    if (errors.length > 0) {
-      job.status = 'failed';
-      job.error = errors.join('; ');
-    } else {
-      job.status = 'completed';
+    const completedAt = Date.now();
+    for (const job of batch) {
+      const jobErrors = errors.get(job);
+      if (jobErrors) {
+        job.status = 'failed';
+        job.error = jobErrors.join('; ');
+      } else {
+        job.status = 'completed';
+      }
+      job.completedAt = completedAt;
+      this.jobsRun++;
+      console.log(`[TimedDevices] Job ${job.id} ${job.status}${job.error ? ': ' + job.error : ''}`);
     }
-    job.completedAt = Date.now();
-
-    console.log(`[TimedDevices] Job ${jobId} ${job.status}${job.error ? ': ' + job.error : ''}`);
-
-    // Keep completed jobs for a while for status display
-    setTimeout(() => this.cleanup(jobId), 60000);
   }
 
+  // ============================================================================
+  // Cancelling
+  // ============================================================================
+
   cancelJob(jobId: string): boolean {
     const job = this.jobs.get(jobId);
     if (!job || job.status !== 'pending') {
       return false;
     }
 
+    // Left in the heap, skipped when it reaches the top
     job.status = 'cancelled';
     job.completedAt = Date.now();
-
-    const timer = this.timers.get(jobId);
-    if (timer) {
-      clearTimeout(timer);
-      this.timers.delete(jobId);
-    }
+    this.arm();
+    this.scheduleSave();
 
     console.log(`[TimedDevices] Cancelled job ${jobId}`);
     return true;
@@ -156,13 +331,43 @@ class Scheduler {
     return count;
   }
 
-  private cleanup(jobId: string): void {
-    const timer = this.timers.get(jobId);
-    if (timer) {
-      clearTimeout(timer);
-      this.timers.delete(jobId);
+  // ============================================================================
+  // Bookkeeping
+  // ============================================================================
+
+  // Forget finished jobs once they have been visible for a while
+  private prune(): void {
+    const cutoff = Date.now() - COMPLETED_RETENTION_MS;
+    for (const [id, job] of this.jobs) {
+      if (job.status !== 'pending' && job.status !== 'executing' && (job.completedAt ?? 0) < cutoff) {
+        this.jobs.delete(id);
+      }
+    }
+  }
+
+  private recordLag(ms: number): void {
+    this.lagSamples.push(ms);
+    if (this.lagSamples.length > LAG_SAMPLES) this.lagSamples.shift();
+  }
+
+  // Pending jobs to disk, shortly after the last change
+  private scheduleSave(): void {
+    if (this.saveTimer) return;
+    this.saveTimer = setTimeout(() => {
+      this.saveTimer = null;
+      this.save();
+    }, SAVE_DELAY_MS);
+  }
+
+  private save(): void {
+    const pending = [...this.jobs.values()].filter(job => job.status === 'pending');
+    try {
+      const tmp = `${JOBS_FILE}.tmp`;
+      fs.writeFileSync(tmp, JSON.stringify(pending, null, 2));
+      fs.renameSync(tmp, JOBS_FILE);
+    } catch (error) {
+      console.error('[TimedDevices] Failed to save jobs:', error);
     }
-    this.jobs.delete(jobId);
   }
 
   getJob(jobId: string): ScheduledJob | undefined {
@@ -170,6 +375,7 @@ class Scheduler {
   }
 
   getAllJobs(): ScheduledJob[] {
+    this.prune();
     return Array.from(this.jobs.values());
   }
 
@@ -183,12 +389,35 @@ class Scheduler {
     return Array.from(this.jobs.values()).filter(j => j.timedDeviceId === timedDeviceId);
   }
 
+  getStats(): SchedulerStats {
+    const sorted = [...this.lagSamples].sort((a, b) => a - b);
+    const at = (q: number) => sorted.length ? sorted[Math.min(sorted.length - 1, Math.floor(q * sorted.length))] : 0;
+    const next = this.peek();
+    return {
+      pending: this.getActiveJobs().filter(j => j.status === 'pending').length,
+      nextDueIn: next ? Math.max(0, next.executeAt - Date.now()) : null,
+      batches: this.batches,
+      jobsRun: this.jobsRun,
+      lag: {
+        last: this.lagSamples.length ? this.lagSamples[this.lagSamples.length - 1] : 0,
+        p50: at(0.5),
+        p95: at(0.95),
+        max: sorted.length ? sorted[sorted.length - 1] : 0
+      }
+    };
+  }
+
   shutdown(): void {
-    for (const timer of this.timers.values()) {
-      clearTimeout(timer);
+    if (this.timer) clearTimeout(this.timer);
+    this.timer = null;
+    if (this.saveTimer) {
+      clearTimeout(this.saveTimer);
+      this.saveTimer = null;
     }
-    this.timers.clear();
+    // Pending jobs stay on disk for the next start
+    this.save();
     this.jobs.clear();
+    this.heap = [];
     this.jobCounter = 0;
     console.log('[TimedDevices] Scheduler shutdown');
   }
@@ -51,6 +51,17 @@ export interface DeviceState {
   speedLevel?: number;  // 0-100 for fans
 }
 
+// How a panel can reach a plugin's devices itself (direct control): a PUT to
+// url + the binding's externalDeviceId, with the Authorization header and a
+// body from the templates ("{value}" in speedBody is the fan speed level)
+export interface DirectControl {
+  url: string;
+  authorization?: string;
+  onBody: string;
+  offBody: string;
+  speedBody?: string;
+}
+
 // HTTP request configuration for simple HTTP action plugins
 export interface HttpRequest {
   url: string;
@@ -72,6 +83,9 @@ export interface Plugin {
   // Set to 0 or undefined to use the default interval
   pollingInterval?: number;
 
+  // State requests the poller keeps in flight at once (default: 4)
+  maxConcurrentPolls?: number;
+
   // Lifecycle methods
   initialize(config: PluginConfig): Promise<void>;
   shutdown(): Promise<void>;
@@ -90,6 +104,14 @@ export interface Plugin {
 
   // Fetch current state of an external device (optional - for state polling)
   getDeviceState?(externalDeviceId: string): Promise<DeviceState | null>;
+
+  // Fetch the states of many external devices in one go (optional - preferred
+  // by the poller over getDeviceState); IDs without a state are left out
+  getDeviceStates?(externalDeviceIds: string[]): Promise<Map<string, DeviceState>>;
+
+  // Where panels can send actions themselves (optional - direct control);
+  // null while it can't be handed out (e.g. not logged in yet)
+  getDirectControl?(): DirectControl | null;
 }
 
 // Plugin storage format in plugins.json
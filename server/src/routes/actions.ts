@@ -1,7 +1,9 @@
 import { Router, Request, Response } from 'express';
-import { getDevice, upsertDevice, getGlobalScene } from '../db';
+import { getDevice, upsertDevice, getGlobalScene, Device, ButtonConfig } from '../db';
 import { pluginManager } from '../plugins/pluginManager';
-import { pushButtonStatesToDevice } from '../services/deviceService';
+import { pushButtonStatesToDevice, noteDeviceButtonState, compileSceneActions, CompiledSceneAction } from '../services/deviceService';
+import { onPanelMessage } from '../services/deviceSocketService';
+import { pushExternalDeviceState } from '../services/stateSyncService';
 
 const router = Router();
 
@@ -18,8 +20,8 @@ async function executeSceneById(
     const targetState = sceneId === '__builtin_all_on__';
     console.log(`[Action] Executing built-in "${targetState ? 'All On' : 'All Off'}" for device ${deviceId}`);
 
-    // Get all buttons with bindings on this device (excluding scene-type buttons)
-    const boundButtons = device.config.buttons.filter((b: any) => b.binding && b.type !== 'scene');
+    // Get all buttons with bindings on this device (excluding scene and sensor buttons)
+    const boundButtons = device.config.buttons.filter((b: any) => b.binding && b.type !== 'scene' && b.type !== 'sensor');
     console.log(`[Action] Found ${boundButtons.length} bound buttons to control`);
 
     for (const button of boundButtons) {
@@ -98,13 +100,81 @@ async function executeSceneById(
   return { success: results.every(r => r.success), results };
 }
 
-// Helper function to handle button action with optional plugin routing
+// Stage timestamps of one button action, for tap-to-light latency
+interface ActionTiming {
+  receivedAt: number;       // Request reached the route
+  dispatchedAt?: number;    // Plugin action started
+  resolvedAt?: number;      // Plugin (and its external API) answered
+  respondedAt?: number;     // Panel got its answer (HTTP only)
+  fannedOutAt?: number;     // Every panel bound to the device pushed
+}
+
+const MAX_ACTION_TIMINGS = 200;
+const actionTimings: ActionTiming[] = [];
+
+function recordActionTiming(timing: ActionTiming): void {
+  actionTimings.push(timing);
+  if (actionTimings.length > MAX_ACTION_TIMINGS) actionTimings.shift();
+}
+
+// Button/fan echo for a panel; speedLevel only for fan-type buttons
+function buttonUpdateFor(button: ButtonConfig): { id: number; state: boolean; speedLevel?: number } {
+  const update: { id: number; state: boolean; speedLevel?: number } = { id: button.id, state: button.state };
+  if (button.type === 'fan') {
+    update.speedLevel = button.speedLevel;
+  }
+  return update;
+}
+
+// After a plugin action answered (and the panel has its reply): record the
+// state, echo it to the pressing panel and fan it out to every other panel
+// bound to the same external device
+async function finishBoundAction(
+  device: Device,
+  button: ButtonConfig,
+  newState: boolean,
+  speedLevel: number | undefined,
+  timing: ActionTiming
+): Promise<void> {
+  const binding = button.binding!;
+  button.state = newState;
+  if (speedLevel !== undefined) {
+    button.speedLevel = speedLevel;
+  }
+  upsertDevice(device);
+
+  const pushes: Promise<unknown>[] = [
+    pushExternalDeviceState(binding.pluginId, binding.externalDeviceId, newState, speedLevel)
+  ];
+  if (device.ip && device.online) {
+    pushes.push(pushButtonStatesToDevice(device, [buttonUpdateFor(button)]));
+  }
+  const results = await Promise.allSettled(pushes);
+  for (const result of results) {
+    if (result.status === 'rejected') {
+      console.error(`[Action] Failed to push state for ${binding.externalDeviceId}:`, result.reason);
+    }
+  }
+
+  timing.fannedOutAt = Date.now();
+  recordActionTiming(timing);
+  const t0 = timing.receivedAt;
+  console.log(`[Action] ${device.name} button ${button.id} -> ${newState ? 'ON' : 'OFF'} via ${binding.pluginId}: ` +
+              `dispatch +${timing.dispatchedAt! - t0}ms, plugin +${timing.resolvedAt! - t0}ms, ` +
+              `${timing.respondedAt ? `reply +${timing.respondedAt - t0}ms, ` : ''}fan-out +${timing.fannedOutAt - t0}ms`);
+}
+
+// Helper function to handle button action with optional plugin routing.
+// The plugin action goes out first; DB updates, pushes and logging happen
+// once the caller has answered the panel (fills in timing as it goes)
 async function handleButtonAction(
   buttonId: number,
   deviceId: string,
   state: boolean,
   timestamp: number,
-  speedLevel?: number
+  speedLevel?: number,
+  timing: ActionTiming = { receivedAt: Date.now() },
+  direct = false
 ): Promise<{ success: boolean; state: boolean; error?: string }> {
   const device = getDevice(deviceId);
   if (!device) {
@@ -116,6 +186,50 @@ async function handleButtonAction(
     return { success: false, state, error: 'Button not found' };
   }
 
+  // If button has a plugin binding, route through plugin system; with
+  // direct control the panel has already done that, this is bookkeeping
+  if (button.binding && button.type !== 'scene') {
+    timing.dispatchedAt = Date.now();
+    const result = direct
+      ? { success: true, newState: state }
+      : await pluginManager.executeAction({
+          deviceId,
+          buttonId,
+          binding: button.binding,
+          newState: state,
+          speedLevel,
+          timestamp
+        });
+    timing.resolvedAt = Date.now();
+
+    // The panel already shows this state; keep the delta snapshot in step
+    noteDeviceButtonState(deviceId, buttonId, state, speedLevel);
+    // A webhook is proof of life; spares the panel its next health ping
+    device.lastSeen = Date.now();
+    device.online = true;
+
+    if (!result.success) {
+      console.error(`[Action] Plugin action failed: ${result.error}`);
+      return { success: false, state: button.state, error: result.error };
+    }
+
+    // Update local state based on plugin result, after the reply
+    const newState = result.newState !== undefined ? result.newState : state;
+    setImmediate(() => {
+      finishBoundAction(device, button, newState, speedLevel, timing).catch(err => {
+        console.error(`[Action] Failed to finish action on ${device.name}:`, err);
+      });
+    });
+    return { success: true, state: newState };
+  }
+
+  // The panel already shows this state; keep the delta snapshot in step
+  noteDeviceButtonState(deviceId, buttonId, state, speedLevel);
+
+  // A webhook is proof of life; spares the panel its next health ping
+  device.lastSeen = Date.now();
+  device.online = true;
+
   // Handle scene-type buttons
   if (button.type === 'scene') {
     if (!button.sceneId) {
@@ -129,120 +243,79 @@ async function handleButtonAction(
     return { success: result.success, state: false };
   }
 
-  // If button has a plugin binding, route through plugin system
-  if (button.binding) {
-    const result = await pluginManager.executeAction({
-      deviceId,
-      buttonId,
-      binding: button.binding,
-      newState: state,
-      speedLevel,
-      timestamp
-    });
-
-    if (result.success) {
-      // Update local state based on plugin result
-      button.state = result.newState !== undefined ? result.newState : state;
-      if (speedLevel !== undefined) {
-        button.speedLevel = speedLevel;
-      }
-      upsertDevice(device);
-
-      // Push updated state to the ESP32 panel
-      if (device.ip && device.online) {
-        const buttonUpdate: { id: number; state: boolean; speedLevel?: number } = {
-          id: buttonId,
-          state: button.state
-        };
-        // Only include speedLevel for fan-type buttons
-        if (button.type === 'fan') {
-          buttonUpdate.speedLevel = button.speedLevel;
-        }
-        pushButtonStatesToDevice(device, [buttonUpdate]).catch(err => {
-          console.error(`[Action] Failed to push state to device ${device.name}:`, err);
-        });
-      }
-
-      return { success: true, state: button.state };
-    } else {
-      console.error(`[Action] Plugin action failed: ${result.error}`);
-      return { success: false, state: button.state, error: result.error };
-    }
-  }
-
   // Legacy behavior for buttons without bindings
   button.state = state;
   if (speedLevel !== undefined) {
     button.speedLevel = speedLevel;
   }
-  upsertDevice(device);
+  setImmediate(() => {
+    upsertDevice(device);
 
-  // Push updated state to the ESP32 panel
-  if (device.ip && device.online) {
-    const buttonUpdate: { id: number; state: boolean; speedLevel?: number } = {
-      id: buttonId,
-      state: button.state
-    };
-    // Only include speedLevel for fan-type buttons
-    if (button.type === 'fan') {
-      buttonUpdate.speedLevel = button.speedLevel;
+    // Push updated state to the ESP32 panel
+    if (device.ip && device.online) {
+      pushButtonStatesToDevice(device, [buttonUpdateFor(button)]).catch(err => {
+        console.error(`[Action] Failed to push state to device ${device.name}:`, err);
+      });
     }
-    pushButtonStatesToDevice(device, [buttonUpdate]).catch(err => {
-      console.error(`[Action] Failed to push state to device ${device.name}:`, err);
-    });
-  }
+  });
 
   return { success: true, state };
 }
 
 // POST /api/action/light/:buttonId - Light button pressed (called by ESP32)
 router.post('/light/:buttonId', async (req: Request, res: Response) => {
+  const timing: ActionTiming = { receivedAt: Date.now() };
   const buttonId = parseInt(req.params.buttonId);
   const { deviceId, state, timestamp } = req.body;
 
-  console.log(`[Action] Light ${buttonId} on device ${deviceId} -> ${state ? 'ON' : 'OFF'}`);
-
-  const result = await handleButtonAction(buttonId, deviceId, state, timestamp);
+  const result = await handleButtonAction(buttonId, deviceId, state, timestamp, undefined, timing);
   res.json({ buttonId, ...result });
+  timing.respondedAt = Date.now();
+
+  console.log(`[Action] Light ${buttonId} on device ${deviceId} -> ${state ? 'ON' : 'OFF'}`);
 });
 
 // POST /api/action/switch/:buttonId - Switch button pressed (called by ESP32)
 router.post('/switch/:buttonId', async (req: Request, res: Response) => {
+  const timing: ActionTiming = { receivedAt: Date.now() };
   const buttonId = parseInt(req.params.buttonId);
   const { deviceId, state, timestamp } = req.body;
 
-  console.log(`[Action] Switch ${buttonId} on device ${deviceId} -> ${state ? 'ON' : 'OFF'}`);
-
-  const result = await handleButtonAction(buttonId, deviceId, state, timestamp);
+  const result = await handleButtonAction(buttonId, deviceId, state, timestamp, undefined, timing);
   res.json({ buttonId, ...result });
+  timing.respondedAt = Date.now();
+
+  console.log(`[Action] Switch ${buttonId} on device ${deviceId} -> ${state ? 'ON' : 'OFF'}`);
 });
 
 // POST /api/action/fan/:buttonId - Fan button pressed (called by ESP32)
 router.post('/fan/:buttonId', async (req: Request, res: Response) => {
+  const timing: ActionTiming = { receivedAt: Date.now() };
   const buttonId = parseInt(req.params.buttonId);
   const { deviceId, state, speedLevel, timestamp } = req.body;
 
-  console.log(`[Action] Fan ${buttonId} on device ${deviceId} -> ${state ? 'ON' : 'OFF'}, speed: ${speedLevel}`);
-
-  const result = await handleButtonAction(buttonId, deviceId, state, timestamp, speedLevel);
+  const result = await handleButtonAction(buttonId, deviceId, state, timestamp, speedLevel, timing);
   res.json({ buttonId, speedLevel, ...result });
-});
+  timing.respondedAt = Date.now();
 
-// POST /api/action/scene/:sceneId - Scene activated (called by ESP32 scene buttons)
-router.post('/scene/:sceneId', async (req: Request, res: Response) => {
-  const sceneId = parseInt(req.params.sceneId);
-  const { deviceId, timestamp } = req.body;
+  console.log(`[Action] Fan ${buttonId} on device ${deviceId} -> ${state ? 'ON' : 'OFF'}, speed: ${speedLevel}`);
+});
 
+// Helper function to handle a device scene activation
+async function handleSceneAction(
+  sceneId: number,
+  deviceId: string
+): Promise<{ status: number; body: any }> {
   console.log(`[Action] Scene ${sceneId} activated on device ${deviceId}`);
 
   const device = getDevice(deviceId);
   if (!device) {
-    return res.status(404).json({ success: false, error: 'Device not found' });
+    return { status: 404, body: { success: false, error: 'Device not found' } };
   }
 
   const deviceScene = device.config.scenes.find(s => s.id === sceneId);
   if (!deviceScene) {
-    return res.status(404).json({ success: false, error: 'Scene not found on device' });
+    return { status: 404, body: { success: false, error: 'Scene not found on device' } };
   }
 
   console.log(`[Action] Scene name: ${deviceScene.name}`);
@@ -250,17 +323,180 @@ router.post('/scene/:sceneId', async (req: Request, res: Response) => {
   // Check if this device scene references a global scene
   if (!deviceScene.globalSceneId) {
     console.log(`[Action] Scene "${deviceScene.name}" has no global scene reference, skipping execution`);
-    return res.json({ success: true, sceneId, message: 'No global scene linked' });
+    return { status: 200, body: { success: true, sceneId, message: 'No global scene linked' } };
   }
 
   // Use shared scene execution function
   const result = await executeSceneById(deviceScene.globalSceneId, device, deviceId);
 
+  return {
+    status: 200,
+    body: {
+      success: result.success,
+      sceneId,
+      sceneName: deviceScene.name,
+      results: result.results
+    }
+  };
+}
+
+// POST /api/action/scene/:sceneId - Scene activated (called by ESP32 scene buttons)
+router.post('/scene/:sceneId', async (req: Request, res: Response) => {
+  const sceneId = parseInt(req.params.sceneId);
+  const { deviceId } = req.body;
+
+  const result = await handleSceneAction(sceneId, deviceId);
+  res.status(result.status).json(result.body);
+});
+
+// Batched panel actions: N button/fan changes plus scene presses in one message
+interface ActionBatch {
+  seq?: number;
+  buttons?: Array<{ id: number; state: boolean; speedLevel?: number; direct?: boolean }>;
+  scenes?: number[];
+  timestamp?: number;
+  journal?: ActionJournal;
+}
+
+// Actions the panel made while it had no WiFi, replayed with the next batch
+// until one is delivered. Entry sequences grow within an epoch (a new one
+// after the panel loses power), so entries already applied are skipped.
+interface ActionJournal {
+  epoch: number;
+  buttons?: Array<{ id: number; state: boolean; speedLevel?: number; seq: number }>;
+  scenes?: Array<{ id: number; seq: number }>;
+}
+
+// Last batch sequence seen per device; a repeat is a transport retry
+const lastBatchSeq: Map<string, number> = new Map();
+
+// Newest journal entry applied per device
+const lastJournal: Map<string, { epoch: number; seq: number }> = new Map();
+
+// The journal's entries not applied yet, recording them as applied
+function takeJournal(deviceId: string, journal: ActionJournal | undefined) {
+  const fresh = { buttons: [] as NonNullable<ActionJournal['buttons']>, scenes: [] as number[] };
+  if (!journal || typeof journal.epoch !== 'number') {
+    return fresh;
+  }
+  const last = lastJournal.get(deviceId);
+  const applied = last && last.epoch === journal.epoch ? last.seq : 0;
+  let newest = applied;
+  for (const b of Array.isArray(journal.buttons) ? journal.buttons : []) {
+    if (b.seq > applied) fresh.buttons.push(b);
+    newest = Math.max(newest, b.seq);
+  }
+  for (const scene of Array.isArray(journal.scenes) ? journal.scenes : []) {
+    if (scene.seq > applied) fresh.scenes.push(scene.id);
+    newest = Math.max(newest, scene.seq);
+  }
+  lastJournal.set(deviceId, { epoch: journal.epoch, seq: newest });
+  return fresh;
+}
+
+async function handleActionBatch(deviceId: string, batch: ActionBatch): Promise<{ success: boolean; duplicate?: boolean; results: any[] }> {
+  if (batch.seq !== undefined) {
+    if (lastBatchSeq.get(deviceId) === batch.seq) {
+      console.log(`[Action] Ignoring duplicate batch ${batch.seq} from device ${deviceId}`);
+      return { success: true, duplicate: true, results: [] };
+    }
+    lastBatchSeq.set(deviceId, batch.seq);
+  }
+
+  const live = Array.isArray(batch.buttons) ? batch.buttons : [];
+  const journal = takeJournal(deviceId, batch.journal);
+  if (journal.buttons.length > 0 || journal.scenes.length > 0) {
+    console.log(`[Action] Replaying ${journal.buttons.length} buttons, ${journal.scenes.length} scenes from device ${deviceId}'s offline journal`);
+  }
+
+  // Offline actions are older: they go first, and a live change of the same button replaces its own
+  const liveIds = new Set(live.map(b => b.id));
+  const buttons: NonNullable<ActionBatch['buttons']> = [...journal.buttons.filter(b => !liveIds.has(b.id)), ...live];
+  const scenes = [...journal.scenes, ...(Array.isArray(batch.scenes) ? batch.scenes : [])];
+  const timestamp = batch.timestamp ?? Date.now();
+  console.log(`[Action] Batch ${batch.seq ?? '-'} from device ${deviceId}: ${buttons.length} buttons, ${scenes.length} scenes`);
+
+  const results: any[] = [];
+
+  // Scenes first so explicit button states in the same batch win.
+  // Sequential: each action updates the same device record.
+  const applied: Map<number, CompiledSceneAction> = new Map();
+  for (const sceneId of scenes) {
+    const result = await handleSceneAction(sceneId, deviceId);
+    results.push({ sceneId, ...result.body });
+
+    // The panel applied the scene's compiled actions and reports them with
+    // it; what the scene already did to the plugins is not sent again
+    const device = getDevice(deviceId);
+    const scene = device?.config.scenes.find(s => s.id === sceneId);
+    if (device && scene && result.body.success) {
+      for (const action of compileSceneActions(device, scene) ?? []) {
+        applied.set(action.buttonId, action);
+      }
+    }
+  }
+  for (const b of buttons) {
+    // direct: the panel already sent it to the plugin's device itself
+    const done = applied.get(b.id);
+    const covered = done !== undefined && done.state === b.state &&
+      (done.speedLevel === undefined || done.speedLevel === b.speedLevel);
+    const result = await handleButtonAction(b.id, deviceId, b.state, timestamp, b.speedLevel, undefined, b.direct === true || covered);
+    results.push({ buttonId: b.id, ...result });
+  }
+
+  return { success: results.every(r => r.success), results };
+}
+
+// POST /api/action/batch - Coalesced button/fan/scene actions (called by ESP32)
+router.post('/batch', async (req: Request, res: Response) => {
+  const { deviceId, ...batch } = req.body;
+  if (!deviceId) {
+    return res.status(400).json({ success: false, error: 'deviceId is required' });
+  }
+
+  const result = await handleActionBatch(deviceId, batch);
+  res.json({ seq: batch.seq, ...result });
+});
+
+// Actions arriving over the panel WebSocket take the same paths as the HTTP routes
+onPanelMessage((deviceId, message) => {
+  if (message.t === 'batch') {
+    handleActionBatch(deviceId, message).catch(err => {
+      console.error(`[Action] Socket batch failed for ${deviceId}:`, err);
+    });
+    return;
+  }
+
+  if (message.t === 'light') {
+    console.log(`[Action] Light ${message.id} on device ${deviceId} -> ${message.state ? 'ON' : 'OFF'} (socket)`);
+    handleButtonAction(message.id, deviceId, message.state, Date.now()).catch(err => {
+      console.error(`[Action] Socket light action failed for ${deviceId}:`, err);
+    });
+  } else if (message.t === 'scene') {
+    handleSceneAction(message.id, deviceId).catch(err => {
+      console.error(`[Action] Socket scene action failed for ${deviceId}:`, err);
+    });
+  }
+});
+
+// GET /api/action/timings - Stage latencies of recent plugin actions (ms
+// after the request arrived: p50/p95/max)
+router.get('/timings', (req: Request, res: Response) => {
+  const stage = (pick: (t: ActionTiming) => number | undefined) => {
+    const values = actionTimings.map(t => pick(t)).filter((v): v is number => v !== undefined).sort((a, b) => a - b);
+    if (values.length === 0) return null;
+    return {
+      p50: values[Math.floor(values.length * 0.5)],
+      p95: values[Math.min(values.length - 1, Math.floor(values.length * 0.95))],
+      max: values[values.length - 1]
+    };
+  };
   res.json({
-    success: result.success,
-    sceneId,
-    sceneName: deviceScene.name,
-    results: result.results
+    count: actionTimings.length,
+    dispatch: stage(t => t.dispatchedAt! - t.receivedAt),
+    plugin: stage(t => t.resolvedAt! - t.dispatchedAt!),
+    reply: stage(t => t.respondedAt && t.respondedAt - t.receivedAt),
+    fanOut: stage(t => t.fannedOutAt! - t.resolvedAt!)
   });
 });
 
@@ -1,23 +1,31 @@
 import { Router, Request, Response } from 'express';
 import { Jimp } from 'jimp';
+import { decodeQoi, QOI_CONTENT_TYPE } from '../utils/qoi';
 import {
   getAllDevices,
   getDevice,
   upsertDevice,
   deleteDevice as dbDeleteDevice,
+  addCrashReport,
+  getCrashReports,
+  CrashReport,
   Device,
   ButtonBinding
 } from '../db';
 import {
   pushConfigToDevice,
-  prepareConfigForDevice,
+  configPayloadForDevice,
+  noteConfigSchema,
   fetchDeviceState,
+  getReportingCaCert,
   updateDeviceConfig,
   captureDeviceScreenshot,
   getDeviceScreenshot,
   pushButtonStatesToDevice
 } from '../services/deviceService';
 import { syncDevice } from '../services/stateSyncService';
+import { getDeviceHeapHistory, getDeviceTaskHistory, sendToDevice, serverTime } from '../services/deviceSocketService';
+import { getFleetTelemetry, getDeviceTelemetry, forgetTelemetry } from '../services/telemetryService';
 
 const router = Router();
 
@@ -40,6 +48,12 @@ router.get('/', (req: Request, res: Response) => {
   })));
 });
 
+// GET /api/devices/telemetry - Fleet percentiles and per-panel alerts from recent heartbeats
+router.get('/telemetry', (req: Request, res: Response) => {
+  const names = new Map(getAllDevices().map(d => [d.id, d.name] as [string, string]));
+  res.json(getFleetTelemetry(names));
+});
+
 // GET /api/devices/:id - Get device details
 router.get('/:id', (req: Request, res: Response) => {
   const device = getDevice(req.params.id);
@@ -60,11 +74,16 @@ router.get('/:id/config', (req: Request, res: Response) => {
   device.lastSeen = Date.now();
   device.online = true;
 
+  // Firmware that reads the wire schema asks for it (?schema=2); the rest
+  // get buttons and scenes by field name
+  noteConfigSchema(device.id, req.query.schema === undefined ? undefined : Number(req.query.schema));
+
   // Return config converted for ESP32 (POSIX timezone, startHour/startMinute)
   // Include server time for immediate time sync (faster than waiting for NTP)
-  const config = prepareConfigForDevice(device);
-  config.serverTime = Math.floor(Date.now() / 1000);  // Unix timestamp in seconds
-  res.json(config);
+  const { body } = configPayloadForDevice(device, {
+    serverTime: serverTime()
+  });
+  res.type('application/json').send(body);
 });
 
 // PUT /api/devices/:id - Update device configuration
@@ -164,12 +183,91 @@ router.post('/:id/state', async (req: Request, res: Response) => {
 router.delete('/:id', (req: Request, res: Response) => {
   const success = dbDeleteDevice(req.params.id);
   if (success) {
+    forgetTelemetry(req.params.id);
     res.json({ success: true, message: 'Device removed' });
   } else {
     res.status(404).json({ error: 'Device not found' });
   }
 });
 
+// GET /api/devices/:id/diag/heap - Heap samples from the panel's heartbeats
+router.get('/:id/diag/heap', (req: Request, res: Response) => {
+  const device = getDevice(req.params.id);
+  if (!device) {
+    return res.status(404).json({ error: 'Device not found' });
+  }
+
+  res.json({ deviceId: device.id, samples: getDeviceHeapHistory(device.id) });
+});
+
+// GET /api/devices/:id/telemetry - Downsampled heartbeat history (?resolution=minute|quarter)
+router.get('/:id/telemetry', (req: Request, res: Response) => {
+  const device = getDevice(req.params.id);
+  if (!device) {
+    return res.status(404).json({ error: 'Device not found' });
+  }
+
+  const resolution = req.query.resolution === 'quarter' ? 'quarter' : 'minute';
+  res.json(getDeviceTelemetry(device.id, resolution));
+});
+
+// GET /api/devices/:id/diag/tasks - Task CPU/stack samples from the panel's heartbeats
+router.get('/:id/diag/tasks', (req: Request, res: Response) => {
+  const device = getDevice(req.params.id);
+  if (!device) {
+    return res.status(404).json({ error: 'Device not found' });
+  }
+
+  const samples = getDeviceTaskHistory(device.id);
+  res.json({ deviceId: device.id, latest: samples[samples.length - 1] ?? null, samples });
+});
+
+// POST /api/devices/:id/crash - Previous boot's crash, sent by the panel after its first config fetch
+router.post('/:id/crash', (req: Request, res: Response) => {
+  const device = getDevice(req.params.id);
+  if (!device) {
+    return res.status(404).json({ error: 'Device not found' });
+  }
+
+  const body = req.body ?? {};
+  if (typeof body.reset_reason !== 'string') {
+    return res.status(400).json({ error: 'reset_reason is required' });
+  }
+
+  const dump = body.dump;
+  const report: CrashReport = {
+    receivedAt: Date.now(),
+    resetReason: body.reset_reason,
+    firmware: typeof body.firmware === 'string' ? body.firmware : undefined,
+    uptimeS: typeof body.uptime_s === 'number' ? body.uptime_s : undefined,
+    heap: body.heap && typeof body.heap === 'object' ? body.heap : undefined,
+    dump: dump && typeof dump === 'object' ? {
+      task: String(dump.task ?? ''),
+      pc: String(dump.pc ?? ''),
+      cause: Number(dump.cause ?? 0),
+      vaddr: String(dump.vaddr ?? ''),
+      elfSha256: String(dump.elf_sha256 ?? ''),
+      backtrace: Array.isArray(dump.backtrace) ? dump.backtrace.map(String) : [],
+      btCorrupted: Boolean(dump.bt_corrupted),
+    } : dump === null ? null : undefined,
+  };
+  addCrashReport(device.id, report);
+
+  const where = report.dump ? ` in ${report.dump.task} at ${report.dump.pc}` : '';
+  console.warn(`Device ${device.id} reported a ${report.resetReason} reset${where}`);
+  res.json({ success: true });
+});
+
+// GET /api/devices/:id/crashes - Crash reports received from the panel
+router.get('/:id/crashes', (req: Request, res: Response) => {
+  const device = getDevice(req.params.id);
+  if (!device) {
+    return res.status(404).json({ error: 'Device not found' });
+  }
+
+  res.json({ deviceId: device.id, reports: getCrashReports(device.id) });
+});
+
 // POST /api/devices/:id/screenshot/capture - Capture screenshot on device
 router.post('/:id/screenshot/capture', async (req: Request, res: Response) => {
   const device = getDevice(req.params.id);
@@ -185,7 +283,7 @@ router.post('/:id/screenshot/capture', async (req: Request, res: Response) => {
   }
 });
 
-// GET /api/devices/:id/screenshot - Get screenshot from device (proxy, auto-converts BMP to PNG)
+// GET /api/devices/:id/screenshot - Get screenshot from device (proxy, auto-converts QOI/BMP to PNG)
 router.get('/:id/screenshot', async (req: Request, res: Response) => {
   const device = getDevice(req.params.id);
   if (!device) {
@@ -193,24 +291,30 @@ router.get('/:id/screenshot', async (req: Request, res: Response) => {
   }
 
   const screenshot = await getDeviceScreenshot(device);
-  if (screenshot) {
-    try {
-      // Convert BMP to PNG using Jimp
-      const image = await Jimp.read(screenshot);
-      const pngBuffer = await image.getBuffer('image/png');
-      res.set('Content-Type', 'image/png');
-      res.set('Content-Disposition', `inline; filename="${device.id}-screenshot.png"`);
-      res.set('Cache-Control', 'no-cache');
-      res.send(pngBuffer);
-    } catch (err) {
-      console.error(`Failed to convert screenshot to PNG:`, err);
-      // Fallback to BMP if conversion fails
-      res.set('Content-Type', 'image/bmp');
-      res.set('Content-Disposition', `inline; filename="${device.id}-screenshot.bmp"`);
-      res.send(screenshot);
+  if (!screenshot) {
+    return res.status(404).json({ error: 'No screenshot available or device offline' });
+  }
+
+  const isQoi = screenshot.contentType.startsWith(QOI_CONTENT_TYPE);
+  try {
+    // Convert to PNG using Jimp (QOI is decoded to RGBA first)
+    const image = isQoi
+      ? new Jimp(decodeQoi(screenshot.data))
+      : await Jimp.read(screenshot.data);
+    const pngBuffer = await image.getBuffer('image/png');
+    res.set('Content-Type', 'image/png');
+    res.set('Content-Disposition', `inline; filename="${device.id}-screenshot.png"`);
+    res.set('Cache-Control', 'no-cache');
+    res.send(pngBuffer);
+  } catch (err) {
+    console.error(`Failed to convert screenshot to PNG:`, err);
+    if (isQoi) {
+      return res.status(502).json({ error: 'Invalid screenshot from device' });
     }
-  } else {
-    res.status(404).json({ error: 'No screenshot available or device offline' });
+    // Fallback to BMP if conversion fails
+    res.set('Content-Type', 'image/bmp');
+    res.set('Content-Disposition', `inline; filename="${device.id}-screenshot.bmp"`);
+    res.send(screenshot.data);
   }
 });
 
@@ -299,6 +403,74 @@ router.post('/:id/theme', async (req: Request, res: Response) => {
   }
 });
 
+// POST /api/devices/:id/lcars/fields - Live LCARS frame text, e.g.
+// { "fields": { "footer_left": "47635.1", "header_right": "21.5 C" } }
+// Relabels just those fields over the device socket (no config push or
+// rebuild); "" restores a field's built-in text. Not stored: resend after
+// the panel reboots.
+const LCARS_FIELD_IDS = ['header_left', 'header_right', 'footer_left', 'footer_right', 'sidebar_top', 'sidebar_bottom'];
+const LCARS_FIELD_MAX = 31;
+
+router.post('/:id/lcars/fields', (req: Request, res: Response) => {
+  const device = getDevice(req.params.id);
+  if (!device) {
+    return res.status(404).json({ error: 'Device not found' });
+  }
+
+  const { fields } = req.body;
+  if (!fields || typeof fields !== 'object' || Array.isArray(fields)) {
+    return res.status(400).json({ error: 'fields must be an object of field id to text' });
+  }
+  for (const [id, value] of Object.entries(fields)) {
+    if (!LCARS_FIELD_IDS.includes(id)) {
+      return res.status(400).json({ error: `Field must be one of: ${LCARS_FIELD_IDS.join(', ')}` });
+    }
+    if (typeof value !== 'string' || Buffer.byteLength(value) > LCARS_FIELD_MAX) {
+      return res.status(400).json({ error: `${id} must be a string of at most ${LCARS_FIELD_MAX} bytes` });
+    }
+  }
+
+  if (!sendToDevice(device.id, { t: 'fields', fields })) {
+    return res.status(503).json({ error: 'Device socket not connected' });
+  }
+  res.json({ success: true });
+});
+
+// POST /api/devices/:id/sensors/samples - Samples for sensor buttons, by
+// button id: a number, or an array oldest first to backfill, e.g.
+// { "samples": { "5": 21.5, "6": [1180, 1240, 1310] } }
+// Sent over the device socket; the panel keeps the last SENSOR_HISTORY_SIZE
+// per sensor (in RAM, so resend a backfill after it reboots).
+const SENSOR_HISTORY_SIZE = 288;
+
+router.post('/:id/sensors/samples', (req: Request, res: Response) => {
+  const device = getDevice(req.params.id);
+  if (!device) {
+    return res.status(404).json({ error: 'Device not found' });
+  }
+
+  const { samples } = req.body;
+  if (!samples || typeof samples !== 'object' || Array.isArray(samples)) {
+    return res.status(400).json({ error: 'samples must be an object of button id to value(s)' });
+  }
+  for (const [id, value] of Object.entries(samples)) {
+    const button = device.config.buttons.find(b => String(b.id) === id);
+    if (!button || button.type !== 'sensor') {
+      return res.status(400).json({ error: `Button ${id} is not a sensor` });
+    }
+    const values = Array.isArray(value) ? value : [value];
+    if (values.length === 0 || values.length > SENSOR_HISTORY_SIZE ||
+        !values.every(v => typeof v === 'number' && Number.isFinite(v))) {
+      return res.status(400).json({ error: `${id} must be a number or up to ${SENSOR_HISTORY_SIZE} numbers` });
+    }
+  }
+
+  if (!sendToDevice(device.id, { t: 'samples', samples })) {
+    return res.status(503).json({ error: 'Device socket not connected' });
+  }
+  res.json({ success: true });
+});
+
 // POST /api/devices/:id/server - Push server reporting URL to device (requires user confirmation)
 // Uses REPORTING_URL env var if set, otherwise uses request body
 router.post('/:id/server', async (req: Request, res: Response) => {
@@ -321,11 +493,14 @@ router.post('/:id/server', async (req: Request, res: Response) => {
     return res.status(400).json({ error: 'reportingUrl must start with http:// or https://' });
   }
 
+  // CA for an https:// server: the body's, else REPORTING_CA_FILE's
+  const caCert = typeof req.body.caCert === 'string' ? req.body.caCert : getReportingCaCert();
+
   try {
     const response = await fetch(`http://${device.ip}/api/server`, {
       method: 'POST',
       headers: { 'Content-Type': 'application/json' },
-      body: JSON.stringify({ reportingUrl })
+      body: JSON.stringify(caCert !== undefined ? { reportingUrl, caCert } : { reportingUrl })
     });
 
     const data = await response.json();
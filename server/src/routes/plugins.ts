@@ -115,6 +115,15 @@ router.get('/timed-devices/jobs/active', (req: Request, res: Response) => {
   }
 });
 
+// GET /api/plugins/timed-devices/scheduler - Pending jobs and scheduling lag
+router.get('/timed-devices/scheduler', (req: Request, res: Response) => {
+  try {
+    res.json(timedDevicesPlugin.getSchedulerStats());
+  } catch (error: any) {
+    res.status(500).json({ error: error.message });
+  }
+});
+
 // DELETE /api/plugins/timed-devices/jobs/:jobId - Cancel a job
 router.delete('/timed-devices/jobs/:jobId', (req: Request, res: Response) => {
   try {
@@ -9,6 +9,7 @@ import {
   SceneAction
 } from '../db';
 import { pluginManager } from '../plugins/pluginManager';
+import { refreshSceneActions } from '../services/deviceService';
 
 const router = Router();
 
@@ -66,6 +67,7 @@ router.put('/:id', (req: Request, res: Response) => {
   };
 
   upsertGlobalScene(updated);
+  refreshSceneActions(updated.id);
   res.json(updated);
 });
 
@@ -73,6 +75,7 @@ router.put('/:id', (req: Request, res: Response) => {
 router.delete('/:id', (req: Request, res: Response) => {
   const success = deleteGlobalScene(req.params.id);
   if (success) {
+    refreshSceneActions(req.params.id);
     res.json({ success: true, message: 'Scene deleted' });
   } else {
     res.status(404).json({ error: 'Scene not found' });
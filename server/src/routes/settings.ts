@@ -1,8 +1,24 @@
 import { Router, Request, Response } from 'express';
-import { getGlobalSettings, updateGlobalSettings, GlobalSettings } from '../db';
+import { getGlobalSettings, updateGlobalSettings, GlobalSettings, getAllDevices } from '../db';
+import { notifyConfigChanged, pushConfigToDevices, refreshDirectControl } from '../services/deviceService';
 
 const router = Router();
 
+// Devices following the global schedules need their config again: those
+// with a socket are told to re-fetch it, the rest get it pushed, a few at a time
+function notifyGlobalScheduleDevices(): void {
+  const unreached = getAllDevices().filter(device => {
+    const display = device.config.display;
+    if (!display.useGlobalSchedule && !display.useGlobalThemeSchedule) return false;
+    return !notifyConfigChanged(device) && device.online;
+  });
+  if (unreached.length > 0) {
+    pushConfigToDevices(unreached).catch(error => {
+      console.error('[Settings] Error pushing config to devices:', error);
+    });
+  }
+}
+
 // GET /api/settings - Get global settings
 router.get('/', (req: Request, res: Response) => {
   try {
@@ -18,8 +34,19 @@ router.get('/', (req: Request, res: Response) => {
 router.put('/', (req: Request, res: Response) => {
   try {
     const updates = req.body as Partial<GlobalSettings>;
+    const switchedDirect = updates.directControl !== undefined &&
+      updates.directControl !== (getGlobalSettings().directControl === true);
+    const switchedMulticast = updates.stateMulticast !== undefined &&
+      updates.stateMulticast !== (getGlobalSettings().stateMulticast === true);
+    const switchedPeerMirror = updates.peerMirror !== undefined &&
+      updates.peerMirror !== (getGlobalSettings().peerMirror === true);
     const settings = updateGlobalSettings(updates);
     console.log('[Settings] Updated global settings');
+    notifyGlobalScheduleDevices();
+    // Each changes the config of every panel with bound buttons
+    if (switchedDirect || switchedMulticast || switchedPeerMirror) {
+      refreshDirectControl();
+    }
     res.json(settings);
   } catch (error) {
     console.error('Error updating global settings:', error);
@@ -44,6 +71,7 @@ router.put('/brightness-schedule', (req: Request, res: Response) => {
     const brightnessSchedule = req.body;
     const settings = updateGlobalSettings({ brightnessSchedule });
     console.log('[Settings] Updated global brightness schedule');
+    notifyGlobalScheduleDevices();
     res.json(settings.brightnessSchedule);
   } catch (error) {
     console.error('Error updating brightness schedule:', error);
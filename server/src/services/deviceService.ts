@@ -1,7 +1,11 @@
 // Using bun's built-in fetch
+import * as crypto from 'crypto';
+import { readFileSync } from 'fs';
 import {
   Device,
   DeviceConfig,
+  ButtonConfig,
+  SceneConfig,
   BrightnessScheduleConfig,
   ThemeScheduleConfig,
   DayNightConfig,
@@ -12,9 +16,130 @@ import {
   createDefaultConfig,
   getDiscoveredDevices,
   DiscoveredDevice,
-  getGlobalSettings
+  getGlobalSettings,
+  GlobalSettings,
+  getGlobalScene,
+  getGlobalScenesRevision
 } from '../db';
 import { ianaToPosix, parseTimeString } from '../utils/timezone';
+import { isDeviceSocketOpen, isDeviceMulticast, sendToDevice, onPanelMessage, serverTime } from './deviceSocketService';
+import { bindingId, multicastConfig, signingKey } from './multicastService';
+import { encodeMsgPack, decodeMsgPack, MSGPACK_CONTENT_TYPE } from '../utils/msgpack';
+import { pluginManager } from '../plugins/pluginManager';
+import { DirectControl } from '../plugins/types';
+
+// Panels that answered /api/ping with msgpack:true get MessagePack state
+// pushes over HTTP (set PANEL_MSGPACK=false to always send JSON)
+const MSGPACK_ENABLED = process.env.PANEL_MSGPACK !== 'false';
+const msgpackDevices: Set<string> = new Set();
+
+// Config wire schema each panel reported reading, from /api/ping's
+// configSchema or the ?schema= of its own config fetch. Panels that don't
+// report one predate the wire schema and are sent the long-key form.
+const configSchemas: Map<string, number> = new Map();
+
+export function noteConfigSchema(deviceId: string, schema: unknown): void {
+  if (typeof schema === 'number' && Number.isInteger(schema) && schema >= 2) {
+    configSchemas.set(deviceId, schema);
+  } else {
+    configSchemas.delete(deviceId);
+  }
+}
+
+// Versioned delta state sync
+// Each panel has a monotonic state version. A push sends only the buttons
+// that differ from what we last sent, tagged {version, base}; the panel skips
+// anything that already matches and asks for a full push (resync) when the
+// base isn't the version it holds. A full push is also forced periodically
+// in case the panel drifted without telling us.
+const FULL_RESYNC_INTERVAL = 10 * 60 * 1000;  // 10 minutes
+
+type ButtonUpdate = { id: number; state: boolean; speedLevel?: number };
+
+interface StateSyncTrack {
+  version: number;
+  synced: boolean;              // false until a full push has been accepted
+  sent: Map<number, string>;    // buttonId -> state key the panel holds
+  lastFull: number;
+}
+const stateTracks: Map<string, StateSyncTrack> = new Map();
+
+// Last /api/state body per device with its ETag, for conditional GETs
+const stateCache: Map<string, { etag: string; state: any }> = new Map();
+
+function buttonKey(update: ButtonUpdate): string {
+  return `${update.state ? 1 : 0}:${update.speedLevel ?? ''}`;
+}
+
+// Forget what the panel holds; the next push will be a full one
+export function resetStateSync(deviceId: string): void {
+  const track = stateTracks.get(deviceId);
+  if (track) track.synced = false;
+}
+
+// What each panel last advertised in its mDNS TXT record. The panel
+// rewrites the record when its config generation or state version moves,
+// and draws a new boot id on every restart, so a fresh advert is proof of
+// life and a changed boot id means it lost the state we pushed.
+export interface DeviceAdvert {
+  fw?: string;
+  boot?: string;
+  cfg?: number;
+  state?: number;
+  at: number;
+}
+const adverts: Map<string, DeviceAdvert> = new Map();
+const ADVERT_FRESH_MS = 30 * 1000;
+
+// Health checks. A panel we heard from within the last check interval (a
+// push it accepted, a button webhook, a config fetch) is not pinged at all;
+// one that stopped answering is retried with exponential backoff, capped.
+const PING_TIMEOUT = 5000;
+const HEALTH_BACKOFF_MAX = 15 * 60 * 1000;  // 15 minutes
+const healthBackoff: Map<string, { failures: number; nextCheck: number }> = new Map();
+
+export function noteDeviceAdvert(device: Device, advert: DeviceAdvert): void {
+  const prev = adverts.get(device.id);
+  adverts.set(device.id, advert);
+
+  if (prev?.boot && advert.boot && prev.boot !== advert.boot) {
+    console.log(`[DeviceService] ${device.name} restarted (fw ${advert.fw ?? 'unknown'}), next push is full`);
+    resetStateSync(device.id);
+  } else if (advert.state === 0 && stateTracks.get(device.id)?.synced) {
+    console.log(`[DeviceService] ${device.name} advertises no state, next push is full`);
+    resetStateSync(device.id);
+  }
+}
+
+export function getDeviceAdvert(deviceId: string): DeviceAdvert | undefined {
+  return adverts.get(deviceId);
+}
+
+// Record a state the panel reported itself (e.g. the user toggled a button)
+export function noteDeviceButtonState(deviceId: string, buttonId: number, state: boolean, speedLevel?: number): void {
+  stateTracks.get(deviceId)?.sent.set(buttonId, buttonKey({ id: buttonId, state, speedLevel }));
+}
+
+// A panel hearing state multicast (see multicastService) that already holds
+// a full push takes the changes just multicast as sent. False leaves them to
+// a push as usual: the panel doesn't hear the group, or a push is queued
+// that could land after the multicast and undo it.
+export function noteMulticastStates(device: Device, updates: ButtonUpdate[]): boolean {
+  const track = stateTracks.get(device.id);
+  const queue = pushQueues.get(device.id);
+  if (!track?.synced || !isDeviceMulticast(device.id) || queue?.current || queue?.next) return false;
+  for (const update of updates) {
+    track.sent.set(update.id, buttonKey(update));
+  }
+  return true;
+}
+
+// Panels reconnecting (possibly after a reboot) or rejecting a delta get a full push next
+onPanelMessage((deviceId, message) => {
+  if (message.t === 'hello' || message.t === 'resync') {
+    resetStateSync(deviceId);
+  }
+});
 
 // Convert brightness schedule for ESP32 format
 // - Convert IANA timezone to POSIX
@@ -58,11 +183,152 @@ function convertThemeScheduleForDevice(
   };
 }
 
-// Prepare device config for ESP32 consumption
+// One button change a scene makes on a panel
+export interface CompiledSceneAction {
+  buttonId: number;
+  state: boolean;
+  speedLevel?: number;  // Fans only
+}
+
+// What a device scene does to this device's own buttons, for the panel to
+// apply itself when the scene is pressed (the server still runs the scene
+// on the plugins). Built-ins cover every button but scene buttons; a global
+// scene covers the buttons bound to one of its targets. undefined when the
+// scene references nothing, leaving the panel to go by the scene's name.
+export function compileSceneActions(device: Device, scene: SceneConfig): CompiledSceneAction[] | undefined {
+  const sceneId = scene.globalSceneId;
+  if (!sceneId) return undefined;
+
+  if (sceneId === '__builtin_all_on__' || sceneId === '__builtin_all_off__') {
+    const state = sceneId === '__builtin_all_on__';
+    return device.config.buttons
+      .filter(button => button.type !== 'scene' && button.type !== 'sensor')
+      .map(button => button.type === 'fan'
+        ? { buttonId: button.id, state, speedLevel: state ? 1 : 0 }
+        : { buttonId: button.id, state });
+  }
+
+  const globalScene = getGlobalScene(sceneId);
+  if (!globalScene) return [];
+  const actions: CompiledSceneAction[] = [];
+  for (const action of globalScene.actions) {
+    for (const button of device.config.buttons) {
+      if (!button.binding || button.type === 'scene' || button.type === 'sensor') continue;
+      if (button.binding.pluginId !== action.pluginId || button.binding.externalDeviceId !== action.externalDeviceId) continue;
+      actions.push(button.type === 'fan'
+        ? { buttonId: button.id, state: action.targetState, speedLevel: action.targetState ? (action.targetSpeedLevel ?? 1) : 0 }
+        : { buttonId: button.id, state: action.targetState });
+    }
+  }
+  return actions;
+}
+
+// Device-facing config (wire schema)
+// Panels are sent a trimmed config, not the stored one: no plugin bindings
+// (a bound button only needs its binding id), no dashboard-only flags or
+// global scene references, custom themes and LCARS texts only when the
+// panel can show them, and no more buttons or scenes than it holds. Buttons
+// and scenes, the records that repeat, use the short keys of
+// CONFIG_WIRE_SCHEMA (firmware config_manager.h), which the panel validates
+// strictly. Everything else keeps the names the panel's own /api/config uses.
+// Panels that don't report the schema (see configSchemas) get buttons and
+// scenes by field name instead, which every firmware reads.
+const CONFIG_WIRE_SCHEMA = 2;
+const PANEL_MAX_BUTTONS = 36;
+const PANEL_MAX_SCENES = 2;
+
+// Button and scene field -> wire key
+const BUTTON_WIRE_KEYS: Record<string, string> = {
+  id: 'i', type: 't', name: 'n', icon: 'ic', state: 's', subtitle: 'sub',
+  speedSteps: 'ss', speedLevel: 'sl', sceneId: 'sc', direct: 'd', bid: 'b'
+};
+const SCENE_WIRE_KEYS: Record<string, string> = { id: 'i', name: 'n', icon: 'ic', actions: 'a' };
+
+// Display fields the panel reads
+const DISPLAY_WIRE_FIELDS = ['brightness', 'theme', 'layout', 'cardTiles', 'adaptiveBrightness'];
+
+// The buttons a panel is sent (it drops any past its limit anyway)
+function panelButtons(device: Device): ButtonConfig[] {
+  return device.config.buttons.slice(0, PANEL_MAX_BUTTONS);
+}
+
+function wireButton(button: ButtonConfig, bid: number, route?: { target: number; path: string }): Record<string, unknown> {
+  const wire: Record<string, unknown> = { i: button.id, t: button.type, n: button.name, ic: button.icon };
+  if (button.state) wire.s = true;
+  if (button.subtitle) wire.sub = button.subtitle;
+  if (button.type === 'fan') {
+    wire.ss = button.speedSteps ?? 0;
+    if (button.speedLevel) wire.sl = button.speedLevel;
+  }
+  if (button.type === 'scene' && button.sceneId) wire.sc = button.sceneId;
+  if (route) wire.d = route;
+  if (bid) wire.b = bid;
+  return wire;
+}
+
+// Actions go as [buttonId, on, speedLevel?]; undefined leaves the panel to
+// go by the scene's name
+function wireScene(scene: SceneConfig, actions: CompiledSceneAction[] | undefined): Record<string, unknown> {
+  const wire: Record<string, unknown> = { i: scene.id, n: scene.name, ic: scene.icon };
+  if (actions) {
+    wire.a = actions.map(action => action.speedLevel === undefined
+      ? [action.buttonId, action.state ? 1 : 0]
+      : [action.buttonId, action.state ? 1 : 0, action.speedLevel]);
+  }
+  return wire;
+}
+
+// Display settings the panel reads. Custom themes and the LCARS texts go
+// only when one of the themes it can switch to (fixed or day/night) needs
+// them.
+function wireDisplay(display: any, brightnessSchedule: any, dayNightMode: DayNightConfig | undefined): any {
+  const reachable = new Set<string>([display.theme]);
+  if (dayNightMode?.enabled) {
+    reachable.add(dayNightMode.dayTheme);
+    reachable.add(dayNightMode.nightTheme);
+  }
+  const themes = (display.themes ?? []).filter((theme: any) => reachable.has(theme.name));
+  for (const theme of themes) reachable.add(theme.base);
+
+  const wire: any = {};
+  for (const field of DISPLAY_WIRE_FIELDS) {
+    if (display[field] !== undefined) wire[field] = display[field];
+  }
+  if (dayNightMode) wire.dayNightMode = dayNightMode;
+  if (brightnessSchedule) wire.brightnessSchedule = brightnessSchedule;
+  if (reachable.has('lcars') && display.lcars) wire.lcars = display.lcars;
+  if (themes.length > 0) wire.themes = themes;
+  return wire;
+}
+
+// The schema a panel is sent: the newest both sides read
+function panelConfigSchema(device: Device): number {
+  return Math.min(configSchemas.get(device.id) ?? 1, CONFIG_WIRE_SCHEMA);
+}
+
+// Back to field names, for a PATCH (which takes those) and for panels
+// without the wire schema; scene action tuples become objects again
+function fromWire(record: any, keys: Record<string, string>): any {
+  const fields: any = {};
+  for (const [field, key] of Object.entries(keys)) {
+    if (record?.[key] !== undefined) fields[field] = record[key];
+  }
+  if (Array.isArray(fields.actions)) {
+    fields.actions = fields.actions.map(([buttonId, on, speedLevel]: number[]): CompiledSceneAction =>
+      speedLevel === undefined ? { buttonId, state: on === 1 } : { buttonId, state: on === 1, speedLevel });
+  }
+  return fields;
+}
+
+// Prepare device config for ESP32 consumption, without its buttons (whose
+// live states go in at send time, see configPayloadForDevice)
 // - Applies global schedule if useGlobalSchedule is true
 // - Applies global theme schedule if useGlobalThemeSchedule is true
 // - Converts schedule format (IANA→POSIX timezone, startTime→startHour/startMinute)
-export function prepareConfigForDevice(device: Device): any {
+// - Compiles each scene's button changes (see compileSceneActions)
+// - Trims it to the wire schema (see CONFIG_WIRE_SCHEMA above), with short
+//   keys only if the panel reads them
+export function prepareConfigForDevice(device: Device, schema: number = panelConfigSchema(device)): any {
   const globalSettings = getGlobalSettings();
 
   // Determine which brightness schedule to use (global or device-specific)
@@ -81,23 +347,363 @@ export function prepareConfigForDevice(device: Device): any {
 
   // Prepare config for device, converting schedule formats
   // Force dayNightMode.enabled=true when device uses "Auto Light/Dark" theme
+  const display = wireDisplay(
+    device.config.display,
+    convertScheduleForDevice(effectiveSchedule),
+    convertThemeScheduleForDevice(effectiveThemeSchedule, useGlobalTheme)
+  );
+
+  // Scene actions only for buttons the panel is sent
+  const sent = new Set(panelButtons(device)
+    .filter(button => button.type !== 'scene' && button.type !== 'sensor')
+    .map(button => button.id));
+  const scenes = device.config.scenes.slice(0, PANEL_MAX_SCENES).map(scene => {
+    const actions = compileSceneActions(device, scene)?.filter(action => sent.has(action.buttonId));
+    const wire = wireScene(scene, actions);
+    return schema >= 2 ? wire : fromWire(wire, SCENE_WIRE_KEYS);
+  });
+
+  const { id, name, location } = device.config.device;
+  const network = (device.config as any).network;
   return {
-    ...device.config,
-    display: {
-      ...device.config.display,
-      brightnessSchedule: convertScheduleForDevice(effectiveSchedule),
-      dayNightMode: convertThemeScheduleForDevice(effectiveThemeSchedule, useGlobalTheme)
-    }
+    ...(schema >= 2 ? { schema } : {}),
+    version: device.config.version,
+    device: { id, name, location },
+    display,
+    scenes,
+    server: device.config.server,
+    ...(network ? { network } : {})
   };
 }
 
+// Prepared /api/config payloads per device. Preparing one merges the
+// global schedules and converts timezones, and only changes when the
+// device's config, the global settings or the global scenes do; the first
+// two are replaced rather than mutated when they change, so identity is the
+// cache key, and the scenes have a revision. Kept as JSON
+// without the buttons, whose live states go in at send time, plus a hash
+// of what the panel stores (button states left out).
+interface ConfigPayload {
+  config: DeviceConfig;
+  settings: GlobalSettings;
+  scenesRevision: number;
+  schema: number;
+  base: string;
+  hash: string;
+}
+const configPayloads: Map<string, ConfigPayload> = new Map();
+
+// Hash of the payload each panel last accepted from a push, and the payload
+// itself (parsed), to send a later single-record edit as a patch
+const pushedConfigHashes: Map<string, string> = new Map();
+const pushedConfigBodies: Map<string, any> = new Map();
+
+const CONFIG_CHECK_TIMEOUT = 5000;
+const CONFIG_JOB_TIMEOUT = 15000;        // A panel parses and applies in well under a second
+const CONFIG_JOB_POLL_INTERVAL = 250;
+const CONFIG_PUSH_CONCURRENCY = 4;
+
+// Direct control targets a panel keeps (one per plugin)
+const MAX_DIRECT_TARGETS = 2;
+
+// 32 bits, as the panel keeps it; never 0, which it reads as "none"
+function configHash(...parts: string[]): string {
+  const sha = crypto.createHash('sha1');
+  for (const part of parts) sha.update(part);
+  const hash = sha.digest('hex').slice(0, 8);
+  return hash === '00000000' ? '00000001' : hash;
+}
+
+function preparedConfig(device: Device): ConfigPayload {
+  const settings = getGlobalSettings();
+  const scenesRevision = getGlobalScenesRevision();
+  const schema = panelConfigSchema(device);
+  const cached = configPayloads.get(device.id);
+  if (cached && cached.config === device.config && cached.settings === settings &&
+      cached.scenesRevision === scenesRevision && cached.schema === schema) {
+    return cached;
+  }
+
+  const base = JSON.stringify(prepareConfigForDevice(device, schema));
+  // A rebinding changes what the panel stores: the button's binding id
+  const definitions = JSON.stringify(panelButtons(device).map(button => {
+    const { s, sl, ...definition } = wireButton(button, buttonBindingId(button));
+    return definition;
+  }));
+  const payload = { config: device.config, settings, scenesRevision, schema, base, hash: configHash(base, definitions) };
+  configPayloads.set(device.id, payload);
+  return payload;
+}
+
+// With directControl on, each bound button whose plugin allows it is told
+// where to send its actions itself: "direct" lists the targets, and the
+// button's "direct" names one and the device path under it. Built per send,
+// since targets carry credentials that change (e.g. token renewals).
+function directControlFor(device: Device): { targets: DirectControl[]; buttons: Map<number, { target: number; path: string }> } | null {
+  if (!getGlobalSettings().directControl) return null;
+
+  const targets: DirectControl[] = [];
+  const targetIndex = new Map<string, number>();
+  const buttons = new Map<number, { target: number; path: string }>();
+  for (const button of device.config.buttons) {
+    if (!button.binding || button.type === 'scene' || button.type === 'sensor') continue;
+    const { pluginId, externalDeviceId } = button.binding;
+
+    let target = targetIndex.get(pluginId);
+    if (target === undefined) {
+      const control = targets.length < MAX_DIRECT_TARGETS ? pluginManager.getDirectControl(pluginId) : null;
+      target = control ? targets.push(control) - 1 : -1;
+      targetIndex.set(pluginId, target);
+    }
+    if (target >= 0) {
+      buttons.set(button.id, { target, path: encodeURIComponent(externalDeviceId) });
+    }
+  }
+  return buttons.size > 0 ? { targets, buttons } : null;
+}
+
+// Binding id of a button the panel keeps state multicast for (0: none)
+function buttonBindingId(button: ButtonConfig): number {
+  return button.binding && button.type !== 'scene' && button.type !== 'sensor'
+    ? bindingId(button.binding.pluginId, button.binding.externalDeviceId)
+    : 0;
+}
+
+// /api/config body for a device: its prepared config with the current
+// button states, the config hash, and any extra top-level fields
+export function configPayloadForDevice(device: Device, extra: Record<string, unknown> = {}): { body: string; hash: string } {
+  const payload = preparedConfig(device);
+  const direct = directControlFor(device);
+  const buttons = panelButtons(device).map(button => {
+    const wire = wireButton(button, buttonBindingId(button), direct?.buttons.get(button.id));
+    return payload.schema >= 2 ? wire : fromWire(wire, BUTTON_WIRE_KEYS);
+  });
+  // Only panels with bound buttons have anything to hear or mirror
+  const bound = device.config.buttons.some(button => buttonBindingId(button) !== 0);
+  const multicast = bound ? multicastConfig() : null;
+  const peerMirror = bound && getGlobalSettings().peerMirror ? { key: signingKey('peerMirrorKey') } : null;
+
+  let body = payload.base.slice(0, -1);
+  let hash = payload.hash;
+  if (direct) {
+    const targets = JSON.stringify(direct.targets);
+    hash = configHash(hash, targets, JSON.stringify([...direct.buttons]));
+    body += `,"direct":${targets}`;
+  }
+  if (multicast) {
+    const json = JSON.stringify(multicast);
+    hash = configHash(hash, json);
+    body += `,"multicast":${json}`;
+  }
+  if (peerMirror) {
+    const json = JSON.stringify(peerMirror);
+    hash = configHash(hash, json);
+    body += `,"peerMirror":${json}`;
+  }
+  body += `,"buttons":${JSON.stringify(buttons)}`;
+  body += `,"configHash":"${hash}"`;
+  for (const [key, value] of Object.entries(extra)) {
+    body += `,${JSON.stringify(key)}:${JSON.stringify(value)}`;
+  }
+  return { body: body + '}', hash };
+}
+
+// A plugin's direct control target changed (or directControl was switched):
+// panels with buttons bound to it need their config again
+export function refreshDirectControl(pluginId?: string): void {
+  if (pluginId && !getGlobalSettings().directControl) return;
+  const devices = getAllDevices().filter(device =>
+    device.online && device.config.buttons.some(b => b.binding && (!pluginId || b.binding.pluginId === pluginId)));
+
+  const unreached = devices.filter(device => !notifyConfigChanged(device));
+  if (unreached.length > 0) {
+    pushConfigToDevices(unreached).catch(error => {
+      console.error('[DeviceService] Error pushing direct control config:', error);
+    });
+  }
+}
+
+// A global scene changed (or was deleted): panels with a scene referencing
+// it need its compiled actions again
+export function refreshSceneActions(globalSceneId: string): void {
+  const devices = getAllDevices().filter(device =>
+    device.online && device.config.scenes.some(scene => scene.globalSceneId === globalSceneId));
+
+  const unreached = devices.filter(device => !notifyConfigChanged(device));
+  if (unreached.length > 0) {
+    pushConfigToDevices(unreached).catch(error => {
+      console.error('[DeviceService] Error pushing scene config:', error);
+    });
+  }
+}
+
+// Whether the panel still holds the config we last pushed it with this
+// hash: it answers 304 to If-None-Match "h<hash>" until its config changes
+// any other way (or it restarts)
+async function deviceHoldsConfig(device: Device, hash: string): Promise<boolean> {
+  if (pushedConfigHashes.get(device.id) !== hash) return false;
+  try {
+    const response = await fetch(`http://${device.ip}/api/config`, {
+      headers: { 'If-None-Match': `"h${hash}"` },
+      signal: AbortSignal.timeout(CONFIG_CHECK_TIMEOUT)
+    });
+    if (response.status !== 304) {
+      await response.body?.cancel();
+      return false;
+    }
+    return true;
+  } catch (error) {
+    return false;
+  }
+}
+
+// Panels parse a pushed config on a worker and answer 202 with a job id;
+// wait for its outcome. True for older firmware that answers 200 directly.
+async function awaitConfigJob(device: Device, response: Response): Promise<boolean> {
+  if (response.status !== 202) return true;
+  const accepted = await response.json().catch(() => ({})) as { job?: number };
+  if (!accepted.job) return true;
+
+  const deadline = Date.now() + CONFIG_JOB_TIMEOUT;
+  while (Date.now() < deadline) {
+    await new Promise(resolve => setTimeout(resolve, CONFIG_JOB_POLL_INTERVAL));
+    try {
+      const status = await fetch(`http://${device.ip}/api/config/job?id=${accepted.job}`, {
+        signal: AbortSignal.timeout(CONFIG_CHECK_TIMEOUT)
+      });
+      if (!status.ok) return false;
+      const job = await status.json() as { state: string; error?: string };
+      if (job.state === 'done') return true;
+      if (job.state === 'failed') {
+        console.error(`Config rejected by ${device.name}: ${job.error ?? 'unknown error'}`);
+        return false;
+      }
+      if (job.state === 'superseded') return false;  // A newer push took its place
+    } catch {
+      // Keep polling until the deadline
+    }
+  }
+  console.error(`Timed out waiting for ${device.name} to apply config`);
+  return false;
+}
+
+// Fields a panel can change in place (PATCH /api/config/...); anything else
+// (button type, schedules, layout of the button list) needs a full push
+const BUTTON_PATCH_FIELDS = ['name', 'icon', 'subtitle', 'speedSteps', 'sceneId', 'bid', 'direct'];
+const SCENE_PATCH_FIELDS = ['name', 'icon', 'actions'];
+const DISPLAY_PATCH_FIELDS = ['brightness', 'theme', 'layout', 'cardTiles', 'dayNightMode'];
+
+// Changed fields of one record, or null if a field outside allowed changed
+function changedFields(before: any, after: any, allowed: string[], ignore: string[] = []): Record<string, unknown> | null {
+  const fields: Record<string, unknown> = {};
+  const keys = new Set([...Object.keys(before ?? {}), ...Object.keys(after ?? {})]);
+  for (const key of keys) {
+    if (ignore.includes(key)) continue;
+    if (JSON.stringify(before?.[key]) === JSON.stringify(after?.[key])) continue;
+    if (!allowed.includes(key)) return null;
+    if (after?.[key] === undefined) {
+      // Removed (the wire form leaves out empty values): only these have one
+      if (key === 'direct') fields[key] = {};
+      else if (key === 'bid') fields[key] = 0;
+      else if (key === 'subtitle' || key === 'sceneId') fields[key] = '';
+      else return null;
+    } else {
+      fields[key] = after[key];
+    }
+  }
+  return fields;
+}
+
+// The patch turning the config a panel holds into the new one, when the
+// edit touched a single button, a single scene or the display settings
+function configPatchFor(before: any, after: any): { path: string; fields: Record<string, unknown> } | null {
+  const keys = new Set([...Object.keys(before), ...Object.keys(after)]);
+  keys.delete('configHash');
+  const changed = [...keys].filter(key => JSON.stringify(before[key]) !== JSON.stringify(after[key]));
+  if (changed.length !== 1) return null;
+  const [key] = changed;
+
+  if (key === 'display') {
+    const fields = changedFields(before.display, after.display, DISPLAY_PATCH_FIELDS);
+    return fields ? { path: 'display', fields } : null;
+  }
+  if (key !== 'buttons' && key !== 'scenes') return null;
+
+  // Only the wire form needs mapping; a schema change alone is a full push
+  const names = key === 'buttons' ? BUTTON_WIRE_KEYS : SCENE_WIRE_KEYS;
+  const byName = (record: any) => (after.schema ?? 1) >= 2 ? fromWire(record, names) : record;
+  const was: any[] = (before[key] ?? []).map(byName);
+  const now: any[] = (after[key] ?? []).map(byName);
+  if (was.length !== now.length) return null;
+  const idOf = (record: any, index: number) => record.id ?? index + 1;
+  let patch: { path: string; fields: Record<string, unknown> } | null = null;
+  for (let i = 0; i < now.length; i++) {
+    if (idOf(was[i], i) !== idOf(now[i], i)) return null;
+    if (JSON.stringify(was[i]) === JSON.stringify(now[i])) continue;
+    // Button states and speeds are live values, not config
+    const fields = key === 'buttons'
+      ? changedFields(was[i], now[i], BUTTON_PATCH_FIELDS, ['state', 'speedLevel'])
+      : changedFields(was[i], now[i], SCENE_PATCH_FIELDS);
+    if (!fields || patch) return null;
+    if (Object.keys(fields).length === 0) continue;
+    patch = { path: `${key}/${idOf(now[i], i)}`, fields };
+  }
+  return patch;
+}
+
+// Send a single-record edit as a patch instead of the whole config; true if
+// the panel took it (and now holds hash)
+async function patchConfigOnDevice(device: Device, body: any, hash: string): Promise<boolean> {
+  const previous = pushedConfigBodies.get(device.id);
+  const previousHash = pushedConfigHashes.get(device.id);
+  if (!previous || !previousHash) return false;
+  const patch = configPatchFor(previous, body);
+  if (!patch) return false;
+  if (!await deviceHoldsConfig(device, previousHash)) return false;
+
+  try {
+    const response = await fetch(`http://${device.ip}/api/config/${patch.path}`, {
+      method: 'PATCH',
+      headers: { 'Content-Type': 'application/json' },
+      body: JSON.stringify({ ...patch.fields, configHash: hash }),
+      signal: AbortSignal.timeout(CONFIG_CHECK_TIMEOUT)
+    });
+    if (!response.ok) {
+      // Older firmware (404/405) or a field it refused: fall back to a push
+      await response.body?.cancel();
+      return false;
+    }
+    return true;
+  } catch {
+    return false;
+  }
+}
+
 // Push configuration to a device
 export async function pushConfigToDevice(device: Device): Promise<boolean> {
   try {
     const url = `http://${device.ip}/api/config`;
-    console.log(`Pushing config to ${device.name} at ${url}`);
+    const { body, hash } = configPayloadForDevice(device);
+
+    if (await deviceHoldsConfig(device, hash)) {
+      console.log(`Config on ${device.name} is already current, skipping push`);
+      device.lastSeen = Date.now();
+      device.online = true;
+      return true;
+    }
+
+    const parsed = JSON.parse(body);
+    if (await patchConfigOnDevice(device, parsed, hash)) {
+      console.log(`Config patched on ${device.name}`);
+      pushedConfigHashes.set(device.id, hash);
+      pushedConfigBodies.set(device.id, parsed);
+      device.lastSeen = Date.now();
+      device.online = true;
+      upsertDevice(device);
+      return true;
+    }
 
-    const configForDevice = prepareConfigForDevice(device);
+    console.log(`Pushing config to ${device.name} at ${url}`);
     if (device.config.display.useGlobalSchedule) {
       console.log(`[DeviceService] Using global brightness schedule for ${device.name}`);
     }
@@ -105,38 +711,83 @@ export async function pushConfigToDevice(device: Device): Promise<boolean> {
     const response = await fetch(url, {
       method: 'POST',
       headers: { 'Content-Type': 'application/json' },
-      body: JSON.stringify(configForDevice)
+      body
     });
 
-    if (response.ok) {
+    if (response.ok && await awaitConfigJob(device, response)) {
       console.log(`Config pushed successfully to ${device.name}`);
+      pushedConfigHashes.set(device.id, hash);
+      pushedConfigBodies.set(device.id, parsed);
       device.lastSeen = Date.now();
       device.online = true;
       upsertDevice(device);
       return true;
     } else {
-      console.error(`Failed to push config to ${device.name}: ${response.status}`);
+      if (!response.ok) {
+        console.error(`Failed to push config to ${device.name}: ${response.status}`);
+      }
+      pushedConfigHashes.delete(device.id);
+      pushedConfigBodies.delete(device.id);
       return false;
     }
   } catch (error) {
     console.error(`Error pushing config to ${device.name}:`, error);
+    pushedConfigHashes.delete(device.id);
+    pushedConfigBodies.delete(device.id);
     device.online = false;
     upsertDevice(device);
     return false;
   }
 }
 
+// Push configuration to many devices, a few at a time
+export async function pushConfigToDevices(devices: Device[]): Promise<void> {
+  const queue = [...devices];
+  const worker = async () => {
+    for (let device = queue.shift(); device; device = queue.shift()) {
+      await pushConfigToDevice(device);
+    }
+  };
+  await Promise.all(Array.from({ length: Math.min(CONFIG_PUSH_CONCURRENCY, queue.length) }, worker));
+}
+
 // Get device state from device
 export async function fetchDeviceState(device: Device): Promise<any | null> {
   try {
     const url = `http://${device.ip}/api/state`;
-    const response = await fetch(url);
+    const headers: Record<string, string> = {};
+    if (MSGPACK_ENABLED) {
+      headers.Accept = `${MSGPACK_CONTENT_TYPE}, application/json`;
+    }
+    // Panels answer 304 when nothing changed since our last copy
+    const cached = stateCache.get(device.id);
+    if (cached) {
+      headers['If-None-Match'] = cached.etag;
+    }
+
+    const response = await fetch(url, { headers });
+
+    if (response.status === 304 && cached) {
+      device.lastSeen = Date.now();
+      device.online = true;
+      upsertDevice(device);
+      return cached.state;
+    }
 
     if (response.ok) {
       device.lastSeen = Date.now();
       device.online = true;
       upsertDevice(device);
-      return await response.json();
+      const state = (response.headers.get('content-type') || '').includes('msgpack')
+        ? decodeMsgPack(new Uint8Array(await response.arrayBuffer()))
+        : await response.json();
+      const etag = response.headers.get('etag');
+      if (etag) {
+        stateCache.set(device.id, { etag, state });
+      } else {
+        stateCache.delete(device.id);
+      }
+      return state;
     }
     return null;
   } catch (error) {
@@ -150,12 +801,38 @@ export async function fetchDeviceState(device: Device): Promise<any | null> {
 export async function pingDevice(device: Device): Promise<boolean> {
   const wasOffline = !device.online;
 
+  // An open socket is already heartbeating, no need for an HTTP round trip
+  if (isDeviceSocketOpen(device.id)) {
+    device.online = true;
+    device.lastSeen = Date.now();
+    upsertDevice(device);
+    return true;
+  }
+
+  // So is a TXT record announced moments ago
+  const advert = adverts.get(device.id);
+  if (advert && Date.now() - advert.at < ADVERT_FRESH_MS) {
+    device.online = true;
+    device.lastSeen = Math.max(device.lastSeen, advert.at);
+    upsertDevice(device);
+    return true;
+  }
+
   try {
     const url = `http://${device.ip}/api/ping`;
-    const response = await fetch(url);
+    const response = await fetch(url, { signal: AbortSignal.timeout(PING_TIMEOUT) });
 
     const online = response.ok;
     device.online = online;
+    if (online) {
+      const body = await response.json().catch(() => ({})) as { msgpack?: boolean; configSchema?: number };
+      if (MSGPACK_ENABLED && body.msgpack === true) {
+        msgpackDevices.add(device.id);
+      } else {
+        msgpackDevices.delete(device.id);
+      }
+      noteConfigSchema(device.id, body.configSchema);
+    }
     if (online) device.lastSeen = Date.now();
     upsertDevice(device);
 
@@ -181,22 +858,49 @@ export async function captureDeviceScreenshot(device: Device): Promise<boolean>
   try {
     const url = `http://${device.ip}/api/screenshot/capture`;
     const response = await fetch(url, { method: 'POST' });
-    return response.ok;
+    if (!response.ok) {
+      // 503 + Retry-After when the panel's heavy-request worker is saturated
+      return false;
+    }
+    if (response.status !== 202) {
+      return true;
+    }
+
+    // Capture runs on the panel's worker; wait for it before the caller
+    // fetches /api/screenshot/view
+    const statusUrl = `http://${device.ip}/api/screenshot/status`;
+    for (let i = 0; i < 40; i++) {
+      await new Promise(resolve => setTimeout(resolve, 250));
+      const status = await (await fetch(statusUrl)).json();
+      if (!status.pending) {
+        return status.last === 'done';
+      }
+    }
+    return false;
   } catch (error) {
     console.error(`Failed to capture screenshot from ${device.name}:`, error);
     return false;
   }
 }
 
-// Get screenshot from device (returns Buffer)
-export async function getDeviceScreenshot(device: Device): Promise<Buffer | null> {
+export interface DeviceScreenshot {
+  data: Buffer;
+  contentType: string;
+}
+
+// Get screenshot from device. Asks for QOI (a few percent of the BMP size);
+// firmware without format support ignores the parameter and sends BMP
+export async function getDeviceScreenshot(device: Device): Promise<DeviceScreenshot | null> {
   try {
-    const url = `http://${device.ip}/api/screenshot/view`;
+    const url = `http://${device.ip}/api/screenshot/view?format=qoi`;
     const response = await fetch(url);
 
     if (response.ok) {
       const arrayBuffer = await response.arrayBuffer();
-      return Buffer.from(arrayBuffer);
+      return {
+        data: Buffer.from(arrayBuffer),
+        contentType: response.headers.get('content-type') || 'image/bmp'
+      };
     }
     return null;
   } catch (error) {
@@ -261,13 +965,34 @@ export function updateDeviceConfig(
   return device;
 }
 
-// Periodic health check for all devices
-export async function checkAllDevicesHealth(): Promise<void> {
-  const devices = getAllDevices();
-  console.log(`Checking health of ${devices.length} devices...`);
+// Periodic health check for all devices, in parallel
+let healthCheckRunning = false;
 
-  for (const device of devices) {
-    await pingDevice(device);
+export async function checkAllDevicesHealth(intervalMs: number = 60000): Promise<void> {
+  if (healthCheckRunning) return;
+  healthCheckRunning = true;
+
+  try {
+    const now = Date.now();
+    const due = getAllDevices().filter(device => {
+      if (device.online && now - device.lastSeen < intervalMs) return false;
+      const backoff = healthBackoff.get(device.id);
+      return !backoff || now >= backoff.nextCheck;
+    });
+    if (due.length === 0) return;
+    console.log(`Checking health of ${due.length} devices...`);
+
+    await Promise.all(due.map(async device => {
+      if (await pingDevice(device)) {
+        healthBackoff.delete(device.id);
+        return;
+      }
+      const failures = (healthBackoff.get(device.id)?.failures || 0) + 1;
+      const delay = Math.min(intervalMs * 2 ** (failures - 1), HEALTH_BACKOFF_MAX);
+      healthBackoff.set(device.id, { failures, nextCheck: Date.now() + delay });
+    }));
+  } finally {
+    healthCheckRunning = false;
   }
 }
 
@@ -277,7 +1002,7 @@ let healthCheckInterval: NodeJS.Timeout | null = null;
 export function startHealthChecks(intervalMs: number = 60000): void {
   if (healthCheckInterval) return;
 
-  healthCheckInterval = setInterval(checkAllDevicesHealth, intervalMs);
+  healthCheckInterval = setInterval(() => checkAllDevicesHealth(intervalMs), intervalMs);
   console.log(`Started health checks every ${intervalMs / 1000} seconds`);
 }
 
@@ -288,10 +1013,30 @@ export function stopHealthChecks(): void {
   }
 }
 
-// Push reporting URL to a device (triggers confirmation dialog on device)
+// CA that signed an https:// REPORTING_URL's certificate (REPORTING_CA_FILE),
+// read once; panels verify the server against it
+let reportingCaCert: string | null | undefined;
+export function getReportingCaCert(): string | undefined {
+  if (reportingCaCert === undefined) {
+    const file = process.env.REPORTING_CA_FILE;
+    reportingCaCert = null;
+    if (file) {
+      try {
+        reportingCaCert = readFileSync(file, 'utf8');
+      } catch (error) {
+        console.error(`[DeviceService] Cannot read REPORTING_CA_FILE ${file}:`, error);
+      }
+    }
+  }
+  return reportingCaCert ?? undefined;
+}
+
+// Push reporting URL to a device (triggers confirmation dialog on device).
+// The panel only asks again when the URL or the CA differs from what it has.
 export async function pushReportingUrlToDevice(
   device: Device,
-  reportingUrl: string
+  reportingUrl: string,
+  caCert: string | undefined = getReportingCaCert()
 ): Promise<boolean> {
   try {
     const url = `http://${device.ip}/api/server`;
@@ -300,7 +1045,7 @@ export async function pushReportingUrlToDevice(
     const response = await fetch(url, {
       method: 'POST',
       headers: { 'Content-Type': 'application/json' },
-      body: JSON.stringify({ reportingUrl })
+      body: JSON.stringify(caCert !== undefined ? { reportingUrl, caCert } : { reportingUrl })
     });
 
     if (response.ok) {
@@ -366,33 +1111,132 @@ export async function syncReportingUrls(): Promise<void> {
   }
 }
 
+// Per-panel push queue. A panel has only a handful of sockets, and a poll
+// change, a heartbeat, a forced push and an action echo can all want to
+// push at once, so there is at most one push in flight per panel. Updates
+// that arrive meanwhile are merged (latest state per button wins) and go
+// out together once it finishes; every caller whose updates were in a
+// batch gets that batch's result.
+interface PushQueue {
+  device: Device;
+  pending: Map<number, ButtonUpdate>;
+  current: Promise<boolean> | null;   // The push in flight
+  next: Promise<boolean> | null;      // The batch waiting on it
+}
+const pushQueues: Map<string, PushQueue> = new Map();
+
 // Push button state updates to a device
-export async function pushButtonStatesToDevice(
+export function pushButtonStatesToDevice(
   device: Device,
   buttonUpdates: Array<{ id: number; state: boolean; speedLevel?: number }>
 ): Promise<boolean> {
+  let queue = pushQueues.get(device.id);
+  if (!queue) {
+    queue = { device, pending: new Map(), current: null, next: null };
+    pushQueues.set(device.id, queue);
+  }
+  queue.device = device;
+  for (const update of buttonUpdates) {
+    queue.pending.set(update.id, { ...update });
+  }
+
+  if (!queue.next) {
+    const q = queue;
+    q.next = (async () => {
+      // Always yields, so pushes requested in the same tick share the batch
+      await q.current;
+      const batch = Array.from(q.pending.values());
+      q.pending.clear();
+      q.next = null;
+      const push = sendButtonStates(q.device, batch);
+      q.current = push;
+      try {
+        return await push;
+      } finally {
+        if (q.current === push) q.current = null;
+      }
+    })();
+  }
+  return queue.next;
+}
+
+async function sendButtonStates(device: Device, buttonUpdates: ButtonUpdate[]): Promise<boolean> {
+  let track = stateTracks.get(device.id);
+  if (!track) {
+    track = { version: 0, synced: false, sent: new Map(), lastFull: 0 };
+    stateTracks.set(device.id, track);
+  }
+
+  // Full push when unsynced, or periodically when we hold every button anyway
+  const now = Date.now();
+  const coversAll = buttonUpdates.length >= device.config.buttons.length;
+  const full = !track.synced || (coversAll && now - track.lastFull >= FULL_RESYNC_INTERVAL);
+
+  const changed = full ? buttonUpdates : buttonUpdates.filter(u => track!.sent.get(u.id) !== buttonKey(u));
+  const version = (full || changed.length > 0) ? track.version + 1 : track.version;
+  const message: { version: number; base?: number; buttons: ButtonUpdate[]; serverTime: number } =
+    { version, buttons: changed, serverTime: serverTime() };
+  if (!full) message.base = track.version;
+
+  const commit = () => {
+    if (full) {
+      track!.sent.clear();
+      track!.synced = true;
+      if (coversAll) track!.lastFull = now;
+    }
+    for (const u of changed) track!.sent.set(u.id, buttonKey(u));
+    track!.version = version;
+  };
+
+  // Prefer the persistent socket; fall back to HTTP when it is down
+  if (sendToDevice(device.id, { t: 'state', ...message })) {
+    commit();
+    device.lastSeen = Date.now();
+    device.online = true;
+    return true;
+  }
+
   try {
     const url = `http://${device.ip}/api/state/buttons`;
-    const body = JSON.stringify({ buttons: buttonUpdates });
-    console.log(`[DeviceService] Pushing states to ${device.name} (${device.ip}): ${body}`);
+    const json = JSON.stringify(message);
+    const msgpack = msgpackDevices.has(device.id);
+    console.log(`[DeviceService] Pushing states to ${device.name} (${device.ip})${msgpack ? ' as msgpack' : ''}: ${json}`);
 
     const response = await fetch(url, {
       method: 'POST',
-      headers: { 'Content-Type': 'application/json' },
-      body
+      headers: { 'Content-Type': msgpack ? MSGPACK_CONTENT_TYPE : 'application/json' },
+      body: msgpack ? encodeMsgPack(message) : json
     });
 
     if (response.ok) {
+      commit();
+      const result = await response.json().catch(() => ({})) as { resync?: boolean };
+      if (result.resync) {
+        console.log(`[DeviceService] ${device.name} asked for a full state push`);
+        resetStateSync(device.id);
+      }
       device.lastSeen = Date.now();
       device.online = true;
       console.log(`[DeviceService] Successfully pushed states to ${device.name}`);
       return true;
     }
     console.error(`[DeviceService] Failed to push button states to ${device.name}: ${response.status}`);
+    resetStateSync(device.id);
     return false;
   } catch (error) {
     console.error(`[DeviceService] Error pushing button states to ${device.name}:`, error);
+    resetStateSync(device.id);
     device.online = false;
     return false;
   }
 }
+
+// Tell a device its effective config changed so it re-fetches it.
+// Only possible over the socket; returns false if the channel is down.
+export function notifyConfigChanged(device: Device): boolean {
+  const sent = sendToDevice(device.id, { t: 'config' });
+  if (sent) {
+    console.log(`[DeviceService] Notified ${device.name} of config change`);
+  }
+  return sent;
+}
@@ -0,0 +1,367 @@
+import { getAllDevices, getDevice, upsertDevice } from '../db';
+import { encodeMsgPack, decodeMsgPack } from '../utils/msgpack';
+import { ingestTelemetry } from './telemetryService';
+
+// Persistent WebSocket channel to each adopted panel (ws://<ip>/ws).
+//
+// The server is the dialing side: it keeps one socket per panel open,
+// reconnecting with exponential backoff, and uses it for state pushes,
+// heartbeats and config-changed notifications. Panels send button/scene
+// actions back over the same socket. When a channel is down, callers fall
+// back to the existing HTTP endpoints.
+
+const HEARTBEAT_INTERVAL = 15000;   // Ping every 15 seconds
+const HEARTBEAT_TIMEOUT = 45000;    // Drop the socket after 45 seconds of silence
+const RECONNECT_MIN_DELAY = 1000;
+const RECONNECT_MAX_DELAY = 30000;
+const SWEEP_INTERVAL = 10000;       // Pick up newly adopted / re-addressed devices
+const HEAP_HISTORY_SIZE = 1440;     // Pong heap samples kept per panel (6 hours)
+const TASK_HISTORY_SIZE = 240;      // Pong task samples kept per panel (1 hour)
+
+// Send binary MessagePack frames to panels that advertise support
+// (set PANEL_MSGPACK=false to force JSON text frames)
+const MSGPACK_ENABLED = process.env.PANEL_MSGPACK !== 'false';
+
+// Bun ships a browser-compatible WebSocket client; tsconfig only pulls in
+// ES2020 typings, so describe the subset used here.
+interface SocketLike {
+  readyState: number;
+  binaryType: string;
+  send(data: string | Uint8Array): void;
+  close(): void;
+  onopen: (() => void) | null;
+  onmessage: ((event: { data: unknown }) => void) | null;
+  onclose: (() => void) | null;
+  onerror: ((event: unknown) => void) | null;
+}
+const SOCKET_OPEN = 1;
+const WebSocketClient: new (url: string) => SocketLike = (globalThis as any).WebSocket;
+
+// Heap sample a panel attaches to its pong (see firmware heap_monitor.h)
+export interface PanelHeapSample {
+  uptime_s: number;
+  internal_free: number;
+  internal_largest: number;
+  internal_min: number;
+  psram_free: number;
+  psram_largest: number;
+  psram_min: number;
+  lvgl_used: number;
+  lvgl_largest: number;
+  lvgl_frag_pct: number;
+  ops: Record<string, number>;   // Tagged operations (config, web, ...) since boot
+}
+
+// Task sample a panel attaches to its pong (see firmware task_monitor.h).
+// CPU figures are null when the firmware was built without FreeRTOS
+// run-time stats.
+export type PanelTaskRow = [
+  name: string,
+  core: number,               // Pinned core, -1 for no affinity
+  cpuPct: number | null,      // Share of one core over the last window
+  stackFree: number,          // Stack high-water mark, bytes
+];
+
+export interface PanelTaskSample {
+  window_ms: number;
+  core_load_pct: number[] | null;
+  tasks: PanelTaskRow[];
+}
+
+// Frame time percentiles a panel attaches to its pong (see firmware
+// perf_monitor.h), over the monitor's current window
+export interface PanelPerfSample {
+  frames: number;
+  frame_p50_us: number;
+  frame_p95_us: number;
+  render_p95_us: number;
+  jitter_p95_us: number;
+}
+
+// Link figures a panel attaches to its pong (rssi is 0 while unassociated)
+export interface PanelWifiSample {
+  rssi: number;
+  reconnects: number;     // Since boot
+}
+
+// Messages sent by the panel
+export type PanelMessage =
+  | { t: 'hello'; deviceId: string; msgpack?: boolean; mcast?: boolean }
+  | { t: 'light'; id: number; state: boolean }
+  | { t: 'scene'; id: number }
+  | {
+      t: 'batch';
+      seq: number;
+      buttons?: Array<{ id: number; state: boolean; speedLevel?: number }>;
+      scenes?: number[];
+    }
+  | { t: 'resync' }
+  | { t: 'pong'; heap?: PanelHeapSample; perf?: PanelPerfSample; wifi?: PanelWifiSample; tasks?: PanelTaskSample };
+
+type PanelMessageHandler = (deviceId: string, message: PanelMessage) => void;
+
+interface Channel {
+  deviceId: string;
+  ip: string;
+  socket: SocketLike | null;
+  open: boolean;
+  msgpack: boolean;       // Panel accepts MessagePack binary frames
+  multicast: boolean;     // Panel hears state multicast (multicastService)
+  lastReceive: number;
+  backoff: number;
+  reconnectTimer: NodeJS.Timeout | null;
+}
+
+const channels: Map<string, Channel> = new Map();
+const messageHandlers: PanelMessageHandler[] = [];
+const heapHistory: Map<string, Array<PanelHeapSample & { receivedAt: number }>> = new Map();
+const taskHistory: Map<string, Array<PanelTaskSample & { receivedAt: number }>> = new Map();
+let heartbeatInterval: NodeJS.Timeout | null = null;
+let sweepInterval: NodeJS.Timeout | null = null;
+
+// Register a handler for messages arriving over panel sockets
+export function onPanelMessage(handler: PanelMessageHandler): void {
+  messageHandlers.push(handler);
+}
+
+// Heap samples received from a panel's pongs, oldest first
+export function getDeviceHeapHistory(deviceId: string): Array<PanelHeapSample & { receivedAt: number }> {
+  return heapHistory.get(deviceId) ?? [];
+}
+
+function recordHeapSample(deviceId: string, sample: PanelHeapSample): void {
+  let history = heapHistory.get(deviceId);
+  if (!history) {
+    history = [];
+    heapHistory.set(deviceId, history);
+  }
+  history.push({ ...sample, receivedAt: Date.now() });
+  if (history.length > HEAP_HISTORY_SIZE) {
+    history.splice(0, history.length - HEAP_HISTORY_SIZE);
+  }
+}
+
+// Task samples received from a panel's pongs, oldest first
+export function getDeviceTaskHistory(deviceId: string): Array<PanelTaskSample & { receivedAt: number }> {
+  return taskHistory.get(deviceId) ?? [];
+}
+
+function recordTaskSample(deviceId: string, sample: PanelTaskSample): void {
+  let history = taskHistory.get(deviceId);
+  if (!history) {
+    history = [];
+    taskHistory.set(deviceId, history);
+  }
+  history.push({ ...sample, receivedAt: Date.now() });
+  if (history.length > TASK_HISTORY_SIZE) {
+    history.splice(0, history.length - TASK_HISTORY_SIZE);
+  }
+}
+
+// True if the panel's channel is open and usable
+export function isDeviceSocketOpen(deviceId: string): boolean {
+  const channel = channels.get(deviceId);
+  return !!channel && channel.open && channel.socket?.readyState === SOCKET_OPEN;
+}
+
+// True if the panel's channel is open and its hello says it hears state multicast
+export function isDeviceMulticast(deviceId: string): boolean {
+  return isDeviceSocketOpen(deviceId) && channels.get(deviceId)!.multicast;
+}
+
+// Send a message to a panel; returns false if its channel is down
+// Unix seconds, as panels take it in config, state pushes and pings
+export function serverTime(): number {
+  return Math.floor(Date.now() / 1000);
+}
+
+export function sendToDevice(deviceId: string, message: object): boolean {
+  const channel = channels.get(deviceId);
+  if (!channel || !isDeviceSocketOpen(deviceId)) return false;
+
+  try {
+    channel.socket!.send(channel.msgpack ? encodeMsgPack(message) : JSON.stringify(message));
+    return true;
+  } catch (error) {
+    console.error(`[DeviceSocket] Send to ${deviceId} failed:`, error);
+    return false;
+  }
+}
+
+function scheduleReconnect(channel: Channel): void {
+  if (channel.reconnectTimer || !channels.has(channel.deviceId)) return;
+
+  // Jitter keeps a server restart from reconnecting every panel in lockstep
+  const delay = channel.backoff + Math.floor(Math.random() * channel.backoff * 0.2);
+  channel.backoff = Math.min(channel.backoff * 2, RECONNECT_MAX_DELAY);
+
+  channel.reconnectTimer = setTimeout(() => {
+    channel.reconnectTimer = null;
+    connect(channel);
+  }, delay);
+}
+
+function handleMessage(channel: Channel, raw: unknown): void {
+  channel.lastReceive = Date.now();
+
+  let message: PanelMessage;
+  try {
+    message = (raw instanceof ArrayBuffer || ArrayBuffer.isView(raw))
+      ? decodeMsgPack(raw instanceof ArrayBuffer ? new Uint8Array(raw) : new Uint8Array(raw.buffer, raw.byteOffset, raw.byteLength)) as PanelMessage
+      : JSON.parse(String(raw));
+  } catch {
+    console.error(`[DeviceSocket] Malformed message from ${channel.deviceId}`);
+    return;
+  }
+
+  if (message.t === 'hello') {
+    channel.msgpack = MSGPACK_ENABLED && message.msgpack === true;
+    channel.multicast = message.mcast === true;
+    // Our clock right away, so a panel that just booted has its schedules before NTP
+    sendToDevice(channel.deviceId, { t: 'ping', serverTime: serverTime() });
+  }
+  if (message.t === 'pong') {
+    if (message.heap) recordHeapSample(channel.deviceId, message.heap);
+    if (message.tasks) recordTaskSample(channel.deviceId, message.tasks);
+    ingestTelemetry(channel.deviceId, message);
+  } else {
+    for (const handler of messageHandlers) handler(channel.deviceId, message);
+  }
+}
+
+function connect(channel: Channel): void {
+  if (!WebSocketClient) return;
+
+  let socket: SocketLike;
+  try {
+    socket = new WebSocketClient(`ws://${channel.ip}/ws`);
+  } catch (error) {
+    console.error(`[DeviceSocket] Failed to open socket to ${channel.ip}:`, error);
+    scheduleReconnect(channel);
+    return;
+  }
+  channel.socket = socket;
+  socket.binaryType = 'arraybuffer';
+
+  socket.onopen = () => {
+    channel.open = true;
+    channel.msgpack = false;  // Until the panel's hello says otherwise
+    channel.multicast = false;
+    channel.backoff = RECONNECT_MIN_DELAY;
+    channel.lastReceive = Date.now();
+    console.log(`[DeviceSocket] Connected to ${channel.deviceId} (${channel.ip})`);
+
+    const device = getDevice(channel.deviceId);
+    if (device) {
+      device.online = true;
+      device.lastSeen = Date.now();
+      upsertDevice(device);
+    }
+  };
+
+  socket.onmessage = (event) => handleMessage(channel, event.data);
+
+  socket.onerror = () => {
+    // onclose follows and handles the reconnect
+  };
+
+  socket.onclose = () => {
+    if (channel.socket !== socket) return;
+    if (channel.open) {
+      console.log(`[DeviceSocket] Disconnected from ${channel.deviceId}`);
+    }
+    channel.open = false;
+    channel.socket = null;
+    scheduleReconnect(channel);
+  };
+}
+
+function closeChannel(channel: Channel): void {
+  if (channel.reconnectTimer) {
+    clearTimeout(channel.reconnectTimer);
+    channel.reconnectTimer = null;
+  }
+  const socket = channel.socket;
+  channel.socket = null;
+  channel.open = false;
+  socket?.close();
+}
+
+// Open channels for adopted devices, follow IP changes, drop removed devices
+function sweepChannels(): void {
+  const devices = getAllDevices().filter(d => d.adopted && d.ip);
+  const ids = new Set(devices.map(d => d.id));
+
+  for (const [deviceId, channel] of channels) {
+    if (!ids.has(deviceId)) {
+      closeChannel(channel);
+      channels.delete(deviceId);
+    }
+  }
+
+  for (const device of devices) {
+    const existing = channels.get(device.id);
+    if (existing && existing.ip === device.ip) continue;
+
+    if (existing) closeChannel(existing);
+    const channel: Channel = {
+      deviceId: device.id,
+      ip: device.ip,
+      socket: null,
+      open: false,
+      msgpack: false,
+      multicast: false,
+      lastReceive: 0,
+      backoff: RECONNECT_MIN_DELAY,
+      reconnectTimer: null
+    };
+    channels.set(device.id, channel);
+    connect(channel);
+  }
+}
+
+function heartbeatTick(): void {
+  const now = Date.now();
+  for (const channel of channels.values()) {
+    if (!channel.open || !channel.socket) continue;
+
+    if (now - channel.lastReceive > HEARTBEAT_TIMEOUT) {
+      console.log(`[DeviceSocket] Heartbeat timeout for ${channel.deviceId}, reconnecting`);
+      const socket = channel.socket;
+      channel.socket = null;
+      channel.open = false;
+      socket.close();
+      scheduleReconnect(channel);
+      continue;
+    }
+    sendToDevice(channel.deviceId, { t: 'ping', serverTime: serverTime() });
+  }
+}
+
+export function startDeviceSockets(): void {
+  if (sweepInterval) return;
+  if (!WebSocketClient) {
+    console.warn('[DeviceSocket] No WebSocket client available, using HTTP only');
+    return;
+  }
+
+  sweepChannels();
+  sweepInterval = setInterval(sweepChannels, SWEEP_INTERVAL);
+  heartbeatInterval = setInterval(heartbeatTick, HEARTBEAT_INTERVAL);
+  console.log('[DeviceSocket] Started device socket channels');
+}
+
+export function stopDeviceSockets(): void {
+  if (sweepInterval) {
+    clearInterval(sweepInterval);
+    sweepInterval = null;
+  }
+  if (heartbeatInterval) {
+    clearInterval(heartbeatInterval);
+    heartbeatInterval = null;
+  }
+  for (const channel of channels.values()) {
+    closeChannel(channel);
+  }
+  channels.clear();
+}
@@ -1,6 +1,6 @@
 import Bonjour, { Service } from 'bonjour-service';
 import { addDiscoveredDevice, DiscoveredDevice, getDevice, upsertDevice } from '../db';
-import { pushReportingUrlToDevice } from './deviceService';
+import { noteDeviceAdvert, pushReportingUrlToDevice } from './deviceService';
 
 const bonjour = new Bonjour();
 let browser: ReturnType<typeof bonjour.find> | null = null;
@@ -14,54 +14,74 @@ export function startDiscovery(): void {
 
   console.log('Starting mDNS discovery for _esp32display._tcp...');
 
-  browser = bonjour.find({ type: 'esp32display' }, async (service: Service) => {
+  browser = bonjour.find({ type: 'esp32display' }, (service: Service) => onServiceSeen(service, false));
+
+  // Panels re-announce their TXT record when its versions change
+  browser.on('txt-update', (service: Service) => onServiceSeen(service, true));
+}
+
+function txtNumber(value: unknown): number | undefined {
+  const n = Number(value);
+  return value !== undefined && Number.isFinite(n) ? n : undefined;
+}
+
+async function onServiceSeen(service: Service, txtUpdate: boolean): Promise<void> {
+  if (!txtUpdate) {
     console.log('Discovered device:', service.name, service.addresses);
+  }
+
+  // Extract device info from TXT records
+  const txt = service.txt || {};
+  const id = txt.id || service.name;
+  const mac = txt.mac || 'unknown';
+  const name = txt.name || service.name;
+
+  // Get first IPv4 address
+  const ip = service.addresses?.find(addr => !addr.includes(':')) || service.host;
 
-    // Extract device info from TXT records
-    const txt = service.txt || {};
-    const id = txt.id || service.name;
-    const mac = txt.mac || 'unknown';
-    const name = txt.name || service.name;
-
-    // Get first IPv4 address
-    const ip = service.addresses?.find(addr => !addr.includes(':')) || service.host;
-
-    // Check if this is an already-adopted device
-    const adoptedDevice = getDevice(id);
-    if (adoptedDevice && adoptedDevice.adopted) {
-      const ipChanged = adoptedDevice.ip !== ip;
-      const wasOffline = !adoptedDevice.online;
-
-      if (ipChanged) {
-        console.log(`[Discovery] Updating adopted device ${adoptedDevice.name} IP: ${adoptedDevice.ip} -> ${ip}`);
-        adoptedDevice.ip = ip;
-      }
-
-      adoptedDevice.online = true;
-      adoptedDevice.lastSeen = Date.now();
-      upsertDevice(adoptedDevice);
-
-      // Sync reporting URL if env var is set and device was offline or IP changed
-      const reportingUrl = process.env.REPORTING_URL;
-      if (reportingUrl && (ipChanged || wasOffline)) {
-        console.log(`[Discovery] Syncing reporting URL to ${adoptedDevice.name}`);
-        await pushReportingUrlToDevice(adoptedDevice, reportingUrl);
-      }
-      return;
+  // Check if this is an already-adopted device
+  const adoptedDevice = getDevice(id);
+  if (adoptedDevice && adoptedDevice.adopted) {
+    const ipChanged = adoptedDevice.ip !== ip;
+    const wasOffline = !adoptedDevice.online;
+
+    if (ipChanged) {
+      console.log(`[Discovery] Updating adopted device ${adoptedDevice.name} IP: ${adoptedDevice.ip} -> ${ip}`);
+      adoptedDevice.ip = ip;
+    }
+
+    adoptedDevice.online = true;
+    adoptedDevice.lastSeen = Date.now();
+    upsertDevice(adoptedDevice);
+
+    noteDeviceAdvert(adoptedDevice, {
+      fw: txt.fw,
+      boot: txt.boot,
+      cfg: txtNumber(txt.cfg),
+      state: txtNumber(txt.state),
+      at: Date.now()
+    });
+
+    // Sync reporting URL if env var is set and device was offline or IP changed
+    const reportingUrl = process.env.REPORTING_URL;
+    if (reportingUrl && (ipChanged || wasOffline)) {
+      console.log(`[Discovery] Syncing reporting URL to ${adoptedDevice.name}`);
+      await pushReportingUrlToDevice(adoptedDevice, reportingUrl);
     }
+    return;
+  }
+
+  const device: DiscoveredDevice = {
+    id,
+    name,
+    mac,
+    ip,
+    port: service.port,
+    discoveredAt: Date.now()
+  };
 
-    const device: DiscoveredDevice = {
-      id,
-      name,
-      mac,
-      ip,
-      port: service.port,
-      discoveredAt: Date.now()
-    };
-
-    addDiscoveredDevice(device);
-    console.log(`Added discovered device: ${id} at ${ip}:${service.port}`);
-  });
+  addDiscoveredDevice(device);
+  console.log(`Added discovered device: ${id} at ${ip}:${service.port}`);
 }
 
 // Stop discovery
@@ -0,0 +1,129 @@
+import * as crypto from 'crypto';
+import * as dgram from 'dgram';
+import { getGlobalSettings, updateGlobalSettings, GlobalSettings } from '../db';
+
+// State multicast (global setting stateMulticast).
+//
+// A change to an accessory shown on many panels goes out as one UDP
+// datagram to a multicast group every panel joins, instead of one push per
+// panel. Entries are addressed by binding id (bindingId() below, sent to
+// the panels as each bound button's "bid"), and each datagram is signed
+// with a key the panels get in their config. See the firmware's
+// state_multicast.h for the layout. Every datagram is sent twice; a panel
+// that notices a gap in seq asks for a full push over its socket, and a
+// heartbeat (no entries, last seq) every HEARTBEAT_INTERVAL lets it notice
+// a lost last one. Panels keep getting unicast pushes unless their hello
+// says they hear the group (see noteMulticastStates in deviceService).
+
+const GROUP = process.env.PANEL_MULTICAST_GROUP || '239.255.77.77';
+const PORT = Number(process.env.PANEL_MULTICAST_PORT) || 47777;
+
+const DATAGRAM_VERSION = 1;
+const HEADER_SIZE = 12;
+const ENTRY_SIZE = 6;
+const TAG_SIZE = 8;
+const MAX_ENTRIES = 200;             // Keeps a datagram under 1300 bytes
+const NO_SPEED = 0xff;
+const HEARTBEAT_INTERVAL = 15000;    // Panels give up on the group after 45 s of silence
+
+export interface MulticastEntry {
+  bindingId: number;
+  state: boolean;
+  speedLevel?: number;
+}
+
+// Redrawn per server run so panels don't mistake a restart's seq for old ones; never 0
+const epoch = (crypto.randomBytes(4).readUInt32LE(0) | 1) >>> 0;
+let seq = 0;
+let socket: dgram.Socket | null = null;
+let heartbeatTimer: NodeJS.Timeout | null = null;
+
+// Binding id of an external device: FNV-1a of "<pluginId>\0<externalDeviceId>", never 0
+export function bindingId(pluginId: string, externalDeviceId: string): number {
+  let hash = 0x811c9dc5;
+  for (const byte of Buffer.from(`${pluginId}\0${externalDeviceId}`, 'utf8')) {
+    hash = Math.imul(hash ^ byte, 0x01000193) >>> 0;
+  }
+  return hash === 0 ? 1 : hash;
+}
+
+// A signing key kept in the global settings (hex), drawn the first time it's needed
+export function signingKey(field: 'multicastKey' | 'peerMirrorKey'): string {
+  let key = getGlobalSettings()[field];
+  if (!key) {
+    key = crypto.randomBytes(32).toString('hex');
+    const update: Partial<GlobalSettings> = {};
+    update[field] = key;
+    updateGlobalSettings(update);
+  }
+  return key;
+}
+
+// The "multicast" object of a panel's config, or null with the setting off
+export function multicastConfig(): { group: string; port: number; key: string } | null {
+  if (!getGlobalSettings().stateMulticast) return null;
+  return { group: GROUP, port: PORT, key: signingKey('multicastKey') };
+}
+
+function datagram(key: Buffer, number: number, entries: MulticastEntry[]): Buffer {
+  const body = Buffer.alloc(HEADER_SIZE + entries.length * ENTRY_SIZE);
+  body.write('PS', 0, 'ascii');
+  body.writeUInt8(DATAGRAM_VERSION, 2);
+  body.writeUInt8(entries.length, 3);
+  body.writeUInt32LE(epoch, 4);
+  body.writeUInt32LE(number, 8);
+  entries.forEach((entry, i) => {
+    const at = HEADER_SIZE + i * ENTRY_SIZE;
+    body.writeUInt32LE(entry.bindingId, at);
+    body.writeUInt8(entry.state ? 1 : 0, at + 4);
+    body.writeUInt8(entry.speedLevel ?? NO_SPEED, at + 5);
+  });
+  const tag = crypto.createHmac('sha256', key).update(body).digest().subarray(0, TAG_SIZE);
+  return Buffer.concat([body, tag]);
+}
+
+function send(packet: Buffer): void {
+  if (!socket) {
+    // Default multicast TTL is 1: the group stays on the panels' subnet
+    socket = dgram.createSocket('udp4');
+    socket.on('error', error => console.error('[Multicast] Socket error:', error));
+  }
+  for (let copy = 0; copy < 2; copy++) {
+    socket.send(packet, PORT, GROUP, error => {
+      if (error) console.error('[Multicast] Send failed:', error);
+    });
+  }
+}
+
+// Multicast state changes; false with the setting off (push them as usual)
+export function broadcastStates(entries: MulticastEntry[]): boolean {
+  const config = multicastConfig();
+  if (!config) return false;
+  const key = Buffer.from(config.key, 'hex');
+  for (let i = 0; i < entries.length; i += MAX_ENTRIES) {
+    send(datagram(key, ++seq, entries.slice(i, i + MAX_ENTRIES)));
+  }
+  return true;
+}
+
+function heartbeat(): void {
+  const config = multicastConfig();
+  if (config) {
+    send(datagram(Buffer.from(config.key, 'hex'), seq, []));
+  }
+}
+
+export function startStateMulticast(): void {
+  if (heartbeatTimer) return;
+  heartbeatTimer = setInterval(heartbeat, HEARTBEAT_INTERVAL);
+  console.log(`[Multicast] State multicast to ${GROUP}:${PORT} ${getGlobalSettings().stateMulticast ? 'on' : 'off (setting stateMulticast)'}`);
+}
+
+export function stopStateMulticast(): void {
+  if (heartbeatTimer) {
+    clearInterval(heartbeatTimer);
+    heartbeatTimer = null;
+  }
+  socket?.close();
+  socket = null;
+}
@@ -1,14 +1,151 @@
-import { getAllDevices, upsertDevice, Device, ButtonConfig } from '../db';
+import {
+  getAllDevices,
+  getDevice,
+  upsertDevice,
+  getBoundPluginIds,
+  getBindingTargets,
+  getBindingTarget,
+  BindingTarget,
+  Device,
+  ButtonConfig
+} from '../db';
 import { pluginManager } from '../plugins/pluginManager';
-import { pushButtonStatesToDevice } from './deviceService';
+import { ButtonBinding, DeviceState } from '../plugins/types';
+import { pushButtonStatesToDevice, noteMulticastStates } from './deviceService';
+import { bindingId, broadcastStates, MulticastEntry } from './multicastService';
 
 const DEFAULT_POLL_INTERVAL = 30000;  // 30 seconds default
 const TICK_INTERVAL = 5000;           // Check every 5 seconds which plugins need polling
 const FORCE_PUSH_INTERVAL = 60000;    // Force push states every 60 seconds even if unchanged
+const DEFAULT_MAX_CONCURRENT_POLLS = 4;  // State requests in flight per plugin
+const POLL_TIMEOUT = 5000;            // Give up on one state request after 5 seconds
 
 let tickInterval: NodeJS.Timeout | null = null;
 const lastPollTime: Map<string, number> = new Map();
 const lastPushTime: Map<string, number> = new Map();  // Track last push per device
+const pollsInFlight: Set<string> = new Set();         // Plugins whose last poll hasn't finished
+
+type ButtonUpdate = { id: number; state: boolean; speedLevel?: number };
+
+// Run fn over items with at most limit calls in flight
+async function runLimited<T>(items: T[], limit: number, fn: (item: T) => Promise<void>): Promise<void> {
+  let next = 0;
+  const worker = async () => {
+    while (next < items.length) {
+      await fn(items[next++]);
+    }
+  };
+  const workers = Math.max(1, Math.min(limit, items.length));
+  await Promise.all(Array.from({ length: workers }, worker));
+}
+
+// What request resolves to, or fallback if it takes longer than POLL_TIMEOUT
+async function withTimeout<T>(request: Promise<T>, fallback: T, what: string): Promise<T> {
+  let timer: NodeJS.Timeout | undefined;
+  const timeout = new Promise<T>(resolve => {
+    timer = setTimeout(() => {
+      console.log(`[StateSync] ${what} timed out after ${POLL_TIMEOUT / 1000}s`);
+      resolve(fallback);
+    }, POLL_TIMEOUT);
+  });
+  try {
+    return await Promise.race([request, timeout]);
+  } finally {
+    clearTimeout(timer);
+  }
+}
+
+// Fetch the states of one plugin's external devices, given one binding each:
+// in one call if the plugin has a batch API, else one request per device
+// under the plugin's concurrency limit. Keyed by external device ID; null
+// when no state came back.
+async function fetchExternalStates(pluginId: string, bindings: ButtonBinding[]): Promise<Map<string, DeviceState | null>> {
+  const states: Map<string, DeviceState | null> = new Map();
+  if (bindings.length === 0) return states;
+
+  const ids = bindings.map(binding => binding.externalDeviceId);
+  const batch = await withTimeout(pluginManager.getDeviceStates(pluginId, ids), new Map<string, DeviceState>(),
+                                  `Batch state request to ${pluginId}`);
+  if (batch) {
+    for (const id of ids) {
+      states.set(id, batch.get(id) || null);
+    }
+    return states;
+  }
+
+  const limit = pluginManager.getPlugin(pluginId)?.maxConcurrentPolls || DEFAULT_MAX_CONCURRENT_POLLS;
+  await runLimited(bindings, limit, async binding => {
+    states.set(binding.externalDeviceId, await withTimeout(pluginManager.getDeviceState(binding), null,
+                                                           `State request for ${binding.externalDeviceId}`));
+  });
+  return states;
+}
+
+// External devices of a plugin bound to a button on at least one online panel
+function shownTargets(pluginId: string): BindingTarget[] {
+  return getBindingTargets(pluginId).filter(target =>
+    target.buttons.some(bound => getDevice(bound.deviceId)?.online));
+}
+
+// Apply an external device's state to every online button bound to it,
+// collecting what changed per panel; true if any button changed
+function applyExternalState(target: BindingTarget, externalState: DeviceState,
+                            updates: Map<string, ButtonUpdate[]>): boolean {
+  let changed = false;
+  for (const bound of target.buttons) {
+    const device = getDevice(bound.deviceId);
+    if (!device?.online) continue;
+    const button = device.config.buttons.find(b => b.id === bound.buttonId);
+    if (!button) continue;
+
+    // Check if state changed
+    const stateChanged = button.state !== externalState.state;
+    const speedChanged = externalState.speedLevel !== undefined &&
+                        button.speedLevel !== externalState.speedLevel;
+    if (!stateChanged && !speedChanged) continue;
+
+    console.log(`[StateSync] State change detected: ${device.name} button ${button.id} "${button.name}": ${button.state} -> ${externalState.state}`);
+
+    // Update local state
+    button.state = externalState.state;
+    if (externalState.speedLevel !== undefined) {
+      button.speedLevel = externalState.speedLevel;
+    }
+
+    // Only include speedLevel for fan-type buttons
+    const update: ButtonUpdate = {
+      id: button.id,
+      state: externalState.state
+    };
+    if (button.type === 'fan' && externalState.speedLevel !== undefined) {
+      update.speedLevel = externalState.speedLevel;
+    }
+    const list = updates.get(device.id);
+    if (list) {
+      list.push(update);
+    } else {
+      updates.set(device.id, [update]);
+    }
+    changed = true;
+  }
+  return changed;
+}
+
+// Multicast entry for an external device's new state
+function multicastEntry(target: BindingTarget, externalState: DeviceState): MulticastEntry {
+  return {
+    bindingId: bindingId(target.pluginId, target.externalDeviceId),
+    state: externalState.state,
+    speedLevel: externalState.speedLevel
+  };
+}
+
+// Changes for the panels that heard them multicast are recorded, not pushed
+function multicastHandled(device: Device, buttonUpdates: ButtonUpdate[], multicast: boolean): boolean {
+  if (!multicast || !noteMulticastStates(device, buttonUpdates)) return false;
+  console.log(`[StateSync] ${buttonUpdates.length} changed state(s) for ${device.name} went by multicast`);
+  return true;
+}
 
 // Get the polling interval for a plugin
 function getPluginPollingInterval(pluginId: string): number {
@@ -53,107 +190,80 @@ async function pushAllStatesToDevice(device: Device): Promise<boolean> {
   return success;
 }
 
-// Poll devices bound to a specific plugin
+// Poll a plugin: each external device shown on an online panel once, then
+// the changes fanned out to the panels bound to them, in parallel
 async function pollPluginDevices(pluginId: string): Promise<void> {
-  const devices = getAllDevices();
+  const targets = shownTargets(pluginId);
+  const states = await fetchExternalStates(pluginId, targets.map(target => target.binding));
   const now = Date.now();
 
-  for (const device of devices) {
-    if (!device.online) {
+  const updates: Map<string, ButtonUpdate[]> = new Map();
+  const panels: Set<string> = new Set();
+  const entries: MulticastEntry[] = [];
+  for (const target of targets) {
+    for (const bound of target.buttons) {
+      panels.add(bound.deviceId);
+    }
+    const externalState = states.get(target.externalDeviceId);
+    if (!externalState) {
+      console.log(`[StateSync] No state returned for ${target.externalDeviceId} (${target.buttons.length} button(s))`);
       continue;
     }
+    if (applyExternalState(target, externalState, updates)) {
+      entries.push(multicastEntry(target, externalState));
+    }
+  }
+  // One datagram for every panel showing them; pushes cover those not hearing it
+  const multicast = entries.length > 0 && broadcastStates(entries);
 
-    const buttonUpdates: Array<{ id: number; state: boolean; speedLevel?: number }> = [];
-    let hasChanges = false;
-    let hasBoundButtons = false;
-
-    for (const button of device.config.buttons) {
-      // Only poll buttons bound to this plugin
-      if (!button.binding || button.binding.pluginId !== pluginId) continue;
-      hasBoundButtons = true;
+  await Promise.all([...panels].map(async deviceId => {
+    const device = getDevice(deviceId);
+    if (!device?.online) return;
 
-      const externalState = await pluginManager.getDeviceState(button.binding);
-      if (!externalState) {
-        console.log(`[StateSync] No state returned for button ${button.id} (${button.name})`);
-        continue;
+    try {
+      const buttonUpdates = updates.get(deviceId);
+      if (buttonUpdates && multicastHandled(device, buttonUpdates, multicast)) {
+        upsertDevice(device);
       }
-
-      // Check if state changed
-      const stateChanged = button.state !== externalState.state;
-      const speedChanged = externalState.speedLevel !== undefined &&
-                          button.speedLevel !== externalState.speedLevel;
-
-      if (stateChanged || speedChanged) {
-        console.log(`[StateSync] State change detected: Button ${button.id} "${button.name}": ${button.state} -> ${externalState.state}`);
-
-        // Update local state
-        button.state = externalState.state;
-        if (externalState.speedLevel !== undefined) {
-          button.speedLevel = externalState.speedLevel;
-        }
-
-        // Only include speedLevel for fan-type buttons
-        const update: { id: number; state: boolean; speedLevel?: number } = {
-          id: button.id,
-          state: externalState.state
-        };
-        if (button.type === 'fan' && externalState.speedLevel !== undefined) {
-          update.speedLevel = externalState.speedLevel;
+      // If we have changes, push them
+      else if (buttonUpdates) {
+        const pushed = await pushButtonStatesToDevice(device, buttonUpdates);
+        if (pushed) {
+          upsertDevice(device);
+          lastPushTime.set(device.id, now);
+          console.log(`[StateSync] Pushed ${buttonUpdates.length} changed state(s) to ${device.name}`);
         }
-        buttonUpdates.push(update);
-        hasChanges = true;
       }
-    }
-
-    // If we have changes, push them
-    if (hasChanges) {
-      const pushed = await pushButtonStatesToDevice(device, buttonUpdates);
-      if (pushed) {
+      // If no changes but the device needs a heartbeat, force push all states
+      else if (shouldForcePush(device.id, now)) {
+        await pushAllStatesToDevice(device);
+        // Also save to ensure database is in sync
         upsertDevice(device);
-        lastPushTime.set(device.id, now);
-        console.log(`[StateSync] Pushed ${buttonUpdates.length} changed state(s) to ${device.name}`);
-      }
-    }
-    // If no changes but device has bound buttons and needs heartbeat, force push all states
-    else if (hasBoundButtons && shouldForcePush(device.id, now)) {
-      await pushAllStatesToDevice(device);
-      // Also save to ensure database is in sync
-      upsertDevice(device);
-    }
-  }
-}
-
-// Get all unique plugin IDs from device bindings
-function getBoundPluginIds(): Set<string> {
-  const pluginIds = new Set<string>();
-  const devices = getAllDevices();
-
-  for (const device of devices) {
-    for (const button of device.config.buttons) {
-      if (button.binding?.pluginId) {
-        pluginIds.add(button.binding.pluginId);
       }
+    } catch (error) {
+      console.error(`[StateSync] Error updating ${device.name} from plugin ${pluginId}:`, error);
     }
-  }
-
-  return pluginIds;
+  }));
 }
 
-// Main tick function - checks which plugins need polling
+// Main tick function - polls the plugins that are due, side by side. A
+// plugin still busy with its last poll is left to finish it.
 async function pollTick(): Promise<void> {
   const now = Date.now();
-  const boundPlugins = getBoundPluginIds();
+  const due = getBoundPluginIds().filter(pluginId =>
+    shouldPollPlugin(pluginId, now) && !pollsInFlight.has(pluginId));
 
-  for (const pluginId of boundPlugins) {
-    if (shouldPollPlugin(pluginId, now)) {
-      try {
-        await pollPluginDevices(pluginId);
-        lastPollTime.set(pluginId, now);
-      } catch (error) {
-        console.error(`[StateSync] Error polling plugin ${pluginId}:`, error);
-      }
+  await Promise.all(due.map(async pluginId => {
+    pollsInFlight.add(pluginId);
+    try {
+      await pollPluginDevices(pluginId);
+      lastPollTime.set(pluginId, now);
+    } catch (error) {
+      console.error(`[StateSync] Error polling plugin ${pluginId}:`, error);
+    } finally {
+      pollsInFlight.delete(pluginId);
     }
-  }
+  }));
 }
 
 // Initial sync - poll all plugins and push states to all devices immediately
@@ -165,49 +275,41 @@ async function initialSync(): Promise<void> {
   const now = Date.now();
 
   // First, poll all plugins to get current external states
-  for (const pluginId of boundPlugins) {
-    console.log(`[StateSync] Initial poll for plugin: ${pluginId}`);
+  console.log(`[StateSync] Initial poll for plugins: ${boundPlugins.join(', ')}`);
+  await Promise.all(boundPlugins.map(async pluginId => {
     try {
-      const devicesToUpdate = getAllDevices();
-
-      for (const device of devicesToUpdate) {
-        if (!device.online) continue;
-
-        for (const button of device.config.buttons) {
-          if (!button.binding || button.binding.pluginId !== pluginId) continue;
-
-          const externalState = await pluginManager.getDeviceState(button.binding);
-          if (externalState) {
-            // Update local state to match external
-            if (button.state !== externalState.state) {
-              console.log(`[StateSync] Initial sync: "${button.name}" ${button.state} -> ${externalState.state}`);
-              button.state = externalState.state;
-            }
-            if (externalState.speedLevel !== undefined && button.speedLevel !== externalState.speedLevel) {
-              button.speedLevel = externalState.speedLevel;
-            }
-          }
+      const targets = shownTargets(pluginId);
+      const states = await fetchExternalStates(pluginId, targets.map(target => target.binding));
+
+      const updates: Map<string, ButtonUpdate[]> = new Map();
+      for (const target of targets) {
+        const externalState = states.get(target.externalDeviceId);
+        if (externalState) {
+          applyExternalState(target, externalState, updates);
         }
+      }
 
-        // Save any state updates
-        upsertDevice(device);
+      // Save any state updates
+      for (const deviceId of updates.keys()) {
+        const device = getDevice(deviceId);
+        if (device) upsertDevice(device);
       }
 
       lastPollTime.set(pluginId, now);
     } catch (error) {
       console.error(`[StateSync] Error during initial poll of ${pluginId}:`, error);
     }
-  }
+  }));
 
-  // Then push all states to all online devices
-  for (const device of devices) {
+  // Then push all states to all online devices, in parallel
+  await Promise.all(devices.map(async device => {
     if (!device.online) {
       console.log(`[StateSync] Skipping offline device for initial push: ${device.name}`);
-      continue;
+      return;
     }
 
     await pushAllStatesToDevice(device);
-  }
+  }));
 
   console.log('[StateSync] Initial sync complete');
 }
@@ -245,11 +347,23 @@ export async function syncDevice(device: Device): Promise<{ success: boolean; up
 
   const buttonUpdates: Array<{ id: number; state: boolean; speedLevel?: number }> = [];
 
-  // Poll all bound buttons from their plugins
+  // Poll all bound buttons from their plugins, each external device once
+  const byPlugin: Map<string, Map<string, ButtonBinding>> = new Map();
   for (const button of device.config.buttons) {
     if (!button.binding) continue;
+    const { pluginId, externalDeviceId } = button.binding;
+    if (!byPlugin.has(pluginId)) byPlugin.set(pluginId, new Map());
+    byPlugin.get(pluginId)!.set(externalDeviceId, button.binding);
+  }
+  const states: Map<string, Map<string, DeviceState | null>> = new Map();
+  await Promise.all([...byPlugin].map(async ([pluginId, bindings]) => {
+    states.set(pluginId, await fetchExternalStates(pluginId, [...bindings.values()]));
+  }));
 
-    const externalState = await pluginManager.getDeviceState(button.binding);
+  for (const button of device.config.buttons) {
+    if (!button.binding) continue;
+
+    const externalState = states.get(button.binding.pluginId)?.get(button.binding.externalDeviceId);
     if (externalState) {
       // Update local state to match external
       const changed = button.state !== externalState.state ||
@@ -324,44 +438,55 @@ export async function forceDevicePush(deviceId: string): Promise<void> {
   }
 }
 
-// Push state update for a specific external device to all panels that have buttons bound to it
+// Push state update for a specific external device to the panels that have
+// buttons bound to it (straight from the binding index), skipping buttons
+// that already show it (plugin events often echo an action the panel
+// itself sent)
 export async function pushExternalDeviceState(
   pluginId: string,
   externalDeviceId: string,
   newState: boolean,
   speedLevel?: number
 ): Promise<void> {
-  const devices = getAllDevices();
-
-  for (const device of devices) {
-    if (!device.online) continue;
-
-    const buttonUpdates: Array<{ id: number; state: boolean; speedLevel?: number }> = [];
-
-    for (const button of device.config.buttons) {
-      if (!button.binding) continue;
-      if (button.binding.pluginId !== pluginId) continue;
-      if (button.binding.externalDeviceId !== externalDeviceId) continue;
+  await pushExternalDeviceStates([{ pluginId, externalDeviceId, state: newState, speedLevel }]);
+}
 
-      // Update local state
-      button.state = newState;
-      if (speedLevel !== undefined) {
-        button.speedLevel = speedLevel;
-      }
+export interface ExternalStateChange {
+  pluginId: string;
+  externalDeviceId: string;
+  state: boolean;
+  speedLevel?: number;
+}
 
-      const update: { id: number; state: boolean; speedLevel?: number } = {
-        id: button.id,
-        state: newState
-      };
-      if (button.type === 'fan' && speedLevel !== undefined) {
-        update.speedLevel = speedLevel;
-      }
-      buttonUpdates.push(update);
+// Several external devices changed at once (e.g. timed jobs falling due
+// together): one multicast and at most one push per panel for all of them
+export async function pushExternalDeviceStates(changes: ExternalStateChange[]): Promise<void> {
+  const updates: Map<string, ButtonUpdate[]> = new Map();
+  const entries: MulticastEntry[] = [];
+  for (const change of changes) {
+    const target = getBindingTarget(change.pluginId, change.externalDeviceId);
+    if (!target) continue;
+    const externalState = { state: change.state, speedLevel: change.speedLevel };
+    if (applyExternalState(target, externalState, updates)) {
+      entries.push(multicastEntry(target, externalState));
+    }
+  }
+  if (updates.size === 0) return;
+  const multicast = entries.length > 0 && broadcastStates(entries);
+
+  // One external change can reach many panels; push to them in parallel
+  await Promise.all([...updates].map(async ([deviceId, buttonUpdates]) => {
+    const device = getDevice(deviceId);
+    if (!device) return;
+    if (multicastHandled(device, buttonUpdates, multicast)) {
+      upsertDevice(device);
+      return;
     }
 
-    if (buttonUpdates.length > 0) {
-      console.log(`[StateSync] Pushing ${buttonUpdates.length} button state(s) to ${device.name} for external device ${externalDeviceId}`);
-      await pushButtonStatesToDevice(device, buttonUpdates);
+    console.log(`[StateSync] Pushing ${buttonUpdates.length} button state(s) to ${device.name} for ${changes.length} external device(s)`);
+    if (await pushButtonStatesToDevice(device, buttonUpdates)) {
+      lastPushTime.set(device.id, Date.now());
     }
-  }
+    upsertDevice(device);
+  }));
 }
@@ -0,0 +1,362 @@
+import * as fs from 'fs';
+import * as path from 'path';
+
+// Fleet telemetry from the panels' heartbeats.
+//
+// Each pong (see deviceSocketService.ts) carries the panel's latest heap,
+// frame time and WiFi figures. They are folded into fixed-size rings per
+// panel at two resolutions, one-minute buckets for the last six hours and
+// fifteen-minute buckets for the last week, so a panel's history costs the
+// same after a month as after a day. Each bucket keeps one value per metric,
+// aggregated the way that metric goes bad: the worst frame time, the lowest
+// free heap and signal, the latest counter. The rings are saved to
+// DATA_DIR/telemetry.json every few minutes and on shutdown.
+//
+// getFleetTelemetry() compares panels over the last ALERT_WINDOW_MS: fleet
+// percentiles per metric, and alerts for the panel that is slower, weaker
+// or leaking compared with TELEMETRY_THRESHOLDS.
+
+// Data directory path (DATA_DIR overrides, e.g. for the fleet simulator)
+const DATA_DIR = process.env.DATA_DIR || path.join(__dirname, '../../data');
+const TELEMETRY_FILE = path.join(DATA_DIR, 'telemetry.json');
+
+const SAVE_INTERVAL = 5 * 60 * 1000;
+const ALERT_WINDOW_MS = 15 * 60 * 1000;   // "Now", for alerts and fleet percentiles
+const HOUR_MS = 60 * 60 * 1000;
+
+type Aggregate = 'max' | 'min' | 'last';
+
+// Metrics kept per bucket, in row order after the bucket start
+const METRICS: Array<{ name: string; aggregate: Aggregate }> = [
+  { name: 'frame_p50_us', aggregate: 'max' },
+  { name: 'frame_p95_us', aggregate: 'max' },
+  { name: 'render_p95_us', aggregate: 'max' },
+  { name: 'jitter_p95_us', aggregate: 'max' },
+  { name: 'rssi', aggregate: 'min' },
+  { name: 'reconnects', aggregate: 'last' },
+  { name: 'internal_free', aggregate: 'min' },
+  { name: 'internal_largest', aggregate: 'min' },
+  { name: 'psram_free', aggregate: 'min' },
+  { name: 'lvgl_frag_pct', aggregate: 'max' },
+  { name: 'uptime_s', aggregate: 'last' }
+];
+const METRIC_INDEX: Record<string, number> = Object.fromEntries(METRICS.map((m, i) => [m.name, i + 1]));
+
+interface Tier {
+  name: 'minute' | 'quarter';
+  stepMs: number;
+  size: number;
+}
+const TIERS: Tier[] = [
+  { name: 'minute', stepMs: 60 * 1000, size: 360 },          // 6 hours
+  { name: 'quarter', stepMs: 15 * 60 * 1000, size: 672 }     // 7 days
+];
+
+// [bucket start, ...one value per METRICS entry (null if not reported)]
+type Row = Array<number | null>;
+
+interface PanelRings {
+  minute: Row[];
+  quarter: Row[];
+  lastSampleAt: number;
+}
+
+export const TELEMETRY_THRESHOLDS = {
+  frameP95Us: 40000,       // Frame time p95 worse than 25 fps
+  rssiDbm: -75,               // Weaker than this is a flaky link
+  reconnectsPerHour: 3,
+  heapLeakBytes: 16384,       // Free internal heap lost over LEAK_WINDOW in one boot
+  internalLargestBytes: 12288,  // Largest internal block: TLS and WiFi buffers need more
+  lvglFragPct: 60
+};
+const LEAK_WINDOW_MS = 6 * HOUR_MS;
+
+// What a pong carries, as far as telemetry is concerned
+export interface HeartbeatTelemetry {
+  heap?: {
+    uptime_s?: number;
+    internal_free?: number;
+    internal_largest?: number;
+    psram_free?: number;
+    lvgl_frag_pct?: number;
+  };
+  perf?: {
+    frame_p50_us?: number;
+    frame_p95_us?: number;
+    render_p95_us?: number;
+    jitter_p95_us?: number;
+  };
+  wifi?: {
+    rssi?: number;
+    reconnects?: number;
+  };
+}
+
+export interface TelemetryAlert {
+  kind: 'slow_frames' | 'weak_wifi' | 'wifi_flapping' | 'heap_leak' | 'heap_fragmented' | 'lvgl_fragmented' | 'rebooted';
+  message: string;
+}
+
+const panels: Map<string, PanelRings> = new Map();
+let saveTimer: NodeJS.Timeout | null = null;
+let dirty = false;
+
+// ============================================================================
+// Ingest
+// ============================================================================
+
+function sampleValues(sample: HeartbeatTelemetry): Array<number | null> {
+  const value = (v: unknown) => (typeof v === 'number' && Number.isFinite(v) ? v : null);
+  const values: Record<string, number | null> = {
+    frame_p50_us: value(sample.perf?.frame_p50_us),
+    frame_p95_us: value(sample.perf?.frame_p95_us),
+    render_p95_us: value(sample.perf?.render_p95_us),
+    jitter_p95_us: value(sample.perf?.jitter_p95_us),
+    // The radio reports 0 while it has no link; that is not a signal level
+    rssi: sample.wifi?.rssi ? value(sample.wifi.rssi) : null,
+    reconnects: value(sample.wifi?.reconnects),
+    internal_free: value(sample.heap?.internal_free),
+    internal_largest: value(sample.heap?.internal_largest),
+    psram_free: value(sample.heap?.psram_free),
+    lvgl_frag_pct: value(sample.heap?.lvgl_frag_pct),
+    uptime_s: value(sample.heap?.uptime_s)
+  };
+  return METRICS.map(m => values[m.name]);
+}
+
+function fold(row: Row, values: Array<number | null>): void {
+  METRICS.forEach((metric, i) => {
+    const value = values[i];
+    if (value === null) return;
+    const current = row[i + 1];
+    if (current === null || metric.aggregate === 'last') {
+      row[i + 1] = value;
+    } else if (metric.aggregate === 'max') {
+      row[i + 1] = Math.max(current, value);
+    } else {
+      row[i + 1] = Math.min(current, value);
+    }
+  });
+}
+
+// Fold one heartbeat into the panel's rings
+export function ingestTelemetry(deviceId: string, sample: HeartbeatTelemetry, at: number = Date.now()): void {
+  let rings = panels.get(deviceId);
+  if (!rings) {
+    rings = { minute: [], quarter: [], lastSampleAt: 0 };
+    panels.set(deviceId, rings);
+  }
+  const values = sampleValues(sample);
+  for (const tier of TIERS) {
+    const ring = rings[tier.name];
+    const start = at - (at % tier.stepMs);
+    const last = ring[ring.length - 1];
+    if (last && last[0] === start) {
+      fold(last, values);
+      continue;
+    }
+    ring.push([start, ...values]);
+    if (ring.length > tier.size) {
+      ring.splice(0, ring.length - tier.size);
+    }
+  }
+  rings.lastSampleAt = at;
+  dirty = true;
+}
+
+export function forgetTelemetry(deviceId: string): void {
+  if (panels.delete(deviceId)) dirty = true;
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+// A panel's rings at one resolution, oldest first
+export function getDeviceTelemetry(deviceId: string, resolution: 'minute' | 'quarter' = 'minute') {
+  const tier = TIERS.find(t => t.name === resolution) ?? TIERS[0];
+  const rings = panels.get(deviceId);
+  return {
+    deviceId,
+    resolution: tier.name,
+    stepMs: tier.stepMs,
+    columns: ['start', ...METRICS.map(m => m.name)],
+    rows: rings ? rings[tier.name] : [],
+    lastSampleAt: rings?.lastSampleAt ?? null
+  };
+}
+
+// One metric over the minute buckets since `since`, aggregated its way
+function recent(rows: Row[], name: string, since: number): number | null {
+  const column = METRIC_INDEX[name];
+  const aggregate = METRICS[column - 1].aggregate;
+  let result: number | null = null;
+  for (const row of rows) {
+    if ((row[0] as number) < since) continue;
+    const value = row[column];
+    if (value === null) continue;
+    if (result === null || aggregate === 'last') result = value;
+    else if (aggregate === 'max') result = Math.max(result, value);
+    else result = Math.min(result, value);
+  }
+  return result;
+}
+
+// The value at the oldest minute bucket since `since` (for counters and trends)
+function earliest(rows: Row[], name: string, since: number): { at: number; value: number } | null {
+  const column = METRIC_INDEX[name];
+  for (const row of rows) {
+    if ((row[0] as number) < since || row[column] === null) continue;
+    return { at: row[0] as number, value: row[column] as number };
+  }
+  return null;
+}
+
+// Minute buckets since the panel's last restart (uptime only grows within a boot)
+function currentBoot(rows: Row[]): Row[] {
+  const column = METRIC_INDEX.uptime_s;
+  let first = 0;
+  for (let i = 1; i < rows.length; i++) {
+    const before = rows[i - 1][column];
+    const after = rows[i][column];
+    if (before !== null && after !== null && after < before) first = i;
+  }
+  return rows.slice(first);
+}
+
+function alertsFor(rows: Row[], now: number): TelemetryAlert[] {
+  const t = TELEMETRY_THRESHOLDS;
+  const alerts: TelemetryAlert[] = [];
+  const windowStart = now - ALERT_WINDOW_MS;
+
+  const frame = recent(rows, 'frame_p95_us', windowStart);
+  if (frame !== null && frame > t.frameP95Us) {
+    alerts.push({ kind: 'slow_frames', message: `Frame time p95 ${(frame / 1000).toFixed(1)} ms` });
+  }
+  const rssi = recent(rows, 'rssi', windowStart);
+  if (rssi !== null && rssi < t.rssiDbm) {
+    alerts.push({ kind: 'weak_wifi', message: `Signal down to ${rssi} dBm` });
+  }
+
+  const boot = currentBoot(rows);
+  if (boot.length < rows.length && (boot[0][0] as number) >= now - HOUR_MS) {
+    alerts.push({ kind: 'rebooted', message: 'Restarted within the last hour' });
+  }
+
+  const firstReconnects = earliest(boot, 'reconnects', now - HOUR_MS);
+  const reconnects = recent(boot, 'reconnects', now - HOUR_MS);
+  if (firstReconnects && reconnects !== null && reconnects - firstReconnects.value >= t.reconnectsPerHour) {
+    alerts.push({ kind: 'wifi_flapping', message: `${reconnects - firstReconnects.value} reconnects in the last hour` });
+  }
+
+  // A leak: the free heap's low point keeps sinking across one boot
+  const leakStart = earliest(boot, 'internal_free', now - LEAK_WINDOW_MS);
+  if (leakStart && now - leakStart.at >= HOUR_MS) {
+    const startLow = recent(boot.filter(row => (row[0] as number) < leakStart.at + HOUR_MS), 'internal_free', leakStart.at);
+    const nowLow = recent(boot, 'internal_free', now - HOUR_MS);
+    if (startLow !== null && nowLow !== null && startLow - nowLow >= t.heapLeakBytes) {
+      alerts.push({ kind: 'heap_leak', message: `Free internal heap down ${Math.round((startLow - nowLow) / 1024)} KB since ${new Date(leakStart.at).toISOString()}` });
+    }
+  }
+
+  const largest = recent(rows, 'internal_largest', windowStart);
+  if (largest !== null && largest < t.internalLargestBytes) {
+    alerts.push({ kind: 'heap_fragmented', message: `Largest internal block ${Math.round(largest / 1024)} KB` });
+  }
+  const lvglFrag = recent(rows, 'lvgl_frag_pct', windowStart);
+  if (lvglFrag !== null && lvglFrag > t.lvglFragPct) {
+    alerts.push({ kind: 'lvgl_fragmented', message: `LVGL heap ${lvglFrag}% fragmented` });
+  }
+  return alerts;
+}
+
+function percentile(sorted: number[], q: number): number {
+  return sorted[Math.min(sorted.length - 1, Math.floor(q * sorted.length))];
+}
+
+// Per-panel figures over the last ALERT_WINDOW_MS, fleet percentiles of
+// them, and each panel's alerts. names maps device ids to display names.
+export function getFleetTelemetry(names: Map<string, string>, now: number = Date.now()) {
+  const since = now - ALERT_WINDOW_MS;
+  const panelsOut = [];
+  const columns: Record<string, number[]> = {};
+
+  for (const [deviceId, rings] of panels) {
+    if (!names.has(deviceId)) continue;
+    const latest: Record<string, number | null> = {};
+    for (const metric of METRICS) {
+      const value = recent(rings.minute, metric.name, since);
+      latest[metric.name] = value;
+      if (value !== null) (columns[metric.name] ??= []).push(value);
+    }
+    panelsOut.push({
+      deviceId,
+      name: names.get(deviceId),
+      lastSampleAt: rings.lastSampleAt,
+      recent: latest,
+      alerts: alertsFor(rings.minute, now)
+    });
+  }
+
+  const fleet: Record<string, { panels: number; min: number; p50: number; p95: number; max: number }> = {};
+  for (const [name, values] of Object.entries(columns)) {
+    const sorted = values.sort((a, b) => a - b);
+    fleet[name] = {
+      panels: sorted.length,
+      min: sorted[0],
+      p50: percentile(sorted, 0.5),
+      p95: percentile(sorted, 0.95),
+      max: sorted[sorted.length - 1]
+    };
+  }
+
+  return { windowMs: ALERT_WINDOW_MS, thresholds: TELEMETRY_THRESHOLDS, fleet, panels: panelsOut };
+}
+
+// ============================================================================
+// Persistence
+// ============================================================================
+
+function load(): void {
+  try {
+    if (!fs.existsSync(TELEMETRY_FILE)) return;
+    const data = JSON.parse(fs.readFileSync(TELEMETRY_FILE, 'utf-8'));
+    // Rows are positional; a file written with other metrics is dropped
+    if (JSON.stringify(data.metrics) !== JSON.stringify(METRICS.map(m => m.name))) return;
+    for (const [deviceId, rings] of Object.entries(data.panels ?? {})) {
+      panels.set(deviceId, rings as PanelRings);
+    }
+    console.log(`[Telemetry] Loaded history for ${panels.size} panel(s)`);
+  } catch (error) {
+    console.error('[Telemetry] Failed to load history:', error);
+  }
+}
+
+export function flushTelemetry(): void {
+  if (!dirty) return;
+  try {
+    const tmp = `${TELEMETRY_FILE}.tmp`;
+    fs.writeFileSync(tmp, JSON.stringify({
+      metrics: METRICS.map(m => m.name),
+      panels: Object.fromEntries(panels)
+    }));
+    fs.renameSync(tmp, TELEMETRY_FILE);
+    dirty = false;
+  } catch (error) {
+    console.error('[Telemetry] Failed to save history:', error);
+  }
+}
+
+export function startTelemetry(): void {
+  if (saveTimer) return;
+  load();
+  saveTimer = setInterval(flushTelemetry, SAVE_INTERVAL);
+}
+
+export function stopTelemetry(): void {
+  if (saveTimer) {
+    clearInterval(saveTimer);
+    saveTimer = null;
+  }
+  flushTelemetry();
+}
@@ -0,0 +1,134 @@
+// Minimal MessagePack encoder/decoder for the panel sync protocol
+// Covers the subset ArduinoJson produces and consumes: nil, booleans,
+// integers, floats, strings, arrays and maps.
+
+export const MSGPACK_CONTENT_TYPE = 'application/msgpack';
+
+export function encodeMsgPack(value: unknown): Uint8Array {
+  const out: number[] = [];
+
+  const writeUint = (v: number, bytes: number) => {
+    for (let i = bytes - 1; i >= 0; i--) out.push(Math.floor(v / 2 ** (8 * i)) & 0xff);
+  };
+
+  const writeLength = (len: number, fix: number, fixMax: number, c8: number | null, c16: number, c32: number) => {
+    if (len <= fixMax) out.push(fix | len);
+    else if (c8 !== null && len <= 0xff) { out.push(c8); writeUint(len, 1); }
+    else if (len <= 0xffff) { out.push(c16); writeUint(len, 2); }
+    else { out.push(c32); writeUint(len, 4); }
+  };
+
+  const write = (v: unknown): void => {
+    if (v === null || v === undefined) {
+      out.push(0xc0);
+    } else if (typeof v === 'boolean') {
+      out.push(v ? 0xc3 : 0xc2);
+    } else if (typeof v === 'number') {
+      if (Number.isInteger(v) && v >= 0 && v <= 0xffffffff) {
+        if (v < 0x80) out.push(v);
+        else if (v <= 0xff) { out.push(0xcc); writeUint(v, 1); }
+        else if (v <= 0xffff) { out.push(0xcd); writeUint(v, 2); }
+        else { out.push(0xce); writeUint(v, 4); }
+      } else if (Number.isInteger(v) && v < 0 && v >= -0x80000000) {
+        if (v >= -32) out.push(v & 0xff);
+        else if (v >= -0x80) { out.push(0xd0); out.push(v & 0xff); }
+        else if (v >= -0x8000) { out.push(0xd1); writeUint(v & 0xffff, 2); }
+        else { out.push(0xd2); writeUint(v >>> 0, 4); }
+      } else {
+        const buf = new DataView(new ArrayBuffer(8));
+        buf.setFloat64(0, v);
+        out.push(0xcb);
+        for (let i = 0; i < 8; i++) out.push(buf.getUint8(i));
+      }
+    } else if (typeof v === 'string') {
+      const bytes = Buffer.from(v, 'utf8');
+      writeLength(bytes.length, 0xa0, 31, 0xd9, 0xda, 0xdb);
+      for (const b of bytes) out.push(b);
+    } else if (Array.isArray(v)) {
+      writeLength(v.length, 0x90, 15, null, 0xdc, 0xdd);
+      for (const item of v) write(item);
+    } else if (typeof v === 'object') {
+      const entries = Object.entries(v as Record<string, unknown>).filter(([, x]) => x !== undefined);
+      writeLength(entries.length, 0x80, 15, null, 0xde, 0xdf);
+      for (const [k, x] of entries) {
+        write(k);
+        write(x);
+      }
+    } else {
+      throw new Error(`Cannot encode ${typeof v} as MessagePack`);
+    }
+  };
+
+  write(value);
+  return Uint8Array.from(out);
+}
+
+export function decodeMsgPack(data: Uint8Array): unknown {
+  const view = new DataView(data.buffer, data.byteOffset, data.byteLength);
+  let pos = 0;
+
+  const need = (n: number) => {
+    if (pos + n > data.length) throw new Error('Truncated MessagePack data');
+  };
+  const uint = (bytes: number): number => {
+    need(bytes);
+    let v = 0;
+    for (let i = 0; i < bytes; i++) v = v * 256 + data[pos++];
+    return v;
+  };
+  const str = (len: number): string => {
+    need(len);
+    const s = Buffer.from(data.buffer, data.byteOffset + pos, len).toString('utf8');
+    pos += len;
+    return s;
+  };
+  const array = (len: number): unknown[] => {
+    const a: unknown[] = [];
+    for (let i = 0; i < len; i++) a.push(read());
+    return a;
+  };
+  const map = (len: number): Record<string, unknown> => {
+    const m: Record<string, unknown> = {};
+    for (let i = 0; i < len; i++) {
+      const k = String(read());
+      m[k] = read();
+    }
+    return m;
+  };
+
+  const read = (): unknown => {
+    const c = uint(1);
+    if (c < 0x80) return c;
+    if (c >= 0xe0) return c - 0x100;
+    if ((c & 0xf0) === 0x80) return map(c & 0x0f);
+    if ((c & 0xf0) === 0x90) return array(c & 0x0f);
+    if ((c & 0xe0) === 0xa0) return str(c & 0x1f);
+
+    switch (c) {
+      case 0xc0: return null;
+      case 0xc2: return false;
+      case 0xc3: return true;
+      case 0xcc: return uint(1);
+      case 0xcd: return uint(2);
+      case 0xce: return uint(4);
+      case 0xcf: return uint(8);
+      case 0xd0: { need(1); const v = view.getInt8(pos); pos += 1; return v; }
+      case 0xd1: { need(2); const v = view.getInt16(pos); pos += 2; return v; }
+      case 0xd2: { need(4); const v = view.getInt32(pos); pos += 4; return v; }
+      case 0xd3: { need(8); const v = Number(view.getBigInt64(pos)); pos += 8; return v; }
+      case 0xca: { need(4); const v = view.getFloat32(pos); pos += 4; return v; }
+      case 0xcb: { need(8); const v = view.getFloat64(pos); pos += 8; return v; }
+      case 0xd9: return str(uint(1));
+      case 0xda: return str(uint(2));
+      case 0xdb: return str(uint(4));
+      case 0xdc: return array(uint(2));
+      case 0xdd: return array(uint(4));
+      case 0xde: return map(uint(2));
+      case 0xdf: return map(uint(4));
+      default:
+        throw new Error(`Unsupported MessagePack type 0x${c.toString(16)}`);
+    }
+  };
+
+  return read();
+}
@@ -0,0 +1,70 @@
+// Minimal QOI decoder (https://qoiformat.org) for panel screenshots
+// Panels send QOI because flat UI frames compress far better than BMP;
+// the output is RGBA ready for Jimp.
+
+export const QOI_CONTENT_TYPE = 'image/qoi';
+
+export interface DecodedImage {
+  width: number;
+  height: number;
+  data: Buffer;  // RGBA, 4 bytes per pixel
+}
+
+export function decodeQoi(input: Uint8Array): DecodedImage {
+  if (input.length < 22 || input[0] !== 0x71 || input[1] !== 0x6f || input[2] !== 0x69 || input[3] !== 0x66) {
+    throw new Error('Not a QOI image');
+  }
+
+  const view = new DataView(input.buffer, input.byteOffset, input.byteLength);
+  const width = view.getUint32(4);
+  const height = view.getUint32(8);
+  if (width === 0 || height === 0 || width * height > 16 * 1024 * 1024) {
+    throw new Error(`Bad QOI dimensions ${width}x${height}`);
+  }
+
+  const pixels = width * height;
+  const data = Buffer.alloc(pixels * 4);
+  const index = new Uint8Array(64 * 4);
+  let r = 0, g = 0, b = 0, a = 255;
+  let run = 0;
+  let p = 14;
+  const end = input.length - 8;
+
+  for (let px = 0; px < pixels * 4; px += 4) {
+    if (run > 0) {
+      run--;
+    } else if (p < end) {
+      const b1 = input[p++];
+      if (b1 === 0xfe) {
+        r = input[p++]; g = input[p++]; b = input[p++];
+      } else if (b1 === 0xff) {
+        r = input[p++]; g = input[p++]; b = input[p++]; a = input[p++];
+      } else if ((b1 & 0xc0) === 0x00) {
+        const i = b1 * 4;
+        r = index[i]; g = index[i + 1]; b = index[i + 2]; a = index[i + 3];
+      } else if ((b1 & 0xc0) === 0x40) {
+        r = (r + ((b1 >> 4) & 0x03) - 2) & 0xff;
+        g = (g + ((b1 >> 2) & 0x03) - 2) & 0xff;
+        b = (b + (b1 & 0x03) - 2) & 0xff;
+      } else if ((b1 & 0xc0) === 0x80) {
+        const b2 = input[p++];
+        const vg = (b1 & 0x3f) - 32;
+        r = (r + vg - 8 + ((b2 >> 4) & 0x0f)) & 0xff;
+        g = (g + vg) & 0xff;
+        b = (b + vg - 8 + (b2 & 0x0f)) & 0xff;
+      } else {
+        run = b1 & 0x3f;
+      }
+
+      const i = ((r * 3 + g * 5 + b * 7 + a * 11) % 64) * 4;
+      index[i] = r; index[i + 1] = g; index[i + 2] = b; index[i + 3] = a;
+    }
+
+    data[px] = r;
+    data[px + 1] = g;
+    data[px + 2] = b;
+    data[px + 3] = a;
+  }
+
+  return { width, height, data };
+}
@@ -0,0 +1,160 @@
+#include "ambient_light.h"
+#include "config_manager.h"
+#include "brightness_scheduler.h"
+#include "event_scheduler.h"
+#include <Wire.h>
+
+// Global instance
+AmbientLight ambientLight;
+
+// BH1750: ADDR pin low / high
+static const uint8_t BH1750_ADDR_LOW = 0x23;
+static const uint8_t BH1750_ADDR_HIGH = 0x5C;
+static const uint8_t BH1750_POWER_ON = 0x01;
+static const uint8_t BH1750_CONTINUOUS_HIGH_RES = 0x10;    // 1 lx resolution, 120 ms per conversion
+
+AmbientLight::AmbientLight()
+    : wire(nullptr)
+    , address(0)
+    , job(-1)
+    , filteredLogQ8(0)
+    , primed(false)
+    , level(-1)
+    , lastReadingAt(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , submittedLux(0)
+    , submitted(false)
+{
+}
+
+void AmbientLight::begin(TwoWire& bus) {
+    wire = &bus;
+    job = eventScheduler.add("ambient", onSampleTimer, this);
+
+    if (probe(BH1750_ADDR_LOW) || probe(BH1750_ADDR_HIGH)) {
+        Serial.printf("AmbientLight: BH1750 at 0x%02X, sampling every %lu ms\n", address, SAMPLE_INTERVAL_MS);
+        // First conversion needs 120 ms
+        eventScheduler.schedule(job, 200);
+    } else {
+        Serial.println("AmbientLight: No sensor, waiting for server readings");
+    }
+}
+
+bool AmbientLight::probe(uint8_t addr) {
+    wire->beginTransmission(addr);
+    wire->write(BH1750_POWER_ON);
+    if (wire->endTransmission() != 0) return false;
+
+    wire->beginTransmission(addr);
+    wire->write(BH1750_CONTINUOUS_HIGH_RES);
+    if (wire->endTransmission() != 0) return false;
+
+    address = addr;
+    return true;
+}
+
+void AmbientLight::submitLux(uint32_t lux) {
+    portENTER_CRITICAL(&mux);
+    submittedLux = lux;
+    submitted = true;
+    portEXIT_CRITICAL(&mux);
+    eventScheduler.post(job);
+}
+
+int16_t AmbientLight::getLevel() const {
+    if (!configManager.getConfig().display.ambient.enabled) return -1;
+
+    unsigned long readingAt = lastReadingAt;
+    if (readingAt == 0 || millis() - readingAt >= STALE_MS) return -1;
+    return level;
+}
+
+uint32_t AmbientLight::getLux() const {
+    if (!primed) return 0;
+    int32_t v = filteredLogQ8;
+    uint32_t whole = 1UL << (v >> 8);
+    return whole + ((whole * (uint32_t)(v & 0xFF)) >> 8) - 1;
+}
+
+// ============================================================================
+// Sampling
+// ============================================================================
+
+void AmbientLight::onSampleTimer(void* arg) {
+    AmbientLight* self = (AmbientLight*)arg;
+    bool wasActive = self->getLevel() >= 0;
+
+    portENTER_CRITICAL(&self->mux);
+    bool fromServer = self->submitted;
+    uint32_t lux = self->submittedLux;
+    self->submitted = false;
+    portEXIT_CRITICAL(&self->mux);
+
+    if (fromServer) {
+        self->feed(lux, false);
+    } else if (self->address && self->readSensor(lux)) {
+        self->feed(lux, true);
+    }
+
+    if (self->address) {
+        eventScheduler.schedule(self->job, SAMPLE_INTERVAL_MS);
+    } else if (self->lastReadingAt) {
+        // Wake once the last server reading goes stale
+        unsigned long age = millis() - self->lastReadingAt;
+        eventScheduler.schedule(self->job, age < STALE_MS ? STALE_MS - age : 0);
+    }
+
+    // Falling back to the schedule is a change too
+    if (wasActive && self->getLevel() < 0) {
+        brightnessScheduler.onAmbientChanged();
+    }
+}
+
+bool AmbientLight::readSensor(uint32_t& lux) {
+    if (wire->requestFrom(address, (uint8_t)2) != 2) {
+        return false;
+    }
+    uint32_t raw = (uint32_t)wire->read() << 8;
+    raw |= wire->read();
+    lux = raw * 5 / 6;     // Counts / 1.2 in high-res mode
+    return true;
+}
+
+void AmbientLight::feed(uint32_t lux, bool smooth) {
+    ConfigSnapshot snapshot;
+    const AmbientConfig& config = snapshot->display.ambient;
+    int32_t sample = log2Q8(lux + 1);
+
+    if (!primed || !smooth) {
+        filteredLogQ8 = sample;
+        primed = true;
+    } else {
+        filteredLogQ8 += (sample - filteredLogQ8) >> FILTER_SHIFT;
+    }
+    lastReadingAt = millis() | 1;   // Never 0 once read
+
+    // 1 lux (log 0) maps to minBrightness, luxAtMax and up to maxBrightness
+    int32_t top = log2Q8((uint32_t)config.luxAtMax + 1);
+    int32_t x = filteredLogQ8 < 0 ? 0 : (filteredLogQ8 > top ? top : filteredLogQ8);
+    int32_t span = (int32_t)config.maxBrightness - config.minBrightness;
+    int16_t target = top > 0 ? config.minBrightness + span * x / top : config.maxBrightness;
+
+    int16_t current = level;
+    int16_t moved = target > current ? target - current : current - target;
+    if (current < 0 || moved >= HYSTERESIS_PCT ||
+        (target != current && (target == config.minBrightness || target == config.maxBrightness))) {
+        level = target;
+        if (config.enabled) {
+            brightnessScheduler.onAmbientChanged();
+        }
+    }
+}
+
+int32_t AmbientLight::log2Q8(uint32_t x) {
+    // Integer part from the leading-zero count, fraction from the next
+    // 8 mantissa bits (linear between powers of two, within 0.09 of log2)
+    if (x == 0) return 0;
+    int32_t n = 31 - __builtin_clz(x);
+    uint32_t frac = n >= 8 ? (x >> (n - 8)) & 0xFF : (x << (8 - n)) & 0xFF;
+    return (n << 8) | (int32_t)frac;
+}
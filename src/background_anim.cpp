@@ -0,0 +1,500 @@
+#include "background_anim.h"
+#include "ui_manager.h"
+#include "lvgl_task.h"
+#include "psram_budget.h"
+#include "stream_inflater.h"
+#include "panel_log.h"
+#include <esp32s3/rom/tjpgd.h>
+#include <new>
+
+// Global instance
+BackgroundAnimation backgroundAnim;
+
+static const char* stateName(BackgroundAnimation::State state) {
+    switch (state) {
+        case BackgroundAnimation::State::IDLE:      return "idle";
+        case BackgroundAnimation::State::RECEIVING: return "receiving";
+        case BackgroundAnimation::State::DECODING:  return "decoding";
+        case BackgroundAnimation::State::DONE:      return "done";
+        case BackgroundAnimation::State::FAILED:    return "failed";
+    }
+    return "unknown";
+}
+
+BackgroundAnimation::BackgroundAnimation()
+    : anim(nullptr)
+    , timer(nullptr)
+    , framesShown(0)
+    , framesSkipped(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , state(State::IDLE)
+    , error(nullptr)
+    , staging(nullptr)
+    , size(0)
+    , received(0)
+    , decodeMs(0)
+{
+    memset(images, 0, sizeof(images));
+}
+
+// ============================================================================
+// Upload (AsyncTCP task)
+// ============================================================================
+
+bool BackgroundAnimation::beginUpload(size_t uploadSize, const char*& reason) {
+    if (isBusy()) {
+        reason = "background upload already running";
+        return false;
+    }
+    if (uploadSize < sizeof(BackgroundHeader) || uploadSize > MAX_UPLOAD_BYTES) {
+        reason = "upload size out of range";
+        return false;
+    }
+
+    staging = (uint8_t*)psramBudget.alloc(PSRAM_BACKGROUND, uploadSize);
+    if (!staging) {
+        reason = "not enough PSRAM to stage the upload";
+        return false;
+    }
+
+    size = uploadSize;
+    received = 0;
+    error = nullptr;
+    decodeMs = 0;
+    state = State::RECEIVING;
+    return true;
+}
+
+void BackgroundAnimation::feed(const uint8_t* data, size_t len) {
+    portENTER_CRITICAL(&mux);
+    if (staging && state == State::RECEIVING) {
+        size_t at = received;
+        if (len > size - at) len = size - at;
+        memcpy(staging + at, data, len);
+        received = at + len;
+    }
+    portEXIT_CRITICAL(&mux);
+}
+
+void BackgroundAnimation::abortUpload() {
+    if (state != State::RECEIVING) return;
+    fail("upload aborted");
+}
+
+void BackgroundAnimation::freeStaging() {
+    portENTER_CRITICAL(&mux);
+    uint8_t* buffer = staging;
+    staging = nullptr;
+    portEXIT_CRITICAL(&mux);
+    psramBudget.release(PSRAM_BACKGROUND, buffer, size);
+}
+
+void BackgroundAnimation::fail(const char* reason) {
+    freeStaging();
+    error = reason;
+    state = State::FAILED;
+    LOG_W("Background: Upload failed, %s", reason);
+}
+
+// ============================================================================
+// Decode (heavy lane)
+// ============================================================================
+
+const char* BackgroundAnimation::validate(const BackgroundHeader& header, uint32_t* offsets) const {
+    if (header.magic != BACKGROUND_MAGIC || header.version != BACKGROUND_VERSION) {
+        return "not a background animation";
+    }
+    if (header.frameCount == 0 || header.frameCount > MAX_FRAMES) {
+        return "frame count out of range";
+    }
+    if (header.width == 0 || header.height == 0 ||
+        header.width > lv_disp_get_hor_res(NULL) || header.height > lv_disp_get_ver_res(NULL)) {
+        return "larger than the screen";
+    }
+
+    size_t at = sizeof(BackgroundHeader);
+    for (uint16_t i = 0; i < header.frameCount; i++) {
+        uint32_t length;
+        if (size - at < sizeof(length)) return "truncated frame table";
+        memcpy(&length, staging + at, sizeof(length));
+        at += sizeof(length);
+        if (length == 0 || length > size - at) return "truncated frame";
+        offsets[i] = at;
+        at += length;
+    }
+    return nullptr;
+}
+
+bool BackgroundAnimation::decodeFrame(uint32_t offset, uint16_t* dst, size_t bytes) {
+    StreamInflater inflater;
+    if (!inflater.begin(true)) return false;
+    const uint8_t* in = staging + offset;
+    size_t inLeft = size - offset;
+    return inflater.read(in, inLeft, false, (uint8_t*)dst, bytes) == (int)bytes;
+}
+
+// The runs that turn from into to, written to scratch; frame.size is 0 if
+// the two are the same
+bool BackgroundAnimation::encodeRuns(const uint16_t* from, const uint16_t* to, uint32_t pixels, uint16_t width,
+                                     Frame& frame, uint8_t* scratch, size_t scratchSize) {
+    size_t at = 0;
+    uint32_t first = 0;
+    uint32_t last = 0;
+    uint32_t i = 0;
+    while (i < pixels) {
+        if (from[i] == to[i]) {
+            i++;
+            continue;
+        }
+
+        // Extend over short unchanged gaps, a run header costs as much as
+        // four pixels
+        uint32_t end = i + 1;
+        for (uint32_t j = end; j < pixels && j - end < MERGE_GAP; j++) {
+            if (from[j] != to[j]) end = j + 1;
+        }
+
+        Run run = { i, end - i };
+        size_t bytes = (run.count * 2 + 3) & ~3;
+        if (at + sizeof(run) + bytes > scratchSize) return false;
+        memcpy(scratch + at, &run, sizeof(run));
+        memcpy(scratch + at + sizeof(run), to + i, run.count * 2);
+        if (at == 0) first = i;
+        at += sizeof(run) + bytes;
+        last = end - 1;
+        i = end;
+    }
+
+    frame.size = at;
+    frame.firstRow = first / width;
+    frame.lastRow = last / width;
+    return true;
+}
+
+bool BackgroundAnimation::install() {
+    if (!isStaged()) return false;
+    state = State::DECODING;
+    unsigned long start = millis();
+
+    Animation* next = nullptr;
+    bool jpeg = size >= 2 && staging[0] == 0xFF && staging[1] == 0xD8;
+    const char* reason = jpeg ? decodeJpeg(next) : decodeFrames(next);
+    if (reason) {
+        freeAnimation(next);
+        fail(reason);
+        return false;
+    }
+    freeStaging();
+
+    next->dsc.header.cf = LV_IMG_CF_TRUE_COLOR;
+    next->dsc.header.always_zero = 0;
+    next->dsc.header.reserved = 0;
+    uint16_t width = next->dsc.header.w;
+    uint16_t height = next->dsc.header.h;
+    uint16_t frameCount = next->frameCount;
+    size_t bytes = next->bytes;
+    show(next);
+
+    decodeMs = millis() - start;
+    state = State::DONE;
+    LOG_I("Background: %s of %u frame(s), %ux%u, decoded in %u ms, %u KB cached",
+          jpeg ? "JPEG" : "animation", frameCount, width, height, decodeMs, (unsigned)(bytes / 1024));
+    return true;
+}
+
+// A new animation with count frames (none changing anything yet) and a
+// width x height image to show, or nullptr without memory
+BackgroundAnimation::Animation* BackgroundAnimation::newAnimation(uint16_t count, uint16_t width, uint16_t height) {
+    Animation* a = new (std::nothrow) Animation();
+    if (!a) return nullptr;
+    size_t frameBytes = (size_t)width * height * 2;
+    a->frames = (Frame*)calloc(count, sizeof(Frame));
+    a->frameCount = count;
+    a->bytes = frameBytes;
+    a->dsc.header.w = width;
+    a->dsc.header.h = height;
+    a->dsc.data_size = frameBytes;
+    a->dsc.data = (const uint8_t*)psramBudget.alloc(PSRAM_BACKGROUND, frameBytes);
+    return a;
+}
+
+const char* BackgroundAnimation::decodeFrames(Animation*& next) {
+    BackgroundHeader header;
+    memcpy(&header, staging, sizeof(header));
+    uint32_t* offsets = (uint32_t*)malloc(sizeof(uint32_t) * MAX_FRAMES);
+    if (!offsets) return "out of memory";
+    const char* reason = validate(header, offsets);
+    if (reason) {
+        free(offsets);
+        return reason;
+    }
+
+    uint32_t pixels = (uint32_t)header.width * header.height;
+    size_t frameBytes = pixels * 2;
+    // Worst case: a one-pixel run after every gap
+    size_t scratchSize = frameBytes + (pixels / (MERGE_GAP + 1) + 1) * (sizeof(Run) + 4);
+
+    next = newAnimation(header.frameCount, header.width, header.height);
+    if (!next) {
+        free(offsets);
+        return "out of memory";
+    }
+    next->periodMs = max((uint32_t)header.frameMs, (uint32_t)(1000 / MAX_FPS));
+    uint16_t* shown = (uint16_t*)next->dsc.data;
+    uint16_t* work = (uint16_t*)psramBudget.alloc(PSRAM_BACKGROUND, frameBytes);
+    uint8_t* scratch = (uint8_t*)psramBudget.alloc(PSRAM_BACKGROUND, scratchSize);
+
+    if (!next->frames || !shown || !work || !scratch) {
+        reason = "not enough PSRAM to decode";
+    } else if (!decodeFrame(offsets[0], shown, frameBytes)) {
+        reason = "corrupt frame";
+    }
+
+    // Each frame against the one before; with more than one, the last step
+    // decodes the first frame again and leads back to it
+    for (uint16_t i = 1; !reason && header.frameCount > 1 && i <= header.frameCount; i++) {
+        uint16_t index = i % header.frameCount;
+        Frame& frame = next->frames[index];
+        if (!decodeFrame(offsets[index], work, frameBytes)) {
+            reason = "corrupt frame";
+        } else if (!encodeRuns(shown, work, pixels, header.width, frame, scratch, scratchSize)) {
+            reason = "frame runs overflow";
+        } else if (frame.size) {
+            next->bytes += frame.size;
+            frame.data = next->bytes <= MAX_CACHE_BYTES
+                             ? (uint8_t*)psramBudget.alloc(PSRAM_BACKGROUND, frame.size)
+                             : nullptr;
+            if (!frame.data) {
+                frame.size = 0;
+                reason = next->bytes > MAX_CACHE_BYTES ? "too large once decoded" : "not enough PSRAM for the frames";
+            } else {
+                memcpy(frame.data, scratch, frame.size);
+            }
+        }
+        uint16_t* swap = shown;
+        shown = work;
+        work = swap;
+    }
+    // Whichever buffer holds the first frame is the one shown
+    next->dsc.data = (const uint8_t*)shown;
+
+    psramBudget.release(PSRAM_BACKGROUND, work, frameBytes);
+    psramBudget.release(PSRAM_BACKGROUND, scratch, scratchSize);
+    free(offsets);
+    return reason;
+}
+
+// ============================================================================
+// JPEG (heavy lane)
+// ============================================================================
+
+// tjpgd runs from the S3's ROM: no flash cache misses and nothing to link.
+// Output comes in MCU blocks of RGB888, converted into the image as they arrive.
+struct JpegJob {
+    const uint8_t* data;
+    size_t size;
+    size_t at;
+    uint16_t* out;
+    uint16_t width;
+    uint16_t height;
+};
+
+static UINT jpegInput(JDEC* jd, BYTE* buf, UINT len) {
+    JpegJob* job = (JpegJob*)jd->device;
+    size_t left = job->size - job->at;
+    if (len > left) len = left;
+    if (buf) memcpy(buf, job->data + job->at, len);
+    job->at += len;
+    return len;
+}
+
+static UINT jpegOutput(JDEC* jd, void* bitmap, JRECT* rect) {
+    JpegJob* job = (JpegJob*)jd->device;
+    const uint8_t* rgb = (const uint8_t*)bitmap;
+    for (uint16_t y = rect->top; y <= rect->bottom; y++) {
+        uint16_t* row = job->out + (uint32_t)y * job->width;
+        for (uint16_t x = rect->left; x <= rect->right; x++, rgb += 3) {
+            if (x < job->width && y < job->height) {
+                row[x] = lv_color_make(rgb[0], rgb[1], rgb[2]).full;
+            }
+        }
+    }
+    return 1;
+}
+
+// A still image: decoded at the largest of tjpgd's 1/1 to 1/8 scales that
+// fits the screen, straight into the shown image
+const char* BackgroundAnimation::decodeJpeg(Animation*& next) {
+    uint8_t* work = (uint8_t*)malloc(JPEG_WORK_SIZE);
+    if (!work) return "out of memory";
+
+    JpegJob job = { staging, size, 0, nullptr, 0, 0 };
+    JDEC jd;
+    const char* reason = nullptr;
+    if (jd_prepare(&jd, jpegInput, work, JPEG_WORK_SIZE, &job) != JDR_OK) {
+        reason = "unsupported JPEG (baseline only)";
+    } else {
+        uint8_t scale = 0;
+        while (scale < 3 && (((jd.width >> scale) > lv_disp_get_hor_res(NULL)) ||
+                             ((jd.height >> scale) > lv_disp_get_ver_res(NULL)))) {
+            scale++;
+        }
+        job.width = jd.width >> scale;
+        job.height = jd.height >> scale;
+        if (job.width > lv_disp_get_hor_res(NULL) || job.height > lv_disp_get_ver_res(NULL) ||
+            job.width == 0 || job.height == 0) {
+            reason = "larger than the screen at 1/8 scale";
+        } else {
+            next = newAnimation(1, job.width, job.height);
+            if (!next || !next->frames || !next->dsc.data) {
+                reason = "not enough PSRAM for the image";
+            } else {
+                job.out = (uint16_t*)next->dsc.data;
+                if (jd_decomp(&jd, jpegOutput, scale) != JDR_OK) {
+                    reason = "corrupt JPEG";
+                }
+            }
+        }
+    }
+    free(work);
+    return reason;
+}
+
+void BackgroundAnimation::freeAnimation(Animation* a) {
+    if (!a) return;
+    if (a->frames) {
+        for (uint16_t i = 0; i < a->frameCount; i++) {
+            psramBudget.release(PSRAM_BACKGROUND, a->frames[i].data, a->frames[i].size);
+        }
+        free(a->frames);
+    }
+    psramBudget.release(PSRAM_BACKGROUND, (void*)a->dsc.data, a->dsc.data_size);
+    delete a;
+}
+
+// ============================================================================
+// Showing (LVGL lock)
+// ============================================================================
+
+void BackgroundAnimation::remove() {
+    show(nullptr);
+}
+
+// Swaps next in on the images already shown; the first animation, or
+// removing the last, rebuilds the UI to add or drop the images and turn
+// card tiles off or on
+void BackgroundAnimation::show(Animation* next) {
+    Animation* old;
+    {
+        LVGLLock lock;
+        old = anim;
+        anim = next;
+        for (uint8_t i = 0; i < MAX_IMAGES; i++) {
+            if (!images[i]) continue;
+            if (next) {
+                lv_img_set_src(images[i], &next->dsc);
+                lv_obj_center(images[i]);
+            } else {
+                lv_obj_del(images[i]);  // Clears the slot
+            }
+        }
+        if (next && next->frameCount > 1) {
+            if (!timer) {
+                timer = lv_timer_create(onFrameTimer, next->periodMs, this);
+            }
+            lv_timer_set_period(timer, next->periodMs);
+            lv_timer_resume(timer);
+        } else if (timer) {
+            lv_timer_pause(timer);
+        }
+        if (old) {
+            // LVGL's image cache knows descriptors by address
+            lv_img_cache_invalidate_src(&old->dsc);
+        }
+    }
+
+    if ((old == nullptr) != (next == nullptr)) {
+        uiManager.requestRebuild();
+    }
+    freeAnimation(old);
+}
+
+void BackgroundAnimation::attach(lv_obj_t* screen) {
+    if (!anim) return;
+    for (uint8_t i = 0; i < MAX_IMAGES; i++) {
+        if (images[i]) continue;
+        lv_obj_t* img = lv_img_create(screen);
+        lv_img_set_src(img, &anim->dsc);
+        lv_obj_center(img);
+        lv_obj_move_background(img);
+        lv_obj_add_event_cb(img, onImageDeleted, LV_EVENT_DELETE, this);
+        images[i] = img;
+        return;
+    }
+    LOG_W("Background: No image slot left, screen built without it");
+}
+
+void BackgroundAnimation::onImageDeleted(lv_event_t* e) {
+    BackgroundAnimation* self = (BackgroundAnimation*)lv_event_get_user_data(e);
+    lv_obj_t* img = lv_event_get_target(e);
+    for (uint8_t i = 0; i < MAX_IMAGES; i++) {
+        if (self->images[i] == img) self->images[i] = nullptr;
+    }
+}
+
+void BackgroundAnimation::onFrameTimer(lv_timer_t* timer) {
+    ((BackgroundAnimation*)timer->user_data)->step();
+}
+
+void BackgroundAnimation::step() {
+    Animation* a = anim;
+    if (!a || a->frameCount < 2) return;
+    if (lvglTask.isDarkIdle() || lvglTask.isUpdateMode()) {
+        framesSkipped++;
+        return;
+    }
+
+    uint16_t index = (a->current + 1 == a->frameCount) ? 0 : a->current + 1;
+    const Frame& frame = a->frames[index];
+    a->current = index;
+    framesShown++;
+    if (!frame.data) return;
+
+    uint16_t* pixels = (uint16_t*)a->dsc.data;
+    const uint8_t* at = frame.data;
+    const uint8_t* end = frame.data + frame.size;
+    while (at < end) {
+        Run run;
+        memcpy(&run, at, sizeof(run));
+        at += sizeof(run);
+        memcpy(pixels + run.offset, at, run.count * 2);
+        at += (run.count * 2 + 3) & ~3;
+    }
+
+    // Only the rows that changed are redrawn, and only on the loaded screen
+    lv_obj_t* active = lv_scr_act();
+    for (uint8_t i = 0; i < MAX_IMAGES; i++) {
+        if (!images[i] || lv_obj_get_screen(images[i]) != active) continue;
+        lv_area_t area;
+        lv_obj_get_coords(images[i], &area);
+        area.y2 = area.y1 + frame.lastRow;
+        area.y1 += frame.firstRow;
+        lv_obj_invalidate_area(images[i], &area);
+    }
+}
+
+void BackgroundAnimation::writeJson(Print& out) const {
+    out.printf("{\"state\":\"%s\",\"received\":%u,\"size\":%u,\"decode_ms\":%u",
+               stateName(state), (unsigned)received, (unsigned)size, decodeMs);
+    if (error) {
+        out.printf(",\"error\":\"%s\"", error);
+    }
+    // The animation is freed under the lock
+    LVGLLock lock;
+    Animation* a = anim;
+    if (a) {
+        out.printf(",\"animation\":{\"width\":%u,\"height\":%u,\"frames\":%u,\"period_ms\":%u,\"bytes\":%u}",
+                   a->dsc.header.w, a->dsc.header.h, a->frameCount, a->periodMs, (unsigned)a->bytes);
+    }
+    out.printf(",\"frames_shown\":%u,\"frames_skipped\":%u}", framesShown, framesSkipped);
+}
@@ -0,0 +1,154 @@
+#include "backlight.h"
+#include "event_scheduler.h"
+#include "lvgl_task.h"
+#include <driver/ledc.h>
+#include <math.h>
+
+// Global instance
+Backlight backlight;
+
+static const ledc_mode_t BACKLIGHT_SPEED_MODE = LEDC_LOW_SPEED_MODE;   // The S3 has no high-speed mode
+static const ledc_timer_t BACKLIGHT_TIMER = LEDC_TIMER_0;
+static const float BACKLIGHT_GAMMA = 2.2f;
+
+Backlight::Backlight()
+    : lock(nullptr)
+    , channel(0)
+    , ready(false)
+    , level(0)
+    , pendingLevel(0)
+    , pendingFadeMs(0)
+    , pending(false)
+    , fadeEndsAt(0)
+    , fadeJob(-1)
+{
+    memset(gammaDuty, 0, sizeof(gammaDuty));
+}
+
+void Backlight::begin(uint8_t pin, uint8_t ch) {
+    channel = ch;
+
+    gammaDuty[0] = 0;
+    for (int i = 1; i <= 100; i++) {
+        float perceived = powf(i / 100.0f, BACKLIGHT_GAMMA);
+        gammaDuty[i] = MIN_LIT_DUTY + (uint32_t)lroundf(perceived * (MAX_DUTY - MIN_LIT_DUTY));
+    }
+
+    ledc_timer_config_t timer = {};
+    timer.speed_mode = BACKLIGHT_SPEED_MODE;
+    timer.duty_resolution = (ledc_timer_bit_t)RESOLUTION_BITS;
+    timer.timer_num = BACKLIGHT_TIMER;
+    timer.freq_hz = PWM_FREQ_HZ;
+    timer.clk_cfg = LEDC_AUTO_CLK;
+
+    ledc_channel_config_t cfg = {};
+    cfg.gpio_num = pin;
+    cfg.speed_mode = BACKLIGHT_SPEED_MODE;
+    cfg.channel = (ledc_channel_t)channel;
+    cfg.intr_type = LEDC_INTR_DISABLE;
+    cfg.timer_sel = BACKLIGHT_TIMER;
+    cfg.duty = 0;
+    cfg.hpoint = 0;
+
+    if (ledc_timer_config(&timer) != ESP_OK || ledc_channel_config(&cfg) != ESP_OK) {
+        Serial.println("Backlight: LEDC setup failed");
+        return;
+    }
+    if (ledc_fade_func_install(0) != ESP_OK) {
+        Serial.println("Backlight: Fade engine unavailable");
+        return;
+    }
+
+    lock = xSemaphoreCreateMutex();
+    ready = lock != nullptr;
+    fadeJob = eventScheduler.add("backlight_fade", onFadeDone, this);
+    Serial.printf("Backlight: GPIO %d, %lu Hz, %u-bit, gamma %.1f\n",
+                  pin, PWM_FREQ_HZ, RESOLUTION_BITS, BACKLIGHT_GAMMA);
+}
+
+uint32_t Backlight::getDuty() const {
+    return ready ? ledc_get_duty(BACKLIGHT_SPEED_MODE, (ledc_channel_t)channel) : 0;
+}
+
+bool Backlight::fading(unsigned long now) const {
+    return (long)(fadeEndsAt - now) > 0;
+}
+
+// ============================================================================
+// Targets
+// ============================================================================
+
+void Backlight::set(uint8_t brightness, uint32_t fadeMs) {
+    if (!ready) return;
+    if (brightness > 100) brightness = 100;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    unsigned long now = millis();
+    if (fading(now)) {
+        // Latest wins; the job starts it when the running fade ends
+        pendingLevel = brightness;
+        pendingFadeMs = fadeMs;
+        pending = brightness != level;
+        if (pending) {
+            eventScheduler.schedule(fadeJob, fadeEndsAt - now);
+        }
+    } else if (brightness != level) {
+        pending = false;
+        apply(brightness, fadeMs);
+    }
+    xSemaphoreGive(lock);
+}
+
+void Backlight::wake(uint8_t brightness) {
+    // Only ever raises the light; the scheduler decides everything else
+    if (!ready || brightness == 0 || level >= brightness) return;
+    set(brightness, WAKE_FADE_MS);
+}
+
+void Backlight::onFadeDone(void* arg) {
+    Backlight* self = (Backlight*)arg;
+
+    xSemaphoreTake(self->lock, portMAX_DELAY);
+    unsigned long now = millis();
+    if (self->pending) {
+        if (self->fading(now)) {
+            eventScheduler.schedule(self->fadeJob, self->fadeEndsAt - now);
+        } else {
+            self->pending = false;
+            self->apply(self->pendingLevel, self->pendingFadeMs);
+        }
+    } else if (self->level == 0 && !self->fading(now)) {
+        // Faded all the way out
+        lvglTask.setDarkIdle(true);
+    }
+    xSemaphoreGive(self->lock);
+}
+
+void Backlight::apply(uint8_t brightness, uint32_t fadeMs) {
+    ledc_channel_t ch = (ledc_channel_t)channel;
+    uint32_t duty = gammaDuty[brightness];
+    level = brightness;
+
+    // Scanout restarts before the light comes up; dark idle starts once it's out
+    if (brightness > 0) {
+        lvglTask.setDarkIdle(false);
+    }
+
+    if (fadeMs == 0) {
+        ledc_set_duty(BACKLIGHT_SPEED_MODE, ch, duty);
+        ledc_update_duty(BACKLIGHT_SPEED_MODE, ch);
+        fadeEndsAt = millis();
+        if (brightness == 0) {
+            lvglTask.setDarkIdle(true);
+        }
+        return;
+    }
+
+    ledc_set_fade_with_time(BACKLIGHT_SPEED_MODE, ch, duty, fadeMs);
+    ledc_fade_start(BACKLIGHT_SPEED_MODE, ch, LEDC_FADE_NO_WAIT);
+    // A tick of slack so the next fade never waits on this one's end
+    fadeEndsAt = millis() + fadeMs + 2;
+    if (brightness == 0) {
+        eventScheduler.schedule(fadeJob, fadeMs + 2);
+    }
+}
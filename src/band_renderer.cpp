@@ -0,0 +1,137 @@
+#include "band_renderer.h"
+#include <esp_timer.h>
+
+// Global instance
+BandRenderer bandRenderer;
+
+BandRenderer::BandRenderer()
+    : jobState(JOB_IDLE)
+    , jobFn(nullptr)
+    , jobArg(nullptr)
+    , jobFirst(0)
+    , jobEnd(0)
+    , worker(nullptr)
+    , jobDone(nullptr)
+    , splits(0)
+    , takenBack(0)
+    , small(0)
+    , workerUs(0)
+{
+}
+
+void BandRenderer::begin() {
+    jobDone = xSemaphoreCreateBinary();
+    if (!jobDone) {
+        Serial.println("BandRenderer: Failed to create semaphore, rendering on one core");
+        return;
+    }
+    if (xTaskCreatePinnedToCore(workerTask, "BandRender", WORKER_STACK_SIZE, this,
+                                WORKER_PRIORITY, &worker, WORKER_CORE) != pdPASS) {
+        worker = nullptr;
+        vSemaphoreDelete(jobDone);
+        jobDone = nullptr;
+        Serial.println("BandRenderer: Failed to create worker, rendering on one core");
+        return;
+    }
+    Serial.println("BandRenderer: Large blends split across both cores");
+}
+
+void BandRenderer::split(uint32_t rows, RowFn fn, void* arg) {
+    if (!worker || rows < 2) {
+        fn(arg, 0, rows);
+        return;
+    }
+
+    uint32_t mid = rows / 2;
+    jobFn = fn;
+    jobArg = arg;
+    jobFirst = mid;
+    jobEnd = rows;
+    jobState.store(JOB_POSTED);
+    xTaskNotifyGive(worker);
+
+    fn(arg, 0, mid);
+
+    // Not started yet: do it here rather than wait for core 0
+    uint8_t expected = JOB_POSTED;
+    if (jobState.compare_exchange_strong(expected, JOB_IDLE)) {
+        fn(arg, mid, rows);
+        takenBack++;
+        return;
+    }
+    xSemaphoreTake(jobDone, portMAX_DELAY);
+    jobState.store(JOB_IDLE);
+    splits++;
+}
+
+void BandRenderer::workerTask(void* arg) {
+    BandRenderer* self = (BandRenderer*)arg;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // A wakeup for a band split() already took back finds nothing posted
+        uint8_t expected = JOB_POSTED;
+        if (!self->jobState.compare_exchange_strong(expected, JOB_RUNNING)) continue;
+
+        int64_t start = esp_timer_get_time();
+        self->jobFn(self->jobArg, self->jobFirst, self->jobEnd);
+        self->workerUs += (uint32_t)(esp_timer_get_time() - start);
+        xSemaphoreGive(self->jobDone);
+    }
+}
+
+// ============================================================================
+// LVGL blend
+// ============================================================================
+
+namespace {
+
+struct BlendJob {
+    lv_draw_sw_ctx_t ctx;
+    const lv_draw_sw_blend_dsc_t* dsc;
+    lv_area_t area;             // Blend area within the clip area
+};
+
+}  // namespace
+
+void BandRenderer::initDrawCtx(lv_disp_drv_t* drv, lv_draw_ctx_t* ctx) {
+    lv_draw_sw_init_ctx(drv, ctx);
+    ((lv_draw_sw_ctx_t*)ctx)->blend = blend;
+}
+
+void BandRenderer::blend(lv_draw_ctx_t* ctx, const lv_draw_sw_blend_dsc_t* dsc) {
+    lv_area_t area;
+    if (!_lv_area_intersect(&area, dsc->blend_area, ctx->clip_area)) return;
+
+    if (lv_area_get_size(&area) < MIN_SPLIT_PX) {
+        bandRenderer.small++;
+        lv_draw_sw_blend_basic(ctx, dsc);
+        return;
+    }
+
+    BlendJob job;
+    job.ctx = *(lv_draw_sw_ctx_t*)ctx;
+    job.dsc = dsc;
+    job.area = area;
+    bandRenderer.split(lv_area_get_height(&area), blendRows, &job);
+}
+
+void BandRenderer::blendRows(void* arg, uint32_t first, uint32_t end) {
+    const BlendJob* job = (const BlendJob*)arg;
+
+    // Same context narrowed to the band: the basic blend clips the area and
+    // offsets the source and mask rows to match
+    lv_draw_sw_ctx_t ctx = job->ctx;
+    lv_area_t clip = job->area;
+    clip.y1 = job->area.y1 + first;
+    clip.y2 = job->area.y1 + end - 1;
+    ctx.base_draw.clip_area = &clip;
+    lv_draw_sw_blend_basic(&ctx.base_draw, job->dsc);
+}
+
+void BandRenderer::writeJson(Print& out) const {
+    out.printf("{\"enabled\":%s,\"min_split_px\":%u,\"splits\":%u,\"taken_back\":%u,"
+               "\"small\":%u,\"worker_us\":%u}",
+               worker ? "true" : "false", (unsigned)MIN_SPLIT_PX, splits, takenBack,
+               small, workerUs);
+}
@@ -0,0 +1,147 @@
+#include "boot_profile.h"
+#include <esp_timer.h>
+#include <esp_system.h>
+#include <esp_attr.h>
+
+// Global instance
+BootProfile bootProfile;
+
+static const char* const STAGE_NAMES[BOOT_STAGE_COUNT] = {
+    "startup",
+    "early",
+    "config",
+    "display",
+    "lvgl",
+    "touch",
+    "theme",
+    "ui_begin",
+    "create_ui",
+    "first_render",
+    "lvgl_task",
+    "network",
+    "services",
+    "web_server",
+    "wifi_connect",
+    "mdns",
+    "config_fetch"
+};
+
+static const char* const RESET_REASONS[] = {
+    "unknown", "poweron", "ext", "sw", "panic", "int_wdt", "task_wdt",
+    "wdt", "deepsleep", "brownout", "sdio"
+};
+
+// Ring of boot records in RTC slow memory; the magic tells it apart from
+// what a power cut leaves there
+struct RtcBootHistory {
+    uint32_t magic;
+    uint32_t bootCount;
+    uint8_t head;               // Slot of the current boot
+    uint8_t count;
+    BootRecord boots[BootProfile::HISTORY_SIZE];
+};
+
+static const uint32_t RTC_BOOT_MAGIC = 0x424f4f54;     // "BOOT"
+static RTC_NOINIT_ATTR RtcBootHistory rtcBoots;
+
+BootProfile::BootProfile()
+    : current(nullptr)
+    , lastMarkUs(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+{
+}
+
+void BootProfile::begin() {
+    if (rtcBoots.magic != RTC_BOOT_MAGIC || rtcBoots.head >= HISTORY_SIZE ||
+        rtcBoots.count > HISTORY_SIZE) {
+        memset(&rtcBoots, 0, sizeof(rtcBoots));
+        rtcBoots.magic = RTC_BOOT_MAGIC;
+        rtcBoots.head = HISTORY_SIZE - 1;
+    }
+
+    rtcBoots.head = (rtcBoots.head + 1) % HISTORY_SIZE;
+    if (rtcBoots.count < HISTORY_SIZE) {
+        rtcBoots.count++;
+    }
+    current = &rtcBoots.boots[rtcBoots.head];
+    memset(current, 0, sizeof(*current));
+    current->seq = ++rtcBoots.bootCount;
+    current->resetReason = (uint8_t)esp_reset_reason();
+
+    record(BOOT_STAGE_STARTUP, 0);
+    lastMarkUs = esp_timer_get_time();
+}
+
+void BootProfile::mark(BootStage stage) {
+    int64_t start = lastMarkUs;
+    lastMarkUs = esp_timer_get_time();
+    record(stage, start);
+}
+
+void BootProfile::record(BootStage stage, int64_t startUs) {
+    if (!current || stage >= BOOT_STAGE_COUNT) return;
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&mux);
+    current->startUs[stage] = (uint32_t)startUs;
+    current->durationUs[stage] = (uint32_t)(now - startUs);
+    current->done |= 1UL << stage;
+    portEXIT_CRITICAL(&mux);
+}
+
+const char* BootProfile::stageName(BootStage stage) {
+    return stage < BOOT_STAGE_COUNT ? STAGE_NAMES[stage] : "unknown";
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+void BootProfile::printSummary() const {
+    if (!current) return;
+
+    portENTER_CRITICAL(&mux);
+    BootRecord boot = *current;
+    portEXIT_CRITICAL(&mux);
+
+    Serial.printf("BootProfile: Boot %u, stages in ms:", boot.seq);
+    for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+        if (boot.done & (1UL << i)) {
+            Serial.printf(" %s %u.%u", STAGE_NAMES[i],
+                          boot.durationUs[i] / 1000, (boot.durationUs[i] % 1000) / 100);
+        }
+    }
+    Serial.println();
+}
+
+void BootProfile::writeJson(Print& out) const {
+    out.printf("{\"boot_count\":%u,\"stages\":[", rtcBoots.bootCount);
+    for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+        out.printf("%s\"%s\"", i ? "," : "", STAGE_NAMES[i]);
+    }
+
+    // Stages as [start_us, duration_us] in the order above, null if the
+    // boot never reached them
+    out.print("],\"boots\":[");
+    uint8_t n = current ? rtcBoots.count : 0;
+    for (uint8_t i = 0; i < n; i++) {
+        portENTER_CRITICAL(&mux);
+        BootRecord boot = rtcBoots.boots[(rtcBoots.head + HISTORY_SIZE - i) % HISTORY_SIZE];
+        portEXIT_CRITICAL(&mux);
+
+        const char* reason = boot.resetReason < sizeof(RESET_REASONS) / sizeof(RESET_REASONS[0])
+            ? RESET_REASONS[boot.resetReason] : "unknown";
+        out.printf("%s{\"seq\":%u,\"reset_reason\":\"%s\",\"stages\":[",
+                   i ? "," : "", boot.seq, reason);
+        for (int s = 0; s < BOOT_STAGE_COUNT; s++) {
+            if (s) out.print(",");
+            if (boot.done & (1UL << s)) {
+                out.printf("[%u,%u]", boot.startUs[s], boot.durationUs[s]);
+            } else {
+                out.print("null");
+            }
+        }
+        out.print("]}");
+    }
+    out.print("]}");
+}
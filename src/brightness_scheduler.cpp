@@ -1,6 +1,12 @@
 #include "brightness_scheduler.h"
 #include "time_manager.h"
 #include "ui_manager.h"
+#include "lvgl_task.h"
+#include "event_scheduler.h"
+#include "solar_clock.h"
+#include "ambient_light.h"
+#include "wifi_link.h"
+#include "panel_log.h"
 
 // Global instance
 BrightnessScheduler brightnessScheduler;
@@ -11,33 +17,62 @@ BrightnessScheduler::BrightnessScheduler()
     , lastAppliedBrightness(255)  // Invalid value to force initial update
     , wakeStartTime(0)
     , wakeGraceEndTime(0)
-    , currentPeriodIndex(-1) {
+    , currentPeriodIndex(-1)
+    , timelineCount(0)
+    , solarAnchored(false)
+    , timelineDay(-1)
+    , ambientDriving(false)
+    , job(-1) {
 }
 
 void BrightnessScheduler::begin() {
-    Serial.println("BrightnessScheduler: Initializing...");
+    LOG_I("BrightnessScheduler: Initializing...");
+    job = eventScheduler.add("brightness", onTimer, this, true);
     refresh();
 }
 
-bool BrightnessScheduler::update() {
-    const BrightnessScheduleConfig& schedule = configManager.getConfig().display.schedule;
+void BrightnessScheduler::onTimer(void* arg) {
+    ((BrightnessScheduler*)arg)->evaluate();
+}
 
-    // Skip if scheduling disabled
-    if (!schedule.enabled) {
-        return false;
+bool BrightnessScheduler::evaluate() {
+    unsigned long now = millis();
+    eventScheduler.schedule(job, RECHECK_MS);
+
+    // Pinned for the whole pass so a concurrent config push can't reuse it
+    ConfigSnapshot snapshot;
+    const BrightnessScheduleConfig& schedule = snapshot->display.schedule;
+
+    // New day (or first pass since the clock was set): new sun times
+    if (schedule.enabled && solarAnchored && timeManager.isSynced()) {
+        struct tm local;
+        timeManager.getLocalNow(local);
+        if (SolarClock::dayKey(local) != timelineDay) {
+            compileTimeline(schedule);
+        }
+        uint32_t secondsOfDay = (uint32_t)local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec;
+        eventScheduler.scheduleWithin(job, (86400 - secondsOfDay) * 1000UL);
     }
 
-    // Skip if no periods configured
-    if (schedule.periodCount == 0) {
-        return false;
+    // Room light level, if adaptive mode has a fresh reading
+    int16_t ambient = ambientLight.getLevel();
+
+    // Without a schedule (or periods) only the light level moves brightness;
+    // refresh() runs the job again when the config changes
+    if (!schedule.enabled || timelineCount == 0) {
+        return followAmbient(ambient, snapshot->display.brightness);
     }
 
-    // Check if time is synced - if not, use default 50% brightness
+    // Check if time is synced - if not, use default 50% brightness (or the
+    // light level) - the sync counts as a wall clock change and runs the job
     if (!timeManager.isSynced()) {
-        if (lastAppliedBrightness != 50) {
-            Serial.println("BrightnessScheduler: NTP not synced, using default 50% brightness");
-            applyBrightness(50);
-            lastAppliedBrightness = 50;
+        uint8_t level = ambient >= 0 ? ambient : 50;
+        if (lastAppliedBrightness != level) {
+            if (ambient < 0) {
+                LOG_I("BrightnessScheduler: NTP not synced, using default 50%% brightness");
+            }
+            applyBrightness(level, ambient >= 0);
+            lastAppliedBrightness = level;
             return true;
         }
         return false;
@@ -47,38 +82,47 @@ bool BrightnessScheduler::update() {
 
     // Handle wake timeout
     if (state == SchedulerState::AWAKE) {
-        unsigned long elapsed = millis() - wakeStartTime;
-        if (elapsed >= (schedule.displayTimeout * 1000UL)) {
-            Serial.println("BrightnessScheduler: Wake timeout, returning to schedule");
+        unsigned long timeoutMs = schedule.displayTimeout * 1000UL;
+        unsigned long elapsed = now - wakeStartTime;
+        if (elapsed >= timeoutMs) {
+            LOG_I("BrightnessScheduler: Wake timeout, returning to schedule");
             state = SchedulerState::SCHEDULED;
             // Force brightness reapply by invalidating lastAppliedBrightness
             lastAppliedBrightness = 255;
+        } else {
+            eventScheduler.scheduleWithin(job, timeoutMs - elapsed);
         }
     }
 
-    // Update scheduled brightness based on current time
-    uint8_t hour = timeManager.getCurrentHour();
-    uint8_t minute = timeManager.getCurrentMinute();
-    int8_t periodIndex = findActivePeriod(hour, minute);
+    // Level in effect now, and when it next changes
+    int8_t index;
+    uint32_t untilChange;
+    currentScheduledBrightness = scheduledLevel(schedule.curve, timeManager.getSecondsOfDay(), index, untilChange);
+    eventScheduler.scheduleWithin(job, untilChange * 1000UL);
 
-    if (periodIndex != currentPeriodIndex) {
-        currentPeriodIndex = periodIndex;
-        currentScheduledBrightness = getPeriodBrightness(periodIndex);
-        Serial.printf("BrightnessScheduler: Period changed to %d, brightness=%d\n",
-            periodIndex, currentScheduledBrightness);
+    if (timeline[index].period != currentPeriodIndex) {
+        currentPeriodIndex = timeline[index].period;
+        LOG_I("BrightnessScheduler: Period changed to %d, brightness=%d",
+            currentPeriodIndex, currentScheduledBrightness);
     }
 
-    // Determine target brightness based on state
+    // Determine target brightness based on state; the light level can
+    // only dim the schedule, so a 0% period still turns the panel off
     uint8_t targetBrightness;
+    bool gradual = false;
     if (state == SchedulerState::AWAKE) {
         targetBrightness = schedule.touchBrightness;
+    } else if (ambient >= 0 && ambient < currentScheduledBrightness) {
+        targetBrightness = ambient;
+        gradual = true;
     } else {
         targetBrightness = currentScheduledBrightness;
+        gradual = schedule.curve && abs((int)targetBrightness - (int)lastAppliedBrightness) <= 1;
     }
 
     // Apply brightness if changed
     if (targetBrightness != lastAppliedBrightness) {
-        applyBrightness(targetBrightness);
+        applyBrightness(targetBrightness, gradual);
         lastAppliedBrightness = targetBrightness;
         brightnessChanged = true;
     }
@@ -86,8 +130,37 @@ bool BrightnessScheduler::update() {
     return brightnessChanged;
 }
 
+bool BrightnessScheduler::followAmbient(int16_t ambient, uint8_t configured) {
+    if (ambient >= 0) {
+        ambientDriving = true;
+        if (ambient == lastAppliedBrightness) return false;
+        applyBrightness(ambient, true);
+        lastAppliedBrightness = ambient;
+        return true;
+    }
+
+    // Reading went stale or adaptive mode was switched off: back to the
+    // configured brightness
+    if (ambientDriving) {
+        ambientDriving = false;
+        applyBrightness(configured);
+        lastAppliedBrightness = configured;
+        return true;
+    }
+    return false;
+}
+
+void BrightnessScheduler::onAmbientChanged() {
+    eventScheduler.post(job);
+}
+
+unsigned long BrightnessScheduler::getNextEventInMs() const {
+    return eventScheduler.remainingMs(job);
+}
+
 bool BrightnessScheduler::onTouchDetected() {
-    const BrightnessScheduleConfig& schedule = configManager.getConfig().display.schedule;
+    ConfigSnapshot snapshot;
+    const BrightnessScheduleConfig& schedule = snapshot->display.schedule;
 
     // Skip if scheduling disabled
     if (!schedule.enabled) {
@@ -105,16 +178,17 @@ bool BrightnessScheduler::onTouchDetected() {
             bool shouldBlock = (actualBrightness <= 5);
 
             if (shouldBlock) {
-                Serial.printf("BrightnessScheduler: Touch detected at %d%% brightness, waking to %d%% (blocking for %lums)\n",
+                LOG_I("BrightnessScheduler: Touch detected at %d%% brightness, waking to %d%% (blocking for %lums)",
                     actualBrightness, schedule.touchBrightness, WAKE_GRACE_PERIOD_MS);
                 wakeGraceEndTime = millis() + WAKE_GRACE_PERIOD_MS;
             } else {
-                Serial.printf("BrightnessScheduler: Touch detected at %d%% brightness, waking to %d%%\n",
+                LOG_I("BrightnessScheduler: Touch detected at %d%% brightness, waking to %d%%",
                     actualBrightness, schedule.touchBrightness);
             }
 
             state = SchedulerState::AWAKE;
             wakeStartTime = millis();
+            eventScheduler.post(job);   // Arms the wake timeout
 
             // Apply wake brightness immediately
             applyBrightness(schedule.touchBrightness);
@@ -132,8 +206,20 @@ bool BrightnessScheduler::onTouchDetected() {
     return false;  // Don't block button action
 }
 
+uint8_t BrightnessScheduler::getWakeBrightness() const {
+    ConfigSnapshot snapshot;
+    const BrightnessScheduleConfig& schedule = snapshot->display.schedule;
+
+    // Same floor rule as onTouchDetected(); the backlight only ever raises
+    if (!schedule.enabled || currentScheduledBrightness >= schedule.touchBrightness) {
+        return 0;
+    }
+    return schedule.touchBrightness;
+}
+
 bool BrightnessScheduler::shouldBlockButtons() const {
-    const BrightnessScheduleConfig& schedule = configManager.getConfig().display.schedule;
+    ConfigSnapshot snapshot;
+    const BrightnessScheduleConfig& schedule = snapshot->display.schedule;
 
     if (!schedule.enabled) {
         return false;
@@ -149,10 +235,13 @@ bool BrightnessScheduler::shouldBlockButtons() const {
 }
 
 uint8_t BrightnessScheduler::getTargetBrightness() const {
-    const BrightnessScheduleConfig& schedule = configManager.getConfig().display.schedule;
+    ConfigSnapshot snapshot;
+    const BrightnessScheduleConfig& schedule = snapshot->display.schedule;
+
+    int16_t ambient = ambientLight.getLevel();
 
     if (!schedule.enabled) {
-        return configManager.getConfig().display.brightness;
+        return ambient >= 0 ? ambient : snapshot->display.brightness;
     }
 
     if (state == SchedulerState::AWAKE) {
@@ -161,10 +250,10 @@ uint8_t BrightnessScheduler::getTargetBrightness() const {
 
     // If NTP not synced yet, use default 50%
     if (!timeManager.isSynced()) {
-        return 50;
+        return ambient >= 0 ? ambient : 50;
     }
 
-    return currentScheduledBrightness;
+    return ambient >= 0 && ambient < currentScheduledBrightness ? ambient : currentScheduledBrightness;
 }
 
 bool BrightnessScheduler::isEnabled() const {
@@ -172,10 +261,16 @@ bool BrightnessScheduler::isEnabled() const {
 }
 
 void BrightnessScheduler::refresh() {
-    const BrightnessScheduleConfig& schedule = configManager.getConfig().display.schedule;
+    ConfigSnapshot snapshot;
+    const BrightnessScheduleConfig& schedule = snapshot->display.schedule;
+
+    // The WiFi profiles may have changed with the rest of the config
+    wifiLink.applyProfile();
 
     if (!schedule.enabled) {
-        Serial.println("BrightnessScheduler: Disabled");
+        LOG_I("BrightnessScheduler: Disabled");
+        timelineCount = 0;
+        eventScheduler.post(job);   // Adaptive brightness may still apply
         return;
     }
 
@@ -183,90 +278,171 @@ void BrightnessScheduler::refresh() {
     timeManager.setTimezone(schedule.timezone);
 
     // Reset state
+    timelineDay = -1;
+    compileTimeline(schedule);
     state = SchedulerState::SCHEDULED;
     currentPeriodIndex = -1;
     lastAppliedBrightness = 255;  // Force re-application
+    eventScheduler.post(job);
 
-    Serial.printf("BrightnessScheduler: Enabled with %d periods, timeout=%ds\n",
-        schedule.periodCount, schedule.displayTimeout);
+    LOG_I("BrightnessScheduler: Enabled with %d periods (%s), timeout=%ds",
+        schedule.periodCount, schedule.curve ? "curve" : "steps", schedule.displayTimeout);
 
     if (schedule.periodCount == 0) {
-        Serial.println("BrightnessScheduler: WARNING - No periods configured!");
+        LOG_W("BrightnessScheduler: WARNING - No periods configured!");
     }
 
     for (uint8_t i = 0; i < schedule.periodCount; i++) {
-        Serial.printf("  Period %d: %s at %02d:%02d -> %d%%\n",
-            i, schedule.periods[i].name.c_str(),
-            schedule.periods[i].startHour, schedule.periods[i].startMinute,
-            schedule.periods[i].brightness);
+        const BrightnessSchedulePeriod& period = schedule.periods[i];
+        if (period.anchor == ScheduleAnchor::CLOCK) {
+            LOG_I("  Period %d: %s at %02d:%02d -> %d%%",
+                i, period.name.c_str(), period.startHour, period.startMinute, period.brightness);
+        } else {
+            LOG_I("  Period %d: %s at %s%+d min -> %d%%",
+                i, period.name.c_str(), period.anchor == ScheduleAnchor::SUNRISE ? "sunrise" : "sunset",
+                period.offsetMinutes, period.brightness);
+        }
     }
 
     // If time is already synced, immediately find and apply the correct period
-    if (timeManager.isSynced() && schedule.periodCount > 0) {
-        uint8_t hour = timeManager.getCurrentHour();
-        uint8_t minute = timeManager.getCurrentMinute();
-        int8_t periodIndex = findActivePeriod(hour, minute);
-        if (periodIndex >= 0) {
+    if (timeManager.isSynced() && timelineCount > 0) {
+        int8_t index;
+        uint32_t untilChange;
+        uint8_t level = scheduledLevel(schedule.curve, timeManager.getSecondsOfDay(), index, untilChange);
+        if (index >= 0) {
+            uint8_t periodIndex = timeline[index].period;
             currentPeriodIndex = periodIndex;
-            currentScheduledBrightness = schedule.periods[periodIndex].brightness;
-            Serial.printf("BrightnessScheduler: Initial period %d (%s), brightness=%d%%\n",
+            currentScheduledBrightness = level;
+            LOG_I("BrightnessScheduler: Initial period %d (%s), brightness=%d%%",
                 periodIndex, schedule.periods[periodIndex].name.c_str(), currentScheduledBrightness);
             applyBrightness(currentScheduledBrightness);
             lastAppliedBrightness = currentScheduledBrightness;
         }
     } else if (!timeManager.isSynced()) {
         // NTP not synced yet, use default 50% brightness
-        Serial.println("BrightnessScheduler: NTP not synced, applying default 50% brightness");
+        LOG_I("BrightnessScheduler: NTP not synced, applying default 50%% brightness");
         applyBrightness(50);
         lastAppliedBrightness = 50;
     }
 }
 
-int8_t BrightnessScheduler::findActivePeriod(uint8_t hour, uint8_t minute) const {
-    const BrightnessScheduleConfig& schedule = configManager.getConfig().display.schedule;
+// ============================================================================
+// Timeline
+// ============================================================================
 
-    if (schedule.periodCount == 0) {
-        return -1;
+void BrightnessScheduler::compileTimeline(const BrightnessScheduleConfig& schedule) {
+    uint8_t n = schedule.periodCount < MAX_SCHEDULE_PERIODS ? schedule.periodCount : MAX_SCHEDULE_PERIODS;
+
+    solarAnchored = false;
+    for (uint8_t i = 0; i < n; i++) {
+        solarAnchored = solarAnchored || schedule.periods[i].anchor != ScheduleAnchor::CLOCK;
     }
+    SunTimes sun;
+    bool haveSun = solarAnchored && solarClock.today(schedule.latitude, schedule.longitude, sun);
+    timelineDay = haveSun ? sun.day : -1;
+    if (solarAnchored && !haveSun && timeManager.isSynced()) {
+        LOG_I("BrightnessScheduler: No location set, skipping sunrise/sunset periods");
+    }
+
+    // Insertion sort by start minute; stable, so equal starts keep config order
+    timelineCount = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        const BrightnessSchedulePeriod& period = schedule.periods[i];
+        BrightnessTransition t;
+        if (period.anchor == ScheduleAnchor::CLOCK) {
+            t.minute = toMinutesSinceMidnight(period.startHour, period.startMinute) % 1440;
+        } else {
+            int16_t event = period.anchor == ScheduleAnchor::SUNRISE ? sun.sunrise : sun.sunset;
+            if (!haveSun || event < 0) {
+                continue;   // No location yet, or the sun doesn't rise/set today
+            }
+            t.minute = (uint16_t)(((event + period.offsetMinutes) % 1440 + 1440) % 1440);
+        }
+        t.brightness = period.brightness;
+        t.period = i;
 
-    uint16_t currentMinutes = toMinutesSinceMidnight(hour, minute);
+        uint8_t j = timelineCount;
+        while (j > 0 && timeline[j - 1].minute > t.minute) {
+            timeline[j] = timeline[j - 1];
+            j--;
+        }
+        timeline[j] = t;
+        timelineCount++;
+    }
+}
 
-    // Find the period with the latest start time that is <= current time
-    // If none found (current time is before first period), use the last period (wrap around)
-    int8_t activePeriod = schedule.periodCount - 1;  // Default to last period (wrap around)
+int8_t BrightnessScheduler::findActivePeriod(uint16_t minuteOfDay) const {
+    if (timelineCount == 0) {
+        return -1;
+    }
 
-    for (uint8_t i = 0; i < schedule.periodCount; i++) {
-        uint16_t periodStart = toMinutesSinceMidnight(
-            schedule.periods[i].startHour,
-            schedule.periods[i].startMinute
-        );
+    // Latest start at or before now; before the first start of the day the
+    // last period is still running from yesterday (wrap around)
+    int8_t active = timelineCount - 1;
+    for (uint8_t i = 0; i < timelineCount && timeline[i].minute <= minuteOfDay; i++) {
+        active = i;
+    }
+    return active;
+}
 
-        if (periodStart <= currentMinutes) {
-            activePeriod = i;
-        } else {
-            // Periods are sorted by start time, so once we find one that's later
-            // than current time, we've found our answer (it's the previous one)
+uint32_t BrightnessScheduler::secondsToNextTransition(uint32_t secondsOfDay) const {
+    uint16_t minuteOfDay = secondsOfDay / 60;
+    uint32_t next = (uint32_t)timeline[0].minute + 1440;   // First start tomorrow
+    for (uint8_t i = 0; i < timelineCount; i++) {
+        if (timeline[i].minute > minuteOfDay) {
+            next = timeline[i].minute;
             break;
         }
     }
-
-    return activePeriod;
+    return next * 60 - secondsOfDay;
 }
 
-uint8_t BrightnessScheduler::getPeriodBrightness(int8_t periodIndex) const {
-    const BrightnessScheduleConfig& schedule = configManager.getConfig().display.schedule;
+uint8_t BrightnessScheduler::scheduledLevel(bool curve, uint32_t secondsOfDay, int8_t& index,
+                                            uint32_t& untilChange) const {
+    index = findActivePeriod(secondsOfDay / 60);
+    const BrightnessTransition& from = timeline[index];
+    if (!curve || timelineCount < 2) {
+        untilChange = secondsToNextTransition(secondsOfDay);
+        return from.brightness;
+    }
 
-    if (periodIndex < 0 || periodIndex >= schedule.periodCount) {
-        // Fallback to manual brightness
-        return configManager.getConfig().display.brightness;
+    // Ramp from this keyframe to the next, wrapping past midnight
+    const BrightnessTransition& to = timeline[(index + 1) % timelineCount];
+    int32_t span = ((int32_t)to.minute - from.minute) * 60;
+    if (span <= 0) span += 86400;
+    int32_t into = (int32_t)secondsOfDay - (int32_t)from.minute * 60;
+    if (into < 0) into += 86400;
+
+    int32_t delta = (int32_t)to.brightness - from.brightness;
+    int32_t steps = delta < 0 ? -delta : delta;
+    if (steps == 0) {
+        untilChange = span - into;
+        return from.brightness;
     }
 
-    return schedule.periods[periodIndex].brightness;
+    // Whole 1% steps taken so far, and when the next one is due
+    int32_t done = (int32_t)((int64_t)steps * into / span);
+    int32_t nextAt = (int32_t)(((int64_t)(done + 1) * span + steps - 1) / steps);
+    untilChange = nextAt > into ? nextAt - into : 1;
+    return (uint8_t)(from.brightness + (delta > 0 ? done : -done));
 }
 
-void BrightnessScheduler::applyBrightness(uint8_t brightness) {
-    Serial.printf("BrightnessScheduler: Setting brightness to %d\n", brightness);
-    uiManager.setBrightness(brightness);
+void BrightnessScheduler::applyBrightness(uint8_t brightness, bool gradual) {
+    if (gradual) {
+        uiManager.setBrightness(brightness, GRADUAL_FADE_MS);
+    } else {
+        LOG_D("BrightnessScheduler: Setting brightness to %d", brightness);
+        uiManager.setBrightness(brightness);
+    }
+
+    // Clock down and let the radio doze while parked at a dim scheduled
+    // level, full speed once touched
+    ConfigSnapshot snapshot;
+    const BrightnessScheduleConfig& schedule = snapshot->display.schedule;
+    bool dim = schedule.enabled && state == SchedulerState::SCHEDULED &&
+               brightness < schedule.touchBrightness;
+    lvglTask.setPowerSave(dim);
+    wifiLink.setDim(dim);
 }
 
 uint16_t BrightnessScheduler::toMinutesSinceMidnight(uint8_t hour, uint8_t minute) {
@@ -0,0 +1,122 @@
+#include "card_tile_cache.h"
+#include "psram_budget.h"
+
+// Global instance
+CardTileCache cardTileCache;
+
+CardTileCache::CardTileCache()
+    : bytes(0)
+    , hits(0)
+    , captures(0)
+    , refused(0)
+{
+    memset(tiles, 0, sizeof(tiles));
+}
+
+const CardTile* CardTileCache::get(uint8_t slot, bool state) {
+    if (slot >= MAX_PAGE_CARDS) return nullptr;
+    CardTile& tile = tiles[slot][state ? 1 : 0];
+    if (!tile.dsc.data) return nullptr;
+    hits++;
+    return &tile;
+}
+
+const CardTile* CardTileCache::capture(uint8_t slot, bool state, lv_obj_t* card,
+                                       lv_coord_t margin, lv_color_t background) {
+    if (slot >= MAX_PAGE_CARDS) return nullptr;
+    CardTile& tile = tiles[slot][state ? 1 : 0];
+    if (tile.dsc.data) drop(tile);
+
+    // The snapshot takes in the card's whole shadow; keep what fits the margin
+    lv_obj_update_layout(card);
+    lv_coord_t ext = _lv_obj_get_ext_draw_size(card);
+    if (margin > ext) margin = ext;
+    if (margin < 0) margin = 0;
+    lv_coord_t crop = ext - margin;
+    lv_coord_t w = lv_obj_get_width(card) + 2 * margin;
+    lv_coord_t h = lv_obj_get_height(card) + 2 * margin;
+    size_t size = (size_t)w * h * sizeof(lv_color_t);
+    if (bytes + size > MAX_BYTES) {
+        refused++;
+        return nullptr;
+    }
+
+    // With alpha, so the shadow and rounded corners can be laid on the
+    // background they really sit on rather than the snapshot's black
+    uint32_t snapSize = lv_snapshot_buf_size_needed(card, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    uint8_t* snap = (uint8_t*)psramBudget.alloc(PSRAM_CARD_TILE, snapSize);
+    if (!snap) {
+        refused++;
+        return nullptr;
+    }
+    lv_img_dsc_t snapDsc;
+    if (lv_snapshot_take_to_buf(card, LV_IMG_CF_TRUE_COLOR_ALPHA, &snapDsc, snap, snapSize) != LV_RES_OK) {
+        psramBudget.release(PSRAM_CARD_TILE, snap, snapSize);
+        refused++;
+        return nullptr;
+    }
+    lv_color_t* data = (lv_color_t*)psramBudget.alloc(PSRAM_CARD_TILE, size);
+    if (!data) {
+        psramBudget.release(PSRAM_CARD_TILE, snap, snapSize);
+        refused++;
+        return nullptr;
+    }
+
+    // TRUE_COLOR_ALPHA at 16-bit depth: color low byte, high byte, alpha
+    uint32_t snapW = snapDsc.header.w;
+    lv_color_t* out = data;
+    for (lv_coord_t y = 0; y < h; y++) {
+        const uint8_t* px = snap + ((y + crop) * snapW + crop) * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        for (lv_coord_t x = 0; x < w; x++) {
+            lv_color_t c;
+            c.full = px[0] | (px[1] << 8);
+            *out++ = lv_color_mix(c, background, px[2]);
+            px += LV_IMG_PX_SIZE_ALPHA_BYTE;
+        }
+    }
+    psramBudget.release(PSRAM_CARD_TILE, snap, snapSize);
+
+    tile.margin = margin;
+    tile.dsc.header.cf = LV_IMG_CF_TRUE_COLOR;
+    tile.dsc.header.always_zero = 0;
+    tile.dsc.header.reserved = 0;
+    tile.dsc.header.w = w;
+    tile.dsc.header.h = h;
+    tile.dsc.data_size = size;
+    tile.dsc.data = (const uint8_t*)data;
+    bytes += size;
+    captures++;
+    return &tile;
+}
+
+void CardTileCache::drop(CardTile& tile) {
+    // LVGL's image cache knows descriptors by address, and the slot is reused
+    lv_img_cache_invalidate_src(&tile.dsc);
+    psramBudget.release(PSRAM_CARD_TILE, (void*)tile.dsc.data, tile.dsc.data_size);
+    bytes -= tile.dsc.data_size;
+    memset(&tile, 0, sizeof(tile));
+}
+
+void CardTileCache::invalidate(uint8_t slot) {
+    if (slot >= MAX_PAGE_CARDS) return;
+    for (int s = 0; s < 2; s++) {
+        if (tiles[slot][s].dsc.data) drop(tiles[slot][s]);
+    }
+}
+
+void CardTileCache::clear() {
+    for (int i = 0; i < MAX_PAGE_CARDS; i++) {
+        invalidate(i);
+    }
+}
+
+void CardTileCache::writeJson(Print& out) const {
+    int count = 0;
+    for (int i = 0; i < MAX_PAGE_CARDS; i++) {
+        for (int s = 0; s < 2; s++) {
+            if (tiles[i][s].dsc.data) count++;
+        }
+    }
+    out.printf("{\"tiles\":%d,\"bytes\":%u,\"hits\":%u,\"captures\":%u,\"refused\":%u}",
+               count, (unsigned)bytes, hits, captures, refused);
+}
@@ -1,370 +1,2821 @@
 #include "config_manager.h"
 #include "time_manager.h"
+#include "heap_monitor.h"
+#include "theme_engine.h"
+#include "panel_log.h"
+#include "http_pool.h"
+#include "json_alloc.h"
 #include <Preferences.h>
 #include <WiFi.h>
 #include <HTTPClient.h>
+#include <esp_heap_caps.h>
+#include <esp_rom_crc.h>
+
+// Which glyphs the panel's fonts carry (scripts/make_fonts.py); see lv_conf.h
+#if __has_include("panel_fonts_subset.h")
+#include "panel_fonts_subset.h"
+#endif
+#ifndef PANEL_FONTS_SUBSET
+#define PANEL_FONTS_SUBSET 0
+#define PANEL_FONTS_LATIN1 1
+#endif
 
 // NVS keys
 const char* ConfigManager::NVS_NAMESPACE = "device_config";
-const char* ConfigManager::NVS_CONFIG_KEY = "config_json";
+const char* ConfigManager::NVS_CONFIG_KEY = "config_json";      // Legacy JSON blob (migrated on load)
+const char* ConfigManager::NVS_CONFIG_BIN_KEY = "config_bin";
+const char* ConfigManager::NVS_SERVER_CA_KEY = "server_ca";
 
 // Global instance
 ConfigManager configManager;
 
-ConfigManager::ConfigManager() : configured(false) {
+// ============================================================================
+// Config slots and string arena
+// ============================================================================
+
+bool ConfigArena::begin(size_t size) {
+    if (base) return true;
+    base = (char*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!base) {
+        base = (char*)malloc(size);
+    }
+    if (!base) {
+        LOG_E("ConfigManager: Failed to allocate config arena");
+        return false;
+    }
+    capacity = size;
+    used = 0;
+    return true;
+}
+
+ConfigString ConfigArena::intern(const char* s) {
+    if (!s || !*s) return ConfigString();
+
+    size_t len = strlen(s);
+    if (!base || len > 0xFFFF || used + len + 1 > capacity) {
+        overflowed = true;
+        return ConfigString();
+    }
+
+    char* dst = base + used;
+    memcpy(dst, s, len + 1);
+    used += len + 1;
+    return ConfigString(dst, (uint16_t)len);
+}
+
+#if PANEL_FONTS_SUBSET && !PANEL_FONTS_LATIN1
+// Latin-1 letters U+00C0-U+00FF without their accents, for the ASCII-only
+// subset fonts ('*' where there is no sensible letter)
+static const char LATIN1_FOLD[] =
+    "AAAAAAACEEEEIIII" "DNOOOOO*OUUUUYTs"
+    "aaaaaaaceeeeiiii" "dnooooo*ouuuuyty";
+#endif
+
+// Typographic punctuation U+2010-U+202F (UTF-8 E2 80 90-AF) the fonts lack,
+// by its last byte; 0 keeps the character
+static const char* const PUNCT_FOLD[32] = {
+    "-", "-", "-", "-", "-", "-", nullptr, nullptr,     // Hyphens, dashes
+    "'", "'", "'", "'", "\"", "\"", "\"", "\"",     // Quotation marks
+    nullptr, nullptr, "*", nullptr, nullptr, nullptr, "...", nullptr,  // Bullet, ellipsis
+    nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+};
+
+ConfigString ConfigArena::internDisplay(const char* s) {
+    if (!s || !*s) return ConfigString();
+
+    size_t len = strlen(s);
+    if (!base || len > 0xFFFF || used + len + 1 > capacity) {
+        overflowed = true;
+        return ConfigString();
+    }
+
+    // One pass straight into the arena; every replacement is no longer than
+    // what it replaces, so the reserved len + 1 bytes always suffice
+    char* dst = base + used;
+    char* out = dst;
+    const uint8_t* p = (const uint8_t*)s;
+    while (*p) {
+        uint8_t c = *p;
+        if (c < 0x80) {
+            *out++ = (char)c;
+            p++;
+            continue;
+        }
+
+        // Sequence length from the lead byte; a truncated one is cut short
+        size_t n = (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : (c >= 0xC0) ? 2 : 1;
+        size_t have = 1;
+        while (have < n && (p[have] & 0xC0) == 0x80) have++;
+
+        const char* fold = nullptr;
+        if (have == 3 && c == 0xE2 && p[1] == 0x80 && p[2] >= 0x90 && p[2] <= 0xAF) {
+            fold = PUNCT_FOLD[p[2] - 0x90];
+        } else if (have == 2 && c == 0xC2 && p[1] == 0xB4) {
+            fold = "'";  // Acute accent used as an apostrophe
+        }
+#if PANEL_FONTS_SUBSET && !PANEL_FONTS_LATIN1
+        // The subset fonts stop at ASCII: fold accented letters and turn
+        // anything else into '?' rather than draw empty boxes
+        char letter[2] = {'?', '\0'};
+        if (!fold) {
+            if (have == 2 && c == 0xC3) {
+                letter[0] = LATIN1_FOLD[p[1] & 0x3F];
+            }
+            fold = letter;
+        }
+#endif
+        if (fold) {
+            while (*fold) *out++ = *fold++;
+        } else {
+            memcpy(out, p, have);
+            out += have;
+        }
+        p += have;
+    }
+    *out = '\0';
+
+    size_t folded = out - dst;
+    used += folded + 1;
+    return ConfigString(dst, (uint16_t)folded);
+}
+
+namespace {
+
+// A scene the server sent no actions for: "All On"/"All Off" set every
+// button (fans to their first speed), anything else does nothing locally
+void compileBuiltinScene(DeviceConfig& config, SceneConfig& scene) {
+    scene.firstAction = config.sceneActions.size();
+    scene.actionCount = 0;
+    bool state;
+    if (scene.name == "All On") {
+        state = true;
+    } else if (scene.name == "All Off") {
+        state = false;
+    } else {
+        return;
+    }
+    for (const ButtonConfig& btn : config.buttons) {
+        if (btn.type == ButtonType::SCENE || btn.type == ButtonType::SENSOR) continue;
+        SceneAction action;
+        action.buttonId = btn.id;
+        action.state = state;
+        action.speedLevel = btn.type == ButtonType::FAN ? (state ? 1 : 0) : NO_SCENE_SPEED;
+        if (!config.sceneActions.push_back(action)) break;
+        scene.actionCount++;
+    }
+}
+
+// Calls fn on every string in a config (used to re-home a copy into a new arena)
+template <typename Fn>
+void forEachString(DeviceConfig& c, Fn fn) {
+    fn(c.device.id);
+    fn(c.device.name);
+    fn(c.device.title);
+    fn(c.device.location);
+    fn(c.display.theme);
+    fn(c.display.dayNight.dayTheme);
+    fn(c.display.dayNight.nightTheme);
+    fn(c.display.lcars.colorScheme);
+    fn(c.display.lcars.headerLeft);
+    fn(c.display.lcars.headerRight);
+    fn(c.display.lcars.footerLeft);
+    fn(c.display.lcars.footerRight);
+    fn(c.display.lcars.sidebarTop);
+    fn(c.display.lcars.sidebarBottom);
+    for (LCARSTextField& field : c.display.lcars.customFields) {
+        fn(field.id);
+        fn(field.value);
+        fn(field.style);
+    }
+    fn(c.display.schedule.timezone);
+    for (uint8_t i = 0; i < c.display.schedule.periodCount; i++) {
+        fn(c.display.schedule.periods[i].name);
+    }
+    for (ButtonConfig& btn : c.buttons) {
+        fn(btn.name);
+        fn(btn.icon);
+        fn(btn.subtitle);
+        fn(btn.sceneId);
+        fn(btn.directPath);
+    }
+    for (SceneConfig& scn : c.scenes) {
+        fn(scn.name);
+        fn(scn.icon);
+    }
+    for (DirectTargetConfig& target : c.direct) {
+        fn(target.url);
+        fn(target.auth);
+        fn(target.onBody);
+        fn(target.offBody);
+        fn(target.speedBody);
+    }
+    for (CustomThemeConfig& theme : c.display.themes) {
+        fn(theme.name);
+        fn(theme.base);
+    }
+    fn(c.server.reportingUrl);
+}
+
+} // namespace
+
+uint32_t ConfigManager::pinSnapshot() const {
+    // Retry if a writer published between reading the index and pinning,
+    // so a pinned slot is always one that was live while pinned
+    while (true) {
+        uint32_t slot = activeSlot.load();
+        readers[slot].fetch_add(1);
+        if (activeSlot.load() == slot) {
+            return slot;
+        }
+        readers[slot].fetch_sub(1);
+    }
+}
+
+void ConfigManager::unpinSnapshot(uint32_t slot) const {
+    readers[slot].fetch_sub(1);
+}
+
+ConfigManager::ConfigSlot& ConfigManager::beginUpdate(bool clone) {
+    // Grace period: readers still holding the previous config must finish
+    // before its slot is overwritten. Waited out before taking writeMutex,
+    // so a snapshot holder that is itself blocked on writeMutex (in
+    // setButtonState(), say) can still finish and unpin; re-checked under
+    // the mutex, since another writer may have published in between
+    uint32_t spareIndex;
+    unsigned long waitStart = millis();
+    while (true) {
+        spareIndex = activeSlot.load() ^ 1;
+        if (readers[spareIndex].load() == 0) {
+            if (writeMutex) {
+                xSemaphoreTakeRecursive(writeMutex, portMAX_DELAY);
+            }
+            spareIndex = activeSlot.load() ^ 1;
+            if (readers[spareIndex].load() == 0) {
+                break;
+            }
+            if (writeMutex) {
+                xSemaphoreGiveRecursive(writeMutex);
+            }
+        }
+        if (millis() - waitStart > 1000) {
+            LOG_I("ConfigManager: Waiting on a long-held config snapshot");
+            waitStart = millis();
+        }
+        vTaskDelay(1);
+    }
+
+    ConfigSlot& spare = slots[spareIndex];
+    spare.arena.reset();
+    if (clone) {
+        spare.config = live();
+        forEachString(spare.config, [&spare](ConfigString& str) {
+            str = spare.arena.intern(str.c_str());
+        });
+    } else {
+        spare.config = DeviceConfig();
+    }
+    return spare;
+}
+
+bool ConfigManager::commitUpdate() {
+    uint32_t spareIndex = activeSlot.load() ^ 1;
+    ConfigSlot& spare = slots[spareIndex];
+    if (spare.arena.overflow()) {
+        abortUpdate();
+        LOG_W("ConfigManager: Config strings exceed %u byte arena, keeping current config",
+                      CONFIG_ARENA_SIZE);
+        return false;
+    }
+
+    rebuildButtonIndex(spare);
+    activeSlot.store(spareIndex);
+    generation.fetch_add(1);
+    serverConfigHash.store(pendingConfigHash);
+    abortUpdate();
+    return true;
+}
+
+void ConfigManager::abortUpdate() {
+    pendingConfigHash = 0;
+    if (writeMutex) {
+        xSemaphoreGiveRecursive(writeMutex);
+    }
+}
+
+// ============================================================================
+// Streaming serializer
+// ============================================================================
+// Writes the config straight to a Print, field by field, so the HTTP handler
+// never has to build a JsonDocument first. The output matches what the
+// DynamicJsonDocument-based serializer used to produce.
+
+namespace {
+
+class ConfigJsonWriter {
+public:
+    explicit ConfigJsonWriter(Print& out) : out(out), first(true), written(0) {}
+
+    void beginObject(const char* key = nullptr) { open(key, '{'); }
+    void endObject() { close('}'); }
+    void beginArray(const char* key = nullptr) { open(key, '['); }
+    void endArray() { close(']'); }
+
+    void field(const char* key, const ConfigString& value) {
+        name(key);
+        string(value.c_str());
+    }
+
+    void field(const char* key, const char* value) {
+        name(key);
+        string(value);
+    }
+
+    void field(const char* key, bool value) {
+        name(key);
+        raw(value ? "true" : "false");
+    }
+
+    void field(const char* key, unsigned int value) {
+        name(key);
+        written += out.print(value);
+    }
+
+    void field(const char* key, int value) {
+        name(key);
+        written += out.print(value);
+    }
+
+    void field(const char* key, float value, uint8_t decimals) {
+        name(key);
+        written += out.print(value, decimals);
+    }
+
+    void nullField(const char* key) {
+        name(key);
+        raw("null");
+    }
+
+    size_t size() const { return written; }
+
+private:
+    Print& out;
+    bool first;      // No comma needed before the next member
+    size_t written;
+
+    void raw(const char* s) { written += out.print(s); }
+    void raw(char c) { written += out.write((uint8_t)c); }
+
+    void name(const char* key) {
+        if (!first) raw(',');
+        first = false;
+        if (key) {
+            string(key);
+            raw(':');
+        }
+    }
+
+    void open(const char* key, char bracket) {
+        name(key);
+        raw(bracket);
+        first = true;
+    }
+
+    void close(char bracket) {
+        raw(bracket);
+        first = false;
+    }
+
+    void string(const char* s) {
+        raw('"');
+        for (; *s; s++) {
+            char c = *s;
+            switch (c) {
+                case '"':  raw("\\\""); break;
+                case '\\': raw("\\\\"); break;
+                case '\n': raw("\\n"); break;
+                case '\r': raw("\\r"); break;
+                case '\t': raw("\\t"); break;
+                case '\b': raw("\\b"); break;
+                case '\f': raw("\\f"); break;
+                default:
+                    if ((uint8_t)c < 0x20) {
+                        char esc[7];
+                        snprintf(esc, sizeof(esc), "\\u%04x", (uint8_t)c);
+                        raw(esc);
+                    } else {
+                        raw(c);
+                    }
+            }
+        }
+        raw('"');
+    }
+};
+
+// Counts bytes without storing them (sizing pass for toJson)
+class CountingPrint : public Print {
+public:
+    size_t write(uint8_t) override { return 1; }
+    size_t write(const uint8_t*, size_t size) override { return size; }
+};
+
+// Appends into a String (reserve() first so this doesn't reallocate)
+class StringPrint : public Print {
+public:
+    explicit StringPrint(String& str) : str(str) {}
+    size_t write(uint8_t c) override { return str.concat((char)c) ? 1 : 0; }
+    size_t write(const uint8_t* data, size_t size) override {
+        return str.concat((const char*)data, size) ? size : 0;
+    }
+
+private:
+    String& str;
+};
+
+void setAmbientDefaults(AmbientConfig& ambient) {
+    ambient.enabled = false;
+    ambient.minBrightness = 10;
+    ambient.maxBrightness = 100;
+    ambient.luxAtMax = 400;
+}
+
+void setNetworkDefaults(NetworkConfig& network) {
+    network.wifiProfile = WifiProfile::BALANCED;
+    network.dimProfile = WifiProfile::BALANCED;
+    memset(&network.multicast, 0, sizeof(network.multicast));
+    memset(&network.peerMirror, 0, sizeof(network.peerMirror));
+}
+
+// "239.255.77.77" -> 4 bytes; false unless a dotted IPv4 multicast address
+bool parseMulticastGroup(const char* text, uint8_t group[4]) {
+    unsigned int a, b, c, d;
+    char tail;
+    if (sscanf(text, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail) != 4 ||
+        a < 224 || a > 239 || b > 255 || c > 255 || d > 255) {
+        return false;
+    }
+    group[0] = a;
+    group[1] = b;
+    group[2] = c;
+    group[3] = d;
+    return true;
+}
+
+// 2 * size hex digits -> size bytes
+bool parseHexKey(const char* text, uint8_t* out, size_t size) {
+    if (strlen(text) != size * 2) return false;
+    for (size_t i = 0; i < size * 2; i++) {
+        char ch = text[i];
+        uint8_t nibble;
+        if (ch >= '0' && ch <= '9') nibble = ch - '0';
+        else if (ch >= 'a' && ch <= 'f') nibble = ch - 'a' + 10;
+        else if (ch >= 'A' && ch <= 'F') nibble = ch - 'A' + 10;
+        else return false;
+        out[i / 2] = (i & 1) ? (out[i / 2] | nibble) : (nibble << 4);
+    }
+    return true;
+}
+
+// size bytes -> 2 * size hex digits and a terminator
+void formatHexKey(const uint8_t* key, size_t size, char* out) {
+    for (size_t i = 0; i < size; i++) {
+        snprintf(out + i * 2, 3, "%02x", key[i]);
+    }
+}
+
+WifiProfile parseWifiProfile(const char* name, WifiProfile fallback) {
+    if (strcmp(name, "low_latency") == 0) return WifiProfile::LOW_LATENCY;
+    if (strcmp(name, "balanced") == 0) return WifiProfile::BALANCED;
+    if (strcmp(name, "low_power") == 0) return WifiProfile::LOW_POWER;
+    return fallback;
+}
+
+CardLayout parseCardLayout(const char* name) {
+    if (strcmp(name, "list") == 0) return CardLayout::LIST;
+    return CardLayout::GRID;
+}
+
+const char* scheduleAnchorName(ScheduleAnchor anchor) {
+    switch (anchor) {
+        case ScheduleAnchor::SUNRISE: return "sunrise";
+        case ScheduleAnchor::SUNSET:  return "sunset";
+        default:                      return "clock";
+    }
+}
+
+ScheduleAnchor parseScheduleAnchor(const char* name) {
+    if (strcmp(name, "sunrise") == 0) return ScheduleAnchor::SUNRISE;
+    if (strcmp(name, "sunset") == 0) return ScheduleAnchor::SUNSET;
+    return ScheduleAnchor::CLOCK;
+}
+
+// Custom theme keys, in ThemeColorRole / ThemeShapeParam order
+const char* const THEME_COLOR_KEYS[THEME_COLOR_COUNT] = {
+    "background", "card", "cardHover", "on", "off",
+    "text", "textSecondary", "accent", "border", "shadow"
+};
+const char* const THEME_SHAPE_KEYS[THEME_SHAPE_COUNT] = {
+    "cardRadius", "buttonRadius", "borderWidth", "shadowWidth",
+    "shadowOffsetY", "shadowSpread", "shadowOpacity"
+};
+const uint8_t THEME_SHAPE_MAX[THEME_SHAPE_COUNT] = { 60, 60, 8, 60, 20, 20, 255 };
+const char* const THEME_FLAG_KEYS[] = { "statusText", "glowingBorders" };
+const uint8_t THEME_FLAG_BITS[] = { THEME_FLAG_STATUS_TEXT, THEME_FLAG_GLOWING_BORDERS };
+const size_t THEME_NAME_MAX = 23;
+
+// "#rrggbb" (or without the '#') into 0xRRGGBB
+bool parseThemeColor(const char* text, uint32_t& color) {
+    if (!text) return false;
+    if (*text == '#') text++;
+    if (strlen(text) != 6) return false;
+    char* end = nullptr;
+    unsigned long value = strtoul(text, &end, 16);
+    if (*end != '\0') return false;
+    color = (uint32_t)value;
+    return true;
+}
+
+void formatThemeColor(uint32_t color, char* out) {
+    snprintf(out, 8, "#%06x", (unsigned)(color & 0xFFFFFF));
+}
+
+// Why a display.themes entry can't be used (nullptr if it can). next holds
+// the themes accepted before it.
+const char* parseCustomTheme(JsonObject obj, const DisplayConfig& next, CustomThemeConfig& theme,
+                             ConfigArena& arena) {
+    const char* name = obj["name"] | "";
+    size_t len = strlen(name);
+    if (len == 0 || len > THEME_NAME_MAX) return "name must be 1-23 characters";
+    for (size_t i = 0; i < len; i++) {
+        char c = name[i];
+        if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_')) {
+            return "name may only use a-z, 0-9 and '_'";
+        }
+    }
+    if (ThemeEngine::isBuiltinTheme(name)) return "name is a built-in theme";
+    for (const CustomThemeConfig& other : next.themes) {
+        if (strcmp(other.name.c_str(), name) == 0) return "duplicate name";
+    }
+    const char* base = obj["base"] | "dark_mode";
+    if (!ThemeEngine::isBuiltinTheme(base)) return "base is not a built-in theme";
+
+    theme = CustomThemeConfig();
+
+    JsonObject colors = obj["colors"];
+    for (uint8_t i = 0; i < THEME_COLOR_COUNT; i++) {
+        JsonVariant value = colors[THEME_COLOR_KEYS[i]];
+        if (value.isNull()) continue;
+        if (!parseThemeColor(value.as<const char*>(), theme.colors[i])) return "color is not #rrggbb";
+        theme.colorMask |= 1 << i;
+    }
+
+    JsonArray palette = obj["palette"];
+    if (palette.size() > THEME_PALETTE_SIZE) return "palette has more than 9 colors";
+    for (uint8_t i = 0; i < palette.size(); i++) {
+        if (palette[i].isNull()) continue;
+        if (!parseThemeColor(palette[i].as<const char*>(), theme.palette[i])) return "palette color is not #rrggbb";
+        theme.paletteMask |= 1 << i;
+    }
+
+    JsonObject shape = obj["shape"];
+    for (uint8_t i = 0; i < THEME_SHAPE_COUNT; i++) {
+        JsonVariant value = shape[THEME_SHAPE_KEYS[i]];
+        if (value.isNull()) continue;
+        if (!value.is<int>() || value.as<int>() < 0 || value.as<int>() > THEME_SHAPE_MAX[i]) {
+            return "shape value out of range";
+        }
+        theme.shapes[i] = value.as<int>();
+        theme.shapeMask |= 1 << i;
+    }
+
+    JsonObject flags = obj["flags"];
+    for (uint8_t i = 0; i < sizeof(THEME_FLAG_BITS); i++) {
+        JsonVariant value = flags[THEME_FLAG_KEYS[i]];
+        if (value.isNull()) continue;
+        theme.flagMask |= THEME_FLAG_BITS[i];
+        if (value.as<bool>()) theme.flags |= THEME_FLAG_BITS[i];
+    }
+
+    theme.name = arena.intern(name);
+    theme.base = arena.intern(base);
+    return nullptr;
+}
+
+const char* buttonTypeName(ButtonType type) {
+    switch (type) {
+        case ButtonType::SWITCH: return "switch";
+        case ButtonType::FAN:    return "fan";
+        case ButtonType::SCENE:  return "scene";
+        case ButtonType::SENSOR: return "sensor";
+        default:                 return "light";
+    }
+}
+
+ButtonType parseButtonType(const char* name) {
+    if (strcmp(name, "switch") == 0) return ButtonType::SWITCH;
+    if (strcmp(name, "fan") == 0) return ButtonType::FAN;
+    if (strcmp(name, "scene") == 0) return ButtonType::SCENE;
+    if (strcmp(name, "sensor") == 0) return ButtonType::SENSOR;
+    return ButtonType::LIGHT;
+}
+
+// A scene's "actions" against the config's buttons, appended to out;
+// returns how many were added. Scene buttons and unknown ids are skipped.
+// An action is {"buttonId","state","speedLevel"} or, in the wire schema,
+// [buttonId, on, speedLevel].
+uint8_t compileSceneActions(JsonArrayConst list, const DeviceConfig& config,
+                            FixedVector<SceneAction, MAX_SCENE_ACTIONS>& out) {
+    uint8_t count = 0;
+    for (JsonVariantConst entry : list) {
+        JsonArrayConst tuple = entry.as<JsonArrayConst>();
+        bool compact = !tuple.isNull();
+        const ButtonConfig* btn = nullptr;
+        uint8_t buttonId = compact ? (tuple[0] | 0) : (entry["buttonId"] | 0);
+        for (const ButtonConfig& b : config.buttons) {
+            if (b.id == buttonId) {
+                btn = &b;
+                break;
+            }
+        }
+        if (btn == nullptr || btn->type == ButtonType::SCENE || btn->type == ButtonType::SENSOR) continue;
+
+        SceneAction action;
+        action.buttonId = buttonId;
+        action.state = compact ? (tuple[1] | 0) != 0 : (entry["state"] | false);
+        action.speedLevel = NO_SCENE_SPEED;
+        bool hasSpeed = compact ? tuple.size() > 2 : entry.containsKey("speedLevel");
+        if (btn->type == ButtonType::FAN && hasSpeed) {
+            action.speedLevel = compact ? (tuple[2] | 0) : (entry["speedLevel"] | 0);
+            action.state = action.speedLevel > 0;
+        }
+        if (!out.push_back(action)) break;
+        count++;
+    }
+    return count;
+}
+
+// A button's direct control route, as the full parse and a patch read it
+void applyDirectRoute(JsonVariantConst direct, const DeviceConfig& config, ButtonConfig& button, ConfigArena& arena) {
+    uint8_t target = direct["target"] | NO_DIRECT_TARGET;
+    const char* path = direct["path"] | "";
+    bool routed = target < config.direct.size() && *path && button.type != ButtonType::SCENE &&
+                  button.type != ButtonType::SENSOR;
+    button.directTarget = routed ? target : NO_DIRECT_TARGET;
+    button.directPath = arena.intern(routed ? path : "");
+}
+
+// Every key of a patch is one the handler knows, so a typo isn't dropped
+// silently
+bool patchKeysKnown(JsonObjectConst fields, const char* const* known, size_t count) {
+    for (JsonPairConst field : fields) {
+        bool found = false;
+        for (size_t i = 0; i < count && !found; i++) {
+            found = strcmp(field.key().c_str(), known[i]) == 0;
+        }
+        if (!found) {
+            LOG_W("ConfigManager: Patch field '%s' not supported", field.key().c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+const char* cardLayoutName(CardLayout layout) {
+    return layout == CardLayout::LIST ? "list" : "grid";
+}
+
+const char* wifiProfileName(WifiProfile profile) {
+    switch (profile) {
+        case WifiProfile::LOW_LATENCY: return "low_latency";
+        case WifiProfile::LOW_POWER:   return "low_power";
+        default:                       return "balanced";
+    }
+}
+
+// ============================================================================
+// Binary storage format
+// ============================================================================
+// NVS holds the config as one versioned binary blob; JSON is only used on
+// the wire. Layout (little-endian, packed):
+//
+//   BinHeader | BinGlobal | BinButton[n] | BinScene[n] | BinPeriod[n] |
+//   BinField[n] | BinSolar (format 2+) | BinAmbient (format 3+) |
+//   BinNetwork (format 4+) | BinThemeCount, BinTheme[n] (format 5+) |
+//   BinDirectCount, BinDirectTarget[n], BinButtonDirect[buttons] (format 6+) |
+//   BinSceneActionCount, BinSceneAction[n], BinSceneRange[scenes] (format 7+) |
+//   BinMulticast, BinButtonBinding[buttons] (format 8+) | BinPeerMirror (format 9+) |
+//   string table
+//
+// Older formats still load, with the settings they lack at defaults.
+//
+// Every string is a uint16 offset into the NUL-terminated string table
+// (offset 0 is always ""). The CRC covers everything after the header, and
+// the whole blob is validated before any of it is copied into config.
+
+namespace {
+
+const uint32_t BIN_MAGIC = 0x31474643;   // "CFG1"
+const uint16_t BIN_FORMAT = 9;
+const uint16_t BIN_FORMAT_SOLAR = 2;        // Oldest with BinSolar
+const uint16_t BIN_FORMAT_AMBIENT = 3;      // Oldest with BinAmbient
+const uint16_t BIN_FORMAT_NETWORK = 4;      // Oldest with BinNetwork
+const uint16_t BIN_FORMAT_THEMES = 5;       // Oldest with BinThemeCount/BinTheme
+const uint16_t BIN_FORMAT_DIRECT = 6;       // Oldest with direct control targets
+const uint16_t BIN_FORMAT_SCENE_ACTIONS = 7; // Oldest with compiled scenes
+const uint16_t BIN_FORMAT_MULTICAST = 8;    // Oldest with state multicast and binding ids
+const uint16_t BIN_FORMAT_PEER_MIRROR = 9;  // Oldest with ESP-NOW peer mirroring
+const uint16_t BIN_FORMAT_MIN = 1;
+
+const uint8_t BIN_FLAG_DAYNIGHT = 0x01;
+const uint8_t BIN_FLAG_LCARS = 0x02;
+const uint8_t BIN_FLAG_SCHEDULE = 0x04;
+const uint8_t BIN_FLAG_LIST_LAYOUT = 0x08;  // Older formats leave it clear: grid
+const uint8_t BIN_FLAG_CARD_TILES = 0x10;
+
+const uint8_t BIN_SOLAR_CURVE = 0x01;
+const uint8_t BIN_SOLAR_FOLLOW_SUN = 0x02;
+
+struct __attribute__((packed)) BinHeader {
+    uint32_t magic;
+    uint16_t format;
+    uint16_t headerSize;
+    uint32_t length;        // Total blob size, header included
+    uint32_t crc;           // CRC32 of bytes [headerSize, length)
+    uint8_t buttonCount;
+    uint8_t sceneCount;
+    uint8_t periodCount;
+    uint8_t fieldCount;
+    uint16_t stringsSize;
+};
+
+struct __attribute__((packed)) BinGlobal {
+    uint8_t version;
+    uint8_t brightness;
+    uint8_t flags;
+    uint8_t dayStartHour;
+    uint8_t nightStartHour;
+    uint8_t touchBrightness;
+    uint16_t displayTimeout;
+    uint16_t deviceId, deviceName, deviceLocation;
+    uint16_t theme, dayTheme, nightTheme;
+    uint16_t colorScheme, headerLeft, headerRight, footerLeft, footerRight;
+    uint16_t sidebarTop, sidebarBottom;
+    uint16_t timezone;
+    uint16_t reportingUrl;
+};
+
+struct __attribute__((packed)) BinButton {
+    uint8_t id;
+    uint8_t type;
+    uint8_t state;
+    uint8_t speedSteps;
+    uint8_t speedLevel;
+    uint16_t name, icon, subtitle, sceneId;
+};
+
+struct __attribute__((packed)) BinScene {
+    uint8_t id;
+    uint16_t name, icon;
+};
+
+struct __attribute__((packed)) BinPeriod {
+    uint8_t startHour;
+    uint8_t startMinute;
+    uint8_t brightness;
+    uint16_t name;
+};
+
+struct __attribute__((packed)) BinField {
+    uint16_t id, value, style;
+};
+
+// Schedule curve mode, location and per-period anchors
+struct __attribute__((packed)) BinSolar {
+    uint8_t flags;
+    float latitude;
+    float longitude;
+    uint8_t anchor[MAX_SCHEDULE_PERIODS];
+    int16_t offsetMinutes[MAX_SCHEDULE_PERIODS];
+};
+
+struct __attribute__((packed)) BinAmbient {
+    uint8_t enabled;
+    uint8_t minBrightness;
+    uint8_t maxBrightness;
+    uint16_t luxAtMax;
+};
+
+struct __attribute__((packed)) BinNetwork {
+    uint8_t wifiProfile;
+    uint8_t dimProfile;
+};
+
+// Custom themes; the count comes first because the header has no field for it
+struct __attribute__((packed)) BinThemeCount {
+    uint8_t count;
+};
+
+struct __attribute__((packed)) BinTheme {
+    uint16_t name, base;
+    uint16_t colorMask, paletteMask;
+    uint8_t shapeMask, flagMask, flags;
+    uint32_t colors[THEME_COLOR_COUNT];
+    uint32_t palette[THEME_PALETTE_SIZE];
+    uint8_t shapes[THEME_SHAPE_COUNT];
+};
+
+// Direct control targets, then every button's route (in button order)
+struct __attribute__((packed)) BinDirectCount {
+    uint8_t count;
+};
+
+struct __attribute__((packed)) BinDirectTarget {
+    uint16_t url, auth, onBody, offBody, speedBody;
+};
+
+struct __attribute__((packed)) BinButtonDirect {
+    uint8_t target;
+    uint16_t path;
+};
+
+// Compiled scenes: the action table, then each scene's slice of it
+struct __attribute__((packed)) BinSceneActionCount {
+    uint8_t count;
+};
+
+struct __attribute__((packed)) BinSceneAction {
+    uint8_t buttonId;
+    uint8_t state;
+    uint8_t speedLevel;
+};
+
+struct __attribute__((packed)) BinSceneRange {
+    uint8_t first;
+    uint8_t count;
+};
+
+// State multicast group, then every button's binding id (in button order)
+struct __attribute__((packed)) BinMulticast {
+    uint8_t enabled;
+    uint8_t group[4];
+    uint16_t port;
+    uint8_t key[32];
+};
+
+struct __attribute__((packed)) BinButtonBinding {
+    uint32_t bindingId;
+};
+
+struct __attribute__((packed)) BinPeerMirror {
+    uint8_t enabled;
+    uint8_t key[32];
+};
+
+// Collects fixed records and the string table while encoding
+class BinEncoder {
+public:
+    BinEncoder() : overflow(false) { strings.push_back('\0'); }
+
+    uint16_t str(const ConfigString& value) {
+        if (value.length() == 0) return 0;
+        size_t offset = strings.size();
+        if (offset + value.length() + 1 > 0xFFFF) {
+            overflow = true;
+            return 0;
+        }
+        strings.insert(strings.end(), value.c_str(), value.c_str() + value.length() + 1);
+        return (uint16_t)offset;
+    }
+
+    template <typename T>
+    void record(const T& rec) {
+        const uint8_t* p = (const uint8_t*)&rec;
+        records.insert(records.end(), p, p + sizeof(T));
+    }
+
+    std::vector<uint8_t> records;
+    std::vector<char> strings;
+    bool overflow;
+};
+
+// Bounds-checked reader over a validated blob
+class BinDecoder {
+public:
+    BinDecoder(const uint8_t* data, size_t len, const char* strings, uint16_t stringsSize)
+        : data(data), len(len), pos(sizeof(BinHeader)), strings(strings),
+          stringsSize(stringsSize), valid(true) {}
+
+    template <typename T>
+    bool record(T& rec) {
+        if (pos + sizeof(T) > len) return valid = false;
+        memcpy(&rec, data + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+
+    const char* str(uint16_t offset) {
+        if (offset >= stringsSize) {
+            valid = false;
+            return "";
+        }
+        return strings + offset;
+    }
+
+    bool ok() const { return valid; }
+
+private:
+    const uint8_t* data;
+    size_t len;
+    size_t pos;
+    const char* strings;
+    uint16_t stringsSize;
+    bool valid;
+};
+
+} // namespace
+
+bool ConfigManager::encodeBinary(std::vector<uint8_t>& out) const {
+    ConfigSnapshot snapshot(*this);
+    const DeviceConfig& config = *snapshot;
+    BinEncoder enc;
+
+    const DisplayConfig& display = config.display;
+    BinGlobal g;
+    g.version = config.version;
+    g.brightness = display.brightness;
+    g.flags = (display.dayNight.enabled ? BIN_FLAG_DAYNIGHT : 0) |
+              (display.lcars.enabled ? BIN_FLAG_LCARS : 0) |
+              (display.schedule.enabled ? BIN_FLAG_SCHEDULE : 0) |
+              (display.cardLayout == CardLayout::LIST ? BIN_FLAG_LIST_LAYOUT : 0) |
+              (display.cardTiles ? BIN_FLAG_CARD_TILES : 0);
+    g.dayStartHour = display.dayNight.dayStartHour;
+    g.nightStartHour = display.dayNight.nightStartHour;
+    g.touchBrightness = display.schedule.touchBrightness;
+    g.displayTimeout = display.schedule.displayTimeout;
+    g.deviceId = enc.str(config.device.id);
+    g.deviceName = enc.str(config.device.name);
+    g.deviceLocation = enc.str(config.device.location);
+    g.theme = enc.str(display.theme);
+    g.dayTheme = enc.str(display.dayNight.dayTheme);
+    g.nightTheme = enc.str(display.dayNight.nightTheme);
+    g.colorScheme = enc.str(display.lcars.colorScheme);
+    g.headerLeft = enc.str(display.lcars.headerLeft);
+    g.headerRight = enc.str(display.lcars.headerRight);
+    g.footerLeft = enc.str(display.lcars.footerLeft);
+    g.footerRight = enc.str(display.lcars.footerRight);
+    g.sidebarTop = enc.str(display.lcars.sidebarTop);
+    g.sidebarBottom = enc.str(display.lcars.sidebarBottom);
+    g.timezone = enc.str(display.schedule.timezone);
+    g.reportingUrl = enc.str(config.server.reportingUrl);
+    enc.record(g);
+
+    for (const ButtonConfig& btn : config.buttons) {
+        BinButton b;
+        b.id = btn.id;
+        b.type = (uint8_t)btn.type;
+        b.state = btn.state ? 1 : 0;
+        b.speedSteps = btn.speedSteps;
+        b.speedLevel = btn.speedLevel;
+        b.name = enc.str(btn.name);
+        b.icon = enc.str(btn.icon);
+        b.subtitle = enc.str(btn.subtitle);
+        b.sceneId = enc.str(btn.sceneId);
+        enc.record(b);
+    }
+
+    for (const SceneConfig& scn : config.scenes) {
+        BinScene sc;
+        sc.id = scn.id;
+        sc.name = enc.str(scn.name);
+        sc.icon = enc.str(scn.icon);
+        enc.record(sc);
+    }
+
+    for (uint8_t i = 0; i < display.schedule.periodCount; i++) {
+        const BrightnessSchedulePeriod& period = display.schedule.periods[i];
+        BinPeriod p;
+        p.startHour = period.startHour;
+        p.startMinute = period.startMinute;
+        p.brightness = period.brightness;
+        p.name = enc.str(period.name);
+        enc.record(p);
+    }
+
+    size_t fieldCount = display.lcars.customFields.size();
+    for (size_t i = 0; i < fieldCount; i++) {
+        const LCARSTextField& field = display.lcars.customFields[i];
+        BinField f;
+        f.id = enc.str(field.id);
+        f.value = enc.str(field.value);
+        f.style = enc.str(field.style);
+        enc.record(f);
+    }
+
+    BinSolar solar;
+    memset(&solar, 0, sizeof(solar));
+    solar.flags = (display.schedule.curve ? BIN_SOLAR_CURVE : 0) |
+                  (display.dayNight.followSun ? BIN_SOLAR_FOLLOW_SUN : 0);
+    solar.latitude = display.schedule.latitude;
+    solar.longitude = display.schedule.longitude;
+    for (uint8_t i = 0; i < display.schedule.periodCount; i++) {
+        solar.anchor[i] = (uint8_t)display.schedule.periods[i].anchor;
+        solar.offsetMinutes[i] = display.schedule.periods[i].offsetMinutes;
+    }
+    enc.record(solar);
+
+    BinAmbient ambient;
+    ambient.enabled = display.ambient.enabled ? 1 : 0;
+    ambient.minBrightness = display.ambient.minBrightness;
+    ambient.maxBrightness = display.ambient.maxBrightness;
+    ambient.luxAtMax = display.ambient.luxAtMax;
+    enc.record(ambient);
+
+    BinNetwork network;
+    network.wifiProfile = (uint8_t)config.network.wifiProfile;
+    network.dimProfile = (uint8_t)config.network.dimProfile;
+    enc.record(network);
+
+    BinThemeCount themeCount;
+    themeCount.count = display.themes.size();
+    enc.record(themeCount);
+    for (const CustomThemeConfig& theme : display.themes) {
+        BinTheme t;
+        t.name = enc.str(theme.name);
+        t.base = enc.str(theme.base);
+        t.colorMask = theme.colorMask;
+        t.paletteMask = theme.paletteMask;
+        t.shapeMask = theme.shapeMask;
+        t.flagMask = theme.flagMask;
+        t.flags = theme.flags;
+        memcpy(t.colors, theme.colors, sizeof(t.colors));
+        memcpy(t.palette, theme.palette, sizeof(t.palette));
+        memcpy(t.shapes, theme.shapes, sizeof(t.shapes));
+        enc.record(t);
+    }
+
+    BinDirectCount directCount;
+    directCount.count = config.direct.size();
+    enc.record(directCount);
+    for (const DirectTargetConfig& target : config.direct) {
+        BinDirectTarget d;
+        d.url = enc.str(target.url);
+        d.auth = enc.str(target.auth);
+        d.onBody = enc.str(target.onBody);
+        d.offBody = enc.str(target.offBody);
+        d.speedBody = enc.str(target.speedBody);
+        enc.record(d);
+    }
+    for (const ButtonConfig& btn : config.buttons) {
+        BinButtonDirect d;
+        d.target = btn.directTarget;
+        d.path = enc.str(btn.directPath);
+        enc.record(d);
+    }
+
+    BinSceneActionCount actionCount;
+    actionCount.count = config.sceneActions.size();
+    enc.record(actionCount);
+    for (const SceneAction& action : config.sceneActions) {
+        BinSceneAction a;
+        a.buttonId = action.buttonId;
+        a.state = action.state ? 1 : 0;
+        a.speedLevel = action.speedLevel;
+        enc.record(a);
+    }
+    for (const SceneConfig& scn : config.scenes) {
+        BinSceneRange r;
+        r.first = scn.firstAction;
+        r.count = scn.actionCount;
+        enc.record(r);
+    }
+
+    const StateMulticastConfig& multicast = config.network.multicast;
+    BinMulticast m;
+    m.enabled = multicast.enabled ? 1 : 0;
+    memcpy(m.group, multicast.group, sizeof(m.group));
+    m.port = multicast.port;
+    memcpy(m.key, multicast.key, sizeof(m.key));
+    enc.record(m);
+    for (const ButtonConfig& btn : config.buttons) {
+        BinButtonBinding b;
+        b.bindingId = btn.bindingId;
+        enc.record(b);
+    }
+
+    BinPeerMirror pm;
+    pm.enabled = config.network.peerMirror.enabled ? 1 : 0;
+    memcpy(pm.key, config.network.peerMirror.key, sizeof(pm.key));
+    enc.record(pm);
+
+    if (enc.overflow) {
+        LOG_W("ConfigManager: Config strings exceed binary format limit");
+        return false;
+    }
+
+    BinHeader h;
+    h.magic = BIN_MAGIC;
+    h.format = BIN_FORMAT;
+    h.headerSize = sizeof(BinHeader);
+    h.length = sizeof(BinHeader) + enc.records.size() + enc.strings.size();
+    h.buttonCount = config.buttons.size();
+    h.sceneCount = config.scenes.size();
+    h.periodCount = display.schedule.periodCount;
+    h.fieldCount = fieldCount;
+    h.stringsSize = enc.strings.size();
+
+    out.clear();
+    out.reserve(h.length);
+    out.resize(sizeof(BinHeader));
+    out.insert(out.end(), enc.records.begin(), enc.records.end());
+    out.insert(out.end(), enc.strings.begin(), enc.strings.end());
+    h.crc = esp_rom_crc32_le(0, out.data() + sizeof(BinHeader), h.length - sizeof(BinHeader));
+    memcpy(out.data(), &h, sizeof(BinHeader));
+    return true;
+}
+
+bool ConfigManager::decodeBinary(const uint8_t* data, size_t len) {
+    if (len < sizeof(BinHeader)) return false;
+
+    BinHeader h;
+    memcpy(&h, data, sizeof(BinHeader));
+    bool hasSolar = h.format >= BIN_FORMAT_SOLAR;
+    bool hasAmbient = h.format >= BIN_FORMAT_AMBIENT;
+    bool hasNetwork = h.format >= BIN_FORMAT_NETWORK;
+    bool hasThemes = h.format >= BIN_FORMAT_THEMES;
+    bool hasDirect = h.format >= BIN_FORMAT_DIRECT;
+    bool hasSceneActions = h.format >= BIN_FORMAT_SCENE_ACTIONS;
+    bool hasMulticast = h.format >= BIN_FORMAT_MULTICAST;
+    bool hasPeerMirror = h.format >= BIN_FORMAT_PEER_MIRROR;
+    if (h.magic != BIN_MAGIC || h.format < BIN_FORMAT_MIN || h.format > BIN_FORMAT ||
+        h.headerSize != sizeof(BinHeader)) {
+        LOG_I("ConfigManager: Unknown binary config format");
+        return false;
+    }
+    if (h.buttonCount > MAX_BUTTONS || h.sceneCount > MAX_SCENES ||
+        h.periodCount > MAX_SCHEDULE_PERIODS || h.fieldCount > MAX_LCARS_FIELDS) {
+        LOG_W("ConfigManager: Binary config counts out of range");
+        return false;
+    }
+
+    size_t expected = sizeof(BinHeader) + sizeof(BinGlobal) +
+                      h.buttonCount * sizeof(BinButton) + h.sceneCount * sizeof(BinScene) +
+                      h.periodCount * sizeof(BinPeriod) + h.fieldCount * sizeof(BinField) +
+                      (hasSolar ? sizeof(BinSolar) : 0) + (hasAmbient ? sizeof(BinAmbient) : 0) +
+                      (hasNetwork ? sizeof(BinNetwork) : 0) + h.stringsSize;
+    uint8_t themeCount = 0;
+    if (hasThemes) {
+        // Peek the theme count, which sits right before the string table
+        size_t countAt = expected - h.stringsSize;
+        if (countAt + sizeof(BinThemeCount) > len) {
+            LOG_W("ConfigManager: Binary config size mismatch");
+            return false;
+        }
+        themeCount = data[countAt];
+        if (themeCount > MAX_CUSTOM_THEMES) {
+            LOG_W("ConfigManager: Binary config counts out of range");
+            return false;
+        }
+        expected += sizeof(BinThemeCount) + themeCount * sizeof(BinTheme);
+    }
+    uint8_t directCount = 0;
+    if (hasDirect) {
+        // Same again for the direct target count, right after the themes
+        size_t countAt = expected - h.stringsSize;
+        if (countAt + sizeof(BinDirectCount) > len) {
+            LOG_W("ConfigManager: Binary config size mismatch");
+            return false;
+        }
+        directCount = data[countAt];
+        if (directCount > MAX_DIRECT_TARGETS) {
+            LOG_W("ConfigManager: Binary config counts out of range");
+            return false;
+        }
+        expected += sizeof(BinDirectCount) + directCount * sizeof(BinDirectTarget) +
+                    h.buttonCount * sizeof(BinButtonDirect);
+    }
+    uint8_t sceneActionCount = 0;
+    if (hasSceneActions) {
+        // And the scene action count, right after the direct section
+        size_t countAt = expected - h.stringsSize;
+        if (countAt + sizeof(BinSceneActionCount) > len) {
+            LOG_W("ConfigManager: Binary config size mismatch");
+            return false;
+        }
+        sceneActionCount = data[countAt];
+        if (sceneActionCount > MAX_SCENE_ACTIONS) {
+            LOG_W("ConfigManager: Binary config counts out of range");
+            return false;
+        }
+        expected += sizeof(BinSceneActionCount) + sceneActionCount * sizeof(BinSceneAction) +
+                    h.sceneCount * sizeof(BinSceneRange);
+    }
+    if (hasMulticast) {
+        expected += sizeof(BinMulticast) + h.buttonCount * sizeof(BinButtonBinding);
+    }
+    if (hasPeerMirror) {
+        expected += sizeof(BinPeerMirror);
+    }
+    if (h.length != len || expected != len || h.stringsSize == 0) {
+        LOG_W("ConfigManager: Binary config size mismatch");
+        return false;
+    }
+
+    const char* strings = (const char*)data + len - h.stringsSize;
+    if (strings[0] != '\0' || strings[h.stringsSize - 1] != '\0') {
+        LOG_W("ConfigManager: Binary config string table corrupt");
+        return false;
+    }
+    if (esp_rom_crc32_le(0, data + sizeof(BinHeader), len - sizeof(BinHeader)) != h.crc) {
+        LOG_W("ConfigManager: Binary config CRC mismatch");
+        return false;
+    }
+
+    // Decode into the spare slot so a bad blob never touches the live config
+    BinDecoder dec(data, len, strings, h.stringsSize);
+    ConfigSlot& slot = beginUpdate(false);
+    DeviceConfig& next = slot.config;
+    ConfigArena& arena = slot.arena;
+
+    BinGlobal g;
+    dec.record(g);
+    next.version = g.version;
+    next.device.id = arena.intern(dec.str(g.deviceId));
+    next.device.name = arena.intern(dec.str(g.deviceName));
+    next.device.title = arena.internDisplay(next.device.name.c_str());
+    next.device.location = arena.intern(dec.str(g.deviceLocation));
+
+    DisplayConfig& display = next.display;
+    display.brightness = g.brightness;
+    display.theme = arena.intern(dec.str(g.theme));
+    display.dayNight.enabled = g.flags & BIN_FLAG_DAYNIGHT;
+    display.dayNight.dayTheme = arena.intern(dec.str(g.dayTheme));
+    display.dayNight.nightTheme = arena.intern(dec.str(g.nightTheme));
+    display.dayNight.dayStartHour = g.dayStartHour;
+    display.dayNight.nightStartHour = g.nightStartHour;
+    display.lcars.enabled = g.flags & BIN_FLAG_LCARS;
+    display.lcars.colorScheme = arena.intern(dec.str(g.colorScheme));
+    display.lcars.headerLeft = arena.intern(dec.str(g.headerLeft));
+    display.lcars.headerRight = arena.intern(dec.str(g.headerRight));
+    display.lcars.footerLeft = arena.intern(dec.str(g.footerLeft));
+    display.lcars.footerRight = arena.intern(dec.str(g.footerRight));
+    display.lcars.sidebarTop = arena.intern(dec.str(g.sidebarTop));
+    display.lcars.sidebarBottom = arena.intern(dec.str(g.sidebarBottom));
+    display.schedule.enabled = g.flags & BIN_FLAG_SCHEDULE;
+    display.cardLayout = (g.flags & BIN_FLAG_LIST_LAYOUT) ? CardLayout::LIST : CardLayout::GRID;
+    display.cardTiles = g.flags & BIN_FLAG_CARD_TILES;
+    display.schedule.timezone = arena.intern(dec.str(g.timezone));
+    display.schedule.touchBrightness = g.touchBrightness;
+    display.schedule.displayTimeout = g.displayTimeout;
+    next.server.reportingUrl = arena.intern(dec.str(g.reportingUrl));
+
+    for (uint8_t i = 0; i < h.buttonCount; i++) {
+        BinButton b;
+        dec.record(b);
+        if (b.type > (uint8_t)ButtonType::SENSOR) {
+            abortUpdate();
+            LOG_W("ConfigManager: Binary config has unknown button type");
+            return false;
+        }
+
+        ButtonConfig button;
+        button.id = b.id;
+        button.type = (ButtonType)b.type;
+        button.state = b.state != 0;
+        button.speedSteps = b.speedSteps;
+        button.speedLevel = b.speedLevel;
+        button.name = arena.internDisplay(dec.str(b.name));
+        button.icon = arena.intern(dec.str(b.icon));
+        button.iconId = resolveIcon(button.icon.c_str());
+        button.subtitle = arena.intern(dec.str(b.subtitle));
+        button.sceneId = arena.intern(dec.str(b.sceneId));
+        button.directTarget = NO_DIRECT_TARGET;
+        button.bindingId = 0;
+        next.buttons.push_back(button);
+    }
+
+    for (uint8_t i = 0; i < h.sceneCount; i++) {
+        BinScene sc;
+        dec.record(sc);
+        SceneConfig scene;
+        scene.id = sc.id;
+        scene.name = arena.internDisplay(dec.str(sc.name));
+        scene.icon = arena.intern(dec.str(sc.icon));
+        scene.iconId = resolveIcon(scene.icon.c_str());
+        next.scenes.push_back(scene);
+    }
+
+    display.schedule.periodCount = h.periodCount;
+    for (uint8_t i = 0; i < h.periodCount; i++) {
+        BinPeriod p;
+        dec.record(p);
+        display.schedule.periods[i].name = arena.intern(dec.str(p.name));
+        display.schedule.periods[i].startHour = p.startHour;
+        display.schedule.periods[i].startMinute = p.startMinute;
+        display.schedule.periods[i].brightness = p.brightness;
+        display.schedule.periods[i].anchor = ScheduleAnchor::CLOCK;
+        display.schedule.periods[i].offsetMinutes = 0;
+    }
+
+    for (uint8_t i = 0; i < h.fieldCount; i++) {
+        BinField f;
+        dec.record(f);
+        LCARSTextField field;
+        field.id = arena.intern(dec.str(f.id));
+        field.value = arena.intern(dec.str(f.value));
+        field.style = arena.intern(dec.str(f.style));
+        display.lcars.customFields.push_back(field);
+    }
+
+    display.schedule.curve = false;
+    display.schedule.latitude = NAN;
+    display.schedule.longitude = NAN;
+    display.dayNight.followSun = false;
+    if (hasSolar) {
+        BinSolar solar;
+        dec.record(solar);
+        display.schedule.curve = solar.flags & BIN_SOLAR_CURVE;
+        display.dayNight.followSun = solar.flags & BIN_SOLAR_FOLLOW_SUN;
+        display.schedule.latitude = solar.latitude;
+        display.schedule.longitude = solar.longitude;
+        for (uint8_t i = 0; i < h.periodCount; i++) {
+            if (solar.anchor[i] > (uint8_t)ScheduleAnchor::SUNSET) {
+                abortUpdate();
+                LOG_W("ConfigManager: Binary config has unknown schedule anchor");
+                return false;
+            }
+            display.schedule.periods[i].anchor = (ScheduleAnchor)solar.anchor[i];
+            display.schedule.periods[i].offsetMinutes = solar.offsetMinutes[i];
+        }
+    }
+
+    setAmbientDefaults(display.ambient);
+    if (hasAmbient) {
+        BinAmbient ambient;
+        dec.record(ambient);
+        display.ambient.enabled = ambient.enabled != 0;
+        display.ambient.minBrightness = ambient.minBrightness;
+        display.ambient.maxBrightness = ambient.maxBrightness;
+        display.ambient.luxAtMax = ambient.luxAtMax;
+    }
+
+    setNetworkDefaults(next.network);
+    if (hasNetwork) {
+        BinNetwork network;
+        dec.record(network);
+        if (network.wifiProfile > (uint8_t)WifiProfile::LOW_POWER ||
+            network.dimProfile > (uint8_t)WifiProfile::LOW_POWER) {
+            abortUpdate();
+            LOG_W("ConfigManager: Binary config has unknown WiFi profile");
+            return false;
+        }
+        next.network.wifiProfile = (WifiProfile)network.wifiProfile;
+        next.network.dimProfile = (WifiProfile)network.dimProfile;
+    }
+
+    if (hasThemes) {
+        BinThemeCount count;
+        dec.record(count);
+        for (uint8_t i = 0; i < themeCount; i++) {
+            BinTheme t;
+            dec.record(t);
+            CustomThemeConfig theme;
+            theme.name = arena.intern(dec.str(t.name));
+            theme.base = arena.intern(dec.str(t.base));
+            theme.colorMask = t.colorMask;
+            theme.paletteMask = t.paletteMask;
+            theme.shapeMask = t.shapeMask;
+            theme.flagMask = t.flagMask;
+            theme.flags = t.flags;
+            memcpy(theme.colors, t.colors, sizeof(theme.colors));
+            memcpy(theme.palette, t.palette, sizeof(theme.palette));
+            memcpy(theme.shapes, t.shapes, sizeof(theme.shapes));
+            display.themes.push_back(theme);
+        }
+    }
+    resolveThemes(display);
+
+    if (hasDirect) {
+        BinDirectCount count;
+        dec.record(count);
+        for (uint8_t i = 0; i < directCount; i++) {
+            BinDirectTarget d;
+            dec.record(d);
+            DirectTargetConfig target;
+            target.url = arena.intern(dec.str(d.url));
+            target.auth = arena.intern(dec.str(d.auth));
+            target.onBody = arena.intern(dec.str(d.onBody));
+            target.offBody = arena.intern(dec.str(d.offBody));
+            target.speedBody = arena.intern(dec.str(d.speedBody));
+            next.direct.push_back(target);
+        }
+        for (ButtonConfig& button : next.buttons) {
+            BinButtonDirect d;
+            dec.record(d);
+            button.directTarget = d.target < directCount ? d.target : NO_DIRECT_TARGET;
+            button.directPath = arena.intern(dec.str(d.path));
+        }
+    }
+
+    if (hasSceneActions) {
+        BinSceneActionCount count;
+        dec.record(count);
+        for (uint8_t i = 0; i < sceneActionCount; i++) {
+            BinSceneAction a;
+            dec.record(a);
+            SceneAction action;
+            action.buttonId = a.buttonId;
+            action.state = a.state != 0;
+            action.speedLevel = a.speedLevel;
+            next.sceneActions.push_back(action);
+        }
+        for (SceneConfig& scene : next.scenes) {
+            BinSceneRange r;
+            dec.record(r);
+            if (r.first + r.count > sceneActionCount) {
+                abortUpdate();
+                LOG_W("ConfigManager: Binary config scene actions out of range");
+                return false;
+            }
+            scene.firstAction = r.first;
+            scene.actionCount = r.count;
+        }
+    } else {
+        for (SceneConfig& scene : next.scenes) {
+            compileBuiltinScene(next, scene);
+        }
+    }
+
+    if (hasMulticast) {
+        BinMulticast m;
+        dec.record(m);
+        StateMulticastConfig& multicast = next.network.multicast;
+        multicast.enabled = m.enabled != 0 && m.group[0] >= 224 && m.group[0] <= 239 && m.port != 0;
+        memcpy(multicast.group, m.group, sizeof(multicast.group));
+        multicast.port = m.port;
+        memcpy(multicast.key, m.key, sizeof(multicast.key));
+        for (ButtonConfig& button : next.buttons) {
+            BinButtonBinding b;
+            dec.record(b);
+            button.bindingId = b.bindingId;
+        }
+    }
+    if (hasPeerMirror) {
+        BinPeerMirror pm;
+        dec.record(pm);
+        next.network.peerMirror.enabled = pm.enabled != 0;
+        memcpy(next.network.peerMirror.key, pm.key, sizeof(pm.key));
+    }
+
+    if (!dec.ok()) {
+        abortUpdate();
+        LOG_W("ConfigManager: Binary config string reference out of range");
+        return false;
+    }
+
+    if (!commitUpdate()) {
+        return false;
+    }
+    configured = true;
+    return true;
+}
+
+ConfigManager::ConfigManager()
+    : activeSlot(0)
+    , writeMutex(nullptr)
+    , generation(0)
+    , serverConfigHash(0)
+    , pendingConfigHash(0)
+    , configured(false)
+    , lastParseError(nullptr)
+    , iconLookup(nullptr)
+    , persistHandle(nullptr)
+    , dirtyMux(portMUX_INITIALIZER_UNLOCKED)
+    , dirtySections(0)
+    , lastDirtyAt(0)
+    , persistWrites(0)
+{
+    for (int i = 0; i < 2; i++) {
+        readers[i].store(0);
+        memset(slots[i].buttonIndexById, NO_BUTTON, sizeof(slots[i].buttonIndexById));
+        slots[i].bindingCount = 0;
+    }
 }
 
 void ConfigManager::begin() {
-    Serial.println("ConfigManager: Initializing...");
+    LOG_I("ConfigManager: Initializing...");
+
+    writeMutex = xSemaphoreCreateRecursiveMutex();
+    for (ConfigSlot& slot : slots) {
+        slot.arena.begin(CONFIG_ARENA_SIZE);
+    }
 
     // Try to load saved configuration
     if (!loadConfig()) {
-        Serial.println("ConfigManager: No saved config, using defaults");
+        LOG_I("ConfigManager: No saved config, using defaults");
         createDefaultConfig();
     }
 
-    Serial.printf("ConfigManager: Device ID: %s\n", config.device.id.c_str());
-    Serial.printf("ConfigManager: Theme: %s\n", config.display.theme.c_str());
-    Serial.printf("ConfigManager: Buttons: %d, Scenes: %d\n",
-                  config.buttons.size(), config.scenes.size());
+    // Before the first request: the config fetch may already be HTTPS
+    String ca = getServerCa();
+    if (ca.length() > 0) {
+        httpPool.setCACert(ca.c_str());
+    }
+
+    const DeviceConfig& config = live();
+    LOG_I("ConfigManager: Device ID: %s", config.device.id.c_str());
+    LOG_I("ConfigManager: Theme: %s", config.display.theme.c_str());
+    LOG_I("ConfigManager: Buttons: %d, Scenes: %d (%u string bytes)",
+                  config.buttons.size(), config.scenes.size(),
+                  slots[activeSlot.load()].arena.bytesUsed());
+
+    // Low-priority writer for markDirty(); flash writes never block callers
+    xTaskCreatePinnedToCore(
+        persistTask,
+        "ConfigPersist",
+        4096,
+        this,
+        tskIDLE_PRIORITY + 1,
+        &persistHandle,
+        0
+    );
 }
 
 bool ConfigManager::loadConfig() {
     Preferences prefs;
     if (!prefs.begin(NVS_NAMESPACE, true)) {
-        Serial.println("ConfigManager: Failed to open NVS");
+        LOG_E("ConfigManager: Failed to open NVS");
+        return false;
+    }
+
+    size_t length = prefs.getBytesLength(NVS_CONFIG_BIN_KEY);
+    if (length > 0) {
+        uint8_t* blob = (uint8_t*)heap_caps_malloc(length, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!blob) {
+            blob = (uint8_t*)malloc(length);
+        }
+        bool ok = blob && prefs.getBytes(NVS_CONFIG_BIN_KEY, blob, length) == length &&
+                  decodeBinary(blob, length);
+        free(blob);
+        prefs.end();
+
+        if (ok) {
+            LOG_I("ConfigManager: Loaded binary config from NVS (%u bytes)", length);
+            return true;
+        }
+        LOG_W("ConfigManager: Stored binary config invalid");
         return false;
     }
 
+    // Older firmware stored the config as a JSON string; parse it once and
+    // rewrite it in the binary format
     String json = prefs.getString(NVS_CONFIG_KEY, "");
     prefs.end();
 
     if (json.length() == 0) {
-        Serial.println("ConfigManager: No config in NVS");
+        LOG_I("ConfigManager: No config in NVS");
         return false;
     }
 
-    Serial.println("ConfigManager: Loading config from NVS...");
-    return parseConfigJson(json);
+    LOG_I("ConfigManager: Migrating JSON config in NVS to binary...");
+    if (!parseConfigJson(json)) {
+        return false;
+    }
+    saveConfig();
+    return true;
 }
 
 bool ConfigManager::saveConfig() {
-    String json = toJson();
-    if (json.length() == 0) {
-        Serial.println("ConfigManager: Failed to serialize config");
+    std::vector<uint8_t> blob;
+    if (!encodeBinary(blob)) {
+        LOG_E("ConfigManager: Failed to serialize config");
         return false;
     }
 
     Preferences prefs;
     if (!prefs.begin(NVS_NAMESPACE, false)) {
-        Serial.println("ConfigManager: Failed to open NVS for writing");
+        LOG_E("ConfigManager: Failed to open NVS for writing");
         return false;
     }
 
-    bool success = prefs.putString(NVS_CONFIG_KEY, json);
+    bool success = prefs.putBytes(NVS_CONFIG_BIN_KEY, blob.data(), blob.size()) == blob.size();
+    if (success && prefs.isKey(NVS_CONFIG_KEY)) {
+        prefs.remove(NVS_CONFIG_KEY);
+    }
     prefs.end();
 
     if (success) {
-        Serial.println("ConfigManager: Config saved to NVS");
+        LOG_I("ConfigManager: Config saved to NVS (%u bytes)", blob.size());
     } else {
-        Serial.println("ConfigManager: Failed to save config to NVS");
+        LOG_E("ConfigManager: Failed to save config to NVS");
     }
 
     return success;
 }
 
-bool ConfigManager::parseConfigJson(const String& json) {
-    DynamicJsonDocument doc(6144);
-    DeserializationError error = deserializeJson(doc, json);
+// ============================================================================
+// Write-behind persistence
+// ============================================================================
+
+void ConfigManager::markDirty(uint8_t sections) {
+    portENTER_CRITICAL(&dirtyMux);
+    dirtySections |= sections;
+    lastDirtyAt = millis();
+    portEXIT_CRITICAL(&dirtyMux);
+
+    if (persistHandle) {
+        xTaskNotifyGive(persistHandle);
+    }
+}
+
+void ConfigManager::flush() {
+    portENTER_CRITICAL(&dirtyMux);
+    uint8_t sections = dirtySections;
+    dirtySections = 0;
+    portEXIT_CRITICAL(&dirtyMux);
+
+    if (sections && !saveConfig()) {
+        markDirty(sections);
+    }
+}
+
+void ConfigManager::persistTask(void* parameter) {
+    ConfigManager* self = (ConfigManager*)parameter;
+    TickType_t wait = portMAX_DELAY;
+
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, wait);
+
+        portENTER_CRITICAL(&self->dirtyMux);
+        uint8_t sections = self->dirtySections;
+        unsigned long elapsed = millis() - self->lastDirtyAt;
+        bool due = sections && elapsed >= PERSIST_DELAY_MS;
+        if (due) {
+            self->dirtySections = 0;
+        }
+        portEXIT_CRITICAL(&self->dirtyMux);
+
+        if (!sections) {
+            wait = portMAX_DELAY;
+            continue;
+        }
+        if (!due) {
+            // Every markDirty() pushes the deadline out again
+            wait = pdMS_TO_TICKS(PERSIST_DELAY_MS - elapsed);
+            continue;
+        }
+
+        LOG_I("ConfigManager: Persisting config (sections 0x%02x)", sections);
+        if (self->saveConfig()) {
+            self->persistWrites++;
+        } else {
+            // Keep the changes pending and retry after another window
+            self->markDirty(sections);
+        }
+        wait = pdMS_TO_TICKS(PERSIST_DELAY_MS);
+    }
+}
+
+// ============================================================================
+// JSON parsing
+// ============================================================================
+// Config documents are deserialized through a filter, so only keys that
+// applyConfigDoc() reads are materialized, into a PSRAM document whose
+// capacity is measured from the input instead of guessed.
+
+namespace {
+
+// Button and scene keys of each schema (see CONFIG_WIRE_SCHEMA)
+struct ButtonKeys {
+    const char* id;
+    const char* type;
+    const char* name;
+    const char* icon;
+    const char* state;
+    const char* subtitle;
+    const char* speedSteps;
+    const char* speedLevel;
+    const char* sceneId;
+    const char* direct;
+    const char* bid;
+};
+
+struct SceneKeys {
+    const char* id;
+    const char* name;
+    const char* icon;
+    const char* actions;
+};
+
+const ButtonKeys FULL_BUTTON_KEYS = {
+    "id", "type", "name", "icon", "state", "subtitle", "speedSteps", "speedLevel", "sceneId", "direct", "bid"
+};
+const ButtonKeys WIRE_BUTTON_KEYS = { "i", "t", "n", "ic", "s", "sub", "ss", "sl", "sc", "d", "b" };
+const SceneKeys FULL_SCENE_KEYS = { "id", "name", "icon", "actions" };
+const SceneKeys WIRE_SCENE_KEYS = { "i", "n", "ic", "a" };
+
+bool isButtonType(const char* name) {
+    return name && (strcmp(name, "light") == 0 || strcmp(name, "switch") == 0 ||
+                    strcmp(name, "fan") == 0 || strcmp(name, "scene") == 0 ||
+                    strcmp(name, "sensor") == 0);
+}
+
+bool isRecordId(JsonVariantConst id) {
+    return id.is<unsigned int>() && id.as<unsigned int>() >= 1 && id.as<unsigned int>() <= 255;
+}
+
+// The wire schema's checks, before anything is applied: every button and
+// scene well formed, ids unique, counts within the panel's limits, scene
+// actions naming buttons that exist. Returns the error, nullptr if valid.
+const char* validateWireConfig(JsonDocument& doc) {
+    if (!doc["device"].is<JsonObject>() || !doc["display"].is<JsonObject>()) {
+        return "Config missing device or display";
+    }
+
+    const ButtonKeys& bk = WIRE_BUTTON_KEYS;
+    JsonArray buttons = doc["buttons"];
+    if (buttons.isNull()) return "Config missing buttons";
+    if (buttons.size() > MAX_BUTTONS) return "Too many buttons";
+    uint32_t buttonIds[8] = {};     // Bit per id, 1..255
+    uint32_t passiveIds[8] = {};    // Scene and sensor buttons, which scenes can't act on
+    size_t index = 0;
+    for (JsonVariant entry : buttons) {
+        JsonObject btn = entry.as<JsonObject>();
+        const char* error = nullptr;
+        if (btn.isNull() || !isRecordId(btn[bk.id])) {
+            error = "Button without a valid id";
+        } else if (!isButtonType(btn[bk.type].as<const char*>())) {
+            error = "Button with an unknown type";
+        } else if (!btn[bk.name].is<const char*>() ||
+                   (!btn[bk.icon].isNull() && !btn[bk.icon].is<const char*>())) {
+            error = "Button without a name, or with a malformed icon";
+        } else if ((!btn[bk.speedSteps].isNull() && !btn[bk.speedSteps].is<unsigned int>()) ||
+                   (!btn[bk.speedLevel].isNull() && !btn[bk.speedLevel].is<unsigned int>()) ||
+                   (!btn[bk.bid].isNull() && !btn[bk.bid].is<unsigned int>())) {
+            error = "Button with a non-numeric field";
+        } else if (!btn[bk.direct].isNull() && !btn[bk.direct].is<JsonObject>()) {
+            error = "Button with a malformed direct route";
+        }
+        if (error) {
+            LOG_W("ConfigManager: Button %u rejected: %s", index, error);
+            return error;
+        }
+        uint8_t id = btn[bk.id];
+        if (buttonIds[id / 32] & (1u << (id % 32))) {
+            LOG_W("ConfigManager: Button id %u appears twice", id);
+            return "Duplicate button id";
+        }
+        buttonIds[id / 32] |= 1u << (id % 32);
+        const char* type = btn[bk.type];
+        if (strcmp(type, "scene") == 0 || strcmp(type, "sensor") == 0) {
+            passiveIds[id / 32] |= 1u << (id % 32);
+        }
+        index++;
+    }
+
+    const SceneKeys& sk = WIRE_SCENE_KEYS;
+    JsonArray scenes = doc["scenes"];
+    if (scenes.size() > MAX_SCENES) return "Too many scenes";
+    uint32_t sceneIds[8] = {};
+    index = 0;
+    for (JsonVariant entry : scenes) {
+        JsonObject scn = entry.as<JsonObject>();
+        if (scn.isNull() || !isRecordId(scn[sk.id]) || !scn[sk.name].is<const char*>()) {
+            LOG_W("ConfigManager: Scene %u rejected", index);
+            return "Scene without a valid id or name";
+        }
+        uint8_t id = scn[sk.id];
+        if (sceneIds[id / 32] & (1u << (id % 32))) {
+            LOG_W("ConfigManager: Scene id %u appears twice", id);
+            return "Duplicate scene id";
+        }
+        sceneIds[id / 32] |= 1u << (id % 32);
+
+        JsonVariant actions = scn[sk.actions];
+        if (actions.isNull()) {
+            index++;
+            continue;
+        }
+        if (!actions.is<JsonArray>()) return "Scene with malformed actions";
+        for (JsonVariant action : actions.as<JsonArray>()) {
+            JsonArray tuple = action.as<JsonArray>();
+            if (tuple.isNull() || tuple.size() < 2 || tuple.size() > 3 || !isRecordId(tuple[0]) ||
+                !tuple[1].is<unsigned int>() || (tuple.size() > 2 && !tuple[2].is<unsigned int>())) {
+                LOG_W("ConfigManager: Scene %u has a malformed action", id);
+                return "Scene with malformed actions";
+            }
+            uint8_t buttonId = tuple[0];
+            bool exists = buttonIds[buttonId / 32] & (1u << (buttonId % 32));
+            bool passive = passiveIds[buttonId / 32] & (1u << (buttonId % 32));
+            if (!exists || passive) {
+                LOG_W("ConfigManager: Scene %u acts on button %u, which it can't", id, buttonId);
+                return "Scene action for an unknown button";
+            }
+        }
+        index++;
+    }
+    return nullptr;
+}
+
+// Keys applyConfigDoc() reads; keep the two in step. Arrays filter every
+// element through their first entry.
+PsramJsonDocument buildConfigFilter() {
+    PsramJsonDocument filter(2048);
+    filter["schema"] = true;
+    filter["version"] = true;
+    filter["serverTime"] = true;
+    filter["configHash"] = true;
+
+    JsonObject device = filter.createNestedObject("device");
+    device["id"] = true;
+    device["name"] = true;
+    device["location"] = true;
+
+    JsonObject display = filter.createNestedObject("display");
+    display["brightness"] = true;
+    display["theme"] = true;
+    display["layout"] = true;
+    display["cardTiles"] = true;
+
+    JsonObject dayNight = display.createNestedObject("dayNightMode");
+    dayNight["enabled"] = true;
+    dayNight["dayTheme"] = true;
+    dayNight["nightTheme"] = true;
+    dayNight["dayStartHour"] = true;
+    dayNight["nightStartHour"] = true;
+    dayNight["followSun"] = true;
+
+    JsonObject lcars = display.createNestedObject("lcars");
+    lcars["enabled"] = true;
+    lcars["colorScheme"] = true;
+    lcars["headerLeft"] = true;
+    lcars["headerRight"] = true;
+    lcars["footerLeft"] = true;
+    lcars["footerRight"] = true;
+    lcars["sidebarTop"] = true;
+    lcars["sidebarBottom"] = true;
+    JsonObject field = lcars.createNestedArray("customFields").createNestedObject();
+    field["id"] = true;
+    field["value"] = true;
+    field["style"] = true;
+
+    JsonObject schedule = display.createNestedObject("brightnessSchedule");
+    schedule["enabled"] = true;
+    schedule["mode"] = true;
+    schedule["timezone"] = true;
+    schedule["latitude"] = true;
+    schedule["longitude"] = true;
+    schedule["touchBrightness"] = true;
+    schedule["displayTimeout"] = true;
+    JsonObject period = schedule.createNestedArray("periods").createNestedObject();
+    period["name"] = true;
+    period["startHour"] = true;
+    period["startMinute"] = true;
+    period["brightness"] = true;
+    period["anchor"] = true;
+    period["offsetMinutes"] = true;
+
+    JsonObject ambient = display.createNestedObject("adaptiveBrightness");
+    ambient["enabled"] = true;
+    ambient["minBrightness"] = true;
+    ambient["maxBrightness"] = true;
+    ambient["luxAtMax"] = true;
+
+    JsonObject theme = display.createNestedArray("themes").createNestedObject();
+    theme["name"] = true;
+    theme["base"] = true;
+    theme["colors"] = true;
+    theme["palette"] = true;
+    theme["shape"] = true;
+    theme["flags"] = true;
+
+    JsonObject button = filter.createNestedArray("buttons").createNestedObject();
+    button["id"] = true;
+    button["type"] = true;
+    button["name"] = true;
+    button["icon"] = true;
+    button["state"] = true;
+    button["subtitle"] = true;
+    button["speedSteps"] = true;
+    button["speedLevel"] = true;
+    button["sceneId"] = true;
+    button["direct"] = true;
+    button["bid"] = true;
+    const ButtonKeys& bk = WIRE_BUTTON_KEYS;
+    for (const char* key : { bk.id, bk.type, bk.name, bk.icon, bk.state, bk.subtitle, bk.speedSteps,
+                             bk.speedLevel, bk.sceneId, bk.direct, bk.bid }) {
+        button[key] = true;
+    }
+
+    JsonObject direct = filter.createNestedArray("direct").createNestedObject();
+    direct["url"] = true;
+    direct["auth"] = true;
+    direct["onBody"] = true;
+    direct["offBody"] = true;
+    direct["speedBody"] = true;
+
+    JsonObject scene = filter.createNestedArray("scenes").createNestedObject();
+    scene["id"] = true;
+    scene["name"] = true;
+    scene["icon"] = true;
+    scene["actions"] = true;
+    const SceneKeys& sk = WIRE_SCENE_KEYS;
+    for (const char* key : { sk.id, sk.name, sk.icon, sk.actions }) {
+        scene[key] = true;
+    }
+
+    filter.createNestedObject("server")["reportingUrl"] = true;
+
+    JsonObject network = filter.createNestedObject("network");
+    network["wifiProfile"] = true;
+    network["dimProfile"] = true;
+
+    JsonObject multicast = filter.createNestedObject("multicast");
+    multicast["group"] = true;
+    multicast["port"] = true;
+    multicast["key"] = true;
+
+    JsonObject peerMirror = filter.createNestedObject("peerMirror");
+    peerMirror["key"] = true;
+    return filter;
+}
+
+const JsonDocument& configFilter() {
+    // Built once, on first use from whichever task parses first
+    static const PsramJsonDocument filter = buildConfigFilter();
+    return filter;
+}
+
+// Upper bound on the pool a document needs for this input: every member or
+// element takes one slot, and a container with n commas holds at most n+1,
+// so slots <= commas + containers. Copied strings (and keys) fit in len.
+size_t configDocCapacity(const char* json, size_t len, bool zeroCopy) {
+    size_t slots = 0;
+    bool inString = false;
+    for (size_t i = 0; i < len; i++) {
+        char c = json[i];
+        if (inString) {
+            if (c == '\\') {
+                i++;
+            } else if (c == '"') {
+                inString = false;
+            }
+        } else if (c == '"') {
+            inString = true;
+        } else if (c == ',' || c == '{' || c == '[') {
+            slots++;
+        }
+    }
+
+    size_t capacity = JSON_ARRAY_SIZE(slots) + (zeroCopy ? 0 : len + 1);
+    return capacity < CONFIG_DOC_MAX_SIZE ? capacity : CONFIG_DOC_MAX_SIZE;
+}
+
+} // namespace
+
+bool ConfigManager::parseConfigJson(const String& json, bool keepReportingUrl) {
+    return parseConfigDoc(json.c_str(), json.length(), false, keepReportingUrl);
+}
+
+bool ConfigManager::parseConfigJson(char* json, size_t len, bool keepReportingUrl) {
+    // Mutable input is parsed in place: strings stay in the caller's buffer
+    // instead of being copied into the document pool
+    return parseConfigDoc(json, len, true, keepReportingUrl);
+}
+
+bool ConfigManager::parseConfigDoc(const char* json, size_t len, bool zeroCopy, bool keepReportingUrl) {
+    HeapTagScope heapTag(HEAP_TAG_CONFIG);
+    size_t capacity = configDocCapacity(json, len, zeroCopy);
+    PsramJsonDocument doc(capacity);
+    if (doc.capacity() == 0) {
+        lastParseError = "Out of memory";
+        LOG_E("ConfigManager: Cannot allocate %u byte config document", capacity);
+        return false;
+    }
 
+    DeserializationOption::Filter filter(configFilter());
+    DeserializationError error = zeroCopy
+        ? deserializeJson(doc, (char*)json, len, filter)
+        : deserializeJson(doc, json, len, filter);
+
+    if (error == DeserializationError::NoMemory) {
+        lastParseError = "Config document too large";
+        LOG_W("ConfigManager: Config needs more than %u bytes of JSON document (limit %u)",
+                      capacity, CONFIG_DOC_MAX_SIZE);
+        return false;
+    }
     if (error) {
-        Serial.printf("ConfigManager: JSON parse error: %s\n", error.c_str());
+        lastParseError = error.c_str();
+        LOG_E("ConfigManager: JSON parse error: %s", error.c_str());
+        return false;
+    }
+
+    unsigned int schema = doc["schema"] | 1;
+    if (schema > CONFIG_WIRE_SCHEMA) {
+        lastParseError = "Unsupported config schema";
+        LOG_W("ConfigManager: Config schema %u is newer than this firmware (%u)", schema, CONFIG_WIRE_SCHEMA);
         return false;
     }
+    if (schema >= 2) {
+        const char* invalid = validateWireConfig(doc);
+        if (invalid) {
+            lastParseError = invalid;
+            return false;
+        }
+    }
+
+    LOG_I("ConfigManager: Parsed %u byte config (schema %u) into %u/%u byte document",
+                  len, schema, doc.memoryUsage(), capacity);
+    return applyConfigDoc(doc, keepReportingUrl);
+}
+
+bool ConfigManager::applyConfigDoc(JsonDocument& doc, bool keepReportingUrl) {
+    // Checked before anything is applied: a config holds at most
+    // MAX_LCARS_FIELDS, and one that can't be stored whole isn't accepted
+    size_t fieldCount = doc["display"]["lcars"]["customFields"].size();
+    if (fieldCount > MAX_LCARS_FIELDS) {
+        LOG_W("ConfigManager: %u LCARS custom fields, at most %u allowed",
+              (unsigned)fieldCount, MAX_LCARS_FIELDS);
+        return false;
+    }
+
+    // Build the new config in the spare slot; strings are copied once into
+    // its arena and the live config is swapped in at the end
+    ConfigSlot& slot = beginUpdate(false);
+    DeviceConfig& next = slot.config;
+    ConfigArena& arena = slot.arena;
+    pendingConfigHash = strtoul(doc["configHash"] | "0", nullptr, 16);
 
     // Parse version
-    config.version = doc["version"] | 1;
+    next.version = doc["version"] | 1;
 
     // Parse device info
     JsonObject device = doc["device"];
-    config.device.id = device["id"] | generateDeviceId();
-    config.device.name = device["name"] | "ESP32 Display";
-    config.device.location = device["location"] | "Unknown";
+    const char* deviceId = device["id"];
+    next.device.id = deviceId ? arena.intern(deviceId) : arena.intern(generateDeviceId());
+    next.device.name = arena.intern(device["name"] | "ESP32 Display");
+    next.device.title = arena.internDisplay(next.device.name.c_str());
+    next.device.location = arena.intern(device["location"] | "Unknown");
 
     // Parse display settings
     JsonObject display = doc["display"];
-    config.display.brightness = display["brightness"] | 80;
-    config.display.theme = display["theme"] | "dark_mode";
+    next.display.brightness = display["brightness"] | 80;
+    next.display.theme = arena.intern(display["theme"] | "dark_mode");
+    next.display.cardLayout = parseCardLayout(display["layout"] | "grid");
+    next.display.cardTiles = display["cardTiles"] | false;
 
     // Parse day/night mode
     JsonObject dayNight = display["dayNightMode"];
-    config.display.dayNight.enabled = dayNight["enabled"] | false;
-    config.display.dayNight.dayTheme = dayNight["dayTheme"] | "light_mode";
-    config.display.dayNight.nightTheme = dayNight["nightTheme"] | "dark_mode";
-    config.display.dayNight.dayStartHour = dayNight["dayStartHour"] | 7;
-    config.display.dayNight.nightStartHour = dayNight["nightStartHour"] | 20;
+    next.display.dayNight.enabled = dayNight["enabled"] | false;
+    next.display.dayNight.dayTheme = arena.intern(dayNight["dayTheme"] | "light_mode");
+    next.display.dayNight.nightTheme = arena.intern(dayNight["nightTheme"] | "dark_mode");
+    next.display.dayNight.dayStartHour = dayNight["dayStartHour"] | 7;
+    next.display.dayNight.nightStartHour = dayNight["nightStartHour"] | 20;
+    next.display.dayNight.followSun = dayNight["followSun"] | false;
 
     // Parse LCARS configuration
     JsonObject lcars = display["lcars"];
-    config.display.lcars.enabled = lcars["enabled"] | false;
-    config.display.lcars.colorScheme = lcars["colorScheme"] | "federation";
-    config.display.lcars.headerLeft = lcars["headerLeft"] | "STARDATE";
-    config.display.lcars.headerRight = lcars["headerRight"] | "ONLINE";
-    config.display.lcars.footerLeft = lcars["footerLeft"] | "";
-    config.display.lcars.footerRight = lcars["footerRight"] | "";
-    config.display.lcars.sidebarTop = lcars["sidebarTop"] | "";
-    config.display.lcars.sidebarBottom = lcars["sidebarBottom"] | "";
+    next.display.lcars.enabled = lcars["enabled"] | false;
+    next.display.lcars.colorScheme = arena.intern(lcars["colorScheme"] | "federation");
+    next.display.lcars.headerLeft = arena.intern(lcars["headerLeft"] | "STARDATE");
+    next.display.lcars.headerRight = arena.intern(lcars["headerRight"] | "ONLINE");
+    next.display.lcars.footerLeft = arena.intern(lcars["footerLeft"] | "");
+    next.display.lcars.footerRight = arena.intern(lcars["footerRight"] | "");
+    next.display.lcars.sidebarTop = arena.intern(lcars["sidebarTop"] | "");
+    next.display.lcars.sidebarBottom = arena.intern(lcars["sidebarBottom"] | "");
 
     // Parse LCARS custom fields
-    config.display.lcars.customFields.clear();
     JsonArray customFields = lcars["customFields"];
     for (JsonObject field : customFields) {
         LCARSTextField textField;
-        textField.id = field["id"] | "";
-        textField.value = field["value"] | "";
-        textField.style = field["style"] | "label";
-        config.display.lcars.customFields.push_back(textField);
+        textField.id = arena.intern(field["id"] | "");
+        textField.value = arena.intern(field["value"] | "");
+        textField.style = arena.intern(field["style"] | "label");
+        if (!next.display.lcars.customFields.push_back(textField)) break;
     }
 
     // Parse brightness schedule
     JsonObject schedule = display["brightnessSchedule"];
-    config.display.schedule.enabled = schedule["enabled"] | false;
-    config.display.schedule.timezone = schedule["timezone"] | "MST7MDT,M3.2.0,M11.1.0";
-    config.display.schedule.touchBrightness = schedule["touchBrightness"] | 30;
-    config.display.schedule.displayTimeout = schedule["displayTimeout"] | 30;
+    next.display.schedule.enabled = schedule["enabled"] | false;
+    next.display.schedule.curve = strcmp(schedule["mode"] | "steps", "curve") == 0;
+    next.display.schedule.timezone = arena.intern(schedule["timezone"] | "MST7MDT,M3.2.0,M11.1.0");
+    next.display.schedule.latitude = schedule["latitude"] | NAN;
+    next.display.schedule.longitude = schedule["longitude"] | NAN;
+    next.display.schedule.touchBrightness = schedule["touchBrightness"] | 30;
+    next.display.schedule.displayTimeout = schedule["displayTimeout"] | 30;
 
     // Parse schedule periods
-    config.display.schedule.periodCount = 0;
+    next.display.schedule.periodCount = 0;
     JsonArray periods = schedule["periods"];
     for (JsonObject period : periods) {
-        if (config.display.schedule.periodCount >= MAX_SCHEDULE_PERIODS) break;
+        if (next.display.schedule.periodCount >= MAX_SCHEDULE_PERIODS) break;
+
+        uint8_t idx = next.display.schedule.periodCount;
+        next.display.schedule.periods[idx].name = arena.intern(period["name"] | "Period");
+        next.display.schedule.periods[idx].startHour = period["startHour"] | 0;
+        next.display.schedule.periods[idx].startMinute = period["startMinute"] | 0;
+        next.display.schedule.periods[idx].brightness = period["brightness"] | 80;
+        next.display.schedule.periods[idx].anchor = parseScheduleAnchor(period["anchor"] | "clock");
+        int offset = period["offsetMinutes"] | 0;
+        next.display.schedule.periods[idx].offsetMinutes = offset < -720 ? -720 : (offset > 720 ? 720 : offset);
+        next.display.schedule.periodCount++;
+    }
 
-        uint8_t idx = config.display.schedule.periodCount;
-        config.display.schedule.periods[idx].name = period["name"] | "Period";
-        config.display.schedule.periods[idx].startHour = period["startHour"] | 0;
-        config.display.schedule.periods[idx].startMinute = period["startMinute"] | 0;
-        config.display.schedule.periods[idx].brightness = period["brightness"] | 80;
-        config.display.schedule.periodCount++;
+    // Parse adaptive brightness
+    JsonObject ambient = display["adaptiveBrightness"];
+    AmbientConfig& adaptive = next.display.ambient;
+    setAmbientDefaults(adaptive);
+    adaptive.enabled = ambient["enabled"] | false;
+    adaptive.maxBrightness = ambient["maxBrightness"] | adaptive.maxBrightness;
+    adaptive.minBrightness = ambient["minBrightness"] | adaptive.minBrightness;
+    adaptive.luxAtMax = ambient["luxAtMax"] | adaptive.luxAtMax;
+    if (adaptive.maxBrightness > 100) adaptive.maxBrightness = 100;
+    if (adaptive.minBrightness > adaptive.maxBrightness) adaptive.minBrightness = adaptive.maxBrightness;
+    if (adaptive.luxAtMax == 0) adaptive.luxAtMax = 1;
+
+    // Parse custom themes; a bad one is dropped, the rest of the config stands
+    JsonArray themes = display["themes"];
+    for (JsonObject obj : themes) {
+        if (next.display.themes.size() >= MAX_CUSTOM_THEMES) {
+            LOG_W("ConfigManager: More than %d custom themes, ignoring the rest", MAX_CUSTOM_THEMES);
+            break;
+        }
+        CustomThemeConfig theme;
+        const char* error = parseCustomTheme(obj, next.display, theme, arena);
+        if (error) {
+            LOG_W("ConfigManager: Ignoring theme '%s': %s", obj["name"] | "", error);
+            continue;
+        }
+        next.display.themes.push_back(theme);
+    }
+    resolveThemes(next.display);
+
+    // Parse direct control targets (before the buttons that refer to them)
+    for (JsonObject obj : doc["direct"].as<JsonArray>()) {
+        if (next.direct.size() >= MAX_DIRECT_TARGETS) break;
+        DirectTargetConfig target;
+        target.url = arena.intern(obj["url"] | "");
+        target.auth = arena.intern(obj["auth"] | "");
+        target.onBody = arena.intern(obj["onBody"] | "");
+        target.offBody = arena.intern(obj["offBody"] | "");
+        target.speedBody = arena.intern(obj["speedBody"] | "");
+        next.direct.push_back(target);
     }
 
-    // Parse buttons
-    config.buttons.clear();
+    // Parse buttons (parseConfigDoc() has validated the wire schema's)
+    bool wire = (doc["schema"] | 1) >= 2;
+    const ButtonKeys& bk = wire ? WIRE_BUTTON_KEYS : FULL_BUTTON_KEYS;
     JsonArray buttons = doc["buttons"];
     for (JsonObject btn : buttons) {
-        if (config.buttons.size() >= MAX_BUTTONS) break;
+        if (next.buttons.size() >= MAX_BUTTONS) break;
 
         ButtonConfig button;
-        button.id = btn["id"] | (config.buttons.size() + 1);
-        String typeStr = btn["type"] | "light";
-        if (typeStr == "switch") {
-            button.type = ButtonType::SWITCH;
-        } else if (typeStr == "fan") {
-            button.type = ButtonType::FAN;
-        } else if (typeStr == "scene") {
-            button.type = ButtonType::SCENE;
-        } else {
-            button.type = ButtonType::LIGHT;
-        }
-        button.name = btn["name"] | "Button";
-        button.icon = btn["icon"] | "charge";
-        button.state = btn["state"] | false;
-        button.subtitle = btn["subtitle"] | "";
-        button.speedSteps = btn["speedSteps"] | 0;  // 0 = simple on/off, 3 = low/med/high
-        button.speedLevel = btn["speedLevel"] | 0;
-        button.sceneId = btn["sceneId"] | "";  // Scene ID for scene-type buttons
-        config.buttons.push_back(button);
+        button.id = btn[bk.id] | (next.buttons.size() + 1);
+        button.type = parseButtonType(btn[bk.type] | "light");
+        button.name = arena.internDisplay(btn[bk.name] | "Button");
+        button.icon = arena.intern(btn[bk.icon] | "charge");
+        button.iconId = resolveIcon(button.icon.c_str());
+        button.state = btn[bk.state] | false;
+        button.subtitle = arena.intern(btn[bk.subtitle] | "");
+        button.speedSteps = btn[bk.speedSteps] | 0;  // 0 = simple on/off, 3 = low/med/high
+        button.speedLevel = btn[bk.speedLevel] | 0;
+        button.sceneId = arena.intern(btn[bk.sceneId] | "");  // Scene ID for scene-type buttons
+        applyDirectRoute(btn[bk.direct], next, button, arena);
+        button.bindingId = btn[bk.bid] | 0;
+        next.buttons.push_back(button);
     }
 
     // Parse scenes
-    config.scenes.clear();
+    const SceneKeys& sk = wire ? WIRE_SCENE_KEYS : FULL_SCENE_KEYS;
     JsonArray scenes = doc["scenes"];
     for (JsonObject scn : scenes) {
-        if (config.scenes.size() >= MAX_SCENES) break;
+        if (next.scenes.size() >= MAX_SCENES) break;
 
         SceneConfig scene;
-        scene.id = scn["id"] | (config.scenes.size() + 1);
-        scene.name = scn["name"] | "Scene";
-        scene.icon = scn["icon"] | "power";
-        config.scenes.push_back(scene);
+        scene.id = scn[sk.id] | (next.scenes.size() + 1);
+        scene.name = arena.internDisplay(scn[sk.name] | "Scene");
+        scene.icon = arena.intern(scn[sk.icon] | "power");
+        scene.iconId = resolveIcon(scene.icon.c_str());
+
+        // Compile the scene's actions against the buttons parsed above
+        if (scn.containsKey(sk.actions)) {
+            scene.firstAction = next.sceneActions.size();
+            scene.actionCount = compileSceneActions(scn[sk.actions].as<JsonArrayConst>(), next, next.sceneActions);
+        } else {
+            compileBuiltinScene(next, scene);
+        }
+        next.scenes.push_back(scene);
     }
 
     // Parse server config
     JsonObject server = doc["server"];
-    config.server.reportingUrl = server["reportingUrl"] | "http://10.0.1.250:3000";
+    if (keepReportingUrl) {
+        next.server.reportingUrl = arena.intern(live().server.reportingUrl.c_str());
+    } else {
+        next.server.reportingUrl = arena.intern(server["reportingUrl"] | "http://10.0.1.250:3000");
+    }
+
+    // Parse network config; the dim profile defaults to the normal one
+    JsonObject network = doc["network"];
+    setNetworkDefaults(next.network);
+    next.network.wifiProfile = parseWifiProfile(network["wifiProfile"] | "", next.network.wifiProfile);
+    next.network.dimProfile = parseWifiProfile(network["dimProfile"] | "", next.network.wifiProfile);
+
+    // State multicast: all three or none
+    JsonObject multicast = doc["multicast"];
+    StateMulticastConfig& mc = next.network.multicast;
+    mc.port = multicast["port"] | 0;
+    mc.enabled = mc.port != 0 &&
+                 parseMulticastGroup(multicast["group"] | "", mc.group) &&
+                 parseHexKey(multicast["key"] | "", mc.key, sizeof(mc.key));
+    if (!mc.enabled) {
+        memset(&mc, 0, sizeof(mc));
+    }
+
+    // Peer mirroring: on with a key
+    PeerMirrorConfig& pm = next.network.peerMirror;
+    pm.enabled = parseHexKey(doc["peerMirror"]["key"] | "", pm.key, sizeof(pm.key));
+    if (!pm.enabled) {
+        memset(&pm, 0, sizeof(pm));
+    }
+
+    if (!commitUpdate()) {
+        lastParseError = "Config strings exceed arena";
+        return false;
+    }
+    lastParseError = nullptr;
 
     // If server provided current time, use it for immediate sync (faster than NTP)
     if (doc.containsKey("serverTime")) {
-        uint32_t serverTime = doc["serverTime"];
-        if (serverTime > 1700000000) {  // Sanity check: after Nov 2023
-            timeManager.setTimeFromServer(serverTime);
-        }
+        timeManager.setTimeFromServer(doc["serverTime"].as<uint32_t>());
     }
 
     configured = true;
-    Serial.println("ConfigManager: Config parsed successfully");
+    LOG_I("ConfigManager: Config parsed successfully");
     return true;
 }
 
-String ConfigManager::toJson() {
-    DynamicJsonDocument doc(6144);
+size_t ConfigManager::writeJson(Print& out, bool withSecrets) const {
+    ConfigSnapshot snapshot(*this);
+    const DeviceConfig& config = *snapshot;
+    ConfigJsonWriter w(out);
 
-    doc["version"] = config.version;
+    w.beginObject();
+    w.field("version", (unsigned int)config.version);
 
     // Device info
-    JsonObject device = doc.createNestedObject("device");
-    device["id"] = config.device.id;
-    device["name"] = config.device.name;
-    device["location"] = config.device.location;
+    w.beginObject("device");
+    w.field("id", config.device.id);
+    w.field("name", config.device.name);
+    w.field("location", config.device.location);
+    w.endObject();
 
     // Display settings
-    JsonObject display = doc.createNestedObject("display");
-    display["brightness"] = config.display.brightness;
-    display["theme"] = config.display.theme;
-
-    JsonObject dayNight = display.createNestedObject("dayNightMode");
-    dayNight["enabled"] = config.display.dayNight.enabled;
-    dayNight["dayTheme"] = config.display.dayNight.dayTheme;
-    dayNight["nightTheme"] = config.display.dayNight.nightTheme;
-    dayNight["dayStartHour"] = config.display.dayNight.dayStartHour;
-    dayNight["nightStartHour"] = config.display.dayNight.nightStartHour;
+    w.beginObject("display");
+    w.field("brightness", (unsigned int)config.display.brightness);
+    w.field("theme", config.display.theme);
+    w.field("layout", cardLayoutName(config.display.cardLayout));
+    w.field("cardTiles", config.display.cardTiles);
+
+    const DayNightConfig& dn = config.display.dayNight;
+    w.beginObject("dayNightMode");
+    w.field("enabled", dn.enabled);
+    w.field("dayTheme", dn.dayTheme);
+    w.field("nightTheme", dn.nightTheme);
+    w.field("dayStartHour", (unsigned int)dn.dayStartHour);
+    w.field("nightStartHour", (unsigned int)dn.nightStartHour);
+    w.field("followSun", dn.followSun);
+    w.endObject();
 
     // LCARS configuration
-    JsonObject lcars = display.createNestedObject("lcars");
-    lcars["enabled"] = config.display.lcars.enabled;
-    lcars["colorScheme"] = config.display.lcars.colorScheme;
-    lcars["headerLeft"] = config.display.lcars.headerLeft;
-    lcars["headerRight"] = config.display.lcars.headerRight;
-    lcars["footerLeft"] = config.display.lcars.footerLeft;
-    lcars["footerRight"] = config.display.lcars.footerRight;
-    lcars["sidebarTop"] = config.display.lcars.sidebarTop;
-    lcars["sidebarBottom"] = config.display.lcars.sidebarBottom;
-
-    JsonArray customFields = lcars.createNestedArray("customFields");
-    for (const LCARSTextField& field : config.display.lcars.customFields) {
-        JsonObject f = customFields.createNestedObject();
-        f["id"] = field.id;
-        f["value"] = field.value;
-        f["style"] = field.style;
+    const LCARSConfig& lcars = config.display.lcars;
+    w.beginObject("lcars");
+    w.field("enabled", lcars.enabled);
+    w.field("colorScheme", lcars.colorScheme);
+    w.field("headerLeft", lcars.headerLeft);
+    w.field("headerRight", lcars.headerRight);
+    w.field("footerLeft", lcars.footerLeft);
+    w.field("footerRight", lcars.footerRight);
+    w.field("sidebarTop", lcars.sidebarTop);
+    w.field("sidebarBottom", lcars.sidebarBottom);
+    w.beginArray("customFields");
+    for (const LCARSTextField& field : lcars.customFields) {
+        w.beginObject();
+        w.field("id", field.id);
+        w.field("value", field.value);
+        w.field("style", field.style);
+        w.endObject();
     }
+    w.endArray();
+    w.endObject();
 
     // Brightness schedule
-    JsonObject schedule = display.createNestedObject("brightnessSchedule");
-    schedule["enabled"] = config.display.schedule.enabled;
-    schedule["timezone"] = config.display.schedule.timezone;
-    schedule["touchBrightness"] = config.display.schedule.touchBrightness;
-    schedule["displayTimeout"] = config.display.schedule.displayTimeout;
-
-    JsonArray periods = schedule.createNestedArray("periods");
-    for (uint8_t i = 0; i < config.display.schedule.periodCount; i++) {
-        JsonObject period = periods.createNestedObject();
-        period["name"] = config.display.schedule.periods[i].name;
-        period["startHour"] = config.display.schedule.periods[i].startHour;
-        period["startMinute"] = config.display.schedule.periods[i].startMinute;
-        period["brightness"] = config.display.schedule.periods[i].brightness;
+    const BrightnessScheduleConfig& schedule = config.display.schedule;
+    w.beginObject("brightnessSchedule");
+    w.field("enabled", schedule.enabled);
+    w.field("mode", schedule.curve ? "curve" : "steps");
+    w.field("timezone", schedule.timezone);
+    if (!isnan(schedule.latitude) && !isnan(schedule.longitude)) {
+        w.field("latitude", schedule.latitude, 4);
+        w.field("longitude", schedule.longitude, 4);
     }
+    w.field("touchBrightness", (unsigned int)schedule.touchBrightness);
+    w.field("displayTimeout", (unsigned int)schedule.displayTimeout);
+    w.beginArray("periods");
+    for (uint8_t i = 0; i < schedule.periodCount; i++) {
+        const BrightnessSchedulePeriod& period = schedule.periods[i];
+        w.beginObject();
+        w.field("name", period.name);
+        w.field("startHour", (unsigned int)period.startHour);
+        w.field("startMinute", (unsigned int)period.startMinute);
+        w.field("brightness", (unsigned int)period.brightness);
+        if (period.anchor != ScheduleAnchor::CLOCK) {
+            w.field("anchor", scheduleAnchorName(period.anchor));
+            w.field("offsetMinutes", (int)period.offsetMinutes);
+        }
+        w.endObject();
+    }
+    w.endArray();
+    w.endObject();
+
+    const AmbientConfig& ambient = config.display.ambient;
+    w.beginObject("adaptiveBrightness");
+    w.field("enabled", ambient.enabled);
+    w.field("minBrightness", (unsigned int)ambient.minBrightness);
+    w.field("maxBrightness", (unsigned int)ambient.maxBrightness);
+    w.field("luxAtMax", (unsigned int)ambient.luxAtMax);
+    w.endObject();
+
+    // Custom themes, with only the fields they set
+    w.beginArray("themes");
+    for (const CustomThemeConfig& theme : config.display.themes) {
+        char hex[8];
+        w.beginObject();
+        w.field("name", theme.name);
+        w.field("base", theme.base);
+        w.beginObject("colors");
+        for (uint8_t i = 0; i < THEME_COLOR_COUNT; i++) {
+            if (!(theme.colorMask & (1 << i))) continue;
+            formatThemeColor(theme.colors[i], hex);
+            w.field(THEME_COLOR_KEYS[i], hex);
+        }
+        w.endObject();
+        w.beginArray("palette");
+        for (uint8_t i = 0; i < THEME_PALETTE_SIZE && (theme.paletteMask >> i); i++) {
+            if (theme.paletteMask & (1 << i)) {
+                formatThemeColor(theme.palette[i], hex);
+                w.field(nullptr, hex);
+            } else {
+                w.nullField(nullptr);
+            }
+        }
+        w.endArray();
+        w.beginObject("shape");
+        for (uint8_t i = 0; i < THEME_SHAPE_COUNT; i++) {
+            if (theme.shapeMask & (1 << i)) {
+                w.field(THEME_SHAPE_KEYS[i], (unsigned int)theme.shapes[i]);
+            }
+        }
+        w.endObject();
+        w.beginObject("flags");
+        for (uint8_t i = 0; i < sizeof(THEME_FLAG_BITS); i++) {
+            if (theme.flagMask & THEME_FLAG_BITS[i]) {
+                w.field(THEME_FLAG_KEYS[i], (theme.flags & THEME_FLAG_BITS[i]) != 0);
+            }
+        }
+        w.endObject();
+        w.endObject();
+    }
+    w.endArray();
+
+    w.endObject();  // display
 
     // Buttons
-    JsonArray buttons = doc.createNestedArray("buttons");
+    w.beginArray("buttons");
     for (const ButtonConfig& btn : config.buttons) {
-        JsonObject button = buttons.createNestedObject();
-        button["id"] = btn.id;
-        const char* typeStr = "light";
-        if (btn.type == ButtonType::SWITCH) typeStr = "switch";
-        else if (btn.type == ButtonType::FAN) typeStr = "fan";
-        else if (btn.type == ButtonType::SCENE) typeStr = "scene";
-        button["type"] = typeStr;
-        button["name"] = btn.name;
-        button["icon"] = btn.icon;
-        button["state"] = btn.state;
+        w.beginObject();
+        w.field("id", (unsigned int)btn.id);
+        w.field("type", buttonTypeName(btn.type));
+        w.field("name", btn.name);
+        w.field("icon", btn.icon);
+        w.field("state", btn.state);
         if (btn.subtitle.length() > 0) {
-            button["subtitle"] = btn.subtitle;
+            w.field("subtitle", btn.subtitle);
         }
         if (btn.type == ButtonType::FAN) {
-            button["speedSteps"] = btn.speedSteps;
-            button["speedLevel"] = btn.speedLevel;
+            w.field("speedSteps", (unsigned int)btn.speedSteps);
+            w.field("speedLevel", (unsigned int)btn.speedLevel);
         }
         if (btn.type == ButtonType::SCENE && btn.sceneId.length() > 0) {
-            button["sceneId"] = btn.sceneId;
+            w.field("sceneId", btn.sceneId);
         }
+        if (btn.directTarget != NO_DIRECT_TARGET) {
+            w.beginObject("direct");
+            w.field("target", (unsigned int)btn.directTarget);
+            w.field("path", btn.directPath);
+            w.endObject();
+        }
+        if (btn.bindingId != 0) {
+            w.field("bid", (unsigned int)btn.bindingId);
+        }
+        w.endObject();
+    }
+    w.endArray();
+
+    // Direct control targets; the credentials only in copies made to be
+    // parsed back, never over the open /api/config
+    if (config.direct.size() > 0) {
+        w.beginArray("direct");
+        for (const DirectTargetConfig& target : config.direct) {
+            w.beginObject();
+            w.field("url", target.url);
+            if (withSecrets) {
+                w.field("auth", target.auth);
+            }
+            w.field("onBody", target.onBody);
+            w.field("offBody", target.offBody);
+            w.field("speedBody", target.speedBody);
+            w.endObject();
+        }
+        w.endArray();
     }
 
     // Scenes
-    JsonArray scenes = doc.createNestedArray("scenes");
+    w.beginArray("scenes");
     for (const SceneConfig& scn : config.scenes) {
-        JsonObject scene = scenes.createNestedObject();
-        scene["id"] = scn.id;
-        scene["name"] = scn.name;
-        scene["icon"] = scn.icon;
+        w.beginObject();
+        w.field("id", (unsigned int)scn.id);
+        w.field("name", scn.name);
+        w.field("icon", scn.icon);
+        w.beginArray("actions");
+        for (uint8_t i = 0; i < scn.actionCount; i++) {
+            const SceneAction& action = config.sceneActions[scn.firstAction + i];
+            w.beginObject();
+            w.field("buttonId", (unsigned int)action.buttonId);
+            w.field("state", action.state);
+            if (action.speedLevel != NO_SCENE_SPEED) {
+                w.field("speedLevel", (unsigned int)action.speedLevel);
+            }
+            w.endObject();
+        }
+        w.endArray();
+        w.endObject();
     }
+    w.endArray();
 
     // Server config
-    JsonObject server = doc.createNestedObject("server");
-    server["reportingUrl"] = config.server.reportingUrl;
+    w.beginObject("server");
+    w.field("reportingUrl", config.server.reportingUrl);
+    w.endObject();
+
+    w.beginObject("network");
+    w.field("wifiProfile", wifiProfileName(config.network.wifiProfile));
+    w.field("dimProfile", wifiProfileName(config.network.dimProfile));
+    w.endObject();
+
+    // State multicast group; the key, like the direct credentials, only when asked
+    const StateMulticastConfig& multicast = config.network.multicast;
+    if (multicast.enabled) {
+        char group[16];
+        snprintf(group, sizeof(group), "%u.%u.%u.%u",
+                 multicast.group[0], multicast.group[1], multicast.group[2], multicast.group[3]);
+        w.beginObject("multicast");
+        w.field("group", (const char*)group);
+        w.field("port", (unsigned int)multicast.port);
+        if (withSecrets) {
+            char key[sizeof(multicast.key) * 2 + 1];
+            formatHexKey(multicast.key, sizeof(multicast.key), key);
+            w.field("key", (const char*)key);
+        }
+        w.endObject();
+    }
+
+    const PeerMirrorConfig& peerMirror = config.network.peerMirror;
+    if (peerMirror.enabled) {
+        w.beginObject("peerMirror");
+        if (withSecrets) {
+            char key[sizeof(peerMirror.key) * 2 + 1];
+            formatHexKey(peerMirror.key, sizeof(peerMirror.key), key);
+            w.field("key", (const char*)key);
+        }
+        w.endObject();
+    }
+
+    w.endObject();
+    return w.size();
+}
 
+size_t ConfigManager::jsonLength(bool withSecrets) const {
+    CountingPrint counter;
+    return writeJson(counter, withSecrets);
+}
+
+String ConfigManager::toJson(bool withSecrets) {
     String json;
-    serializeJson(doc, json);
+    json.reserve(jsonLength(withSecrets));
+    StringPrint out(json);
+    writeJson(out, withSecrets);
     return json;
 }
 
 bool ConfigManager::fetchConfigFromServer() {
     if (WiFi.status() != WL_CONNECTED) {
-        Serial.println("ConfigManager: WiFi not connected, cannot fetch config");
+        LOG_E("ConfigManager: WiFi not connected, cannot fetch config");
         return false;
     }
 
-    // Preserve current reporting URL - this is set locally and shouldn't be overwritten by server
-    String savedReportingUrl = config.server.reportingUrl;
-
-    String url = savedReportingUrl + "/api/devices/" + getDeviceId() + "/config";
-
-    Serial.printf("ConfigManager: Fetching config from %s\n", url.c_str());
+    // ?schema= tells the server this firmware reads the short-key wire form
+    String url = String(live().server.reportingUrl.c_str()) + "/api/devices/" + getDeviceId() +
+                 "/config?schema=" + CONFIG_WIRE_SCHEMA;
 
-    HTTPClient http;
-    http.begin(url);
-    http.setTimeout(5000);
+    LOG_I("ConfigManager: Fetching config from %s", url.c_str());
 
-    int httpCode = http.GET();
+    // Through the pool: its resolved address of the server is reused later
+    String payload;
+    int httpCode = httpPool.get(url.c_str(), 5000, &payload);
 
     if (httpCode == HTTP_CODE_OK) {
-        String payload = http.getString();
-        http.end();
-
-        if (parseConfigJson(payload)) {
-            // Restore the reporting URL - device's local setting takes precedence over server
-            config.server.reportingUrl = savedReportingUrl;
-            saveConfig();
-            Serial.println("ConfigManager: Config parsed and saved successfully");
+        // The device's local reporting URL takes precedence over the server copy;
+        // parsed in place, the payload is discarded afterwards
+        if (parseConfigJson(payload.begin(), payload.length(), true)) {
+            markDirty();
+            LOG_I("ConfigManager: Config parsed and saved successfully");
             return true;
         } else {
-            Serial.println("ConfigManager: Failed to parse config JSON");
+            LOG_E("ConfigManager: Failed to parse config JSON");
         }
     } else if (httpCode == HTTP_CODE_NOT_FOUND) {
-        Serial.println("ConfigManager: Device not registered with server (404)");
+        LOG_I("ConfigManager: Device not registered with server (404)");
     } else if (httpCode < 0) {
-        Serial.printf("ConfigManager: Connection failed (error %d: %s)\n", httpCode, http.errorToString(httpCode).c_str());
+        LOG_E("ConfigManager: Connection failed (error %d: %s)", httpCode, HTTPClient::errorToString(httpCode).c_str());
     } else {
-        Serial.printf("ConfigManager: HTTP error: %d\n", httpCode);
+        LOG_E("ConfigManager: HTTP error: %d", httpCode);
     }
-
-    http.end();
     return false;
 }
 
 const DeviceConfig& ConfigManager::getConfig() const {
-    return config;
+    return live();
 }
 
-DeviceConfig& ConfigManager::getConfigMutable() {
-    return config;
+void ConfigManager::setReportingUrl(const String& url) {
+    ConfigSlot& slot = beginUpdate(true);
+    slot.config.server.reportingUrl = slot.arena.intern(url);
+    commitUpdate();
+
+    // Sockets to the old server and its resolved address are of no more use
+    httpPool.closeAll();
 }
 
-void ConfigManager::setReportingUrl(const String& url) {
-    config.server.reportingUrl = url;
+String ConfigManager::getServerCa() {
+    Preferences prefs;
+    if (!prefs.begin(NVS_NAMESPACE, true)) {
+        return String();
+    }
+    // A blob, not a string: NVS strings stop at 4000 bytes, a CA chain may not
+    String pem;
+    size_t length = prefs.getBytesLength(NVS_SERVER_CA_KEY);
+    if (length > 0) {
+        char* buffer = (char*)malloc(length + 1);
+        if (buffer != nullptr) {
+            prefs.getBytes(NVS_SERVER_CA_KEY, buffer, length);
+            buffer[length] = '\0';
+            pem = buffer;
+            free(buffer);
+        }
+    }
+    prefs.end();
+    return pem;
+}
+
+void ConfigManager::setServerCa(const String& pem) {
+    Preferences prefs;
+    if (prefs.begin(NVS_NAMESPACE, false)) {
+        if (pem.length() > 0) {
+            prefs.putBytes(NVS_SERVER_CA_KEY, pem.c_str(), pem.length());
+        } else {
+            prefs.remove(NVS_SERVER_CA_KEY);
+        }
+        prefs.end();
+    } else {
+        LOG_E("ConfigManager: Failed to open NVS, CA certificate not saved");
+    }
+    httpPool.setCACert(pem.c_str());
+}
+
+void ConfigManager::setTheme(const char* theme) {
+    ConfigSlot& slot = beginUpdate(true);
+    slot.config.display.theme = slot.arena.intern(theme);
+    slot.config.display.themeId = resolveTheme(theme, slot.config.display, ThemeId::DARK_CLEAN);
+    commitUpdate();
+}
+
+void ConfigManager::setBrightness(uint8_t brightness) {
+    if (live().display.brightness == brightness) return;
+    ConfigSlot& slot = beginUpdate(true);
+    slot.config.display.brightness = brightness;
+    commitUpdate();
+}
+
+// ============================================================================
+// Partial updates
+// ============================================================================
+// Each patch edits a copy of the live config in the spare slot and publishes
+// it like the setters do; keys absent from the patch keep their value.
+
+bool ConfigManager::commitPatch() {
+    if (!commitUpdate()) {
+        lastParseError = "Config strings exceed arena";
+        return false;
+    }
+    return true;
+}
+
+ConfigManager::PatchResult ConfigManager::patchButton(uint8_t buttonId, JsonObjectConst fields) {
+    static const char* const KEYS[] = {
+        "name", "icon", "subtitle", "speedSteps", "sceneId", "direct", "bid", "configHash"
+    };
+    if (!patchKeysKnown(fields, KEYS, sizeof(KEYS) / sizeof(KEYS[0]))) {
+        lastParseError = "Unsupported field (type and layout changes need a full config)";
+        return PATCH_INVALID;
+    }
+
+    ConfigSlot& slot = beginUpdate(true);
+    ButtonConfig* button = nullptr;
+    for (ButtonConfig& b : slot.config.buttons) {
+        if (b.id == buttonId) {
+            button = &b;
+            break;
+        }
+    }
+    if (button == nullptr) {
+        abortUpdate();
+        return PATCH_NOT_FOUND;
+    }
+
+    ConfigArena& arena = slot.arena;
+    if (fields.containsKey("name")) {
+        button->name = arena.internDisplay(fields["name"] | "Button");
+    }
+    if (fields.containsKey("icon")) {
+        button->icon = arena.intern(fields["icon"] | "charge");
+        button->iconId = resolveIcon(button->icon.c_str());
+    }
+    if (fields.containsKey("subtitle")) {
+        button->subtitle = arena.intern(fields["subtitle"] | "");
+    }
+    if (fields.containsKey("speedSteps")) {
+        button->speedSteps = fields["speedSteps"] | 0;
+        if (button->speedLevel > button->speedSteps) {
+            button->speedLevel = button->speedSteps;
+        }
+    }
+    if (fields.containsKey("sceneId")) {
+        button->sceneId = arena.intern(fields["sceneId"] | "");
+    }
+    if (fields.containsKey("direct")) {
+        applyDirectRoute(fields["direct"], slot.config, *button, arena);
+    }
+    if (fields.containsKey("bid")) {
+        button->bindingId = fields["bid"] | 0;
+    }
+    pendingConfigHash = strtoul(fields["configHash"] | "0", nullptr, 16);
+    return commitPatch() ? PATCH_APPLIED : PATCH_INVALID;
+}
+
+ConfigManager::PatchResult ConfigManager::patchScene(uint8_t sceneId, JsonObjectConst fields) {
+    static const char* const KEYS[] = { "name", "icon", "actions", "configHash" };
+    if (!patchKeysKnown(fields, KEYS, sizeof(KEYS) / sizeof(KEYS[0]))) {
+        lastParseError = "Unsupported field";
+        return PATCH_INVALID;
+    }
+
+    ConfigSlot& slot = beginUpdate(true);
+    DeviceConfig& next = slot.config;
+    SceneConfig* scene = nullptr;
+    for (SceneConfig& s : next.scenes) {
+        if (s.id == sceneId) {
+            scene = &s;
+            break;
+        }
+    }
+    if (scene == nullptr) {
+        abortUpdate();
+        return PATCH_NOT_FOUND;
+    }
+
+    if (fields.containsKey("name")) {
+        scene->name = slot.arena.internDisplay(fields["name"] | "Scene");
+    }
+    if (fields.containsKey("icon")) {
+        scene->icon = slot.arena.intern(fields["icon"] | "power");
+        scene->iconId = resolveIcon(scene->icon.c_str());
+    }
+    if (fields.containsKey("actions")) {
+        // Scenes' actions share one table: lay it out again with this
+        // scene's recompiled and the others' copied over
+        FixedVector<SceneAction, MAX_SCENE_ACTIONS> actions;
+        for (SceneConfig& s : next.scenes) {
+            uint8_t first = actions.size();
+            uint8_t count = 0;
+            if (&s == scene) {
+                count = compileSceneActions(fields["actions"].as<JsonArrayConst>(), next, actions);
+            } else {
+                for (uint8_t i = 0; i < s.actionCount && actions.push_back(next.sceneActions[s.firstAction + i]); i++) {
+                    count++;
+                }
+            }
+            s.firstAction = first;
+            s.actionCount = count;
+        }
+        next.sceneActions = actions;
+    }
+    pendingConfigHash = strtoul(fields["configHash"] | "0", nullptr, 16);
+    return commitPatch() ? PATCH_APPLIED : PATCH_INVALID;
+}
+
+ConfigManager::PatchResult ConfigManager::patchDisplay(JsonObjectConst fields) {
+    static const char* const KEYS[] = {
+        "brightness", "theme", "layout", "cardTiles", "dayNightMode", "configHash"
+    };
+    if (!patchKeysKnown(fields, KEYS, sizeof(KEYS) / sizeof(KEYS[0]))) {
+        lastParseError = "Unsupported field (schedules, LCARS and themes need a full config)";
+        return PATCH_INVALID;
+    }
+
+    ConfigSlot& slot = beginUpdate(true);
+    DisplayConfig& display = slot.config.display;
+    ConfigArena& arena = slot.arena;
+    display.brightness = fields["brightness"] | display.brightness;
+    if (fields.containsKey("theme")) {
+        display.theme = arena.intern(fields["theme"] | "dark_mode");
+    }
+    if (fields.containsKey("layout")) {
+        display.cardLayout = parseCardLayout(fields["layout"] | "grid");
+    }
+    display.cardTiles = fields["cardTiles"] | display.cardTiles;
+
+    JsonObjectConst dayNight = fields["dayNightMode"];
+    if (!dayNight.isNull()) {
+        DayNightConfig& dn = display.dayNight;
+        dn.enabled = dayNight["enabled"] | dn.enabled;
+        if (dayNight.containsKey("dayTheme")) {
+            dn.dayTheme = arena.intern(dayNight["dayTheme"] | "light_mode");
+        }
+        if (dayNight.containsKey("nightTheme")) {
+            dn.nightTheme = arena.intern(dayNight["nightTheme"] | "dark_mode");
+        }
+        dn.dayStartHour = dayNight["dayStartHour"] | dn.dayStartHour;
+        dn.nightStartHour = dayNight["nightStartHour"] | dn.nightStartHour;
+        dn.followSun = dayNight["followSun"] | dn.followSun;
+    }
+    resolveThemes(display);
+    pendingConfigHash = strtoul(fields["configHash"] | "0", nullptr, 16);
+    return commitPatch() ? PATCH_APPLIED : PATCH_INVALID;
+}
+
+IconId ConfigManager::resolveIcon(const char* name) const {
+    if (iconLookup) {
+        IconId id = iconLookup(name);
+        if (id != IconId::COUNT) return id;
+    }
+    return findIcon(name);
+}
+
+ThemeId ConfigManager::resolveTheme(const char* name, const DisplayConfig& display, ThemeId fallback) {
+    ThemeId id;
+    if (ThemeEngine::findBuiltinTheme(name, id)) return id;
+    // Custom themes take the CUSTOM_* slot of their position
+    for (size_t i = 0; i < display.themes.size(); i++) {
+        if (strcmp(name, display.themes[i].name.c_str()) == 0) {
+            return (ThemeId)((int)ThemeId::CUSTOM_0 + i);
+        }
+    }
+    LOG_W("ConfigManager: Unknown theme '%s', using the default", name);
+    return fallback;
+}
+
+void ConfigManager::resolveThemes(DisplayConfig& display) {
+    display.themeId = resolveTheme(display.theme.c_str(), display, ThemeId::DARK_CLEAN);
+    display.dayNight.dayThemeId = resolveTheme(display.dayNight.dayTheme.c_str(), display, ThemeId::LIGHT_MODE);
+    display.dayNight.nightThemeId = resolveTheme(display.dayNight.nightTheme.c_str(), display, ThemeId::DARK_CLEAN);
+}
+
+void ConfigManager::refreshIcons() {
+    ConfigSlot& slot = beginUpdate(true);
+    for (ButtonConfig& btn : slot.config.buttons) {
+        btn.iconId = resolveIcon(btn.icon.c_str());
+    }
+    for (SceneConfig& scn : slot.config.scenes) {
+        scn.iconId = resolveIcon(scn.icon.c_str());
+    }
+    commitUpdate();
 }
 
 String ConfigManager::getDeviceId() {
-    if (config.device.id.length() > 0) {
-        return config.device.id;
+    const ConfigString& id = live().device.id;
+    if (id.length() > 0) {
+        return id;
     }
     return generateDeviceId();
 }
@@ -386,21 +2837,89 @@ void ConfigManager::resetToDefaults() {
 }
 
 void ConfigManager::setButtonState(uint8_t buttonId, bool state) {
-    for (ButtonConfig& btn : config.buttons) {
-        if (btn.id == buttonId) {
-            btn.state = state;
-            return;
+    // Held so a writer cloning the live slot can't drop this store
+    if (writeMutex) {
+        xSemaphoreTakeRecursive(writeMutex, portMAX_DELAY);
+    }
+    int index = findButtonIndex(buttonId);
+    if (index >= 0 && live().buttons[index].state != state) {
+        live().buttons[index].state = state;
+        generation.fetch_add(1);
+    }
+    if (writeMutex) {
+        xSemaphoreGiveRecursive(writeMutex);
+    }
+}
+
+void ConfigManager::setButtonSpeed(uint8_t buttonId, uint8_t speedLevel) {
+    if (writeMutex) {
+        xSemaphoreTakeRecursive(writeMutex, portMAX_DELAY);
+    }
+    int index = findButtonIndex(buttonId);
+    if (index >= 0) {
+        ButtonConfig& button = live().buttons[index];
+        if (button.speedLevel != speedLevel || button.state != (speedLevel > 0)) {
+            button.speedLevel = speedLevel;
+            button.state = speedLevel > 0;
+            generation.fetch_add(1);
         }
     }
+    if (writeMutex) {
+        xSemaphoreGiveRecursive(writeMutex);
+    }
 }
 
 bool ConfigManager::getButtonState(uint8_t buttonId) {
+    const ButtonConfig* btn = findButton(buttonId);
+    return btn ? btn->state : false;
+}
+
+const ButtonConfig* ConfigManager::findButton(uint8_t buttonId) const {
+    const ConfigSlot& slot = slots[activeSlot.load()];
+    uint8_t index = slot.buttonIndexById[buttonId];
+    return (index != NO_BUTTON && index < slot.config.buttons.size()) ? &slot.config.buttons[index] : nullptr;
+}
+
+int ConfigManager::findButtonIndex(uint8_t buttonId) const {
+    const ConfigSlot& slot = slots[activeSlot.load()];
+    uint8_t index = slot.buttonIndexById[buttonId];
+    return (index != NO_BUTTON && index < slot.config.buttons.size()) ? index : -1;
+}
+
+void ConfigManager::rebuildButtonIndex(ConfigSlot& slot) {
+    memset(slot.buttonIndexById, NO_BUTTON, sizeof(slot.buttonIndexById));
+    // First match wins, like the linear scans this replaces
+    const DeviceConfig& config = slot.config;
+    for (int i = config.buttons.size() - 1; i >= 0; i--) {
+        slot.buttonIndexById[config.buttons[i].id] = i;
+    }
+
+    // Bound buttons sorted by binding id (insertion sort, at most MAX_BUTTONS)
+    slot.bindingCount = 0;
     for (const ButtonConfig& btn : config.buttons) {
-        if (btn.id == buttonId) {
-            return btn.state;
+        if (btn.bindingId == 0) continue;
+        int at = slot.bindingCount++;
+        while (at > 0 && slot.bindings[at - 1].bindingId > btn.bindingId) {
+            slot.bindings[at] = slot.bindings[at - 1];
+            at--;
         }
+        slot.bindings[at] = { btn.bindingId, btn.id };
     }
-    return false;
+}
+
+int ConfigManager::findButtonsByBinding(uint32_t bindingId, uint8_t* buttonIds, int max) const {
+    const ConfigSlot& slot = slots[activeSlot.load()];
+    int lo = 0;
+    int hi = slot.bindingCount;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (slot.bindings[mid].bindingId < bindingId) lo = mid + 1; else hi = mid;
+    }
+    int count = 0;
+    for (int i = lo; i < slot.bindingCount && slot.bindings[i].bindingId == bindingId && count < max; i++) {
+        buttonIds[count++] = slot.bindings[i].buttonId;
+    }
+    return count;
 }
 
 String ConfigManager::generateDeviceId() {
@@ -411,84 +2930,111 @@ String ConfigManager::generateDeviceId() {
 }
 
 void ConfigManager::createDefaultConfig() {
+    ConfigSlot& slot = beginUpdate(false);
+    DeviceConfig& config = slot.config;
+    ConfigArena& arena = slot.arena;
+
     config.version = 1;
 
     // Device info
-    config.device.id = generateDeviceId();
-    config.device.name = "ESP32 Display";
-    config.device.location = "Unknown";
+    config.device.id = arena.intern(generateDeviceId());
+    config.device.name = arena.intern("ESP32 Display");
+    config.device.title = config.device.name;
+    config.device.location = arena.intern("Unknown");
 
     // Display settings
     config.display.brightness = 80;
-    config.display.theme = "dark_mode";
+    config.display.theme = arena.intern("dark_mode");
+    config.display.cardLayout = CardLayout::GRID;
+    config.display.cardTiles = false;
     config.display.dayNight.enabled = false;
-    config.display.dayNight.dayTheme = "light_mode";
-    config.display.dayNight.nightTheme = "dark_mode";
+    config.display.dayNight.dayTheme = arena.intern("light_mode");
+    config.display.dayNight.nightTheme = arena.intern("dark_mode");
     config.display.dayNight.dayStartHour = 7;
     config.display.dayNight.nightStartHour = 20;
+    config.display.dayNight.followSun = false;
+    resolveThemes(config.display);
 
     // LCARS defaults (disabled by default)
     config.display.lcars.enabled = false;
-    config.display.lcars.colorScheme = "federation";
-    config.display.lcars.headerLeft = "STARDATE";
-    config.display.lcars.headerRight = "ONLINE";
-    config.display.lcars.footerLeft = "";
-    config.display.lcars.footerRight = "";
-    config.display.lcars.sidebarTop = "";
-    config.display.lcars.sidebarBottom = "";
-    config.display.lcars.customFields.clear();
+    config.display.lcars.colorScheme = arena.intern("federation");
+    config.display.lcars.headerLeft = arena.intern("STARDATE");
+    config.display.lcars.headerRight = arena.intern("ONLINE");
+    config.display.lcars.footerLeft = arena.intern("");
+    config.display.lcars.footerRight = arena.intern("");
+    config.display.lcars.sidebarTop = arena.intern("");
+    config.display.lcars.sidebarBottom = arena.intern("");
 
     // Brightness schedule defaults (disabled by default)
     config.display.schedule.enabled = false;
-    config.display.schedule.timezone = "MST7MDT,M3.2.0,M11.1.0";
+    config.display.schedule.timezone = arena.intern("MST7MDT,M3.2.0,M11.1.0");
     config.display.schedule.touchBrightness = 30;
     config.display.schedule.displayTimeout = 30;
+    config.display.schedule.curve = false;
+    config.display.schedule.latitude = NAN;
+    config.display.schedule.longitude = NAN;
     config.display.schedule.periodCount = 3;
     // Day period
-    config.display.schedule.periods[0].name = "Day";
+    config.display.schedule.periods[0].name = arena.intern("Day");
     config.display.schedule.periods[0].startHour = 7;
     config.display.schedule.periods[0].startMinute = 0;
     config.display.schedule.periods[0].brightness = 80;
     // Night period
-    config.display.schedule.periods[1].name = "Night";
+    config.display.schedule.periods[1].name = arena.intern("Night");
     config.display.schedule.periods[1].startHour = 20;
     config.display.schedule.periods[1].startMinute = 0;
     config.display.schedule.periods[1].brightness = 40;
     // Late night period
-    config.display.schedule.periods[2].name = "Late Night";
+    config.display.schedule.periods[2].name = arena.intern("Late Night");
     config.display.schedule.periods[2].startHour = 23;
     config.display.schedule.periods[2].startMinute = 0;
     config.display.schedule.periods[2].brightness = 0;
+    for (uint8_t i = 0; i < config.display.schedule.periodCount; i++) {
+        config.display.schedule.periods[i].anchor = ScheduleAnchor::CLOCK;
+        config.display.schedule.periods[i].offsetMinutes = 0;
+    }
+
+    // Adaptive brightness defaults (disabled by default)
+    setAmbientDefaults(config.display.ambient);
+
+    // WiFi profiles
+    setNetworkDefaults(config.network);
 
     // Default buttons (4 lights)
-    config.buttons.clear();
     const char* defaultNames[] = {"Living Room", "Bedroom", "Kitchen", "Bathroom"};
     for (int i = 0; i < 4; i++) {
         ButtonConfig btn;
         btn.id = i + 1;
         btn.type = ButtonType::LIGHT;
-        btn.name = defaultNames[i];
-        btn.icon = "charge";
+        btn.name = arena.intern(defaultNames[i]);
+        btn.icon = arena.intern("charge");
+        btn.iconId = resolveIcon("charge");
         btn.state = false;
+        btn.directTarget = NO_DIRECT_TARGET;
+        btn.bindingId = 0;
         config.buttons.push_back(btn);
     }
 
     // Default scenes
-    config.scenes.clear();
     SceneConfig sceneOff;
     sceneOff.id = 1;
-    sceneOff.name = "All Off";
-    sceneOff.icon = "power";
+    sceneOff.name = arena.intern("All Off");
+    sceneOff.icon = arena.intern("power");
+    sceneOff.iconId = resolveIcon("power");
+    compileBuiltinScene(config, sceneOff);
     config.scenes.push_back(sceneOff);
 
     SceneConfig sceneOn;
     sceneOn.id = 2;
-    sceneOn.name = "All On";
-    sceneOn.icon = "ok";
+    sceneOn.name = arena.intern("All On");
+    sceneOn.icon = arena.intern("ok");
+    sceneOn.iconId = resolveIcon("ok");
+    compileBuiltinScene(config, sceneOn);
     config.scenes.push_back(sceneOn);
 
     // Server config
-    config.server.reportingUrl = "http://10.0.1.250:3000";
+    config.server.reportingUrl = arena.intern("http://10.0.1.250:3000");
 
-    Serial.println("ConfigManager: Created default configuration");
+    commitUpdate();
+    LOG_I("ConfigManager: Created default configuration");
 }
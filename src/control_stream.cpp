@@ -0,0 +1,86 @@
+#include "control_stream.h"
+
+ControlStream::ControlStream(SendFn send, uint32_t intervalMs)
+    : sendFn(send)
+    , intervalMs(intervalMs)
+    , timer(nullptr)
+    , id(0)
+    , active(false)
+    , lastSent(-1)
+    , lastSentAt(0)
+    , pending(false)
+    , pendingValue(0)
+{
+}
+
+void ControlStream::start(uint8_t controlId, int value) {
+    flush();
+    id = controlId;
+    active = true;
+    lastSent = value;
+    lastSentAt = 0;
+}
+
+void ControlStream::update(int value) {
+    if (!active) return;
+
+    uint32_t now = lv_tick_get();
+    uint32_t since = now - lastSentAt;
+    if (lastSentAt == 0 || since >= intervalMs) {
+        if (value != lastSent) {
+            send(value);
+        } else {
+            // Back where it was: whatever was held is stale
+            pending = false;
+            if (timer) lv_timer_pause(timer);
+        }
+        return;
+    }
+
+    // Within the interval: hold it for the timer
+    pending = true;
+    pendingValue = value;
+    if (timer == nullptr) {
+        timer = lv_timer_create(onTimer, intervalMs, this);
+    }
+    lv_timer_set_period(timer, intervalMs - since);
+    lv_timer_reset(timer);
+    lv_timer_resume(timer);
+}
+
+void ControlStream::finish(int value) {
+    if (!active) return;
+    if (value != lastSent) {
+        send(value);
+    } else {
+        pending = false;
+        if (timer) lv_timer_pause(timer);
+    }
+}
+
+void ControlStream::flush() {
+    if (active && pending) {
+        send(pendingValue);
+    }
+    pending = false;
+    if (timer) lv_timer_pause(timer);
+    active = false;
+}
+
+void ControlStream::onTimer(lv_timer_t* timer) {
+    ControlStream* self = (ControlStream*)timer->user_data;
+    lv_timer_pause(timer);
+    if (self->pending && self->pendingValue != self->lastSent) {
+        self->send(self->pendingValue);
+    }
+    self->pending = false;
+}
+
+void ControlStream::send(int value) {
+    pending = false;
+    if (timer) lv_timer_pause(timer);
+    lastSent = value;
+    lastSentAt = lv_tick_get();
+    if (lastSentAt == 0) lastSentAt = 1;
+    sendFn(id, value);
+}
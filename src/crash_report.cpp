@@ -0,0 +1,174 @@
+#include "crash_report.h"
+#include "heap_monitor.h"
+#include "http_pool.h"
+#include "mdns_service.h"
+#include <stdarg.h>
+#include <esp_system.h>
+#include <esp_attr.h>
+#include <sdkconfig.h>
+#if CONFIG_ESP_COREDUMP_ENABLE_TO_FLASH
+#include <esp_core_dump.h>
+#endif
+
+// Global instance
+CrashReport crashReport;
+
+// RTC slow memory is left alone by panics, watchdogs and software resets;
+// the magic tells a snapshot from whatever a power cut left there
+struct RtcHeapSnapshot {
+    uint32_t magic;
+    HeapSample sample;
+};
+
+static const uint32_t RTC_HEAP_MAGIC = 0x48454150;     // "HEAP"
+static RTC_NOINIT_ATTR RtcHeapSnapshot rtcHeap;
+
+CrashReport::CrashReport()
+    : pending(false)
+    , haveDump(false)
+{
+    report[0] = '\0';
+}
+
+const char* CrashReport::crashReason(int reason) {
+    switch (reason) {
+        case ESP_RST_PANIC:     return "panic";
+        case ESP_RST_INT_WDT:   return "int_wdt";
+        case ESP_RST_TASK_WDT:  return "task_wdt";
+        case ESP_RST_WDT:       return "wdt";
+        case ESP_RST_BROWNOUT:  return "brownout";
+        default:                return nullptr;
+    }
+}
+
+void CrashReport::begin() {
+    esp_reset_reason_t reset = esp_reset_reason();
+    const char* reason = crashReason(reset);
+
+#if CONFIG_ESP_COREDUMP_ENABLE_TO_FLASH
+    size_t dumpAddr = 0;
+    size_t dumpSize = 0;
+    haveDump = esp_core_dump_image_get(&dumpAddr, &dumpSize) == ESP_OK;
+    if (haveDump) {
+        Serial.printf("CrashReport: Core dump stored (%u bytes at 0x%x)\n",
+                      (unsigned)dumpSize, (unsigned)dumpAddr);
+    }
+#endif
+
+    // A dump left over from an earlier boot whose upload never got through
+    // is still a crash, whatever reset this one was
+    if (reason || haveDump) {
+        buildReport(reason ? reason : "panic", haveDump);
+        pending = true;
+        Serial.printf("CrashReport: Previous boot ended in %s\n", reason ? reason : "a panic");
+    }
+
+    // From here on the snapshot describes this boot
+    rtcHeap.magic = 0;
+}
+
+void CrashReport::noteHeap(const HeapSample& sample) {
+    rtcHeap.sample = sample;
+    rtcHeap.magic = RTC_HEAP_MAGIC;
+}
+
+// snprintf at buf + len, advancing len; past the end len stays >= size
+static void __attribute__((format(printf, 4, 5)))
+appendf(char* buf, size_t size, size_t& len, const char* fmt, ...) {
+    if (len >= size) return;
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf + len, size - len, fmt, args);
+    va_end(args);
+    if (n > 0) len += n;
+}
+
+void CrashReport::buildReport(const char* reason, bool withDump) {
+    size_t len = 0;
+#define APPEND(...) appendf(report, sizeof(report), len, __VA_ARGS__)
+
+    APPEND("{\"pending\":true,\"reset_reason\":\"%s\",\"firmware\":\"%s\"",
+           reason, MDNSService::getFirmwareVersion());
+
+    // Only meaningful if this reset is the crash; the snapshot is the
+    // previous boot's last heap sample, up to SAMPLE_INTERVAL_MS before it
+    if (crashReason(esp_reset_reason()) && rtcHeap.magic == RTC_HEAP_MAGIC) {
+        const HeapSample& s = rtcHeap.sample;
+        APPEND(",\"uptime_s\":%u,\"heap\":{\"internal_free\":%u,\"internal_largest\":%u,"
+               "\"internal_min\":%u,\"psram_free\":%u,\"psram_largest\":%u,\"psram_min\":%u,"
+               "\"lvgl_used\":%u,\"lvgl_frag_pct\":%u}",
+               s.uptimeS, s.internalFree, s.internalLargest, s.internalMin,
+               s.psramFree, s.psramLargest, s.psramMin, s.lvglUsed, s.lvglFragPct);
+    }
+
+#if CONFIG_ESP_COREDUMP_ENABLE_TO_FLASH && CONFIG_ESP_COREDUMP_DATA_FORMAT_ELF
+    esp_core_dump_summary_t* summary = withDump
+        ? (esp_core_dump_summary_t*)malloc(sizeof(esp_core_dump_summary_t)) : nullptr;
+    if (summary && esp_core_dump_get_summary(summary) == ESP_OK) {
+        summary->exc_task[sizeof(summary->exc_task) - 1] = '\0';
+        summary->app_elf_sha256[sizeof(summary->app_elf_sha256) - 1] = '\0';
+        // PCs for addr2line against the ELF the hash names
+        APPEND(",\"dump\":{\"task\":\"%s\",\"pc\":\"0x%08x\",\"cause\":%u,\"vaddr\":\"0x%08x\","
+               "\"elf_sha256\":\"%s\",\"bt_corrupted\":%s,\"backtrace\":[",
+               summary->exc_task, summary->exc_pc,
+               summary->ex_info.exc_cause, summary->ex_info.exc_vaddr,
+               (const char*)summary->app_elf_sha256,
+               summary->exc_bt_info.corrupted ? "true" : "false");
+        uint32_t depth = summary->exc_bt_info.depth;
+        if (depth > sizeof(summary->exc_bt_info.bt) / sizeof(summary->exc_bt_info.bt[0])) {
+            depth = sizeof(summary->exc_bt_info.bt) / sizeof(summary->exc_bt_info.bt[0]);
+        }
+        for (uint32_t i = 0; i < depth; i++) {
+            APPEND("%s\"0x%08x\"", i ? "," : "", summary->exc_bt_info.bt[i]);
+        }
+        APPEND("]}");
+        Serial.printf("CrashReport: %s crashed at 0x%08x\n", summary->exc_task, summary->exc_pc);
+    } else if (withDump) {
+        APPEND(",\"dump\":null");
+        Serial.println("CrashReport: Core dump present but its summary could not be read");
+    }
+    free(summary);
+#else
+    (void)withDump;
+#endif
+
+    APPEND("}");
+#undef APPEND
+    if (len >= sizeof(report)) {
+        // Truncated mid-way; keep what identifies the crash
+        snprintf(report, sizeof(report), "{\"pending\":true,\"reset_reason\":\"%s\",\"truncated\":true}", reason);
+    }
+}
+
+// ============================================================================
+// Upload
+// ============================================================================
+
+bool CrashReport::upload(const String& reportingUrl, const String& deviceId) {
+    if (!pending) return false;
+
+    String url = reportingUrl + "/api/devices/" + deviceId + "/crash";
+    int httpCode = httpPool.post(url.c_str(), report, UPLOAD_TIMEOUT_MS);
+    if (httpCode < 200 || httpCode >= 300) {
+        Serial.printf("CrashReport: Upload failed (%d), keeping the report for the next boot\n", httpCode);
+        return false;
+    }
+
+#if CONFIG_ESP_COREDUMP_ENABLE_TO_FLASH
+    if (haveDump && esp_core_dump_image_erase() != ESP_OK) {
+        Serial.println("CrashReport: Failed to erase the core dump");
+    }
+#endif
+    haveDump = false;
+    pending = false;
+    Serial.println("CrashReport: Report uploaded");
+    return true;
+}
+
+void CrashReport::writeJson(Print& out) const {
+    if (pending) {
+        out.print(report);
+    } else {
+        out.print("{\"pending\":false}");
+    }
+}
@@ -1,77 +1,254 @@
 #include "device_controller.h"
 #include "ui_manager.h"
+#include "http_pool.h"
+#include "server_channel.h"
+#include "peer_mirror.h"
+#include "latency_trace.h"
+#include "heap_monitor.h"
+#include "event_scheduler.h"
+#include "crash_report.h"
+#include "panel_log.h"
+#include "json_alloc.h"
+#include "static_memory.h"
+#include "time_manager.h"
 #include <WiFi.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
+#include <esp_attr.h>
+#include <esp_random.h>
+#include <esp_timer.h>
 
 // Global instance
 DeviceController deviceController;
 
-// HTTP worker task - processes requests from queue one at a time
+// Actions made while WiFi was down, in RTC slow memory so a restart keeps
+// them (a power cut doesn't; the magic catches what it leaves there). The
+// epoch is drawn when the journal is set up and the sequence only grows
+// within it, so the server can skip entries it has already applied.
+enum : uint8_t { JOURNAL_FREE = 0, JOURNAL_BUTTON, JOURNAL_SCENE };
+
+struct JournalEntry {
+    uint32_t seq;               // Newer actions have higher ones
+    uint8_t kind;               // JOURNAL_*
+    uint8_t id;                 // buttonId or sceneId
+    uint8_t state;
+    uint8_t speedLevel;         // NO_SCENE_SPEED unless a fan speed
+};
+
+static const uint8_t JOURNAL_SLOTS = 16;
+
+struct RtcActionJournal {
+    uint32_t magic;
+    uint32_t epoch;
+    uint32_t lastSeq;
+    uint32_t dropped;           // Entries pushed out by newer ones when full
+    JournalEntry entries[JOURNAL_SLOTS];
+};
+
+static const uint32_t RTC_JOURNAL_MAGIC = 0x4a524e4c;  // "JRNL"
+static RTC_NOINIT_ATTR RtcActionJournal rtcJournal;
+
+// HTTP worker task - drains the pending action table one batch at a time
 void DeviceController::httpWorkerTask(void* parameter) {
     DeviceController* controller = (DeviceController*)parameter;
-    HttpRequest request;
+    PendingActions batch;
+    BatchOutcome outcome;
 
     while (true) {
-        // Wait for a request (blocks until available)
-        if (xQueueReceive(controller->httpQueue, &request, portMAX_DELAY) == pdTRUE) {
+        // Sleep until something is queued
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // Presses made while a batch is in flight are picked up on the next pass
+        while (controller->takePending(batch)) {
             // Check WiFi before attempting connection
             if (WiFi.status() != WL_CONNECTED) {
-                Serial.println("DeviceController: WiFi not connected, dropping request");
-                continue;
+                LOG_I("DeviceController: WiFi not connected, journaling pending actions");
+                controller->journalBatch(batch);
+                break;
+            }
+            {
+                HeapTagScope heapTag(HEAP_TAG_HTTP_WORKER);
+                int64_t sentAt = esp_timer_get_time();
+                controller->flushPending(batch, outcome);
+                controller->batchLatency.observe(esp_timer_get_time() - sentAt);
+                if (outcome.delivered) {
+                    controller->batchesDelivered++;
+                } else {
+                    controller->batchesFailed++;
+                }
+            }
+            if (controller->batchTrace) {
+                latencyTrace.mark(LAT_HTTP_RESPONSE, controller->batchTrace);
             }
 
-            HTTPClient http;
-            http.begin(request.url);
-            http.addHeader("Content-Type", "application/json");
-            http.setTimeout(3000);  // 3 second timeout
-            http.setReuse(false);   // Don't reuse connections (cleaner socket management)
+            // Undelivered changes are back in the table; give the server a moment
+            uint32_t retryMs = controller->settleBatch(batch, outcome, true);
+            if (retryMs) {
+                vTaskDelay(pdMS_TO_TICKS(retryMs));
+            }
+        }
+    }
+}
 
-            int httpCode = http.POST(request.payload);
+// Direct worker task - carries out presses at their direct control targets,
+// so a slow target only ever delays its own buttons
+void DeviceController::directWorkerTask(void* parameter) {
+    DeviceController* controller = (DeviceController*)parameter;
+    PendingActions batch;
 
-            if (httpCode > 0) {
-                Serial.printf("DeviceController: POST %s -> %d\n", request.url, httpCode);
-            } else {
-                Serial.printf("DeviceController: POST failed: %d (%s)\n",
-                    httpCode, http.errorToString(httpCode).c_str());
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        while (controller->takeDirect(batch)) {
+            bool online = (WiFi.status() == WL_CONNECTED);
+            for (int id = 0; id < 256; id++) {
+                int word = id >> 5;
+                uint32_t bit = 1UL << (id & 31);
+                if (!(batch.buttons[word] & bit)) continue;
+
+                bool state = (batch.buttonStates[word] & bit) != 0;
+                bool hasSpeed = (batch.hasSpeed[word] & bit) != 0;
+                int speedLevel = hasSpeed ? batch.speedLevels[id] : -1;
+                bool done = online && controller->sendDirect(id, state, speedLevel);
+
+                // On to the action lane, which tells the server (or carries it
+                // out through the server if the target didn't). A newer press
+                // already back in the direct table takes its place.
+                portENTER_CRITICAL(&controller->pendingMux);
+                if (!(controller->directPending.buttons[word] & bit)) {
+                    PendingActions& p = controller->pending;
+                    p.buttons[word] |= bit;
+                    if (state) p.buttonStates[word] |= bit; else p.buttonStates[word] &= ~bit;
+                    if (hasSpeed) {
+                        p.hasSpeed[word] |= bit;
+                        p.speedLevels[id] = speedLevel;
+                    } else {
+                        p.hasSpeed[word] &= ~bit;
+                    }
+                    if (done) p.direct[word] |= bit; else p.direct[word] &= ~bit;
+                }
+                portEXIT_CRITICAL(&controller->pendingMux);
             }
+            if (controller->httpWorkerHandle) xTaskNotifyGive(controller->httpWorkerHandle);
+        }
+    }
+}
+
+// Background worker task - probes and reports, never in the way of an action
+void DeviceController::backgroundWorkerTask(void* parameter) {
+    DeviceController* controller = (DeviceController*)parameter;
+
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 
-            http.end();
+        while (true) {
+            portENTER_CRITICAL(&controller->pendingMux);
+            uint8_t requests = controller->backgroundPending;
+            uint8_t next = requests & -requests;   // Lowest bit first
+            controller->backgroundPending &= ~next;
+            portEXIT_CRITICAL(&controller->pendingMux);
+            if (next == 0) break;
 
-            // Small delay between requests to let sockets fully close
-            vTaskDelay(pdMS_TO_TICKS(50));
+            if (WiFi.status() != WL_CONNECTED) {
+                // Dropped: the server check probes again and a crash report
+                // stays pending until the next boot
+                continue;
+            }
+            controller->runBackground(next);
         }
     }
 }
 
 DeviceController::DeviceController()
     : serverConnected(false)
-    , lastServerCheck(0)
-    , lastWebhookTime(0)
-    , httpQueue(nullptr)
+    , lastServerContact(0)
+    , serverCheckJob(-1)
+    , pendingMux(portMUX_INITIALIZER_UNLOCKED)
+    , backgroundPending(0)
     , httpWorkerHandle(nullptr)
+    , directWorkerHandle(nullptr)
+    , backgroundWorkerHandle(nullptr)
+    , batchTrace(0)
+    , actionsMuted(false)
+    , actionSeq(0)
+    , stateVersion(0)
+    , suppressedUpdates(0)
+    , actionRollbacks(0)
+    , workerResponse(nullptr)
+    , directActions(0)
+    , directFallbacks(0)
+    , batchesDelivered(0)
+    , batchesFailed(0)
+    , batchLatency(LATENCY_BOUNDS_US, LATENCY_BOUND_COUNT)
+    , journalReplayed(0)
+    , snapshotMutex(nullptr)
+    , snapshotPacked(nullptr)
+    , snapshotPackedLen(0)
+    , snapshotValid(false)
+    , snapshotGeneration(0)
+    , snapshotVersion(0)
+    , snapshotIp(0)
+    , snapshotBrightness(0)
+    , reportedValid(false)
+    , reportedGeneration(0)
+    , reportedVersion(0)
 {
+    memset(&pending, 0, sizeof(pending));
+    memset(&directPending, 0, sizeof(directPending));
+    memset(&unconfirmed, 0, sizeof(unconfirmed));
+    memset(confirmedFans, 0, sizeof(confirmedFans));
 }
 
 void DeviceController::begin() {
-    Serial.println("DeviceController: Initializing...");
-
-    // Create HTTP request queue (small queue - we only care about latest state)
-    httpQueue = xQueueCreate(HTTP_QUEUE_SIZE, sizeof(HttpRequest));
-    if (httpQueue == nullptr) {
-        Serial.println("DeviceController: Failed to create HTTP queue!");
+    LOG_I("DeviceController: Initializing...");
+
+    httpPool.begin();
+    snapshotMutex = xSemaphoreCreateMutex();
+#if PANEL_STATIC_MEMORY
+    workerResponse = (char*)staticMemory.alloc(STATIC_POOL_HTTP, STATIC_HTTP_SLOT);
+#endif
+
+    // Journal from before a restart, or a fresh one
+    bool journalValid = rtcJournal.magic == RTC_JOURNAL_MAGIC;
+    for (const JournalEntry& e : rtcJournal.entries) {
+        if (e.kind > JOURNAL_SCENE || e.seq > rtcJournal.lastSeq) journalValid = false;
+    }
+    if (!journalValid) {
+        memset(&rtcJournal, 0, sizeof(rtcJournal));
+        rtcJournal.magic = RTC_JOURNAL_MAGIC;
+        rtcJournal.epoch = esp_random() | 1;
+    } else if (uint8_t kept = getJournaled()) {
+        LOG_I("DeviceController: %u journaled actions from before the restart", kept);
     }
 
-    // Create single HTTP worker task
+    // One task per HTTP lane, so a hung endpoint holds up only its own lane
     xTaskCreatePinnedToCore(
         httpWorkerTask,
         "HTTPWorker",
-        4096,
+        7168,   // Batch JSON document lives on this stack
         this,
         1,  // Low priority
         &httpWorkerHandle,
         1   // Run on core 1 (leave core 0 for WiFi)
     );
+    xTaskCreatePinnedToCore(
+        directWorkerTask,
+        "HTTPDirect",
+        5120,
+        this,
+        1,
+        &directWorkerHandle,
+        1
+    );
+    xTaskCreatePinnedToCore(
+        backgroundWorkerTask,
+        "HTTPBackground",
+        6144,   // State document and crash report
+        this,
+        1,
+        &backgroundWorkerHandle,
+        1
+    );
 
     // Register callbacks with UI manager
     uiManager.setButtonCallback([](uint8_t buttonId, bool newState) {
@@ -82,232 +259,961 @@ void DeviceController::begin() {
         deviceController.onSceneActivated(sceneId);
     });
 
-    Serial.println("DeviceController: Initialized with HTTP worker task");
+    uiManager.setFanSpeedCallback([](uint8_t buttonId, uint8_t speedLevel) {
+        deviceController.onFanSpeedChanged(buttonId, speedLevel);
+    });
+
+    serverCheckJob = eventScheduler.add("server_check", onServerCheckTimer, this);
+    eventScheduler.schedule(serverCheckJob, SERVER_CHECK_INTERVAL);
+
+    LOG_I("DeviceController: Initialized with action, direct and background HTTP workers");
 }
 
 void DeviceController::onButtonStateChanged(uint8_t buttonId, bool newState) {
-    const DeviceConfig& config = configManager.getConfig();
-
-    // Find the button to check its type
-    for (const ButtonConfig& btn : config.buttons) {
-        if (btn.id == buttonId) {
-            // Scene buttons don't have state, just trigger the scene
-            if (btn.type == ButtonType::SCENE) {
-                Serial.printf("DeviceController: Scene button %d pressed\n", buttonId);
-                sendButtonWebhook(buttonId, true);  // Send press event to server
-                return;
-            }
-            break;
-        }
+    // Scene buttons don't have state, just trigger the scene
+    const ButtonConfig* btn = configManager.findButton(buttonId);
+    if (btn && btn->type == ButtonType::SCENE) {
+        LOG_I("DeviceController: Scene button %d pressed", buttonId);
+        sendButtonWebhook(buttonId, true);  // Send press event to server
+        return;
     }
 
-    Serial.printf("DeviceController: Button %d changed to %s\n", buttonId, newState ? "ON" : "OFF");
+    LOG_I("DeviceController: Button %d changed to %s", buttonId, newState ? "ON" : "OFF");
 
     // Update config for non-scene buttons
     configManager.setButtonState(buttonId, newState);
 
+    // Offline: the card keeps its new state and the server hears of it later
+    if (WiFi.status() != WL_CONNECTED) {
+        LOG_I("DeviceController: WiFi not connected, journaling press");
+        journalAction(JOURNAL_BUTTON, buttonId, newState);
+        return;
+    }
+
+    // The card has already flipped; a toggle's earlier state is the other one
+    trackAction(buttonId, true, !newState, false, 0);
+
     // Send webhook to server (non-blocking would be better, but keep it simple)
     sendButtonWebhook(buttonId, newState);
 }
 
+void DeviceController::onFanSpeedChanged(uint8_t buttonId, uint8_t speedLevel) {
+    LOG_D("DeviceController: Fan %d speed set to %d", buttonId, speedLevel);
+
+    configManager.setButtonSpeed(buttonId, speedLevel);
+
+    // The slider has moved already, so the speed to go back to is the last
+    // one the server confirmed, if it has confirmed one
+    portENTER_CRITICAL(&pendingMux);
+    bool known = (confirmedFans[buttonId >> 5] & (1UL << (buttonId & 31))) != 0;
+    uint8_t prior = confirmedSpeeds[buttonId];
+    portEXIT_CRITICAL(&pendingMux);
+
+    if (WiFi.status() != WL_CONNECTED) {
+        LOG_I("DeviceController: WiFi not connected, journaling fan change");
+        journalAction(JOURNAL_BUTTON, buttonId, speedLevel > 0, speedLevel);
+        return;
+    }
+    trackAction(buttonId, known, prior > 0, true, prior);
+
+    // Throttled slider levels (control_stream.h) coalesce in the pending
+    // table; the worker sends whichever is latest when it gets to them
+    queueButtonAction(buttonId, speedLevel > 0, speedLevel);
+    wakeWorker();
+}
+
 void DeviceController::onSceneActivated(uint8_t sceneId) {
-    Serial.printf("DeviceController: Scene %d activated\n", sceneId);
-
-    const DeviceConfig& config = configManager.getConfig();
-
-    // Find the scene
-    for (const SceneConfig& scene : config.scenes) {
-        if (scene.id == sceneId) {
-            // Handle built-in scene actions
-            if (scene.name == "All Off") {
-                setAllButtons(false);
-            } else if (scene.name == "All On") {
-                setAllButtons(true);
+    LOG_I("DeviceController: Scene %d activated", sceneId);
+
+    // Copy the scene's actions out and let the snapshot go before applying
+    // them: setFanSpeed()/updateButtonState() reach config writers, which
+    // must not run while a snapshot is held
+    SceneAction actions[MAX_SCENE_ACTIONS];
+    uint8_t count = 0;
+    {
+        ConfigSnapshot snapshot;
+        for (const SceneConfig& s : snapshot->scenes) {
+            if (s.id == sceneId) {
+                for (uint8_t i = 0; i < s.actionCount && count < MAX_SCENE_ACTIONS; i++) {
+                    actions[count++] = snapshot->sceneActions[s.firstAction + i];
+                }
+                break;
             }
-            break;
         }
     }
 
-    // Send webhook to server
-    sendSceneWebhook(sceneId);
+    // Queue the scene without waking the worker yet, so the button states
+    // set below go out in the same batch
+    bool online = (WiFi.status() == WL_CONNECTED);
+    if (online) {
+        queueSceneAction(sceneId);
+    } else {
+        LOG_I("DeviceController: WiFi not connected, journaling scene");
+        journalAction(JOURNAL_SCENE, sceneId, true);
+    }
+
+    // Walk the scene's compiled actions: called on the LVGL task, so every
+    // card changes in this one pass and shows in the same frame
+    for (uint8_t i = 0; i < count; i++) {
+        const SceneAction& action = actions[i];
+        bool hasSpeed = action.speedLevel != NO_SCENE_SPEED;
+        if (hasSpeed) {
+            uiManager.setFanSpeed(action.buttonId, action.speedLevel);
+        } else {
+            uiManager.updateButtonState(action.buttonId, action.state);
+        }
+        if (online) {
+            queueButtonAction(action.buttonId, action.state, hasSpeed ? action.speedLevel : -1);
+        } else {
+            journalAction(JOURNAL_BUTTON, action.buttonId, action.state, hasSpeed ? action.speedLevel : -1);
+        }
+    }
+
+    // Send scene and button changes to the server, in one batch
+    if (online) {
+        wakeWorker();
+    }
+    LOG_I("DeviceController: Scene %d set %d buttons", sceneId, count);
 }
 
 void DeviceController::setAllButtons(bool state) {
-    const DeviceConfig& config = configManager.getConfig();
+    // Collect the buttons and unpin before the loop, which writes states
+    uint8_t ids[MAX_BUTTONS];
+    ButtonType types[MAX_BUTTONS];
+    uint8_t count = 0;
+    {
+        ConfigSnapshot snapshot;
+        for (const ButtonConfig& btn : snapshot->buttons) {
+            if (btn.type == ButtonType::SENSOR) continue;
+            ids[count] = btn.id;
+            types[count] = btn.type;
+            count++;
+        }
+    }
 
-    for (const ButtonConfig& btn : config.buttons) {
-        configManager.setButtonState(btn.id, state);
-        uiManager.updateButtonState(btn.id, state);
+    for (uint8_t i = 0; i < count; i++) {
+        configManager.setButtonState(ids[i], state);
+        uiManager.updateButtonState(ids[i], state);
+
+        // Report the new states too; they ride in the same batch as the scene
+        if (types[i] == ButtonType::SCENE) continue;
+        int speedLevel = types[i] == ButtonType::FAN ? (state ? 1 : 0) : -1;
+        if (WiFi.status() == WL_CONNECTED) {
+            queueButtonAction(ids[i], state, speedLevel);
+        } else {
+            journalAction(JOURNAL_BUTTON, ids[i], state, speedLevel);
+        }
     }
+    wakeWorker();
 
-    Serial.printf("DeviceController: All buttons set to %s\n", state ? "ON" : "OFF");
+    LOG_I("DeviceController: All buttons set to %s", state ? "ON" : "OFF");
 }
 
-void DeviceController::httpPostAsync(const String& url, const String& payload) {
-    if (httpQueue == nullptr) {
-        Serial.println("DeviceController: HTTP queue not initialized");
+// ============================================================================
+// Pending action table
+// ============================================================================
+
+void DeviceController::queueButtonAction(uint8_t buttonId, bool state, int speedLevel) {
+    if (actionsMuted) {
         return;
     }
+    uint32_t bit = 1UL << (buttonId & 31);
+    int word = buttonId >> 5;
+
+    bool direct = false;
+    {
+        ConfigSnapshot snapshot;
+        for (const ButtonConfig& b : snapshot->buttons) {
+            if (b.id == buttonId) {
+                direct = b.directTarget < snapshot->direct.size();
+                break;
+            }
+        }
+    }
 
-    // Prepare request
-    HttpRequest request;
-    strncpy(request.url, url.c_str(), sizeof(request.url) - 1);
-    request.url[sizeof(request.url) - 1] = '\0';
-    strncpy(request.payload, payload.c_str(), sizeof(request.payload) - 1);
-    request.payload[sizeof(request.payload) - 1] = '\0';
-
-    // Try to add to queue (don't block if full - just drop the request)
-    // The state sync service will catch up with correct state anyway
-    if (xQueueSend(httpQueue, &request, 0) != pdTRUE) {
-        Serial.println("DeviceController: HTTP queue full, dropping request");
+    portENTER_CRITICAL(&pendingMux);
+    PendingActions& table = direct ? directPending : pending;
+    table.buttons[word] |= bit;
+    if (state) {
+        table.buttonStates[word] |= bit;
+    } else {
+        table.buttonStates[word] &= ~bit;
+    }
+    if (speedLevel >= 0) {
+        table.hasSpeed[word] |= bit;
+        table.speedLevels[buttonId] = speedLevel;
+    } else {
+        table.hasSpeed[word] &= ~bit;
+    }
+    if (direct) {
+        // An older press the action lane hasn't sent yet is superseded
+        pending.buttons[word] &= ~bit;
     }
+    pending.direct[word] &= ~bit;
+    latencyTrace.mark(LAT_WEBHOOK_ENQUEUE);
+    portEXIT_CRITICAL(&pendingMux);
+    peerMirror.mirror(buttonId, state, speedLevel);
 }
 
-void DeviceController::sendButtonWebhook(uint8_t buttonId, bool state) {
-    // Rate limiting
-    unsigned long now = millis();
-    if (now - lastWebhookTime < WEBHOOK_MIN_INTERVAL) {
+void DeviceController::queueSceneAction(uint8_t sceneId) {
+    if (actionsMuted) {
         return;
     }
-    lastWebhookTime = now;
+    portENTER_CRITICAL(&pendingMux);
+    pending.scenes[sceneId >> 5] |= 1UL << (sceneId & 31);
+    latencyTrace.mark(LAT_WEBHOOK_ENQUEUE);
+    portEXIT_CRITICAL(&pendingMux);
+}
 
-    if (WiFi.status() != WL_CONNECTED) {
-        Serial.println("DeviceController: WiFi not connected, skipping webhook");
+void DeviceController::wakeWorker() {
+    // Peers see the presses queued since the last wakeup at once
+    peerMirror.flush();
+    if (directWorkerHandle) xTaskNotifyGive(directWorkerHandle);
+    if (httpWorkerHandle) xTaskNotifyGive(httpWorkerHandle);
+}
+
+void DeviceController::queueBackground(uint8_t request) {
+    portENTER_CRITICAL(&pendingMux);
+    backgroundPending |= request;
+    portEXIT_CRITICAL(&pendingMux);
+    if (backgroundWorkerHandle) xTaskNotifyGive(backgroundWorkerHandle);
+}
+
+// ============================================================================
+// Offline journal
+// ============================================================================
+
+void DeviceController::journalAction(uint8_t kind, uint8_t id, bool state, int speedLevel) {
+    if (actionsMuted) {
         return;
     }
+    portENTER_CRITICAL(&pendingMux);
+    // The same button or scene's entry, else a free slot, else the oldest
+    JournalEntry* match = nullptr;
+    JournalEntry* unused = nullptr;
+    JournalEntry* oldest = nullptr;
+    for (JournalEntry& e : rtcJournal.entries) {
+        if (e.kind == JOURNAL_FREE) {
+            if (!unused) unused = &e;
+        } else if (e.kind == kind && e.id == id) {
+            match = &e;
+            break;
+        } else if (!oldest || e.seq < oldest->seq) {
+            oldest = &e;
+        }
+    }
+    JournalEntry* slot = match ? match : unused ? unused : oldest;
+    if (!match && !unused) {
+        rtcJournal.dropped++;
+    }
+    slot->seq = ++rtcJournal.lastSeq;
+    slot->kind = kind;
+    slot->id = id;
+    slot->state = state;
+    slot->speedLevel = speedLevel >= 0 ? speedLevel : NO_SCENE_SPEED;
+    portEXIT_CRITICAL(&pendingMux);
+}
 
-    const DeviceConfig& config = configManager.getConfig();
-    String url = config.server.reportingUrl + "/api/action/light/" + String(buttonId);
+void DeviceController::journalBatch(const PendingActions& batch) {
+    for (int id = 0; id < 256; id++) {
+        int word = id >> 5;
+        uint32_t bit = 1UL << (id & 31);
+        if (batch.scenes[word] & bit) {
+            journalAction(JOURNAL_SCENE, id, true);
+        }
+        if (!(batch.buttons[word] & bit)) continue;
+        journalAction(JOURNAL_BUTTON, id, (batch.buttonStates[word] & bit) != 0,
+                      (batch.hasSpeed[word] & bit) ? batch.speedLevels[id] : -1);
+
+        // Stays on screen; unless a newer press settles it, the journal does
+        portENTER_CRITICAL(&pendingMux);
+        if (!(pending.buttons[word] & bit)) {
+            unconfirmed.buttons[word] &= ~bit;
+            unconfirmed.failures[id] = 0;
+        }
+        portEXIT_CRITICAL(&pendingMux);
+    }
+}
 
-    // Create payload
-    StaticJsonDocument<256> doc;
-    doc["deviceId"] = config.device.id;
-    doc["buttonId"] = buttonId;
-    doc["state"] = state;
-    doc["timestamp"] = millis();
+uint32_t DeviceController::addJournal(JsonDocument& doc) {
+    JournalEntry entries[JOURNAL_SLOTS];
+    portENTER_CRITICAL(&pendingMux);
+    memcpy(entries, rtcJournal.entries, sizeof(entries));
+    uint32_t epoch = rtcJournal.epoch;
+    portEXIT_CRITICAL(&pendingMux);
+
+    // "journal":{"epoch":E,"buttons":[{"id","state","speedLevel","seq"}],"scenes":[{"id","seq"}]}
+    uint32_t through = 0;
+    JsonArray buttons;
+    JsonArray scenes;
+    for (const JournalEntry& e : entries) {
+        if (e.kind == JOURNAL_FREE) continue;
+        if (through == 0) {
+            JsonObject journal = doc.createNestedObject("journal");
+            journal["epoch"] = epoch;
+            buttons = journal.createNestedArray("buttons");
+            scenes = journal.createNestedArray("scenes");
+        }
+        JsonObject entry = (e.kind == JOURNAL_SCENE ? scenes : buttons).createNestedObject();
+        entry["id"] = e.id;
+        if (e.kind == JOURNAL_BUTTON) {
+            entry["state"] = e.state != 0;
+            if (e.speedLevel != NO_SCENE_SPEED) {
+                entry["speedLevel"] = e.speedLevel;
+            }
+        }
+        entry["seq"] = e.seq;
+        if (e.seq > through) through = e.seq;
+    }
+    return through;
+}
+
+void DeviceController::trimJournal(uint32_t throughSeq) {
+    // Entries replaced since the batch went out have newer sequences and stay
+    uint8_t taken = 0;
+    portENTER_CRITICAL(&pendingMux);
+    for (JournalEntry& e : rtcJournal.entries) {
+        if (e.kind != JOURNAL_FREE && e.seq <= throughSeq) {
+            e.kind = JOURNAL_FREE;
+            taken++;
+        }
+    }
+    portEXIT_CRITICAL(&pendingMux);
+    journalReplayed += taken;
+    LOG_I("DeviceController: Server has %u journaled actions", taken);
+}
 
-    String payload;
-    serializeJson(doc, payload);
+uint8_t DeviceController::getJournaled() const {
+    uint8_t count = 0;
+    for (const JournalEntry& e : rtcJournal.entries) {
+        if (e.kind != JOURNAL_FREE) count++;
+    }
+    return count;
+}
 
-    // Use async POST so UI isn't blocked
-    httpPostAsync(url, payload);
+uint32_t DeviceController::getJournalDropped() const {
+    return rtcJournal.dropped;
 }
 
-void DeviceController::sendSceneWebhook(uint8_t sceneId) {
-    // Rate limiting
-    unsigned long now = millis();
-    if (now - lastWebhookTime < WEBHOOK_MIN_INTERVAL) {
+void DeviceController::replayJournal() {
+    if (getJournaled() == 0 || WiFi.status() != WL_CONNECTED) {
         return;
     }
-    lastWebhookTime = now;
+    portENTER_CRITICAL(&pendingMux);
+    pending.replay = true;
+    portEXIT_CRITICAL(&pendingMux);
+    wakeWorker();
+}
 
-    if (WiFi.status() != WL_CONNECTED) {
-        Serial.println("DeviceController: WiFi not connected, skipping webhook");
+// ============================================================================
+// Optimistic presses
+// ============================================================================
+
+void DeviceController::trackAction(uint8_t buttonId, bool hasPrior, bool priorState,
+                                   bool priorIsSpeed, uint8_t priorSpeed) {
+    if (actionsMuted) {
         return;
     }
+    uint32_t bit = 1UL << (buttonId & 31);
+    int word = buttonId >> 5;
+
+    portENTER_CRITICAL(&pendingMux);
+    // Pressed again before the server answered: still going back to what
+    // the card showed before the first press
+    if (!(unconfirmed.buttons[word] & bit)) {
+        unconfirmed.buttons[word] |= bit;
+        if (hasPrior) unconfirmed.hasPrior[word] |= bit; else unconfirmed.hasPrior[word] &= ~bit;
+        if (priorState) unconfirmed.priorStates[word] |= bit; else unconfirmed.priorStates[word] &= ~bit;
+        if (priorIsSpeed) unconfirmed.priorIsSpeed[word] |= bit; else unconfirmed.priorIsSpeed[word] &= ~bit;
+        unconfirmed.priorSpeeds[buttonId] = priorSpeed;
+    }
+    unconfirmed.failures[buttonId] = 0;
+    portEXIT_CRITICAL(&pendingMux);
+}
 
-    const DeviceConfig& config = configManager.getConfig();
-    String url = config.server.reportingUrl + "/api/action/scene/" + String(sceneId);
+uint32_t DeviceController::settleBatch(const PendingActions& batch, const BatchOutcome& outcome, bool retry) {
+    struct Rollback {
+        uint8_t id;
+        bool hasPrior;
+        bool state;
+        bool isSpeed;
+        uint8_t speed;
+    };
+    Rollback rollbacks[MAX_BUTTONS];
+    int rollbackCount = 0;
+    uint8_t retryFailures = 0;
+
+    portENTER_CRITICAL(&pendingMux);
+    for (int id = 0; id < 256; id++) {
+        int word = id >> 5;
+        uint32_t bit = 1UL << (id & 31);
+        if (!(batch.buttons[word] & bit)) continue;
+
+        // A newer press of the button is already queued; its batch settles it
+        bool superseded = ((pending.buttons[word] | directPending.buttons[word]) & bit) != 0;
+
+        // Done at its direct target: confirmed whether or not the server heard
+        if (outcome.delivered || (outcome.direct[word] & bit)) {
+            if (batch.hasSpeed[word] & bit) {
+                confirmedFans[word] |= bit;
+                confirmedSpeeds[id] = batch.speedLevels[id];
+            }
+            if (superseded || !(unconfirmed.buttons[word] & bit)) continue;
+            unconfirmed.buttons[word] &= ~bit;
+            unconfirmed.failures[id] = 0;
 
-    // Create payload
-    StaticJsonDocument<256> doc;
-    doc["deviceId"] = config.device.id;
-    doc["sceneId"] = sceneId;
-    doc["timestamp"] = millis();
+            // Answered, but the plugin couldn't do it: show what the server has
+            if ((outcome.refused[word] & bit) && rollbackCount < MAX_BUTTONS) {
+                rollbacks[rollbackCount++] = { (uint8_t)id, true, (outcome.refusedStates[word] & bit) != 0, false, 0 };
+            }
+            continue;
+        }
+
+        if (superseded || !(unconfirmed.buttons[word] & bit)) continue;
+        if (retry && ++unconfirmed.failures[id] <= MAX_ACTION_RETRIES) {
+            // Back in the table exactly as it went out
+            pending.buttons[word] |= bit;
+            if (batch.buttonStates[word] & bit) pending.buttonStates[word] |= bit; else pending.buttonStates[word] &= ~bit;
+            if (batch.hasSpeed[word] & bit) {
+                pending.hasSpeed[word] |= bit;
+                pending.speedLevels[id] = batch.speedLevels[id];
+            }
+            if (unconfirmed.failures[id] > retryFailures) retryFailures = unconfirmed.failures[id];
+            continue;
+        }
+        unconfirmed.buttons[word] &= ~bit;
+        unconfirmed.failures[id] = 0;
+        if (rollbackCount < MAX_BUTTONS) {
+            rollbacks[rollbackCount++] = {
+                (uint8_t)id,
+                (unconfirmed.hasPrior[word] & bit) != 0,
+                (unconfirmed.priorStates[word] & bit) != 0,
+                (unconfirmed.priorIsSpeed[word] & bit) != 0,
+                unconfirmed.priorSpeeds[id]
+            };
+        }
+    }
+    portEXIT_CRITICAL(&pendingMux);
+
+    // Config and UI queue take their own locks
+    for (int i = 0; i < rollbackCount; i++) {
+        const Rollback& r = rollbacks[i];
+        rollbackAction(r.id, r.hasPrior, r.state, r.isSpeed, r.speed);
+    }
+
+    // Scenes aren't retried: a scene press isn't shown optimistically
+    return retryFailures ? ACTION_RETRY_MS << (retryFailures - 1) : 0;
+}
+
+void DeviceController::rollbackAction(uint8_t buttonId, bool hasPrior, bool priorState,
+                                      bool priorIsSpeed, uint8_t priorSpeed) {
+    if (actionsMuted) {
+        return;
+    }
+    if (hasPrior) {
+        if (priorIsSpeed) {
+            configManager.setButtonSpeed(buttonId, priorSpeed);
+            uiManager.postFanSpeed(buttonId, priorSpeed);
+        } else {
+            configManager.setButtonState(buttonId, priorState);
+            uiManager.postButtonState(buttonId, priorState);
+        }
+        // Peers showed the press too
+        peerMirror.mirror(buttonId, priorIsSpeed ? priorSpeed > 0 : priorState, priorIsSpeed ? priorSpeed : -1);
+        peerMirror.flush();
+    }
+    uiManager.postActionFailed(buttonId);
+    actionRollbacks++;
+    LOG_I("DeviceController: Action on button %d not confirmed, %s",
+        buttonId, hasPrior ? "rolled back" : "left as is");
+}
+
+bool DeviceController::takePending(PendingActions& batch) {
+    portENTER_CRITICAL(&pendingMux);
+    batch = pending;
+    pending.replay = false;
+    memset(pending.buttons, 0, sizeof(pending.buttons));
+    memset(pending.hasSpeed, 0, sizeof(pending.hasSpeed));
+    memset(pending.direct, 0, sizeof(pending.direct));
+    memset(pending.scenes, 0, sizeof(pending.scenes));
+    // Traced press whose action is in this batch (enqueue is stamped under the same lock)
+    batchTrace = latencyTrace.openWith(LAT_WEBHOOK_ENQUEUE);
+    portEXIT_CRITICAL(&pendingMux);
+
+    if (batch.replay) return true;
+    for (int i = 0; i < 8; i++) {
+        if (batch.buttons[i] || batch.scenes[i]) return true;
+    }
+    return false;
+}
 
-    String payload;
-    serializeJson(doc, payload);
+bool DeviceController::takeDirect(PendingActions& batch) {
+    portENTER_CRITICAL(&pendingMux);
+    batch = directPending;
+    memset(directPending.buttons, 0, sizeof(directPending.buttons));
+    memset(directPending.hasSpeed, 0, sizeof(directPending.hasSpeed));
+    portEXIT_CRITICAL(&pendingMux);
 
-    // Use async POST so UI isn't blocked
-    httpPostAsync(url, payload);
+    for (int i = 0; i < 8; i++) {
+        if (batch.buttons[i]) return true;
+    }
+    return false;
 }
 
-bool DeviceController::httpPost(const String& url, const String& payload) {
-    HTTPClient http;
-    http.begin(url);
-    http.addHeader("Content-Type", "application/json");
-    http.setTimeout(2000);  // 2 second timeout
+// Copy a body template with "{value}" replaced by value
+static bool fillDirectBody(char* out, size_t size, const char* tmpl, int value) {
+    static const char mark[] = "{value}";
+    const char* at = strstr(tmpl, mark);
+    if (at == nullptr) {
+        return strlcpy(out, tmpl, size) < size;
+    }
+    int n = snprintf(out, size, "%.*s%d%s", (int)(at - tmpl), tmpl, value, at + sizeof(mark) - 1);
+    return n >= 0 && (size_t)n < size;
+}
 
-    int httpCode = http.POST(payload);
-    http.end();
+bool DeviceController::sendDirect(uint8_t buttonId, bool state, int speedLevel) {
+    // Copied out, so no config is pinned while the request runs
+    {
+        ConfigSnapshot snapshot;
+        const ButtonConfig* btn = nullptr;
+        for (const ButtonConfig& b : snapshot->buttons) {
+            if (b.id == buttonId) {
+                btn = &b;
+                break;
+            }
+        }
+        if (btn == nullptr || btn->directTarget >= snapshot->direct.size()) {
+            return false;
+        }
+
+        const DirectTargetConfig& target = snapshot->direct[btn->directTarget];
+        const char* body = state ? target.onBody.c_str() : target.offBody.c_str();
+        if (speedLevel >= 0 && target.speedBody.length() > 0) {
+            body = target.speedBody.c_str();
+        }
+        int urlLen = snprintf(directUrl, sizeof(directUrl), "%s%s", target.url.c_str(), btn->directPath.c_str());
+        if (urlLen < 0 || (size_t)urlLen >= sizeof(directUrl) ||
+            !fillDirectBody(directBody, sizeof(directBody), body, speedLevel) ||
+            strlcpy(directAuth, target.auth.c_str(), sizeof(directAuth)) >= sizeof(directAuth)) {
+            LOG_I("DeviceController: Direct target of button %d doesn't fit, using the server", buttonId);
+            return false;
+        }
+    }
+
+    int httpCode = httpPool.put(directUrl, directBody, directAuth, DIRECT_TIMEOUT_MS);
+    if (httpCode >= 200 && httpCode < 300) {
+        directActions++;
+        return true;
+    }
+    // An expired token (401) included: the server has a fresh one and sends it along
+    directFallbacks++;
+    LOG_E("DeviceController: Direct action on button %d failed (%d), sending through the server",
+        buttonId, httpCode);
+    return false;
+}
+
+void DeviceController::flushPending(const PendingActions& batch, BatchOutcome& outcome) {
+    memset(&outcome, 0, sizeof(outcome));
+
+    // Copy what the POST needs up front: the config may be republished
+    // (twice, resetting this slot's strings) while the batch is sent
+    {
+        ConfigSnapshot config;
+        snprintf(workerUrl, sizeof(workerUrl), "%s/api/action/batch", config->server.reportingUrl.c_str());
+        snprintf(workerDeviceId, sizeof(workerDeviceId), "%s", config->device.id.c_str());
+    }
+
+    // Everything pending goes out as one batch: a single WebSocket frame,
+    // or a single POST when the channel is down
+    StaticJsonDocument<1536> doc;
+    JsonArray buttons = doc.createNestedArray("buttons");
+    JsonArray scenes = doc.createNestedArray("scenes");
+
+    for (int id = 0; id < 256; id++) {
+        int word = id >> 5;
+        uint32_t bit = 1UL << (id & 31);
+        if (batch.buttons[word] & bit) {
+            bool state = (batch.buttonStates[word] & bit) != 0;
+            bool hasSpeed = (batch.hasSpeed[word] & bit) != 0;
+            JsonObject b = buttons.createNestedObject();
+            b["id"] = id;
+            b["state"] = state;
+            if (hasSpeed) {
+                b["speedLevel"] = batch.speedLevels[id];
+            }
+
+            // Carried out at its direct target already: the server only hears of it
+            if (batch.direct[word] & bit) {
+                outcome.direct[word] |= bit;
+                b["direct"] = true;
+            }
+        }
+        if (batch.scenes[word] & bit) {
+            scenes.add(id);
+        }
+    }
+
+    // Whatever was done offline rides along
+    uint32_t journalSeq = addJournal(doc);
+
+    if (buttons.size() == 0 && scenes.size() == 0 && journalSeq == 0) {
+        outcome.delivered = true;
+        return;
+    }
+    doc["seq"] = ++actionSeq;
+
+    // Serialize straight into the worker's buffers - no String temporaries.
+    // A frame the socket took counts as delivered; the server answers
+    // socket batches with state pushes, not per-button results.
+    if (serverChannel.isConnected()) {
+        doc["t"] = "batch";
+        serializeJson(doc, workerPayload, sizeof(workerPayload));
+        if (serverChannel.send(workerPayload)) {
+            outcome.delivered = true;
+            if (journalSeq) trimJournal(journalSeq);
+            return;
+        }
+        doc.remove("t");
+    }
+
+    // const char* keeps ArduinoJson from copying the id into the pool
+    doc["deviceId"] = (const char*)workerDeviceId;
+    doc["timestamp"] = millis();
+    serializeJson(doc, workerPayload, sizeof(workerPayload));
+    String response;
+    int httpCode = workerResponse
+        ? postFromWorker(workerUrl, workerPayload, nullptr, workerResponse, STATIC_HTTP_SLOT)
+        : postFromWorker(workerUrl, workerPayload, &response);
+    if (httpCode < 200 || httpCode >= 300) {
+        return;
+    }
+    outcome.delivered = true;
+    if (journalSeq) trimJournal(journalSeq);
+
+    // {"results":[{"buttonId":3,"success":false,"state":true}, ...]}
+    StaticJsonDocument<64> filter;
+    JsonObject resultFilter = filter["results"].createNestedObject();
+    resultFilter["buttonId"] = true;
+    resultFilter["success"] = true;
+    resultFilter["state"] = true;
+    PsramJsonDocument result(JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(MAX_BUTTONS + 8) +
+                             (MAX_BUTTONS + 8) * JSON_OBJECT_SIZE(3));
+    const char* body = workerResponse ? workerResponse : response.c_str();
+    if (deserializeJson(result, body, DeserializationOption::Filter(filter))) {
+        return;  // Delivered; no word on the plugins
+    }
+    for (JsonObject r : result["results"].as<JsonArray>()) {
+        if (!r.containsKey("buttonId") || (r["success"] | true)) continue;
+        uint8_t id = r["buttonId"];
+        uint32_t bit = 1UL << (id & 31);
+        outcome.refused[id >> 5] |= bit;
+        if (r["state"] | false) outcome.refusedStates[id >> 5] |= bit;
+    }
+}
+
+int DeviceController::postFromWorker(const char* url, const char* payload, String* response,
+                                     char* buf, size_t len) {
+    // Keep-alive pool: back-to-back presses reuse the open socket
+    int httpCode = buf ? httpPool.post(url, payload, ACTION_TIMEOUT_MS, buf, len)
+                       : httpPool.post(url, payload, ACTION_TIMEOUT_MS, response);
+    noteServerResult(httpCode > 0);
 
     if (httpCode > 0) {
-        Serial.printf("DeviceController: POST %s -> %d\n", url.c_str(), httpCode);
-        return httpCode >= 200 && httpCode < 300;
+        LOG_D("DeviceController: POST %s -> %d", url, httpCode);
     } else {
-        Serial.printf("DeviceController: POST failed: %s\n", http.errorToString(httpCode).c_str());
-        return false;
+        LOG_E("DeviceController: POST failed: %d (%s)",
+            httpCode, HTTPClient::errorToString(httpCode).c_str());
     }
+    return httpCode;
 }
 
-void DeviceController::reportStateToServer() {
+void DeviceController::sendButtonWebhook(uint8_t buttonId, bool state) {
     if (WiFi.status() != WL_CONNECTED) {
+        LOG_I("DeviceController: WiFi not connected, journaling webhook");
+        journalAction(JOURNAL_BUTTON, buttonId, state);
+        return;
+    }
+
+    // Latest state per button wins; the worker sends it without blocking the UI
+    queueButtonAction(buttonId, state);
+    wakeWorker();
+}
+
+bool DeviceController::stateReported() const {
+    return reportedValid && reportedGeneration == configManager.getGeneration() &&
+           reportedVersion == stateVersion;
+}
+
+void DeviceController::reportStateToServer() {
+    if (WiFi.status() != WL_CONNECTED || stateReported()) {
         return;
     }
+    queueBackground(BG_STATE_REPORT);
+}
+
+void DeviceController::uploadCrashReport() {
+    if (crashReport.isPending()) {
+        queueBackground(BG_CRASH_REPORT);
+    }
+}
+
+// ============================================================================
+// Background lane
+// ============================================================================
+
+void DeviceController::runBackground(uint8_t request) {
+    switch (request) {
+        case BG_PROBE: {
+            String url = String(configManager.getConfig().server.reportingUrl.c_str()) + "/api/ping";
+            int httpCode = httpPool.get(url.c_str(), PROBE_TIMEOUT_MS);
+            noteServerResult(httpCode == 200);
+            break;
+        }
+        case BG_STATE_REPORT:
+            sendStateReport();
+            break;
+        case BG_CRASH_REPORT:
+            if (crashReport.isPending()) {
+                crashReport.upload(configManager.getConfig().server.reportingUrl, configManager.getDeviceId());
+            }
+            break;
+    }
+}
 
-    const DeviceConfig& config = configManager.getConfig();
-    String url = config.server.reportingUrl + "/api/devices/" + config.device.id + "/state";
+void DeviceController::sendStateReport() {
+    // Requests queued before an earlier report went out are covered by it
+    if (stateReported()) {
+        return;
+    }
+    // Read before the document, so a change made while it's built is sent next time
+    uint32_t generation = configManager.getGeneration();
+    uint32_t version = stateVersion;
+
+    String url;
+    {
+        ConfigSnapshot config;
+        url = String(config->server.reportingUrl.c_str()) + "/api/devices/" + config->device.id.c_str() + "/state";
+    }
 
     String payload = getStateJson();
-    httpPost(url, payload);
+    int httpCode = httpPool.post(url.c_str(), payload.c_str(), REPORT_TIMEOUT_MS);
+    noteServerResult(httpCode > 0);
+
+    if (httpCode > 0) {
+        LOG_D("DeviceController: POST %s -> %d", url.c_str(), httpCode);
+        if (httpCode >= 200 && httpCode < 300) {
+            reportedGeneration = generation;
+            reportedVersion = version;
+            reportedValid = true;
+        }
+    } else {
+        LOG_E("DeviceController: POST failed: %s", HTTPClient::errorToString(httpCode).c_str());
+    }
 }
 
-void DeviceController::processServerStateUpdate(const String& json) {
-    StaticJsonDocument<1024> doc;
-    DeserializationError error = deserializeJson(doc, json);
+bool DeviceController::processServerStateUpdate(char* json, size_t len, bool msgpack, bool* resync) {
+    // Only buttons[].{id,state,speedLevel}, brightness, the version fields and
+    // the server's clock are applied; the filter drops everything else before
+    // it takes pool space
+    StaticJsonDocument<176> filter;
+    JsonObject buttonFilter = filter["buttons"].createNestedObject();
+    buttonFilter["id"] = true;
+    buttonFilter["state"] = true;
+    buttonFilter["speedLevel"] = true;
+    filter["brightness"] = true;
+    filter["version"] = true;
+    filter["base"] = true;
+    filter["serverTime"] = true;
+
+    // Room for every configured button (pushes carry each at most once); no
+    // strings survive the filter, and parsing a mutable buffer is zero-copy anyway
+    StaticJsonDocument<JSON_OBJECT_SIZE(5) + JSON_ARRAY_SIZE(MAX_BUTTONS) +
+                       MAX_BUTTONS * JSON_OBJECT_SIZE(3)> doc;
+    DeserializationError error = msgpack
+        ? deserializeMsgPack(doc, json, len, DeserializationOption::Filter(filter))
+        : deserializeJson(doc, json, len, DeserializationOption::Filter(filter));
 
     if (error) {
-        Serial.printf("DeviceController: Failed to parse state update: %s\n", error.c_str());
-        return;
+        LOG_E("DeviceController: Failed to parse state update: %s", error.c_str());
+        return false;
+    }
+
+    // Called from web server callbacks - UI changes are queued for the LVGL task
+    // A push from the server is proof it's up
+    noteServerResult(true);
+
+    // Its clock too, before the schedules miss it right after boot
+    if (doc.containsKey("serverTime")) {
+        timeManager.setTimeFromServer(doc["serverTime"].as<uint32_t>());
+    }
+
+    // Versioned pushes: "version" is the server's state counter for this panel,
+    // "base" the version a delta was computed against. A delta against a
+    // version we never applied (e.g. after a reboot) is applied anyway, but
+    // the caller asks the server for a full push.
+    uint32_t version = doc["version"] | 0;
+    if (resync) {
+        *resync = doc.containsKey("base") && (doc["base"].as<uint32_t>() != stateVersion);
     }
 
-    // Update button states
     JsonArray buttons = doc["buttons"];
+    if (version != 0 && version == stateVersion && buttons.size() == 0 && !doc.containsKey("brightness")) {
+        suppressedUpdates++;
+        return true;  // Heartbeat, nothing changed
+    }
+
+    // Update button states, skipping any that already match so unchanged
+    // cards aren't restyled and redrawn
+    int applied = 0;
     for (JsonObject btn : buttons) {
-        uint8_t id = btn["id"];
-        bool state = btn["state"];
-
-        // Check if speedLevel is present (for fans)
-        if (btn.containsKey("speedLevel")) {
-            uint8_t speedLevel = btn["speedLevel"];
-            uiManager.setFanSpeed(id, speedLevel);
-            configManager.setButtonState(id, speedLevel > 0);
-        } else {
-            configManager.setButtonState(id, state);
-            uiManager.updateButtonState(id, state);
+        int speedLevel = btn.containsKey("speedLevel") ? btn["speedLevel"].as<uint8_t>() : -1;
+        if (applyServerButton(btn["id"].as<uint8_t>(), btn["state"].as<bool>(), speedLevel)) {
+            applied++;
         }
     }
 
     // Update display settings if present
     if (doc.containsKey("brightness")) {
         uint8_t brightness = doc["brightness"];
-        uiManager.setBrightness(brightness);
-        configManager.getConfigMutable().display.brightness = brightness;
+        if (brightness != uiManager.getBrightness()) {
+            uiManager.postBrightness(brightness);
+            configManager.setBrightness(brightness);
+            configManager.markDirty(ConfigManager::DIRTY_DISPLAY);
+            applied++;
+        } else {
+            suppressedUpdates++;
+        }
+    }
+
+    if (version != 0) {
+        stateVersion = version;
+    }
+
+    if (applied > 0) {
+        LOG_I("DeviceController: State update processed (%d changed, v%u)", applied, version);
     }
+    return true;
+}
 
-    Serial.println("DeviceController: State update processed");
+bool DeviceController::applyServerButton(uint8_t id, bool state, int speedLevel) {
+    peerMirror.noteServerState(id);
+    if (speedLevel >= 0) {
+        portENTER_CRITICAL(&pendingMux);
+        confirmedFans[id >> 5] |= 1UL << (id & 31);
+        confirmedSpeeds[id] = speedLevel;
+        portEXIT_CRITICAL(&pendingMux);
+    }
+    return applyPeerButton(id, state, speedLevel);
+}
+
+bool DeviceController::applyPeerButton(uint8_t id, bool state, int speedLevel) {
+    if (speedLevel >= 0) {
+        // Fans carry their speed; the state follows it
+        if (configManager.getButtonState(id) == (speedLevel > 0) &&
+            uiManager.getFanSpeed(id) == speedLevel) {
+            suppressedUpdates++;
+            return false;
+        }
+        configManager.setButtonSpeed(id, speedLevel);
+        uiManager.postFanSpeed(id, speedLevel);
+    } else {
+        if (configManager.getButtonState(id) == state) {
+            suppressedUpdates++;
+            return false;
+        }
+        configManager.setButtonState(id, state);
+        uiManager.postButtonState(id, state);
+    }
+    return true;
+}
+
+void DeviceController::refreshSnapshot() {
+    uint32_t generation = configManager.getGeneration();
+    uint32_t version = stateVersion;
+    uint32_t ip = (uint32_t)WiFi.localIP();
+    uint8_t brightness = uiManager.getBrightness();
+    if (snapshotValid && generation == snapshotGeneration && version == snapshotVersion &&
+        ip == snapshotIp && brightness == snapshotBrightness) {
+        return;
+    }
+
+    // Every configured button and scene, with names borrowed from the config
+    PsramJsonDocument doc(JSON_OBJECT_SIZE(10) + JSON_ARRAY_SIZE(MAX_BUTTONS) +
+                          MAX_BUTTONS * JSON_OBJECT_SIZE(4) + JSON_ARRAY_SIZE(MAX_SCENES) +
+                          MAX_SCENES * JSON_OBJECT_SIZE(2) + 64);
+    {
+        ConfigSnapshot config;
+        buildStateDoc(doc, *config);
+        snapshotJson = "";
+        serializeJson(doc, snapshotJson);
+        free(snapshotPacked);
+        snapshotPackedLen = measureMsgPack(doc);
+        snapshotPacked = (uint8_t*)malloc(snapshotPackedLen);
+        if (snapshotPacked) {
+            serializeMsgPack(doc, snapshotPacked, snapshotPackedLen);
+        }
+    }
+    snapshotValid = snapshotPacked != nullptr;  // Else try again next time
+    snapshotGeneration = generation;
+    snapshotVersion = version;
+    snapshotIp = ip;
+    snapshotBrightness = brightness;
 }
 
 String DeviceController::getStateJson() {
-    const DeviceConfig& config = configManager.getConfig();
+    String result;
+    xSemaphoreTake(snapshotMutex, portMAX_DELAY);
+    refreshSnapshot();
+    result.reserve(snapshotJson.length() + 24);
+    result = "{\"uptime\":";
+    result += millis() / 1000;
+    result += ',';
+    result += snapshotJson.c_str() + 1;
+    xSemaphoreGive(snapshotMutex);
+    return result;
+}
 
-    DynamicJsonDocument doc(1024);
+void DeviceController::writeState(Print& out, bool msgpack) {
+    uint32_t uptime = millis() / 1000;
+    xSemaphoreTake(snapshotMutex, portMAX_DELAY);
+    refreshSnapshot();
+    if (msgpack) {
+        // fixmap header + 1, "uptime" as a fixstr, the value as a uint32
+        // (out of memory for the packed copy: a map of just the uptime)
+        uint8_t head[] = {
+            (uint8_t)(snapshotPacked ? snapshotPacked[0] + 1 : 0x81),
+            0xA6, 'u', 'p', 't', 'i', 'm', 'e',
+            0xCE, (uint8_t)(uptime >> 24), (uint8_t)(uptime >> 16), (uint8_t)(uptime >> 8), (uint8_t)uptime
+        };
+        out.write(head, sizeof(head));
+        if (snapshotPacked) {
+            out.write(snapshotPacked + 1, snapshotPackedLen - 1);
+        }
+    } else {
+        out.print("{\"uptime\":");
+        out.print(uptime);
+        out.print(',');
+        out.write((const uint8_t*)snapshotJson.c_str() + 1, snapshotJson.length() - 1);
+    }
+    xSemaphoreGive(snapshotMutex);
+}
 
-    doc["deviceId"] = config.device.id;
-    doc["name"] = config.device.name;
-    doc["location"] = config.device.location;
+void DeviceController::buildStateDoc(JsonDocument& doc, const DeviceConfig& config) {
+    doc["deviceId"] = config.device.id.c_str();
+    doc["name"] = config.device.name.c_str();
+    doc["location"] = config.device.location.c_str();
     doc["ip"] = WiFi.localIP().toString();
     doc["mac"] = WiFi.macAddress();
-    doc["uptime"] = millis() / 1000;
     doc["brightness"] = uiManager.getBrightness();
-    doc["theme"] = config.display.theme;
+    doc["theme"] = config.display.theme.c_str();
+    doc["stateVersion"] = stateVersion;
 
     // Button states
     JsonArray buttons = doc.createNestedArray("buttons");
     for (const ButtonConfig& btn : config.buttons) {
         JsonObject b = buttons.createNestedObject();
         b["id"] = btn.id;
-        b["name"] = btn.name;
+        b["name"] = btn.name.c_str();
         b["type"] = (btn.type == ButtonType::SWITCH) ? "switch" : "light";
         b["state"] = btn.state;
     }
@@ -317,43 +1223,46 @@ String DeviceController::getStateJson() {
     for (const SceneConfig& scn : config.scenes) {
         JsonObject s = scenes.createNestedObject();
         s["id"] = scn.id;
-        s["name"] = scn.name;
+        s["name"] = scn.name.c_str();
     }
-
-    String result;
-    serializeJson(doc, result);
-    return result;
 }
 
 bool DeviceController::isServerConnected() {
     return serverConnected;
 }
 
-void DeviceController::update() {
-    // Periodic server connectivity check
-    unsigned long now = millis();
-    if (now - lastServerCheck >= SERVER_CHECK_INTERVAL) {
-        lastServerCheck = now;
-
-        if (WiFi.status() == WL_CONNECTED) {
-            const DeviceConfig& config = configManager.getConfig();
-            String url = config.server.reportingUrl + "/api/ping";
-
-            HTTPClient http;
-            http.begin(url);
-            http.setTimeout(2000);
-
-            int httpCode = http.GET();
-            http.end();
+void DeviceController::noteServerResult(bool reachable) {
+    if (reachable) {
+        lastServerContact = millis();
+    }
+    if (serverConnected != reachable) {
+        serverConnected = reachable;
+        LOG_I("DeviceController: Server %s", reachable ? "connected" : "disconnected");
+        if (reachable) {
+            replayJournal();
+        }
+    }
+}
 
-            bool wasConnected = serverConnected;
-            serverConnected = (httpCode == 200);
+void DeviceController::queueServerProbe() {
+    queueBackground(BG_PROBE);
+}
 
-            if (serverConnected != wasConnected) {
-                Serial.printf("DeviceController: Server %s\n", serverConnected ? "connected" : "disconnected");
-            }
-        } else {
-            serverConnected = false;
-        }
+void DeviceController::onServerCheckTimer(void* arg) {
+    // Connectivity is tracked passively from webhook results, server pushes
+    // and the WebSocket heartbeat. Only if the server has been silent for a
+    // whole interval is a probe queued - never a blocking GET from loop().
+    DeviceController* self = (DeviceController*)arg;
+    eventScheduler.schedule(self->serverCheckJob, SERVER_CHECK_INTERVAL);
+
+    // A journal an earlier replay didn't get through is tried again
+    self->replayJournal();
+
+    if (serverChannel.isConnected()) {
+        self->noteServerResult(true);
+    } else if (WiFi.status() != WL_CONNECTED) {
+        self->noteServerResult(false);
+    } else if (millis() - self->lastServerContact >= SERVER_CHECK_INTERVAL) {
+        self->queueServerProbe();
     }
 }
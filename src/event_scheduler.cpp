@@ -0,0 +1,256 @@
+#include "event_scheduler.h"
+#include "perf_monitor.h"
+#include "stall_monitor.h"
+#include <esp_timer.h>
+
+// Global instance
+EventScheduler eventScheduler;
+
+EventScheduler::EventScheduler()
+    : jobCount(0)
+    , heapSize(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , owner(nullptr)
+{
+}
+
+void EventScheduler::begin() {
+    owner = xTaskGetCurrentTaskHandle();
+}
+
+int8_t EventScheduler::add(const char* name, EventJobFn fn, void* arg, bool wallClock) {
+    portENTER_CRITICAL(&mux);
+    if (jobCount == MAX_JOBS) {
+        portEXIT_CRITICAL(&mux);
+        Serial.printf("EventScheduler: Job table full, '%s' not registered\n", name);
+        return -1;
+    }
+    int8_t id = jobCount++;
+    Job& job = jobs[id];
+    job.name = name;
+    job.fn = fn;
+    job.arg = arg;
+    job.dueUs = 0;
+    job.heapPos = -1;
+    job.wallClock = wallClock;
+    job.runs = 0;
+    job.maxLateUs = 0;
+    portEXIT_CRITICAL(&mux);
+    return id;
+}
+
+// ============================================================================
+// Deadlines
+// ============================================================================
+
+void EventScheduler::schedule(int8_t id, uint32_t delayMs) {
+    if (id < 0 || id >= jobCount) return;
+
+    int64_t due = esp_timer_get_time() + (int64_t)delayMs * 1000;
+    portENTER_CRITICAL(&mux);
+    bool top = setDueLocked(id, due);
+    portEXIT_CRITICAL(&mux);
+    if (top) {
+        wakeOwner();
+    }
+}
+
+void EventScheduler::scheduleWithin(int8_t id, uint32_t delayMs) {
+    if (id < 0 || id >= jobCount) return;
+
+    int64_t due = esp_timer_get_time() + (int64_t)delayMs * 1000;
+    portENTER_CRITICAL(&mux);
+    bool top = false;
+    if (jobs[id].heapPos < 0 || due < jobs[id].dueUs) {
+        top = setDueLocked(id, due);
+    }
+    portEXIT_CRITICAL(&mux);
+    if (top) {
+        wakeOwner();
+    }
+}
+
+void EventScheduler::cancel(int8_t id) {
+    if (id < 0 || id >= jobCount) return;
+
+    portENTER_CRITICAL(&mux);
+    removeLocked(id);
+    portEXIT_CRITICAL(&mux);
+}
+
+void EventScheduler::postWallClockChange() {
+    int64_t now = esp_timer_get_time();
+    bool top = false;
+
+    portENTER_CRITICAL(&mux);
+    for (int8_t id = 0; id < jobCount; id++) {
+        if (jobs[id].wallClock) {
+            top = setDueLocked(id, now) || top;
+        }
+    }
+    portEXIT_CRITICAL(&mux);
+    if (top) {
+        wakeOwner();
+    }
+}
+
+uint32_t EventScheduler::remainingMs(int8_t id) const {
+    if (id < 0 || id >= jobCount) return UINT32_MAX;
+
+    portENTER_CRITICAL(&mux);
+    bool scheduled = jobs[id].heapPos >= 0;
+    int64_t due = jobs[id].dueUs;
+    portEXIT_CRITICAL(&mux);
+
+    if (!scheduled) return UINT32_MAX;
+    int64_t remaining = due - esp_timer_get_time();
+    return remaining > 0 ? (uint32_t)(remaining / 1000) : 0;
+}
+
+void EventScheduler::wakeOwner() {
+    // The loop re-reads the heap top after every job, so only other tasks
+    // need to interrupt its wait
+    if (owner && owner != xTaskGetCurrentTaskHandle()) {
+        xTaskNotifyGive(owner);
+    }
+}
+
+// ============================================================================
+// Heap
+// ============================================================================
+
+bool EventScheduler::setDueLocked(int8_t id, int64_t dueUs) {
+    Job& job = jobs[id];
+    if (job.heapPos < 0) {
+        job.dueUs = dueUs;
+        place(heapSize, id);
+        heapSize++;
+        siftUp(job.heapPos);
+    } else if (dueUs < job.dueUs) {
+        job.dueUs = dueUs;
+        siftUp(job.heapPos);
+    } else {
+        job.dueUs = dueUs;
+        siftDown(job.heapPos);
+    }
+
+    // The loop may be sleeping past this deadline
+    return heap[0] == id;
+}
+
+void EventScheduler::removeLocked(int8_t id) {
+    int8_t pos = jobs[id].heapPos;
+    if (pos < 0) return;
+
+    jobs[id].heapPos = -1;
+    heapSize--;
+    if (pos == heapSize) return;
+
+    // Move the last entry into the hole and restore order either way
+    int8_t moved = heap[heapSize];
+    place(pos, moved);
+    siftUp(pos);
+    siftDown(jobs[moved].heapPos);
+}
+
+void EventScheduler::place(uint8_t pos, int8_t id) {
+    heap[pos] = id;
+    jobs[id].heapPos = pos;
+}
+
+void EventScheduler::siftUp(uint8_t pos) {
+    int8_t id = heap[pos];
+    while (pos > 0) {
+        uint8_t parent = (pos - 1) / 2;
+        if (jobs[heap[parent]].dueUs <= jobs[id].dueUs) break;
+        place(pos, heap[parent]);
+        pos = parent;
+    }
+    place(pos, id);
+}
+
+void EventScheduler::siftDown(uint8_t pos) {
+    int8_t id = heap[pos];
+    while (true) {
+        uint8_t child = pos * 2 + 1;
+        if (child >= heapSize) break;
+        if (child + 1 < heapSize && jobs[heap[child + 1]].dueUs < jobs[heap[child]].dueUs) {
+            child++;
+        }
+        if (jobs[id].dueUs <= jobs[heap[child]].dueUs) break;
+        place(pos, heap[child]);
+        pos = child;
+    }
+    place(pos, id);
+}
+
+// ============================================================================
+// Loop
+// ============================================================================
+
+void EventScheduler::run() {
+    int64_t now = esp_timer_get_time();
+    TickType_t wait = pdMS_TO_TICKS(MAX_SLEEP_MS);
+
+    while (true) {
+        portENTER_CRITICAL(&mux);
+        if (heapSize == 0) {
+            portEXIT_CRITICAL(&mux);
+            break;
+        }
+        int8_t id = heap[0];
+        Job& job = jobs[id];
+        if (job.dueUs > now) {
+            int64_t ms = (job.dueUs - now + 999) / 1000;
+            portEXIT_CRITICAL(&mux);
+            if (ms > MAX_SLEEP_MS) ms = MAX_SLEEP_MS;
+            wait = pdMS_TO_TICKS(ms);
+            if (wait == 0) wait = 1;
+            break;
+        }
+        removeLocked(id);
+        uint32_t late = (uint32_t)(now - job.dueUs);
+        job.runs++;
+        if (late > job.maxLateUs) {
+            job.maxLateUs = late;
+        }
+        portEXIT_CRITICAL(&mux);
+
+        perfMonitor.record(PERF_LOOP_JITTER_US, late);
+        stallMonitor.enter(STALL_LOOP, job.name);
+        job.fn(job.arg);
+        stallMonitor.leave(STALL_LOOP);
+        now = esp_timer_get_time();
+    }
+
+    ulTaskNotifyTake(pdTRUE, wait);
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+void EventScheduler::writeJson(Print& out) const {
+    int64_t now = esp_timer_get_time();
+
+    out.print("{\"jobs\":[");
+    portENTER_CRITICAL(&mux);
+    uint8_t n = jobCount;
+    Job snapshot[MAX_JOBS];
+    memcpy(snapshot, jobs, n * sizeof(Job));
+    portEXIT_CRITICAL(&mux);
+
+    for (uint8_t i = 0; i < n; i++) {
+        const Job& job = snapshot[i];
+        out.printf("%s{\"name\":\"%s\",\"wall_clock\":%s,\"runs\":%u,\"max_late_us\":%u,\"due_in_ms\":",
+                   i ? "," : "", job.name, job.wallClock ? "true" : "false", job.runs, job.maxLateUs);
+        if (job.heapPos >= 0) {
+            int64_t ms = (job.dueUs - now) / 1000;
+            out.printf("%ld", (long)(ms > 0 ? ms : 0));
+        } else {
+            out.print("null");
+        }
+        out.print("}");
+    }
+    out.print("]}");
+}
@@ -0,0 +1,190 @@
+#include "gesture_engine.h"
+
+#define SCREEN_WIDTH 480
+#define SCREEN_HEIGHT 480
+
+// Global instance
+GestureEngine gestureEngine;
+
+static const char* const GESTURE_NAMES[] = {
+    "none",
+    "swipe_up",
+    "swipe_down",
+    "swipe_left",
+    "swipe_right",
+    "long_press",
+    "two_finger_tap",
+    "pinch_in",
+    "pinch_out"
+};
+
+GestureEngine::GestureEngine()
+    : phase(Phase::IDLE)
+    , claimed(false)
+    , moved(false)
+    , longPressSent(false)
+    , start{0, 0}
+    , startCenter{0, 0}
+    , startSpanSq(0)
+    , startedAt(0)
+    , head(0)
+    , count(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , recognized(0)
+{
+}
+
+const char* GestureEngine::name(Gesture gesture) {
+    uint8_t i = (uint8_t)gesture;
+    return i < sizeof(GESTURE_NAMES) / sizeof(GESTURE_NAMES[0]) ? GESTURE_NAMES[i] : "unknown";
+}
+
+bool GestureEngine::update(const TouchPoint* points, uint8_t n, unsigned long now) {
+    if (n == 0) {
+        release(now);
+        return false;
+    }
+
+    if (phase == Phase::IDLE) {
+        phase = Phase::ONE;
+        claimed = false;
+        moved = false;
+        longPressSent = false;
+        start = points[0];
+        startedAt = now;
+    }
+
+    if (n >= 2 && phase == Phase::ONE) {
+        // Second finger: from here on the touch is ours
+        phase = Phase::TWO;
+        claimed = true;
+        startCenter = {(int16_t)((points[0].x + points[1].x) / 2), (int16_t)((points[0].y + points[1].y) / 2)};
+        startSpanSq = spanSq(points);
+    }
+
+    switch (phase) {
+        case Phase::ONE:
+            updateOne(points[0], now);
+            break;
+        case Phase::TWO:
+            if (n >= 2) {
+                updateTwo(points, now);
+            }
+            break;
+        default:
+            break;
+    }
+    return claimed;
+}
+
+void GestureEngine::updateOne(const TouchPoint& p, unsigned long now) {
+    int16_t dx = p.x - start.x;
+    int16_t dy = p.y - start.y;
+    int16_t ax = abs(dx);
+    int16_t ay = abs(dy);
+    if (ax > TAP_SLOP_PX || ay > TAP_SLOP_PX) {
+        moved = true;
+    }
+
+    if (!moved && !longPressSent && now - startedAt >= LONG_PRESS_MS) {
+        longPressSent = true;
+        emit(Gesture::LONG_PRESS);
+        return;
+    }
+
+    if (now - startedAt > SWIPE_MAX_MS) {
+        // Too slow for a swipe; an edge drag stays a plain LVGL drag
+        if (moved) {
+            phase = Phase::DONE;
+        }
+        return;
+    }
+
+    // Mostly along one axis: the other moves at most half as far
+    Gesture swipe = Gesture::NONE;
+    if (ay >= SWIPE_MIN_PX && ax * 2 <= ay) {
+        if (dy > 0 && start.y < EDGE_PX) {
+            swipe = Gesture::SWIPE_DOWN;
+        } else if (dy < 0 && start.y >= SCREEN_HEIGHT - EDGE_PX) {
+            swipe = Gesture::SWIPE_UP;
+        }
+    } else if (ax >= SWIPE_MIN_PX && ay * 2 <= ax) {
+        if (dx > 0 && start.x < EDGE_PX) {
+            swipe = Gesture::SWIPE_RIGHT;
+        } else if (dx < 0 && start.x >= SCREEN_WIDTH - EDGE_PX) {
+            swipe = Gesture::SWIPE_LEFT;
+        }
+    }
+
+    if (swipe != Gesture::NONE) {
+        claimed = true;
+        phase = Phase::DONE;
+        emit(swipe);
+    }
+}
+
+void GestureEngine::updateTwo(const TouchPoint* points, unsigned long now) {
+    int16_t cx = (points[0].x + points[1].x) / 2;
+    int16_t cy = (points[0].y + points[1].y) / 2;
+    if (abs(cx - startCenter.x) > TAP_SLOP_PX || abs(cy - startCenter.y) > TAP_SLOP_PX) {
+        moved = true;
+    }
+
+    // (span / start)^2 against the thresholds, in sixteenths
+    if (startSpanSq > 0) {
+        int64_t span16 = (int64_t)spanSq(points) * 16;
+        if (span16 >= (int64_t)startSpanSq * PINCH_OUT_Q4) {
+            phase = Phase::DONE;
+            emit(Gesture::PINCH_OUT);
+        } else if (span16 <= (int64_t)startSpanSq * PINCH_IN_Q4) {
+            phase = Phase::DONE;
+            emit(Gesture::PINCH_IN);
+        }
+    }
+}
+
+void GestureEngine::release(unsigned long now) {
+    if (phase == Phase::TWO && !moved && now - startedAt <= TWO_FINGER_TAP_MS) {
+        emit(Gesture::TWO_FINGER_TAP);
+    }
+    phase = Phase::IDLE;
+    claimed = false;
+}
+
+int32_t GestureEngine::spanSq(const TouchPoint* points) {
+    int32_t dx = points[1].x - points[0].x;
+    int32_t dy = points[1].y - points[0].y;
+    return dx * dx + dy * dy;
+}
+
+// ============================================================================
+// Queue
+// ============================================================================
+
+void GestureEngine::emit(Gesture gesture) {
+    portENTER_CRITICAL(&mux);
+    recognized++;
+    if (count == QUEUE_SIZE) {
+        // Keep the newest; an old swipe isn't worth acting on late
+        head = (head + 1) % QUEUE_SIZE;
+        count--;
+    }
+    queue[(head + count) % QUEUE_SIZE] = gesture;
+    count++;
+    portEXIT_CRITICAL(&mux);
+}
+
+bool GestureEngine::pop(Gesture& gesture) {
+    bool popped = false;
+
+    portENTER_CRITICAL(&mux);
+    if (count > 0) {
+        gesture = queue[head];
+        head = (head + 1) % QUEUE_SIZE;
+        count--;
+        popped = true;
+    }
+    portEXIT_CRITICAL(&mux);
+
+    return popped;
+}
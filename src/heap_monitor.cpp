@@ -0,0 +1,240 @@
+#include "heap_monitor.h"
+#include "lvgl_mem.h"
+#include "lvgl_task.h"
+#include "event_scheduler.h"
+#include "crash_report.h"
+#include "json_alloc.h"
+#include "static_memory.h"
+#include <lvgl.h>
+#include <esp_heap_caps.h>
+
+// Global instance
+HeapMonitor heapMonitor;
+
+static const char* const TAG_NAMES[HEAP_TAG_COUNT] = {
+    "config",
+    "web",
+    "http_worker",
+    "ui_rebuild"
+};
+
+HeapMonitor::HeapMonitor()
+    : history(nullptr)
+    , head(0)
+    , count(0)
+    , activeTags(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , sampleJob(-1)
+{
+    memset(&latest, 0, sizeof(latest));
+    memset(tagStats, 0, sizeof(tagStats));
+}
+
+void HeapMonitor::begin() {
+    size_t bytes = HISTORY_SIZE * sizeof(HeapSample);
+    history = (HeapSample*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!history) {
+        history = (HeapSample*)malloc(bytes);
+    }
+    if (!history) {
+        Serial.println("HeapMonitor: Failed to allocate history, keeping latest sample only");
+    }
+
+    takeSample();
+    sampleJob = eventScheduler.add("heap_sample", onSampleTimer, this);
+    eventScheduler.schedule(sampleJob, SAMPLE_INTERVAL_MS);
+    Serial.printf("HeapMonitor: Internal %u free (largest %u), PSRAM %u free (largest %u)\n",
+                  latest.internalFree, latest.internalLargest, latest.psramFree, latest.psramLargest);
+}
+
+void HeapMonitor::onSampleTimer(void* arg) {
+    HeapMonitor* self = (HeapMonitor*)arg;
+    eventScheduler.schedule(self->sampleJob, SAMPLE_INTERVAL_MS);
+    self->takeSample();
+}
+
+const char* HeapMonitor::tagName(HeapTag tag) {
+    return tag < HEAP_TAG_COUNT ? TAG_NAMES[tag] : "unknown";
+}
+
+// ============================================================================
+// Sampling
+// ============================================================================
+
+void HeapMonitor::takeSample() {
+    HeapSample sample = {};
+    sample.uptimeS = millis() / 1000;
+
+    // heap_caps_get_info() walks the heap under its lock; fine every 30 s
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, MALLOC_CAP_INTERNAL);
+    sample.internalFree = info.total_free_bytes;
+    sample.internalLargest = info.largest_free_block;
+    sample.internalMin = info.minimum_free_bytes;
+
+    heap_caps_get_info(&info, MALLOC_CAP_SPIRAM);
+    sample.psramFree = info.total_free_bytes;
+    sample.psramLargest = info.largest_free_block;
+    sample.psramMin = info.minimum_free_bytes;
+
+#if LVGL_MEM_BUILTIN
+    {
+        // LVGL's own pool is not thread safe
+        LVGLLock lock;
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        sample.lvglUsed = mon.total_size - mon.free_size;
+        sample.lvglLargest = mon.free_biggest_size;
+        sample.lvglFragPct = mon.frag_pct;
+    }
+#else
+    // Custom allocator: fragmentation is what matters in the PSRAM arena
+    lvgl_mem_stats_t mem;
+    lvgl_mem_get_stats(&mem);
+    sample.lvglUsed = mem.internalUsed + mem.psramUsed;
+    sample.lvglLargest = mem.psramLargestFree;
+    size_t arenaFree = mem.psramArenaSize - mem.psramUsed;
+    sample.lvglFragPct = arenaFree > 0 ? 100 - (uint64_t)mem.psramLargestFree * 100 / arenaFree : 0;
+#endif
+
+    portENTER_CRITICAL(&mux);
+    sample.tags = activeTags;
+    activeTags = 0;
+    latest = sample;
+    if (history) {
+        history[head] = sample;
+        head = (head + 1) % HISTORY_SIZE;
+        if (count < HISTORY_SIZE) {
+            count++;
+        }
+    }
+    portEXIT_CRITICAL(&mux);
+
+    // Survives a crash, for the next boot's report
+    crashReport.noteHeap(sample);
+}
+
+// ============================================================================
+// Tags
+// ============================================================================
+
+void HeapMonitor::beginTag(HeapTag tag) {
+    portENTER_CRITICAL(&mux);
+    activeTags |= 1 << tag;
+    portEXIT_CRITICAL(&mux);
+}
+
+void HeapMonitor::endTag(HeapTag tag, int32_t internalDelta, int32_t psramDelta) {
+    portENTER_CRITICAL(&mux);
+    HeapTagStats& stats = tagStats[tag];
+    stats.ops++;
+    stats.internalNet += internalDelta;
+    stats.psramNet += psramDelta;
+    stats.lastInternal = internalDelta;
+    stats.lastPsram = psramDelta;
+    portEXIT_CRITICAL(&mux);
+}
+
+HeapTagStats HeapMonitor::getTagStats(HeapTag tag) const {
+    portENTER_CRITICAL(&mux);
+    HeapTagStats stats = tagStats[tag];
+    portEXIT_CRITICAL(&mux);
+    return stats;
+}
+
+HeapTagScope::HeapTagScope(HeapTag tag)
+    : tag(tag)
+    , internalStart(heap_caps_get_free_size(MALLOC_CAP_INTERNAL))
+    , psramStart(heap_caps_get_free_size(MALLOC_CAP_SPIRAM))
+{
+    heapMonitor.beginTag(tag);
+}
+
+HeapTagScope::~HeapTagScope() {
+    // Positive: the operation left that much less free heap behind
+    int32_t internalDelta = (int32_t)(internalStart - heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    int32_t psramDelta = (int32_t)(psramStart - heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    heapMonitor.endTag(tag, internalDelta, psramDelta);
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+static void printSampleRow(Print& out, const HeapSample& s) {
+    out.printf("[%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u]",
+               s.uptimeS, s.internalFree, s.internalLargest, s.internalMin,
+               s.psramFree, s.psramLargest, s.psramMin,
+               s.lvglUsed, s.lvglLargest, s.lvglFragPct, s.tags);
+}
+
+void HeapMonitor::writeJson(Print& out) const {
+    portENTER_CRITICAL(&mux);
+    HeapSample current = latest;
+    HeapTagStats stats[HEAP_TAG_COUNT];
+    memcpy(stats, tagStats, sizeof(stats));
+    uint16_t n = count;
+    uint16_t start = (head + HISTORY_SIZE - count) % HISTORY_SIZE;
+    portEXIT_CRITICAL(&mux);
+
+    out.printf("{\"uptime_s\":%lu,\"interval_ms\":%lu,", millis() / 1000, SAMPLE_INTERVAL_MS);
+
+    out.print("\"tag_bits\":{");
+    for (int i = 0; i < HEAP_TAG_COUNT; i++) {
+        out.printf("%s\"%s\":%d", i ? "," : "", TAG_NAMES[i], 1 << i);
+    }
+    out.print("},\"tags\":{");
+    for (int i = 0; i < HEAP_TAG_COUNT; i++) {
+        const HeapTagStats& t = stats[i];
+        out.printf("%s\"%s\":{\"ops\":%u,\"internal_net\":%d,\"psram_net\":%d,"
+                   "\"last_internal\":%d,\"last_psram\":%d}",
+                   i ? "," : "", TAG_NAMES[i], t.ops, t.internalNet, t.psramNet,
+                   t.lastInternal, t.lastPsram);
+    }
+
+    out.print("},\"json\":");
+    writeJsonAllocStats(out);
+    out.print(",\"static\":");
+    staticMemory.writeJson(out);
+
+    out.print(",\"fields\":[\"uptime_s\",\"internal_free\",\"internal_largest\",\"internal_min\","
+              "\"psram_free\",\"psram_largest\",\"psram_min\","
+              "\"lvgl_used\",\"lvgl_largest\",\"lvgl_frag_pct\",\"tags\"],\"latest\":");
+    printSampleRow(out, current);
+
+    out.print(",\"samples\":[");
+    for (uint16_t i = 0; i < n; i++) {
+        if (i) {
+            out.print(",");
+        }
+        // Row by row, so a sample landing meanwhile can't tear one
+        portENTER_CRITICAL(&mux);
+        HeapSample row = history[(start + i) % HISTORY_SIZE];
+        portEXIT_CRITICAL(&mux);
+        printSampleRow(out, row);
+    }
+    out.print("]}");
+}
+
+size_t HeapMonitor::writeHeartbeat(char* buf, size_t len) const {
+    portENTER_CRITICAL(&mux);
+    HeapSample s = latest;
+    HeapTagStats stats[HEAP_TAG_COUNT];
+    memcpy(stats, tagStats, sizeof(stats));
+    portEXIT_CRITICAL(&mux);
+
+    int n = snprintf(buf, len,
+        "{\"uptime_s\":%u,\"internal_free\":%u,\"internal_largest\":%u,\"internal_min\":%u,"
+        "\"psram_free\":%u,\"psram_largest\":%u,\"psram_min\":%u,"
+        "\"lvgl_used\":%u,\"lvgl_largest\":%u,\"lvgl_frag_pct\":%u,\"ops\":{",
+        s.uptimeS, s.internalFree, s.internalLargest, s.internalMin,
+        s.psramFree, s.psramLargest, s.psramMin,
+        s.lvglUsed, s.lvglLargest, s.lvglFragPct);
+    for (int i = 0; i < HEAP_TAG_COUNT && n > 0 && (size_t)n < len; i++) {
+        n += snprintf(buf + n, len - n, "%s\"%s\":%u", i ? "," : "", TAG_NAMES[i], stats[i].ops);
+    }
+    if (n > 0 && (size_t)n < len) {
+        n += snprintf(buf + n, len - n, "}}");
+    }
+    return (n > 0 && (size_t)n < len) ? n : 0;
+}
@@ -0,0 +1,414 @@
+#include "http_pool.h"
+#include <HTTPClient.h>
+#include <WiFi.h>
+#include <esp_heap_caps.h>
+
+// Global instance
+HttpConnectionPool httpPool;
+
+HttpConnectionPool::HttpConnectionPool()
+    : mutex(nullptr)
+    , caCert(nullptr)
+    , retiredCaCert(nullptr)
+    , resolveMux(portMUX_INITIALIZER_UNLOCKED)
+{
+    for (int i = 0; i < POOL_SIZE; i++) {
+        slots[i].secure = false;
+        slots[i].host[0] = '\0';
+        slots[i].port = 0;
+        slots[i].busy = false;
+        slots[i].lastUsed = 0;
+    }
+    for (int i = 0; i < RESOLVE_SLOTS; i++) {
+        resolved[i].host[0] = '\0';
+        resolved[i].resolvedAt = 0;
+    }
+}
+
+void HttpConnectionPool::begin() {
+    if (mutex == nullptr) {
+        mutex = xSemaphoreCreateMutex();
+    }
+}
+
+int HttpConnectionPool::post(const char* url, const char* payload, uint16_t timeoutMs, String* response) {
+    return request("POST", url, payload, nullptr, timeoutMs, Body{response, nullptr, 0});
+}
+
+int HttpConnectionPool::post(const char* url, const char* payload, uint16_t timeoutMs, char* buf, size_t len) {
+    if (buf != nullptr && len > 0) {
+        buf[0] = '\0';
+    }
+    return request("POST", url, payload, nullptr, timeoutMs, Body{nullptr, buf, len});
+}
+
+int HttpConnectionPool::get(const char* url, uint16_t timeoutMs, String* response) {
+    return request("GET", url, nullptr, nullptr, timeoutMs, Body{response, nullptr, 0});
+}
+
+int HttpConnectionPool::put(const char* url, const char* payload, const char* authorization, uint16_t timeoutMs) {
+    return request("PUT", url, payload, authorization, timeoutMs, Body{nullptr, nullptr, 0});
+}
+
+void HttpConnectionPool::closeAll() {
+    portENTER_CRITICAL(&resolveMux);
+    for (int i = 0; i < RESOLVE_SLOTS; i++) {
+        resolved[i].host[0] = '\0';
+    }
+    portEXIT_CRITICAL(&resolveMux);
+
+    if (mutex == nullptr) return;
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    for (int i = 0; i < POOL_SIZE; i++) {
+        if (!slots[i].busy) {
+            slots[i].conn().stop();
+            slots[i].host[0] = '\0';
+        }
+    }
+    xSemaphoreGive(mutex);
+}
+
+void HttpConnectionPool::setCACert(const char* pem) {
+    char* copy = nullptr;
+    if (pem != nullptr && *pem) {
+        size_t len = strlen(pem) + 1;
+        copy = (char*)heap_caps_malloc(len, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (copy == nullptr) {
+            copy = (char*)malloc(len);
+        }
+        if (copy == nullptr) {
+            return;
+        }
+        memcpy(copy, pem, len);
+    }
+
+    if (mutex != nullptr) {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+    }
+    free(retiredCaCert);
+    retiredCaCert = caCert;
+    caCert = copy;
+    // Connections verified against the old CA (or none) aren't kept
+    for (int i = 0; i < POOL_SIZE; i++) {
+        if (!slots[i].busy && slots[i].secure) {
+            slots[i].tls.stop();
+            slots[i].host[0] = '\0';
+        }
+    }
+    if (mutex != nullptr) {
+        xSemaphoreGive(mutex);
+    }
+}
+
+// ============================================================================
+// Request handling
+// ============================================================================
+
+int HttpConnectionPool::request(const char* method, const char* url, const char* payload,
+                                const char* authorization, uint16_t timeoutMs, const Body& body) {
+    char host[sizeof(slots[0].host)];
+    uint16_t port;
+
+    bool secure = false;
+    bool reused = false;
+    Slot* slot = nullptr;
+    bool parsed = parseHostPort(url, host, sizeof(host), port, secure);
+    if (mutex != nullptr && parsed) {
+        slot = acquire(host, port, secure, reused);
+    }
+
+    if (slot == nullptr) {
+        // Not poolable (oversized host) or all slots busy: one-shot connection
+        if (secure) {
+            WiFiClientSecure tls;
+            configureTls(tls, timeoutMs);
+            connectResolved(tls, true, host, port, timeoutMs);
+            int httpCode = requestOnce(tls, false, method, url, payload, authorization, timeoutMs, body);
+            if (httpCode < 0) {
+                forget(host);
+            }
+            return httpCode;
+        }
+        WiFiClient client;
+        if (parsed) {
+            connectResolved(client, false, host, port, timeoutMs);
+        }
+        int httpCode = requestOnce(client, false, method, url, payload, authorization, timeoutMs, body);
+        if (parsed && httpCode < 0) {
+            forget(host);
+        }
+        return httpCode;
+    }
+
+    WiFiClient& conn = slot->conn();
+    if (!reused) {
+        if (secure) {
+            configureTls(slot->tls, timeoutMs);
+        }
+        connectResolved(conn, secure, host, port, timeoutMs);
+    }
+    int httpCode = requestOnce(conn, true, method, url, payload, authorization, timeoutMs, body);
+
+    // The server may have closed a kept-alive socket without us noticing;
+    // retry once on a fresh connection. Webhooks carry absolute state, so a
+    // duplicate delivery is harmless.
+    if (reused && (httpCode == HTTPC_ERROR_SEND_HEADER_FAILED ||
+                   httpCode == HTTPC_ERROR_SEND_PAYLOAD_FAILED ||
+                   httpCode == HTTPC_ERROR_CONNECTION_LOST ||
+                   httpCode == HTTPC_ERROR_NOT_CONNECTED)) {
+        conn.stop();
+        if (secure) {
+            configureTls(slot->tls, timeoutMs);
+        }
+        connectResolved(conn, secure, host, port, timeoutMs);
+        httpCode = requestOnce(conn, true, method, url, payload, authorization, timeoutMs, body);
+    }
+
+    if (httpCode < 0) {
+        conn.stop();
+        forget(host);
+    }
+    release(slot);
+    return httpCode;
+}
+
+int HttpConnectionPool::requestOnce(WiFiClient& client, bool reuse, const char* method,
+                                    const char* url, const char* payload, const char* authorization,
+                                    uint16_t timeoutMs, const Body& body) {
+    HTTPClient http;
+    http.setReuse(reuse);
+    if (!http.begin(client, url)) {
+        return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+    http.setTimeout(timeoutMs);
+    http.setConnectTimeout(timeoutMs);
+    if (authorization != nullptr && *authorization) {
+        http.addHeader("Authorization", authorization);
+    }
+
+    int httpCode;
+    if (payload != nullptr) {
+        http.addHeader("Content-Type", "application/json");
+        httpCode = http.sendRequest(method, (uint8_t*)payload, strlen(payload));
+    } else {
+        httpCode = http.sendRequest(method);
+    }
+
+    // Body must be drained for the socket to be reusable; end() discards it
+    if (httpCode > 0) {
+        readBody(http, body);
+    }
+
+    // With reuse enabled end() keeps the socket open unless the server
+    // answered "Connection: close"
+    http.end();
+    return httpCode;
+}
+
+void HttpConnectionPool::readBody(HTTPClient& http, const Body& body) {
+    if (body.str != nullptr) {
+        *body.str = http.getString();
+        return;
+    }
+    if (body.buf == nullptr || body.len == 0) {
+        return;
+    }
+
+    // Straight off the socket when the length is known; whatever doesn't
+    // fit is left for end() to discard
+    size_t got = 0;
+    int size = http.getSize();
+    WiFiClient* stream = http.getStreamPtr();
+    if (size >= 0 && stream != nullptr) {
+        size_t want = (size_t)size < body.len - 1 ? (size_t)size : body.len - 1;
+        got = stream->readBytes(body.buf, want);
+    } else {
+        String chunked = http.getString();
+        got = chunked.length() < body.len - 1 ? chunked.length() : body.len - 1;
+        memcpy(body.buf, chunked.c_str(), got);
+    }
+    body.buf[got] = '\0';
+}
+
+// ============================================================================
+// Slot management
+// ============================================================================
+
+HttpConnectionPool::Slot* HttpConnectionPool::acquire(const char* host, uint16_t port, bool secure,
+                                                     bool& reused) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+
+    unsigned long now = millis();
+    Slot* match = nullptr;
+    Slot* oldest = nullptr;
+
+    for (int i = 0; i < POOL_SIZE; i++) {
+        Slot& s = slots[i];
+        if (s.busy) continue;
+
+        // Drop sockets the server has likely timed out by now
+        if (s.host[0] != '\0' && now - s.lastUsed > IDLE_TIMEOUT) {
+            s.conn().stop();
+        }
+
+        bool connected = s.conn().connected();
+        if (s.port == port && s.secure == secure && strcmp(s.host, host) == 0 && connected) {
+            match = &s;
+            break;
+        }
+        // Otherwise prefer a closed slot, then the least recently used one
+        if (!connected) {
+            if (oldest == nullptr || oldest->conn().connected()) oldest = &s;
+        } else if (oldest == nullptr ||
+                   (oldest->conn().connected() && s.lastUsed < oldest->lastUsed)) {
+            oldest = &s;
+        }
+    }
+
+    Slot* slot = match ? match : oldest;
+    if (slot != nullptr) {
+        if (match == nullptr) {
+            // Different host (or dead socket): HTTPClient would otherwise
+            // write to whatever the client is still connected to
+            slot->conn().stop();
+            slot->secure = secure;
+            strncpy(slot->host, host, sizeof(slot->host) - 1);
+            slot->host[sizeof(slot->host) - 1] = '\0';
+            slot->port = port;
+        }
+        slot->busy = true;
+    }
+    reused = (match != nullptr);
+
+    xSemaphoreGive(mutex);
+    return slot;
+}
+
+void HttpConnectionPool::release(Slot* slot) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    slot->lastUsed = millis();
+    slot->busy = false;
+    xSemaphoreGive(mutex);
+}
+
+bool HttpConnectionPool::parseHostPort(const char* url, char* host, size_t hostLen, uint16_t& port,
+                                       bool& secure) {
+    static const char prefix[] = "http://";
+    static const char securePrefix[] = "https://";
+    const char* start;
+    if (strncasecmp(url, prefix, sizeof(prefix) - 1) == 0) {
+        start = url + sizeof(prefix) - 1;
+        secure = false;
+    } else if (strncasecmp(url, securePrefix, sizeof(securePrefix) - 1) == 0) {
+        start = url + sizeof(securePrefix) - 1;
+        secure = true;
+    } else {
+        return false;
+    }
+
+    const char* end = start;
+    while (*end && *end != ':' && *end != '/' && *end != '?') end++;
+
+    size_t len = end - start;
+    if (len == 0 || len >= hostLen) {
+        return false;
+    }
+    memcpy(host, start, len);
+    host[len] = '\0';
+
+    port = secure ? 443 : 80;
+    if (*end == ':') {
+        port = (uint16_t)atoi(end + 1);
+        if (port == 0) return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Resolved addresses
+// ============================================================================
+
+void HttpConnectionPool::configureTls(WiFiClientSecure& tls, uint16_t timeoutMs) {
+    const char* ca = caCert;
+    if (ca != nullptr) {
+        tls.setCACert(ca);
+    } else {
+        tls.setInsecure();
+    }
+    tls.setHandshakeTimeout((timeoutMs + 999) / 1000);
+}
+
+void HttpConnectionPool::connectResolved(WiFiClient& client, bool secure, const char* host, uint16_t port,
+                                         uint16_t timeoutMs) {
+    IPAddress ip;
+    if (ip.fromString(host)) {
+        return;     // A literal address: HTTPClient connects without a lookup
+    }
+    if (!resolve(host, ip)) {
+        return;
+    }
+    // HTTPClient finds the socket connected and sends on it; the Host
+    // header still carries the name from the URL, and TLS verifies (and
+    // sends SNI for) the name, not the address
+    bool connected;
+    if (secure) {
+        WiFiClientSecure& tls = static_cast<WiFiClientSecure&>(client);
+        connected = tls.connect(ip, port, host, caCert, nullptr, nullptr);
+    } else {
+        connected = client.connect(ip, port, timeoutMs);
+    }
+    if (!connected) {
+        forget(host);
+    }
+}
+
+bool HttpConnectionPool::resolve(const char* host, IPAddress& ip) {
+    unsigned long now = millis();
+    int victim = 0;
+
+    portENTER_CRITICAL(&resolveMux);
+    for (int i = 0; i < RESOLVE_SLOTS; i++) {
+        Resolved& r = resolved[i];
+        if (r.host[0] != '\0' && strcmp(r.host, host) == 0 && now - r.resolvedAt < RESOLVE_TTL_MS) {
+            ip = r.ip;
+            portEXIT_CRITICAL(&resolveMux);
+            return true;
+        }
+    }
+    portEXIT_CRITICAL(&resolveMux);
+
+    // Blocks for the lookup, outside the lock
+    if (!WiFi.hostByName(host, ip)) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&resolveMux);
+    // The same host's entry, else an empty one, else the oldest
+    for (int i = 0; i < RESOLVE_SLOTS; i++) {
+        Resolved& r = resolved[i];
+        if (strcmp(r.host, host) == 0 || r.host[0] == '\0') {
+            victim = i;
+            break;
+        }
+        if (r.resolvedAt < resolved[victim].resolvedAt) {
+            victim = i;
+        }
+    }
+    Resolved& r = resolved[victim];
+    strlcpy(r.host, host, sizeof(r.host));
+    r.ip = ip;
+    r.resolvedAt = now;
+    portEXIT_CRITICAL(&resolveMux);
+    return true;
+}
+
+void HttpConnectionPool::forget(const char* host) {
+    portENTER_CRITICAL(&resolveMux);
+    for (int i = 0; i < RESOLVE_SLOTS; i++) {
+        if (strcmp(resolved[i].host, host) == 0) {
+            resolved[i].host[0] = '\0';
+        }
+    }
+    portEXIT_CRITICAL(&resolveMux);
+}
@@ -0,0 +1,379 @@
+#include "icon_pack.h"
+#include "config_manager.h"
+#include "ui_manager.h"
+#include "psram_budget.h"
+#include <esp_heap_caps.h>
+#include <esp_rom_crc.h>
+
+// Global instance
+IconPack iconPack;
+
+static const char* const PARTITION_LABEL = "icons";
+static const size_t FLASH_SECTOR_SIZE = 4096;
+static const size_t MMAP_PAGE_SIZE = 64 * 1024;     // Banks start on an MMU page
+
+static size_t pixelBytes(const IconPackEntry& e) {
+    static const uint8_t BYTES_PER_PIXEL[] = { 1, 2, 3 };
+    return (size_t)e.width * e.height * BYTES_PER_PIXEL[e.format];
+}
+
+static bool validName(const char* name, size_t max) {
+    size_t len = strnlen(name, max);
+    if (len == 0 || len == max) return false;
+    // What config icon names are made of, and nothing a JSON string would need escaped
+    for (size_t i = 0; i < len; i++) {
+        char c = name[i];
+        if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '-')) return false;
+    }
+    return true;
+}
+
+IconPack::IconPack()
+    : partition(nullptr)
+    , bankSize(0)
+    , activeBank(-1)
+    , retiredBank(-1)
+    , retireAfter(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , state(State::IDLE)
+    , error(nullptr)
+    , staging(nullptr)
+    , size(0)
+    , received(0)
+    , startedAt(0)
+    , installMs(0)
+{
+    memset(banks, 0, sizeof(banks));
+}
+
+void IconPack::begin() {
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, PARTITION_LABEL);
+    if (!partition) {
+        Serial.println("IconPack: No icons partition, built-in icons only");
+        return;
+    }
+    bankSize = (partition->size / 2) & ~(MMAP_PAGE_SIZE - 1);
+
+    // The newer of two valid banks; the other is left for the next upload
+    bool mapped[2] = { mapBank(0), mapBank(1) };
+    if (mapped[0] && mapped[1]) {
+        int older = (int32_t)(banks[0].sequence - banks[1].sequence) < 0 ? 0 : 1;
+        unmapBank(older);
+        mapped[older] = false;
+    }
+    activeBank = mapped[0] ? 0 : (mapped[1] ? 1 : -1);
+
+    if (activeBank >= 0) {
+        Serial.printf("IconPack: %u icons in bank %d (pack %u)\n",
+                      banks[activeBank].count, activeBank, banks[activeBank].sequence);
+    }
+    configManager.setIconLookup(&IconPack::lookup);
+}
+
+// ============================================================================
+// Banks
+// ============================================================================
+
+const char* IconPack::validate(const uint8_t* pack, size_t len) {
+    IconPackHeader h;
+    if (len < sizeof(h)) return "pack is shorter than its header";
+    memcpy(&h, pack, sizeof(h));
+    if (h.magic != ICON_PACK_MAGIC) return "not an icon pack";
+    if (h.version != ICON_PACK_VERSION) return "unsupported icon pack version";
+    if (h.size != len - sizeof(h)) return "pack size does not match its header";
+    if (h.count > MAX_ICONS) return "too many icons";
+
+    size_t indexEnd = sizeof(h) + (size_t)h.count * sizeof(IconPackEntry);
+    if (indexEnd > len) return "index runs past the end of the pack";
+    if (esp_rom_crc32_le(0, pack + sizeof(h), h.size) != h.crc) return "CRC mismatch";
+
+    const IconPackEntry* entries = (const IconPackEntry*)(pack + sizeof(h));
+    for (uint16_t i = 0; i < h.count; i++) {
+        const IconPackEntry& e = entries[i];
+        if (!validName(e.name, sizeof(e.name))) return "bad icon name";
+        if (i > 0 && strcmp(entries[i - 1].name, e.name) >= 0) return "icon names not sorted or repeated";
+        if (e.format > ICON_PACK_RGB565A8) return "unknown image format";
+        if (e.width == 0 || e.height == 0 || e.width > MAX_ICON_SIZE || e.height > MAX_ICON_SIZE) {
+            return "bad icon size";
+        }
+        if ((e.offset & 3) || e.offset < indexEnd || e.offset > len || pixelBytes(e) > len - e.offset) {
+            return "image data out of bounds";
+        }
+    }
+    return nullptr;
+}
+
+bool IconPack::mapBank(int bank) {
+    size_t offset = bank * bankSize;
+    IconPackHeader h;
+    if (esp_partition_read(partition, offset, &h, sizeof(h)) != ESP_OK) return false;
+    if (h.magic != ICON_PACK_MAGIC || h.size > bankSize - sizeof(h)) return false;
+
+    const void* ptr = nullptr;
+    spi_flash_mmap_handle_t handle;
+    if (esp_partition_mmap(partition, offset, sizeof(h) + h.size, SPI_FLASH_MMAP_DATA, &ptr, &handle) != ESP_OK) {
+        Serial.printf("IconPack: Could not map bank %d\n", bank);
+        return false;
+    }
+    const uint8_t* base = (const uint8_t*)ptr;
+
+    const char* reason = validate(base, sizeof(h) + h.size);
+    if (reason) {
+        Serial.printf("IconPack: Bank %d unusable, %s\n", bank, reason);
+        spi_flash_munmap(handle);
+        return false;
+    }
+
+    // The only RAM a pack costs: the pixels stay in flash
+    lv_img_dsc_t* images = nullptr;
+    if (h.count > 0) {
+        images = (lv_img_dsc_t*)heap_caps_calloc(h.count, sizeof(lv_img_dsc_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!images) {
+            spi_flash_munmap(handle);
+            return false;
+        }
+    }
+    const IconPackEntry* entries = (const IconPackEntry*)(base + sizeof(h));
+    for (uint16_t i = 0; i < h.count; i++) {
+        const IconPackEntry& e = entries[i];
+        images[i].header.cf = e.format == ICON_PACK_A8 ? LV_IMG_CF_ALPHA_8BIT
+                            : e.format == ICON_PACK_RGB565 ? LV_IMG_CF_TRUE_COLOR
+                            : LV_IMG_CF_TRUE_COLOR_ALPHA;
+        images[i].header.w = e.width;
+        images[i].header.h = e.height;
+        images[i].data_size = pixelBytes(e);
+        images[i].data = base + e.offset;
+    }
+
+    Bank& b = banks[bank];
+    b.handle = handle;
+    b.entries = entries;
+    b.images = images;
+    b.count = h.count;
+    b.size = sizeof(h) + h.size;
+    b.sequence = h.sequence;
+    b.base = base;      // Last: image() takes a mapped base as a usable bank
+    return true;
+}
+
+void IconPack::unmapBank(int bank) {
+    Bank& b = banks[bank];
+    if (!b.base) return;
+    b.base = nullptr;
+    spi_flash_munmap(b.handle);
+    heap_caps_free(b.images);
+    memset(&b, 0, sizeof(b));
+}
+
+// ============================================================================
+// Lookup
+// ============================================================================
+
+IconId IconPack::lookup(const char* name) {
+    int bank = iconPack.activeBank;
+    if (bank < 0) return IconId::COUNT;
+
+    const Bank& b = iconPack.banks[bank];
+    int lo = 0;
+    int hi = b.count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        int c = strcmp(name, b.entries[mid].name);
+        if (c == 0) return (IconId)(ICON_PACK_FIRST + bank * MAX_ICONS + mid);
+        if (c < 0) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return IconId::COUNT;
+}
+
+const lv_img_dsc_t* IconPack::image(IconId id) const {
+    uint8_t value = (uint8_t)id;
+    if (value < ICON_PACK_FIRST) return nullptr;
+
+    const Bank& b = banks[(value - ICON_PACK_FIRST) / MAX_ICONS];
+    uint16_t index = (value - ICON_PACK_FIRST) % MAX_ICONS;
+    if (!b.base || index >= b.count) return nullptr;
+    return &b.images[index];
+}
+
+// ============================================================================
+// Upload
+// ============================================================================
+
+bool IconPack::beginUpload(size_t uploadSize, const char*& reason) {
+    if (!partition) {
+        reason = "no icons partition";
+        return false;
+    }
+    if (isBusy()) {
+        reason = "icon pack upload already running";
+        return false;
+    }
+    if (retiredBank >= 0) {
+        reason = "the previous icon pack is still on screen";
+        return false;
+    }
+    if (uploadSize < sizeof(IconPackHeader) || uploadSize > bankSize) {
+        reason = "pack size does not fit the icons partition";
+        return false;
+    }
+
+    staging = (uint8_t*)psramBudget.alloc(PSRAM_ICON_PACK, uploadSize);
+    if (!staging) {
+        reason = "not enough PSRAM to stage the pack";
+        return false;
+    }
+
+    size = uploadSize;
+    received = 0;
+    error = nullptr;
+    installMs = 0;
+    startedAt = millis();
+    state = State::RECEIVING;
+    return true;
+}
+
+void IconPack::feed(const uint8_t* data, size_t len) {
+    portENTER_CRITICAL(&mux);
+    if (staging && state == State::RECEIVING) {
+        size_t at = received;
+        if (len > size - at) len = size - at;
+        memcpy(staging + at, data, len);
+        received = at + len;
+    }
+    portEXIT_CRITICAL(&mux);
+}
+
+void IconPack::abortUpload() {
+    if (state != State::RECEIVING) return;
+    fail("upload aborted");
+}
+
+void IconPack::freeStaging() {
+    portENTER_CRITICAL(&mux);
+    uint8_t* buffer = staging;
+    staging = nullptr;
+    portEXIT_CRITICAL(&mux);
+    psramBudget.release(PSRAM_ICON_PACK, buffer, size);
+}
+
+void IconPack::fail(const char* reason) {
+    freeStaging();
+    error = reason;
+    state = State::FAILED;
+    Serial.printf("IconPack: Upload failed, %s\n", reason);
+}
+
+// ============================================================================
+// Install
+// ============================================================================
+
+bool IconPack::install() {
+    if (!isStaged()) return false;
+    state = State::INSTALLING;
+    unsigned long start = millis();
+
+    const char* reason = validate(staging, size);
+    if (reason) {
+        fail(reason);
+        return false;
+    }
+
+    int spare = activeBank == 0 ? 1 : 0;
+    size_t offset = spare * bankSize;
+    size_t eraseSize = (size + FLASH_SECTOR_SIZE - 1) & ~(FLASH_SECTOR_SIZE - 1);
+
+    IconPackHeader header;
+    memcpy(&header, staging, sizeof(header));
+    header.sequence = (activeBank >= 0 ? banks[activeBank].sequence : 0) + 1;
+
+    // Header last: until it lands the spare bank holds no pack at all
+    size_t bodySize = size - sizeof(header);
+    if (esp_partition_erase_range(partition, offset, eraseSize) != ESP_OK ||
+        (bodySize > 0 && esp_partition_write(partition, offset + sizeof(header),
+                                             staging + sizeof(header), bodySize) != ESP_OK) ||
+        esp_partition_write(partition, offset, &header, sizeof(header)) != ESP_OK) {
+        fail("flash write failed");
+        return false;
+    }
+    freeStaging();
+
+    // Maps and checks what was written, CRC included
+    if (!mapBank(spare)) {
+        fail("written pack did not verify");
+        return false;
+    }
+
+    // Names resolve against the new pack from here; the old one stays
+    // drawable until the UI has rebuilt from the refreshed config
+    int previous = activeBank;
+    activeBank = spare;
+    configManager.refreshIcons();
+    if (previous >= 0) {
+        portENTER_CRITICAL(&mux);
+        retireAfter = configManager.getGeneration();
+        retiredBank = previous;
+        portEXIT_CRITICAL(&mux);
+    }
+    uiManager.requestRebuild();
+
+    installMs = millis() - start;
+    state = State::DONE;
+    Serial.printf("IconPack: %u icons installed in bank %d in %u ms\n",
+                  banks[spare].count, spare, installMs);
+    return true;
+}
+
+bool IconPack::releaseRetired(uint32_t generation) {
+    portENTER_CRITICAL(&mux);
+    int bank = retiredBank;
+    bool due = bank >= 0 && (int32_t)(generation - retireAfter) >= 0;
+    portEXIT_CRITICAL(&mux);
+    if (!due) return false;
+
+    // LVGL's image cache may still hold the old descriptors
+    lv_img_cache_invalidate_src(nullptr);
+    unmapBank(bank);
+    retiredBank = -1;
+    return true;
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+const char* IconPack::stateName() const {
+    switch (state) {
+        case State::IDLE:       return "idle";
+        case State::RECEIVING:  return "receiving";
+        case State::INSTALLING: return "installing";
+        case State::DONE:       return "done";
+        case State::FAILED:     return "failed";
+    }
+    return "unknown";
+}
+
+void IconPack::writeJson(Print& out) const {
+    out.printf("{\"state\":\"%s\",\"partition\":%s,\"bank_size\":%u,\"received\":%u,\"size\":%u,\"install_ms\":%u",
+               stateName(), partition ? "true" : "false", (unsigned)bankSize,
+               (unsigned)received, (unsigned)size, installMs);
+    if (error) {
+        out.printf(",\"error\":\"%s\"", error);
+    }
+
+    // Names are checked to need no escaping (see validName())
+    int bank = activeBank;
+    if (bank >= 0) {
+        const Bank& b = banks[bank];
+        out.printf(",\"pack\":{\"bank\":%d,\"sequence\":%u,\"bytes\":%u,\"icons\":[",
+                   bank, b.sequence, b.size);
+        for (uint16_t i = 0; i < b.count; i++) {
+            out.printf("%s\"%s\"", i ? "," : "", b.entries[i].name);
+        }
+        out.print("]}");
+    }
+    out.print("}");
+}
@@ -0,0 +1,137 @@
+#include "icon_tint_cache.h"
+#include "psram_budget.h"
+
+// Global instance
+IconTintCache iconTintCache;
+
+IconTintCache::IconTintCache()
+    : bytes(0)
+    , hits(0)
+    , misses(0)
+    , refused(0)
+{
+    memset(entries, 0, sizeof(entries));
+}
+
+IconTintCache::Entry* IconTintCache::find(const void* src) {
+    // Copies are the cache's own descriptors, so an address check tells them apart
+    Entry* entry = (Entry*)src;
+    if ((const uint8_t*)src < (const uint8_t*)entries ||
+        (const uint8_t*)src >= (const uint8_t*)(entries + MAX_ENTRIES) ||
+        ((const uint8_t*)src - (const uint8_t*)entries) % sizeof(Entry) != 0) {
+        return nullptr;
+    }
+    return entry->dsc.data ? entry : nullptr;
+}
+
+const IconTintCache::Entry* IconTintCache::find(const void* src) const {
+    return const_cast<IconTintCache*>(this)->find(src);
+}
+
+const lv_img_dsc_t* IconTintCache::acquire(const lv_img_dsc_t* base, lv_color_t color) {
+    if (!base || base->header.cf != LV_IMG_CF_ALPHA_8BIT) return nullptr;
+
+    Entry* slot = nullptr;
+    Entry* unused = nullptr;
+    for (int i = 0; i < MAX_ENTRIES; i++) {
+        Entry& e = entries[i];
+        if (!e.dsc.data) {
+            if (!slot) slot = &e;
+        } else if (e.base == base && e.color == color.full) {
+            e.refs++;
+            hits++;
+            return &e.dsc;
+        } else if (e.refs == 0 && !unused) {
+            unused = &e;
+        }
+    }
+    misses++;
+
+    size_t pixels = (size_t)base->header.w * base->header.h;
+    size_t size = pixels * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    while (unused && (!slot || bytes + size > MAX_BYTES)) {
+        drop(*unused);
+        if (!slot) slot = unused;
+        unused = nullptr;
+        for (int i = 0; i < MAX_ENTRIES && !unused; i++) {
+            if (entries[i].dsc.data && entries[i].refs == 0) unused = &entries[i];
+        }
+    }
+    if (!slot || bytes + size > MAX_BYTES) {
+        refused++;
+        return nullptr;
+    }
+
+    uint8_t* data = (uint8_t*)psramBudget.alloc(PSRAM_ICON_TINT, size);
+    if (!data) {
+        refused++;
+        return nullptr;
+    }
+
+    // The tint color with the icon's coverage as alpha, as LVGL lays out
+    // TRUE_COLOR_ALPHA at 16-bit depth: color low byte, high byte, alpha
+    const uint8_t* alpha = base->data;
+    uint8_t lo = color.full & 0xff;
+    uint8_t hi = color.full >> 8;
+    uint8_t* out = data;
+    for (size_t i = 0; i < pixels; i++) {
+        out[0] = lo;
+        out[1] = hi;
+        out[2] = alpha[i];
+        out += LV_IMG_PX_SIZE_ALPHA_BYTE;
+    }
+
+    slot->base = base;
+    slot->color = color.full;
+    slot->refs = 1;
+    slot->dsc.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    slot->dsc.header.always_zero = 0;
+    slot->dsc.header.reserved = 0;
+    slot->dsc.header.w = base->header.w;
+    slot->dsc.header.h = base->header.h;
+    slot->dsc.data_size = size;
+    slot->dsc.data = data;
+    bytes += size;
+    return &slot->dsc;
+}
+
+void IconTintCache::release(const void* src) {
+    Entry* entry = find(src);
+    if (entry && entry->refs > 0) {
+        entry->refs--;
+    }
+}
+
+const void* IconTintCache::baseOf(const void* src) const {
+    const Entry* entry = find(src);
+    return entry ? entry->base : src;
+}
+
+void IconTintCache::drop(Entry& entry) {
+    // LVGL's image cache knows descriptors by address, and the slot is reused
+    lv_img_cache_invalidate_src(&entry.dsc);
+    psramBudget.release(PSRAM_ICON_TINT, (void*)entry.dsc.data, entry.dsc.data_size);
+    bytes -= entry.dsc.data_size;
+    memset(&entry, 0, sizeof(entry));
+}
+
+void IconTintCache::trim() {
+    for (int i = 0; i < MAX_ENTRIES; i++) {
+        if (entries[i].dsc.data && entries[i].refs == 0) {
+            drop(entries[i]);
+        }
+    }
+}
+
+void IconTintCache::writeJson(Print& out) const {
+    int count = 0;
+    int inUse = 0;
+    for (int i = 0; i < MAX_ENTRIES; i++) {
+        if (entries[i].dsc.data) {
+            count++;
+            if (entries[i].refs) inUse++;
+        }
+    }
+    out.printf("{\"entries\":%d,\"in_use\":%d,\"bytes\":%u,\"hits\":%u,\"misses\":%u,\"refused\":%u}",
+               count, inUse, (unsigned)bytes, hits, misses, refused);
+}
@@ -0,0 +1,185 @@
+#include "img_cache_stats.h"
+#include "panel_log.h"
+
+// Global instance
+ImageCacheStats imageCacheStats;
+
+static const char* cfName(uint8_t cf) {
+    switch (cf) {
+        case LV_IMG_CF_TRUE_COLOR:              return "true_color";
+        case LV_IMG_CF_TRUE_COLOR_ALPHA:        return "true_color_alpha";
+        case LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED: return "chroma_keyed";
+        case LV_IMG_CF_ALPHA_8BIT:              return "a8";
+        case LV_IMG_CF_ALPHA_4BIT:              return "a4";
+        case LV_IMG_CF_ALPHA_2BIT:              return "a2";
+        case LV_IMG_CF_ALPHA_1BIT:              return "a1";
+        case LV_IMG_CF_INDEXED_8BIT:            return "indexed8";
+        case LV_IMG_CF_INDEXED_4BIT:            return "indexed4";
+        case LV_IMG_CF_INDEXED_2BIT:            return "indexed2";
+        case LV_IMG_CF_INDEXED_1BIT:            return "indexed1";
+        default:                                return "other";
+    }
+}
+
+ImageCacheStats::ImageCacheStats()
+    : drawNext(nullptr)
+    , cacheSize(0)
+    , draws(0)
+    , opens(0)
+    , lines(0)
+    , untracked(0)
+{
+    memset(sources, 0, sizeof(sources));
+}
+
+void ImageCacheStats::begin(lv_disp_t* disp) {
+    // Registered last, so tried first: the built-in decoder with a counting
+    // open and line read
+    lv_img_decoder_t* decoder = lv_img_decoder_create();
+    if (decoder) {
+        lv_img_decoder_set_info_cb(decoder, lv_img_decoder_built_in_info);
+        lv_img_decoder_set_open_cb(decoder, decoderOpen);
+        lv_img_decoder_set_read_line_cb(decoder, decoderReadLine);
+        lv_img_decoder_set_close_cb(decoder, lv_img_decoder_built_in_close);
+    }
+
+    lv_draw_ctx_t* ctx = disp ? disp->driver->draw_ctx : nullptr;
+    if (ctx && ctx->draw_img_decoded) {
+        drawNext = ctx->draw_img_decoded;
+        ctx->draw_img_decoded = drawImgDecoded;
+    }
+
+    setCacheSize(PANEL_IMG_CACHE_SIZE);
+    LOG_I("ImageCache: %u entries%s", cacheSize, decoder ? "" : " (no decoder stats)");
+}
+
+bool ImageCacheStats::setCacheSize(uint16_t entries) {
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    if (entries > 0) return false;      // Compiled out
+#endif
+    if (entries > MAX_CACHE_SIZE) return false;
+    lv_img_cache_set_size(entries);
+    cacheSize = entries;
+    return true;
+}
+
+void ImageCacheStats::reset() {
+    memset(sources, 0, sizeof(sources));
+    draws = 0;
+    opens = 0;
+    lines = 0;
+    untracked = 0;
+}
+
+// ============================================================================
+// Sources
+// ============================================================================
+
+ImageCacheStats::Source* ImageCacheStats::find(const void* src) {
+    for (Source& s : sources) {
+        if (s.src == src) return &s;
+    }
+    return nullptr;
+}
+
+ImageCacheStats::Source* ImageCacheStats::findData(const void* data) {
+    for (Source& s : sources) {
+        if (s.src && s.data == data) return &s;
+    }
+    return nullptr;
+}
+
+ImageCacheStats::Source* ImageCacheStats::add(const void* src) {
+    // A freed copy's address can come back as another image: slots are
+    // reused least recently drawn first, the totals stay exact
+    Source* slot = &sources[0];
+    for (Source& s : sources) {
+        if (!s.src) {
+            slot = &s;
+            break;
+        }
+        if (s.lastUse < slot->lastUse) slot = &s;
+    }
+    memset(slot, 0, sizeof(*slot));
+    slot->src = src;
+    slot->lastLine = -1;
+    return slot;
+}
+
+// ============================================================================
+// Hooks (LVGL task)
+// ============================================================================
+
+lv_res_t ImageCacheStats::decoderOpen(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    lv_res_t res = lv_img_decoder_built_in_open(decoder, dsc);
+
+    ImageCacheStats& self = imageCacheStats;
+    self.opens++;
+    Source* s = self.find(dsc->src);
+    if (!s) s = self.add(dsc->src);
+    s->opens++;
+    s->lastUse = self.draws;
+    s->lastLine = -1;
+    s->data = res == LV_RES_OK ? dsc->img_data : nullptr;
+    s->width = dsc->header.w;
+    s->height = dsc->header.h;
+    s->cf = dsc->header.cf;
+    return res;
+}
+
+lv_res_t ImageCacheStats::decoderReadLine(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+                                          lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf) {
+    ImageCacheStats& self = imageCacheStats;
+    self.lines++;
+    Source* s = self.find(dsc->src);
+    if (s) {
+        s->lines++;
+        // A draw decodes its rows top down; going back up is the next draw
+        if (s->lastLine < 0 || y <= s->lastLine) {
+            s->draws++;
+            self.draws++;
+        }
+        s->lastLine = y;
+        s->lastUse = self.draws;
+    }
+    return lv_img_decoder_built_in_read_line(decoder, dsc, x, y, len, buf);
+}
+
+void ImageCacheStats::drawImgDecoded(lv_draw_ctx_t* ctx, const lv_draw_img_dsc_t* dsc,
+                                     const lv_area_t* coords, const uint8_t* map, lv_img_cf_t cf) {
+    ImageCacheStats& self = imageCacheStats;
+    Source* s = self.findData(map);
+    if (s) {
+        s->draws++;
+        self.draws++;
+        s->lastUse = self.draws;
+    } else if (lv_area_get_height(coords) > 1) {
+        // One-row blits are lines decoded above
+        self.untracked++;
+    }
+    self.drawNext(ctx, dsc, coords, map, cf);
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+void ImageCacheStats::writeJson(Print& out) const {
+    uint32_t d = draws;
+    uint32_t o = opens;
+    uint32_t hits = d > o ? d - o : 0;
+    out.printf("{\"cache_size\":%u,\"max_cache_size\":%u,\"draws\":%u,\"hits\":%u,\"misses\":%u,"
+               "\"hit_rate\":%.3f,\"lines_decoded\":%u,\"untracked_blits\":%u,\"sources\":[",
+               cacheSize, MAX_CACHE_SIZE, d, hits, o, d ? (float)hits / d : 0.0f, lines, untracked);
+    bool first = true;
+    for (const Source& s : sources) {
+        if (!s.src) continue;
+        uint32_t sourceHits = s.draws > s.opens ? s.draws - s.opens : 0;
+        out.printf("%s{\"src\":\"%p\",\"w\":%u,\"h\":%u,\"cf\":\"%s\",\"draws\":%u,\"hits\":%u,"
+                   "\"misses\":%u,\"lines_decoded\":%u}",
+                   first ? "" : ",", s.src, s.width, s.height, cfName(s.cf), s.draws, sourceHits,
+                   s.opens, s.lines);
+        first = false;
+    }
+    out.print("]}");
+}
@@ -0,0 +1,102 @@
+#include "json_alloc.h"
+#include "static_memory.h"
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+
+// Ahead of each block; 8 bytes keep the pool 8-aligned
+struct JsonBlockHeader {
+    uint32_t size;
+    uint32_t internal;          // Fallback block, not PSRAM
+};
+
+static JsonAllocStats stats = {};
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+static void noteAlloc(size_t size, bool internal) {
+    portENTER_CRITICAL(&statsMux);
+    stats.current += size;
+    if (stats.current > stats.peak) stats.peak = stats.current;
+    stats.allocs++;
+    if (internal) stats.internalFallbacks++;
+    portEXIT_CRITICAL(&statsMux);
+}
+
+static void noteFree(size_t size) {
+    portENTER_CRITICAL(&statsMux);
+    stats.current -= size;
+    portEXIT_CRITICAL(&statsMux);
+}
+
+static void noteFailure() {
+    portENTER_CRITICAL(&statsMux);
+    stats.failures++;
+    portEXIT_CRITICAL(&statsMux);
+}
+
+void* PsramJsonAllocator::allocate(size_t size) {
+    size_t total = sizeof(JsonBlockHeader) + size;
+    bool internal = false;
+    JsonBlockHeader* h = nullptr;
+#if PANEL_STATIC_MEMORY
+    // A fixed slot when one fits (free() and realloc() know them); a larger
+    // pool still gets PSRAM, and shows as a pool overflow
+    StaticPool pool = total <= staticMemory.poolSlotSize(STATIC_POOL_JSON_SMALL)
+        ? STATIC_POOL_JSON_SMALL : STATIC_POOL_JSON_LARGE;
+    h = (JsonBlockHeader*)staticMemory.alloc(pool, total);
+#endif
+    if (!h) {
+        h = (JsonBlockHeader*)heap_caps_malloc(total, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (!h) {
+        h = (JsonBlockHeader*)malloc(total);
+        internal = true;
+    }
+    if (!h) {
+        noteFailure();
+        return nullptr;
+    }
+    h->size = size;
+    h->internal = internal;
+    noteAlloc(size, internal);
+    return h + 1;
+}
+
+void PsramJsonAllocator::deallocate(void* ptr) {
+    if (!ptr) return;
+    JsonBlockHeader* h = (JsonBlockHeader*)ptr - 1;
+    noteFree(h->size);
+    free(h);
+}
+
+void* PsramJsonAllocator::reallocate(void* ptr, size_t size) {
+    if (!ptr) return allocate(size);
+
+    // ArduinoJson only shrinks (shrinkToFit), so the block stays where it is
+    JsonBlockHeader* h = (JsonBlockHeader*)ptr - 1;
+    uint32_t caps = h->internal ? MALLOC_CAP_DEFAULT : (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    JsonBlockHeader* moved = (JsonBlockHeader*)heap_caps_realloc(h, sizeof(JsonBlockHeader) + size, caps);
+    if (!moved) {
+        noteFailure();
+        return nullptr;
+    }
+
+    portENTER_CRITICAL(&statsMux);
+    stats.current = stats.current - moved->size + size;
+    if (stats.current > stats.peak) stats.peak = stats.current;
+    portEXIT_CRITICAL(&statsMux);
+    moved->size = size;
+    return moved + 1;
+}
+
+JsonAllocStats getJsonAllocStats() {
+    portENTER_CRITICAL(&statsMux);
+    JsonAllocStats s = stats;
+    portEXIT_CRITICAL(&statsMux);
+    return s;
+}
+
+void writeJsonAllocStats(Print& out) {
+    JsonAllocStats s = getJsonAllocStats();
+    out.printf("{\"current\":%u,\"peak\":%u,\"allocs\":%u,\"internal_fallbacks\":%u,\"failures\":%u}",
+               s.current, s.peak, s.allocs, s.internalFallbacks, s.failures);
+}
@@ -0,0 +1,200 @@
+#include "latency_trace.h"
+#include "perf_monitor.h"
+#include <ArduinoJson.h>
+#include <esp_timer.h>
+
+// Global instance
+LatencyTrace latencyTrace;
+
+static const char* const STAGE_NAMES[LAT_STAGE_COUNT] = {
+    "touch_read",
+    "event_dispatch",
+    "style_update",
+    "flush_done",
+    "vsync",
+    "webhook_enqueue",
+    "http_response"
+};
+
+// Stage that has to be stamped before this one counts
+static const LatencyStage PREREQUISITE[LAT_STAGE_COUNT] = {
+    LAT_TOUCH_READ,
+    LAT_TOUCH_READ,
+    LAT_EVENT_DISPATCH,
+    LAT_STYLE_UPDATE,
+    LAT_FLUSH_DONE,
+    LAT_EVENT_DISPATCH,
+    LAT_WEBHOOK_ENQUEUE
+};
+
+// A click comes from the release read just before it, stamped with when the
+// touch task sampled it (a queued release can be a long frame old); anything
+// older means the event didn't start with a touch (e.g. sent programmatically)
+static const int64_t TOUCH_EDGE_MAX_AGE_US = 1000000;
+
+LatencyTrace::LatencyTrace()
+    : toAction(LATENCY_BOUNDS_US, LATENCY_BOUND_COUNT)
+    , toPhoton(LATENCY_BOUNDS_US, LATENCY_BOUND_COUNT)
+    , toResponse(LATENCY_BOUNDS_US, LATENCY_BOUND_COUNT)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , touchEdgeUs(0)
+    , touchPressed(false)
+    , vsyncStage(false)
+    , openId(0)
+    , nextId(1)
+    , traces(0)
+    , incomplete(0)
+{
+    memset(rings, 0, sizeof(rings));
+    memset(stamps, 0, sizeof(stamps));
+    memset(last, 0, sizeof(last));
+}
+
+const char* LatencyTrace::stageName(LatencyStage stage) {
+    return stage < LAT_STAGE_COUNT ? STAGE_NAMES[stage] : "unknown";
+}
+
+void LatencyTrace::noteTouch(bool pressed, int64_t atUs) {
+    if (pressed != touchPressed) {
+        touchPressed = pressed;
+        touchEdgeUs = atUs ? atUs : esp_timer_get_time();
+    }
+}
+
+void LatencyTrace::begin() {
+    int64_t now = esp_timer_get_time();
+    int64_t touch = (touchEdgeUs > 0 && now - touchEdgeUs < TOUCH_EDGE_MAX_AGE_US) ? touchEdgeUs : now;
+
+    portENTER_CRITICAL(&mux);
+    if (openId) {
+        closeLocked(false);
+    }
+    memset(stamps, 0, sizeof(stamps));
+    stamps[LAT_TOUCH_READ] = touch;
+    stamps[LAT_EVENT_DISPATCH] = now;
+    openId = nextId++;
+    if (nextId == 0) {
+        nextId = 1;
+    }
+    portEXIT_CRITICAL(&mux);
+}
+
+void LatencyTrace::mark(LatencyStage stage, uint16_t id) {
+    if (stage >= LAT_STAGE_COUNT || !openId) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+
+    // Called from the flush-done ISR as well as from tasks
+    portENTER_CRITICAL_SAFE(&mux);
+    if (openId && (id == 0 || id == openId) &&
+        stamps[stage] == 0 && stamps[PREREQUISITE[stage]] != 0) {
+        stamps[stage] = now;
+
+        LatencyStage photon = vsyncStage ? LAT_VSYNC : LAT_FLUSH_DONE;
+        if (stamps[photon] && stamps[LAT_HTTP_RESPONSE]) {
+            closeLocked(true);
+        }
+    }
+    portEXIT_CRITICAL_SAFE(&mux);
+}
+
+uint16_t LatencyTrace::openWith(LatencyStage stage) {
+    uint16_t id = 0;
+    portENTER_CRITICAL_SAFE(&mux);
+    if (openId && stage < LAT_STAGE_COUNT && stamps[stage] != 0) {
+        id = openId;
+    }
+    portEXIT_CRITICAL_SAFE(&mux);
+    return id;
+}
+
+void LatencyTrace::closeLocked(bool complete) {
+    for (int i = LAT_EVENT_DISPATCH; i < LAT_STAGE_COUNT; i++) {
+        if (stamps[i] == 0) {
+            last[i] = 0;
+            continue;
+        }
+        uint32_t offset = stamps[i] - stamps[LAT_TOUCH_READ];
+        Ring& ring = rings[i];
+        ring.samples[ring.head] = offset;
+        ring.head = (ring.head + 1) % RING_SIZE;
+        ring.count++;
+        last[i] = offset;
+    }
+
+    LatencyStage photon = vsyncStage ? LAT_VSYNC : LAT_FLUSH_DONE;
+    if (last[LAT_STYLE_UPDATE]) toAction.observe(last[LAT_STYLE_UPDATE]);
+    if (last[photon]) toPhoton.observe(last[photon]);
+    if (last[LAT_HTTP_RESPONSE]) toResponse.observe(last[LAT_HTTP_RESPONSE]);
+    traces++;
+    if (!complete) {
+        incomplete++;
+    }
+    openId = 0;
+}
+
+void LatencyTrace::expireLocked(int64_t now) {
+    if (openId && now - stamps[LAT_TOUCH_READ] > (int64_t)TRACE_TIMEOUT_US) {
+        closeLocked(false);
+    }
+}
+
+void LatencyTrace::reset() {
+    portENTER_CRITICAL(&mux);
+    memset(rings, 0, sizeof(rings));
+    memset(last, 0, sizeof(last));
+    traces = 0;
+    incomplete = 0;
+    openId = 0;
+    portEXIT_CRITICAL(&mux);
+}
+
+String LatencyTrace::toJson() {
+    StaticJsonDocument<1536> doc;
+
+    portENTER_CRITICAL(&mux);
+    expireLocked(esp_timer_get_time());
+    doc["traces"] = traces;
+    doc["incomplete"] = incomplete;
+    doc["open"] = openId != 0;
+    portEXIT_CRITICAL(&mux);
+
+    doc["photon_stage"] = STAGE_NAMES[vsyncStage ? LAT_VSYNC : LAT_FLUSH_DONE];
+    doc["ring_size"] = (uint32_t)RING_SIZE;
+
+    // Microseconds since touch_read, per stage
+    JsonObject stages = doc.createNestedObject("stages");
+    JsonObject lastTrace = doc.createNestedObject("last");
+    for (int i = LAT_EVENT_DISPATCH; i < LAT_STAGE_COUNT; i++) {
+        uint32_t samples[RING_SIZE];
+        portENTER_CRITICAL(&mux);
+        const Ring& ring = rings[i];
+        uint32_t count = ring.count;
+        uint32_t n = ring.count < RING_SIZE ? ring.count : RING_SIZE;
+        memcpy(samples, ring.samples, n * sizeof(uint32_t));
+        uint32_t lastOffset = last[i];
+        portEXIT_CRITICAL(&mux);
+
+        PerfSummary s = PerfMonitor::summarizeSamples(samples, n, count);
+        JsonObject m = stages.createNestedObject(STAGE_NAMES[i]);
+        m["count"] = s.count;
+        m["window"] = s.window;
+        m["min"] = s.min;
+        m["p50"] = s.p50;
+        m["p95"] = s.p95;
+        m["p99"] = s.p99;
+        m["max"] = s.max;
+        m["avg"] = s.avg;
+
+        if (lastOffset) {
+            lastTrace[STAGE_NAMES[i]] = lastOffset;
+        } else {
+            lastTrace[STAGE_NAMES[i]] = nullptr;
+        }
+    }
+
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
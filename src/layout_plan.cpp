@@ -0,0 +1,169 @@
+#include "layout_plan.h"
+
+// Panel and chrome, shared with ui_manager.cpp
+static const int SCREEN_WIDTH = 480;
+static const int CONTENT_TOP = 90;              // Below the 70px header
+static const int CYBERPUNK_DENSE_TOP = 75;      // 7+ cards leave room for the data bar
+static const int HEIGHT_WITH_SCENES = 250;      // Above the action bar
+static const int HEIGHT_WITHOUT_SCENES = 340;
+static const int PAGER_Y = 464;                 // Below the grid and the action bar
+static const int PAGER_Y_CYBERPUNK = 438;       // Above the data bar
+
+// Standard and Cyberpunk grid by button count
+struct GridShape {
+    uint8_t cols, rows;
+    int16_t cardWidth;
+    int16_t cardHeight;         // Without scenes; dense grids shrink with them
+    int16_t gap;
+    bool dense;
+};
+
+static GridShape gridShape(uint8_t buttons) {
+    switch (buttons) {
+        case 2:  return {2, 1, 200, 110, 20, false};
+        case 3:  return {3, 1, 140, 110, 20, false};
+        case 4:  return {2, 2, 200, 110, 20, false};
+        case 5:
+        case 6:  return {3, 2, 140, 110, 20, false};
+        case 7:
+        case 8:
+        case 9:  return {3, 3, 130, 110, 12, true};
+        case 10:
+        case 11:
+        case 12: return {4, 3, 105, 110, 10, true};
+        default: return {1, 1, 200, 110, 20, false};     // 1 button
+    }
+}
+
+static void planGrid(LayoutPlan& plan, uint8_t count) {
+    GridShape grid = gridShape(count);
+    int cardHeight = grid.cardHeight;
+    if (grid.dense && plan.scenes > 0) {
+        cardHeight = 78;
+    }
+
+    plan.cols = grid.cols;
+    plan.rows = grid.rows;
+    plan.gap = grid.gap;
+    bool compact = grid.dense && plan.family == LayoutFamily::STANDARD;
+    plan.shape = compact ? CARD_SHAPE_COMPACT : CARD_SHAPE_REGULAR;
+    plan.iconFont = compact ? &lv_font_montserrat_24 : &lv_font_montserrat_28;
+
+    // Centered horizontally
+    int totalWidth = grid.cols * grid.cardWidth + (grid.cols - 1) * grid.gap;
+    int startX = (SCREEN_WIDTH - totalWidth) / 2;
+    int startY = (plan.family == LayoutFamily::CYBERPUNK && grid.dense) ? CYBERPUNK_DENSE_TOP : CONTENT_TOP;
+
+    for (int i = 0; i < count; i++) {
+        CardRect& r = plan.cards[i];
+        r.x = startX + (i % grid.cols) * (grid.cardWidth + grid.gap);
+        r.y = startY + (i / grid.cols) * (cardHeight + grid.gap);
+        r.w = grid.cardWidth;
+        r.h = cardHeight;
+    }
+}
+
+static void planList(LayoutPlan& plan, uint8_t count) {
+    const int gap = 8;
+    const int margin = 20;
+    plan.cols = count > 6 ? 2 : 1;
+    plan.rows = (count + plan.cols - 1) / plan.cols;
+    plan.gap = gap;
+    plan.shape = CARD_SHAPE_ROW;
+    plan.iconFont = &lv_font_montserrat_24;
+
+    int available = plan.scenes > 0 ? HEIGHT_WITH_SCENES : HEIGHT_WITHOUT_SCENES;
+    int rowHeight = (available - (plan.rows - 1) * gap) / plan.rows;
+    if (rowHeight > 72) rowHeight = 72;
+    if (rowHeight < 36) rowHeight = 36;
+    int width = (SCREEN_WIDTH - 2 * margin - (plan.cols - 1) * gap) / plan.cols;
+
+    // Filled column by column, so the order reads top to bottom
+    for (int i = 0; i < count; i++) {
+        CardRect& r = plan.cards[i];
+        r.x = margin + (i / plan.rows) * (width + gap);
+        r.y = CONTENT_TOP + (i % plan.rows) * (rowHeight + gap);
+        r.w = width;
+        r.h = rowHeight;
+    }
+}
+
+static void planLCARS(LayoutPlan& plan, uint8_t count) {
+    // Right of the sidebar, above the status block
+    const int startX = 70;
+    const int gap = 8;
+    const int available = 210;
+    plan.cols = count > 6 ? 3 : 2;
+    plan.rows = (count + plan.cols - 1) / plan.cols;
+    plan.gap = gap;
+
+    int cardHeight = (available - (plan.rows - 1) * gap) / plan.rows;
+    if (cardHeight > 95) cardHeight = 95;
+    if (cardHeight < 50) cardHeight = 50;
+    int cardWidth = count > 6 ? 128 : 195;
+
+    bool tall = cardHeight >= 80;
+    plan.shape = tall ? CARD_SHAPE_REGULAR : CARD_SHAPE_COMPACT;
+    plan.iconFont = tall ? &lv_font_montserrat_28 : &lv_font_montserrat_20;
+    plan.statusY = CONTENT_TOP + plan.rows * (cardHeight + gap) + 5;
+
+    // Right of the section title
+    plan.pagerX = 430;
+    plan.pagerY = 62;
+
+    for (int i = 0; i < count; i++) {
+        CardRect& r = plan.cards[i];
+        r.x = startX + (i % plan.cols) * (cardWidth + gap);
+        r.y = CONTENT_TOP + (i / plan.cols) * (cardHeight + gap);
+        r.w = cardWidth;
+        r.h = cardHeight;
+    }
+}
+
+bool LayoutPlan::update(uint8_t buttonCount, uint8_t sceneCount, LayoutFamily layoutFamily, CardLayout layoutMode) {
+    if (buttonCount > MAX_BUTTONS) buttonCount = MAX_BUTTONS;
+    // Lists are a standard-theme arrangement
+    if (layoutFamily != LayoutFamily::STANDARD) layoutMode = CardLayout::GRID;
+
+    if (valid && buttons == buttonCount && scenes == sceneCount &&
+        family == layoutFamily && mode == layoutMode) {
+        return false;
+    }
+
+    memset(this, 0, sizeof(*this));
+    valid = true;
+    buttons = buttonCount;
+    scenes = sceneCount;
+    family = layoutFamily;
+    mode = layoutMode;
+
+    // Geometry is planned for a full page; the last one leaves slots empty
+    perPage = pageCapacity(family);
+    pages = pageCount(buttons, family);
+    uint8_t count = buttons < perPage ? buttons : perPage;
+
+    // Below the cards, or in the strip above Cyberpunk's data bar
+    pagerX = SCREEN_WIDTH / 2;
+    pagerY = (family == LayoutFamily::CYBERPUNK) ? PAGER_Y_CYBERPUNK : PAGER_Y;
+
+    if (count == 0) {
+        iconFont = &lv_font_montserrat_28;
+    } else if (family == LayoutFamily::LCARS) {
+        planLCARS(*this, count);
+    } else if (mode == CardLayout::LIST) {
+        planList(*this, count);
+    } else {
+        planGrid(*this, count);
+    }
+    return true;
+}
+
+uint8_t LayoutPlan::pageCapacity(LayoutFamily family) {
+    // LCARS keeps its status block in place at three rows
+    return family == LayoutFamily::LCARS ? 9 : MAX_PAGE_CARDS;
+}
+
+uint8_t LayoutPlan::pageCount(uint8_t buttons, LayoutFamily family) {
+    uint8_t capacity = pageCapacity(family);
+    return buttons == 0 ? 1 : (buttons + capacity - 1) / capacity;
+}
@@ -0,0 +1,214 @@
+#include "lvgl_mem.h"
+#include "psram_budget.h"
+#include "static_memory.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <multi_heap.h>
+#include <string.h>
+
+// All LVGL allocations happen with the LVGL lock held (see lvgl_task.h),
+// so the counters and the arena need no locking of their own.
+
+// Internal blocks carry a small header so free() knows their size;
+// the header keeps the 8-byte alignment malloc() gives
+struct InternalHeader {
+    uint32_t size;
+    uint32_t magic;
+};
+static const uint32_t INTERNAL_MAGIC = 0x4C564D49;  // "LVMI"
+
+static bool initialized = false;
+static uint8_t* arenaStart = nullptr;
+static size_t arenaSize = 0;
+static multi_heap_handle_t arena = nullptr;
+
+static lvgl_mem_stats_t stats;
+
+#if PANEL_STATIC_MEMORY
+// The internal share is one block taken at boot and carved by a heap of its
+// own, so object churn never reaches the system heap (static_memory.h)
+static uint8_t* internalStart = nullptr;
+static multi_heap_handle_t internalHeap = nullptr;
+
+static inline bool inInternalHeap(const void* ptr) {
+    return internalHeap && (const uint8_t*)ptr >= internalStart &&
+           (const uint8_t*)ptr < internalStart + LVGL_MEM_INTERNAL_BUDGET;
+}
+#endif
+
+static inline bool inArena(const void* ptr) {
+    return arena && (const uint8_t*)ptr >= arenaStart && (const uint8_t*)ptr < arenaStart + arenaSize;
+}
+
+void lvgl_mem_init(void) {
+    if (initialized) return;
+    initialized = true;
+    memset(&stats, 0, sizeof(stats));
+
+#if PANEL_STATIC_MEMORY
+    internalStart = (uint8_t*)heap_caps_malloc(LVGL_MEM_INTERNAL_BUDGET, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (internalStart) {
+        internalHeap = multi_heap_register(internalStart, LVGL_MEM_INTERNAL_BUDGET);
+    }
+    if (!internalHeap) {
+        Serial.println("LVGLMem: No internal block, small allocations use the system heap");
+    }
+#endif
+
+    if (!psramFound()) {
+        Serial.println("LVGLMem: No PSRAM, all LVGL allocations use internal SRAM");
+        return;
+    }
+
+    size_t size = ESP.getPsramSize() / LVGL_MEM_PSRAM_DIVISOR;
+    if (size > LVGL_MEM_PSRAM_MAX) size = LVGL_MEM_PSRAM_MAX;
+    if (size > ESP.getFreePsram() / 2) size = ESP.getFreePsram() / 2;  // Framebuffers come first
+
+    arenaStart = (uint8_t*)psramBudget.alloc(PSRAM_LVGL_ARENA, size);
+    if (arenaStart) {
+        arena = multi_heap_register(arenaStart, size);
+    }
+    if (!arena) {
+        Serial.printf("LVGLMem: Failed to create %u byte PSRAM arena\n", (unsigned)size);
+        psramBudget.release(PSRAM_LVGL_ARENA, arenaStart, size);
+        arenaStart = nullptr;
+        return;
+    }
+
+    arenaSize = size;
+    stats.psramArenaSize = size;
+    Serial.printf("LVGLMem: %u KB PSRAM arena, %u KB internal budget, small <= %u bytes\n",
+                  (unsigned)(size / 1024), (unsigned)(LVGL_MEM_INTERNAL_BUDGET / 1024),
+                  (unsigned)LVGL_MEM_SMALL_MAX);
+}
+
+static void* mallocInternal(size_t size) {
+#if PANEL_STATIC_MEMORY
+    // Full (only without a PSRAM arena to take the rest): the system heap,
+    // where it shows in the post-setup count
+    void* ptr = internalHeap ? multi_heap_malloc(internalHeap, size) : nullptr;
+    if (ptr) return ptr;
+#endif
+    return heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+
+static void freeInternal(void* ptr) {
+#if PANEL_STATIC_MEMORY
+    if (inInternalHeap(ptr)) {
+        multi_heap_free(internalHeap, ptr);
+        return;
+    }
+#endif
+    heap_caps_free(ptr);
+}
+
+static void* allocInternal(size_t size) {
+    // Without an arena internal SRAM is the only option, so the budget is not enforced
+    if (arena && stats.internalUsed + size > LVGL_MEM_INTERNAL_BUDGET) {
+        return nullptr;
+    }
+
+    InternalHeader* hdr = (InternalHeader*)mallocInternal(sizeof(InternalHeader) + size);
+    if (!hdr) return nullptr;
+
+    hdr->size = size;
+    hdr->magic = INTERNAL_MAGIC;
+    stats.internalUsed += size;
+    if (stats.internalUsed > stats.internalPeak) stats.internalPeak = stats.internalUsed;
+    return hdr + 1;
+}
+
+static void* allocArena(size_t size) {
+    if (!arena) return nullptr;
+
+    void* ptr = multi_heap_malloc(arena, size);
+    if (!ptr) return nullptr;
+
+    stats.psramUsed += multi_heap_get_allocated_size(arena, ptr);
+    if (stats.psramUsed > stats.psramPeak) stats.psramPeak = stats.psramUsed;
+    return ptr;
+}
+
+static size_t allocatedSize(void* ptr) {
+    if (inArena(ptr)) {
+        return multi_heap_get_allocated_size(arena, ptr);
+    }
+    return ((InternalHeader*)ptr - 1)->size;
+}
+
+void* lvgl_mem_alloc(size_t size) {
+    if (!initialized) lvgl_mem_init();
+    if (size == 0) return nullptr;
+
+    void* ptr;
+    if (size <= LVGL_MEM_SMALL_MAX) {
+        ptr = allocInternal(size);
+        if (!ptr) ptr = allocArena(size);
+    } else {
+        ptr = allocArena(size);
+        if (!ptr) ptr = allocInternal(size);
+    }
+
+    if (ptr) {
+        stats.allocCount++;
+    } else {
+        stats.failures++;
+        Serial.printf("LVGLMem: Allocation of %u bytes failed\n", (unsigned)size);
+    }
+    return ptr;
+}
+
+void lvgl_mem_free(void* ptr) {
+    if (!ptr) return;
+
+    if (inArena(ptr)) {
+        stats.psramUsed -= multi_heap_get_allocated_size(arena, ptr);
+        multi_heap_free(arena, ptr);
+    } else {
+        InternalHeader* hdr = (InternalHeader*)ptr - 1;
+        if (hdr->magic != INTERNAL_MAGIC) {
+            Serial.println("LVGLMem: free() of unknown pointer ignored");
+            return;
+        }
+        hdr->magic = 0;
+        stats.internalUsed -= hdr->size;
+        freeInternal(hdr);
+    }
+    stats.allocCount--;
+}
+
+void* lvgl_mem_realloc(void* ptr, size_t size) {
+    if (!ptr) return lvgl_mem_alloc(size);
+    if (size == 0) {
+        lvgl_mem_free(ptr);
+        return nullptr;
+    }
+
+    // Large blocks that stay large can grow/shrink inside the arena
+    if (inArena(ptr) && size > LVGL_MEM_SMALL_MAX) {
+        size_t oldSize = multi_heap_get_allocated_size(arena, ptr);
+        void* moved = multi_heap_realloc(arena, ptr, size);
+        if (moved) {
+            stats.psramUsed = stats.psramUsed - oldSize + multi_heap_get_allocated_size(arena, moved);
+            if (stats.psramUsed > stats.psramPeak) stats.psramPeak = stats.psramUsed;
+            return moved;
+        }
+    }
+
+    size_t oldSize = allocatedSize(ptr);
+    void* moved = lvgl_mem_alloc(size);
+    if (!moved) return nullptr;
+    memcpy(moved, ptr, oldSize < size ? oldSize : size);
+    lvgl_mem_free(ptr);
+    return moved;
+}
+
+void lvgl_mem_get_stats(lvgl_mem_stats_t* out) {
+    *out = stats;
+    out->psramLargestFree = 0;
+    if (arena) {
+        multi_heap_info_t info;
+        multi_heap_get_info(arena, &info);
+        out->psramLargestFree = info.largest_free_block;
+    }
+}
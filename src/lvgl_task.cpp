@@ -0,0 +1,256 @@
+#include "lvgl_task.h"
+#include "ui_manager.h"
+#include "screenshot.h"
+#include "perf_monitor.h"
+#include "touch_input.h"
+#include "stall_monitor.h"
+#include <lvgl.h>
+#include <esp_pm.h>
+#include <esp_timer.h>
+
+// Global instance
+LVGLTask lvglTask;
+
+LVGLTask::LVGLTask()
+    : mutex(nullptr)
+    , taskHandle(nullptr)
+    , lastTick(0)
+    , powerSave(false)
+    , darkRequested(false)
+    , darkActive(false)
+    , scanoutStopped(false)
+    , updateMode(false)
+    , scanoutControl(nullptr)
+    , frameCount(nullptr)
+    , frameNotify(nullptr)
+    , lastFrame(0)
+{
+}
+
+void LVGLTask::begin() {
+    if (taskHandle) return;
+
+    if (!mutex) {
+        mutex = xSemaphoreCreateRecursiveMutex();
+        if (!mutex) {
+            Serial.println("LVGLTask: Failed to create mutex!");
+            return;
+        }
+    }
+
+    lastTick = millis();
+
+    BaseType_t result = xTaskCreatePinnedToCore(
+        taskMain,
+        "LVGL",
+        TASK_STACK_SIZE,
+        this,
+        TASK_PRIORITY,
+        &taskHandle,
+        TASK_CORE
+    );
+
+    if (result != pdPASS) {
+        taskHandle = nullptr;
+        Serial.println("LVGLTask: Failed to create render task!");
+        return;
+    }
+
+    Serial.printf("LVGLTask: Render task started on core %d\n", TASK_CORE);
+}
+
+bool LVGLTask::lock(uint32_t timeoutMs) {
+    // Before the task starts setup() is the only LVGL user
+    if (!mutex) return true;
+
+    TickType_t ticks = (timeoutMs == UINT32_MAX) ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+    return xSemaphoreTakeRecursive(mutex, ticks) == pdTRUE;
+}
+
+void LVGLTask::unlock() {
+    if (!mutex) return;
+    xSemaphoreGiveRecursive(mutex);
+}
+
+void LVGLTask::setFramePacing(FrameCountFn count, FrameNotifyFn notify) {
+    frameCount = count;
+    frameNotify = notify;
+    lastFrame = count();
+
+    // Due only when a frame edge makes them so; the period is a backstop
+    lv_timer_set_period(_lv_disp_get_refr_timer(lv_disp_get_default()), PACED_FALLBACK_MS);
+    lv_timer_set_period(lv_anim_get_timer(), PACED_FALLBACK_MS);
+}
+
+void LVGLTask::taskMain(void* parameter) {
+    LVGLTask* self = (LVGLTask*)parameter;
+    stallMonitor.attach(STALL_LVGL);
+
+    while (true) {
+        // Transitions happen here, between frames, never mid-render
+        bool dark = self->darkRequested;
+        if (dark != self->darkActive) {
+            self->applyDarkIdle(dark);
+        }
+
+        // Waiting here is a stall too: someone else holds the LVGL lock
+        stallMonitor.enter(STALL_LVGL, "lock");
+        self->lock();
+
+        unsigned long now = millis();
+        lv_tick_inc(now - self->lastTick);
+        self->lastTick = now;
+
+        uint32_t idleMs;
+        if (self->darkActive) {
+            // Nothing reaches the glass: keep the UI state current without
+            // drawing it. Invalidated areas wait for the first lit frame.
+            stallMonitor.setTag(STALL_LVGL, "ui_update");
+            uiManager.update();
+            idleMs = DARK_IDLE_MS;
+        } else if (self->updateMode) {
+            // OTA screen only: no touch, no queued UI work, no screenshots.
+            // Commands stay queued for the UI that comes back on failure.
+            stallMonitor.setTag(STALL_LVGL, "render");
+            lv_timer_handler();
+            idleMs = UPDATE_FRAME_MS;
+        } else {
+            // A scanout edge since the last pass: render now, with the
+            // animations stepped and a held touch read for this frame
+            if (self->frameCount) {
+                uint32_t frame = self->frameCount();
+                if (frame != self->lastFrame) {
+                    self->lastFrame = frame;
+                    lv_timer_ready(_lv_disp_get_refr_timer(lv_disp_get_default()));
+                    lv_timer_ready(lv_anim_get_timer());
+                    touchInput.alignToFrame();
+                }
+            }
+
+            // A touch interrupt makes the read timer due in this pass
+            stallMonitor.setTag(STALL_LVGL, "touch");
+            touchInput.service();
+
+            // Returns ms until the next LVGL timer (animation, touch read) is due
+            stallMonitor.setTag(STALL_LVGL, "render");
+            int64_t handlerStart = esp_timer_get_time();
+            idleMs = lv_timer_handler();
+            perfMonitor.record(PERF_TIMER_HANDLER_US, esp_timer_get_time() - handlerStart);
+
+            // Frame is complete here: hand out a copy if a screenshot is waiting
+            stallMonitor.setTag(STALL_LVGL, "screenshot");
+            serviceScreenshotCapture();
+
+            // Pending UI rebuilds run here, in the UI thread
+            stallMonitor.setTag(STALL_LVGL, "ui_update");
+            uiManager.update();
+
+            if (idleMs < MIN_IDLE_MS) idleMs = MIN_IDLE_MS;
+            if (idleMs > MAX_IDLE_MS) idleMs = MAX_IDLE_MS;
+
+            // More to draw (an animation, invalidated areas, a finger on
+            // the glass): wake at the next frame done. An edge that passed
+            // while this pass ran is caught up at once.
+            if (self->frameCount) {
+                lv_disp_t* disp = lv_disp_get_default();
+                if (disp->inv_p > 0 || lv_anim_count_running() > 0 || touchInput.isTracking()) {
+                    self->frameNotify(self->taskHandle);
+                    if (self->frameCount() != self->lastFrame) {
+                        idleMs = 0;
+                    }
+                }
+            }
+        }
+
+        self->unlock();
+        stallMonitor.leave(STALL_LVGL);
+
+        // Sleep until the next deadline, or until a queued command wakes us
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(idleMs));
+    }
+}
+
+void LVGLTask::wake() {
+    if (taskHandle) {
+        xTaskNotifyGive(taskHandle);
+    }
+}
+
+void LVGLTask::setPowerSave(bool enabled) {
+    if (enabled == powerSave) return;
+    powerSave = enabled;
+    applyPowerConfig();
+}
+
+void LVGLTask::setUpdateMode(bool enabled) {
+    if (enabled == updateMode) return;
+    updateMode = enabled;
+    Serial.printf("LVGLTask: Update mode %s\n", enabled ? "on" : "off");
+    wake();
+}
+
+void LVGLTask::setDarkIdle(bool dark) {
+    if (dark == darkRequested) return;
+    darkRequested = dark;
+    wake();
+}
+
+void LVGLTask::applyDarkIdle(bool dark) {
+    darkActive = dark;
+
+    if (dark) {
+        // The last frame stays in the framebuffer; the dark panel doesn't need it clocked out
+        scanoutStopped = scanoutControl && scanoutControl(false);
+        Serial.printf("LVGLTask: Dark idle, rendering paused%s\n",
+            scanoutStopped ? ", scanout stopped" : "");
+    } else {
+        // Restart from the top of the frame before the backlight gets anywhere
+        if (scanoutStopped) {
+            scanoutControl(true);
+            scanoutStopped = false;
+        }
+        Serial.println("LVGLTask: Dark idle ended");
+    }
+    applyPowerConfig();
+}
+
+void LVGLTask::applyPowerConfig() {
+    int minMhz = MAX_CPU_MHZ;
+    if (darkActive) {
+        minMhz = scanoutStopped ? DARK_IDLE_MIN_MHZ : POWER_SAVE_MIN_MHZ;
+    } else if (powerSave) {
+        minMhz = POWER_SAVE_MIN_MHZ;
+    }
+
+#if CONFIG_PM_ENABLE
+    // Light sleep stays off - the RGB panel's PM lock blocks it while scanning
+    // out, and the WiFi link has to keep serving state sync while dark
+    esp_pm_config_esp32s3_t pmConfig = {};
+    pmConfig.max_freq_mhz = MAX_CPU_MHZ;
+    pmConfig.min_freq_mhz = minMhz;
+    pmConfig.light_sleep_enable = false;
+
+    esp_err_t err = esp_pm_configure(&pmConfig);
+    if (err == ESP_OK) {
+        Serial.printf("LVGLTask: CPU %d-%d MHz\n", pmConfig.min_freq_mhz, pmConfig.max_freq_mhz);
+    } else {
+        Serial.printf("LVGLTask: esp_pm_configure failed: %s\n", esp_err_to_name(err));
+    }
+#else
+    Serial.printf("LVGLTask: CPU floor %d MHz wanted (no DFS, CONFIG_PM_ENABLE off)\n", minMhz);
+#endif
+}
+
+// ============================================================================
+// Scoped lock
+// ============================================================================
+
+LVGLLock::LVGLLock() {
+    locked = lvglTask.lock();
+}
+
+LVGLLock::~LVGLLock() {
+    if (locked) {
+        lvglTask.unlock();
+    }
+}
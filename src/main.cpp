@@ -2,7 +2,7 @@
 #include <lvgl.h>
 #include <WiFi.h>
 #include <Wire.h>
-#include <Preferences.h>
+#include <esp_timer.h>
 #include <Arduino_GFX_Library.h>
 #include <TAMC_GT911.h>
 
@@ -12,19 +12,41 @@
 #include "ui_manager.h"
 #include "device_controller.h"
 #include "mdns_service.h"
+#include "ota_stream.h"
+#include "icon_pack.h"
+#include "crash_report.h"
+#include "boot_profile.h"
+#include "psram_budget.h"
+#include "static_memory.h"
 #include "web_server.h"
 #include "screenshot.h"
 #include "time_manager.h"
 #include "brightness_scheduler.h"
 #include "theme_scheduler.h"
+#include "lvgl_task.h"
+#include "lvgl_mem.h"
+#include "server_channel.h"
+#include "state_multicast.h"
+#include "peer_mirror.h"
+#include "perf_monitor.h"
+#include "latency_trace.h"
+#include "heap_monitor.h"
+#include "task_monitor.h"
+#include "stall_monitor.h"
+#include "touch_input.h"
+#include "gesture_engine.h"
+#include "backlight.h"
+#include "ambient_light.h"
+#include "event_scheduler.h"
+#include "ui_benchmark.h"
+#include "panel_tuner.h"
+#include "wifi_link.h"
+#include "wifi_scan.h"
+#include "panel_log.h"
+#include "band_renderer.h"
+#include "img_cache_stats.h"
+#include "warm_state.h"
 
-// Optional: include secrets.h for default WiFi credentials
-#if __has_include("secrets.h")
-#include "secrets.h"
-#define HAS_DEFAULT_WIFI 1
-#else
-#define HAS_DEFAULT_WIFI 0
-#endif
 
 // ============================================================================
 // PIN DEFINITIONS for Guition ESP32-S3-4848S040
@@ -33,7 +55,11 @@
 // Touch controller pins
 #define TOUCH_SDA 19
 #define TOUCH_SCL 45
-#define TOUCH_INT -1  // Not connected
+// INT isn't wired on the stock board; variants that route it to a GPIO can
+// build with -DTOUCH_INT=<gpio> to read the controller on interrupt
+#ifndef TOUCH_INT
+#define TOUCH_INT -1
+#endif
 #define TOUCH_RST -1  // Not connected
 
 // Backlight pin (PWM controlled via ui_manager)
@@ -50,13 +76,21 @@
 // Touch controller instance
 TAMC_GT911 touchController(TOUCH_SDA, TOUCH_SCL, TOUCH_INT, TOUCH_RST, TFT_WIDTH, TFT_HEIGHT);
 
+// Scanout through internal SRAM bounce buffers of this many lines
+// (0 = DMA reads the PSRAM framebuffer directly). Costs 2 x lines x 960 bytes
+// of internal RAM; helps when WiFi traffic starves the PSRAM bus.
+#ifndef PANEL_BOUNCE_LINES
+#define PANEL_BOUNCE_LINES 0
+#endif
+
 // Display bus configuration for ESP32-S3-4848S040
 Arduino_ESP32RGBPanel *bus = new Arduino_ESP32RGBPanel(
     39 /* CS */, 48 /* SCK */, 47 /* SDA */,
     18 /* DE */, 17 /* VSYNC */, 16 /* HSYNC */, 21 /* PCLK */,
     11 /* R0 */, 12 /* R1 */, 13 /* R2 */, 14 /* R3 */, 0 /* R4 */,
     8 /* G0 */, 20 /* G1 */, 3 /* G2 */, 46 /* G3 */, 9 /* G4 */, 10 /* G5 */,
-    4 /* B0 */, 5 /* B1 */, 6 /* B2 */, 7 /* B3 */, 15 /* B4 */
+    4 /* B0 */, 5 /* B1 */, 6 /* B2 */, 7 /* B3 */, 15 /* B4 */,
+    false /* useBigEndian */, PANEL_BOUNCE_LINES * TFT_WIDTH /* bounce_buffer_size_px */
 );
 
 // ST7701 display panel
@@ -73,45 +107,370 @@ Arduino_ST7701_RGBPanel *gfx = new Arduino_ST7701_RGBPanel(
 // LVGL CONFIGURATION
 // ============================================================================
 
-// LVGL display buffers (double buffered in PSRAM)
+// Render strategies
+#define RENDER_MODE_FULL    0   // Full-frame PSRAM buffers, whole screen re-rendered and copied
+#define RENDER_MODE_PARTIAL 1   // Small PSRAM buffers, merged dirty areas rendered and copied
+#define RENDER_MODE_DIRECT  2   // LVGL draws dirty areas straight into the panel framebuffer
+
+#ifndef LVGL_RENDER_MODE
+#define LVGL_RENDER_MODE RENDER_MODE_DIRECT
+#endif
+
+#define LVGL_DIRECT_MODE (LVGL_RENDER_MODE == RENDER_MODE_DIRECT)
+
+// Full/partial modes: copy full-width areas into the panel framebuffer with
+// GDMA and signal flush_ready from its ISR, so LVGL renders the next frame
+// into the other buffer meanwhile
+#ifndef LVGL_ASYNC_FLUSH
+#define LVGL_ASYNC_FLUSH 1
+#endif
+
+// Partial mode: draw buffer height in lines, and how many rectangles the
+// invalidated areas are merged into per refresh
+#define PARTIAL_BUF_LINES 60
+#define PARTIAL_MAX_AREAS 4
+
+// Second panel framebuffer, LVGL renders into the hidden one and the panel
+// switches over at VSYNC (direct mode only)
+#ifndef PANEL_DOUBLE_BUFFER
+#define PANEL_DOUBLE_BUFFER 1
+#endif
+
+// Tear-free double buffering allows a faster pixel clock
+#if LVGL_DIRECT_MODE && PANEL_DOUBLE_BUFFER
+#define PANEL_PCLK_HZ 12000000
+#else
+#define PANEL_PCLK_HZ 8000000
+#endif
+
+// Render in step with scanout: LVGL's refresh runs at each frame done
+// instead of every 30 ms (see LVGLTask::setFramePacing). Needs the second
+// framebuffer, so a frame rendered right after a swap has a whole scanout
+// to finish before the next one.
+#ifndef PANEL_VSYNC_PACING
+#define PANEL_VSYNC_PACING (LVGL_DIRECT_MODE && PANEL_DOUBLE_BUFFER)
+#endif
+
+// Run the UI benchmark once the system is up and print its report to
+// serial (set by the esp32s3-bench env)
+#ifndef UI_BENCH_ON_BOOT
+#define UI_BENCH_ON_BOOT 0
+#endif
+
+#if LVGL_DIRECT_MODE && (LV_COLOR_16_SWAP != 0)
+#error "RENDER_MODE_DIRECT requires LV_COLOR_16_SWAP 0 (panel framebuffer is native RGB565)"
+#endif
+
+// LVGL display buffers (panel framebuffer(s) in direct mode, else double buffered in PSRAM)
 static lv_disp_draw_buf_t draw_buf;
 static lv_color_t *disp_draw_buf1;
 static lv_color_t *disp_draw_buf2;
 static lv_disp_drv_t disp_drv;
 
-// LVGL tick tracking
-static unsigned long last_tick = 0;
-
 // LVGL touch input device
 static lv_indev_drv_t indev_drv;
 static lv_indev_t *touch_indev = nullptr;
 
-// WiFi preferences storage
-Preferences wifi_prefs;
-
 // ============================================================================
 // LVGL CALLBACKS
 // ============================================================================
 
-// Display flush callback - sends pixels to the display
-void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
+#if LVGL_DIRECT_MODE && PANEL_DOUBLE_BUFFER
+// Copy this frame's dirty areas into the other buffer so both stay identical
+static void syncBackBuffer(lv_color_t *front) {
+    lv_disp_t *disp = _lv_refr_get_disp_refreshing();
+    lv_color_t *back = (front == disp_draw_buf1) ? disp_draw_buf2 : disp_draw_buf1;
+
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        if (disp->inv_area_joined[i]) continue;
+
+        const lv_area_t *a = &disp->inv_areas[i];
+        lv_coord_t w = lv_area_get_width(a);
+        for (lv_coord_t y = a->y1; y <= a->y2; y++) {
+            uint32_t offset = (uint32_t)y * TFT_WIDTH + a->x1;
+            memcpy(back + offset, front + offset, w * sizeof(lv_color_t));
+        }
+        gfx->flushFramebuffer((uint16_t *)back, a->x1, a->y1, w, lv_area_get_height(a));
+    }
+}
+#endif
+
+#if LVGL_RENDER_MODE == RENDER_MODE_PARTIAL
+// Collapse the invalidated areas into at most PARTIAL_MAX_AREAS bounding boxes,
+// joining whichever pair adds the fewest extra pixels each step
+static void mergeInvalidAreas(lv_disp_t *disp) {
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        if (!disp->inv_area_joined[i]) {
+            disp->inv_areas[n++] = disp->inv_areas[i];
+        }
+    }
+
+    while (n > PARTIAL_MAX_AREAS) {
+        uint16_t best_a = 0, best_b = 1;
+        int32_t best_cost = INT32_MAX;
+        for (uint16_t a = 0; a < n; a++) {
+            for (uint16_t b = a + 1; b < n; b++) {
+                lv_area_t joined;
+                _lv_area_join(&joined, &disp->inv_areas[a], &disp->inv_areas[b]);
+                int32_t cost = (int32_t)lv_area_get_size(&joined)
+                             - (int32_t)lv_area_get_size(&disp->inv_areas[a])
+                             - (int32_t)lv_area_get_size(&disp->inv_areas[b]);
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_a = a;
+                    best_b = b;
+                }
+            }
+        }
+        _lv_area_join(&disp->inv_areas[best_a], &disp->inv_areas[best_a], &disp->inv_areas[best_b]);
+        disp->inv_areas[best_b] = disp->inv_areas[--n];
+    }
+
+    memset(disp->inv_area_joined, 0, sizeof(disp->inv_area_joined));
+    disp->inv_p = n;
+}
+#endif
+
+// Display refresh timer wrapper - merges dirty areas (partial mode), then lets
+// LVGL render them, recording frame timings for /api/perf
+static void refr_timer(lv_timer_t *timer) {
+    lv_disp_t *disp = (lv_disp_t *)timer->user_data;
+#if LVGL_RENDER_MODE == RENDER_MODE_PARTIAL
+    if (disp && disp->inv_p > PARTIAL_MAX_AREAS) {
+        mergeInvalidAreas(disp);
+    }
+#endif
+
+    uint32_t area = 0;
+    if (disp) {
+        for (uint16_t i = 0; i < disp->inv_p; i++) {
+            if (!disp->inv_area_joined[i]) {
+                area += lv_area_get_size(&disp->inv_areas[i]);
+            }
+        }
+    }
+
+    perfMonitor.beginFrame();
+    int64_t start = esp_timer_get_time();
+    _lv_disp_refr_timer(timer);
+    uint32_t elapsed = esp_timer_get_time() - start;
+
+    // Idle ticks (nothing invalidated) aren't frames
+    if (area > 0) {
+        uint32_t flush = perfMonitor.frameFlush();
+        perfMonitor.record(PERF_RENDER_US, elapsed > flush ? elapsed - flush : 0);
+        perfMonitor.record(PERF_FLUSH_US, flush);
+        perfMonitor.record(PERF_INV_AREA_PX, area);
+        perfMonitor.record(PERF_FRAME_US, elapsed);
+        perfMonitor.countFrame();
+    }
+}
+
+#if !LVGL_DIRECT_MODE && LVGL_ASYNC_FLUSH
+// GDMA copy finished (ISR context)
+static void flush_done_cb(void *user_ctx) {
+    lv_disp_drv_t *disp = (lv_disp_drv_t *)user_ctx;
+    if (lv_disp_flush_is_last(disp)) {
+        latencyTrace.mark(LAT_FLUSH_DONE);
+    }
+    lv_disp_flush_ready(disp);
+}
+#endif
+
+// Display flush callback - sends pixels to the display (in IRAM with
+// PANEL_FAST_RENDER, like LVGL's blend loops; see lv_conf.h)
+LV_ATTRIBUTE_FAST_MEM void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
+    int64_t flush_start = esp_timer_get_time();
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
 
-#if (LV_COLOR_16_SWAP != 0)
+#if LVGL_DIRECT_MODE
+    // Pixels are already in the panel framebuffer, just write the dirty area back from cache
+    gfx->flushFramebuffer((uint16_t *)color_p, area->x1, area->y1, w, h);
+    if (lv_disp_flush_is_last(disp)) {
+        latencyTrace.mark(LAT_FLUSH_DONE);
+    }
+
+#if PANEL_DOUBLE_BUFFER
+    if (disp_draw_buf2 && lv_disp_flush_is_last(disp)) {
+        // Show the finished frame at VSYNC, then bring the hidden buffer up to date
+        bus->presentFrameBuffer((uint16_t *)color_p);
+        latencyTrace.mark(LAT_VSYNC);
+        syncBackBuffer(color_p);
+    }
+#endif
+#elif (LV_COLOR_16_SWAP != 0)
     gfx->draw16bitBeRGBBitmap(area->x1, area->y1, (uint16_t *)&color_p->full, w, h);
 #else
+#if LVGL_ASYNC_FLUSH
+    if (gfx->draw16bitRGBBitmapAsync(area->x1, area->y1, (uint16_t *)&color_p->full, w, h, flush_done_cb, disp)) {
+        // Only the DMA submit is counted; the copy overlaps rendering
+        perfMonitor.addFlush(esp_timer_get_time() - flush_start);
+        return;  // flush_ready comes from the DMA completion
+    }
+#endif
     gfx->draw16bitRGBBitmap(area->x1, area->y1, (uint16_t *)&color_p->full, w, h);
 #endif
 
+#if !LVGL_DIRECT_MODE
+    if (lv_disp_flush_is_last(disp)) {
+        latencyTrace.mark(LAT_FLUSH_DONE);
+    }
+#endif
+    perfMonitor.addFlush(esp_timer_get_time() - flush_start);
     lv_disp_flush_ready(disp);
 }
 
-// Touch read callback for LVGL
-void my_touchpad_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
+// Dark idle hook for the render task: no pixel clock while the backlight is off
+static bool setPanelScanout(bool enabled) {
+    return bus->setScanout(enabled);
+}
+
+#if PANEL_VSYNC_PACING
+// Frame pacing hooks for the render task
+static uint32_t panelFrameCount() {
+    return bus->getFrameCount();
+}
+
+static void notifyPanelFrame(TaskHandle_t task) {
+    bus->notifyNextFrame(task);
+}
+#endif
+
+// Panel calibration hooks (see panel_tuner.h)
+static PanelTiming currentPanelTiming() {
+    PanelTiming timing = {};
+    const esp_lcd_rgb_timing_t *t = bus->getTimings();
+    if (t) {
+        timing.pclkHz = t->pclk_hz;
+        timing.width = t->h_res;
+        timing.height = t->v_res;
+        timing.hsyncPulse = t->hsync_pulse_width;
+        timing.hsyncBack = t->hsync_back_porch;
+        timing.hsyncFront = t->hsync_front_porch;
+        timing.vsyncPulse = t->vsync_pulse_width;
+        timing.vsyncBack = t->vsync_back_porch;
+        timing.vsyncFront = t->vsync_front_porch;
+    }
+    return timing;
+}
+
+static bool retimePanel(PanelTiming& timing) {
+    if (!bus->setTiming(timing.pclkHz, timing.hsyncPulse, timing.hsyncBack, timing.hsyncFront,
+                        timing.vsyncPulse, timing.vsyncBack, timing.vsyncFront)) {
+        return false;
+    }
+    timing.pclkHz = bus->getPixelClock();
+    return true;
+}
+
+static ScanoutHealth panelScanoutHealth() {
+    ScanoutHealth health;
+    health.frames = bus->getFrameCount();
+    health.underruns = bus->getUnderrunFrames();
+    health.late = bus->getLateFrames();
+    return health;
+}
+
+// Screenshot source: the scanned-out framebuffer, whatever the render mode
+static bool readPanelFrame(uint16_t* dst) {
+    return gfx->readFrame(dst);
+}
+
+// Touch sampler, run from the touch task (see touch_input.h)
+static uint8_t readTouchPanel(TouchPoint* points, uint8_t max) {
+    static bool wasTouched = false;
+
     touchController.read();
+    if (!touchController.isTouched) {
+        wasTouched = false;
+        return 0;
+    }
+
+    // Start the wake fade from here, not a frame later in the read callback
+    if (!wasTouched) {
+        wasTouched = true;
+        backlight.wake(brightnessScheduler.getWakeBrightness());
+    }
+
+    uint8_t n = touchController.touches < max ? touchController.touches : max;
+    if (n == 0) n = 1;
+    for (uint8_t i = 0; i < n; i++) {
+        // Transform coordinates - GT911 has origin at bottom-right by default
+        // Invert both axes for 0 degree rotation
+        points[i].x = TFT_WIDTH - 1 - touchController.points[i].x;
+        points[i].y = TFT_HEIGHT - 1 - touchController.points[i].y;
+    }
+    return n;
+}
+
+// Gesture bindings
+static const uint8_t GESTURE_BRIGHTNESS_STEP = 20;
+static const uint8_t GESTURE_BRIGHTNESS_MIN = 10;   // Dim, never dark
+
+static void setGestureBrightness(int brightness) {
+    if (brightness < GESTURE_BRIGHTNESS_MIN) brightness = GESTURE_BRIGHTNESS_MIN;
+    if (brightness > 100) brightness = 100;
+    uiManager.setBrightness(brightness);
+    configManager.setBrightness(brightness);
+    configManager.markDirty(ConfigManager::DIRTY_DISPLAY);
+}
+
+// Runs in the LVGL task, from the read callback
+static void handleGesture(Gesture gesture) {
+    switch (gesture) {
+        case Gesture::SWIPE_DOWN:
+            setGestureBrightness(uiManager.getBrightness() - GESTURE_BRIGHTNESS_STEP);
+            break;
+        case Gesture::SWIPE_UP:
+            setGestureBrightness(uiManager.getBrightness() + GESTURE_BRIGHTNESS_STEP);
+            break;
+        case Gesture::PINCH_IN:
+            setGestureBrightness(GESTURE_BRIGHTNESS_MIN);
+            break;
+        case Gesture::PINCH_OUT:
+            setGestureBrightness(100);
+            break;
+        case Gesture::TWO_FINGER_TAP:
+            deviceController.setAllButtons(false);
+            break;
+        case Gesture::SWIPE_LEFT:
+            // In from the right edge: next page of buttons
+            uiManager.showPage(uiManager.getPage() + 1);
+            break;
+        case Gesture::SWIPE_RIGHT:
+            if (uiManager.getPage() > 0) {
+                uiManager.showPage(uiManager.getPage() - 1);
+            }
+            break;
+        default:
+            // Long-press is recognized but unbound
+            break;
+    }
+}
+
+// Touch read callback for LVGL: replays the sampled events in order
+void my_touchpad_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
+    // A dark or just-woken display swallows gestures like it does taps
+    Gesture gesture;
+    while (gestureEngine.pop(gesture)) {
+        if (!brightnessScheduler.shouldBlockButtons()) {
+            handleGesture(gesture);
+        }
+    }
+
+    TouchEvent event;
+    bool more = false;
+    touchInput.next(event, more);
+    data->continue_reading = more;
 
-    if (touchController.isTouched) {
+    if (event.cancel) {
+        // The gesture owns this touch: end LVGL's press without a click
+        lv_indev_wait_release(touch_indev);
+    }
+
+    if (event.pressed) {
         // Notify brightness scheduler of touch event
         // If it returns true, the touch should be consumed (display was at 0%)
         if (brightnessScheduler.onTouchDetected()) {
@@ -127,17 +486,12 @@ void my_touchpad_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
         }
 
         data->state = LV_INDEV_STATE_PRESSED;
-
-        // Raw touch coordinates from GT911
-        int16_t raw_x = touchController.points[0].x;
-        int16_t raw_y = touchController.points[0].y;
-
-        // Transform coordinates - GT911 has origin at bottom-right by default
-        // Invert both axes for 0 degree rotation
-        data->point.x = TFT_WIDTH - 1 - raw_x;
-        data->point.y = TFT_HEIGHT - 1 - raw_y;
+        data->point.x = event.x;
+        data->point.y = event.y;
+        latencyTrace.noteTouch(true, event.timeUs);
     } else {
         data->state = LV_INDEV_STATE_RELEASED;
+        latencyTrace.noteTouch(false, event.timeUs);
     }
 }
 
@@ -148,8 +502,11 @@ void my_touchpad_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
 void setupDisplay() {
     Serial.println("Initializing display...");
 
-    // Lower pixel clock (8MHz) reduces tearing
-    gfx->begin(8000000);
+    // 8MHz when single buffered (reduces tearing), faster with VSYNC-swapped buffers.
+    // The panel framebuffer is allocated inside the library
+    size_t psramBefore = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    gfx->begin(PANEL_PCLK_HZ);
+    psramBudget.noteExternal(PSRAM_FRAMEBUFFER, psramBefore - heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
     gfx->fillScreen(BLACK);
 
     // Backlight will be controlled via PWM by ui_manager
@@ -162,13 +519,55 @@ void setupDisplay() {
 void setupLVGL() {
     Serial.println("Initializing LVGL...");
 
+#if !LVGL_MEM_BUILTIN
+    // Size the PSRAM arena now that the framebuffers are allocated
+    lvgl_mem_init();
+#endif
     lv_init();
 
-    // Full frame double buffers in PSRAM for smooth updates
     size_t buf_size = TFT_WIDTH * TFT_HEIGHT;
 
-    disp_draw_buf1 = (lv_color_t *)heap_caps_malloc(sizeof(lv_color_t) * buf_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-    disp_draw_buf2 = (lv_color_t *)heap_caps_malloc(sizeof(lv_color_t) * buf_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#if LVGL_DIRECT_MODE
+    // Render into the panel's own framebuffer - no extra frame copies
+    lv_color_t *front = (lv_color_t *)gfx->getFramebuffer();
+    lv_color_t *back = nullptr;
+
+    if (!front) {
+        Serial.println("Panel framebuffer not available!");
+        while (1) { delay(1000); }
+    }
+
+#if PANEL_DOUBLE_BUFFER
+    size_t psramBefore = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    back = (lv_color_t *)bus->allocBackBuffer();
+    psramBudget.noteExternal(PSRAM_FRAMEBUFFER, psramBefore - heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    if (!back) {
+        Serial.println("Failed to allocate second panel framebuffer, using single buffer");
+    }
+#endif
+
+    if (back) {
+        // LVGL starts drawing into buf1, so hand it the buffer that isn't on screen
+        disp_draw_buf1 = back;
+        disp_draw_buf2 = front;
+        latencyTrace.setVsyncStage(true);
+        Serial.println("Display buffers: direct mode, 2 panel framebuffers with VSYNC swap");
+    } else {
+        disp_draw_buf1 = front;
+        disp_draw_buf2 = nullptr;
+        Serial.println("Display buffer: direct mode into panel framebuffer");
+    }
+
+    lv_disp_draw_buf_init(&draw_buf, disp_draw_buf1, disp_draw_buf2, buf_size);
+#else
+#if LVGL_RENDER_MODE == RENDER_MODE_PARTIAL
+    // A band of lines is enough, LVGL renders large areas in several passes
+    buf_size = TFT_WIDTH * PARTIAL_BUF_LINES;
+#endif
+
+    // Double buffers in PSRAM for smooth updates (cache-line aligned for GDMA)
+    disp_draw_buf1 = (lv_color_t *)psramBudget.alloc(PSRAM_FRAMEBUFFER, sizeof(lv_color_t) * buf_size, 64);
+    disp_draw_buf2 = (lv_color_t *)psramBudget.alloc(PSRAM_FRAMEBUFFER, sizeof(lv_color_t) * buf_size, 64);
 
     if (!disp_draw_buf1 || !disp_draw_buf2) {
         Serial.println("Failed to allocate display buffers in PSRAM!");
@@ -179,6 +578,7 @@ void setupLVGL() {
 
     // Initialize double buffering
     lv_disp_draw_buf_init(&draw_buf, disp_draw_buf1, disp_draw_buf2, buf_size);
+#endif
 
     // Setup display driver
     lv_disp_drv_init(&disp_drv);
@@ -186,8 +586,22 @@ void setupLVGL() {
     disp_drv.ver_res = TFT_HEIGHT;
     disp_drv.flush_cb = my_disp_flush;
     disp_drv.draw_buf = &draw_buf;
+#if LVGL_RENDER_MODE == RENDER_MODE_DIRECT
+    disp_drv.direct_mode = 1;   // Draw in place, flush only invalidated areas
+#elif LVGL_RENDER_MODE == RENDER_MODE_FULL
     disp_drv.full_refresh = 1;  // Always send full frame to reduce tearing
-    lv_disp_drv_register(&disp_drv);
+#endif
+#if PANEL_BAND_RENDER
+    // Large blends split between this core and a worker on core 0
+    bandRenderer.begin();
+    disp_drv.draw_ctx_init = BandRenderer::initDrawCtx;
+#endif
+    lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+
+    // Image cache sizing and hit counters (see img_cache_stats.h)
+    imageCacheStats.begin(disp);
+
+    lv_timer_set_cb(_lv_disp_get_refr_timer(disp), refr_timer);
 
     Serial.println("LVGL initialized");
 }
@@ -208,68 +622,89 @@ void setupTouch() {
     indev_drv.read_cb = my_touchpad_read;
     touch_indev = lv_indev_drv_register(&indev_drv);
 
+    // Sampled from its own task into an event queue (see touch_input.h)
+    touchInput.begin(touch_indev, TOUCH_INT, readTouchPanel);
+
     Serial.println("Touch controller initialized");
 }
 
-void setupWiFi() {
-    Serial.println("Setting up WiFi...");
-
-    // Try to load saved credentials
-    wifi_prefs.begin("wifi", false);
-    String ssid = wifi_prefs.getString("ssid", "");
-    String password = wifi_prefs.getString("password", "");
-    wifi_prefs.end();
-
-    // If no saved credentials, try default from secrets.h
-#if HAS_DEFAULT_WIFI
-    if (ssid.length() == 0) {
-        Serial.println("No saved credentials, using defaults from secrets.h");
-        ssid = WIFI_SSID;
-        password = WIFI_PASSWORD;
-    }
-#endif
+// ============================================================================
+// NETWORK BRING-UP
+// ============================================================================
+// The UI is already on screen, built from the NVS copy of the config, by the
+// time the network starts. wifiLink connects and reconnects on its own (see
+// wifi_link.h); a one-shot task waits for the first link, starts mDNS and
+// fetches the server config, and a loop() job then applies whatever
+// changed, the same way a config refresh over the server channel does.
 
-    if (ssid.length() > 0) {
-        Serial.printf("Connecting to network: %s\n", ssid.c_str());
-        WiFi.begin(ssid.c_str(), password.c_str());
+static const uint32_t NET_BOOT_STACK_SIZE = 8192;     // HTTPClient plus config parse
+static const uint32_t NET_BOOT_POLL_MS = 100;
+static int8_t bootConfigJob = -1;
 
-        // Wait for connection with timeout
-        int attempts = 0;
-        while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-            delay(500);
-            Serial.print(".");
-            attempts++;
-        }
-        Serial.println();
+// Try to fetch config from server on boot
+static bool tryFetchServerConfig() {
+    const String& reportingUrl = configManager.getConfig().server.reportingUrl;
+    Serial.printf("Attempting to fetch config from server: %s\n", reportingUrl.c_str());
 
-        if (WiFi.status() == WL_CONNECTED) {
-            Serial.printf("Connected! IP: %s\n", WiFi.localIP().toString().c_str());
-            return;
-        }
+    if (configManager.fetchConfigFromServer()) {
+        Serial.println("Config fetched from server successfully");
+        return true;
     }
+    Serial.println("Failed to fetch config from server, using local config");
+    return false;
+}
 
-    // No saved credentials or connection failed - start AP mode for configuration
-    Serial.println("Starting AP mode for WiFi configuration...");
-    WiFi.mode(WIFI_AP);
-    WiFi.softAP("ESP32-Display", "configure");
-    Serial.printf("AP started. Connect to 'ESP32-Display' and visit http://%s\n",
-                  WiFi.softAPIP().toString().c_str());
+// Scheduler job, posted by the boot task once the network is up: bring the
+// schedules and the UI in line with the fetched config and the new address
+// (a reconcile, not a full rebuild, unless the layout changed)
+static void onBootConfigFetched(void* arg) {
+    brightnessScheduler.refresh();
+    themeScheduler.refresh();
+    uiManager.requestRebuild();
 }
 
-// Try to fetch config from server on boot
-void tryFetchServerConfig() {
-    if (WiFi.status() != WL_CONNECTED) {
-        Serial.println("WiFi not connected, skipping server config fetch");
-        return;
+static void networkBootTask(void* parameter) {
+    // Configuration AP or not, the link keeps retrying; wait for it
+    int64_t stageStart = esp_timer_get_time();
+    while (!wifiLink.isConnected()) {
+        vTaskDelay(pdMS_TO_TICKS(NET_BOOT_POLL_MS));
     }
+    bootProfile.record(BOOT_STAGE_WIFI_CONNECT, stageStart);
 
-    const String& reportingUrl = configManager.getConfig().server.reportingUrl;
-    Serial.printf("Attempting to fetch config from server: %s\n", reportingUrl.c_str());
+    // Start mDNS for device discovery
+    stageStart = esp_timer_get_time();
+    if (mdnsService.begin(configManager.getDeviceId())) {
+        mdnsService.advertiseService();
+    }
+    bootProfile.record(BOOT_STAGE_MDNS, stageStart);
 
-    if (configManager.fetchConfigFromServer()) {
-        Serial.println("Config fetched from server successfully");
-    } else {
-        Serial.println("Failed to fetch config from server, using local config");
+    // Try to fetch config from server (may update config)
+    stageStart = esp_timer_get_time();
+    bool synced = tryFetchServerConfig();
+    bootProfile.record(BOOT_STAGE_CONFIG_FETCH, stageStart);
+    eventScheduler.post(bootConfigJob);
+
+    // The server is known to be reachable: hand it the previous boot's crash
+    if (synced) {
+        deviceController.uploadCrashReport();
+    }
+
+    // Hash the running image here rather than in the first /api/info
+    otaStream.runningSha256();
+
+    vTaskDelete(nullptr);
+}
+
+static void startNetwork() {
+    bootConfigJob = eventScheduler.add("boot_config", onBootConfigFetched, nullptr);
+    mdnsService.addJobs();
+    wifiLink.begin();
+    if (!wifiLink.hasCredentials()) return;
+
+    // Low priority on core 1 like the HTTP worker; core 0 is WiFi's
+    if (xTaskCreatePinnedToCore(networkBootTask, "NetBoot", NET_BOOT_STACK_SIZE,
+                                nullptr, 1, nullptr, 1) != pdPASS) {
+        Serial.println("Failed to create network boot task!");
     }
 }
 
@@ -278,12 +713,31 @@ void tryFetchServerConfig() {
 // ============================================================================
 
 void setup() {
+    // Stage timings for /api/diag/boot, from here to the web server
+    bootProfile.begin();
+
     Serial.begin(115200);
     delay(100);
     Serial.println("\n\n========================================");
     Serial.println("ESP32 Display Controller Starting...");
     Serial.println("========================================\n");
 
+    // LOG_* lines queue for a drain task from here on instead of blocking on the UART
+    panelLog.begin();
+
+    // Modules register their loop() jobs as they start
+    eventScheduler.begin();
+
+    // Reset reason and core dump from the previous boot, before the heap
+    // monitor's first sample overwrites the last one it took
+    crashReport.begin();
+
+    // Large PSRAM buffers go through the budget from here on
+    psramBudget.begin();
+
+    // Fixed pools for the run-time buffers (static memory build only)
+    staticMemory.begin();
+
     // Check PSRAM
     if (psramFound()) {
         Serial.printf("PSRAM found: %d bytes (%d MB)\n",
@@ -291,49 +745,82 @@ void setup() {
     } else {
         Serial.println("WARNING: PSRAM not found!");
     }
+    bootProfile.mark(BOOT_STAGE_EARLY);
+
+    // Map the uploaded icon pack before the config resolves its icon names
+    iconPack.begin();
+
+    // Load the NVS-cached configuration first: the UI is built from it
+    // straight away, the server copy is applied as a diff once it arrives
+    configManager.begin();
 
-    // Initialize screenshot storage
-    initScreenshot();
+    // Button states from before a software restart, newer than the NVS copy
+    warmState.restore();
+    bootProfile.mark(BOOT_STAGE_CONFIG);
 
     // Setup display hardware
     setupDisplay();
+    // Timing found by an earlier calibration, if any
+    panelTuner.begin(currentPanelTiming(), retimePanel, panelScanoutHealth);
+    bootProfile.mark(BOOT_STAGE_DISPLAY);
 
     // Initialize LVGL
     setupLVGL();
+    bootProfile.mark(BOOT_STAGE_LVGL);
 
     // Initialize touch
     setupTouch();
-
-    // Setup WiFi
-    setupWiFi();
-
-    // Initialize configuration manager (loads from NVS)
-    configManager.begin();
+    bootProfile.mark(BOOT_STAGE_TOUCH);
 
     // Initialize theme engine
     themeEngine.begin();
+    bootProfile.mark(BOOT_STAGE_THEME);
 
     // Initialize UI manager (sets up PWM backlight)
     uiManager.begin();
-
-    // Try to fetch config from server (may update config)
-    tryFetchServerConfig();
+    warmState.restoreDisplay();
+    bootProfile.mark(BOOT_STAGE_UI_BEGIN);
 
     // Create the UI based on config
     uiManager.createUI();
+    bootProfile.mark(BOOT_STAGE_CREATE_UI);
 
     // Force initial render
     lv_timer_handler();
+    bootProfile.mark(BOOT_STAGE_FIRST_RENDER);
+
+    // Hand LVGL over to its own render task - from here on, UI access
+    // outside that task must hold lvglTask.lock()
+    lvglTask.setScanoutControl(setPanelScanout);
+    setScreenshotFrameReader(readPanelFrame);
+#if PANEL_VSYNC_PACING
+    if (disp_draw_buf2) {
+        lvglTask.setFramePacing(panelFrameCount, notifyPanelFrame);
+        uint32_t periodUs = bus->getFramePeriodUs();
+        Serial.printf("Refresh paced to scanout: %lu us per frame (%lu.%lu Hz)\n", periodUs,
+                      100000000UL / periodUs / 100, 100000000UL / periodUs / 10 % 10);
+    }
+#endif
+    lvglTask.begin();
+    bootProfile.mark(BOOT_STAGE_LVGL_TASK);
+    Serial.printf("UI ready in %lu ms\n", millis());
+
+    // WiFi connects, mDNS starts and the server config is fetched in the
+    // background; none of it holds up the rest of setup()
+    startNetwork();
+    bootProfile.mark(BOOT_STAGE_NETWORK);
 
     // Initialize device controller (registers UI callbacks)
     deviceController.begin();
 
-    // Start mDNS for device discovery
-    if (WiFi.status() == WL_CONNECTED) {
-        if (mdnsService.begin(configManager.getDeviceId())) {
-            mdnsService.advertiseService();
-        }
-    }
+    // Server state multicast, joined once WiFi and the config allow
+    stateMulticast.begin();
+
+    // Presses mirrored to and from panels nearby over ESP-NOW, when configured
+    peerMirror.begin();
+
+    // WiFi scans for the web UI, run in the background
+    wifiScanner.begin();
 
     // Initialize time manager for NTP sync
     timeManager.begin();
@@ -341,50 +828,68 @@ void setup() {
     // Initialize brightness scheduler
     brightnessScheduler.begin();
 
+    // Adaptive brightness: light sensor on the touch I2C bus, or server readings
+    ambientLight.begin(Wire);
+
     // Initialize theme scheduler (auto day/night theme switching)
     themeScheduler.begin();
 
+    // Heap/PSRAM fragmentation history (baseline after boot allocations)
+    heapMonitor.begin();
+
+    // Per-task CPU and stack high-water marks
+    taskMonitor.begin();
+
+    // Loop and LVGL task stalls with backtraces (setup() runs in the loop task)
+    stallMonitor.attach(STALL_LOOP);
+    stallMonitor.begin();
+
+    // Snapshot of the shown state for the next software restart
+    warmState.begin();
+    bootProfile.mark(BOOT_STAGE_SERVICES);
+
     // Start web server
     webServer.begin();
+    bootProfile.mark(BOOT_STAGE_WEB_SERVER);
+    bootProfile.printSummary();
+    psramBudget.printPlan();
 
     Serial.println("\n========================================");
     Serial.println("System Ready!");
     Serial.printf("Device ID:     %s\n", configManager.getDeviceId().c_str());
     Serial.printf("Theme:         %s\n", configManager.getConfig().display.theme.c_str());
-    Serial.printf("Web interface: http://%s\n",
-                  WiFi.status() == WL_CONNECTED ?
-                  WiFi.localIP().toString().c_str() :
-                  WiFi.softAPIP().toString().c_str());
+    Serial.println("Web interface: http://<ip>/ (address once WiFi is up)");
     Serial.println("OTA updates:   http://<ip>/update");
     Serial.println("Screenshot:    POST /api/screenshot/capture");
+    Serial.println("Live view:     WS /api/screen/stream");
     Serial.println("Config API:    GET/POST /api/config");
+    Serial.println("Light level:   POST /api/ambient");
+    Serial.println("Latency:       GET /api/perf/latency");
+    Serial.println("Heap history:  GET /api/diag/heap");
+    Serial.println("Task stats:    GET /api/diag/tasks");
+    Serial.println("Loop jobs:     GET /api/diag/scheduler");
+    Serial.println("Stalls:        GET /api/diag/stalls");
+    Serial.println("Metrics:       GET /metrics");
+    Serial.println("Boot profile:  GET /api/diag/boot");
+    Serial.println("PSRAM plan:    GET /api/diag/psram");
+    Serial.println("Image cache:   GET /api/diag/img_cache");
+    Serial.println("UI tree:       GET /api/diag/ui_tree");
+    Serial.println("UI benchmark:  POST /api/bench");
+    Serial.println("Panel timing:  POST /api/display/calibrate");
     Serial.println("========================================\n");
-}
-
-void loop() {
-    // Update LVGL tick
-    unsigned long now = millis();
-    lv_tick_inc(now - last_tick);
-    last_tick = now;
-
-    // Handle LVGL tasks
-    lv_timer_handler();
 
-    // Check for pending UI rebuild (from web server callbacks)
-    uiManager.update();
-
-    // Device controller periodic tasks (server connectivity check)
-    deviceController.update();
-
-    // Update time manager (NTP sync)
-    timeManager.update();
-
-    // Update brightness scheduler
-    brightnessScheduler.update();
+#if UI_BENCH_ON_BOOT
+    uiBenchmark.start(true);
+#endif
 
-    // Update theme scheduler (auto day/night theme switching)
-    themeScheduler.update();
+    // Steady state from here: heap allocations are counted (static memory build)
+    staticMemory.seal();
+}
 
-    // Small delay to prevent watchdog issues
-    delay(5);
+void loop() {
+    // LVGL rendering and deferred UI rebuilds run in lvglTask. Everything
+    // else here (server checks, NTP, brightness/theme schedules, fades,
+    // heap/task sampling, WebSocket housekeeping) is a scheduler job, and
+    // the loop task sleeps until the next one is due.
+    eventScheduler.run();
 }
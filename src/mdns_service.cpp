@@ -1,7 +1,10 @@
 #include "mdns_service.h"
 #include "config_manager.h"
+#include "device_controller.h"
+#include "event_scheduler.h"
 #include <ESPmDNS.h>
 #include <WiFi.h>
+#include <esp_random.h>
 
 // Global instance
 MDNSService mdnsService;
@@ -10,10 +13,33 @@ MDNSService mdnsService;
 const char* MDNSService::SERVICE_TYPE = "esp32display";
 const char* MDNSService::SERVICE_PROTOCOL = "tcp";
 
+// CI sets the build identifier with -DFIRMWARE_VERSION=\"...\"; local builds
+// fall back to the time this file was compiled
+#ifndef FIRMWARE_VERSION
+#define FIRMWARE_VERSION __DATE__ " " __TIME__
+#endif
+
+// TXT record layout; bump when keys change meaning
+static const char* TXT_VERSION = "2";
+
 MDNSService::MDNSService()
     : running(false)
+    , advertised(false)
     , hostname("")
+    , txtJob(-1)
+    , txtConfig(0)
+    , txtState(0)
 {
+    bootId[0] = '\0';
+}
+
+const char* MDNSService::getFirmwareVersion() {
+    return FIRMWARE_VERSION;
+}
+
+void MDNSService::addJobs() {
+    snprintf(bootId, sizeof(bootId), "%08lx", (unsigned long)esp_random());
+    txtJob = eventScheduler.add("mdns_txt", onTxtTimer, this);
 }
 
 bool MDNSService::begin(const String& deviceHostname) {
@@ -59,25 +85,68 @@ bool MDNSService::advertiseService() {
     MDNS.addService(SERVICE_TYPE, SERVICE_PROTOCOL, SERVICE_PORT);
 
     // Add TXT records with device information
-    const DeviceConfig& config = configManager.getConfig();
+    ConfigSnapshot snapshot;
+    const DeviceConfig& config = *snapshot;
 
     MDNS.addServiceTxt(SERVICE_TYPE, SERVICE_PROTOCOL, "id", config.device.id.c_str());
-    MDNS.addServiceTxt(SERVICE_TYPE, SERVICE_PROTOCOL, "name", config.device.name.c_str());
     MDNS.addServiceTxt(SERVICE_TYPE, SERVICE_PROTOCOL, "mac", WiFi.macAddress().c_str());
-    MDNS.addServiceTxt(SERVICE_TYPE, SERVICE_PROTOCOL, "version", "1");
+    MDNS.addServiceTxt(SERVICE_TYPE, SERVICE_PROTOCOL, "version", TXT_VERSION);
+    MDNS.addServiceTxt(SERVICE_TYPE, SERVICE_PROTOCOL, "fw", FIRMWARE_VERSION);
+    MDNS.addServiceTxt(SERVICE_TYPE, SERVICE_PROTOCOL, "boot", bootId);
+    updateTxt(true);
+    advertised = true;
 
     Serial.printf("mDNS: Advertising service _%s._%s on port %d\n",
                   SERVICE_TYPE, SERVICE_PROTOCOL, SERVICE_PORT);
-    Serial.printf("mDNS: TXT records - id=%s, name=%s, mac=%s\n",
+    Serial.printf("mDNS: TXT records - id=%s, name=%s, mac=%s, fw=%s, boot=%s\n",
                   config.device.id.c_str(),
-                  config.device.name.c_str(),
-                  WiFi.macAddress().c_str());
+                  txtName.c_str(),
+                  WiFi.macAddress().c_str(),
+                  FIRMWARE_VERSION, bootId);
 
+    eventScheduler.schedule(txtJob, TXT_REFRESH_MS);
     return true;
 }
 
+// ============================================================================
+// TXT refresh
+// ============================================================================
+
+void MDNSService::onTxtTimer(void* arg) {
+    MDNSService* self = (MDNSService*)arg;
+    if (!self->running || !self->advertised) return;
+
+    self->updateTxt(false);
+    eventScheduler.schedule(self->txtJob, TXT_REFRESH_MS);
+}
+
+void MDNSService::updateTxt(bool force) {
+    // Every rewrite is an announcement on the wire; only send what moved
+    ConfigSnapshot snapshot;
+    const DeviceConfig& config = *snapshot;
+    uint32_t generation = configManager.getGeneration();
+    uint32_t stateVersion = deviceController.getStateVersion();
+    char value[12];
+
+    if (force || config.device.name != txtName) {
+        txtName = config.device.name;
+        MDNS.addServiceTxt(SERVICE_TYPE, SERVICE_PROTOCOL, "name", txtName.c_str());
+    }
+    if (force || generation != txtConfig) {
+        txtConfig = generation;
+        snprintf(value, sizeof(value), "%lu", (unsigned long)generation);
+        MDNS.addServiceTxt(SERVICE_TYPE, SERVICE_PROTOCOL, "cfg", value);
+    }
+    if (force || stateVersion != txtState) {
+        txtState = stateVersion;
+        snprintf(value, sizeof(value), "%lu", (unsigned long)stateVersion);
+        MDNS.addServiceTxt(SERVICE_TYPE, SERVICE_PROTOCOL, "state", value);
+    }
+}
+
 void MDNSService::stop() {
     if (running) {
+        advertised = false;
         MDNS.end();
         running = false;
         Serial.println("mDNS: Service stopped");
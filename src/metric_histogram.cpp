@@ -0,0 +1,50 @@
+#include "metric_histogram.h"
+
+const uint32_t FRAME_BOUNDS_US[] = {
+    1000, 2000, 4000, 8000, 16000, 24000, 33000, 50000, 66000, 100000, 128000
+};
+const uint8_t FRAME_BOUND_COUNT = sizeof(FRAME_BOUNDS_US) / sizeof(FRAME_BOUNDS_US[0]);
+
+const uint32_t LATENCY_BOUNDS_US[] = {
+    10000, 25000, 50000, 100000, 150000, 250000, 500000, 1000000, 2000000, 5000000
+};
+const uint8_t LATENCY_BOUND_COUNT = sizeof(LATENCY_BOUNDS_US) / sizeof(LATENCY_BOUNDS_US[0]);
+
+MetricHistogram::MetricHistogram(const uint32_t* b, uint8_t n)
+    : bounds(b)
+    , boundCount(n < MAX_BOUNDS ? n : MAX_BOUNDS)
+    , sum(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+{
+    memset(buckets, 0, sizeof(buckets));
+}
+
+void MetricHistogram::observe(uint32_t value) {
+    uint8_t i = 0;
+    while (i < boundCount && value > bounds[i]) {
+        i++;
+    }
+
+    portENTER_CRITICAL_SAFE(&mux);
+    buckets[i]++;
+    sum += value;
+    portEXIT_CRITICAL_SAFE(&mux);
+}
+
+void MetricHistogram::write(Print& out, const char* name, const char* help, double scale) const {
+    uint32_t counts[MAX_BOUNDS + 1];
+    portENTER_CRITICAL(&mux);
+    memcpy(counts, buckets, sizeof(counts));
+    uint64_t total = sum;
+    portEXIT_CRITICAL(&mux);
+
+    out.printf("# HELP %s %s\n# TYPE %s histogram\n", name, help, name);
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < boundCount; i++) {
+        cumulative += counts[i];
+        out.printf("%s_bucket{le=\"%g\"} %u\n", name, bounds[i] * scale, cumulative);
+    }
+    cumulative += counts[boundCount];
+    out.printf("%s_bucket{le=\"+Inf\"} %u\n", name, cumulative);
+    out.printf("%s_sum %g\n%s_count %u\n", name, (double)total * scale, name, cumulative);
+}
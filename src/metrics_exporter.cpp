@@ -0,0 +1,130 @@
+#include "metrics_exporter.h"
+#include "config_manager.h"
+#include "device_controller.h"
+#include "ui_manager.h"
+#include "touch_input.h"
+#include "perf_monitor.h"
+#include "latency_trace.h"
+#include "wifi_link.h"
+#include "mdns_service.h"
+#include "lvgl_mem.h"
+#include "static_memory.h"
+#include <WiFi.h>
+#include <esp_heap_caps.h>
+#include <lvgl.h>
+
+static const double US_TO_S = 1e-6;
+
+static void writeHeader(Print& out, const char* name, const char* type, const char* help) {
+    out.printf("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+static void writeValue(Print& out, const char* name, const char* type, const char* help, uint32_t value) {
+    writeHeader(out, name, type, help);
+    out.printf("%s %u\n", name, value);
+}
+
+static void writeHeap(Print& out) {
+    static const uint32_t CAPS[] = { MALLOC_CAP_INTERNAL, MALLOC_CAP_SPIRAM };
+    static const char* const REGIONS[] = { "internal", "psram" };
+
+    writeHeader(out, "panel_heap_free_bytes", "gauge", "Free heap");
+    for (uint8_t i = 0; i < 2; i++) {
+        out.printf("panel_heap_free_bytes{region=\"%s\"} %u\n", REGIONS[i], heap_caps_get_free_size(CAPS[i]));
+    }
+    writeHeader(out, "panel_heap_largest_free_block_bytes", "gauge", "Largest allocatable block");
+    for (uint8_t i = 0; i < 2; i++) {
+        out.printf("panel_heap_largest_free_block_bytes{region=\"%s\"} %u\n", REGIONS[i],
+                   heap_caps_get_largest_free_block(CAPS[i]));
+    }
+    writeHeader(out, "panel_heap_min_free_bytes", "gauge", "Lowest free heap since boot");
+    for (uint8_t i = 0; i < 2; i++) {
+        out.printf("panel_heap_min_free_bytes{region=\"%s\"} %u\n", REGIONS[i],
+                   heap_caps_get_minimum_free_size(CAPS[i]));
+    }
+#if PANEL_STATIC_MEMORY
+    writeValue(out, "panel_heap_allocs_after_setup_total", "counter",
+               "Heap allocations since setup() ended", staticMemory.getHeapAllocsAfterSeal());
+#endif
+}
+
+static void writeLvglMem(Print& out) {
+#if !LVGL_MEM_BUILTIN
+    lvgl_mem_stats_t mem;
+    lvgl_mem_get_stats(&mem);
+    writeHeader(out, "panel_lvgl_mem_used_bytes", "gauge", "Bytes LVGL holds");
+    out.printf("panel_lvgl_mem_used_bytes{pool=\"internal\"} %u\n", mem.internalUsed);
+    out.printf("panel_lvgl_mem_used_bytes{pool=\"psram\"} %u\n", mem.psramUsed);
+    writeValue(out, "panel_lvgl_mem_psram_arena_bytes", "gauge", "Size of LVGL's PSRAM arena", mem.psramArenaSize);
+    writeValue(out, "panel_lvgl_mem_largest_free_bytes", "gauge", "Largest block left in LVGL's PSRAM arena",
+               mem.psramLargestFree);
+    writeValue(out, "panel_lvgl_mem_failures_total", "counter", "LVGL allocations that failed", mem.failures);
+#else
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    writeHeader(out, "panel_lvgl_mem_used_bytes", "gauge", "Bytes LVGL holds");
+    out.printf("panel_lvgl_mem_used_bytes{pool=\"builtin\"} %u\n", mon.total_size - mon.free_size);
+    writeValue(out, "panel_lvgl_mem_largest_free_bytes", "gauge", "Largest block left in LVGL's pool",
+               mon.free_biggest_size);
+#endif
+}
+
+void writeMetrics(Print& out) {
+    writeHeader(out, "panel_info", "gauge", "Device and firmware");
+    out.printf("panel_info{device=\"%s\",firmware=\"%s\"} 1\n",
+               configManager.getDeviceId().c_str(), MDNSService::getFirmwareVersion());
+    writeValue(out, "panel_uptime_seconds", "gauge", "Seconds since boot", millis() / 1000);
+
+    // Rendering
+    writeValue(out, "panel_frames_total", "counter", "Frames rendered", perfMonitor.getFrames());
+    perfMonitor.getHistogram(PERF_FRAME_US)->write(out, "panel_frame_seconds",
+        "Whole refresh, render and flush", US_TO_S);
+    perfMonitor.getHistogram(PERF_RENDER_US)->write(out, "panel_render_seconds",
+        "Refresh minus flush", US_TO_S);
+    perfMonitor.getHistogram(PERF_FLUSH_US)->write(out, "panel_flush_seconds",
+        "Flush of a frame to the panel", US_TO_S);
+
+    // Touch to result
+    latencyTrace.getActionHistogram().write(out, "panel_touch_to_action_seconds",
+        "Tap to the card showing its new state", US_TO_S);
+    latencyTrace.getPhotonHistogram().write(out, "panel_touch_to_photon_seconds",
+        "Tap to the new state on glass", US_TO_S);
+    latencyTrace.getResponseHistogram().write(out, "panel_touch_to_response_seconds",
+        "Tap to the server answering its action", US_TO_S);
+    writeValue(out, "panel_latency_traces_total", "counter", "Taps traced", latencyTrace.getTraces());
+    writeValue(out, "panel_latency_traces_incomplete_total", "counter", "Traces that timed out",
+               latencyTrace.getIncomplete());
+
+    // Actions to the server
+    writeHeader(out, "panel_action_batches_total", "counter", "Action batches sent, by outcome");
+    out.printf("panel_action_batches_total{result=\"delivered\"} %u\n", deviceController.getBatchesDelivered());
+    out.printf("panel_action_batches_total{result=\"failed\"} %u\n", deviceController.getBatchesFailed());
+    deviceController.getBatchLatency().write(out, "panel_action_batch_seconds",
+        "Time to send an action batch", US_TO_S);
+    writeValue(out, "panel_action_rollbacks_total", "counter", "Presses undone because the server refused them",
+               deviceController.getActionRollbacks());
+    writeValue(out, "panel_action_journal_dropped_total", "counter", "Offline actions pushed out by newer ones",
+               deviceController.getJournalDropped());
+
+    // Queues
+    writeValue(out, "panel_ui_commands_dropped_total", "counter", "UI commands lost to a full queue",
+               uiManager.getCommandsDropped());
+    writeValue(out, "panel_touch_events_dropped_total", "counter", "Touch presses or releases dropped",
+               touchInput.getDropped());
+    writeValue(out, "panel_touch_events_merged_total", "counter", "Touch moves merged while LVGL was behind",
+               touchInput.getMerged());
+
+    // Memory
+    writeHeap(out);
+    writeLvglMem(out);
+
+    // WiFi
+    bool connected = WiFi.status() == WL_CONNECTED;
+    writeValue(out, "panel_wifi_connected", "gauge", "1 while associated", connected ? 1 : 0);
+    if (connected) {
+        writeHeader(out, "panel_wifi_rssi_dbm", "gauge", "Signal strength of the AP");
+        out.printf("panel_wifi_rssi_dbm %d\n", WiFi.RSSI());
+    }
+    writeValue(out, "panel_wifi_reconnects_total", "counter", "Reconnects after a lost link",
+               wifiLink.getReconnects());
+}
@@ -0,0 +1,163 @@
+#include "ota_delta.h"
+#include "psram_budget.h"
+
+static const uint8_t PATCH_MAGIC[4] = {'E', 'S', 'P', 'D'};
+
+struct OtaDelta::Workspace {
+    uint8_t source[SOURCE_CHUNK];
+    uint8_t out[OUT_CHUNK];
+};
+
+static uint32_t readU32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+OtaDelta::OtaDelta()
+    : work(nullptr)
+    , in(nullptr)
+    , inLeft(0)
+    , sink(nullptr)
+    , sinkCtx(nullptr)
+    , outFill(0)
+{
+}
+
+OtaDelta::~OtaDelta() {
+    psramBudget.release(PSRAM_OTA, work, sizeof(Workspace));
+}
+
+bool OtaDelta::isPatch(const uint8_t* data, size_t len) {
+    return len >= sizeof(PATCH_MAGIC) && memcmp(data, PATCH_MAGIC, sizeof(PATCH_MAGIC)) == 0;
+}
+
+bool OtaDelta::parseHeader(const uint8_t* data, size_t len, Header& out, const char*& error) {
+    if (len < HEADER_SIZE || !isPatch(data, len)) {
+        error = "not a delta patch";
+        return false;
+    }
+    if (data[4] != VERSION) {
+        error = "unsupported patch version";
+        return false;
+    }
+    out.sourceSize = readU32(data + 8);
+    out.targetSize = readU32(data + 12);
+    memcpy(out.sourceSha256, data + 16, 32);
+    memcpy(out.targetSha256, data + 48, 32);
+    if (out.sourceSize == 0 || out.targetSize == 0) {
+        error = "empty source or target in patch";
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Apply
+// ============================================================================
+
+bool OtaDelta::apply(const uint8_t* patch, size_t len, const esp_partition_t* source,
+                     SinkFn sinkFn, void* ctx, const char*& error) {
+    Header header;
+    if (!parseHeader(patch, len, header, error)) return false;
+    if (header.sourceSize > source->size) {
+        error = "patch source is larger than the running slot";
+        return false;
+    }
+
+    if (!work) {
+        work = (Workspace*)psramBudget.alloc(PSRAM_OTA, sizeof(Workspace));
+    }
+    if (!work || !inflater.begin(true)) {
+        error = "not enough PSRAM for the patch workspace";
+        return false;
+    }
+    in = patch + HEADER_SIZE;
+    inLeft = len - HEADER_SIZE;
+    sink = sinkFn;
+    sinkCtx = ctx;
+    outFill = 0;
+
+    size_t produced = 0;
+    int64_t sourcePos = 0;
+
+    while (produced < header.targetSize) {
+        uint8_t control[12];
+        if (!read(control, sizeof(control))) {
+            error = "patch body is corrupt or short";
+            return false;
+        }
+        uint32_t addLen = readU32(control);
+        uint32_t extraLen = readU32(control + 4);
+        int32_t seek = (int32_t)readU32(control + 8);
+        uint64_t recordLen = (uint64_t)addLen + extraLen;
+
+        if (produced + recordLen > header.targetSize ||
+            sourcePos < 0 || sourcePos + addLen > header.sourceSize) {
+            error = "patch record out of range";
+            return false;
+        }
+
+        // Source bytes plus the patch's differences
+        while (addLen > 0) {
+            size_t n = addLen;
+            if (n > SOURCE_CHUNK) n = SOURCE_CHUNK;
+            if (n > OUT_CHUNK - outFill) n = OUT_CHUNK - outFill;
+
+            if (esp_partition_read(source, (size_t)sourcePos, work->source, n) != ESP_OK) {
+                error = "reading the running slot failed";
+                return false;
+            }
+            uint8_t* dst = work->out + outFill;
+            if (!read(dst, n)) {
+                error = "patch body is corrupt or short";
+                return false;
+            }
+            for (size_t i = 0; i < n; i++) {
+                dst[i] += work->source[i];
+            }
+
+            outFill += n;
+            sourcePos += n;
+            addLen -= n;
+            if (outFill == OUT_CHUNK && !flush()) {
+                error = "writing the new image failed";
+                return false;
+            }
+        }
+
+        // New bytes as they are
+        while (extraLen > 0) {
+            size_t n = extraLen;
+            if (n > OUT_CHUNK - outFill) n = OUT_CHUNK - outFill;
+            if (!read(work->out + outFill, n)) {
+                error = "patch body is corrupt or short";
+                return false;
+            }
+            outFill += n;
+            extraLen -= n;
+            if (outFill == OUT_CHUNK && !flush()) {
+                error = "writing the new image failed";
+                return false;
+            }
+        }
+
+        produced += recordLen;
+        sourcePos += seek;
+    }
+
+    if (outFill > 0 && !flush()) {
+        error = "writing the new image failed";
+        return false;
+    }
+    return true;
+}
+
+bool OtaDelta::flush() {
+    bool ok = sink(sinkCtx, work->out, outFill);
+    outFill = 0;
+    return ok;
+}
+
+bool OtaDelta::read(uint8_t* dst, size_t n) {
+    // The whole body is in memory: anything short is a truncated patch
+    return inflater.read(in, inLeft, false, dst, n) == (int)n;
+}
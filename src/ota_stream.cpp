@@ -0,0 +1,515 @@
+#include "ota_stream.h"
+#include "ui_manager.h"
+#include "lvgl_task.h"
+#include "wifi_link.h"
+#include "ota_delta.h"
+#include "stream_inflater.h"
+#include "psram_budget.h"
+#include <ArduinoJson.h>
+#include <esp_ota_ops.h>
+
+// Global instance
+OtaStream otaStream;
+
+static const size_t FLASH_SECTOR_SIZE = 4096;
+static const size_t GZIP_HEADER_WAIT = 512;     // Enough for the header with a file name
+static const size_t GZIP_TRAILER_SIZE = 8;      // CRC32, ISIZE
+
+OtaStream::OtaStream()
+    : mux(portMUX_INITIALIZER_UNLOCKED)
+    , state(State::IDLE)
+    , error(nullptr)
+    , staging(nullptr)
+    , size(0)
+    , received(0)
+    , written(0)
+    , aborted(false)
+    , writer(nullptr)
+    , startedAt(0)
+    , eraseMs(0)
+    , receiveMs(0)
+    , totalMs(0)
+    , lastPercent(-1)
+    , targetSize(0)
+    , declaredImageSize(0)
+    , format("image")
+    , otaHandle(0)
+    , runningHashed(false)
+{
+    expectedMd5[0] = '\0';
+}
+
+bool OtaStream::begin(size_t uploadSize, size_t imageSize, const char* md5Hex, const char*& reason, int& status) {
+    if (isBusy()) {
+        reason = "update already running";
+        status = 409;
+        return false;
+    }
+
+    const esp_partition_t* partition = esp_ota_get_next_update_partition(nullptr);
+    if (!partition) {
+        reason = "no OTA partition";
+        status = 500;
+        return false;
+    }
+    if (uploadSize == 0 || uploadSize > partition->size || imageSize > partition->size) {
+        reason = "image size does not fit the OTA partition";
+        status = 400;
+        return false;
+    }
+    if (md5Hex && strlen(md5Hex) != 32) {
+        reason = "md5 must be 32 hex digits";
+        status = 400;
+        return false;
+    }
+
+    // The whole upload, so receiving never waits for flash; without room
+    // the client falls back to /update
+    staging = (uint8_t*)psramBudget.alloc(PSRAM_OTA, uploadSize);
+    if (!staging) {
+        reason = "not enough PSRAM to stage the image";
+        status = 507;
+        return false;
+    }
+
+    size = uploadSize;
+    received = 0;
+    written = 0;
+    targetSize = imageSize ? imageSize : uploadSize;
+    declaredImageSize = imageSize;
+    format = "image";
+    aborted = false;
+    error = nullptr;
+    eraseMs = receiveMs = totalMs = 0;
+    lastPercent = -1;
+    strlcpy(expectedMd5, md5Hex ? md5Hex : "", sizeof(expectedMd5));
+    startedAt = millis();
+    state = State::RECEIVING;
+
+    if (xTaskCreatePinnedToCore(writerTask, "OTAWrite", WRITER_STACK_SIZE, this,
+                                WRITER_PRIORITY, &writer, WRITER_CORE) != pdPASS) {
+        psramBudget.release(PSRAM_OTA, staging, uploadSize);
+        staging = nullptr;
+        state = State::FAILED;
+        error = "failed to start the writer task";
+        reason = error;
+        status = 500;
+        return false;
+    }
+
+    Serial.printf("OtaStream: Receiving %u bytes into PSRAM for %s\n", (unsigned)size, partition->label);
+    enterUpdateMode();
+    return true;
+}
+
+void OtaStream::feed(const uint8_t* data, size_t len) {
+    // A segment is at most an MSS, a few microseconds to copy
+    portENTER_CRITICAL(&mux);
+    bool taken = staging != nullptr && isBusy();
+    if (taken) {
+        size_t at = received;
+        if (len > size - at) len = size - at;
+        memcpy(staging + at, data, len);
+        received = at + len;
+    }
+    portEXIT_CRITICAL(&mux);
+    if (!taken) return;
+
+    if (received == size) {
+        receiveMs = millis() - startedAt;
+    }
+    xTaskNotifyGive(writer);
+}
+
+void OtaStream::abortUpload() {
+    if (!isBusy() || received == size) return;
+    aborted = true;
+    xTaskNotifyGive(writer);
+}
+
+const char* OtaStream::stateName() const {
+    switch (state) {
+        case State::IDLE:      return "idle";
+        case State::RECEIVING: return "receiving";
+        case State::WRITING:   return "writing";
+        case State::DONE:      return "done";
+        case State::FAILED:    return "failed";
+    }
+    return "unknown";
+}
+
+void OtaStream::writeJson(Print& out) const {
+    StaticJsonDocument<384> doc;
+    doc["state"] = stateName();
+    doc["size"] = size;
+    doc["received"] = received;
+    doc["format"] = format;
+    doc["target_size"] = targetSize;
+    doc["written"] = written;
+    doc["erase_ms"] = eraseMs;
+    doc["receive_ms"] = receiveMs;
+    doc["total_ms"] = totalMs;
+    if (error) {
+        doc["error"] = error;
+    }
+    serializeJson(doc, out);
+}
+
+// ============================================================================
+// Update mode
+// ============================================================================
+
+void OtaStream::enterUpdateMode() {
+    wifiLink.setBoost(true);
+    lvglTask.setUpdateMode(true);
+
+    LVGLLock lvglLock;
+    uiManager.showOTAScreen();
+}
+
+void OtaStream::leaveUpdateMode() {
+    {
+        LVGLLock lvglLock;
+        uiManager.hideOTAScreen();
+    }
+    lvglTask.setUpdateMode(false);
+    wifiLink.setBoost(false);
+}
+
+void OtaStream::reportProgress(size_t done) {
+    int percent = (int)((uint64_t)done * 100 / targetSize);
+    if (percent == lastPercent) return;
+    lastPercent = percent;
+
+    // Only the bar and its label are invalidated; the render task picks
+    // them up on its next slow pass
+    LVGLLock lvglLock;
+    uiManager.updateOTAProgress(percent);
+}
+
+// ============================================================================
+// Writer task
+// ============================================================================
+
+void OtaStream::writerTask(void* parameter) {
+    OtaStream* self = (OtaStream*)parameter;
+    self->run();
+    self->writer = nullptr;
+    vTaskDelete(nullptr);
+}
+
+void OtaStream::run() {
+    // The first bytes tell an image from a delta patch
+    size_t probe = size < OtaDelta::HEADER_SIZE ? size : OtaDelta::HEADER_SIZE;
+    const char* reason = waitFor(probe);
+    if (reason) {
+        fail(reason);
+        return;
+    }
+
+    if (OtaDelta::isPatch(staging, received)) {
+        runPatch();
+    } else if (staging[0] == 0x1f && received > 1 && staging[1] == 0x8b) {
+        runCompressed();
+    } else {
+        runImage();
+    }
+}
+
+const char* OtaStream::waitFor(size_t bytes) {
+    unsigned long lastDataAt = millis();
+    size_t lastReceived = received;
+
+    while (received < bytes) {
+        if (aborted) return "upload aborted";
+        size_t available = received;
+        if (available != lastReceived) {
+            lastReceived = available;
+            lastDataAt = millis();
+        } else if (millis() - lastDataAt >= STALL_TIMEOUT_MS) {
+            return "upload stalled";
+        }
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+    }
+    return nullptr;
+}
+
+bool OtaStream::beginFlash(size_t imageSize) {
+    const esp_partition_t* partition = esp_ota_get_next_update_partition(nullptr);
+    targetSize = imageSize;
+    md5.begin();
+
+    // A known size erases the range in one go, 64 KB blocks where aligned,
+    // instead of sector by sector between writes
+    unsigned long eraseStart = millis();
+    esp_err_t err = esp_ota_begin(partition, imageSize, &otaHandle);
+    eraseMs = millis() - eraseStart;
+    if (err != ESP_OK) {
+        Serial.printf("OtaStream: esp_ota_begin failed: %s\n", esp_err_to_name(err));
+        fail("erase failed");
+        return false;
+    }
+    Serial.printf("OtaStream: Erased %u bytes in %lu ms\n", (unsigned)imageSize, (unsigned long)eraseMs);
+    state = State::WRITING;
+    return true;
+}
+
+bool OtaStream::writeFlash(const uint8_t* data, size_t len) {
+    esp_err_t err = esp_ota_write(otaHandle, data, len);
+    if (err != ESP_OK) {
+        Serial.printf("OtaStream: esp_ota_write failed at %u: %s\n", (unsigned)written, esp_err_to_name(err));
+        return false;
+    }
+    md5.add((uint8_t*)data, len);
+    written += len;
+    reportProgress(written);
+    return true;
+}
+
+bool OtaStream::onPatchOutput(void* ctx, const uint8_t* data, size_t len) {
+    return ((OtaStream*)ctx)->writeFlash(data, len);
+}
+
+bool OtaStream::endFlash(const uint8_t* expectedSha256) {
+    const esp_partition_t* partition = esp_ota_get_next_update_partition(nullptr);
+
+    md5.calculate();
+    if (expectedMd5[0] && strcasecmp(md5.toString().c_str(), expectedMd5) != 0) {
+        esp_ota_abort(otaHandle);
+        fail("md5 mismatch");
+        return false;
+    }
+
+    // Checks the image header and its SHA-256 before it can be booted
+    esp_err_t err = esp_ota_end(otaHandle);
+    if (err != ESP_OK) {
+        Serial.printf("OtaStream: Image rejected: %s\n", esp_err_to_name(err));
+        fail("image validation failed");
+        return false;
+    }
+
+    // A patched image must also be exactly the one the patch was built for
+    if (expectedSha256) {
+        uint8_t sha[32];
+        if (esp_partition_get_sha256(partition, sha) != ESP_OK || memcmp(sha, expectedSha256, sizeof(sha)) != 0) {
+            fail("patched image hash mismatch");
+            return false;
+        }
+    }
+
+    err = esp_ota_set_boot_partition(partition);
+    if (err != ESP_OK) {
+        Serial.printf("OtaStream: Setting the boot slot failed: %s\n", esp_err_to_name(err));
+        fail("image validation failed");
+        return false;
+    }
+    return true;
+}
+
+void OtaStream::runImage() {
+    if (!beginFlash(size)) return;
+
+    while (written < size) {
+        size_t available = received;
+        size_t pending = available - written;
+
+        // Whole chunks while more is coming; the tail once it has all arrived
+        size_t chunk = 0;
+        if (pending >= WRITE_CHUNK) {
+            chunk = WRITE_CHUNK;
+        } else if (available == size) {
+            chunk = pending;
+        } else if (pending >= FLASH_SECTOR_SIZE) {
+            chunk = pending - pending % FLASH_SECTOR_SIZE;
+        }
+
+        if (chunk == 0) {
+            size_t sector = written + FLASH_SECTOR_SIZE;
+            const char* reason = waitFor(sector < size ? sector : size);
+            if (reason) {
+                esp_ota_abort(otaHandle);
+                fail(reason);
+                return;
+            }
+            continue;
+        }
+
+        if (!writeFlash(staging + written, chunk)) {
+            esp_ota_abort(otaHandle);
+            fail("flash write failed");
+            return;
+        }
+    }
+
+    if (endFlash(nullptr)) {
+        finish();
+    }
+}
+
+void OtaStream::runCompressed() {
+    format = "gzip";
+    if (declaredImageSize == 0) {
+        // Erasing without a size would mean the whole 4 MB slot
+        fail("compressed uploads need ?size= (the uncompressed image size)");
+        return;
+    }
+
+    const char* reason = waitFor(size < GZIP_HEADER_WAIT ? size : GZIP_HEADER_WAIT);
+    size_t headerSize = StreamInflater::gzipHeaderSize(staging, received);
+    if (reason || headerSize == 0 || size < headerSize + GZIP_TRAILER_SIZE) {
+        fail(reason ? reason : "malformed gzip header");
+        return;
+    }
+
+    StreamInflater inflater;
+    uint8_t* out = (uint8_t*)psramBudget.alloc(PSRAM_OTA, WRITE_CHUNK);
+    if (!out || !inflater.begin(false)) {
+        psramBudget.release(PSRAM_OTA, out, WRITE_CHUNK);
+        fail("not enough PSRAM to decompress");
+        return;
+    }
+    if (!beginFlash(declaredImageSize)) {
+        psramBudget.release(PSRAM_OTA, out, WRITE_CHUNK);
+        return;
+    }
+
+    // Decompress as the upload arrives; the trailer isn't deflate input
+    size_t bodyEnd = size - GZIP_TRAILER_SIZE;
+    size_t consumed = headerSize;
+    size_t outFill = 0;
+    reason = nullptr;
+
+    while (!inflater.isDone()) {
+        size_t available = received < bodyEnd ? received : bodyEnd;
+        const uint8_t* in = staging + consumed;
+        size_t inLeft = available - consumed;
+        bool moreInput = available < bodyEnd;
+
+        int got = inflater.read(in, inLeft, moreInput, out + outFill, WRITE_CHUNK - outFill);
+        if (got < 0) {
+            reason = "corrupt gzip stream";
+            break;
+        }
+        consumed = in - staging;
+        outFill += got;
+        if (written + outFill > declaredImageSize) {
+            reason = "image is larger than ?size=";
+            break;
+        }
+
+        // Whole chunks only, apart from the tail
+        if (outFill == WRITE_CHUNK || (inflater.isDone() && outFill > 0)) {
+            if (!writeFlash(out, outFill)) {
+                reason = "flash write failed";
+                break;
+            }
+            outFill = 0;
+        } else if (got == 0 && moreInput) {
+            reason = waitFor(received + 1);
+            if (reason) break;
+        }
+    }
+    psramBudget.release(PSRAM_OTA, out, WRITE_CHUNK);
+
+    if (!reason && written != declaredImageSize) {
+        reason = "image is smaller than ?size=";
+    }
+    if (!reason) {
+        // gzip's ISIZE: the uncompressed length mod 2^32
+        const uint8_t* trailer = staging + bodyEnd;
+        waitFor(size);
+        uint32_t isize = trailer[4] | (trailer[5] << 8) | (trailer[6] << 16) | ((uint32_t)trailer[7] << 24);
+        if (received < size || isize != written) {
+            reason = "gzip trailer does not match the image";
+        }
+    }
+    if (reason) {
+        esp_ota_abort(otaHandle);
+        fail(reason);
+        return;
+    }
+
+    if (endFlash(nullptr)) {
+        finish();
+    }
+}
+
+void OtaStream::runPatch() {
+    // Patches are small; apply once the whole one is here
+    const char* reason = waitFor(size);
+    if (reason) {
+        fail(reason);
+        return;
+    }
+    format = "delta";
+
+    OtaDelta::Header header;
+    if (!OtaDelta::parseHeader(staging, size, header, reason)) {
+        fail(reason);
+        return;
+    }
+
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    const esp_partition_t* partition = esp_ota_get_next_update_partition(nullptr);
+    if (memcmp(header.sourceSha256, runningSha256(), 32) != 0) {
+        fail("patch was built for a different running image");
+        return;
+    }
+    if (header.targetSize > partition->size) {
+        fail("patched image does not fit the OTA partition");
+        return;
+    }
+    Serial.printf("OtaStream: Applying a %u byte patch for a %u byte image from %s\n",
+                  (unsigned)size, (unsigned)header.targetSize, running->label);
+
+    if (!beginFlash(header.targetSize)) return;
+
+    OtaDelta patcher;
+    if (!patcher.apply(staging, size, running, onPatchOutput, this, reason) || written != header.targetSize) {
+        esp_ota_abort(otaHandle);
+        fail(reason ? reason : "patch produced the wrong size");
+        return;
+    }
+
+    if (endFlash(header.targetSha256)) {
+        finish();
+    }
+}
+
+const uint8_t* OtaStream::runningSha256() {
+    if (!runningHashed) {
+        // Verifies the whole running image once, tens of ms
+        if (esp_partition_get_sha256(esp_ota_get_running_partition(), runningHash) != ESP_OK) {
+            memset(runningHash, 0, sizeof(runningHash));
+        }
+        runningHashed = true;
+    }
+    return runningHash;
+}
+
+void OtaStream::releaseStaging(State outcome) {
+    portENTER_CRITICAL(&mux);
+    uint8_t* buffer = staging;
+    staging = nullptr;
+    state = outcome;
+    portEXIT_CRITICAL(&mux);
+    psramBudget.release(PSRAM_OTA, buffer, size);
+}
+
+void OtaStream::fail(const char* reason) {
+    error = reason;
+    totalMs = millis() - startedAt;
+    releaseStaging(State::FAILED);
+    Serial.printf("OtaStream: Update failed: %s\n", reason);
+    leaveUpdateMode();
+}
+
+void OtaStream::finish() {
+    totalMs = millis() - startedAt;
+    releaseStaging(State::DONE);
+    Serial.printf("OtaStream: %u bytes written in %lu ms (erase %lu ms, receive %lu ms), rebooting\n",
+                  (unsigned)written, (unsigned long)totalMs, (unsigned long)eraseMs, (unsigned long)receiveMs);
+
+    vTaskDelay(pdMS_TO_TICKS(REBOOT_DELAY_MS));
+    ESP.restart();
+}
@@ -0,0 +1,185 @@
+#include "packed_image.h"
+#include "psram_budget.h"
+#include <esp_heap_caps.h>
+
+// Global instance
+PackedImageCache packedImages;
+
+PackedImageCache::PackedImageCache()
+    : bytes(0)
+    , unpacks(0)
+    , failures(0)
+{
+    memset(entries, 0, sizeof(entries));
+}
+
+PackedImageCache::Entry* PackedImageCache::find(const void* src) {
+    for (int i = 0; i < MAX_ENTRIES; i++) {
+        if (entries[i].dsc.data && src == &entries[i].dsc) return &entries[i];
+    }
+    return nullptr;
+}
+
+PackedImageCache::Entry* PackedImageCache::load(const PackedImage& image) {
+    Entry* slot = nullptr;
+    for (int i = 0; i < MAX_ENTRIES; i++) {
+        Entry& e = entries[i];
+        if (e.dsc.data && e.image == &image) {
+            return &e;
+        }
+        if (!e.dsc.data && !slot) slot = &e;
+    }
+
+    // Make room from copies nothing shows
+    for (int i = 0; i < MAX_ENTRIES && !slot; i++) {
+        if (entries[i].refs == 0) {
+            drop(entries[i]);
+            slot = &entries[i];
+        }
+    }
+    if (!slot || !unpack(image, *slot)) {
+        failures++;
+        return nullptr;
+    }
+    return slot;
+}
+
+bool PackedImageCache::show(lv_obj_t* img, const PackedImage& image) {
+    Entry* entry = load(image);
+    if (!entry) {
+        lv_img_set_src(img, nullptr);
+        return false;
+    }
+
+    Entry* old = find(lv_img_get_src(img));
+    if (old == entry) return true;
+    if (old && old->refs > 0) {
+        old->refs--;
+    } else {
+        lv_obj_add_event_cb(img, onImageDeleted, LV_EVENT_DELETE, nullptr);
+    }
+    entry->refs++;
+    lv_img_set_src(img, &entry->dsc);
+    return true;
+}
+
+const lv_img_dsc_t* PackedImageCache::acquire(lv_obj_t* owner, const PackedImage& image) {
+    Entry* entry = load(image);
+    if (!entry) return nullptr;
+
+    entry->refs++;
+    lv_obj_add_event_cb(owner, onOwnerDeleted, LV_EVENT_DELETE, entry);
+    return &entry->dsc;
+}
+
+bool PackedImageCache::unpack(const PackedImage& image, Entry& entry) {
+    size_t pixels = (size_t)image.width * image.height;
+    uint8_t pxSize = image.hasAlpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    size_t size = pixels * pxSize;
+
+    // PSRAM by preference; the images are small enough for the heap when the
+    // budget is short on headroom, and a missing frame piece looks broken
+    bool inPsram = true;
+    uint8_t* data = (uint8_t*)psramBudget.alloc(PSRAM_PACKED_IMAGE, size);
+    if (!data) {
+        inPsram = false;
+        data = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_8BIT);
+        if (!data) return false;
+    }
+
+    uint8_t* out = data;
+    size_t filled = 0;
+    bool ok = true;
+    for (uint32_t i = 0; i + 1 < image.runsSize && ok; i += 2) {
+        uint8_t index = image.runs[i];
+        size_t count = (size_t)image.runs[i + 1] + 1;
+        if (index >= image.paletteSize || filled + count > pixels) {
+            ok = false;
+            break;
+        }
+        uint16_t color = image.palette[index];
+        uint8_t lo = color & 0xff;
+        uint8_t hi = color >> 8;
+        uint8_t a = image.hasAlpha ? image.alpha[index] : LV_OPA_COVER;
+        for (size_t n = 0; n < count; n++) {
+            out[0] = lo;
+            out[1] = hi;
+            if (image.hasAlpha) out[2] = a;
+            out += pxSize;
+        }
+        filled += count;
+    }
+
+    if (!ok || filled != pixels) {
+        Serial.printf("PackedImage: Malformed %ux%u image (%u of %u pixels)\n",
+                      image.width, image.height, (unsigned)filled, (unsigned)pixels);
+        if (inPsram) {
+            psramBudget.release(PSRAM_PACKED_IMAGE, data, size);
+        } else {
+            heap_caps_free(data);
+        }
+        return false;
+    }
+
+    entry.image = &image;
+    entry.refs = 0;
+    entry.inPsram = inPsram;
+    entry.dsc.header.cf = image.hasAlpha ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+    entry.dsc.header.always_zero = 0;
+    entry.dsc.header.reserved = 0;
+    entry.dsc.header.w = image.width;
+    entry.dsc.header.h = image.height;
+    entry.dsc.data_size = size;
+    entry.dsc.data = data;
+    bytes += size;
+    unpacks++;
+    return true;
+}
+
+void PackedImageCache::drop(Entry& entry) {
+    if (!entry.dsc.data) return;
+    // LVGL's image cache knows descriptors by address, and the slot is reused
+    lv_img_cache_invalidate_src(&entry.dsc);
+    if (entry.inPsram) {
+        psramBudget.release(PSRAM_PACKED_IMAGE, (void*)entry.dsc.data, entry.dsc.data_size);
+    } else {
+        heap_caps_free((void*)entry.dsc.data);
+    }
+    bytes -= entry.dsc.data_size;
+    memset(&entry, 0, sizeof(entry));
+}
+
+void PackedImageCache::onImageDeleted(lv_event_t* e) {
+    Entry* entry = packedImages.find(lv_img_get_src(lv_event_get_target(e)));
+    if (entry && entry->refs > 0) {
+        entry->refs--;
+    }
+}
+
+void PackedImageCache::onOwnerDeleted(lv_event_t* e) {
+    Entry* entry = (Entry*)lv_event_get_user_data(e);
+    if (entry->refs > 0) {
+        entry->refs--;
+    }
+}
+
+void PackedImageCache::trim() {
+    for (int i = 0; i < MAX_ENTRIES; i++) {
+        if (entries[i].dsc.data && entries[i].refs == 0) {
+            drop(entries[i]);
+        }
+    }
+}
+
+void PackedImageCache::writeJson(Print& out) const {
+    int count = 0;
+    int inUse = 0;
+    for (int i = 0; i < MAX_ENTRIES; i++) {
+        if (entries[i].dsc.data) {
+            count++;
+            if (entries[i].refs) inUse++;
+        }
+    }
+    out.printf("{\"entries\":%d,\"in_use\":%d,\"bytes\":%u,\"unpacks\":%u,\"failures\":%u}",
+               count, inUse, (unsigned)bytes, unpacks, failures);
+}
@@ -0,0 +1,208 @@
+#include "panel_log.h"
+#include <esp_heap_caps.h>
+
+// Global instance
+PanelLog panelLog;
+
+static const char LEVEL_LETTERS[] = "-EWID";
+
+PanelLog::PanelLog()
+    : slots(nullptr)
+    , enqueuePos(0)
+    , dequeuePos(0)
+    , dropped(0)
+    , droppedReported(0)
+    , history(nullptr)
+    , lastSeq(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , drainHandle(nullptr)
+{
+    for (uint32_t i = 0; i < RING_SLOTS; i++) {
+        slotSeq[i].store(i, std::memory_order_relaxed);
+    }
+}
+
+void PanelLog::begin() {
+    size_t historyBytes = HISTORY_LINES * sizeof(Line);
+    history = (Line*)heap_caps_malloc(historyBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (history) {
+        memset(history, 0, historyBytes);
+    } else {
+        Serial.println("PanelLog: Failed to allocate history, /api/logs stays empty");
+    }
+
+    size_t ringBytes = RING_SLOTS * sizeof(Line);
+    Line* ring = (Line*)heap_caps_malloc(ringBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!ring) {
+        ring = (Line*)malloc(ringBytes);
+    }
+    if (!ring) {
+        Serial.println("PanelLog: Failed to allocate ring, logging synchronously");
+        return;
+    }
+
+    // Just above idle: the UART may block it, never anyone logging
+    if (xTaskCreatePinnedToCore(drainTask, "LogDrain", 3072, this,
+                                tskIDLE_PRIORITY + 1, &drainHandle, 0) != pdPASS) {
+        free(ring);
+        Serial.println("PanelLog: Failed to create drain task, logging synchronously");
+        return;
+    }
+
+    // Lines queue from here on
+    slots = ring;
+}
+
+// ============================================================================
+// Producers
+// ============================================================================
+
+void PanelLog::write(uint8_t level, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+
+    if (!slots) {
+        // Before begin() (or without a ring): straight out, as Serial did
+        char text[LINE_SIZE];
+        vsnprintf(text, sizeof(text), fmt, args);
+        va_end(args);
+        Serial.println(text);
+        return;
+    }
+
+    // Claim the slot at the enqueue position: free while its sequence
+    // equals the position, still undrained from the last lap when lower
+    uint32_t pos = enqueuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        uint32_t seq = slotSeq[pos & (RING_SLOTS - 1)].load(std::memory_order_acquire);
+        int32_t diff = (int32_t)(seq - pos);
+        if (diff == 0) {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            va_end(args);
+            return;
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Formatted in place; the drain task skips the slot until it is published
+    Line& line = slots[pos & (RING_SLOTS - 1)];
+    line.ms = millis();
+    line.level = level;
+    vsnprintf(line.text, sizeof(line.text), fmt, args);
+    va_end(args);
+    slotSeq[pos & (RING_SLOTS - 1)].store(pos + 1, std::memory_order_release);
+}
+
+// ============================================================================
+// Drain
+// ============================================================================
+
+void PanelLog::drainTask(void* arg) {
+    PanelLog* self = (PanelLog*)arg;
+    for (;;) {
+        bool any = false;
+        while (self->drainOne()) {
+            any = true;
+        }
+
+        uint32_t lost = self->dropped.load(std::memory_order_relaxed);
+        if (lost != self->droppedReported) {
+            Line line;
+            line.ms = millis();
+            line.level = PANEL_LOG_WARN;
+            snprintf(line.text, sizeof(line.text), "PanelLog: %u lines dropped",
+                     (unsigned)(lost - self->droppedReported));
+            self->droppedReported = lost;
+            self->emit(line);
+            any = true;
+        }
+
+        if (!any) {
+            vTaskDelay(pdMS_TO_TICKS(DRAIN_IDLE_MS));
+        }
+    }
+}
+
+bool PanelLog::drainOne() {
+    uint32_t pos = dequeuePos;
+    std::atomic<uint32_t>& seq = slotSeq[pos & (RING_SLOTS - 1)];
+    if (seq.load(std::memory_order_acquire) != pos + 1) {
+        return false;
+    }
+
+    // Copy out and free the slot before the UART gets a chance to block
+    Line line = slots[pos & (RING_SLOTS - 1)];
+    seq.store(pos + RING_SLOTS, std::memory_order_release);
+    dequeuePos = pos + 1;
+
+    emit(line);
+    return true;
+}
+
+void PanelLog::emit(const Line& line) {
+    Serial.println(line.text);
+
+    if (!history) return;
+    portENTER_CRITICAL(&mux);
+    uint32_t seq = lastSeq + 1;
+    Line& kept = history[seq % HISTORY_LINES];
+    kept = line;
+    kept.seq = seq;
+    lastSeq = seq;
+    portEXIT_CRITICAL(&mux);
+}
+
+// ============================================================================
+// History
+// ============================================================================
+
+static void writeEscaped(Print& out, const char* text) {
+    for (const char* p = text; *p; p++) {
+        char c = *p;
+        if (c == '"' || c == '\\') {
+            out.write('\\');
+            out.write(c);
+        } else if ((uint8_t)c < 0x20) {
+            out.printf("\\u%04x", (unsigned)c);
+        } else {
+            out.write(c);
+        }
+    }
+}
+
+void PanelLog::writeJson(Print& out, uint32_t since) const {
+    portENTER_CRITICAL(&mux);
+    uint32_t last = lastSeq;
+    portEXIT_CRITICAL(&mux);
+
+    // Lines older than the history holds are gone; a since past the last
+    // line means the panel restarted, and the reply's next starts over
+    uint32_t first = since + 1;
+    if (last > HISTORY_LINES && first <= last - HISTORY_LINES) {
+        first = last - HISTORY_LINES + 1;
+    }
+
+    out.print("{\"lines\":[");
+    bool any = false;
+    for (uint32_t seq = first; history && seq <= last; seq++) {
+        Line line;
+        portENTER_CRITICAL(&mux);
+        line = history[seq % HISTORY_LINES];
+        portEXIT_CRITICAL(&mux);
+        if (line.seq != seq) continue;  // Overwritten while we wrote
+
+        out.printf("%s{\"seq\":%u,\"ms\":%u,\"level\":\"%c\",\"text\":\"",
+                   any ? "," : "", (unsigned)seq, (unsigned)line.ms,
+                   LEVEL_LETTERS[line.level <= PANEL_LOG_DEBUG ? line.level : 0]);
+        writeEscaped(out, line.text);
+        out.print("\"}");
+        any = true;
+    }
+    out.printf("],\"next\":%u,\"dropped\":%u}", (unsigned)last,
+               (unsigned)dropped.load(std::memory_order_relaxed));
+}
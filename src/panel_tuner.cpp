@@ -0,0 +1,332 @@
+#include "panel_tuner.h"
+#include "lvgl_task.h"
+#include "psram_budget.h"
+#include "panel_log.h"
+#include <Preferences.h>
+#include <lvgl.h>
+
+// Global instance
+PanelTuner panelTuner;
+
+static const char* PREFS_NAMESPACE = "panel";
+static const char* PREFS_KEY = "timing";
+static const uint8_t LOAD_TASK_COUNT = 2;   // One per core
+
+// What NVS holds: the timing, and the build default it was tuned from
+struct SavedTiming {
+    uint32_t basePclkHz;
+    PanelTiming timing;
+};
+
+static const char* const STATE_NAMES[] = { "idle", "running", "done", "failed" };
+
+PanelTuner::PanelTuner()
+    : retimeFn(nullptr)
+    , healthFn(nullptr)
+    , saved(false)
+    , state(TUNER_IDLE)
+    , candidateCount(0)
+    , tested(0)
+    , chosen(-1)
+    , startedAt(0)
+    , durationMs(0)
+    , error(nullptr)
+    , loadBuffer(nullptr)
+    , loadRunning(false)
+    , loadTasks(0)
+    , loadMux(portMUX_INITIALIZER_UNLOCKED)
+{
+    memset(&defaults, 0, sizeof(defaults));
+    memset(&current, 0, sizeof(current));
+    memset(candidates, 0, sizeof(candidates));
+}
+
+void PanelTuner::begin(const PanelTiming& base, PanelRetimeFn retime, ScanoutHealthFn health) {
+    defaults = base;
+    current = base;
+    retimeFn = retime;
+    healthFn = health;
+
+    Preferences prefs;
+    prefs.begin(PREFS_NAMESPACE, true);
+    SavedTiming stored;
+    bool found = prefs.getBytesLength(PREFS_KEY) == sizeof(stored) &&
+                 prefs.getBytes(PREFS_KEY, &stored, sizeof(stored)) == sizeof(stored);
+    prefs.end();
+
+    if (!found) return;
+    if (stored.basePclkHz != defaults.pclkHz) {
+        LOG_I("PanelTuner: Saved timing is for a %u Hz build, keeping the defaults", stored.basePclkHz);
+        return;
+    }
+
+    PanelTiming timing = stored.timing;
+    if (apply(timing)) {
+        saved = true;
+        LOG_I("PanelTuner: Saved timing applied, PCLK %u Hz", current.pclkHz);
+    }
+}
+
+bool PanelTuner::apply(PanelTiming& timing) {
+    if (!retimeFn) return false;
+
+    // Not in the middle of a flush or a buffer swap
+    bool ok;
+    {
+        LVGLLock lock;
+        ok = retimeFn(timing);
+    }
+    if (ok) {
+        current = timing;
+    }
+    return ok;
+}
+
+uint32_t PanelTuner::framePeriodUs(const PanelTiming& t) {
+    uint64_t clocks = (uint64_t)(t.width + t.hsyncPulse + t.hsyncBack + t.hsyncFront) *
+                      (t.height + t.vsyncPulse + t.vsyncBack + t.vsyncFront);
+    return clocks * 1000000 / t.pclkHz;
+}
+
+bool PanelTuner::reset() {
+    if (state == TUNER_RUNNING) return false;
+
+    Preferences prefs;
+    prefs.begin(PREFS_NAMESPACE, false);
+    prefs.remove(PREFS_KEY);
+    prefs.end();
+
+    PanelTiming timing = defaults;
+    saved = false;
+    return apply(timing);
+}
+
+void PanelTuner::save(const PanelTiming& timing) {
+    SavedTiming stored;
+    stored.basePclkHz = defaults.pclkHz;
+    stored.timing = timing;
+
+    Preferences prefs;
+    prefs.begin(PREFS_NAMESPACE, false);
+    prefs.putBytes(PREFS_KEY, &stored, sizeof(stored));
+    prefs.end();
+    saved = true;
+}
+
+// ============================================================================
+// Calibration run
+// ============================================================================
+
+bool PanelTuner::start() {
+    if (state == TUNER_RUNNING || !retimeFn || !healthFn || !lvglTask.isRunning() ||
+        lvglTask.isDarkIdle()) {
+        return false;
+    }
+
+    // Fastest refresh first; the same clock with the wider porch is slower
+    candidateCount = 0;
+    for (uint32_t div = PCLK_SOURCE_HZ / MAX_PCLK_HZ; div <= PCLK_SOURCE_HZ / MIN_PCLK_HZ; div++) {
+        for (uint8_t wide = 0; wide < 2 && candidateCount < MAX_CANDIDATES; wide++) {
+            Candidate& c = candidates[candidateCount++];
+            memset(&c, 0, sizeof(c));
+            c.timing = defaults;
+            c.timing.pclkHz = PCLK_SOURCE_HZ / div;
+            if (wide) c.timing.hsyncBack += WIDE_HSYNC_BACK;
+        }
+    }
+
+    tested = 0;
+    chosen = -1;
+    error = nullptr;
+    durationMs = 0;
+    startedAt = millis();
+    state = TUNER_RUNNING;
+
+    // Below the render task, which has to keep redrawing
+    if (xTaskCreatePinnedToCore(tunerTask, "PanelTune", 4096, this, tskIDLE_PRIORITY + 1, nullptr, 0) != pdPASS) {
+        state = TUNER_FAILED;
+        error = "Task create failed";
+        return false;
+    }
+    return true;
+}
+
+void PanelTuner::tunerTask(void* parameter) {
+    PanelTuner* self = (PanelTuner*)parameter;
+    self->run();
+    vTaskDelete(nullptr);
+}
+
+void PanelTuner::run() {
+    PanelTiming before = current;
+    LOG_I("PanelTuner: Calibrating %u candidates", candidateCount);
+
+    if (!startLoad()) {
+        error = "No PSRAM for the load buffers";
+        durationMs = millis() - startedAt;
+        state = TUNER_FAILED;
+        return;
+    }
+
+    for (uint8_t i = 0; i < candidateCount; i++) {
+        Candidate& c = candidates[i];
+        measure(c, DWELL_MS);
+        tested = i + 1;
+        LOG_I("PanelTuner: %u Hz, HBP %u: %u frames, %u underruns, %u late",
+              c.timing.pclkHz, c.timing.hsyncBack, c.frames, c.underruns, c.late);
+    }
+
+    // Fastest refresh that passed, held longer before it is trusted
+    while (chosen < 0) {
+        int8_t best = -1;
+        for (uint8_t i = 0; i < candidateCount; i++) {
+            if (candidates[i].stable &&
+                (best < 0 || framePeriodUs(candidates[i].timing) < framePeriodUs(candidates[best].timing))) {
+                best = i;
+            }
+        }
+        if (best < 0) break;
+
+        Candidate confirm = candidates[best];
+        if (measure(confirm, CONFIRM_MS)) {
+            chosen = best;
+        } else {
+            candidates[best].stable = false;
+            LOG_W("PanelTuner: %u Hz failed confirmation", confirm.timing.pclkHz);
+        }
+    }
+    stopLoad();
+
+    if (chosen >= 0) {
+        PanelTiming timing = candidates[chosen].timing;
+        apply(timing);
+        save(timing);
+        LOG_I("PanelTuner: Saved PCLK %u Hz, HBP %u (%u us per frame)",
+              timing.pclkHz, timing.hsyncBack, framePeriodUs(timing));
+        state = TUNER_DONE;
+    } else {
+        apply(before);
+        error = "No candidate scanned out cleanly";
+        LOG_W("PanelTuner: %s, timing unchanged", error);
+        state = TUNER_FAILED;
+    }
+    durationMs = millis() - startedAt;
+}
+
+bool PanelTuner::measure(Candidate& c, uint32_t ms) {
+    PanelTiming timing = c.timing;
+    c.tested = true;
+    c.stable = false;
+    if (!apply(timing)) return false;
+    c.timing = timing;
+
+    vTaskDelay(pdMS_TO_TICKS(SETTLE_MS));
+    ScanoutHealth start = healthFn();
+
+    // Whole-screen redraws: render traffic on top of the load tasks
+    unsigned long until = millis() + ms;
+    while ((long)(millis() - until) < 0) {
+        {
+            LVGLLock lock;
+            lv_obj_invalidate(lv_scr_act());
+        }
+        lvglTask.wake();
+        vTaskDelay(pdMS_TO_TICKS(REDRAW_MS));
+    }
+
+    ScanoutHealth end = healthFn();
+    c.frames = end.frames - start.frames;
+    c.underruns = end.underruns - start.underruns;
+    c.late = end.late - start.late;
+    c.stable = c.frames > 0 && c.underruns == 0 && c.late == 0;
+    return c.stable;
+}
+
+bool PanelTuner::startLoad() {
+    if (!loadBuffer) {
+        loadBuffer = (uint8_t*)psramBudget.alloc(PSRAM_PANEL_TUNER, LOAD_TASK_COUNT * 2 * LOAD_BLOCK);
+        if (!loadBuffer) return false;
+    }
+
+    loadRunning = true;
+    loadTasks = 0;
+    for (uint8_t core = 0; core < LOAD_TASK_COUNT; core++) {
+        if (xTaskCreatePinnedToCore(loadTask, "PanelLoad", 2048, loadBuffer + core * 2 * LOAD_BLOCK,
+                                    tskIDLE_PRIORITY + 1, nullptr, core) == pdPASS) {
+            portENTER_CRITICAL(&loadMux);
+            loadTasks++;
+            portEXIT_CRITICAL(&loadMux);
+        }
+    }
+    return true;
+}
+
+void PanelTuner::stopLoad() {
+    loadRunning = false;
+    while (loadTasks > 0) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    psramBudget.release(PSRAM_PANEL_TUNER, loadBuffer, LOAD_TASK_COUNT * 2 * LOAD_BLOCK);
+    loadBuffer = nullptr;
+}
+
+void PanelTuner::loadTask(void* parameter) {
+    uint8_t* a = (uint8_t*)parameter;
+    uint8_t* b = a + LOAD_BLOCK;
+
+    // Copies through the cache in both directions, the access pattern of
+    // a render pass
+    while (panelTuner.loadRunning) {
+        memcpy(b, a, LOAD_BLOCK);
+        memcpy(a, b, LOAD_BLOCK);
+        taskYIELD();
+    }
+
+    portENTER_CRITICAL(&panelTuner.loadMux);
+    panelTuner.loadTasks--;
+    portEXIT_CRITICAL(&panelTuner.loadMux);
+    vTaskDelete(nullptr);
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+static void printTiming(Print& out, const PanelTiming& t) {
+    out.printf("{\"pclk_hz\":%u,\"hsync\":[%u,%u,%u],\"vsync\":[%u,%u,%u]}",
+               t.pclkHz, t.hsyncPulse, t.hsyncBack, t.hsyncFront,
+               t.vsyncPulse, t.vsyncBack, t.vsyncFront);
+}
+
+void PanelTuner::writeJson(Print& out) const {
+    TunerState s = state;
+    out.printf("{\"state\":\"%s\",\"saved\":%s,\"frame_us\":%u,\"timing\":",
+               STATE_NAMES[s], saved ? "true" : "false", framePeriodUs(current));
+    printTiming(out, current);
+    out.print(",\"defaults\":");
+    printTiming(out, defaults);
+
+    if (healthFn) {
+        ScanoutHealth h = healthFn();
+        out.printf(",\"scanout\":{\"frames\":%u,\"underruns\":%u,\"late\":%u}", h.frames, h.underruns, h.late);
+    }
+
+    unsigned long elapsed = s == TUNER_RUNNING ? millis() - startedAt : durationMs;
+    out.printf(",\"run\":{\"tested\":%u,\"candidates\":%u,\"elapsed_ms\":%lu,\"chosen\":%d",
+               tested, candidateCount, elapsed, chosen);
+    if (error) {
+        out.printf(",\"error\":\"%s\"", error);
+    }
+    out.print(",\"results\":[");
+    bool first = true;
+    for (uint8_t i = 0; i < candidateCount; i++) {
+        const Candidate& c = candidates[i];
+        if (!c.tested) continue;
+        out.printf("%s{\"pclk_hz\":%u,\"hsync_back\":%u,\"frame_us\":%u,\"frames\":%u,"
+                   "\"underruns\":%u,\"late\":%u,\"stable\":%s}",
+                   first ? "" : ",", c.timing.pclkHz, c.timing.hsyncBack, framePeriodUs(c.timing),
+                   c.frames, c.underruns, c.late, c.stable ? "true" : "false");
+        first = false;
+    }
+    out.print("]}}");
+}
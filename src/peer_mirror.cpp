@@ -0,0 +1,303 @@
+#include "peer_mirror.h"
+#include "device_controller.h"
+#include "server_channel.h"
+#include "event_scheduler.h"
+#include "panel_log.h"
+#include <WiFi.h>
+#include <esp_now.h>
+#include <esp_random.h>
+#include <mbedtls/md.h>
+
+// Global instance
+PeerMirror peerMirror;
+
+namespace {
+
+const uint8_t FRAME_VERSION = 1;
+const uint8_t NO_SPEED = 0xFF;
+const uint8_t BROADCAST[6] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+struct __attribute__((packed)) FrameHeader {
+    char magic[2];
+    uint8_t version;
+    uint8_t count;
+    uint32_t epoch;
+    uint32_t seq;
+};
+
+struct __attribute__((packed)) FrameEntry {
+    uint32_t bindingId;
+    uint8_t state;
+    uint8_t speedLevel;
+};
+
+}  // namespace
+
+PeerMirror::PeerMirror()
+    : outgoingCount(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , checkJob(-1)
+    , running(false)
+    , active()
+    , epoch(0)
+    , seq(0)
+    , reconcileDue(0)
+    , sent(0)
+    , sendErrors(0)
+    , received(0)
+    , applied(0)
+    , rejected(0)
+    , resyncs(0)
+{
+    memset(peers, 0, sizeof(peers));
+    memset(unreconciled, 0, sizeof(unreconciled));
+}
+
+void PeerMirror::begin() {
+    epoch = esp_random() | 1;
+    checkJob = eventScheduler.add("peer_mirror", onCheckTimer, this);
+    eventScheduler.schedule(checkJob, CHECK_INTERVAL);
+}
+
+void PeerMirror::onCheckTimer(void* arg) {
+    PeerMirror* self = (PeerMirror*)arg;
+    self->check();
+}
+
+void PeerMirror::check() {
+    ConfigSnapshot snapshot;
+    const PeerMirrorConfig& want = snapshot->network.peerMirror;
+    bool up = WiFi.status() == WL_CONNECTED;
+    bool changed = memcmp(want.key, active.key, sizeof(want.key)) != 0;
+    if (running && (!up || !want.enabled || changed)) {
+        stop();
+    }
+    if (!running && up && want.enabled) {
+        start(want);
+    }
+
+    // Mirrored states the server never confirmed: ask it for everything
+    unsigned long now = millis();
+    uint32_t next = CHECK_INTERVAL;
+    bool due = false;
+    portENTER_CRITICAL(&mux);
+    bool pending = false;
+    for (int i = 0; i < 8; i++) pending |= unreconciled[i] != 0;
+    if (pending) {
+        long remaining = (long)(reconcileDue - now);
+        if (remaining <= 0) {
+            due = true;
+            memset(unreconciled, 0, sizeof(unreconciled));
+        } else if ((unsigned long)remaining < next) {
+            next = remaining;
+        }
+    }
+    portEXIT_CRITICAL(&mux);
+
+    if (due) {
+        resyncs++;
+        LOG_I("PeerMirror: Mirrored state not confirmed by the server, asking for a full push");
+        serverChannel.send("{\"t\":\"resync\"}");
+    }
+    eventScheduler.schedule(checkJob, next);
+}
+
+bool PeerMirror::start(const PeerMirrorConfig& config) {
+    active = config;
+    if (esp_now_init() != ESP_OK) {
+        LOG_E("PeerMirror: ESP-NOW init failed");
+        return false;
+    }
+    esp_now_register_recv_cb(onReceive);
+
+    // Broadcast peer on the STA's channel
+    esp_now_peer_info_t peer;
+    memset(&peer, 0, sizeof(peer));
+    memcpy(peer.peer_addr, BROADCAST, sizeof(BROADCAST));
+    peer.channel = 0;
+    peer.ifidx = WIFI_IF_STA;
+    peer.encrypt = false;
+    if (esp_now_add_peer(&peer) != ESP_OK) {
+        LOG_E("PeerMirror: Failed to add broadcast peer");
+        esp_now_deinit();
+        return false;
+    }
+    memset(peers, 0, sizeof(peers));
+    running = true;
+    LOG_I("PeerMirror: Mirroring presses on channel %d", (int)WiFi.channel());
+    return true;
+}
+
+void PeerMirror::stop() {
+    running = false;
+    esp_now_unregister_recv_cb();
+    esp_now_deinit();
+    LOG_I("PeerMirror: Stopped");
+}
+
+// ============================================================================
+// Sending (any task)
+// ============================================================================
+
+void PeerMirror::mirror(uint8_t buttonId, bool state, int speedLevel) {
+    if (!running) return;
+    const ButtonConfig* btn = configManager.findButton(buttonId);
+    if (!btn || btn->bindingId == 0) return;
+
+    OutEntry entry = { btn->bindingId, (uint8_t)(state ? 1 : 0),
+                       (uint8_t)(speedLevel >= 0 ? speedLevel : NO_SPEED) };
+    portENTER_CRITICAL(&mux);
+    int i = 0;
+    while (i < outgoingCount && outgoing[i].bindingId != entry.bindingId) i++;
+    if (i < MAX_BUTTONS) {
+        outgoing[i] = entry;
+        if (i == outgoingCount) outgoingCount++;
+    }
+    portEXIT_CRITICAL(&mux);
+}
+
+void PeerMirror::flush() {
+    // Every entry of a full table fits one frame (MAX_BUTTONS * 6 + 20 < 250)
+    uint8_t frame[sizeof(FrameHeader) + MAX_BUTTONS * sizeof(FrameEntry) + TAG_SIZE];
+    FrameHeader h;
+    h.magic[0] = 'P';
+    h.magic[1] = 'M';
+    h.version = FRAME_VERSION;
+    h.epoch = epoch;
+
+    portENTER_CRITICAL(&mux);
+    h.count = outgoingCount;
+    for (uint8_t i = 0; i < outgoingCount; i++) {
+        FrameEntry e = { outgoing[i].bindingId, outgoing[i].state, outgoing[i].speedLevel };
+        memcpy(frame + sizeof(h) + i * sizeof(e), &e, sizeof(e));
+    }
+    outgoingCount = 0;
+    h.seq = h.count ? ++seq : seq;
+    portEXIT_CRITICAL(&mux);
+
+    if (h.count == 0 || !running) return;
+    memcpy(frame, &h, sizeof(h));
+    size_t len = sizeof(h) + h.count * sizeof(FrameEntry);
+    uint8_t mac[32];
+    if (mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), active.key, sizeof(active.key),
+                        frame, len, mac) != 0) {
+        sendErrors++;
+        return;
+    }
+    memcpy(frame + len, mac, TAG_SIZE);
+    len += TAG_SIZE;
+
+    if (esp_now_send(BROADCAST, frame, len) == ESP_OK) {
+        sent++;
+    } else {
+        sendErrors++;
+    }
+}
+
+void PeerMirror::noteServerState(uint8_t buttonId) {
+    uint32_t bit = 1UL << (buttonId & 31);
+    portENTER_CRITICAL(&mux);
+    unreconciled[buttonId >> 5] &= ~bit;
+    portEXIT_CRITICAL(&mux);
+}
+
+// ============================================================================
+// Receiving (WiFi task)
+// ============================================================================
+
+void PeerMirror::onReceive(const uint8_t* mac, const uint8_t* data, int len) {
+    if (len > 0) {
+        peerMirror.handleFrame(mac, data, len);
+    }
+}
+
+bool PeerMirror::verify(const uint8_t* data, size_t len) const {
+    uint8_t mac[32];
+    if (mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), active.key, sizeof(active.key),
+                        data, len - TAG_SIZE, mac) != 0) {
+        return false;
+    }
+    uint8_t diff = 0;
+    for (size_t i = 0; i < TAG_SIZE; i++) {
+        diff |= mac[i] ^ data[len - TAG_SIZE + i];
+    }
+    return diff == 0;
+}
+
+bool PeerMirror::isNewFromPeer(const uint8_t* mac, uint32_t frameEpoch, uint32_t frameSeq) {
+    Peer* slot = nullptr;
+    for (Peer& p : peers) {
+        if (memcmp(p.mac, mac, 6) == 0) {
+            slot = &p;
+            break;
+        }
+    }
+    if (slot && slot->epoch == frameEpoch && frameSeq <= slot->seq) {
+        return false;
+    }
+    if (!slot) {
+        // Unknown sender: take the slot heard from longest ago
+        slot = &peers[0];
+        for (Peer& p : peers) {
+            if (p.heard < slot->heard) slot = &p;
+        }
+        memcpy(slot->mac, mac, 6);
+    }
+    slot->epoch = frameEpoch;
+    slot->seq = frameSeq;
+    slot->heard = millis();
+    return true;
+}
+
+void PeerMirror::handleFrame(const uint8_t* mac, const uint8_t* data, size_t len) {
+    if (!running || len < sizeof(FrameHeader) + TAG_SIZE) {
+        rejected++;
+        return;
+    }
+    FrameHeader h;
+    memcpy(&h, data, sizeof(h));
+    if (h.magic[0] != 'P' || h.magic[1] != 'M' || h.version != FRAME_VERSION ||
+        len != sizeof(h) + h.count * sizeof(FrameEntry) + TAG_SIZE || !verify(data, len) ||
+        !isNewFromPeer(mac, h.epoch, h.seq)) {
+        rejected++;
+        return;
+    }
+    received++;
+
+    const uint8_t* p = data + sizeof(h);
+    bool changed = false;
+    for (uint8_t i = 0; i < h.count; i++, p += sizeof(FrameEntry)) {
+        FrameEntry e;
+        memcpy(&e, p, sizeof(e));
+        uint8_t ids[MAX_BUTTONS_PER_BINDING];
+        int n = configManager.findButtonsByBinding(e.bindingId, ids, MAX_BUTTONS_PER_BINDING);
+        for (int j = 0; j < n; j++) {
+            const ButtonConfig* btn = configManager.findButton(ids[j]);
+            bool fan = btn && btn->type == ButtonType::FAN && e.speedLevel != NO_SPEED;
+            if (!deviceController.applyPeerButton(ids[j], e.state != 0, fan ? e.speedLevel : -1)) continue;
+            applied++;
+            changed = true;
+            portENTER_CRITICAL(&mux);
+            unreconciled[ids[j] >> 5] |= 1UL << (ids[j] & 31);
+            portEXIT_CRITICAL(&mux);
+        }
+    }
+
+    if (changed) {
+        portENTER_CRITICAL(&mux);
+        reconcileDue = millis() + RECONCILE_MS;
+        portEXIT_CRITICAL(&mux);
+        eventScheduler.scheduleWithin(checkJob, RECONCILE_MS);
+    }
+}
+
+void PeerMirror::writeJson(Print& out) const {
+    int known = 0;
+    for (const Peer& p : peers) {
+        if (p.heard != 0) known++;
+    }
+    out.printf("{\"running\":%s,\"channel\":%d,\"peers\":%d,\"sent\":%u,\"send_errors\":%u,"
+               "\"received\":%u,\"applied\":%u,\"rejected\":%u,\"resyncs\":%u}",
+               running ? "true" : "false", running ? (int)WiFi.channel() : 0, known,
+               sent, sendErrors, received, applied, rejected, resyncs);
+}
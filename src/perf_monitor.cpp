@@ -0,0 +1,142 @@
+#include "perf_monitor.h"
+#include <ArduinoJson.h>
+#include <algorithm>
+
+// Global instance
+PerfMonitor perfMonitor;
+
+static const char* const METRIC_NAMES[PERF_METRIC_COUNT] = {
+    "render_us",
+    "flush_us",
+    "inv_area_px",
+    "timer_handler_us",
+    "loop_jitter_us",
+    "frame_us"
+};
+
+PerfMonitor::PerfMonitor()
+    : renderTimes(FRAME_BOUNDS_US, FRAME_BOUND_COUNT)
+    , flushTimes(FRAME_BOUNDS_US, FRAME_BOUND_COUNT)
+    , frameTimes(FRAME_BOUNDS_US, FRAME_BOUND_COUNT)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , frameFlushUs(0)
+    , frames(0)
+    , resetAt(0)
+{
+    memset(rings, 0, sizeof(rings));
+}
+
+void PerfMonitor::record(PerfMetric metric, uint32_t value) {
+    Ring& ring = rings[metric];
+    portENTER_CRITICAL(&mux);
+    ring.samples[ring.head] = value;
+    ring.head = (ring.head + 1) % RING_SIZE;
+    ring.count++;
+    portEXIT_CRITICAL(&mux);
+
+    MetricHistogram* histogram = histogramFor(metric);
+    if (histogram) {
+        histogram->observe(value);
+    }
+}
+
+MetricHistogram* PerfMonitor::histogramFor(PerfMetric metric) {
+    switch (metric) {
+        case PERF_RENDER_US: return &renderTimes;
+        case PERF_FLUSH_US:  return &flushTimes;
+        case PERF_FRAME_US:  return &frameTimes;
+        default:             return nullptr;
+    }
+}
+
+const MetricHistogram* PerfMonitor::getHistogram(PerfMetric metric) const {
+    return const_cast<PerfMonitor*>(this)->histogramFor(metric);
+}
+
+void PerfMonitor::reset() {
+    portENTER_CRITICAL(&mux);
+    memset(rings, 0, sizeof(rings));
+    frames = 0;
+    portEXIT_CRITICAL(&mux);
+    resetAt = millis();
+}
+
+const char* PerfMonitor::metricName(PerfMetric metric) {
+    return metric < PERF_METRIC_COUNT ? METRIC_NAMES[metric] : "unknown";
+}
+
+PerfSummary PerfMonitor::summarize(PerfMetric metric) const {
+    const Ring& ring = rings[metric];
+
+    // Copy out under the lock, sort outside it
+    uint32_t samples[RING_SIZE];
+    portENTER_CRITICAL(&mux);
+    uint32_t count = ring.count;
+    uint32_t n = ring.count < RING_SIZE ? ring.count : RING_SIZE;
+    memcpy(samples, ring.samples, n * sizeof(uint32_t));
+    portEXIT_CRITICAL(&mux);
+
+    return summarizeSamples(samples, n, count);
+}
+
+PerfSummary PerfMonitor::summarizeSamples(uint32_t* samples, uint32_t n, uint32_t count) {
+    PerfSummary summary = {};
+    summary.count = count;
+    summary.window = n;
+    if (n == 0) {
+        return summary;
+    }
+
+    std::sort(samples, samples + n);
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        total += samples[i];
+    }
+
+    // Nearest-rank percentiles
+    auto rank = [n](uint32_t pct) { return (n * pct + 99) / 100 - 1; };
+    summary.min = samples[0];
+    summary.p50 = samples[rank(50)];
+    summary.p95 = samples[rank(95)];
+    summary.p99 = samples[rank(99)];
+    summary.max = samples[n - 1];
+    summary.avg = total / n;
+    return summary;
+}
+
+size_t PerfMonitor::writeHeartbeat(char* buf, size_t len) const {
+    PerfSummary frame = summarize(PERF_FRAME_US);
+    PerfSummary render = summarize(PERF_RENDER_US);
+    PerfSummary jitter = summarize(PERF_LOOP_JITTER_US);
+    int n = snprintf(buf, len,
+        "{\"frames\":%u,\"frame_p50_us\":%u,\"frame_p95_us\":%u,\"render_p95_us\":%u,"
+        "\"jitter_p95_us\":%u}",
+        frames, frame.p50, frame.p95, render.p95, jitter.p95);
+    return (n > 0 && (size_t)n < len) ? n : 0;
+}
+
+String PerfMonitor::toJson() const {
+    StaticJsonDocument<1792> doc;
+    doc["uptime_ms"] = millis();
+    doc["since_reset_ms"] = millis() - resetAt;
+    doc["frames"] = frames;
+    doc["ring_size"] = (uint32_t)RING_SIZE;
+
+    JsonObject metrics = doc.createNestedObject("metrics");
+    for (int i = 0; i < PERF_METRIC_COUNT; i++) {
+        PerfSummary s = summarize((PerfMetric)i);
+        JsonObject m = metrics.createNestedObject(METRIC_NAMES[i]);
+        m["count"] = s.count;
+        m["window"] = s.window;
+        m["min"] = s.min;
+        m["p50"] = s.p50;
+        m["p95"] = s.p95;
+        m["p99"] = s.p99;
+        m["max"] = s.max;
+        m["avg"] = s.avg;
+    }
+
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
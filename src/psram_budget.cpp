@@ -0,0 +1,188 @@
+#include "psram_budget.h"
+#include <esp_heap_caps.h>
+
+// Global instance
+PsramBudget psramBudget;
+
+static const uint32_t PSRAM_CAPS = MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+
+static const char* const CLIENT_NAMES[PSRAM_CLIENT_COUNT] = {
+    "framebuffer",
+    "lvgl_arena",
+    "ota",
+    "icon_pack",
+    "screenshot",
+    "screen_stream",
+    "ui_snapshot",
+    "icon_tint",
+    "packed_image",
+    "card_tile",
+    "background",
+    "panel_tuner",
+    "static_pools"
+};
+
+static const PsramPriority CLIENT_PRIORITIES[PSRAM_CLIENT_COUNT] = {
+    PsramPriority::FIXED,
+    PsramPriority::FIXED,
+    PsramPriority::TRANSIENT,
+    PsramPriority::TRANSIENT,
+    PsramPriority::OPTIONAL,
+    PsramPriority::OPTIONAL,
+    PsramPriority::OPTIONAL,
+    PsramPriority::OPTIONAL,
+    PsramPriority::OPTIONAL,
+    PsramPriority::OPTIONAL,
+    PsramPriority::OPTIONAL,
+    PsramPriority::OPTIONAL,
+    PsramPriority::FIXED
+};
+
+static const char* const PRIORITY_NAMES[] = { "fixed", "transient", "optional" };
+
+PsramBudget::PsramBudget()
+    : psramSize(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+{
+    memset(accounts, 0, sizeof(accounts));
+    memset(reclaimers, 0, sizeof(reclaimers));
+}
+
+void PsramBudget::begin() {
+    psramSize = heap_caps_get_free_size(PSRAM_CAPS);
+}
+
+PsramPriority PsramBudget::priority(PsramClient client) {
+    return client < PSRAM_CLIENT_COUNT ? CLIENT_PRIORITIES[client] : PsramPriority::OPTIONAL;
+}
+
+const char* PsramBudget::clientName(PsramClient client) {
+    return client < PSRAM_CLIENT_COUNT ? CLIENT_NAMES[client] : "unknown";
+}
+
+void PsramBudget::setReclaimer(PsramClient client, ReclaimFn fn) {
+    reclaimers[client] = fn;
+}
+
+PsramAccount PsramBudget::getAccount(PsramClient client) const {
+    portENTER_CRITICAL(&mux);
+    PsramAccount account = accounts[client];
+    portEXIT_CRITICAL(&mux);
+    return account;
+}
+
+// ============================================================================
+// Allocation
+// ============================================================================
+
+bool PsramBudget::hasHeadroom() const {
+    // No PSRAM figures (host build): nothing to plan against
+    if (psramSize == 0) return true;
+    return heap_caps_get_largest_free_block(PSRAM_CAPS) >= OPTIONAL_HEADROOM;
+}
+
+bool PsramBudget::reclaimBelow(PsramPriority prio) {
+    bool freed = false;
+    for (int i = 0; i < PSRAM_CLIENT_COUNT; i++) {
+        if (CLIENT_PRIORITIES[i] > prio && reclaimers[i]) {
+            // Outside the mux: reclaimers free through release()
+            if (reclaimers[i]()) {
+                freed = true;
+                portENTER_CRITICAL(&mux);
+                accounts[i].reclaimed++;
+                portEXIT_CRITICAL(&mux);
+            }
+        }
+    }
+    return freed;
+}
+
+void* PsramBudget::alloc(PsramClient client, size_t size, size_t align) {
+    PsramPriority prio = priority(client);
+
+    // Twice at most: once as things stand, once after lower-priority
+    // clients have let go of what they can
+    void* ptr = nullptr;
+    for (int attempt = 0; attempt < 2 && !ptr; attempt++) {
+        if (attempt == 1 && !reclaimBelow(prio)) break;
+
+        ptr = align ? heap_caps_aligned_alloc(align, size, PSRAM_CAPS)
+                    : heap_caps_malloc(size, PSRAM_CAPS);
+
+        // An optional buffer must leave room for the transient ones; the
+        // allocator decides which block it came from, so check after
+        if (ptr && prio == PsramPriority::OPTIONAL && !hasHeadroom()) {
+            heap_caps_free(ptr);
+            ptr = nullptr;
+        }
+    }
+
+    portENTER_CRITICAL(&mux);
+    PsramAccount& account = accounts[client];
+    if (ptr) {
+        account.current += size;
+        if (account.current > account.peak) account.peak = account.current;
+        account.allocs++;
+    } else {
+        account.refused++;
+    }
+    portEXIT_CRITICAL(&mux);
+
+    if (!ptr) {
+        Serial.printf("PsramBudget: Refused %u bytes for %s (largest free %u)\n",
+                      (unsigned)size, CLIENT_NAMES[client],
+                      (unsigned)heap_caps_get_largest_free_block(PSRAM_CAPS));
+    }
+    return ptr;
+}
+
+void PsramBudget::release(PsramClient client, void* ptr, size_t size) {
+    if (!ptr) return;
+    heap_caps_free(ptr);
+
+    portENTER_CRITICAL(&mux);
+    PsramAccount& account = accounts[client];
+    account.current = account.current > size ? account.current - size : 0;
+    portEXIT_CRITICAL(&mux);
+}
+
+void PsramBudget::noteExternal(PsramClient client, size_t size) {
+    portENTER_CRITICAL(&mux);
+    PsramAccount& account = accounts[client];
+    account.current += size;
+    if (account.current > account.peak) account.peak = account.current;
+    account.allocs++;
+    portEXIT_CRITICAL(&mux);
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+void PsramBudget::printPlan() const {
+    size_t freeBytes = heap_caps_get_free_size(PSRAM_CAPS);
+    size_t largest = heap_caps_get_largest_free_block(PSRAM_CAPS);
+    Serial.printf("PsramBudget: %u KB PSRAM, %u KB free (largest %u KB), %u KB kept for transient buffers\n",
+                  (unsigned)(psramSize / 1024), (unsigned)(freeBytes / 1024),
+                  (unsigned)(largest / 1024), (unsigned)(OPTIONAL_HEADROOM / 1024));
+    for (int i = 0; i < PSRAM_CLIENT_COUNT; i++) {
+        PsramAccount a = getAccount((PsramClient)i);
+        Serial.printf("PsramBudget:   %-13s %-9s %5u KB now, %5u KB peak\n",
+                      CLIENT_NAMES[i], PRIORITY_NAMES[(int)CLIENT_PRIORITIES[i]],
+                      (unsigned)(a.current / 1024), (unsigned)(a.peak / 1024));
+    }
+}
+
+void PsramBudget::writeJson(Print& out) const {
+    out.printf("{\"psram_size\":%u,\"free\":%u,\"largest_free\":%u,\"optional_headroom\":%u,\"clients\":{",
+               (unsigned)psramSize, (unsigned)heap_caps_get_free_size(PSRAM_CAPS),
+               (unsigned)heap_caps_get_largest_free_block(PSRAM_CAPS), (unsigned)OPTIONAL_HEADROOM);
+    for (int i = 0; i < PSRAM_CLIENT_COUNT; i++) {
+        PsramAccount a = getAccount((PsramClient)i);
+        out.printf("%s\"%s\":{\"priority\":\"%s\",\"current\":%u,\"peak\":%u,"
+                   "\"allocs\":%u,\"refused\":%u,\"reclaimed\":%u}",
+                   i ? "," : "", CLIENT_NAMES[i], PRIORITY_NAMES[(int)CLIENT_PRIORITIES[i]],
+                   (unsigned)a.current, (unsigned)a.peak, a.allocs, a.refused, a.reclaimed);
+    }
+    out.print("}}");
+}
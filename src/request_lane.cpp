@@ -0,0 +1,282 @@
+#include "request_lane.h"
+#include "config_manager.h"
+#include "ui_manager.h"
+#include "brightness_scheduler.h"
+#include "theme_scheduler.h"
+#include "screenshot.h"
+#include "icon_pack.h"
+#include "background_anim.h"
+
+// Global instance
+HeavyRequestLane heavyLane;
+
+static const char* const JOB_NAMES[JOB_COUNT] = {
+    "screenshot",
+    "apply_config",
+    "icon_pack",
+    "background"
+};
+
+// Order the worker drains pending jobs in: a config push is what someone is
+// waiting on, an icon pack is a short flash write, decoding a background
+// takes seconds
+static const HeavyJob JOB_ORDER[JOB_COUNT] = {
+    JOB_APPLY_CONFIG,
+    JOB_ICON_PACK,
+    JOB_SCREENSHOT,
+    JOB_BACKGROUND
+};
+
+HeavyRequestLane::HeavyRequestLane()
+    : workerHandle(nullptr)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , pendingMask(0)
+    , runningJob(JOB_COUNT)
+    , runningId(0)
+    , nextId(1)
+    , configBody(nullptr)
+    , configLength(0) {
+    memset(status, 0, sizeof(status));
+    memset(pendingId, 0, sizeof(pendingId));
+    memset(supersededId, 0, sizeof(supersededId));
+}
+
+void HeavyRequestLane::begin() {
+    // Below the AsyncTCP task so inline handlers always win the CPU
+    xTaskCreatePinnedToCore(
+        workerTask,
+        "HeavyLane",
+        6144,
+        this,
+        tskIDLE_PRIORITY + 1,
+        &workerHandle,
+        0
+    );
+}
+
+// ============================================================================
+// Submission and status
+// ============================================================================
+
+uint8_t HeavyRequestLane::inFlightLocked() const {
+    uint8_t count = runningJob != JOB_COUNT ? 1 : 0;
+    for (int i = 0; i < JOB_COUNT; i++) {
+        if (pendingMask & (1 << i)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+SubmitResult HeavyRequestLane::submit(HeavyJob job, char* body, size_t length, uint32_t* id) {
+    SubmitResult result;
+    char* discard = nullptr;
+    uint32_t jobId = 0;
+
+    portENTER_CRITICAL(&mux);
+    if (pendingMask & (1 << job)) {
+        if (job == JOB_APPLY_CONFIG) {
+            // Last write wins: the queued body is stale now, and so is its id
+            discard = configBody;
+            configBody = body;
+            configLength = length;
+            supersededId[job] = pendingId[job];
+            pendingId[job] = nextId++;
+        }
+        jobId = pendingId[job];
+        result = SUBMIT_COALESCED;
+    } else if (inFlightLocked() >= MAX_IN_FLIGHT) {
+        discard = body;
+        result = SUBMIT_BUSY;
+    } else {
+        pendingMask |= (1 << job);
+        if (job == JOB_APPLY_CONFIG) {
+            configBody = body;
+            configLength = length;
+        }
+        jobId = pendingId[job] = nextId++;
+        result = SUBMIT_QUEUED;
+    }
+    portEXIT_CRITICAL(&mux);
+
+    if (id) {
+        *id = jobId;
+    }
+
+    if (discard) {
+        free(discard);
+    }
+    if (result == SUBMIT_QUEUED && workerHandle) {
+        xTaskNotifyGive(workerHandle);
+    }
+    return result;
+}
+
+JobStatus HeavyRequestLane::getStatus(HeavyJob job) const {
+    portENTER_CRITICAL(&mux);
+    JobStatus copy = status[job];
+    // A job can be queued again while its previous run is still going
+    if (pendingMask & (1 << job)) {
+        copy.state = JOB_PENDING;
+    } else if (runningJob == job) {
+        copy.state = JOB_RUNNING;
+    }
+    portEXIT_CRITICAL(&mux);
+    return copy;
+}
+
+JobState HeavyRequestLane::getJobState(HeavyJob job, uint32_t id) const {
+    JobState state = JOB_IDLE;
+    portENTER_CRITICAL(&mux);
+    if (id == 0) {
+        // Never handed out
+    } else if ((pendingMask & (1 << job)) && pendingId[job] == id) {
+        state = JOB_PENDING;
+    } else if (runningJob == job && runningId == id) {
+        state = JOB_RUNNING;
+    } else if (status[job].id == id) {
+        state = status[job].state;
+    } else if (supersededId[job] == id) {
+        state = JOB_SUPERSEDED;
+    }
+    portEXIT_CRITICAL(&mux);
+    return state;
+}
+
+const char* HeavyRequestLane::stateName(JobState state) {
+    switch (state) {
+        case JOB_PENDING:    return "pending";
+        case JOB_RUNNING:    return "running";
+        case JOB_DONE:       return "done";
+        case JOB_FAILED:     return "failed";
+        case JOB_SUPERSEDED: return "superseded";
+        default:             return "idle";
+    }
+}
+
+const char* HeavyRequestLane::getStateName(HeavyJob job) const {
+    return stateName(getStatus(job).state);
+}
+
+bool HeavyRequestLane::isPending(HeavyJob job) const {
+    JobState state = getStatus(job).state;
+    return state == JOB_PENDING || state == JOB_RUNNING;
+}
+
+// ============================================================================
+// Worker
+// ============================================================================
+
+void HeavyRequestLane::workerTask(void* parameter) {
+    HeavyRequestLane* self = (HeavyRequestLane*)parameter;
+
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // Drain everything queued, including jobs submitted while running
+        while (true) {
+            bool found = false;
+            HeavyJob job = JOB_SCREENSHOT;
+            char* body = nullptr;
+            size_t length = 0;
+            uint32_t id = 0;
+
+            portENTER_CRITICAL(&self->mux);
+            for (int i = 0; i < JOB_COUNT; i++) {
+                if (self->pendingMask & (1 << JOB_ORDER[i])) {
+                    job = JOB_ORDER[i];
+                    found = true;
+                    break;
+                }
+            }
+            if (found) {
+                self->pendingMask &= ~(1 << job);
+                self->runningJob = job;
+                self->runningId = id = self->pendingId[job];
+                if (job == JOB_APPLY_CONFIG) {
+                    body = self->configBody;
+                    length = self->configLength;
+                    self->configBody = nullptr;
+                    self->configLength = 0;
+                }
+            }
+            portEXIT_CRITICAL(&self->mux);
+
+            if (!found) {
+                break;
+            }
+
+            unsigned long start = millis();
+            bool ok = self->runJob(job, body, length);
+            Serial.printf("HeavyLane: %s #%u %s in %lu ms\n", JOB_NAMES[job], id,
+                          ok ? "done" : "failed", millis() - start);
+
+            // Taken now, before another parse (a server fetch) replaces it
+            const char* error = (!ok && job == JOB_APPLY_CONFIG) ? configManager.getLastParseError() : nullptr;
+
+            portENTER_CRITICAL(&self->mux);
+            self->runningJob = JOB_COUNT;
+            self->runningId = 0;
+            self->status[job].state = ok ? JOB_DONE : JOB_FAILED;
+            self->status[job].finishedAt = millis();
+            self->status[job].runs++;
+            self->status[job].id = id;
+            self->status[job].error = error;
+            portEXIT_CRITICAL(&self->mux);
+        }
+    }
+}
+
+bool HeavyRequestLane::runJob(HeavyJob job, char* body, size_t length) {
+    switch (job) {
+        case JOB_SCREENSHOT:   return runScreenshot();
+        case JOB_APPLY_CONFIG: return runApplyConfig(body, length);
+        case JOB_ICON_PACK:    return runIconPack();
+        case JOB_BACKGROUND:   return runBackground();
+        default:               return false;
+    }
+}
+
+bool HeavyRequestLane::runScreenshot() {
+    // The render task makes the copy between frames; holding the LVGL lock
+    // here would keep it from ever getting there
+    return captureScreenshot();
+}
+
+bool HeavyRequestLane::runApplyConfig(char* body, size_t length) {
+    if (body == nullptr) {
+        return false;
+    }
+
+    Serial.printf("HeavyLane: Processing config (%u bytes)\n", length);
+
+    // Published with an atomic swap; readers keep their snapshot
+    bool parsed = configManager.parseConfigJson(body, length);
+    free(body);
+
+    if (!parsed) {
+        return false;
+    }
+
+    // Persisted by the write-behind task; nothing here waits on flash
+    configManager.markDirty();
+
+    // Refresh schedulers BEFORE requesting rebuild so theme/brightness
+    // are set correctly when the UI rebuilds
+    brightnessScheduler.refresh();
+    themeScheduler.refresh();
+
+    // Request UI rebuild (will be done in main loop for thread safety)
+    uiManager.requestRebuild();
+    return true;
+}
+
+bool HeavyRequestLane::runIconPack() {
+    // Resolves config icons against the new pack and requests the rebuild
+    return iconPack.install();
+}
+
+bool HeavyRequestLane::runBackground() {
+    // Swaps the new frames in under the LVGL lock
+    return backgroundAnim.install();
+}
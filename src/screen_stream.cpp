@@ -0,0 +1,320 @@
+#include "screen_stream.h"
+#include "screenshot.h"
+#include "psram_budget.h"
+
+// Global instance
+ScreenStream screenStream;
+
+static const size_t HEADER_SIZE = 10;
+static const size_t TILE_HEADER_SIZE = 5;
+static const size_t TILE_RAW_BYTES = ScreenStream::TILE_SIZE * ScreenStream::TILE_SIZE * sizeof(uint16_t);
+
+static const uint8_t FLAG_KEYFRAME = 0x01;
+static const uint8_t FLAG_END_OF_FRAME = 0x02;
+
+static const uint8_t ENCODING_RAW = 0;
+static const uint8_t ENCODING_RLE = 1;
+
+static inline int tilesX() { return (getScreenshotWidth() + ScreenStream::TILE_SIZE - 1) / ScreenStream::TILE_SIZE; }
+static inline int tilesY() { return (getScreenshotHeight() + ScreenStream::TILE_SIZE - 1) / ScreenStream::TILE_SIZE; }
+
+static inline void putU16(uint8_t* p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+ScreenStream::ScreenStream()
+    : socket("/api/screen/stream")
+    , taskHandle(nullptr)
+    , keyframeRequested(false)
+    , frame(nullptr)
+    , tileHashes(nullptr)
+    , message(nullptr)
+    , messageSeq(0)
+    , frameSeq(0)
+{
+}
+
+void ScreenStream::attach(AsyncWebServer& server) {
+    socket.onEvent(onEvent);
+    server.addHandler(&socket);
+
+    // Sleeps until a viewer connects; below the render and AsyncTCP tasks
+    xTaskCreatePinnedToCore(
+        streamTask,
+        "ScreenStream",
+        4096,
+        this,
+        tskIDLE_PRIORITY + 1,
+        &taskHandle,
+        0
+    );
+}
+
+// ============================================================================
+// Socket events (run in the async_tcp task)
+// ============================================================================
+
+void ScreenStream::onEvent(AsyncWebSocket* ws, AsyncWebSocketClient* client, AwsEventType type,
+                           void* arg, uint8_t* data, size_t len) {
+    ScreenStream& self = screenStream;
+
+    switch (type) {
+        case WS_EVT_CONNECT: {
+            if (ws->count() > MAX_VIEWERS) {
+                Serial.println("ScreenStream: Viewer limit reached, closing");
+                client->close();
+                return;
+            }
+            Serial.printf("ScreenStream: Viewer connected from %s\n",
+                          client->remoteIP().toString().c_str());
+
+            char hello[96];
+            snprintf(hello, sizeof(hello), "{\"t\":\"hello\",\"width\":%d,\"height\":%d,\"tile\":%u,\"fps\":%u}",
+                     getScreenshotWidth(), getScreenshotHeight(), TILE_SIZE, MAX_FPS);
+            client->text(hello);
+
+            // Everyone gets a full frame; cheap next to a missing viewer
+            self.keyframeRequested = true;
+            if (self.taskHandle) {
+                xTaskNotifyGive(self.taskHandle);
+            }
+            break;
+        }
+
+        case WS_EVT_DISCONNECT:
+            Serial.println("ScreenStream: Viewer disconnected");
+            break;
+
+        case WS_EVT_DATA: {
+            AwsFrameInfo* info = (AwsFrameInfo*)arg;
+            if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT &&
+                len == 3 && memcmp(data, "key", 3) == 0) {
+                self.keyframeRequested = true;
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+// ============================================================================
+// Stream task
+// ============================================================================
+
+bool ScreenStream::allocate() {
+    if (!frame) {
+        frame = (uint16_t*)psramBudget.alloc(PSRAM_SCREEN_STREAM, getScreenshotRgb565Size());
+    }
+    if (!tileHashes) {
+        tileHashes = (uint32_t*)calloc(tilesX() * tilesY(), sizeof(uint32_t));
+    }
+    if (!message) {
+        message = (uint8_t*)malloc(MAX_MESSAGE_SIZE);
+    }
+    if (!frame || !tileHashes || !message) {
+        Serial.println("ScreenStream: Failed to allocate stream buffers");
+        release();
+        return false;
+    }
+    return true;
+}
+
+void ScreenStream::release() {
+    psramBudget.release(PSRAM_SCREEN_STREAM, frame, getScreenshotRgb565Size());
+    free(tileHashes);
+    free(message);
+    frame = nullptr;
+    tileHashes = nullptr;
+    message = nullptr;
+}
+
+void ScreenStream::streamTask(void* parameter) {
+    ScreenStream* self = (ScreenStream*)parameter;
+    const uint32_t frameInterval = 1000 / MAX_FPS;
+
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (self->socket.count() == 0 || !self->allocate()) {
+            continue;
+        }
+
+        Serial.println("ScreenStream: Streaming");
+        unsigned long lastKeyframe = 0;
+
+        while (self->socket.count() > 0) {
+            unsigned long start = millis();
+            self->socket.cleanupClients(MAX_VIEWERS);
+
+            bool keyframe = self->keyframeRequested || start - lastKeyframe >= KEYFRAME_INTERVAL_MS;
+            if (keyframe) {
+                self->keyframeRequested = false;
+                lastKeyframe = start;
+            }
+            self->streamFrame(keyframe);
+
+            uint32_t elapsed = millis() - start;
+            vTaskDelay(pdMS_TO_TICKS(elapsed < frameInterval ? frameInterval - elapsed : 1));
+        }
+
+        // Last viewer gone: give the frame copy back
+        self->release();
+        Serial.println("ScreenStream: Idle");
+    }
+}
+
+// ============================================================================
+// Tile diff and encoding
+// ============================================================================
+
+uint32_t ScreenStream::hashTile(int tx, int ty) const {
+    const int width = getScreenshotWidth();
+    int x0 = tx * TILE_SIZE;
+    int y0 = ty * TILE_SIZE;
+    int w = min((int)TILE_SIZE, width - x0);
+    int h = min((int)TILE_SIZE, getScreenshotHeight() - y0);
+
+    // FNV-1a over the tile's pixels
+    uint32_t hash = 2166136261u;
+    for (int y = y0; y < y0 + h; y++) {
+        const uint16_t* row = frame + y * width + x0;
+        for (int x = 0; x < w; x++) {
+            hash = (hash ^ row[x]) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+size_t ScreenStream::encodeTile(int tx, int ty, uint8_t* out, uint8_t& encoding) const {
+    const int width = getScreenshotWidth();
+    int x0 = tx * TILE_SIZE;
+    int y0 = ty * TILE_SIZE;
+    int w = min((int)TILE_SIZE, width - x0);
+    int h = min((int)TILE_SIZE, getScreenshotHeight() - y0);
+    size_t rawBytes = (size_t)w * h * sizeof(uint16_t);
+
+    // RLE first: flat UI tiles are usually a handful of runs
+    size_t n = 0;
+    uint16_t color = 0;
+    int run = 0;
+    bool fits = true;
+    for (int y = y0; y < y0 + h && fits; y++) {
+        const uint16_t* row = frame + y * width + x0;
+        for (int x = 0; x < w; x++) {
+            if (run > 0 && row[x] == color && run < 256) {
+                run++;
+                continue;
+            }
+            if (run > 0) {
+                if (n + 3 > rawBytes) {
+                    fits = false;
+                    break;
+                }
+                out[n++] = run - 1;
+                putU16(out + n, color);
+                n += 2;
+            }
+            color = row[x];
+            run = 1;
+        }
+    }
+    if (fits && run > 0 && n + 3 <= rawBytes) {
+        out[n++] = run - 1;
+        putU16(out + n, color);
+        n += 2;
+        encoding = ENCODING_RLE;
+        return n;
+    }
+
+    // Busy tile (photo-like content): raw pixels are smaller
+    n = 0;
+    for (int y = y0; y < y0 + h; y++) {
+        memcpy(out + n, frame + y * width + x0, w * sizeof(uint16_t));
+        n += w * sizeof(uint16_t);
+    }
+    encoding = ENCODING_RAW;
+    return n;
+}
+
+bool ScreenStream::flushMessage(size_t& length, uint16_t tiles, bool keyframe, bool last) {
+    // Dropping a message would leave a viewer with stale tiles it can't
+    // detect, so don't queue one anywhere it won't fit
+    if (!socket.availableForWriteAll()) {
+        return false;
+    }
+
+    message[0] = 'S';
+    message[1] = 1;
+    message[2] = (keyframe ? FLAG_KEYFRAME : 0) | (last ? FLAG_END_OF_FRAME : 0);
+    message[3] = TILE_SIZE;
+    putU16(message + 4, messageSeq);
+    putU16(message + 6, frameSeq);
+    putU16(message + 8, tiles);
+
+    socket.binaryAll(message, length);
+    messageSeq++;
+    length = HEADER_SIZE;
+    return true;
+}
+
+void ScreenStream::streamFrame(bool keyframe) {
+    if (!copyDisplayFrame(frame, 200)) {
+        return;
+    }
+
+    const int columns = tilesX();
+    const int count = columns * tilesY();
+    size_t length = HEADER_SIZE;
+    uint16_t tiles = 0;
+    int messageStart = 0;
+    bool sent = true;
+    int i = 0;
+
+    for (; i < count; i++) {
+        int tx = i % columns;
+        int ty = i / columns;
+        uint32_t hash = hashTile(tx, ty);
+        if (!keyframe && hash == tileHashes[i]) {
+            continue;
+        }
+
+        if (length + TILE_HEADER_SIZE + TILE_RAW_BYTES > MAX_MESSAGE_SIZE) {
+            if (!flushMessage(length, tiles, keyframe, false)) {
+                sent = false;
+                break;
+            }
+            tiles = 0;
+            messageStart = i;
+        }
+
+        uint8_t encoding;
+        uint8_t* tile = message + length;
+        size_t n = encodeTile(tx, ty, tile + TILE_HEADER_SIZE, encoding);
+        tile[0] = tx;
+        tile[1] = ty;
+        tile[2] = encoding;
+        putU16(tile + 3, n);
+        length += TILE_HEADER_SIZE + n;
+        tiles++;
+        tileHashes[i] = hash;
+    }
+
+    if (sent && (tiles > 0 || keyframe)) {
+        sent = flushMessage(length, tiles, keyframe, true);
+    }
+
+    if (!sent) {
+        // Tiles in the message that didn't go out (and any unchanged ones
+        // in the same range) are resent with the next frame
+        for (int j = messageStart; j < i; j++) {
+            tileHashes[j] = ~tileHashes[j];
+        }
+        if (keyframe) {
+            // A new viewer may be missing the tiles after the break too
+            keyframeRequested = true;
+        }
+    }
+    frameSeq++;
+}
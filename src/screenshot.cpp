@@ -1,5 +1,10 @@
 #include "screenshot.h"
+#include "lvgl_task.h"
 #include <lvgl.h>
+#include "psram_budget.h"
+#include "static_memory.h"
+#include <atomic>
+#include <new>
 
 #define SCREEN_WIDTH 480
 #define SCREEN_HEIGHT 480
@@ -29,40 +34,66 @@ typedef struct {
 } BMPInfoHeader;
 #pragma pack(pop)
 
-// Global buffer to store screenshot in PSRAM
-static uint8_t* screenshot_buffer = nullptr;
-static size_t screenshot_size = 0;
-static bool screenshot_available = false;
+static const uint32_t BMP_HEADER_SIZE = sizeof(BMPFileHeader) + sizeof(BMPInfoHeader);
+static const uint32_t BMP_PIXEL_BYTES = SCREEN_WIDTH * 3;
+static const uint32_t BMP_ROW_SIZE = ((BMP_PIXEL_BYTES + 3) / 4) * 4;  // Rows are padded to 4 bytes
+static const uint32_t BMP_IMAGE_SIZE = BMP_ROW_SIZE * SCREEN_HEIGHT;
+static const uint32_t BMP_FILE_SIZE = BMP_HEADER_SIZE + BMP_IMAGE_SIZE;
 
-void initScreenshot() {
-    // Calculate required buffer size for BMP
-    uint32_t row_size = ((SCREEN_WIDTH * 3 + 3) / 4) * 4;  // Row must be multiple of 4 bytes
-    uint32_t image_size = row_size * SCREEN_HEIGHT;
-    size_t total_size = sizeof(BMPFileHeader) + sizeof(BMPInfoHeader) + image_size;
+// Current capture; the pointer itself is guarded by the mux, the frame is
+// immutable once published
+static ScreenshotRef current_frame;
+static portMUX_TYPE frame_mux = portMUX_INITIALIZER_UNLOCKED;
 
-    // Allocate buffer in PSRAM
-    screenshot_buffer = (uint8_t*)heap_caps_malloc(total_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-
-    if (screenshot_buffer) {
-        Serial.printf("Screenshot buffer allocated: %u bytes in PSRAM\n", total_size);
-    } else {
-        Serial.println("Failed to allocate screenshot buffer in PSRAM");
-    }
+ScreenshotFrame::~ScreenshotFrame() {
+#if PANEL_STATIC_MEMORY
+    staticMemory.release(pixels);
+#else
+    psramBudget.release(PSRAM_SCREENSHOT, pixels, getScreenshotRgb565Size());
+#endif
 }
 
-// Convert RGB565 to RGB888 (24-bit BMP)
-static void rgb565_to_rgb888(uint16_t rgb565, uint8_t* r, uint8_t* g, uint8_t* b) {
-    *r = ((rgb565 >> 11) & 0x1F) << 3;  // 5 bits red
-    *g = ((rgb565 >> 5) & 0x3F) << 2;   // 6 bits green
-    *b = (rgb565 & 0x1F) << 3;          // 5 bits blue
+static void publishFrame(ScreenshotRef frame) {
+    // Swap under the lock; the old frame (if this was its last holder) is
+    // freed when `frame` goes out of scope, outside the critical section
+    portENTER_CRITICAL(&frame_mux);
+    current_frame.swap(frame);
+    portEXIT_CRITICAL(&frame_mux);
 }
 
-bool captureScreenshot() {
-    Serial.println("Capturing screenshot...");
+// ============================================================================
+// Capture handshake with the render task
+// ============================================================================
+// The requester allocates the frame and posts it; the LVGL task copies the
+// displayed buffer into it between lv_timer_handler() calls, when no frame
+// is half rendered, and the requester publishes it. Only the copy itself
+// happens on the render task.
 
-    if (!screenshot_buffer) {
-        Serial.println("Screenshot buffer not initialized");
-        return false;
+enum CaptureState : uint8_t {
+    CAPTURE_IDLE = 0,
+    CAPTURE_CLAIMED,     // A requester is posting its target
+    CAPTURE_REQUESTED,   // Target posted, waiting for the render task
+    CAPTURE_COPYING,     // Render task is copying (can't be cancelled)
+    CAPTURE_DONE,
+    CAPTURE_FAILED
+};
+
+static std::atomic<uint8_t> capture_state(CAPTURE_IDLE);
+static uint16_t* capture_target = nullptr;
+static FrameReadFn frame_reader = nullptr;
+
+void setScreenshotFrameReader(FrameReadFn fn) {
+    frame_reader = fn;
+}
+
+// Copy the last completed frame (LVGL must not be rendering)
+static bool copyDisplayedFrame(uint16_t* dst) {
+    if (frame_reader) {
+        if (!frame_reader(dst)) {
+            Serial.println("Framebuffer readback failed");
+            return false;
+        }
+        return true;
     }
 
     // Get LVGL display and draw buffer
@@ -78,17 +109,19 @@ bool captureScreenshot() {
         return false;
     }
 
-    // With double buffering, buf_act is being prepared for next frame
-    // The displayed buffer is the other one
-    lv_color_t* buf;
+    // Partial render mode only keeps a band of lines, not the whole screen
+    if (draw_buf->size < (uint32_t)SCREEN_WIDTH * SCREEN_HEIGHT) {
+        Serial.println("Draw buffer is not a full frame, cannot capture");
+        return false;
+    }
+
+    // Between frames LVGL has already swapped buf_act to the buffer it will
+    // draw next, so the other one holds the completed, displayed frame
+    const lv_color_t* buf;
     if (draw_buf->buf1 && draw_buf->buf2) {
-        // Double buffered - use the non-active buffer (currently displayed)
-        buf = (lv_color_t*)(draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1);
-        Serial.println("Using displayed buffer (double buffered mode)");
+        buf = (const lv_color_t*)(draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1);
     } else {
-        // Single buffer
-        buf = (lv_color_t*)draw_buf->buf1;
-        Serial.println("Using single buffer");
+        buf = (const lv_color_t*)draw_buf->buf1;
     }
 
     if (!buf) {
@@ -96,23 +129,140 @@ bool captureScreenshot() {
         return false;
     }
 
-    // Calculate sizes
-    uint32_t row_size = ((SCREEN_WIDTH * 3 + 3) / 4) * 4;  // BMP rows must be multiple of 4 bytes
-    uint32_t image_size = row_size * SCREEN_HEIGHT;
-    uint32_t file_size = sizeof(BMPFileHeader) + sizeof(BMPInfoHeader) + image_size;
+    memcpy(dst, buf, getScreenshotRgb565Size());
+    return true;
+}
+
+void serviceScreenshotCapture() {
+    uint8_t expected = CAPTURE_REQUESTED;
+    if (!capture_state.compare_exchange_strong(expected, CAPTURE_COPYING)) {
+        return;
+    }
+    bool ok = copyDisplayedFrame(capture_target);
+    capture_state.store(ok ? CAPTURE_DONE : CAPTURE_FAILED);
+}
+
+bool copyDisplayFrame(uint16_t* dst, uint32_t timeoutMs) {
+    if (!lvglTask.isRunning()) {
+        // No render task yet (early boot): setup() owns LVGL, copy directly
+        LVGLLock lvglLock;
+        return copyDisplayedFrame(dst);
+    }
+
+    // One request at a time (a screenshot and the live stream may overlap)
+    unsigned long start = millis();
+    uint8_t expected = CAPTURE_IDLE;
+    while (!capture_state.compare_exchange_strong(expected, CAPTURE_CLAIMED)) {
+        if (millis() - start > timeoutMs) {
+            Serial.println("Screenshot capture busy");
+            return false;
+        }
+        vTaskDelay(1);
+        expected = CAPTURE_IDLE;
+    }
+    capture_target = dst;
+    capture_state.store(CAPTURE_REQUESTED);
+    lvglTask.wake();
+
+    bool ok;
+    while (true) {
+        uint8_t state = capture_state.load();
+        if (state == CAPTURE_DONE || state == CAPTURE_FAILED) {
+            ok = state == CAPTURE_DONE;
+            break;
+        }
+        if (state == CAPTURE_REQUESTED && millis() - start > timeoutMs) {
+            expected = CAPTURE_REQUESTED;
+            if (capture_state.compare_exchange_strong(expected, CAPTURE_IDLE)) {
+                Serial.println("Screenshot capture timed out waiting for the render task");
+                return false;
+            }
+            continue;  // Render task picked it up just now
+        }
+        vTaskDelay(1);
+    }
+    capture_state.store(CAPTURE_IDLE);
+    return ok;
+}
+
+#if !PANEL_STATIC_MEMORY
+// PSRAM budget reclaimer: the capture only waits for someone to download
+// it, so it goes first when a bigger buffer needs the room (a download in
+// progress keeps it alive until it ends)
+static bool reclaimScreenshot() {
+    if (!hasScreenshot()) return false;
+    deleteScreenshot();
+    return true;
+}
+#endif
+
+bool captureScreenshot(uint32_t timeoutMs) {
+    ScreenshotFrame* frame = new (std::nothrow) ScreenshotFrame();
+    if (!frame) {
+        return false;
+    }
+    size_t frame_bytes = getScreenshotRgb565Size();
+#if PANEL_STATIC_MEMORY
+    // One of the slots reserved at boot; with both held (a download of the
+    // last capture still running) the capture is refused, never heap-backed
+    frame->pixels = (uint16_t*)staticMemory.alloc(STATIC_POOL_SCREENSHOT, frame_bytes);
+#else
+    psramBudget.setReclaimer(PSRAM_SCREENSHOT, reclaimScreenshot);
+    frame->pixels = (uint16_t*)psramBudget.alloc(PSRAM_SCREENSHOT, frame_bytes);
+#endif
+    if (!frame->pixels) {
+        Serial.printf("Failed to allocate %u byte screenshot frame in PSRAM\n", frame_bytes);
+        delete frame;
+        return false;
+    }
+
+    if (!copyDisplayFrame(frame->pixels, timeoutMs)) {
+        delete frame;
+        return false;
+    }
+
+    publishFrame(ScreenshotRef(frame));
+    Serial.printf("Screenshot captured: %u byte frame (%u byte BMP)\n", frame_bytes, BMP_FILE_SIZE);
+    return true;
+}
+
+ScreenshotRef getScreenshot() {
+    portENTER_CRITICAL(&frame_mux);
+    ScreenshotRef frame = current_frame;
+    portEXIT_CRITICAL(&frame_mux);
+    return frame;
+}
+
+size_t getScreenshotSize() {
+    return hasScreenshot() ? BMP_FILE_SIZE : 0;
+}
+
+size_t getScreenshotBmpSize() {
+    return BMP_FILE_SIZE;
+}
+
+bool hasScreenshot() {
+    portENTER_CRITICAL(&frame_mux);
+    bool available = current_frame != nullptr;
+    portEXIT_CRITICAL(&frame_mux);
+    return available;
+}
+
+void deleteScreenshot() {
+    publishFrame(ScreenshotRef());
+}
 
-    screenshot_size = file_size;
-    uint8_t* write_ptr = screenshot_buffer;
+// ============================================================================
+// BMP encoder
+// ============================================================================
 
-    // Write BMP file header
+static void writeBmpHeader(uint8_t* out) {
     BMPFileHeader file_header = {0};
     file_header.signature = 0x4D42;  // "BM"
-    file_header.file_size = file_size;
-    file_header.data_offset = sizeof(BMPFileHeader) + sizeof(BMPInfoHeader);
-    memcpy(write_ptr, &file_header, sizeof(BMPFileHeader));
-    write_ptr += sizeof(BMPFileHeader);
+    file_header.file_size = BMP_FILE_SIZE;
+    file_header.data_offset = BMP_HEADER_SIZE;
+    memcpy(out, &file_header, sizeof(BMPFileHeader));
 
-    // Write BMP info header
     BMPInfoHeader info_header = {0};
     info_header.header_size = sizeof(BMPInfoHeader);
     info_header.width = SCREEN_WIDTH;
@@ -120,50 +270,227 @@ bool captureScreenshot() {
     info_header.planes = 1;
     info_header.bits_per_pixel = 24;
     info_header.compression = 0;  // No compression
-    info_header.image_size = image_size;
-    memcpy(write_ptr, &info_header, sizeof(BMPInfoHeader));
-    write_ptr += sizeof(BMPInfoHeader);
-
-    // Write pixel data (BMP is bottom-up, so write rows in reverse)
-    for (int y = SCREEN_HEIGHT - 1; y >= 0; y--) {
-        for (int x = 0; x < SCREEN_WIDTH; x++) {
-            int pixel_index = y * SCREEN_WIDTH + x;
-            uint16_t rgb565 = buf[pixel_index].full;
-
-            uint8_t r, g, b;
-            rgb565_to_rgb888(rgb565, &r, &g, &b);
-
-            // BMP uses BGR order
-            *write_ptr++ = b;
-            *write_ptr++ = g;
-            *write_ptr++ = r;
-        }
+    info_header.image_size = BMP_IMAGE_SIZE;
+    memcpy(out + sizeof(BMPFileHeader), &info_header, sizeof(BMPInfoHeader));
+}
+
+// Byte `channel` (0 = B, 1 = G, 2 = R; BMP is BGR) of an RGB565 pixel
+static inline uint8_t bmpChannel(uint16_t rgb565, uint32_t channel) {
+    switch (channel) {
+        case 0:  return (rgb565 & 0x1F) << 3;          // 5 bits blue
+        case 1:  return ((rgb565 >> 5) & 0x3F) << 2;   // 6 bits green
+        default: return ((rgb565 >> 11) & 0x1F) << 3;  // 5 bits red
+    }
+}
+
+size_t readScreenshotBmp(const ScreenshotFrame& frame, uint8_t* dst, size_t maxLen, size_t offset) {
+    size_t written = 0;
+
+    // Headers (a response chunk may start part-way into them)
+    if (offset < BMP_HEADER_SIZE) {
+        uint8_t header[BMP_HEADER_SIZE];
+        writeBmpHeader(header);
+        size_t n = BMP_HEADER_SIZE - offset;
+        if (n > maxLen) n = maxLen;
+        memcpy(dst, header + offset, n);
+        written = n;
+        offset += n;
+    }
+
+    // Pixel rows, converted only for the bytes this chunk covers
+    while (written < maxLen && offset < BMP_FILE_SIZE) {
+        uint32_t pos = offset - BMP_HEADER_SIZE;
+        uint32_t row = pos / BMP_ROW_SIZE;
+        uint32_t col = pos % BMP_ROW_SIZE;
+
+        // BMP is bottom-up: the first row in the file is the bottom of the screen
+        const uint16_t* src = frame.pixels + (SCREEN_HEIGHT - 1 - row) * SCREEN_WIDTH;
+
+        size_t room = maxLen - written;
+        uint32_t row_left = BMP_ROW_SIZE - col;
+        uint32_t end = col + (room < row_left ? room : row_left);
+        uint8_t* out = dst + written;
 
-        // Add padding to make row size multiple of 4
-        int padding = row_size - (SCREEN_WIDTH * 3);
-        for (int p = 0; p < padding; p++) {
-            *write_ptr++ = 0;
+        // Leading bytes of a pixel split across chunks
+        while (col < end && col < BMP_PIXEL_BYTES && col % 3 != 0) {
+            *out++ = bmpChannel(src[col / 3], col % 3);
+            col++;
         }
+        // Whole pixels
+        while (col + 3 <= end && col + 3 <= BMP_PIXEL_BYTES) {
+            uint16_t rgb565 = src[col / 3];
+            *out++ = bmpChannel(rgb565, 0);
+            *out++ = bmpChannel(rgb565, 1);
+            *out++ = bmpChannel(rgb565, 2);
+            col += 3;
+        }
+        // Trailing partial pixel
+        while (col < end && col < BMP_PIXEL_BYTES) {
+            *out++ = bmpChannel(src[col / 3], col % 3);
+            col++;
+        }
+        // Row padding
+        while (col < end) {
+            *out++ = 0;
+            col++;
+        }
+
+        size_t n = out - (dst + written);
+        written += n;
+        offset += n;
     }
 
-    screenshot_available = true;
-    Serial.printf("Screenshot captured: %u bytes\n", file_size);
-    return true;
+    return written;
 }
 
-const uint8_t* getScreenshotData() {
-    return screenshot_buffer;
+// ============================================================================
+// Raw RGB565
+// ============================================================================
+
+size_t getScreenshotRgb565Size() {
+    return (size_t)SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t);
 }
 
-size_t getScreenshotSize() {
-    return screenshot_size;
+size_t readScreenshotRgb565(const ScreenshotFrame& frame, uint8_t* dst, size_t maxLen, size_t offset) {
+    size_t total = getScreenshotRgb565Size();
+    if (offset >= total) {
+        return 0;
+    }
+    size_t n = total - offset;
+    if (n > maxLen) n = maxLen;
+    memcpy(dst, (const uint8_t*)frame.pixels + offset, n);
+    return n;
 }
 
-bool hasScreenshot() {
-    return screenshot_available && screenshot_buffer != nullptr;
+int getScreenshotWidth() {
+    return SCREEN_WIDTH;
 }
 
-void deleteScreenshot() {
-    screenshot_available = false;
-    screenshot_size = 0;
+int getScreenshotHeight() {
+    return SCREEN_HEIGHT;
+}
+
+// ============================================================================
+// QOI encoder
+// ============================================================================
+
+#define QOI_OP_INDEX 0x00
+#define QOI_OP_DIFF  0x40
+#define QOI_OP_LUMA  0x80
+#define QOI_OP_RUN   0xc0
+#define QOI_OP_RGB   0xfe
+
+static inline uint32_t rgb565ToRgb888(uint16_t rgb565) {
+    // Same expansion as the BMP encoder, so both formats decode identically
+    uint32_t r = ((rgb565 >> 11) & 0x1F) << 3;
+    uint32_t g = ((rgb565 >> 5) & 0x3F) << 2;
+    uint32_t b = (rgb565 & 0x1F) << 3;
+    return (r << 16) | (g << 8) | b;
+}
+
+static inline uint8_t qoiHash(uint32_t rgb) {
+    uint8_t r = rgb >> 16, g = rgb >> 8, b = rgb;
+    return (r * 3 + g * 5 + b * 7 + 255 * 11) % 64;
+}
+
+QoiScreenshotEncoder::QoiScreenshotEncoder(ScreenshotRef frame)
+    : frame(frame)
+    , pos(0)
+    , prev(0)
+    , run(0)
+    , started(false)
+    , finished(false)
+    , pendingLen(0)
+    , pendingOff(0) {
+    memset(index, 0, sizeof(index));
+    memset(indexUsed, 0, sizeof(indexUsed));
+}
+
+void QoiScreenshotEncoder::encodePixel() {
+    const uint32_t total = (uint32_t)SCREEN_WIDTH * SCREEN_HEIGHT;
+    uint32_t px = rgb565ToRgb888(frame->pixels[pos++]);
+
+    if (px == prev) {
+        run++;
+        if (run == 62 || pos == total) {
+            emit(QOI_OP_RUN | (run - 1));
+            run = 0;
+        }
+        return;
+    }
+
+    if (run > 0) {
+        emit(QOI_OP_RUN | (run - 1));
+        run = 0;
+    }
+
+    uint8_t hash = qoiHash(px);
+    if (indexUsed[hash] && index[hash] == px) {
+        emit(QOI_OP_INDEX | hash);
+    } else {
+        index[hash] = px;
+        indexUsed[hash] = true;
+
+        int8_t vr = (int8_t)((px >> 16) - (prev >> 16));
+        int8_t vg = (int8_t)((px >> 8) - (prev >> 8));
+        int8_t vb = (int8_t)(px - prev);
+        int8_t vg_r = vr - vg;
+        int8_t vg_b = vb - vg;
+
+        if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+            emit(QOI_OP_DIFF | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2));
+        } else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8) {
+            emit(QOI_OP_LUMA | (vg + 32));
+            emit((vg_r + 8) << 4 | (vg_b + 8));
+        } else {
+            emit(QOI_OP_RGB);
+            emit(px >> 16);
+            emit(px >> 8);
+            emit(px);
+        }
+    }
+    prev = px;
+}
+
+size_t QoiScreenshotEncoder::read(uint8_t* dst, size_t maxLen) {
+    const uint32_t total = (uint32_t)SCREEN_WIDTH * SCREEN_HEIGHT;
+    size_t written = 0;
+
+    while (written < maxLen) {
+        // Drain what the last step produced first
+        if (pendingOff < pendingLen) {
+            size_t n = pendingLen - pendingOff;
+            if (n > maxLen - written) n = maxLen - written;
+            memcpy(dst + written, pending + pendingOff, n);
+            written += n;
+            pendingOff += n;
+            continue;
+        }
+        pendingLen = 0;
+        pendingOff = 0;
+
+        if (!started) {
+            // "qoif", width and height (big-endian), 3 channels, sRGB
+            static const uint8_t magic[4] = {'q', 'o', 'i', 'f'};
+            memcpy(pending, magic, 4);
+            pendingLen = 4;
+            for (int shift = 24; shift >= 0; shift -= 8) emit((uint32_t)SCREEN_WIDTH >> shift);
+            for (int shift = 24; shift >= 0; shift -= 8) emit((uint32_t)SCREEN_HEIGHT >> shift);
+            emit(3);
+            emit(0);
+            started = true;
+        } else if (pos < total) {
+            encodePixel();
+        } else if (!finished) {
+            // End marker: seven 0x00 and a 0x01
+            memset(pending, 0, 7);
+            pendingLen = 7;
+            emit(1);
+            finished = true;
+        } else {
+            break;
+        }
+    }
+
+    return written;
 }
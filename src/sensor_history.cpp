@@ -0,0 +1,119 @@
+#include "sensor_history.h"
+#include <math.h>
+
+// Global instance
+SensorHistory sensorHistory;
+
+SensorHistory::SensorHistory()
+    : rings()
+    , dropped(0)
+{
+    mux = portMUX_INITIALIZER_UNLOCKED;
+}
+
+const SensorHistory::Ring* SensorHistory::find(uint8_t buttonId) const {
+    for (const Ring& ring : rings) {
+        if (ring.buttonId == buttonId) return &ring;
+    }
+    return nullptr;
+}
+
+SensorHistory::Ring& SensorHistory::claim(uint8_t buttonId) {
+    for (Ring& ring : rings) {
+        if (ring.buttonId == buttonId) return ring;
+    }
+
+    Ring* oldest = &rings[0];
+    for (Ring& ring : rings) {
+        if (ring.buttonId == 0) {
+            oldest = &ring;
+            break;
+        }
+        if ((int32_t)(ring.lastMs - oldest->lastMs) < 0) oldest = &ring;
+    }
+
+    // A free ring, or the one updated longest ago (a sensor since removed, most likely)
+    dropped += oldest->count;
+    oldest->buttonId = buttonId;
+    oldest->head = 0;
+    oldest->count = 0;
+    return *oldest;
+}
+
+bool SensorHistory::push(uint8_t buttonId, float value) {
+    if (buttonId == 0 || !isfinite(value)) {
+        dropped++;
+        return false;
+    }
+
+    portENTER_CRITICAL(&mux);
+    Ring& ring = claim(buttonId);
+    ring.samples[ring.head] = value;
+    ring.head = (ring.head + 1) % HISTORY_SIZE;
+    if (ring.count < HISTORY_SIZE) ring.count++;
+    ring.lastMs = millis();
+    portEXIT_CRITICAL(&mux);
+    return true;
+}
+
+bool SensorHistory::latest(uint8_t buttonId, float& value) const {
+    bool found = false;
+    portENTER_CRITICAL(&mux);
+    const Ring* ring = find(buttonId);
+    if (ring && ring->count > 0) {
+        value = ring->samples[(ring->head + HISTORY_SIZE - 1) % HISTORY_SIZE];
+        found = true;
+    }
+    portEXIT_CRITICAL(&mux);
+    return found;
+}
+
+uint16_t SensorHistory::decimate(uint8_t buttonId, int16_t* out, uint16_t maxPoints) const {
+    uint16_t written = 0;
+
+    // A few hundred compares; cheaper than copying the ring out first
+    portENTER_CRITICAL(&mux);
+    const Ring* ring = find(buttonId);
+    if (ring && ring->count > 0 && maxPoints >= 2) {
+        uint16_t n = ring->count;
+        uint16_t first = (ring->head + HISTORY_SIZE - n) % HISTORY_SIZE;
+        auto at = [&](uint16_t i) { return ring->samples[(first + i) % HISTORY_SIZE]; };
+
+        float lo = at(0);
+        float hi = lo;
+        for (uint16_t i = 1; i < n; i++) {
+            float v = at(i);
+            if (v < lo) lo = v;
+            if (v > hi) hi = v;
+        }
+        float scale = hi > lo ? CHART_RANGE / (hi - lo) : 0;
+        auto point = [&](float v) -> int16_t {
+            return hi > lo ? (int16_t)((v - lo) * scale + 0.5f) : CHART_RANGE / 2;
+        };
+
+        if (n <= maxPoints) {
+            for (uint16_t i = 0; i < n; i++) {
+                out[written++] = point(at(i));
+            }
+        } else {
+            // Each bucket (at least two samples) keeps its lowest and
+            // highest, in the order they happened
+            uint16_t buckets = maxPoints / 2;
+            for (uint16_t b = 0; b < buckets; b++) {
+                uint16_t start = (uint32_t)b * n / buckets;
+                uint16_t end = (uint32_t)(b + 1) * n / buckets;
+                uint16_t minAt = start;
+                uint16_t maxAt = start;
+                for (uint16_t i = start + 1; i < end; i++) {
+                    float v = at(i);
+                    if (v < at(minAt)) minAt = i;
+                    if (v > at(maxAt)) maxAt = i;
+                }
+                out[written++] = point(at(minAt < maxAt ? minAt : maxAt));
+                out[written++] = point(at(minAt < maxAt ? maxAt : minAt));
+            }
+        }
+    }
+    portEXIT_CRITICAL(&mux);
+    return written;
+}
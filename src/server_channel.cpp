@@ -0,0 +1,292 @@
+#include "server_channel.h"
+#include "config_manager.h"
+#include "device_controller.h"
+#include "ui_manager.h"
+#include "brightness_scheduler.h"
+#include "theme_scheduler.h"
+#include "http_pool.h"
+#include "heap_monitor.h"
+#include "task_monitor.h"
+#include "perf_monitor.h"
+#include "wifi_link.h"
+#include "event_scheduler.h"
+#include "ambient_light.h"
+#include "state_multicast.h"
+#include "panel_log.h"
+#include "time_manager.h"
+#include "sensor_history.h"
+#include "json_alloc.h"
+#include <ArduinoJson.h>
+
+// Global instance
+ServerChannel serverChannel;
+
+ServerChannel::ServerChannel()
+    : socket("/ws")
+    , clientId(0)
+    , lastReceive(0)
+    , cleanupJob(-1)
+    , configJob(-1)
+{
+}
+
+void ServerChannel::attach(AsyncWebServer& server) {
+    socket.onEvent(onEvent);
+    server.addHandler(&socket);
+
+    cleanupJob = eventScheduler.add("ws_cleanup", onCleanupTimer, this);
+    configJob = eventScheduler.add("ws_config", onConfigChanged, this);
+    eventScheduler.schedule(cleanupJob, CLEANUP_INTERVAL);
+}
+
+bool ServerChannel::isConnected() const {
+    return clientId != 0 && millis() - lastReceive < HEARTBEAT_TIMEOUT;
+}
+
+bool ServerChannel::send(const char* json) {
+    uint32_t id = clientId;
+    if (id == 0 || !isConnected() || !socket.availableForWrite(id)) {
+        return false;
+    }
+    socket.text(id, json);
+    return true;
+}
+
+void ServerChannel::announce() {
+    char hello[128];
+    formatHello(hello, sizeof(hello));
+    send(hello);
+}
+
+void ServerChannel::formatHello(char* out, size_t size) {
+    snprintf(out, size, "{\"t\":\"hello\",\"deviceId\":\"%s\",\"msgpack\":true%s}",
+             configManager.getDeviceId().c_str(), stateMulticast.isAdvertised() ? ",\"mcast\":true" : "");
+}
+
+void ServerChannel::onCleanupTimer(void* arg) {
+    ServerChannel* self = (ServerChannel*)arg;
+    eventScheduler.schedule(self->cleanupJob, CLEANUP_INTERVAL);
+    self->socket.cleanupClients();
+
+    // Server went quiet without closing - drop it so we fall back to HTTP
+    uint32_t id = self->clientId;
+    if (id != 0 && millis() - self->lastReceive >= HEARTBEAT_TIMEOUT) {
+        LOG_I("ServerChannel: Heartbeat timeout, closing socket");
+        self->clientId = 0;
+        self->socket.close(id);
+    }
+}
+
+void ServerChannel::onConfigChanged(void* arg) {
+    ((ServerChannel*)arg)->refreshConfig();
+}
+
+// ============================================================================
+// Socket events (run in the async_tcp task)
+// ============================================================================
+
+void ServerChannel::onEvent(AsyncWebSocket* ws, AsyncWebSocketClient* client, AwsEventType type,
+                            void* arg, uint8_t* data, size_t len) {
+    ServerChannel& self = serverChannel;
+
+    switch (type) {
+        case WS_EVT_CONNECT: {
+            // One server at a time - the newest connection wins
+            uint32_t previous = self.clientId;
+            self.clientId = client->id();
+            self.lastReceive = millis();
+            if (previous != 0 && previous != client->id()) {
+                ws->close(previous);
+            }
+            LOG_I("ServerChannel: Server connected from %s",
+                          client->remoteIP().toString().c_str());
+
+            char hello[128];
+            formatHello(hello, sizeof(hello));
+            client->text(hello);
+
+            // Back after an outage (or an AP restart): actions made meanwhile go out now
+            deviceController.replayJournal();
+            break;
+        }
+
+        case WS_EVT_DISCONNECT:
+            if (self.clientId == client->id()) {
+                self.clientId = 0;
+                LOG_I("ServerChannel: Server disconnected");
+            }
+            break;
+
+        case WS_EVT_DATA: {
+            AwsFrameInfo* info = (AwsFrameInfo*)arg;
+            // Messages are tiny; only accept complete single frames.
+            // Binary frames carry the same messages as MessagePack.
+            if (info->final && info->index == 0 && info->len == len && len <= MAX_MESSAGE_SIZE &&
+                (info->opcode == WS_TEXT || info->opcode == WS_BINARY)) {
+                self.handleMessage(client, (char*)data, len, info->opcode == WS_BINARY);
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void ServerChannel::handleMessage(AsyncWebSocketClient* client, char* data, size_t len, bool msgpack) {
+    if (client->id() != clientId) {
+        return;
+    }
+    lastReceive = millis();
+
+    StaticJsonDocument<64> filter;
+    filter["t"] = true;
+    filter["lux"] = true;
+    filter["serverTime"] = true;
+    // Read-only pass (const input) so the buffer is intact for the real parse
+    StaticJsonDocument<96> header;
+    DeserializationError error = msgpack
+        ? deserializeMsgPack(header, (const char*)data, len, DeserializationOption::Filter(filter))
+        : deserializeJson(header, (const char*)data, len, DeserializationOption::Filter(filter));
+    if (error) {
+        LOG_W("ServerChannel: Ignoring malformed message");
+        return;
+    }
+
+    const char* t = header["t"] | "";
+    if (strcmp(t, "ping") == 0) {
+        // Pings carry the server's clock (the first one answers our hello)
+        if (header.containsKey("serverTime")) {
+            timeManager.setTimeFromServer(header["serverTime"].as<uint32_t>());
+        }
+
+        // The pong carries the latest heap, frame time, WiFi and task samples
+        // so the server can keep a fragmentation/CPU/performance history per
+        // panel (its fleet telemetry). Only the AsyncTCP task
+        // gets here, so the buffer can be static instead of on its stack.
+        static char pong[1536];
+        size_t cap = sizeof(pong) - 2;  // Room for the closing brace
+        size_t n = snprintf(pong, sizeof(pong), "{\"t\":\"pong\"");
+        size_t heapLen = strlen(",\"heap\":");
+        size_t heap = heapMonitor.writeHeartbeat(pong + n + heapLen, cap - n - heapLen);
+        if (heap > 0) {
+            memcpy(pong + n, ",\"heap\":", heapLen);
+            n += heapLen + heap;
+        }
+        size_t perfLen = strlen(",\"perf\":");
+        if (n + perfLen < cap) {
+            size_t perf = perfMonitor.writeHeartbeat(pong + n + perfLen, cap - n - perfLen);
+            if (perf > 0) {
+                memcpy(pong + n, ",\"perf\":", perfLen);
+                n += perfLen + perf;
+            }
+        }
+        if (n < cap) {
+            int wifi = snprintf(pong + n, cap - n, ",\"wifi\":{\"rssi\":%d,\"reconnects\":%u}",
+                                WiFi.RSSI(), wifiLink.getReconnects());
+            if (wifi > 0 && (size_t)wifi < cap - n) {
+                n += wifi;
+            } else {
+                pong[n] = '\0';
+            }
+        }
+        size_t tasksLen = strlen(",\"tasks\":");
+        if (n + tasksLen < cap) {
+            size_t tasks = taskMonitor.writeHeartbeat(pong + n + tasksLen, cap - n - tasksLen);
+            if (tasks > 0) {
+                memcpy(pong + n, ",\"tasks\":", tasksLen);
+                n += tasksLen + tasks;
+            }
+        }
+        strcpy(pong + n, "}");
+        client->text(pong);
+    } else if (strcmp(t, "state") == 0) {
+        // Same payload shape as POST /api/state/buttons; the frame buffer is ours
+        bool resync = false;
+        deviceController.processServerStateUpdate(data, len, msgpack, &resync);
+        if (resync) {
+            client->text("{\"t\":\"resync\"}");
+        }
+    } else if (strcmp(t, "config") == 0) {
+        // Fetching blocks on HTTP, do it from the main loop
+        eventScheduler.post(configJob);
+    } else if (strcmp(t, "fields") == 0) {
+        // Live LCARS frame text, relabelled in place by the LVGL task. The
+        // frame buffer is ours, so strings are parsed in place; only the
+        // AsyncTCP task gets here, so the document can be static.
+        static StaticJsonDocument<512> doc;
+        DeserializationError fieldsError = msgpack
+            ? deserializeMsgPack(doc, data, len)
+            : deserializeJson(doc, data, len);
+        if (fieldsError) {
+            LOG_W("ServerChannel: Ignoring malformed fields message");
+            return;
+        }
+        for (JsonPair field : doc["fields"].as<JsonObject>()) {
+            const char* value = field.value() | "";
+            if (!uiManager.postLCARSField(field.key().c_str(), value)) {
+                LOG_W("ServerChannel: Unknown LCARS field %s", field.key().c_str());
+            }
+        }
+    } else if (strcmp(t, "samples") == 0) {
+        // Sensor samples by button id, a number or an array oldest first
+        // (a backfill can fill a whole history, so sized for one in PSRAM)
+        PsramJsonDocument doc(JSON_OBJECT_SIZE(8) + JSON_ARRAY_SIZE(SensorHistory::HISTORY_SIZE) + 512);
+        DeserializationError samplesError = msgpack
+            ? deserializeMsgPack(doc, data, len)
+            : deserializeJson(doc, data, len);
+        if (samplesError) {
+            LOG_W("ServerChannel: Ignoring malformed samples message");
+            return;
+        }
+        for (JsonPair sensor : doc["samples"].as<JsonObject>()) {
+            uint8_t buttonId = (uint8_t)atoi(sensor.key().c_str());
+            JsonArray values = sensor.value().as<JsonArray>();
+            bool taken = true;
+            if (values.isNull()) {
+                taken = uiManager.postSensorSample(buttonId, sensor.value() | NAN);
+            } else {
+                for (JsonVariant value : values) {
+                    taken &= uiManager.postSensorSample(buttonId, value | NAN);
+                }
+            }
+            if (!taken) {
+                LOG_W("ServerChannel: Samples for %s refused (not a sensor, or not numbers)", sensor.key().c_str());
+            }
+        }
+    } else if (strcmp(t, "ambient") == 0) {
+        // Light level for adaptive brightness, same as POST /api/ambient
+        long lux = header["lux"] | -1L;
+        if (lux >= 0) {
+            ambientLight.submitLux((uint32_t)lux);
+        }
+    }
+}
+
+// ============================================================================
+// Config refresh
+// ============================================================================
+
+void ServerChannel::refreshConfig() {
+    const String reportingUrl = configManager.getConfig().server.reportingUrl;
+    String url = reportingUrl + "/api/devices/" + configManager.getDeviceId() + "/config";
+
+    String payload;
+    int httpCode = httpPool.get(url.c_str(), 5000, &payload);
+    if (httpCode != 200) {
+        LOG_E("ServerChannel: Config refresh failed (%d)", httpCode);
+        return;
+    }
+
+    // Reporting URL is a local setting, the server copy doesn't override it
+    if (!configManager.parseConfigJson(payload.begin(), payload.length(), true)) {
+        LOG_E("ServerChannel: Failed to parse refreshed config");
+        return;
+    }
+
+    configManager.markDirty();
+    brightnessScheduler.refresh();
+    themeScheduler.refresh();
+    uiManager.requestRebuild();
+    LOG_I("ServerChannel: Config refreshed");
+}
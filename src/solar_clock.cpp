@@ -0,0 +1,104 @@
+#include "solar_clock.h"
+#include "time_manager.h"
+#include <math.h>
+
+// Global instance
+SolarClock solarClock;
+
+// Sun's centre 0.833 deg below the horizon: refraction plus its radius
+static const double SOLAR_ZENITH_DEG = 90.833;
+
+SolarClock::SolarClock()
+    : cached{-1, -1, -1, 0}
+    , cachedLatitude(NAN)
+    , cachedLongitude(NAN)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+{
+}
+
+bool SolarClock::hasLocation(float latitude, float longitude) {
+    return !isnan(latitude) && !isnan(longitude) &&
+           fabsf(latitude) <= 90.0f && fabsf(longitude) <= 180.0f;
+}
+
+bool SolarClock::today(float latitude, float longitude, SunTimes& out) {
+    if (!hasLocation(latitude, longitude) || !timeManager.isSynced()) {
+        return false;
+    }
+
+    struct tm local;
+    timeManager.getLocalNow(local);
+    int32_t day = dayKey(local);
+
+    portENTER_CRITICAL(&mux);
+    bool hit = cached.day == day && cachedLatitude == latitude && cachedLongitude == longitude;
+    if (hit) {
+        out = cached;
+    }
+    portEXIT_CRITICAL(&mux);
+    if (hit) return true;
+
+    SunTimes times = {day, -1, -1, 0};
+    time_t rise, set;
+    times.polar = compute(local.tm_year + 1900, local.tm_yday, latitude, longitude, rise, set);
+    if (times.polar == 0) {
+        times.sunrise = localMinute(rise);
+        times.sunset = localMinute(set);
+    }
+
+    portENTER_CRITICAL(&mux);
+    cached = times;
+    cachedLatitude = latitude;
+    cachedLongitude = longitude;
+    portEXIT_CRITICAL(&mux);
+
+    if (times.polar == 0) {
+        Serial.printf("SolarClock: Sunrise %02d:%02d, sunset %02d:%02d at %.3f, %.3f\n",
+                      times.sunrise / 60, times.sunrise % 60, times.sunset / 60, times.sunset % 60,
+                      latitude, longitude);
+    } else {
+        Serial.printf("SolarClock: Sun %s all day at %.3f, %.3f\n",
+                      times.polar > 0 ? "up" : "down", latitude, longitude);
+    }
+    out = times;
+    return true;
+}
+
+int8_t SolarClock::compute(int year, int yday, float latitude, float longitude,
+                           time_t& rise, time_t& set) {
+    // Fractional year at local noon, radians
+    double gamma = 2.0 * M_PI / 365.0 * yday;
+
+    double eqTimeMin = 229.18 * (0.000075 + 0.001868 * cos(gamma) - 0.032077 * sin(gamma)
+                                 - 0.014615 * cos(2 * gamma) - 0.040849 * sin(2 * gamma));
+    double decl = 0.006918 - 0.399912 * cos(gamma) + 0.070257 * sin(gamma)
+                  - 0.006758 * cos(2 * gamma) + 0.000907 * sin(2 * gamma)
+                  - 0.002697 * cos(3 * gamma) + 0.00148 * sin(3 * gamma);
+
+    double lat = latitude * M_PI / 180.0;
+    double cosHourAngle = cos(SOLAR_ZENITH_DEG * M_PI / 180.0) / (cos(lat) * cos(decl))
+                          - tan(lat) * tan(decl);
+    if (cosHourAngle > 1.0) return -1;
+    if (cosHourAngle < -1.0) return 1;
+    double hourAngleDeg = acos(cosHourAngle) * 180.0 / M_PI;
+
+    // Midnight UTC of the date: days since 1970 to Jan 1, plus yday
+    int y = year - 1;
+    long days = (long)(year - 1970) * 365 + (y / 4 - 1969 / 4) - (y / 100 - 1969 / 100)
+                + (y / 400 - 1969 / 400) + yday;
+    time_t midnight = (time_t)days * 86400;
+
+    // Minutes after midnight UTC, 4 min per degree of longitude
+    double riseMin = 720.0 - 4.0 * (longitude + hourAngleDeg) - eqTimeMin;
+    double setMin = 720.0 - 4.0 * (longitude - hourAngleDeg) - eqTimeMin;
+    rise = midnight + (time_t)lround(riseMin * 60.0);
+    set = midnight + (time_t)lround(setMin * 60.0);
+    return 0;
+}
+
+int16_t SolarClock::localMinute(time_t at) {
+    // Once per day; the TZ rules decide DST for that instant
+    struct tm local;
+    if (!localtime_r(&at, &local)) return -1;
+    return local.tm_hour * 60 + local.tm_min;
+}
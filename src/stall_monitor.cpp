@@ -0,0 +1,230 @@
+#include "stall_monitor.h"
+#include "panel_log.h"
+#include <esp_ipc.h>
+#include <esp_debug_helpers.h>
+#include <esp_ota_ops.h>
+#include <soc/soc_memory_layout.h>
+#include <freertos/xtensa_context.h>
+
+// Global instance
+StallMonitor stallMonitor;
+
+static const char* const WATCH_NAMES[STALL_WATCH_COUNT] = {
+    "loop",
+    "lvgl"
+};
+
+static const uint32_t MONITOR_STACK_SIZE = 3072;
+static const UBaseType_t MONITOR_PRIORITY = configMAX_PRIORITIES - 2;   // Under the IPC tasks
+
+StallMonitor::StallMonitor()
+    : head(0)
+    , count(0)
+    , total(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+{
+    memset(watches, 0, sizeof(watches));
+    memset(records, 0, sizeof(records));
+    for (Watch& w : watches) {
+        w.openRecord = -1;
+    }
+}
+
+void StallMonitor::begin() {
+    xTaskCreate(monitorTask, "StallMon", MONITOR_STACK_SIZE, this, MONITOR_PRIORITY, nullptr);
+}
+
+void StallMonitor::attach(StallWatch watch) {
+    watches[watch].task = xTaskGetCurrentTaskHandle();
+}
+
+void StallMonitor::enter(StallWatch watch, const char* tag) {
+    Watch& w = watches[watch];
+    w.tag = tag;
+    w.sinceMs = millis();
+    w.seq++;
+    w.busy = true;
+}
+
+void StallMonitor::leave(StallWatch watch) {
+    Watch& w = watches[watch];
+    w.lastMs = millis() - w.sinceMs;
+    w.busy = false;
+    w.doneSeq = w.seq;
+}
+
+void StallMonitor::monitorTask(void* parameter) {
+    StallMonitor* self = (StallMonitor*)parameter;
+    while (true) {
+        vTaskDelay(pdMS_TO_TICKS(CHECK_INTERVAL_MS));
+        self->check();
+    }
+}
+
+void StallMonitor::check() {
+    uint32_t now = millis();
+
+    for (uint8_t i = 0; i < STALL_WATCH_COUNT; i++) {
+        Watch& w = watches[i];
+        if (!w.task) continue;
+
+        uint32_t seq = w.seq;
+        uint32_t since = w.sinceMs;
+        bool busy = w.busy;
+
+        // The stalled unit ended: its record gets the real duration
+        if (w.openRecord >= 0 && w.doneSeq == w.recordedSeq) {
+            portENTER_CRITICAL(&mux);
+            records[w.openRecord].durationMs = w.lastMs;
+            records[w.openRecord].ongoing = false;
+            portEXIT_CRITICAL(&mux);
+            LOG_W("StallMonitor: %s stall in %s ended after %u ms",
+                  WATCH_NAMES[i], records[w.openRecord].tag ? records[w.openRecord].tag : "?",
+                  records[w.openRecord].durationMs);
+            w.openRecord = -1;
+        }
+
+        if (!busy || now - since < THRESHOLD_MS) continue;
+
+        if (w.openRecord >= 0 && w.recordedSeq == seq) {
+            portENTER_CRITICAL(&mux);
+            records[w.openRecord].durationMs = now - since;
+            portEXIT_CRITICAL(&mux);
+            continue;
+        }
+        if (w.recordedSeq == seq && seq != 0) {
+            continue;   // Recorded, and its slot since reused
+        }
+
+        StallRecord record;
+        memset(&record, 0, sizeof(record));
+        record.atMs = since;
+        record.durationMs = now - since;
+        record.tag = w.tag;
+        record.watch = i;
+        record.ongoing = true;
+        capture(w, record);
+
+        portENTER_CRITICAL(&mux);
+        int8_t slot = head;
+        records[slot] = record;
+        head = (head + 1) % HISTORY_SIZE;
+        if (count < HISTORY_SIZE) count++;
+        total++;
+        portEXIT_CRITICAL(&mux);
+
+        // A record pushed out of the ring is no longer anyone's
+        for (Watch& other : watches) {
+            if (other.openRecord == slot) other.openRecord = -1;
+        }
+        w.openRecord = slot;
+        w.recordedSeq = seq;
+        LOG_W("StallMonitor: %s busy in %s for %u ms", WATCH_NAMES[i], record.tag ? record.tag : "?",
+              record.durationMs);
+    }
+}
+
+// ============================================================================
+// Backtrace of another task
+// ============================================================================
+
+struct BacktraceRequest {
+    TaskHandle_t task;
+    uint32_t* pcs;
+    uint8_t maxFrames;
+    uint8_t depth;
+};
+
+// Return addresses carry the window increment in their top bits and point
+// past the call
+static uint32_t callerPc(uint32_t pc) {
+    if (pc & 0x80000000) {
+        pc = (pc & 0x3fffffff) | 0x40000000;
+    }
+    return pc - 3;
+}
+
+// Runs in the IPC task of the watched task's core, so that task (pinned
+// there) is off the CPU with its registers saved at the top of its stack
+static void walkTaskStack(void* arg) {
+    BacktraceRequest* req = (BacktraceRequest*)arg;
+    req->depth = 0;
+
+    // pxTopOfStack is the first member of the TCB
+    const uint32_t* top = *(const uint32_t* const*)req->task;
+    if (!esp_stack_ptr_is_sane((uint32_t)top)) return;
+
+    // An interrupt or preemption leaves an exception frame, a yield from
+    // the task itself (blocking) a solicited one, which has exit == 0
+    esp_backtrace_frame_t frame;
+    const XtExcFrame* exc = (const XtExcFrame*)top;
+    if (exc->exit == 0) {
+        const XtSolFrame* sol = (const XtSolFrame*)top;
+        frame.pc = callerPc(sol->pc);
+        frame.next_pc = sol->a0;
+        frame.sp = sol->a1;
+    } else {
+        frame.pc = exc->pc;
+        frame.next_pc = exc->a0;
+        frame.sp = exc->a1;
+    }
+    frame.exc_frame = nullptr;
+
+    if (!esp_ptr_executable((void*)frame.pc)) return;
+    req->pcs[req->depth++] = frame.pc;
+    while (req->depth < req->maxFrames && frame.next_pc != 0 && esp_stack_ptr_is_sane(frame.sp)) {
+        if (!esp_backtrace_get_next_frame(&frame)) break;
+        req->pcs[req->depth++] = callerPc(frame.pc);
+    }
+}
+
+void StallMonitor::capture(Watch& w, StallRecord& record) {
+    BaseType_t core = xTaskGetAffinity(w.task);
+    if (core == tskNO_AFFINITY) return;
+
+    BacktraceRequest req = {w.task, record.pcs, MAX_FRAMES, 0};
+    if (esp_ipc_call_blocking(core, walkTaskStack, &req) == ESP_OK) {
+        record.depth = req.depth;
+    }
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+void StallMonitor::writeJson(Print& out) const {
+    StallRecord snapshot[HISTORY_SIZE];
+    portENTER_CRITICAL(&mux);
+    uint8_t n = count;
+    uint8_t newest = head;
+    uint32_t all = total;
+    memcpy(snapshot, records, sizeof(snapshot));
+    portEXIT_CRITICAL(&mux);
+
+    uint32_t now = millis();
+    char elfSha[65] = "";
+    esp_ota_get_app_elf_sha256(elfSha, sizeof(elfSha));
+    out.printf("{\"threshold_ms\":%u,\"total\":%u,\"elf_sha256\":\"%s\",\"tasks\":[",
+               THRESHOLD_MS, all, elfSha);
+    for (uint8_t i = 0; i < STALL_WATCH_COUNT; i++) {
+        const Watch& w = watches[i];
+        const char* tag = w.tag;
+        bool busy = w.busy;
+        out.printf("%s{\"name\":\"%s\",\"busy\":%s,\"tag\":\"%s\",\"busy_ms\":%u,\"last_ms\":%u}",
+                   i ? "," : "", WATCH_NAMES[i], busy ? "true" : "false", tag ? tag : "",
+                   busy ? now - w.sinceMs : 0, w.lastMs);
+    }
+
+    out.print("],\"stalls\":[");
+    for (uint8_t i = 0; i < n; i++) {
+        const StallRecord& r = snapshot[(newest + HISTORY_SIZE - 1 - i) % HISTORY_SIZE];
+        out.printf("%s{\"task\":\"%s\",\"tag\":\"%s\",\"at_ms\":%u,\"duration_ms\":%u,\"ongoing\":%s,\"backtrace\":[",
+                   i ? "," : "", WATCH_NAMES[r.watch], r.tag ? r.tag : "", r.atMs, r.durationMs,
+                   r.ongoing ? "true" : "false");
+        for (uint8_t f = 0; f < r.depth; f++) {
+            out.printf("%s\"0x%08x\"", f ? "," : "", r.pcs[f]);
+        }
+        out.print("]}");
+    }
+    out.print("]}");
+}
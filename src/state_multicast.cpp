@@ -0,0 +1,192 @@
+#include "state_multicast.h"
+#include "device_controller.h"
+#include "server_channel.h"
+#include "event_scheduler.h"
+#include "panel_log.h"
+#include <WiFi.h>
+#include <mbedtls/md.h>
+
+// Global instance
+StateMulticast stateMulticast;
+
+namespace {
+
+const uint8_t DATAGRAM_VERSION = 1;
+const uint8_t NO_SPEED = 0xFF;
+
+struct __attribute__((packed)) DatagramHeader {
+    char magic[2];
+    uint8_t version;
+    uint8_t count;
+    uint32_t epoch;
+    uint32_t seq;
+};
+
+struct __attribute__((packed)) DatagramEntry {
+    uint32_t bindingId;
+    uint8_t state;
+    uint8_t speedLevel;
+};
+
+}  // namespace
+
+StateMulticast::StateMulticast()
+    : checkJob(-1)
+    , listening(false)
+    , advertised(false)
+    , active()
+    , listenIp(0)
+    , listenStart(0)
+    , lastValid(0)
+    , epoch(0)
+    , lastSeq(0)
+    , received(0)
+    , applied(0)
+    , repeats(0)
+    , rejected(0)
+    , gaps(0)
+{
+}
+
+void StateMulticast::begin() {
+    udp.onPacket([](AsyncUDPPacket& packet) {
+        stateMulticast.handlePacket(packet.data(), packet.length());
+    });
+    checkJob = eventScheduler.add("multicast", onCheckTimer, this);
+    eventScheduler.schedule(checkJob, CHECK_INTERVAL);
+}
+
+void StateMulticast::onCheckTimer(void* arg) {
+    StateMulticast* self = (StateMulticast*)arg;
+    self->check();
+    eventScheduler.schedule(self->checkJob, CHECK_INTERVAL);
+}
+
+void StateMulticast::check() {
+    ConfigSnapshot snapshot;
+    const StateMulticastConfig& want = snapshot->network.multicast;
+    bool up = WiFi.status() == WL_CONNECTED;
+    uint32_t ip = up ? (uint32_t)WiFi.localIP() : 0;
+
+    // Group, key or address changed: leave and join again
+    bool changed = want.port != active.port || memcmp(want.group, active.group, sizeof(want.group)) != 0 ||
+                   memcmp(want.key, active.key, sizeof(want.key)) != 0;
+    if (listening && (!up || !want.enabled || ip != listenIp || changed)) {
+        stop();
+    }
+    if (!listening && up && want.enabled) {
+        start(want);
+        listenIp = ip;
+    }
+
+    unsigned long now = millis();
+    bool heard = listening &&
+                 (now - listenStart < SILENCE_TIMEOUT || (lastValid != 0 && now - lastValid < SILENCE_TIMEOUT));
+    if (heard != advertised) {
+        advertised = heard;
+        LOG_I("StateMulticast: %s", heard ? "Receiving server multicast" : "No server multicast, unicast only");
+        // The server goes by the hello; tell it again
+        serverChannel.announce();
+    }
+}
+
+void StateMulticast::start(const StateMulticastConfig& config) {
+    active = config;
+    epoch = 0;
+    lastSeq = 0;
+    lastValid = 0;
+    IPAddress group(config.group[0], config.group[1], config.group[2], config.group[3]);
+    if (!udp.listenMulticast(group, config.port)) {
+        LOG_E("StateMulticast: Failed to join %s:%u", group.toString().c_str(), config.port);
+        return;
+    }
+    listening = true;
+    listenStart = millis();
+    LOG_I("StateMulticast: Listening on %s:%u", group.toString().c_str(), config.port);
+}
+
+void StateMulticast::stop() {
+    udp.close();
+    listening = false;
+    LOG_I("StateMulticast: Stopped listening");
+}
+
+// ============================================================================
+// Datagrams (run in the async_udp task)
+// ============================================================================
+
+bool StateMulticast::verify(const uint8_t* data, size_t len) const {
+    uint8_t mac[32];
+    if (mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), active.key, sizeof(active.key),
+                        data, len - TAG_SIZE, mac) != 0) {
+        return false;
+    }
+    // Constant time, so the tag can't be found a byte at a time
+    uint8_t diff = 0;
+    for (size_t i = 0; i < TAG_SIZE; i++) {
+        diff |= mac[i] ^ data[len - TAG_SIZE + i];
+    }
+    return diff == 0;
+}
+
+void StateMulticast::handlePacket(const uint8_t* data, size_t len) {
+    if (len < sizeof(DatagramHeader) + TAG_SIZE) {
+        rejected++;
+        return;
+    }
+    DatagramHeader h;
+    memcpy(&h, data, sizeof(h));
+    if (h.magic[0] != 'P' || h.magic[1] != 'S' || h.version != DATAGRAM_VERSION ||
+        len != sizeof(h) + h.count * sizeof(DatagramEntry) + TAG_SIZE || !verify(data, len)) {
+        rejected++;
+        return;
+    }
+    received++;
+    lastValid = millis();
+
+    // A new epoch is a restarted server, which pushes everything on reconnect
+    bool gap = false;
+    if (h.epoch != epoch) {
+        epoch = h.epoch;
+        lastSeq = h.seq;
+    } else if (h.count == 0) {
+        // Heartbeat: did we get the last one?
+        gap = h.seq > lastSeq;
+        if (gap) lastSeq = h.seq;
+    } else if (h.seq <= lastSeq) {
+        repeats++;
+        return;
+    } else {
+        gap = h.seq != lastSeq + 1;
+        lastSeq = h.seq;
+    }
+    if (gap) {
+        gaps++;
+        LOG_W("StateMulticast: Missed a datagram, asking for a full push");
+        serverChannel.send("{\"t\":\"resync\"}");
+    }
+
+    const uint8_t* p = data + sizeof(h);
+    for (uint8_t i = 0; i < h.count; i++, p += sizeof(DatagramEntry)) {
+        DatagramEntry e;
+        memcpy(&e, p, sizeof(e));
+        uint8_t ids[MAX_BUTTONS_PER_BINDING];
+        int n = configManager.findButtonsByBinding(e.bindingId, ids, MAX_BUTTONS_PER_BINDING);
+        for (int j = 0; j < n; j++) {
+            const ButtonConfig* btn = configManager.findButton(ids[j]);
+            bool fan = btn && btn->type == ButtonType::FAN && e.speedLevel != NO_SPEED;
+            if (deviceController.applyServerButton(ids[j], e.state != 0, fan ? e.speedLevel : -1)) {
+                applied++;
+            }
+        }
+    }
+}
+
+void StateMulticast::writeJson(Print& out) const {
+    char group[16];
+    snprintf(group, sizeof(group), "%u.%u.%u.%u", active.group[0], active.group[1], active.group[2], active.group[3]);
+    out.printf("{\"listening\":%s,\"advertised\":%s,\"group\":\"%s\",\"port\":%u,\"epoch\":%u,\"seq\":%u,"
+               "\"received\":%u,\"applied\":%u,\"repeats\":%u,\"rejected\":%u,\"gaps\":%u}",
+               listening ? "true" : "false", advertised ? "true" : "false", group, active.port,
+               epoch, lastSeq, received, applied, repeats, rejected, gaps);
+}
@@ -0,0 +1,335 @@
+#include "static_memory.h"
+#include "panel_log.h"
+#include <string.h>
+
+#if PANEL_STATIC_MEMORY
+#include "config_manager.h"
+#include "psram_budget.h"
+#include "screenshot.h"
+#include "web_server.h"
+#endif
+
+// Global instance
+StaticMemory staticMemory;
+
+static const char* const POOL_NAMES[STATIC_POOL_COUNT] = {
+    "json_small",
+    "json_large",
+    "http",
+    "web_body",
+    "config_body",
+    "screenshot"
+};
+
+#if PANEL_STATIC_MEMORY
+// Two large JSON slots: a config parse on the heavy lane next to a patch
+static const uint8_t POOL_SLOTS[STATIC_POOL_COUNT] = { 8, 2, 1, 4, 2, 2 };
+
+static uint32_t plannedSlotSize(int pool) {
+    switch (pool) {
+        case STATIC_POOL_JSON_SMALL:  return STATIC_JSON_SMALL_SLOT;
+        case STATIC_POOL_JSON_LARGE:  return CONFIG_DOC_MAX_SIZE + 64;
+        case STATIC_POOL_HTTP:        return STATIC_HTTP_SLOT;
+        case STATIC_POOL_WEB_BODY:    return MAX_SERVER_PAYLOAD_SIZE;
+        case STATIC_POOL_CONFIG_BODY: return MAX_CONFIG_PAYLOAD_SIZE;
+        case STATIC_POOL_SCREENSHOT:  return getScreenshotRgb565Size();
+        default:                      return 0;
+    }
+}
+#endif
+
+StaticMemory::StaticMemory()
+    : block(nullptr)
+    , blockSize(0)
+    , sealed(false)
+    , sealedAtMs(0)
+    , heapAllocs(0)
+    , heapBytes(0)
+    , isrAllocs(0)
+    , untrackedAllocs(0)
+    , taskCount(0)
+{
+    memset(pools, 0, sizeof(pools));
+    memset(tasks, 0, sizeof(tasks));
+    mux = portMUX_INITIALIZER_UNLOCKED;
+}
+
+void StaticMemory::begin() {
+#if PANEL_STATIC_MEMORY
+    if (block) return;
+
+    // Slots stay 8-aligned, like malloc() blocks
+    size_t total = 0;
+    for (int i = 0; i < STATIC_POOL_COUNT; i++) {
+        StaticPoolStats& s = pools[i].stats;
+        s.slotSize = (plannedSlotSize(i) + 7) & ~7u;
+        s.slots = POOL_SLOTS[i];
+        total += (size_t)s.slotSize * s.slots;
+    }
+
+    block = (uint8_t*)psramBudget.alloc(PSRAM_STATIC_POOLS, total, 8);
+    if (!block) {
+        LOG_E("StaticMemory: No room for %u KB of pools, every buffer uses the heap",
+              (unsigned)(total / 1024));
+        return;
+    }
+    blockSize = total;
+
+    uint8_t* at = block;
+    for (int i = 0; i < STATIC_POOL_COUNT; i++) {
+        Pool& p = pools[i];
+        p.base = at;
+        p.freeMask = p.stats.slots >= 32 ? 0xFFFFFFFFu : (1u << p.stats.slots) - 1;
+        at += (size_t)p.stats.slotSize * p.stats.slots;
+    }
+    LOG_I("StaticMemory: %u KB of pools reserved", (unsigned)(total / 1024));
+#endif
+}
+
+void StaticMemory::seal() {
+    sealedAtMs = millis();
+    sealed = true;
+#if PANEL_STATIC_MEMORY
+    LOG_I("StaticMemory: Setup done, heap allocations from here on are counted");
+#endif
+}
+
+void* StaticMemory::alloc(StaticPool pool, size_t size) {
+#if PANEL_STATIC_MEMORY
+    if (pool >= STATIC_POOL_COUNT) return nullptr;
+
+    Pool& p = pools[pool];
+    void* ptr = nullptr;
+    portENTER_CRITICAL(&mux);
+    if (p.base && size <= p.stats.slotSize && p.freeMask) {
+        int slot = __builtin_ctz(p.freeMask);
+        p.freeMask &= ~(1u << slot);
+        ptr = p.base + (size_t)slot * p.stats.slotSize;
+        p.stats.allocs++;
+        p.stats.used++;
+        if (p.stats.used > p.stats.peak) p.stats.peak = p.stats.used;
+    } else {
+        p.stats.overflows++;
+    }
+    portEXIT_CRITICAL(&mux);
+    return ptr;
+#else
+    (void)pool;
+    (void)size;
+    return nullptr;
+#endif
+}
+
+int StaticMemory::poolOf(const void* ptr) const {
+    const uint8_t* p = (const uint8_t*)ptr;
+    if (!block || p < block || p >= block + blockSize) return -1;
+
+    for (int i = 0; i < STATIC_POOL_COUNT; i++) {
+        const Pool& pool = pools[i];
+        if (p >= pool.base && p < pool.base + (size_t)pool.stats.slotSize * pool.stats.slots) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool StaticMemory::release(void* ptr) {
+    int i = poolOf(ptr);
+    if (i < 0) return false;
+
+    Pool& p = pools[i];
+    uint32_t bit = 1u << (((uint8_t*)ptr - p.base) / p.stats.slotSize);
+    portENTER_CRITICAL(&mux);
+    if (!(p.freeMask & bit)) {
+        p.freeMask |= bit;
+        p.stats.used--;
+    }
+    portEXIT_CRITICAL(&mux);
+    return true;
+}
+
+size_t StaticMemory::slotSize(const void* ptr) const {
+    int i = poolOf(ptr);
+    if (i < 0) return 0;
+
+    const Pool& p = pools[i];
+    return p.stats.slotSize - ((const uint8_t*)ptr - p.base) % p.stats.slotSize;
+}
+
+uint32_t StaticMemory::poolSlotSize(StaticPool pool) const {
+    return pool < STATIC_POOL_COUNT ? pools[pool].stats.slotSize : 0;
+}
+
+void StaticMemory::noteHeapAlloc(size_t size, void* caller) {
+    if (!sealed) return;
+
+#if PANEL_STATIC_MEMORY
+    // Nothing here may allocate: it runs inside malloc()
+    if (xPortInIsrContext()) {
+        isrAllocs++;
+        return;
+    }
+
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    portENTER_CRITICAL(&mux);
+    heapAllocs++;
+    heapBytes += size;
+
+    TaskAllocs* entry = nullptr;
+    for (uint8_t i = 0; i < taskCount; i++) {
+        if (tasks[i].task == task) {
+            entry = &tasks[i];
+            break;
+        }
+    }
+    if (!entry && taskCount < MAX_TASKS) {
+        entry = &tasks[taskCount++];
+        entry->task = task;
+        strncpy(entry->name, pcTaskGetName(task), sizeof(entry->name) - 1);
+        entry->firstCaller = caller;
+    }
+    if (entry) {
+        entry->allocs++;
+        entry->bytes += size;
+    } else {
+        untrackedAllocs++;
+    }
+    portEXIT_CRITICAL(&mux);
+#else
+    (void)size;
+    (void)caller;
+#endif
+}
+
+StaticPoolStats StaticMemory::getPoolStats(StaticPool pool) const {
+    StaticPoolStats s = {};
+    if (pool < STATIC_POOL_COUNT) {
+        portENTER_CRITICAL(&mux);
+        s = pools[pool].stats;
+        portEXIT_CRITICAL(&mux);
+    }
+    return s;
+}
+
+const char* StaticMemory::poolName(StaticPool pool) {
+    return pool < STATIC_POOL_COUNT ? POOL_NAMES[pool] : "unknown";
+}
+
+void StaticMemory::writeJson(Print& out) const {
+    if (!PANEL_STATIC_MEMORY) {
+        out.print("{\"enabled\":false}");
+        return;
+    }
+
+    // Copied first: printing allocates, and is counted like anything else
+    portENTER_CRITICAL(&mux);
+    Pool snapshot[STATIC_POOL_COUNT];
+    memcpy(snapshot, pools, sizeof(snapshot));
+    TaskAllocs byTask[MAX_TASKS];
+    uint8_t n = taskCount;
+    memcpy(byTask, tasks, sizeof(TaskAllocs) * n);
+    uint32_t allocs = heapAllocs;
+    uint32_t bytes = heapBytes;
+    uint32_t isr = isrAllocs;
+    uint32_t untracked = untrackedAllocs;
+    portEXIT_CRITICAL(&mux);
+
+    out.printf("{\"enabled\":true,\"sealed\":%s,\"sealed_at_ms\":%u,\"reserved\":%u,\"pools\":{",
+               sealed ? "true" : "false", sealedAtMs, (unsigned)blockSize);
+    for (int i = 0; i < STATIC_POOL_COUNT; i++) {
+        const StaticPoolStats& s = snapshot[i].stats;
+        out.printf("%s\"%s\":{\"slot\":%u,\"slots\":%u,\"used\":%u,\"peak\":%u,"
+                   "\"allocs\":%u,\"overflows\":%u}",
+                   i ? "," : "", POOL_NAMES[i], s.slotSize, s.slots, s.used, s.peak,
+                   s.allocs, s.overflows);
+    }
+
+    out.printf("},\"heap_after_setup\":{\"allocs\":%u,\"bytes\":%u,\"isr\":%u,\"untracked\":%u,\"tasks\":[",
+               allocs, bytes, isr, untracked);
+    for (uint8_t i = 0; i < n; i++) {
+        const TaskAllocs& t = byTask[i];
+        out.printf("%s{\"task\":\"%s\",\"allocs\":%u,\"bytes\":%u,\"first_caller\":\"%p\"}",
+                   i ? "," : "", t.name, t.allocs, t.bytes, t.firstCaller);
+    }
+    out.print("]}}");
+}
+
+void* poolMalloc(StaticPool pool, size_t size, uint32_t caps) {
+    void* ptr = staticMemory.alloc(pool, size);
+    return ptr ? ptr : heap_caps_malloc(size, caps);
+}
+
+#if PANEL_STATIC_MEMORY
+// Link-time wrappers (-Wl,--wrap=..., env:esp32s3-static). Calls inside the
+// heap component aren't redirected, so malloc() reaching heap_caps_malloc()
+// counts once. operator new calls malloc().
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+void* __real_heap_caps_malloc(size_t size, uint32_t caps);
+void* __real_heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void* __real_heap_caps_realloc(void* ptr, size_t size, uint32_t caps);
+
+void* __wrap_malloc(size_t size) {
+    staticMemory.noteHeapAlloc(size, __builtin_return_address(0));
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t n, size_t size) {
+    staticMemory.noteHeapAlloc(n * size, __builtin_return_address(0));
+    return __real_calloc(n, size);
+}
+
+void __wrap_free(void* ptr) {
+    if (!staticMemory.release(ptr)) {
+        __real_free(ptr);
+    }
+}
+
+// A slot keeps its place while it is big enough, else moves to the heap
+static void* reallocSlot(void* ptr, size_t size, uint32_t caps, void* caller) {
+    size_t room = staticMemory.slotSize(ptr);
+    if (size == 0) {
+        staticMemory.release(ptr);
+        return nullptr;
+    }
+    if (size <= room) return ptr;
+
+    staticMemory.noteHeapAlloc(size, caller);
+    void* moved = __real_heap_caps_malloc(size, caps);
+    if (moved) {
+        memcpy(moved, ptr, room);
+        staticMemory.release(ptr);
+    }
+    return moved;
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    if (staticMemory.slotSize(ptr)) {
+        return reallocSlot(ptr, size, MALLOC_CAP_DEFAULT, __builtin_return_address(0));
+    }
+    staticMemory.noteHeapAlloc(size, __builtin_return_address(0));
+    return __real_realloc(ptr, size);
+}
+
+void* __wrap_heap_caps_malloc(size_t size, uint32_t caps) {
+    staticMemory.noteHeapAlloc(size, __builtin_return_address(0));
+    return __real_heap_caps_malloc(size, caps);
+}
+
+void* __wrap_heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    staticMemory.noteHeapAlloc(n * size, __builtin_return_address(0));
+    return __real_heap_caps_calloc(n, size, caps);
+}
+
+void* __wrap_heap_caps_realloc(void* ptr, size_t size, uint32_t caps) {
+    if (staticMemory.slotSize(ptr)) {
+        return reallocSlot(ptr, size, caps, __builtin_return_address(0));
+    }
+    staticMemory.noteHeapAlloc(size, __builtin_return_address(0));
+    return __real_heap_caps_realloc(ptr, size, caps);
+}
+}
+#endif
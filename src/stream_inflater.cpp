@@ -0,0 +1,105 @@
+#include "stream_inflater.h"
+#include "psram_budget.h"
+#include <esp32s3/rom/miniz.h>
+
+struct StreamInflater::Workspace {
+    tinfl_decompressor inflater;
+    uint8_t dict[TINFL_LZ_DICT_SIZE];
+};
+
+// gzip header flags (RFC 1952)
+static const uint8_t GZIP_FHCRC = 0x02;
+static const uint8_t GZIP_FEXTRA = 0x04;
+static const uint8_t GZIP_FNAME = 0x08;
+static const uint8_t GZIP_FCOMMENT = 0x10;
+
+StreamInflater::StreamInflater()
+    : work(nullptr)
+    , flags(0)
+    , dictPos(0)
+    , availStart(0)
+    , availLen(0)
+    , inflateDone(false)
+{
+}
+
+StreamInflater::~StreamInflater() {
+    psramBudget.release(PSRAM_OTA, work, sizeof(Workspace));
+}
+
+bool StreamInflater::begin(bool zlibHeader) {
+    if (!work) {
+        work = (Workspace*)psramBudget.alloc(PSRAM_OTA, sizeof(Workspace));
+        if (!work) return false;
+    }
+    tinfl_init(&work->inflater);
+    flags = zlibHeader ? TINFL_FLAG_PARSE_ZLIB_HEADER : 0;
+    dictPos = availStart = availLen = 0;
+    inflateDone = false;
+    return true;
+}
+
+int StreamInflater::read(const uint8_t*& in, size_t& inLeft, bool moreInput, uint8_t* dst, size_t n) {
+    size_t copied = 0;
+
+    while (copied < n) {
+        if (availLen == 0) {
+            if (inflateDone) break;
+
+            // Output lands in the window at dictPos and wraps; only decode
+            // once everything already decoded has been read out
+            size_t inBytes = inLeft;
+            size_t outBytes = TINFL_LZ_DICT_SIZE - dictPos;
+            uint32_t decompFlags = flags | (moreInput ? TINFL_FLAG_HAS_MORE_INPUT : 0);
+            tinfl_status status = tinfl_decompress(&work->inflater, in, &inBytes,
+                                                   work->dict, work->dict + dictPos, &outBytes,
+                                                   decompFlags);
+            in += inBytes;
+            inLeft -= inBytes;
+
+            if (status < TINFL_STATUS_DONE) return -1;
+            if (status == TINFL_STATUS_DONE) inflateDone = true;
+
+            availStart = dictPos;
+            availLen = outBytes;
+            dictPos = (dictPos + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+
+            if (outBytes == 0 && !inflateDone) {
+                // Waiting for input that may still come, or a truncated stream
+                if (status == TINFL_STATUS_NEEDS_MORE_INPUT && moreInput) break;
+                return -1;
+            }
+            continue;
+        }
+
+        size_t take = n - copied < availLen ? n - copied : availLen;
+        memcpy(dst + copied, work->dict + availStart, take);
+        copied += take;
+        availStart += take;
+        availLen -= take;
+    }
+    return (int)copied;
+}
+
+size_t StreamInflater::gzipHeaderSize(const uint8_t* data, size_t len) {
+    if (len < 10 || data[0] != 0x1f || data[1] != 0x8b || data[2] != 8) return 0;
+
+    uint8_t flg = data[3];
+    size_t at = 10;
+    if (flg & GZIP_FEXTRA) {
+        if (at + 2 > len) return 0;
+        at += 2 + (data[at] | (data[at + 1] << 8));
+    }
+    if (flg & GZIP_FNAME) {
+        while (at < len && data[at] != 0) at++;
+        at++;
+    }
+    if (flg & GZIP_FCOMMENT) {
+        while (at < len && data[at] != 0) at++;
+        at++;
+    }
+    if (flg & GZIP_FHCRC) {
+        at += 2;
+    }
+    return at <= len ? at : 0;
+}
@@ -0,0 +1,268 @@
+#include "task_monitor.h"
+#include "event_scheduler.h"
+#include <esp_heap_caps.h>
+
+// Global instance
+TaskMonitor taskMonitor;
+
+#if configGENERATE_RUN_TIME_STATS
+#define TASK_MONITOR_RUN_TIME 1
+#else
+#define TASK_MONITOR_RUN_TIME 0
+#endif
+
+static const char* const STATE_NAMES[] = {
+    "running",
+    "ready",
+    "blocked",
+    "suspended",
+    "deleted"
+};
+
+static const char* stateName(uint8_t state) {
+    return state < sizeof(STATE_NAMES) / sizeof(STATE_NAMES[0]) ? STATE_NAMES[state] : "unknown";
+}
+
+// Tenths of a percent as "12.3"
+static int formatPermille(char* buf, size_t len, uint16_t permille) {
+    return snprintf(buf, len, "%u.%u", permille / 10, permille % 10);
+}
+
+TaskMonitor::TaskMonitor()
+    : status(nullptr)
+    , tasks(nullptr)
+    , spare(nullptr)
+    , taskCount(0)
+    , totalRunTime(0)
+    , windowMs(0)
+    , sampledAt(0)
+    , overflowed(false)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , lastSample(0)
+    , sampleJob(-1)
+{
+    memset(coreLoadPermille, 0, sizeof(coreLoadPermille));
+}
+
+void TaskMonitor::begin() {
+#if configUSE_TRACE_FACILITY
+    // Read under vTaskSuspendAll(), keep it in internal RAM
+    status = (TaskStatus_t*)heap_caps_malloc(MAX_TASKS * sizeof(TaskStatus_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    tasks = (TaskStat*)malloc(MAX_TASKS * sizeof(TaskStat));
+    spare = (TaskStat*)malloc(MAX_TASKS * sizeof(TaskStat));
+    if (!status || !tasks || !spare) {
+        Serial.println("TaskMonitor: Failed to allocate snapshot buffers");
+        free(status);
+        free(tasks);
+        free(spare);
+        status = nullptr;
+        tasks = nullptr;
+        spare = nullptr;
+        return;
+    }
+
+    takeSample();
+    lastSample = millis();
+    sampleJob = eventScheduler.add("task_sample", onSampleTimer, this);
+    eventScheduler.schedule(sampleJob, SAMPLE_INTERVAL_MS);
+    Serial.printf("TaskMonitor: %u tasks, run-time stats %s\n",
+                  taskCount, TASK_MONITOR_RUN_TIME ? "on" : "off (stacks only)");
+#else
+    Serial.println("TaskMonitor: configUSE_TRACE_FACILITY off, task stats unavailable");
+#endif
+}
+
+void TaskMonitor::onSampleTimer(void* arg) {
+    TaskMonitor* self = (TaskMonitor*)arg;
+    eventScheduler.schedule(self->sampleJob, SAMPLE_INTERVAL_MS);
+
+    // The job runs a little late at times; CPU shares use the real window
+    unsigned long now = millis();
+    self->windowMs = now - self->lastSample;
+    self->lastSample = now;
+    self->takeSample();
+}
+
+bool TaskMonitor::hasRunTimeStats() const {
+    return TASK_MONITOR_RUN_TIME;
+}
+
+// ============================================================================
+// Sampling
+// ============================================================================
+
+void TaskMonitor::takeSample() {
+#if configUSE_TRACE_FACILITY
+    uint32_t total = 0;
+    UBaseType_t n = uxTaskGetSystemState(status, MAX_TASKS, &total);
+    if (n == 0) {
+        // The array has to hold every task or nothing is returned
+        if (!overflowed) {
+            Serial.printf("TaskMonitor: More than %u tasks, raise MAX_TASKS\n", MAX_TASKS);
+        }
+        overflowed = true;
+        return;
+    }
+    overflowed = false;
+
+    // tasks is only ever replaced below, so reading it here needs no lock
+    uint32_t window = total - totalRunTime;
+    TaskStat* next = spare;
+    uint16_t idlePermille[portNUM_PROCESSORS] = {};
+    TaskHandle_t idle[portNUM_PROCESSORS];
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        idle[core] = xTaskGetIdleTaskHandleForCPU(core);
+    }
+
+    for (UBaseType_t i = 0; i < n; i++) {
+        const TaskStatus_t& st = status[i];
+        TaskStat& t = next[i];
+        strlcpy(t.name, st.pcTaskName, sizeof(t.name));
+        t.handle = st.xHandle;
+        t.stackFree = st.usStackHighWaterMark;   // StackType_t is a byte on ESP32
+        t.priority = st.uxCurrentPriority;
+        t.state = st.eCurrentState;
+        BaseType_t affinity = xTaskGetAffinity(st.xHandle);
+        t.core = (affinity == tskNO_AFFINITY) ? -1 : (int8_t)affinity;
+
+#if TASK_MONITOR_RUN_TIME
+        t.runTime = st.ulRunTimeCounter;
+
+        // Tasks created during the interval count from zero
+        uint32_t before = 0;
+        for (uint8_t j = 0; j < taskCount; j++) {
+            if (tasks[j].handle == st.xHandle) {
+                before = tasks[j].runTime <= t.runTime ? tasks[j].runTime : 0;
+                break;
+            }
+        }
+        uint64_t permille = window ? (uint64_t)(t.runTime - before) * 1000 / window : 0;
+        t.cpuPermille = permille > 1000 ? 1000 : permille;
+
+        for (int core = 0; core < portNUM_PROCESSORS; core++) {
+            if (st.xHandle == idle[core]) {
+                idlePermille[core] = t.cpuPermille;
+            }
+        }
+#else
+        t.runTime = 0;
+        t.cpuPermille = 0;
+#endif
+    }
+
+    portENTER_CRITICAL(&mux);
+    spare = tasks;
+    tasks = next;
+    taskCount = n;
+    totalRunTime = total;
+    sampledAt = millis() / 1000;
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        coreLoadPermille[core] = 1000 - idlePermille[core];
+    }
+    portEXIT_CRITICAL(&mux);
+#endif
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+void TaskMonitor::writeJson(Print& out) const {
+    TaskStat snapshot[MAX_TASKS];
+    uint16_t load[portNUM_PROCESSORS];
+
+    portENTER_CRITICAL(&mux);
+    uint8_t n = tasks ? taskCount : 0;
+    if (n) {
+        memcpy(snapshot, tasks, n * sizeof(TaskStat));
+    }
+    memcpy(load, coreLoadPermille, sizeof(load));
+    uint32_t at = sampledAt;
+    uint32_t window = windowMs;
+    portEXIT_CRITICAL(&mux);
+
+    bool cpu = TASK_MONITOR_RUN_TIME && window > 0;
+    char pct[8];
+
+    out.printf("{\"uptime_s\":%lu,\"sampled_at_s\":%u,\"interval_ms\":%lu,\"window_ms\":%u,"
+               "\"run_time_stats\":%s,\"overflow\":%s,\"core_load_pct\":",
+               millis() / 1000, at, SAMPLE_INTERVAL_MS, window,
+               TASK_MONITOR_RUN_TIME ? "true" : "false", overflowed ? "true" : "false");
+    if (cpu) {
+        out.print("[");
+        for (int core = 0; core < portNUM_PROCESSORS; core++) {
+            formatPermille(pct, sizeof(pct), load[core]);
+            out.printf("%s%s", core ? "," : "", pct);
+        }
+        out.print("]");
+    } else {
+        out.print("null");
+    }
+
+    out.print(",\"tasks\":[");
+    for (uint8_t i = 0; i < n; i++) {
+        const TaskStat& t = snapshot[i];
+        if (cpu) {
+            formatPermille(pct, sizeof(pct), t.cpuPermille);
+        } else {
+            strcpy(pct, "null");
+        }
+        out.printf("%s{\"name\":\"%s\",\"core\":%d,\"priority\":%u,\"state\":\"%s\","
+                   "\"stack_free\":%u,\"cpu_pct\":%s}",
+                   i ? "," : "", t.name, t.core, t.priority, stateName(t.state),
+                   t.stackFree, pct);
+    }
+    out.print("]}");
+}
+
+size_t TaskMonitor::writeHeartbeat(char* buf, size_t len) const {
+    TaskStat snapshot[MAX_TASKS];
+    uint16_t load[portNUM_PROCESSORS];
+
+    portENTER_CRITICAL(&mux);
+    uint8_t n = tasks ? taskCount : 0;
+    if (n) {
+        memcpy(snapshot, tasks, n * sizeof(TaskStat));
+    }
+    memcpy(load, coreLoadPermille, sizeof(load));
+    uint32_t window = windowMs;
+    portEXIT_CRITICAL(&mux);
+
+    if (n == 0) {
+        return 0;
+    }
+
+    // [name, core, cpu_pct, stack_free] per task
+    bool cpu = TASK_MONITOR_RUN_TIME && window > 0;
+    char pct[8];
+    int written = snprintf(buf, len, "{\"window_ms\":%u,\"core_load_pct\":", window);
+    if (cpu) {
+        for (int core = 0; core < portNUM_PROCESSORS && written > 0 && (size_t)written < len; core++) {
+            formatPermille(pct, sizeof(pct), load[core]);
+            written += snprintf(buf + written, len - written, "%s%s", core ? "," : "[", pct);
+        }
+        if (written > 0 && (size_t)written < len) {
+            written += snprintf(buf + written, len - written, "]");
+        }
+    } else if (written > 0 && (size_t)written < len) {
+        written += snprintf(buf + written, len - written, "null");
+    }
+    if (written > 0 && (size_t)written < len) {
+        written += snprintf(buf + written, len - written, ",\"tasks\":[");
+    }
+
+    for (uint8_t i = 0; i < n && written > 0 && (size_t)written < len; i++) {
+        const TaskStat& t = snapshot[i];
+        if (cpu) {
+            formatPermille(pct, sizeof(pct), t.cpuPermille);
+        } else {
+            strcpy(pct, "null");
+        }
+        written += snprintf(buf + written, len - written, "%s[\"%s\",%d,%s,%u]",
+                            i ? "," : "", t.name, t.core, pct, t.stackFree);
+    }
+    if (written > 0 && (size_t)written < len) {
+        written += snprintf(buf + written, len - written, "]}");
+    }
+    return (written > 0 && (size_t)written < len) ? written : 0;
+}
@@ -1,4 +1,5 @@
 #include "theme_engine.h"
+#include "config_manager.h"
 
 // Global instance
 ThemeEngine themeEngine;
@@ -217,27 +218,32 @@ LCARSColorScheme ThemeEngine::lcars_tactical = {
 // ThemeEngine Implementation
 // ============================================================================
 
-ThemeEngine::ThemeEngine() : currentTheme(ThemeId::DARK_CLEAN) {
+static_assert(ThemeEngine::CUSTOM_THEME_SLOTS == MAX_CUSTOM_THEMES, "one slot per config theme");
+static_assert((int)ThemeId::CUSTOM_3 == (int)ThemeId::CUSTOM_0 + ThemeEngine::CUSTOM_THEME_SLOTS - 1,
+              "one ThemeId per slot");
+
+ThemeEngine::ThemeEngine()
+    : currentTheme(ThemeId::DARK_CLEAN)
+    , stylesInitialized(false)
+    , stylesTheme(ThemeId::DARK_CLEAN)
+    , stylesRevision(0)
+{
+    for (uint8_t i = 0; i < CUSTOM_THEME_SLOTS; i++) {
+        CustomTheme& slot = customThemes[i];
+        slot.used = false;
+        slot.name[0] = '\0';
+        slot.source = 0;
+        slot.revision = 0;
+        memset(&slot.definition, 0, sizeof(slot.definition));
+        slot.definition.id = (ThemeId)((int)ThemeId::CUSTOM_0 + i);
+        slot.definition.name = slot.name;
+    }
 }
 
 void ThemeEngine::begin() {
     Serial.println("ThemeEngine: Initialized");
 }
 
-bool ThemeEngine::setTheme(const String& themeName) {
-    Serial.printf("ThemeEngine: setTheme called with '%s'\n", themeName.c_str());
-
-    const ThemeDefinition* theme = getThemeByName(themeName);
-    if (theme) {
-        currentTheme = theme->id;
-        Serial.printf("ThemeEngine: Set currentTheme to id=%d (name=%s)\n",
-                      (int)currentTheme, theme->name);
-        return true;
-    }
-    Serial.printf("ThemeEngine: Unknown theme '%s', keeping current\n", themeName.c_str());
-    return false;
-}
-
 void ThemeEngine::setTheme(ThemeId id) {
     currentTheme = id;
     Serial.printf("ThemeEngine: Set theme to ID %d\n", (int)id);
@@ -255,11 +261,37 @@ const ThemeDefinition& ThemeEngine::getCurrentTheme() const {
     return getThemeById(currentTheme);
 }
 
+const ThemeDefinition* ThemeEngine::getBuiltinByName(const char* name) {
+    if (strcmp(name, "light_mode") == 0) return &lightModeTheme;
+    if (strcmp(name, "neon_cyberpunk") == 0) return &neonCyberpunkTheme;
+    if (strcmp(name, "dark_mode") == 0) return &darkCleanTheme;
+    if (strcmp(name, "lcars") == 0) return &lcarsTheme;
+    return nullptr;
+}
+
+bool ThemeEngine::isBuiltinTheme(const char* name) {
+    return getBuiltinByName(name) != nullptr;
+}
+
+bool ThemeEngine::findBuiltinTheme(const char* name, ThemeId& id) {
+    const ThemeDefinition* builtin = getBuiltinByName(name);
+    if (!builtin) return false;
+    id = builtin->id;
+    return true;
+}
+
 const ThemeDefinition* ThemeEngine::getThemeByName(const String& name) const {
-    if (name == "light_mode") return &lightModeTheme;
-    if (name == "neon_cyberpunk") return &neonCyberpunkTheme;
-    if (name == "dark_mode") return &darkCleanTheme;
-    if (name == "lcars") return &lcarsTheme;
+    const ThemeDefinition* builtin = getBuiltinByName(name.c_str());
+    if (builtin) return builtin;
+
+    // Custom themes are found through the config, so any task can resolve
+    // a name; the slot (and so the id) is the theme's position there. The
+    // definition is compiled by the LVGL task before it is shown.
+    ConfigSnapshot snapshot;
+    const FixedVector<CustomThemeConfig, MAX_CUSTOM_THEMES>& themes = snapshot->display.themes;
+    for (size_t i = 0; i < themes.size(); i++) {
+        if (name == themes[i].name.c_str()) return &customThemes[i].definition;
+    }
     return nullptr;
 }
 
@@ -268,6 +300,13 @@ const ThemeDefinition& ThemeEngine::getThemeById(ThemeId id) const {
         case ThemeId::LIGHT_MODE: return lightModeTheme;
         case ThemeId::NEON_CYBERPUNK: return neonCyberpunkTheme;
         case ThemeId::LCARS: return lcarsTheme;
+        case ThemeId::CUSTOM_0:
+        case ThemeId::CUSTOM_1:
+        case ThemeId::CUSTOM_2:
+        case ThemeId::CUSTOM_3: {
+            const CustomTheme& slot = customThemes[(int)id - (int)ThemeId::CUSTOM_0];
+            return slot.used ? slot.definition : darkCleanTheme;
+        }
         case ThemeId::DARK_CLEAN:
         default: return darkCleanTheme;
     }
@@ -289,6 +328,252 @@ bool ThemeEngine::isCyberpunk() const {
     return getCurrentTheme().style.isCyberpunk;
 }
 
+bool ThemeEngine::sharesLayout(ThemeId a, ThemeId b) const {
+    const ThemeStyle& sa = getThemeById(a).style;
+    const ThemeStyle& sb = getThemeById(b).style;
+    return sa.isLCARS == sb.isLCARS &&
+           sa.isCyberpunk == sb.isCyberpunk &&
+           sa.showStatusText == sb.showStatusText;
+}
+
+
+// ============================================================================
+// Custom Themes
+// ============================================================================
+
+uint32_t ThemeEngine::hashDescriptor(const CustomThemeConfig& theme) {
+    // FNV-1a over everything compileDescriptor() reads
+    uint32_t hash = 2166136261u;
+    auto mix = [&hash](const void* data, size_t len) {
+        const uint8_t* p = (const uint8_t*)data;
+        for (size_t i = 0; i < len; i++) {
+            hash = (hash ^ p[i]) * 16777619u;
+        }
+    };
+    mix(theme.name.c_str(), theme.name.length() + 1);
+    mix(theme.base.c_str(), theme.base.length() + 1);
+    mix(&theme.colorMask, sizeof(theme.colorMask));
+    mix(&theme.paletteMask, sizeof(theme.paletteMask));
+    mix(&theme.shapeMask, sizeof(theme.shapeMask));
+    mix(&theme.flagMask, sizeof(theme.flagMask));
+    mix(&theme.flags, sizeof(theme.flags));
+    mix(theme.colors, sizeof(theme.colors));
+    mix(theme.palette, sizeof(theme.palette));
+    mix(theme.shapes, sizeof(theme.shapes));
+    return hash;
+}
+
+void ThemeEngine::compileDescriptor(const CustomThemeConfig& theme, ThemeDefinition& out) {
+    const ThemeDefinition* base = getBuiltinByName(theme.base.c_str());
+    out = base ? *base : darkCleanTheme;
+
+    lv_color_t* colors[THEME_COLOR_COUNT] = {
+        &out.colors.background, &out.colors.cardBackground, &out.colors.cardHover,
+        &out.colors.onState, &out.colors.offState, &out.colors.textPrimary,
+        &out.colors.textSecondary, &out.colors.accent, &out.colors.border,
+        &out.colors.shadow
+    };
+    for (uint8_t i = 0; i < THEME_COLOR_COUNT; i++) {
+        if (theme.colorMask & (1 << i)) *colors[i] = lv_color_hex(theme.colors[i]);
+    }
+    for (uint8_t i = 0; i < THEME_PALETTE_SIZE; i++) {
+        if (theme.paletteMask & (1 << i)) out.colors.neonColors[i] = lv_color_hex(theme.palette[i]);
+    }
+
+    uint8_t* shapes[THEME_SHAPE_COUNT] = {
+        &out.style.cardRadius, &out.style.buttonRadius, &out.style.borderWidth,
+        &out.style.shadowWidth, &out.style.shadowOffsetY, &out.style.shadowSpread,
+        &out.style.shadowOpacity
+    };
+    for (uint8_t i = 0; i < THEME_SHAPE_COUNT; i++) {
+        if (theme.shapeMask & (1 << i)) *shapes[i] = theme.shapes[i];
+    }
+
+    // LCARS and Cyberpunk stay with the base: they pick the widget tree
+    if (theme.flagMask & THEME_FLAG_STATUS_TEXT) {
+        out.style.showStatusText = theme.flags & THEME_FLAG_STATUS_TEXT;
+    }
+    if (theme.flagMask & THEME_FLAG_GLOWING_BORDERS) {
+        out.style.glowingBorders = theme.flags & THEME_FLAG_GLOWING_BORDERS;
+    }
+}
+
+void ThemeEngine::setCustomThemes(const CustomThemeConfig* themes, size_t count) {
+    for (uint8_t i = 0; i < CUSTOM_THEME_SLOTS; i++) {
+        CustomTheme& slot = customThemes[i];
+        if (i >= count) {
+            if (slot.used) {
+                slot.used = false;
+                slot.revision++;
+            }
+            continue;
+        }
+
+        uint32_t source = hashDescriptor(themes[i]);
+        if (slot.used && slot.source == source) {
+            continue;
+        }
+        snprintf(slot.name, sizeof(slot.name), "%s", themes[i].name.c_str());
+        compileDescriptor(themes[i], slot.definition);
+        slot.definition.id = (ThemeId)((int)ThemeId::CUSTOM_0 + i);
+        slot.definition.name = slot.name;
+        slot.used = true;
+        slot.source = source;
+        slot.revision++;
+        Serial.printf("ThemeEngine: Compiled theme '%s' (based on %s)\n",
+                      slot.name, themes[i].base.c_str());
+    }
+}
+
+uint32_t ThemeEngine::getRevision(ThemeId id) const {
+    int slot = (int)id - (int)ThemeId::CUSTOM_0;
+    if (slot < 0 || slot >= CUSTOM_THEME_SLOTS) return 0;
+    return customThemes[slot].revision;
+}
+
+
+// ============================================================================
+// Shared Styles
+// ============================================================================
+
+// True if `style` is already attached to `obj` with this selector
+static bool hasStyle(lv_obj_t* obj, const lv_style_t* style, lv_style_selector_t selector) {
+    for (uint32_t i = 0; i < obj->style_cnt; i++) {
+        if (obj->styles[i].style == style && obj->styles[i].selector == selector) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Attach a shared style once (re-adding would stack duplicates)
+static void addStyleOnce(lv_obj_t* obj, lv_style_t* style, lv_style_selector_t selector) {
+    if (!hasStyle(obj, style, selector)) {
+        lv_obj_add_style(obj, style, selector);
+    }
+}
+
+void ThemeEngine::ensureStyles() {
+    uint32_t revision = getRevision(currentTheme);
+    if (stylesInitialized && stylesTheme == currentTheme && stylesRevision == revision) {
+        return;
+    }
+
+    lv_style_t* all[] = {
+        &styles.screen, &styles.card,
+        &styles.buttonPrimary, &styles.buttonSecondary,
+        &styles.switchMain, &styles.switchIndicator, &styles.switchKnob,
+        &styles.labelPrimary, &styles.labelSecondary,
+        &styles.header, &styles.actionBar
+    };
+
+    if (!stylesInitialized) {
+        for (lv_style_t* st : all) lv_style_init(st);
+        for (lv_style_t& st : styles.cardGlow) lv_style_init(&st);
+    } else {
+        for (lv_style_t* st : all) lv_style_reset(st);
+        for (lv_style_t& st : styles.cardGlow) lv_style_reset(&st);
+    }
+
+    const ThemeDefinition& theme = getCurrentTheme();
+
+    // Screen background
+    lv_style_set_bg_color(&styles.screen, theme.colors.background);
+    lv_style_set_bg_opa(&styles.screen, LV_OPA_COVER);
+
+    // Card base (off state)
+    lv_style_set_bg_color(&styles.card, theme.colors.cardBackground);
+    lv_style_set_bg_opa(&styles.card, LV_OPA_COVER);
+    lv_style_set_radius(&styles.card, theme.style.cardRadius);
+    lv_style_set_pad_all(&styles.card, 0);
+    if (theme.style.borderWidth > 0) {
+        lv_style_set_border_width(&styles.card, theme.style.borderWidth);
+        lv_style_set_border_color(&styles.card, theme.colors.border);
+    }
+    lv_style_set_shadow_width(&styles.card, theme.style.shadowWidth);
+    lv_style_set_shadow_opa(&styles.card, theme.style.shadowOpacity);
+    lv_style_set_shadow_ofs_y(&styles.card, theme.style.shadowOffsetY);
+    lv_style_set_shadow_color(&styles.card, theme.colors.shadow);
+
+#if LV_SHADOW_CACHE_SIZE
+    // Larger shadows bypass LVGL's corner cache and are recomputed every draw
+    if (theme.style.shadowWidth + theme.style.cardRadius > LV_SHADOW_CACHE_SIZE) {
+        Serial.printf("ThemeEngine: WARNING - '%s' card shadow (%d) exceeds LV_SHADOW_CACHE_SIZE (%d)\n",
+                      theme.name, theme.style.shadowWidth + theme.style.cardRadius, LV_SHADOW_CACHE_SIZE);
+    }
+#endif
+
+    // Card "on" glow, layered over the base for neon themes
+    if (theme.style.glowingBorders) {
+        for (int i = 0; i < 9; i++) {
+            lv_color_t neonColor = theme.colors.neonColors[i];
+            if (theme.style.borderWidth > 0) {
+                lv_style_set_border_color(&styles.cardGlow[i], neonColor);
+            }
+            lv_style_set_shadow_color(&styles.cardGlow[i], neonColor);
+            lv_style_set_shadow_spread(&styles.cardGlow[i], theme.style.shadowSpread);
+        }
+    }
+
+    // Buttons
+    lv_style_set_radius(&styles.buttonPrimary, theme.style.buttonRadius);
+    lv_style_set_shadow_width(&styles.buttonPrimary, 0);
+    lv_style_set_bg_color(&styles.buttonPrimary, theme.colors.accent);
+    lv_style_set_radius(&styles.buttonSecondary, theme.style.buttonRadius);
+    lv_style_set_shadow_width(&styles.buttonSecondary, 0);
+    lv_style_set_bg_color(&styles.buttonSecondary, theme.colors.offState);
+
+    // Switch parts
+    lv_style_set_bg_color(&styles.switchMain, theme.colors.offState);
+    lv_style_set_bg_color(&styles.switchIndicator, theme.colors.onState);
+    lv_style_set_bg_color(&styles.switchKnob, lv_color_hex(0xffffff));
+    lv_style_set_pad_all(&styles.switchKnob, -2);
+
+    // Labels
+    lv_style_set_text_color(&styles.labelPrimary, theme.colors.textPrimary);
+    lv_style_set_text_color(&styles.labelSecondary, theme.colors.textSecondary);
+
+    // Header with shadow below
+    lv_style_set_bg_color(&styles.header, theme.colors.cardBackground);
+    lv_style_set_bg_opa(&styles.header, LV_OPA_COVER);
+    lv_style_set_pad_all(&styles.header, 0);
+    lv_style_set_border_width(&styles.header, 0);
+    lv_style_set_shadow_width(&styles.header, 12);
+    lv_style_set_shadow_color(&styles.header, theme.colors.shadow);
+    lv_style_set_shadow_opa(&styles.header, LV_OPA_40);
+    lv_style_set_shadow_ofs_y(&styles.header, 2);
+
+    // Action bar - Cyberpunk uses a transparent, sharp-cornered bar
+    lv_style_set_bg_color(&styles.actionBar, theme.colors.cardBackground);
+    if (theme.style.isCyberpunk) {
+        lv_style_set_radius(&styles.actionBar, 0);
+        lv_style_set_bg_opa(&styles.actionBar, LV_OPA_TRANSP);
+        lv_style_set_shadow_width(&styles.actionBar, 0);
+    } else {
+        lv_style_set_bg_opa(&styles.actionBar, LV_OPA_COVER);
+        lv_style_set_radius(&styles.actionBar, 30);
+        lv_style_set_shadow_width(&styles.actionBar, 15);
+        lv_style_set_shadow_color(&styles.actionBar, theme.colors.shadow);
+        lv_style_set_shadow_opa(&styles.actionBar, LV_OPA_30);
+    }
+    lv_style_set_pad_all(&styles.actionBar, 0);
+    if (theme.style.borderWidth > 0 && !theme.style.isCyberpunk) {
+        lv_style_set_border_width(&styles.actionBar, theme.style.borderWidth);
+        lv_style_set_border_color(&styles.actionBar, theme.colors.border);
+    } else {
+        lv_style_set_border_width(&styles.actionBar, 0);
+    }
+
+    // Objects still holding the previous theme's styles pick up the new values
+    if (stylesInitialized) {
+        lv_obj_report_style_change(NULL);
+    }
+
+    stylesInitialized = true;
+    stylesTheme = currentTheme;
+    stylesRevision = revision;
+    Serial.printf("ThemeEngine: Built shared styles for '%s'\n", theme.name);
+}
 
 void ThemeEngine::applyToScreen(lv_obj_t* screen) {
     const ThemeDefinition& theme = getCurrentTheme();
@@ -297,134 +582,75 @@ void ThemeEngine::applyToScreen(lv_obj_t* screen) {
                   theme.name, (int)currentTheme,
                   (unsigned int)lv_color_to32(theme.colors.background));
 
-    lv_obj_set_style_bg_color(screen, theme.colors.background, 0);
-    lv_obj_set_style_bg_opa(screen, LV_OPA_COVER, 0);
+    ensureStyles();
+    addStyleOnce(screen, &styles.screen, 0);
 }
 
 void ThemeEngine::styleCard(lv_obj_t* obj, bool isOn, int colorIndex) {
     const ThemeDefinition& theme = getCurrentTheme();
+    ensureStyles();
 
-    // Don't use lv_obj_remove_style_all() as it can reset position/size
-    // Instead, set each style property explicitly
-    lv_obj_set_style_bg_color(obj, theme.colors.cardBackground, 0);
-    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(obj, theme.style.cardRadius, 0);
-    lv_obj_set_style_pad_all(obj, 0, 0);  // Remove default padding
+    // Drop local background overrides (e.g. left by the scene flash animation)
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_BG_COLOR, 0);
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_BG_OPA, 0);
+
+    addStyleOnce(obj, &styles.card, 0);
     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);  // Disable scrolling
 
-    // Border
-    if (theme.style.borderWidth > 0) {
-        lv_obj_set_style_border_width(obj, theme.style.borderWidth, 0);
-
-        if (theme.style.glowingBorders && isOn) {
-            // Glowing border for neon theme
-            lv_color_t neonColor = theme.colors.neonColors[colorIndex % 9];
-            lv_obj_set_style_border_color(obj, neonColor, 0);
-        } else {
-            lv_obj_set_style_border_color(obj, theme.colors.border, 0);
+    // State toggle is a glow-style swap, the base style stays attached
+    lv_style_t* glow = (theme.style.glowingBorders && isOn) ? &styles.cardGlow[colorIndex % 9] : nullptr;
+    for (lv_style_t& st : styles.cardGlow) {
+        if (&st != glow && hasStyle(obj, &st, 0)) {
+            lv_obj_remove_style(obj, &st, 0);
         }
     }
-
-    // Shadow/glow
-    lv_obj_set_style_shadow_width(obj, theme.style.shadowWidth, 0);
-    lv_obj_set_style_shadow_opa(obj, theme.style.shadowOpacity, 0);
-    lv_obj_set_style_shadow_ofs_y(obj, theme.style.shadowOffsetY, 0);
-
-    if (theme.style.glowingBorders && isOn) {
-        // Glow effect for neon theme
-        lv_color_t neonColor = theme.colors.neonColors[colorIndex % 9];
-        lv_obj_set_style_shadow_color(obj, neonColor, 0);
-        lv_obj_set_style_shadow_spread(obj, theme.style.shadowSpread, 0);
-    } else {
-        lv_obj_set_style_shadow_color(obj, theme.colors.shadow, 0);
+    if (glow) {
+        addStyleOnce(obj, glow, 0);
     }
 }
 
 void ThemeEngine::styleButton(lv_obj_t* btn, bool isPrimary) {
-    const ThemeDefinition& theme = getCurrentTheme();
-
-    lv_obj_set_style_radius(btn, theme.style.buttonRadius, 0);
-    lv_obj_set_style_shadow_width(btn, 0, 0);
+    ensureStyles();
 
-    if (isPrimary) {
-        lv_obj_set_style_bg_color(btn, theme.colors.accent, 0);
-    } else {
-        lv_obj_set_style_bg_color(btn, theme.colors.offState, 0);
-    }
+    lv_obj_remove_style(btn, isPrimary ? &styles.buttonSecondary : &styles.buttonPrimary, 0);
+    addStyleOnce(btn, isPrimary ? &styles.buttonPrimary : &styles.buttonSecondary, 0);
 }
 
 void ThemeEngine::styleSwitch(lv_obj_t* sw) {
-    const ThemeDefinition& theme = getCurrentTheme();
+    ensureStyles();
 
-    lv_obj_set_style_bg_color(sw, theme.colors.offState, 0);
-    lv_obj_set_style_bg_color(sw, theme.colors.onState, LV_PART_INDICATOR | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_color(sw, lv_color_hex(0xffffff), LV_PART_KNOB);
-    lv_obj_set_style_pad_all(sw, -2, LV_PART_KNOB);
+    addStyleOnce(sw, &styles.switchMain, 0);
+    addStyleOnce(sw, &styles.switchIndicator, LV_PART_INDICATOR | LV_STATE_CHECKED);
+    addStyleOnce(sw, &styles.switchKnob, LV_PART_KNOB);
 }
 
 void ThemeEngine::styleLabel(lv_obj_t* label, bool isPrimary) {
-    const ThemeDefinition& theme = getCurrentTheme();
+    ensureStyles();
 
-    if (isPrimary) {
-        lv_obj_set_style_text_color(label, theme.colors.textPrimary, 0);
-    } else {
-        lv_obj_set_style_text_color(label, theme.colors.textSecondary, 0);
-    }
+    lv_obj_remove_style(label, isPrimary ? &styles.labelSecondary : &styles.labelPrimary, 0);
+    addStyleOnce(label, isPrimary ? &styles.labelPrimary : &styles.labelSecondary, 0);
 }
 
 void ThemeEngine::styleHeader(lv_obj_t* header) {
-    const ThemeDefinition& theme = getCurrentTheme();
+    ensureStyles();
 
-    // Set styles without removing all (preserves position/size)
-    lv_obj_set_style_bg_color(header, theme.colors.cardBackground, 0);
-    lv_obj_set_style_bg_opa(header, LV_OPA_COVER, 0);
-    lv_obj_set_style_pad_all(header, 0, 0);
-    lv_obj_set_style_border_width(header, 0, 0);
+    addStyleOnce(header, &styles.header, 0);
     lv_obj_clear_flag(header, LV_OBJ_FLAG_SCROLLABLE);
-
-    // Shadow below header
-    lv_obj_set_style_shadow_width(header, 12, 0);
-    lv_obj_set_style_shadow_color(header, theme.colors.shadow, 0);
-    lv_obj_set_style_shadow_opa(header, LV_OPA_40, 0);
-    lv_obj_set_style_shadow_ofs_y(header, 2, 0);
 }
 
 void ThemeEngine::styleActionBar(lv_obj_t* bar) {
-    const ThemeDefinition& theme = getCurrentTheme();
-
-    // Set styles without removing all (preserves position/size)
-    lv_obj_set_style_bg_color(bar, theme.colors.cardBackground, 0);
-    lv_obj_set_style_bg_opa(bar, LV_OPA_COVER, 0);
-
-    // Cyberpunk theme uses sharp corners, others use rounded
-    if (theme.style.isCyberpunk) {
-        lv_obj_set_style_radius(bar, 0, 0);
-        // Make it transparent to remove the background entirely
-        lv_obj_set_style_bg_opa(bar, LV_OPA_TRANSP, 0);
-        lv_obj_set_style_shadow_width(bar, 0, 0);
-    } else {
-        lv_obj_set_style_radius(bar, 30, 0);
-        lv_obj_set_style_shadow_width(bar, 15, 0);
-        lv_obj_set_style_shadow_color(bar, theme.colors.shadow, 0);
-        lv_obj_set_style_shadow_opa(bar, LV_OPA_30, 0);
-    }
+    ensureStyles();
 
-    lv_obj_set_style_pad_all(bar, 0, 0);
+    addStyleOnce(bar, &styles.actionBar, 0);
     lv_obj_clear_flag(bar, LV_OBJ_FLAG_SCROLLABLE);
-
-    if (theme.style.borderWidth > 0 && !theme.style.isCyberpunk) {
-        lv_obj_set_style_border_width(bar, theme.style.borderWidth, 0);
-        lv_obj_set_style_border_color(bar, theme.colors.border, 0);
-    } else {
-        lv_obj_set_style_border_width(bar, 0, 0);
-    }
 }
 
 lv_color_t ThemeEngine::getIconColor(bool isOn, int colorIndex) {
     const ThemeDefinition& theme = getCurrentTheme();
 
     if (isOn) {
-        if (theme.id == ThemeId::NEON_CYBERPUNK) {
+        // Glowing themes color each room's icon like its glow
+        if (theme.style.glowingBorders) {
             return theme.colors.neonColors[colorIndex % 9];
         }
         return theme.colors.onState;
@@ -2,20 +2,31 @@
 #include "time_manager.h"
 #include "theme_engine.h"
 #include "ui_manager.h"
+#include "event_scheduler.h"
+#include "solar_clock.h"
 
 // Global instance
 ThemeScheduler themeScheduler;
 
 ThemeScheduler::ThemeScheduler()
-    : currentAppliedTheme("")
+    : currentAppliedTheme(ThemeId::DARK_CLEAN)
+    , themeApplied(false)
     , wasNightTime(false)
-    , initialized(false) {
+    , initialized(false)
+    , dayStartMinute(0)
+    , nightStartMinute(0)
+    , nightAllDay(false)
+    , sunAnchored(false)
+    , boundaryDay(-1)
+    , job(-1) {
 }
 
 void ThemeScheduler::begin() {
     Serial.println("ThemeScheduler: Initializing...");
+    job = eventScheduler.add("theme", onTimer, this, true);
 
-    const DayNightConfig& config = configManager.getConfig().display.dayNight;
+    ConfigSnapshot snapshot;
+    const DayNightConfig& config = snapshot->display.dayNight;
 
     if (!config.enabled) {
         Serial.println("ThemeScheduler: Disabled");
@@ -23,21 +34,26 @@ void ThemeScheduler::begin() {
         return;
     }
 
-    Serial.printf("ThemeScheduler: Enabled - Day theme: %s (starts %d:00), Night theme: %s (starts %d:00)\n",
+    Serial.printf("ThemeScheduler: Enabled - Day theme: %s (starts %d:00), Night theme: %s (starts %d:00)%s\n",
         config.dayTheme.c_str(), config.dayStartHour,
-        config.nightTheme.c_str(), config.nightStartHour);
+        config.nightTheme.c_str(), config.nightStartHour,
+        config.followSun ? ", following the sun" : "");
+    compileBoundaries(snapshot->display);
+    eventScheduler.post(job);
 
     // If time is synced, apply the correct theme and trigger rebuild
     // (on boot, UI was already created with potentially wrong theme)
     if (timeManager.isSynced()) {
-        uint8_t hour = timeManager.getCurrentHour();
-        bool isDay = isDayTime(hour);
-        const String& targetTheme = isDay ? config.dayTheme : config.nightTheme;
+        uint32_t secondsOfDay = timeManager.getSecondsOfDay();
+        uint8_t hour = secondsOfDay / 3600;
+        bool isDay = isDayTime(secondsOfDay / 60);
+        const ConfigString& targetTheme = isDay ? config.dayTheme : config.nightTheme;
+        ThemeId targetId = isDay ? config.dayThemeId : config.nightThemeId;
 
         Serial.printf("ThemeScheduler: Current hour %d is %s time, applying %s theme\n",
             hour, isDay ? "day" : "night", targetTheme.c_str());
 
-        applyTheme(targetTheme, true);  // true = trigger rebuild on boot
+        applyTheme(targetId, targetTheme.c_str(), true);  // true = trigger rebuild on boot
         wasNightTime = !isDay;
         initialized = true;
     } else {
@@ -46,23 +62,51 @@ void ThemeScheduler::begin() {
     }
 }
 
-bool ThemeScheduler::update() {
-    const DayNightConfig& config = configManager.getConfig().display.dayNight;
+void ThemeScheduler::onTimer(void* arg) {
+    ((ThemeScheduler*)arg)->evaluate();
+}
+
+bool ThemeScheduler::evaluate() {
+    eventScheduler.schedule(job, RECHECK_MS);
+
+    // Pinned for the whole pass so a concurrent config push can't reuse it
+    ConfigSnapshot snapshot;
+    const DayNightConfig& config = snapshot->display.dayNight;
 
     // Skip if day/night mode disabled
     if (!config.enabled) {
         return false;
     }
 
-    // Skip if time not synced yet
+    // Skip if time not synced yet (the sync runs the job again)
     if (!timeManager.isSynced()) {
         return false;
     }
 
-    uint8_t hour = timeManager.getCurrentHour();
-    bool isDay = isDayTime(hour);
+    // New day (or first pass since the clock was set): new sun times
+    if (config.followSun) {
+        struct tm local;
+        timeManager.getLocalNow(local);
+        if (!sunAnchored || SolarClock::dayKey(local) != boundaryDay) {
+            compileBoundaries(snapshot->display);
+        }
+    }
+
+    uint32_t secondsOfDay = timeManager.getSecondsOfDay();
+    uint8_t hour = secondsOfDay / 3600;
+    bool isDay = isDayTime(secondsOfDay / 60);
     bool isNight = !isDay;
 
+    unsigned long untilBoundary = secondsToNextBoundary(secondsOfDay) * 1000UL;
+    if (sunAnchored) {
+        // Tomorrow's sunrise is a new computation
+        unsigned long untilMidnight = (86400 - secondsOfDay) * 1000UL;
+        if (untilMidnight < untilBoundary) untilBoundary = untilMidnight;
+    }
+    if (untilBoundary < RECHECK_MS) {
+        eventScheduler.schedule(job, untilBoundary);
+    }
+
     // Check if we crossed a day/night boundary
     if (initialized && isNight == wasNightTime) {
         // No change
@@ -70,10 +114,12 @@ bool ThemeScheduler::update() {
     }
 
     // Determine target theme
-    const String& targetTheme = isDay ? config.dayTheme : config.nightTheme;
+    ThemeId targetId = isDay ? config.dayThemeId : config.nightThemeId;
+
+    const ConfigString& targetTheme = isDay ? config.dayTheme : config.nightTheme;
 
     // Check if theme actually needs to change
-    if (targetTheme == currentAppliedTheme) {
+    if (themeApplied && targetId == currentAppliedTheme) {
         wasNightTime = isNight;
         initialized = true;
         return false;
@@ -82,7 +128,7 @@ bool ThemeScheduler::update() {
     Serial.printf("ThemeScheduler: Time boundary crossed at hour %d, switching to %s theme (%s)\n",
         hour, isDay ? "day" : "night", targetTheme.c_str());
 
-    applyTheme(targetTheme);
+    applyTheme(targetId, targetTheme.c_str());
     wasNightTime = isNight;
     initialized = true;
 
@@ -90,7 +136,8 @@ bool ThemeScheduler::update() {
 }
 
 void ThemeScheduler::refresh() {
-    const DayNightConfig& config = configManager.getConfig().display.dayNight;
+    ConfigSnapshot snapshot;
+    const DayNightConfig& config = snapshot->display.dayNight;
 
     if (!config.enabled) {
         Serial.println("ThemeScheduler: Disabled");
@@ -98,25 +145,30 @@ void ThemeScheduler::refresh() {
         return;
     }
 
-    Serial.printf("ThemeScheduler: Enabled - Day theme: %s (starts %d:00), Night theme: %s (starts %d:00)\n",
+    Serial.printf("ThemeScheduler: Enabled - Day theme: %s (starts %d:00), Night theme: %s (starts %d:00)%s\n",
         config.dayTheme.c_str(), config.dayStartHour,
-        config.nightTheme.c_str(), config.nightStartHour);
+        config.nightTheme.c_str(), config.nightStartHour,
+        config.followSun ? ", following the sun" : "");
 
     // Reset state to force re-evaluation
+    compileBoundaries(snapshot->display);
+    eventScheduler.post(job);
     initialized = false;
-    currentAppliedTheme = "";
+    themeApplied = false;
 
     // If time is synced, immediately apply the correct theme
     // Don't trigger rebuild here - caller (web_server) already requested it
     if (timeManager.isSynced()) {
-        uint8_t hour = timeManager.getCurrentHour();
-        bool isDay = isDayTime(hour);
-        const String& targetTheme = isDay ? config.dayTheme : config.nightTheme;
+        uint32_t secondsOfDay = timeManager.getSecondsOfDay();
+        uint8_t hour = secondsOfDay / 3600;
+        bool isDay = isDayTime(secondsOfDay / 60);
+        const ConfigString& targetTheme = isDay ? config.dayTheme : config.nightTheme;
+        ThemeId targetId = isDay ? config.dayThemeId : config.nightThemeId;
 
         Serial.printf("ThemeScheduler: Current hour %d is %s time, applying %s theme\n",
             hour, isDay ? "day" : "night", targetTheme.c_str());
 
-        applyTheme(targetTheme, false);  // false = don't trigger rebuild
+        applyTheme(targetId, targetTheme.c_str(), false);  // false = don't trigger rebuild
         wasNightTime = !isDay;
         initialized = true;
     } else {
@@ -128,38 +180,77 @@ bool ThemeScheduler::isEnabled() const {
     return configManager.getConfig().display.dayNight.enabled;
 }
 
-bool ThemeScheduler::isDayTime(uint8_t hour) const {
-    const DayNightConfig& config = configManager.getConfig().display.dayNight;
+void ThemeScheduler::compileBoundaries(const DisplayConfig& display) {
+    const DayNightConfig& config = display.dayNight;
+    dayStartMinute = (config.dayStartHour % 24) * 60;
+    nightStartMinute = (config.nightStartHour % 24) * 60;
+    nightAllDay = false;
+    sunAnchored = false;
+    boundaryDay = -1;
+
+    SunTimes sun;
+    if (!config.followSun ||
+        !solarClock.today(display.schedule.latitude, display.schedule.longitude, sun)) {
+        return;
+    }
+
+    sunAnchored = true;
+    boundaryDay = sun.day;
+    if (sun.polar == 0) {
+        dayStartMinute = sun.sunrise;
+        nightStartMinute = sun.sunset;
+    } else {
+        // Equal boundaries mean day all day
+        dayStartMinute = nightStartMinute = 0;
+        nightAllDay = sun.polar < 0;
+    }
+}
+
+bool ThemeScheduler::isDayTime(uint16_t minuteOfDay) const {
+    if (nightAllDay) {
+        return false;
+    }
 
     // Handle the case where day and night start hours define a simple range
     // Day time is from dayStartHour to nightStartHour
     // Night time is from nightStartHour to dayStartHour (next day)
 
-    if (config.dayStartHour < config.nightStartHour) {
+    if (dayStartMinute < nightStartMinute) {
         // Normal case: day starts before night (e.g., day=7, night=20)
         // Day is [7, 20), night is [20, 7)
-        return hour >= config.dayStartHour && hour < config.nightStartHour;
-    } else if (config.dayStartHour > config.nightStartHour) {
+        return minuteOfDay >= dayStartMinute && minuteOfDay < nightStartMinute;
+    } else if (dayStartMinute > nightStartMinute) {
         // Inverted case: day starts after night (e.g., day=20, night=7)
         // Day is [20, 7), night is [7, 20)
-        return hour >= config.dayStartHour || hour < config.nightStartHour;
+        return minuteOfDay >= dayStartMinute || minuteOfDay < nightStartMinute;
     } else {
         // Same hour - default to day
         return true;
     }
 }
 
-void ThemeScheduler::applyTheme(const String& themeName, bool triggerRebuild) {
-    Serial.printf("ThemeScheduler: Setting theme to %s\n", themeName.c_str());
+uint32_t ThemeScheduler::secondsToNextBoundary(uint32_t secondsOfDay) const {
+    if (dayStartMinute == nightStartMinute) {
+        return UINT32_MAX / 1000;   // Always day, no boundary
+    }
 
-    // Set the theme in the theme engine
-    if (themeEngine.setTheme(themeName)) {
-        currentAppliedTheme = themeName;
-        // Request UI rebuild to apply the new theme (unless caller handles it)
-        if (triggerRebuild) {
-            uiManager.requestRebuild();
-        }
-    } else {
-        Serial.printf("ThemeScheduler: WARNING - Failed to set theme %s\n", themeName.c_str());
+    // Whichever start comes next, today or tomorrow
+    uint32_t best = UINT32_MAX;
+    const uint16_t starts[2] = {dayStartMinute, nightStartMinute};
+    for (uint16_t start : starts) {
+        uint32_t at = (uint32_t)start * 60;
+        uint32_t wait = at > secondsOfDay ? at - secondsOfDay : at + 86400 - secondsOfDay;
+        if (wait < best) best = wait;
     }
+    return best;
+}
+
+void ThemeScheduler::applyTheme(ThemeId theme, const char* themeName, bool triggerRebuild) {
+    Serial.printf("ThemeScheduler: Setting theme to %s\n", themeName);
+
+    // Theme is switched by the LVGL task, followed by a rebuild unless the caller handles it.
+    // The id was resolved when the config was parsed (unknown names got the default).
+    currentAppliedTheme = theme;
+    themeApplied = true;
+    uiManager.postTheme(theme, triggerRebuild);
 }
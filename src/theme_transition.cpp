@@ -0,0 +1,208 @@
+#include "theme_transition.h"
+#include "psram_budget.h"
+#include "band_renderer.h"
+#include <esp_timer.h>
+
+#if LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP != 0
+#error "ThemeTransition blends native RGB565 frames"
+#endif
+
+// Global instance
+ThemeTransition themeTransition;
+
+// bg + (fg - bg) * level / 32 for all three channels with one multiply:
+// green is moved to the upper half-word, leaving each channel enough spare
+// bits that the products can't carry into its neighbour
+static inline uint16_t blend565(uint16_t fg, uint16_t bg, uint32_t level) {
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+    uint32_t r = ((((f - b) * level) >> 5) + b) & 0x07E0F81F;
+    return (uint16_t)(r | (r >> 16));
+}
+
+ThemeTransition::ThemeTransition()
+    : enabled(true)
+    , state(IDLE)
+    , cover(nullptr)
+    , frameSize(0)
+    , capturedAt(0)
+    , level(0)
+    , blendLevel(0)
+    , fades(0)
+    , opacityFades(0)
+    , skipped(0)
+    , timeouts(0)
+    , lastBlendUs(0)
+{
+    memset(&from, 0, sizeof(from));
+    memset(&to, 0, sizeof(to));
+    memset(&mix, 0, sizeof(mix));
+}
+
+bool ThemeTransition::capture(lv_obj_t* scr) {
+    if (!enabled || state != IDLE || scr == nullptr) {
+        return false;
+    }
+
+    frameSize = lv_snapshot_buf_size_needed(scr, LV_IMG_CF_TRUE_COLOR);
+    if (!snapshot(scr, from)) {
+        skipped++;
+        Serial.println("ThemeTransition: No memory for the old frame, switching without a fade");
+        return false;
+    }
+
+    // Opaque full-screen image: LVGL stops drawing at it, so the rebuild
+    // underneath costs no rendering and is never seen
+    cover = lv_img_create(lv_layer_top());
+    lv_obj_clear_flag(cover, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_pos(cover, 0, 0);
+    lv_img_set_src(cover, &from.dsc);
+
+    state = CAPTURED;
+    capturedAt = millis();
+    return true;
+}
+
+void ThemeTransition::start(lv_obj_t* scr) {
+    if (state != CAPTURED) {
+        return;
+    }
+
+    // The new tree was just built; position it before it is rendered
+    lv_obj_update_layout(scr);
+
+    bool blended = snapshot(scr, to);
+    if (blended) {
+        mix.buf = (uint8_t*)psramBudget.alloc(PSRAM_UI_SNAPSHOT, frameSize);
+        blended = mix.buf != nullptr;
+    }
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, this);
+    lv_anim_set_time(&a, FADE_MS);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_in_out);
+    lv_anim_set_ready_cb(&a, onFadeDone);
+
+    if (blended) {
+        memcpy(mix.buf, from.buf, frameSize);
+        mix.dsc = from.dsc;
+        mix.dsc.data = mix.buf;
+        lv_img_set_src(cover, &mix.dsc);
+        level = 0;
+        lv_anim_set_values(&a, 0, BLEND_LEVELS);
+        lv_anim_set_exec_cb(&a, onBlendStep);
+        fades++;
+    } else {
+        // Fade the old frame out over the live screen instead; LVGL redraws
+        // the tree under it every step, but only for FADE_MS
+        releaseFrame(to);
+        lv_anim_set_values(&a, LV_OPA_COVER, LV_OPA_TRANSP);
+        lv_anim_set_exec_cb(&a, onOpacityStep);
+        opacityFades++;
+    }
+
+    lv_anim_start(&a);
+    state = FADING;
+}
+
+void ThemeTransition::cancel() {
+    if (state == IDLE) {
+        return;
+    }
+    lv_anim_del(this, nullptr);
+    finish();
+}
+
+void ThemeTransition::poll() {
+    if (state == CAPTURED && millis() - capturedAt > CAPTURE_TIMEOUT_MS) {
+        timeouts++;
+        start(lv_scr_act());
+    }
+}
+
+bool ThemeTransition::snapshot(lv_obj_t* scr, Frame& frame) {
+    // Both frames and the blend are walked pixel for pixel as one size
+    if (lv_snapshot_buf_size_needed(scr, LV_IMG_CF_TRUE_COLOR) != frameSize) {
+        return false;
+    }
+    frame.buf = (uint8_t*)psramBudget.alloc(PSRAM_UI_SNAPSHOT, frameSize);
+    if (!frame.buf) {
+        return false;
+    }
+    if (lv_snapshot_take_to_buf(scr, LV_IMG_CF_TRUE_COLOR, &frame.dsc, frame.buf, frameSize) != LV_RES_OK) {
+        releaseFrame(frame);
+        return false;
+    }
+    return true;
+}
+
+void ThemeTransition::releaseFrame(Frame& frame) {
+    if (!frame.buf) return;
+    // LVGL's image cache knows descriptors by address, and they are reused
+    lv_img_cache_invalidate_src(&frame.dsc);
+    psramBudget.release(PSRAM_UI_SNAPSHOT, frame.buf, frameSize);
+    memset(&frame, 0, sizeof(frame));
+}
+
+void ThemeTransition::finish() {
+    if (cover) {
+        lv_obj_del(cover);
+        cover = nullptr;
+    }
+    releaseFrame(from);
+    releaseFrame(to);
+    releaseFrame(mix);
+    state = IDLE;
+}
+
+void ThemeTransition::blendRows(void* arg, uint32_t first, uint32_t end) {
+    const ThemeTransition* self = (const ThemeTransition*)arg;
+    const uint16_t* a = (const uint16_t*)self->from.buf;
+    const uint16_t* b = (const uint16_t*)self->to.buf;
+    uint16_t* out = (uint16_t*)self->mix.buf;
+    uint32_t step = self->blendLevel;
+    uint32_t count = self->frameSize / sizeof(uint16_t);
+    uint32_t stop = end * BLEND_CHUNK_PX < count ? end * BLEND_CHUNK_PX : count;
+    for (uint32_t i = first * BLEND_CHUNK_PX; i < stop; i++) {
+        uint16_t pa = a[i];
+        uint16_t pb = b[i];
+        out[i] = pa == pb ? pa : blend565(pb, pa, step);
+    }
+}
+
+void ThemeTransition::blend(uint8_t step) {
+    int64_t start = esp_timer_get_time();
+
+    // Top and bottom halves on both cores when the band renderer is running
+    uint32_t count = frameSize / sizeof(uint16_t);
+    blendLevel = step;
+    bandRenderer.split((count + BLEND_CHUNK_PX - 1) / BLEND_CHUNK_PX, blendRows, this);
+
+    level = step;
+    lastBlendUs = esp_timer_get_time() - start;
+}
+
+void ThemeTransition::onBlendStep(void* var, int32_t step) {
+    ThemeTransition* self = (ThemeTransition*)var;
+    if (step == self->level) return;
+    self->blend(step);
+    lv_obj_invalidate(self->cover);
+}
+
+void ThemeTransition::onOpacityStep(void* var, int32_t opa) {
+    ThemeTransition* self = (ThemeTransition*)var;
+    lv_obj_set_style_img_opa(self->cover, opa, 0);
+}
+
+void ThemeTransition::onFadeDone(lv_anim_t* a) {
+    ((ThemeTransition*)a->var)->finish();
+}
+
+void ThemeTransition::writeJson(Print& out) const {
+    static const char* const STATE_NAMES[] = { "idle", "captured", "fading" };
+    out.printf("{\"state\":\"%s\",\"fade_ms\":%u,\"frame_bytes\":%u,\"fades\":%u,"
+               "\"opacity_fades\":%u,\"skipped\":%u,\"timeouts\":%u,\"last_blend_us\":%u}",
+               STATE_NAMES[state], (unsigned)FADE_MS, (unsigned)frameSize, fades,
+               opacityFades, skipped, timeouts, lastBlendUs);
+}
@@ -1,4 +1,5 @@
 #include "time_manager.h"
+#include "event_scheduler.h"
 #include <WiFi.h>
 #include <time.h>
 #include <sys/time.h>
@@ -14,8 +15,13 @@ TimeManager timeManager;
 TimeManager::TimeManager()
     : currentTimezone("MST7MDT,M3.2.0,M11.1.0")
     , synced(false)
-    , lastSyncAttempt(0)
-    , lastSuccessfulSync(0) {
+    , lastSuccessfulSync(0)
+    , syncJob(-1)
+    , cachedMinute()
+    , cachedMinuteStart(-1)
+    , cacheMux(portMUX_INITIALIZER_UNLOCKED)
+    , tickedMinuteOfDay(0)
+    , minuteJob(-1) {
 }
 
 void TimeManager::begin() {
@@ -26,6 +32,89 @@ void TimeManager::begin() {
     configTzTime(currentTimezone.c_str(), NTP_SERVER1, NTP_SERVER2, NTP_SERVER3);
 
     Serial.printf("TimeManager: Timezone set to %s\n", currentTimezone.c_str());
+
+    // First check once SNTP has had a chance; server time usually wins
+    syncJob = eventScheduler.add("time_sync", onSyncTimer, this);
+    eventScheduler.schedule(syncJob, SYNC_RETRY_MS);
+    // Armed once the clock is first set
+    minuteJob = eventScheduler.add("clock_minute", onMinuteTimer, this);
+}
+
+void TimeManager::onSyncTimer(void* arg) {
+    TimeManager* self = (TimeManager*)arg;
+    self->attemptSync();
+    eventScheduler.schedule(self->syncJob, self->synced ? SYNC_INTERVAL_MS : SYNC_RETRY_MS);
+}
+
+void TimeManager::noteClockChanged() {
+    portENTER_CRITICAL(&cacheMux);
+    cachedMinuteStart = -1;
+    portEXIT_CRITICAL(&cacheMux);
+
+    if (synced) {
+        armMinuteTimer();
+    }
+    eventScheduler.postWallClockChange();
+}
+
+// ============================================================================
+// Local time cache
+// ============================================================================
+
+void TimeManager::getLocalNow(struct tm& out) const {
+    time_t now = time(nullptr);
+
+    portENTER_CRITICAL(&cacheMux);
+    bool hit = cachedMinuteStart >= 0 && now >= cachedMinuteStart && now - cachedMinuteStart < 60;
+    if (hit) {
+        out = cachedMinute;
+        out.tm_sec = (int)(now - cachedMinuteStart);
+    }
+    portEXIT_CRITICAL(&cacheMux);
+    if (hit) return;
+
+    // localtime_r parses the POSIX TZ rules; keep it out of the critical section
+    if (!localtime_r(&now, &out)) {
+        memset(&out, 0, sizeof(out));
+        return;
+    }
+    struct tm minute = out;
+    int sec = minute.tm_sec > 59 ? 59 : minute.tm_sec;   // Leap second
+    minute.tm_sec = 0;
+
+    portENTER_CRITICAL(&cacheMux);
+    cachedMinute = minute;
+    cachedMinuteStart = now - sec;
+    portEXIT_CRITICAL(&cacheMux);
+}
+
+void TimeManager::armMinuteTimer() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+
+    struct tm local;
+    getLocalNow(local);
+    tickedMinuteOfDay = local.tm_hour * 60 + local.tm_min;
+
+    // Zones are whole minutes off UTC, so local minutes start on UTC ones
+    uint32_t intoMinuteMs = (uint32_t)(tv.tv_sec % 60) * 1000 + tv.tv_usec / 1000;
+    eventScheduler.schedule(minuteJob, 60000 - intoMinuteMs);
+}
+
+void TimeManager::onMinuteTimer(void* arg) {
+    TimeManager* self = (TimeManager*)arg;
+    uint16_t previous = self->tickedMinuteOfDay;
+    uint16_t expected = (previous + 1) % MINUTES_PER_DAY;
+
+    self->armMinuteTimer();
+    // Same minute: esp_timer ran a hair ahead of the RTC, just re-armed
+    if (self->tickedMinuteOfDay != expected && self->tickedMinuteOfDay != previous) {
+        // A DST change, or the loop overslept a boundary: either way the
+        // schedulers' deadlines may be off
+        Serial.printf("TimeManager: Local time moved to %02u:%02u, re-evaluating schedules\n",
+                      self->tickedMinuteOfDay / 60, self->tickedMinuteOfDay % 60);
+        eventScheduler.postWallClockChange();
+    }
 }
 
 void TimeManager::setTimezone(const String& posixTimezone) {
@@ -39,6 +128,7 @@ void TimeManager::setTimezone(const String& posixTimezone) {
         // Update timezone using setenv + tzset (works after configTzTime was called)
         setenv("TZ", currentTimezone.c_str(), 1);
         tzset();
+        noteClockChanged();
         Serial.printf("TimeManager: Timezone updated to %s\n", currentTimezone.c_str());
     }
 }
@@ -49,21 +139,34 @@ bool TimeManager::isSynced() const {
 
 uint8_t TimeManager::getCurrentHour() const {
     struct tm timeinfo;
-    if (!getLocalTime(&timeinfo)) {
-        return 0;
-    }
+    getLocalNow(timeinfo);
     return timeinfo.tm_hour;
 }
 
 uint8_t TimeManager::getCurrentMinute() const {
     struct tm timeinfo;
-    if (!getLocalTime(&timeinfo)) {
-        return 0;
-    }
+    getLocalNow(timeinfo);
     return timeinfo.tm_min;
 }
 
+uint32_t TimeManager::getSecondsOfDay() const {
+    struct tm timeinfo;
+    getLocalNow(timeinfo);
+    return (uint32_t)timeinfo.tm_hour * 3600 + timeinfo.tm_min * 60 + timeinfo.tm_sec;
+}
+
 void TimeManager::setTimeFromServer(uint32_t unixTimestamp) {
+    if (unixTimestamp < MIN_SERVER_TIME) {
+        return;
+    }
+    // Stepping a good clock would only re-run every wall-clock job
+    if (synced) {
+        int64_t offset = (int64_t)time(nullptr) - unixTimestamp;
+        if (offset <= (int64_t)SERVER_TIME_TOLERANCE_S && offset >= -(int64_t)SERVER_TIME_TOLERANCE_S) {
+            return;
+        }
+    }
+
     struct timeval tv;
     tv.tv_sec = unixTimestamp;
     tv.tv_usec = 0;
@@ -71,6 +174,7 @@ void TimeManager::setTimeFromServer(uint32_t unixTimestamp) {
 
     synced = true;
     lastSuccessfulSync = millis();
+    noteClockChanged();
 
     // Print the time we just set
     struct tm timeinfo;
@@ -80,23 +184,6 @@ void TimeManager::setTimeFromServer(uint32_t unixTimestamp) {
     }
 }
 
-void TimeManager::update() {
-    unsigned long now = millis();
-
-    // Check if we need to attempt sync
-    if (!synced) {
-        // Not synced - retry more frequently
-        if (now - lastSyncAttempt >= SYNC_RETRY_MS) {
-            attemptSync();
-        }
-    } else {
-        // Synced - periodic re-sync
-        if (now - lastSuccessfulSync >= SYNC_INTERVAL_MS) {
-            attemptSync();
-        }
-    }
-}
-
 void TimeManager::forceSync() {
     Serial.println("TimeManager: Forcing NTP sync...");
     attemptSync();
@@ -108,8 +195,6 @@ void TimeManager::attemptSync() {
         return;
     }
 
-    lastSyncAttempt = millis();
-
     // Check if time is valid
     if (checkSyncStatus()) {
         if (!synced) {
@@ -124,6 +209,7 @@ void TimeManager::attemptSync() {
         }
         synced = true;
         lastSuccessfulSync = millis();
+        noteClockChanged();
     } else {
         Serial.println("TimeManager: NTP sync pending...");
     }
@@ -0,0 +1,209 @@
+#include "touch_input.h"
+#include "lvgl_task.h"
+#include <esp_timer.h>
+
+// Global instance
+TouchInput touchInput;
+
+TouchInput::TouchInput()
+    : taskHandle(nullptr)
+    , sampleFn(nullptr)
+    , readTimer(nullptr)
+    , intPin(-1)
+    , head(0)
+    , count(0)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , sampled{0, 0, 0, false, false}
+    , sampledClaimed(false)
+    , sampledTouchAt(0)
+    , delivered{0, 0, 0, false, false}
+    , deliveredTouchAt(0)
+    , periodMs(0)
+    , samples(0)
+    , events(0)
+    , merged(0)
+    , dropped(0)
+{
+}
+
+void TouchInput::begin(lv_indev_t* indev, int pin, TouchSampleFn sample) {
+    readTimer = indev ? indev->driver->read_timer : nullptr;
+    intPin = pin;
+    sampleFn = sample;
+    setPeriod(IDLE_PERIOD_MS);
+
+    if (taskHandle || !sampleFn) return;
+
+    BaseType_t result = xTaskCreatePinnedToCore(
+        taskMain,
+        "Touch",
+        TASK_STACK_SIZE,
+        this,
+        TASK_PRIORITY,
+        &taskHandle,
+        TASK_CORE
+    );
+
+    if (result != pdPASS) {
+        taskHandle = nullptr;
+        Serial.println("TouchInput: Failed to create sampling task!");
+        return;
+    }
+
+    if (intPin >= 0) {
+        // GT911 pulses INT per report; either edge means fresh data
+        pinMode(intPin, INPUT);
+        attachInterruptArg(digitalPinToInterrupt(intPin), onInterrupt, this, CHANGE);
+        Serial.printf("TouchInput: Sampling task on core %d, interrupt on GPIO %d, safety poll every %lu ms\n",
+                      TASK_CORE, intPin, SAFETY_POLL_MS);
+    } else {
+        Serial.printf("TouchInput: Sampling task on core %d, no INT line, polling every %u-%u ms\n",
+                      TASK_CORE, ACTIVE_PERIOD_MS, IDLE_PERIOD_MS);
+    }
+}
+
+void IRAM_ATTR TouchInput::onInterrupt(void* arg) {
+    TouchInput* self = (TouchInput*)arg;
+    if (!self->taskHandle) return;
+
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(self->taskHandle, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+bool TouchInput::isRecent(unsigned long touchAt, unsigned long now) const {
+    return touchAt && now - touchAt < RECENT_WINDOW_MS;
+}
+
+// ============================================================================
+// Sampling task
+// ============================================================================
+
+void TouchInput::taskMain(void* arg) {
+    TouchInput* self = (TouchInput*)arg;
+    TickType_t lastWake = xTaskGetTickCount();
+
+    while (true) {
+        TouchPoint points[GestureEngine::MAX_POINTS];
+        uint8_t contacts = self->sampleFn(points, GestureEngine::MAX_POINTS);
+        bool pressed = contacts > 0;
+        int16_t x = pressed ? points[0].x : self->sampled.x;
+        int16_t y = pressed ? points[0].y : self->sampled.y;
+        unsigned long now = millis();
+        self->samples++;
+
+        bool claimed = gestureEngine.update(points, contacts, now);
+        bool claimedNow = claimed && !self->sampledClaimed;
+        self->sampledClaimed = claimed;
+
+        TouchEvent& last = self->sampled;
+        if (pressed != last.pressed || claimedNow || (pressed && (x != last.x || y != last.y))) {
+            TouchEvent event = {esp_timer_get_time(), x, y, pressed, claimedNow};
+            self->push(event);
+            last = event;
+            lvglTask.wake();
+        }
+
+        if (pressed) {
+            self->sampledTouchAt = now;
+            // Fixed cadence while a finger is down, however long the read took
+            vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(ACTIVE_PERIOD_MS));
+            continue;
+        }
+
+        if (self->intPin >= 0) {
+            // A pending edge from the release report is cleared here, so an
+            // immediate wake means a new touch
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SAFETY_POLL_MS));
+        } else {
+            bool recent = self->isRecent(self->sampledTouchAt, now);
+            vTaskDelay(pdMS_TO_TICKS(recent ? RECENT_PERIOD_MS : IDLE_PERIOD_MS));
+        }
+        lastWake = xTaskGetTickCount();
+    }
+}
+
+void TouchInput::push(const TouchEvent& event) {
+    portENTER_CRITICAL(&mux);
+    events++;
+    if (count == QUEUE_SIZE) {
+        // A move following a move only updates the position LVGL will see
+        TouchEvent& newest = queue[(head + count - 1) % QUEUE_SIZE];
+        const TouchEvent& before = queue[(head + count - 2) % QUEUE_SIZE];
+        if (event.pressed && newest.pressed && before.pressed) {
+            bool cancel = newest.cancel;
+            newest = event;
+            newest.cancel = newest.cancel || cancel;
+            merged++;
+            portEXIT_CRITICAL(&mux);
+            return;
+        }
+        head = (head + 1) % QUEUE_SIZE;
+        count--;
+        dropped++;
+    }
+    queue[(head + count) % QUEUE_SIZE] = event;
+    count++;
+    portEXIT_CRITICAL(&mux);
+}
+
+// ============================================================================
+// LVGL side
+// ============================================================================
+
+void TouchInput::next(TouchEvent& event, bool& more) {
+    portENTER_CRITICAL(&mux);
+    if (count) {
+        delivered = queue[head];
+        head = (head + 1) % QUEUE_SIZE;
+        count--;
+    }
+    more = count > 0;
+    portEXIT_CRITICAL(&mux);
+
+    if (delivered.pressed) {
+        deliveredTouchAt = millis();
+    }
+    event = delivered;
+    // Cancelling is a one-off; repeats of this state are plain reads
+    delivered.cancel = false;
+}
+
+void TouchInput::service() {
+    portENTER_CRITICAL(&mux);
+    bool pending = count > 0;
+    portEXIT_CRITICAL(&mux);
+
+    if (pending && readTimer) {
+        lv_timer_ready(readTimer);
+    }
+
+    // The queue makes reads cheap, but LVGL's long-press and scroll-throw
+    // timing still runs off read ticks while and right after a touch
+    if (delivered.pressed) {
+        setPeriod(ACTIVE_PERIOD_MS);
+    } else if (isRecent(deliveredTouchAt, millis())) {
+        setPeriod(RECENT_PERIOD_MS);
+    } else {
+        setPeriod(IDLE_PERIOD_MS);
+    }
+}
+
+void TouchInput::alignToFrame() {
+    if (delivered.pressed && readTimer) {
+        lv_timer_ready(readTimer);
+    }
+}
+
+bool TouchInput::isTracking() const {
+    return delivered.pressed || isRecent(deliveredTouchAt, millis());
+}
+
+void TouchInput::setPeriod(uint32_t period) {
+    if (period != periodMs && readTimer) {
+        periodMs = period;
+        lv_timer_set_period(readTimer, period);
+    }
+}
@@ -0,0 +1,382 @@
+#include "ui_benchmark.h"
+#include "ui_manager.h"
+#include "device_controller.h"
+#include "brightness_scheduler.h"
+#include "theme_scheduler.h"
+#include "lvgl_task.h"
+#include "theme_transition.h"
+#include "json_alloc.h"
+#include <ArduinoJson.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+// Global instance
+UIBenchmark uiBenchmark;
+
+static const char* const THEME_NAMES[UIBenchmark::THEME_COUNT] = {
+    "light_mode",
+    "dark_mode",
+    "neon_cyberpunk",
+    "lcars"
+};
+static const uint8_t THEME_LCARS = 3;
+
+static const char* const STATE_NAMES[] = {
+    "idle",
+    "running",
+    "done",
+    "failed"
+};
+
+// Mix of symbol and image icons, so both card kinds are measured
+static const char* const BENCH_ICONS[] = {
+    "light", "power", "fan", "bulb", "home", "fan", "moon", "sun", "fan"
+};
+
+UIBenchmark::UIBenchmark()
+    : state(BENCH_IDLE)
+    , printReport(false)
+    , taskHandle(nullptr)
+    , scenarios(nullptr)
+    , scenarioCount(0)
+    , scenarioTotal(0)
+    , startedAt(0)
+    , durationMs(0)
+    , internalBefore(0)
+    , internalAfter(0)
+    , psramBefore(0)
+    , psramAfter(0)
+    , error(nullptr)
+{
+    sketchMd5[0] = '\0';
+}
+
+bool UIBenchmark::start(bool print) {
+    if (state == BENCH_RUNNING || !lvglTask.isRunning()) {
+        return false;
+    }
+
+    if (!scenarios) {
+        scenarios = (Scenario*)heap_caps_malloc(MAX_SCENARIOS * sizeof(Scenario), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!scenarios) {
+            Serial.println("UIBench: Failed to allocate results");
+            return false;
+        }
+    }
+
+    printReport = print;
+    scenarioCount = 0;
+    scenarioTotal = THEME_COUNT * MAX_PAGE_CARDS;
+    durationMs = 0;
+    error = nullptr;
+    startedAt = millis();
+    state = BENCH_RUNNING;
+
+    // Drives the UI through the LVGL lock; below the render task
+    if (xTaskCreatePinnedToCore(
+            benchTask,
+            "UIBench",
+            8192,
+            this,
+            tskIDLE_PRIORITY + 1,
+            &taskHandle,
+            0) != pdPASS) {
+        state = BENCH_FAILED;
+        error = "Failed to start task";
+        return false;
+    }
+    return true;
+}
+
+void UIBenchmark::benchTask(void* parameter) {
+    UIBenchmark* self = (UIBenchmark*)parameter;
+    self->run();
+    self->taskHandle = nullptr;
+    vTaskDelete(nullptr);
+}
+
+// ============================================================================
+// Run
+// ============================================================================
+
+void UIBenchmark::run() {
+    Serial.printf("UIBench: Starting %u scenarios\n", scenarioTotal);
+
+    // Hashing the image takes a moment; never on the web server task
+    strlcpy(sketchMd5, ESP.getSketchMD5().c_str(), sizeof(sketchMd5));
+
+    String saved = configManager.toJson(true);
+    deviceController.setActionsMuted(true);
+    themeTransition.setEnabled(false);      // Rebuilds are timed without the fade
+    internalBefore = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    psramBefore = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+
+    bool ok = true;
+    for (uint8_t buttons = 1; buttons <= MAX_PAGE_CARDS && ok; buttons++) {
+        for (uint8_t theme = 0; theme < THEME_COUNT && ok; theme++) {
+            Scenario& result = scenarios[scenarioCount];
+            ok = runScenario(theme, buttons, result);
+            if (ok) {
+                scenarioCount++;
+                Serial.printf("UIBench: %s/%u: %u frames, p95 %u us, rebuild %u us\n",
+                              THEME_NAMES[theme], buttons, result.frames, result.frame.p95, result.rebuildUs);
+            }
+        }
+    }
+
+    // Put the real config back the way a push would
+    uint32_t totalUs, passUs;
+    bool full;
+    if (!applyConfig(&saved, totalUs, passUs, full) && ok) {
+        ok = false;
+        error = "Failed to restore config";
+    }
+    deviceController.setActionsMuted(false);
+    themeTransition.setEnabled(true);
+    perfMonitor.reset();
+
+    internalAfter = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    psramAfter = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    durationMs = millis() - startedAt;
+    state = ok ? BENCH_DONE : BENCH_FAILED;
+
+    Serial.printf("UIBench: %s after %lu ms (%u/%u scenarios)\n",
+                  ok ? "Done" : "Failed", durationMs, scenarioCount, scenarioTotal);
+    if (printReport) {
+        writeJson(Serial);
+        Serial.println();
+    }
+}
+
+bool UIBenchmark::runScenario(uint8_t theme, uint8_t buttons, Scenario& result) {
+    memset(&result, 0, sizeof(result));
+    result.theme = theme;
+    result.buttons = buttons;
+
+    uint32_t internalStart = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    uint32_t psramStart = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+
+    String json = buildConfig(theme, buttons);
+    if (!applyConfig(&json, result.applyUs, result.rebuildUs, result.rebuilt)) {
+        return false;
+    }
+    vTaskDelay(pdMS_TO_TICKS(SETTLE_MS));
+
+    // Frame stats cover the scripted inputs only
+    perfMonitor.reset();
+    unsigned long scriptStart = millis();
+    result.inputs = runScript();
+    result.scriptMs = millis() - scriptStart;
+    result.frames = perfMonitor.getFrames();
+    result.frame = perfMonitor.summarize(PERF_FRAME_US);
+    result.render = perfMonitor.summarize(PERF_RENDER_US);
+    result.flush = perfMonitor.summarize(PERF_FLUSH_US);
+
+    // Same config again: in-place reconcile
+    uint32_t totalUs;
+    bool full;
+    if (!applyConfig(nullptr, totalUs, result.reconcileUs, full)) {
+        return false;
+    }
+
+    result.internalDelta = (int32_t)(internalStart - heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    result.psramDelta = (int32_t)(psramStart - heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    result.internalLargest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+    return true;
+}
+
+bool UIBenchmark::applyConfig(const String* json, uint32_t& totalUs, uint32_t& passUs, bool& full) {
+    uint32_t before = uiManager.getRebuildCount();
+    int64_t start = esp_timer_get_time();
+
+    if (json) {
+        if (!configManager.parseConfigJson(*json)) {
+            error = configManager.getLastParseError();
+            return false;
+        }
+        // Same sequence as a pushed config (see HeavyRequestLane)
+        brightnessScheduler.refresh();
+        themeScheduler.refresh();
+    }
+    uiManager.requestRebuild();
+
+    unsigned long waitStart = millis();
+    while (uiManager.getRebuildCount() == before) {
+        if (millis() - waitStart > REBUILD_TIMEOUT_MS) {
+            error = "UI rebuild timed out";
+            return false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+
+    totalUs = esp_timer_get_time() - start;
+    passUs = uiManager.getLastRebuildUs();
+    full = uiManager.wasLastRebuildFull();
+    return true;
+}
+
+uint16_t UIBenchmark::runScript() {
+    uint16_t inputs = 0;
+    int count;
+    {
+        LVGLLock lock;
+        count = uiManager.numCards;
+    }
+
+    for (int i = 0; i < count; i++) {
+        lv_obj_t* card;
+        uint8_t steps;
+        {
+            LVGLLock lock;
+            card = uiManager.buttonCards[i].card;
+            steps = uiManager.buttonCards[i].speedSteps;
+        }
+        if (!card) {
+            continue;
+        }
+
+        if (steps == 0) {
+            // Toggle on and back off
+            for (int tap = 0; tap < 2; tap++) {
+                {
+                    LVGLLock lock;
+                    lv_event_send(card, LV_EVENT_CLICKED, nullptr);
+                }
+                inputs++;
+                vTaskDelay(pdMS_TO_TICKS(STEP_MS));
+            }
+            continue;
+        }
+
+        // Fan: tap opens the overlay, drag up to full and back to off, close
+        {
+            LVGLLock lock;
+            lv_event_send(card, LV_EVENT_CLICKED, nullptr);
+        }
+        inputs++;
+        vTaskDelay(pdMS_TO_TICKS(STEP_MS));
+
+        for (int step = 1; step <= steps * 2; step++) {
+            int level = step <= steps ? step : steps * 2 - step;
+            {
+                LVGLLock lock;
+                lv_obj_t* slider = uiManager.fanOverlay.slider;
+                if (!uiManager.fanOverlay.visible || !slider) {
+                    break;
+                }
+                lv_slider_set_value(slider, level, LV_ANIM_OFF);
+                lv_event_send(slider, LV_EVENT_VALUE_CHANGED, nullptr);
+            }
+            inputs++;
+            vTaskDelay(pdMS_TO_TICKS(STEP_MS));
+        }
+
+        {
+            LVGLLock lock;
+            uiManager.hideFanOverlay();
+        }
+        inputs++;
+        vTaskDelay(pdMS_TO_TICKS(STEP_MS));
+    }
+    return inputs;
+}
+
+String UIBenchmark::buildConfig(uint8_t theme, uint8_t buttons) const {
+    ConfigSnapshot snapshot;
+    const DeviceConfig& current = *snapshot;
+    PsramJsonDocument doc(4096);
+
+    doc["version"] = 1;
+    JsonObject device = doc.createNestedObject("device");
+    device["id"] = current.device.id.c_str();
+    device["name"] = "UI Bench";
+    device["location"] = "Bench";
+
+    // Schedules off so nothing but the config picks the theme
+    JsonObject display = doc.createNestedObject("display");
+    display["brightness"] = current.display.brightness;
+    display["theme"] = THEME_NAMES[theme];
+    display["dayNightMode"]["enabled"] = false;
+    display["brightnessSchedule"]["enabled"] = false;
+    display["lcars"]["enabled"] = theme == THEME_LCARS;
+
+    // Every third button is a 3-speed fan, the rest alternate light/switch
+    JsonArray list = doc.createNestedArray("buttons");
+    for (uint8_t i = 1; i <= buttons; i++) {
+        JsonObject b = list.createNestedObject();
+        b["id"] = i;
+        b["name"] = String("Bench ") + i;
+        b["icon"] = BENCH_ICONS[(i - 1) % (sizeof(BENCH_ICONS) / sizeof(BENCH_ICONS[0]))];
+        if (i % 3 == 0) {
+            b["type"] = "fan";
+            b["speedSteps"] = 3;
+        } else {
+            b["type"] = (i % 2) ? "light" : "switch";
+        }
+        b["state"] = false;
+    }
+
+    JsonArray scenes = doc.createNestedArray("scenes");
+    JsonObject evening = scenes.createNestedObject();
+    evening["id"] = 1;
+    evening["name"] = "Evening";
+    evening["icon"] = "moon";
+    JsonObject morning = scenes.createNestedObject();
+    morning["id"] = 2;
+    morning["name"] = "Morning";
+    morning["icon"] = "sun";
+
+    doc["server"]["reportingUrl"] = current.server.reportingUrl.c_str();
+
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
+
+// ============================================================================
+// Report
+// ============================================================================
+
+static void printSummary(Print& out, const char* name, const PerfSummary& s) {
+    out.printf(",\"%s\":{\"p50\":%u,\"p95\":%u,\"p99\":%u,\"max\":%u,\"avg\":%u}",
+               name, s.p50, s.p95, s.p99, s.max, s.avg);
+}
+
+void UIBenchmark::writeJson(Print& out) const {
+    BenchState current = state;
+    uint8_t completed = scenarioCount;
+
+    out.printf("{\"state\":\"%s\",\"progress\":%u,\"total\":%u", STATE_NAMES[current], completed, scenarioTotal);
+    if (error) {
+        out.printf(",\"error\":\"%s\"", error);
+    }
+    if (current == BENCH_IDLE) {
+        out.print("}");
+        return;
+    }
+
+    out.printf(",\"build\":{\"date\":\"%s %s\",\"sdk\":\"%s\",\"md5\":\"%s\"}",
+               __DATE__, __TIME__, ESP.getSdkVersion(), sketchMd5);
+    if (current != BENCH_RUNNING) {
+        out.printf(",\"duration_ms\":%lu", durationMs);
+        out.printf(",\"heap\":{\"internal_before\":%u,\"internal_after\":%u,\"psram_before\":%u,\"psram_after\":%u}",
+                   internalBefore, internalAfter, psramBefore, psramAfter);
+    }
+
+    out.print(",\"scenarios\":[");
+    for (uint8_t i = 0; i < completed; i++) {
+        const Scenario& s = scenarios[i];
+        float fps = s.scriptMs > 0 ? s.frames * 1000.0f / s.scriptMs : 0.0f;
+
+        out.printf("%s{\"theme\":\"%s\",\"buttons\":%u,\"inputs\":%u,\"script_ms\":%u,\"frames\":%u,\"fps\":%.1f",
+                   i ? "," : "", THEME_NAMES[s.theme], s.buttons, s.inputs, s.scriptMs, s.frames, fps);
+        out.printf(",\"apply_us\":%u,\"rebuild_us\":%u,\"full_rebuild\":%s,\"reconcile_us\":%u",
+                   s.applyUs, s.rebuildUs, s.rebuilt ? "true" : "false", s.reconcileUs);
+        printSummary(out, "frame_us", s.frame);
+        printSummary(out, "render_us", s.render);
+        printSummary(out, "flush_us", s.flush);
+        out.printf(",\"heap\":{\"internal_delta\":%d,\"psram_delta\":%d,\"internal_largest\":%u}}",
+                   s.internalDelta, s.psramDelta, s.internalLargest);
+    }
+    out.print("]}");
+}
@@ -0,0 +1,67 @@
+#include "ui_command_queue.h"
+
+UICommandQueue::UICommandQueue()
+    : head(0)
+    , count(0)
+    , dropped(0)
+{
+    mux = portMUX_INITIALIZER_UNLOCKED;
+}
+
+bool UICommandQueue::sameTarget(const UICommand& a, const UICommand& b) {
+    if (a.type != b.type) return false;
+
+    switch (a.type) {
+        case UICommandType::BUTTON_STATE:
+        case UICommandType::FAN_SPEED:
+        case UICommandType::ACTION_FAILED:
+        case UICommandType::LCARS_FIELD:
+        case UICommandType::SENSOR_SAMPLE:
+            return a.buttonId == b.buttonId;
+        default:
+            return true;  // Only the latest brightness/theme/rebuild matters
+    }
+}
+
+bool UICommandQueue::post(const UICommand& cmd) {
+    bool queued = true;
+
+    portENTER_CRITICAL(&mux);
+
+    // Coalesce with a pending command for the same target
+    for (uint8_t i = 0; i < count; i++) {
+        UICommand& pending = items[(head + i) % CAPACITY];
+        if (sameTarget(pending, cmd)) {
+            pending.value = cmd.value;
+            pending.flag = pending.flag || cmd.flag;
+            portEXIT_CRITICAL(&mux);
+            return true;
+        }
+    }
+
+    if (count < CAPACITY) {
+        items[(head + count) % CAPACITY] = cmd;
+        count++;
+    } else {
+        dropped++;
+        queued = false;
+    }
+
+    portEXIT_CRITICAL(&mux);
+    return queued;
+}
+
+bool UICommandQueue::pop(UICommand& cmd) {
+    bool popped = false;
+
+    portENTER_CRITICAL(&mux);
+    if (count > 0) {
+        cmd = items[head];
+        head = (head + 1) % CAPACITY;
+        count--;
+        popped = true;
+    }
+    portEXIT_CRITICAL(&mux);
+
+    return popped;
+}
@@ -1,5 +1,17 @@
 #include "ui_manager.h"
 #include "brightness_scheduler.h"
+#include "lvgl_task.h"
+#include "latency_trace.h"
+#include "heap_monitor.h"
+#include "backlight.h"
+#include "psram_budget.h"
+#include "icon_pack.h"
+#include "icon_tint_cache.h"
+#include "packed_image.h"
+#include "background_anim.h"
+#include "theme_transition.h"
+#include "sensor_history.h"
+#include "panel_log.h"
 #include "lcars_elbow.h"
 #include "fan_icon.h"
 #include "garage_icon.h"
@@ -10,21 +22,27 @@
 #include "moon_icon.h"
 #include "sun_icon.h"
 #include <WiFi.h>
+#include <esp_timer.h>
+#include <math.h>
+
+// Set label text only when it differs, so unchanged labels aren't invalidated
+static bool setLabelTextIfChanged(lv_obj_t* label, const char* text) {
+    if (label && strcmp(lv_label_get_text(label), text) != 0) {
+        lv_label_set_text(label, text);
+        return true;
+    }
+    return false;
+}
 
-// Helper function to sanitize text for LVGL fonts
-// Replaces smart quotes and other problematic Unicode characters with ASCII equivalents
-static String sanitizeForDisplay(const String& input) {
-    String result = input;
-    // Replace various types of apostrophes/single quotes with ASCII apostrophe
-    result.replace("\xe2\x80\x99", "'");  // Right single quotation mark (')
-    result.replace("\xe2\x80\x98", "'");  // Left single quotation mark (')
-    result.replace("\xc2\xb4", "'");      // Acute accent (´)
-    result.replace("\xe2\x80\x9c", "\""); // Left double quotation mark (")
-    result.replace("\xe2\x80\x9d", "\""); // Right double quotation mark (")
-    result.replace("\xe2\x80\x93", "-");  // En dash (–)
-    result.replace("\xe2\x80\x94", "-");  // Em dash (—)
-    result.replace("\xe2\x80\xa6", "..."); // Ellipsis (…)
-    return result;
+// Same for text that outlives the label (literals, icon symbols): the label
+// points at it instead of keeping a copy on the LVGL heap. Not for labels in
+// LV_LABEL_LONG_DOT mode, which writes its dots into the text.
+static bool setLabelStaticIfChanged(lv_obj_t* label, const char* text) {
+    if (label && strcmp(lv_label_get_text(label), text) != 0) {
+        lv_label_set_text_static(label, text);
+        return true;
+    }
+    return false;
 }
 
 // Global instance
@@ -34,59 +52,296 @@ UIManager uiManager;
 #define SCREEN_WIDTH 480
 #define SCREEN_HEIGHT 480
 
+// List rows: where the name starts, right of the icon
+static const int ROW_NAME_X = 56;
+
+// Card design of the current theme
+static LayoutFamily themeFamily() {
+    if (themeEngine.isLCARS()) return LayoutFamily::LCARS;
+    if (themeEngine.isCyberpunk()) return LayoutFamily::CYBERPUNK;
+    return LayoutFamily::STANDARD;
+}
+
 UIManager::UIManager()
     : screen(nullptr)
     , header(nullptr)
     , contentArea(nullptr)
     , actionBar(nullptr)
+    , headerTitle(nullptr)
+    , headerSubtitle(nullptr)
+    , lcarsCountLabel(nullptr)
+    , lcarsFrame(nullptr)
+    , lcarsElbow(nullptr)
+    , ipLabel(nullptr)
+    , cardPoolCount(0)
+    , cardPoolParent(nullptr)
     , numButtons(0)
+    , numCards(0)
     , numScenes(0)
+    , currentPage(0)
+    , pager(nullptr)
+    , tilesOn(false)
+    , tilePending(0)
+    , tileTimer(nullptr)
+    , pressFlash(nullptr)
+    , pressFlashTimer(nullptr)
+    , fanSpinTimer(nullptr)
+    , pressFlashStep(0)
     , buttonCallback(nullptr)
     , sceneCallback(nullptr)
+    , fanSpeedCallback(nullptr)
     , currentBrightness(80)
+    , suppressedUpdates(0)
     , needsRebuild(false)
+    , rebuildCount(0)
+    , lastRebuildUs(0)
+    , lastRebuildFull(false)
+    , rebuildGeneration(0)
+    , buildStage(BuildStage::IDLE)
+    , liveScreen(nullptr)
+    , buildShield(nullptr)
+    , numRetired(0)
+    , tintTheme(ThemeId::LIGHT_MODE)
+    , tintRevision(0)
+    , fanStream(sendFanSpeed)
     , otaScreen(nullptr)
+    , otaProgressBar(nullptr)
     , otaProgressLabel(nullptr)
 {
     memset(buttonCards, 0, sizeof(buttonCards));
     memset(sceneButtons, 0, sizeof(sceneButtons));
+    memset(cardTiles, 0, sizeof(cardTiles));
+    memset(&layout, 0, sizeof(layout));
+    memset(&plan, 0, sizeof(plan));
+    memset(&fanOverlay, 0, sizeof(fanOverlay));
+    fanOverlay.cardIndex = -1;
+    memset(cardIndexById, 0xFF, sizeof(cardIndexById));
+    memset(lcarsFieldLabels, 0, sizeof(lcarsFieldLabels));
+    memset(lcarsFieldText, 0, sizeof(lcarsFieldText));
+    lcarsFieldMux = portMUX_INITIALIZER_UNLOCKED;
 }
 
 void UIManager::begin() {
-    Serial.println("UIManager: Initializing...");
+    LOG_I("UIManager: Initializing...");
     setupBacklightPWM();
     needsRebuild = false;
 }
 
 void UIManager::requestRebuild() {
-    needsRebuild = true;
-    Serial.println("UIManager: Rebuild requested (will execute in main loop)");
+    postCommand({UICommandType::REBUILD, 0, 0, false});
+    LOG_I("UIManager: Rebuild requested (will execute in LVGL task)");
+}
+
+void UIManager::postButtonState(uint8_t buttonId, bool state) {
+    postCommand({UICommandType::BUTTON_STATE, buttonId, (uint8_t)(state ? 1 : 0), false});
+}
+
+void UIManager::postFanSpeed(uint8_t buttonId, uint8_t speedLevel) {
+    postCommand({UICommandType::FAN_SPEED, buttonId, speedLevel, false});
+}
+
+void UIManager::postActionFailed(uint8_t buttonId) {
+    postCommand({UICommandType::ACTION_FAILED, buttonId, 0, false});
+}
+
+void UIManager::postBrightness(uint8_t brightness) {
+    postCommand({UICommandType::BRIGHTNESS, 0, brightness, false});
+}
+
+void UIManager::postTheme(ThemeId id, bool rebuild) {
+    postCommand({UICommandType::THEME, 0, (uint8_t)id, rebuild});
+}
+
+bool UIManager::postSensorSample(uint8_t buttonId, float value) {
+    const ButtonConfig* btn = configManager.findButton(buttonId);
+    if (btn == nullptr || btn->type != ButtonType::SENSOR || !sensorHistory.push(buttonId, value)) {
+        return false;
+    }
+    postCommand({UICommandType::SENSOR_SAMPLE, buttonId, 0, false});
+    return true;
+}
+
+const char* const UIManager::LCARS_FIELD_IDS[LCARS_FIELD_COUNT] = {
+    "header_left", "header_right", "footer_left", "footer_right", "sidebar_top", "sidebar_bottom"
+};
+
+// What the LCARS frame shows without a live value
+static const char* const LCARS_FIELD_DEFAULTS[LCARS_FIELD_COUNT] = {
+    "LCARS", "HOME CTRL", "47634.8", "DECK 7 SECTION 4", "01", "42"
+};
+
+bool UIManager::postLCARSField(const char* id, const char* value) {
+    uint8_t field = 0;
+    while (field < LCARS_FIELD_COUNT && strcmp(id, LCARS_FIELD_IDS[field]) != 0) {
+        field++;
+    }
+    if (field == LCARS_FIELD_COUNT) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&lcarsFieldMux);
+    snprintf(lcarsFieldText[field], LCARS_FIELD_LEN, "%s", value);
+    portEXIT_CRITICAL(&lcarsFieldMux);
+    postCommand({UICommandType::LCARS_FIELD, field, 0, false});
+    return true;
+}
+
+void UIManager::postCommand(const UICommand& cmd) {
+    if (!commandQueue.post(cmd)) {
+        // Ring full - config already holds the latest state, a rebuild resyncs it
+        LOG_W("UIManager: Command queue full, falling back to rebuild");
+        needsRebuild = true;
+    }
+    lvglTask.wake();
+}
+
+void UIManager::processCommands() {
+    UICommand cmd;
+    while (commandQueue.pop(cmd)) {
+        switch (cmd.type) {
+            case UICommandType::BUTTON_STATE:
+                updateButtonState(cmd.buttonId, cmd.value != 0);
+                break;
+            case UICommandType::FAN_SPEED:
+                setFanSpeed(cmd.buttonId, cmd.value);
+                break;
+            case UICommandType::ACTION_FAILED:
+                flagActionFailed(cmd.buttonId);
+                break;
+            case UICommandType::BRIGHTNESS:
+                if (cmd.value == currentBrightness) {
+                    suppressedUpdates++;
+                    break;
+                }
+                setBrightness(cmd.value);
+                break;
+            case UICommandType::THEME:
+                if ((ThemeId)cmd.value != themeEngine.getCurrentThemeId()) {
+                    beginThemeTransition();
+                }
+                themeEngine.setTheme((ThemeId)cmd.value);
+                if (cmd.flag) needsRebuild = true;
+                break;
+            case UICommandType::LCARS_FIELD:
+                applyLCARSField(cmd.buttonId);
+                break;
+            case UICommandType::SENSOR_SAMPLE: {
+                // On another page: the card reads the history when it is built
+                UIButtonCard* card = findCard(cmd.buttonId);
+                if (card && card->chart) {
+                    refreshSensorCard(*card);
+                }
+                break;
+            }
+            case UICommandType::REBUILD:
+                needsRebuild = true;
+                break;
+        }
+    }
 }
 
 void UIManager::update() {
+    processCommands();
+
     if (needsRebuild) {
         needsRebuild = false;
 
-        // Get target brightness - use scheduled brightness if enabled
-        const DeviceConfig& config = configManager.getConfig();
-        uint8_t targetBrightness;
-        if (config.display.schedule.enabled) {
-            targetBrightness = brightnessScheduler.getTargetBrightness();
+        // Pin one config for the whole reconcile pass, or for setting up the
+        // staged rebuild that replaces it
+        rebuildGeneration = configManager.getGeneration();
+        ConfigSnapshot snapshot;
+        const DeviceConfig& config = *snapshot;
+
+        // A pushed config naming another theme fades like a scheduled switch
+        if (!config.display.dayNight.enabled && layout.valid && config.display.themeId != layout.theme) {
+            beginThemeTransition();
+        }
+
+        {
+            HeapTagScope heapTag(HEAP_TAG_UI_REBUILD);
+            int64_t start = esp_timer_get_time();
+            lastRebuildFull = !reconcileUI();
+            if (lastRebuildFull) {
+                LOG_I("UIManager: Layout changed, rebuilding UI");
+                rebuildUI();
+            }
+            lastRebuildUs = esp_timer_get_time() - start;
+        }
+        if (!isBuilding()) {
+            finishRebuild();
+        }
+    } else if (isBuilding()) {
+        // Counts the stages so far were built for are gone: start over
+        // (the rebuild request that comes with the new config would anyway)
+        ConfigSnapshot snapshot;
+        if (snapshot->buttons.size() != numButtons || snapshot->scenes.size() != numScenes) {
+            LOG_I("UIManager: Config changed mid-build, starting over");
+            rebuildGeneration = configManager.getGeneration();
+            rebuildUI();
+        }
+
+        // A stage per pass, so touch and frames run in between. Nothing is
+        // drawn while the panel is dark, so it builds in one go.
+        bool done;
+        {
+            HeapTagScope heapTag(HEAP_TAG_UI_REBUILD);
+            int64_t start = esp_timer_get_time();
+            do {
+                done = buildStep(BUILD_CARDS_PER_PASS);
+            } while (!done && lvglTask.isDarkIdle());
+            lastRebuildUs += esp_timer_get_time() - start;
+        }
+        if (done) {
+            swapBuiltScreen();
+            finishRebuild();
         } else {
-            targetBrightness = config.display.brightness;
+            lvglTask.wake();
         }
+    }
+
+    // A theme command whose rebuild never came (a staged one comes later)
+    if (!isBuilding()) {
+        themeTransition.poll();
+    }
+}
 
-        Serial.println("UIManager: Rebuilding UI");
-        rebuildUI();
-        setBrightness(targetBrightness);
-        Serial.printf("UIManager: UI rebuilt, brightness at %d%%\n", targetBrightness);
+void UIManager::finishRebuild() {
+    // Scheduled or light-level brightness, else the configured one
+    uint8_t targetBrightness = brightnessScheduler.getTargetBrightness();
+
+    // Nothing on screen points into a replaced icon pack any more.
+    // Copies of its icons, and those in the old theme's colors, are
+    // unreferenced now too, as are the old theme's decoration images.
+    bool packReleased = iconPack.releaseRetired(rebuildGeneration);
+    ThemeId currentTheme = themeEngine.getCurrentThemeId();
+    uint32_t currentRevision = themeEngine.getRevision(currentTheme);
+    bool themeChanged = currentTheme != tintTheme || currentRevision != tintRevision;
+    if (packReleased || themeChanged) {
+        iconTintCache.trim();
+    }
+    if (themeChanged) {
+        packedImages.trim();
+        tintTheme = currentTheme;
+        tintRevision = currentRevision;
     }
+    // The new theme is in place: fade to it from the captured frame
+    themeTransition.start(lv_scr_act());
+    setBrightness(targetBrightness);
+    rebuildCount++;
+    LOG_I("UIManager: UI updated, brightness at %d%%", targetBrightness);
+}
+
+void UIManager::beginThemeTransition() {
+    // Nothing to fade from while another screen or a dark panel is showing
+    if (screen == nullptr || screen != lv_scr_act() || currentBrightness == 0 || lvglTask.isDarkIdle()) {
+        return;
+    }
+    themeTransition.capture(screen);
 }
 
 void UIManager::setupBacklightPWM() {
-    // Setup LEDC PWM for backlight control
-    ledcSetup(BACKLIGHT_PWM_CHANNEL, 5000, 8);  // 5kHz, 8-bit resolution
-    ledcAttachPin(BACKLIGHT_PIN, BACKLIGHT_PWM_CHANNEL);
+    // LEDC PWM with hardware fades (see backlight.h)
+    backlight.begin(BACKLIGHT_PIN, BACKLIGHT_PWM_CHANNEL);
 
     // Apply initial brightness from config
     const DeviceConfig& config = configManager.getConfig();
@@ -96,19 +351,14 @@ void UIManager::setupBacklightPWM() {
 void UIManager::setBrightness(uint8_t brightness) {
     currentBrightness = brightness;
 
-    // Map brightness to PWM value with minimum threshold
-    // This display's backlight requires ~50% duty cycle minimum to stay lit
-    // 0% = off, 1-100% maps to PWM 128-255 to ensure visibility
-    uint8_t pwmValue;
-    if (brightness == 0) {
-        pwmValue = 0;  // Allow complete off
-    } else {
-        // Map 1-100 to 128-255 (minimum 50% duty cycle for this display)
-        pwmValue = map(brightness, 1, 100, 128, 255);
-    }
+    // Fades in hardware along a gamma curve, never below the panel's lit
+    // threshold except at 0%
+    backlight.set(brightness);
+}
 
-    ledcWrite(BACKLIGHT_PWM_CHANNEL, pwmValue);
-    Serial.printf("UIManager: Brightness set to %d%% (PWM: %d)\n", brightness, pwmValue);
+void UIManager::setBrightness(uint8_t brightness, uint32_t fadeMs) {
+    currentBrightness = brightness;
+    backlight.set(brightness, fadeMs);
 }
 
 uint8_t UIManager::getBrightness() const {
@@ -116,73 +366,671 @@ uint8_t UIManager::getBrightness() const {
 }
 
 void UIManager::createUI() {
-    Serial.println("UIManager: Creating UI...");
+    LOG_I("UIManager: Creating UI...");
 
+    // Lock-free pin of the live config; while it is held no writer can reuse
+    // a slot, so helpers that call getConfig() only see complete configs
+    ConfigSnapshot snapshot;
+
+    // At boot the UI is built straight onto the active screen, all at once
+    screen = lv_scr_act();
+    beginScreen();
+    buildStage = BuildStage::FRAME;
+    while (!buildStep(MAX_PAGE_CARDS)) {
+    }
+
+    LOG_I("UIManager: UI created successfully");
+}
+
+void UIManager::beginScreen() {
     const DeviceConfig& config = configManager.getConfig();
+    themeEngine.setCustomThemes(config.display.themes.begin(), config.display.themes.size());
 
     // Only set theme from config if dayNightMode is disabled.
     // If dayNightMode is enabled, the themeScheduler handles the theme.
     if (!config.display.dayNight.enabled) {
-        themeEngine.setTheme(config.display.theme);
-        Serial.printf("UIManager: Using static theme '%s'\n", config.display.theme.c_str());
+        themeEngine.setTheme(config.display.themeId);
+        LOG_I("UIManager: Using static theme '%s'", config.display.theme.c_str());
     } else {
-        Serial.printf("UIManager: Day/night mode enabled, using theme '%s' from scheduler\n",
+        LOG_I("UIManager: Day/night mode enabled, using theme '%s' from scheduler",
                       themeEngine.getCurrentThemeName().c_str());
     }
 
-    // Get screen and apply theme background
-    screen = lv_scr_act();
+    // Apply theme background
     lv_obj_set_layout(screen, 0);  // 0 = no layout in LVGL 8
     lv_obj_clear_flag(screen, LV_OBJ_FLAG_SCROLLABLE);
     themeEngine.applyToScreen(screen);
+    backgroundAnim.attach(screen);
+
+    // Pooled cards from another layout family can't be re-bound
+    trimCardPool();
+
+    // Cyberpunk paints its grid and glows under the cards' margins, and an
+    // animated background moves under them, which a tile flattened onto the
+    // background would cover
+    tilesOn = config.display.cardTiles && !themeEngine.isCyberpunk() && !backgroundAnim.isLoaded();
 
     // Store button/scene counts
     numButtons = config.buttons.size();
     numScenes = config.scenes.size();
 
-    Serial.printf("UIManager: Creating UI with %d buttons, %d scenes\n", numButtons, numScenes);
+    LOG_I("UIManager: Creating UI with %d buttons, %d scenes", numButtons, numScenes);
+}
 
-    // Theme-specific layouts
-    if (themeEngine.isLCARS()) {
-        createLCARSLayout();
-    } else {
-        // Standard layout
-        createHeader();
-        createButtonGrid();
+bool UIManager::buildStep(int cardBudget) {
+    switch (buildStage) {
+        case BuildStage::IDLE:
+            return true;
 
-        if (numScenes > 0) {
-            createActionBar();
-        }
+        case BuildStage::FRAME:
+            // Theme-specific layouts
+            if (themeEngine.isLCARS()) {
+                createLCARSFrame();
+            } else {
+                createHeader();
+            }
 
-        // Add Cyberpunk-specific decorations
-        if (themeEngine.isCyberpunk()) {
-            createCyberpunkDecorations();
+            updateLayoutPlan();
+            if (currentPage >= plan.pages) {
+                currentPage = plan.pages - 1;
+            }
+            numCards = 0;
+            buildStage = BuildStage::CARDS;
+            return false;
+
+        case BuildStage::CARDS: {
+            // Other pages' buttons stay config entries until their page is shown.
+            // Cards are bound from one pinned config, never past its buttons: a
+            // smaller one published mid-build restarts the build next pass.
+            ConfigSnapshot snapshot;
+            int first = firstOnPage();
+            int count = min((int)numButtons, (int)snapshot->buttons.size());
+            int total = count > first ? min(count - first, (int)plan.perPage) : 0;
+            while (numCards < total && cardBudget-- > 0) {
+                int index = numCards;
+                createGridCard(*snapshot, index);
+                numCards++;
+                cardIndexById[buttonCards[index].buttonId] = index;
+            }
+            if (numCards < total) {
+                return false;
+            }
+            if (numButtons == 0) {
+                LOG_I("UIManager: No buttons configured");
+            }
+            buildStage = BuildStage::DECOR;
+            return false;
         }
-    }
 
-    // Create fan speed overlay (hidden initially) - works with all themes
-    createFanOverlay();
+        case BuildStage::DECOR:
+            if (themeEngine.isLCARS()) {
+                createLCARSStatus();
+            } else {
+                if (numScenes > 0) {
+                    createActionBar();
+                }
+
+                // Add Cyberpunk-specific decorations
+                if (themeEngine.isCyberpunk()) {
+                    createCyberpunkDecorations();
+                }
+            }
+
+            // Edge swipes (see handleGesture() in main.cpp) and the dots flip pages
+            if (plan.pages > 1) {
+                createPager();
+            }
+
+            // The fan speed overlay is built on first use (see showFanOverlay)
 
-    Serial.println("UIManager: UI created successfully");
+            recordLayout();
+            buildStage = BuildStage::IDLE;
+            return true;
+    }
+    return true;
 }
 
 void UIManager::rebuildUI() {
-    Serial.println("UIManager: Rebuilding UI...");
+    LOG_I("UIManager: Rebuilding UI...");
 
-    // Clear existing UI (except screen)
-    lv_obj_clean(lv_scr_act());
+    // The overlay goes with the old screen, so nothing draws the frames again
+    releaseFanBackdrop();
+    if (fanSpinTimer) {
+        lv_timer_pause(fanSpinTimer);
+    }
+    releaseFanSpin();
+    if (isBuilding()) {
+        // The shown screen is still the one from before; only the half-built
+        // one goes, pooled cards re-bound into it included
+        lv_obj_del(screen);
+        buildStage = BuildStage::IDLE;
+    } else {
+        liveScreen = screen;
+
+        // The shown cards stay up until the swap, then go to the pool. Their
+        // tiles stay too; the cache backs them until it is cleared there.
+        for (int i = 0; i < numCards; i++) {
+            retiredCards[i] = buttonCards[i];
+        }
+        numRetired = numCards;
+        memset(cardTiles, 0, sizeof(cardTiles));
+        tilePending = 0;
+        if (tileTimer) {
+            lv_timer_pause(tileTimer);
+        }
+
+        // Their callbacks index buttonCards, which fills with the new cards;
+        // shield them (a server change prompt stays on top, usable)
+        if (liveScreen) {
+            buildShield = lv_obj_create(liveScreen);
+            lv_obj_remove_style_all(buildShield);
+            lv_obj_set_size(buildShield, SCREEN_WIDTH, SCREEN_HEIGHT);
+            lv_obj_add_flag(buildShield, LV_OBJ_FLAG_CLICKABLE);
+            if (serverChangeState.overlay && lv_obj_get_screen(serverChangeState.overlay) == liveScreen) {
+                lv_obj_move_foreground(serverChangeState.overlay);
+            }
+        }
+
+        // The fan overlay points at the old cards; it is recreated lazily for the new theme
+        if (fanOverlay.overlay) {
+            lv_obj_del(fanOverlay.overlay);
+        }
+        if (pressFlash) {
+            lv_obj_del(pressFlash);
+            pressFlash = nullptr;
+            lv_timer_pause(pressFlashTimer);
+        }
+    }
+    memset(&fanOverlay, 0, sizeof(fanOverlay));
+    fanOverlay.cardIndex = -1;
 
     // Reset tracking
-    memset(buttonCards, 0, sizeof(buttonCards));
+    for (int i = 0; i < MAX_PAGE_CARDS; i++) {
+        buttonCards[i] = UIButtonCard();
+    }
+    memset(cardIndexById, 0xFF, sizeof(cardIndexById));
     memset(sceneButtons, 0, sizeof(sceneButtons));
     numButtons = 0;
+    numCards = 0;
     numScenes = 0;
+    pager = nullptr;
     header = nullptr;
     contentArea = nullptr;
     actionBar = nullptr;
+    headerTitle = nullptr;
+    headerSubtitle = nullptr;
+    lcarsCountLabel = nullptr;
+    lcarsFrame = nullptr;
+    memset(lcarsFieldLabels, 0, sizeof(lcarsFieldLabels));
+    ipLabel = nullptr;
+    layout.valid = false;
+
+    // Recreate off-screen; update() runs the stages and swapBuiltScreen() loads it
+    screen = lv_obj_create(NULL);
+    beginScreen();
+    buildStage = BuildStage::FRAME;
+}
+
+void UIManager::swapBuiltScreen() {
+    lv_obj_t* old = liveScreen;
+    liveScreen = nullptr;
+    buildShield = nullptr;  // Goes with the old screen
+
+    // The old screen's cards are kept for the next rebuild to re-bind
+    for (int i = 0; i < numRetired; i++) {
+        releaseCard(retiredCards[i]);
+    }
+    numRetired = 0;
+    trimCardPool();
+
+    // A pending server change prompt moves across
+    if (old && serverChangeState.overlay && lv_obj_get_screen(serverChangeState.overlay) == old) {
+        lv_obj_set_parent(serverChangeState.overlay, screen);
+        lv_obj_move_foreground(serverChangeState.overlay);
+    }
+
+    // Under the OTA screen the new one waits for hideOTAScreen() to load it
+    if (old == nullptr || lv_scr_act() == old) {
+        lv_scr_load(screen);
+    }
+    if (old) {
+        lv_obj_del(old);
+    }
+
+    // Nothing shows the old tiles any more
+    cardTileCache.clear();
+    for (int i = 0; i < numCards; i++) {
+        scheduleCardTile(i);
+    }
+    LOG_I("UIManager: New screen loaded");
+}
+
+// ============================================================================
+// IN-PLACE RECONCILIATION
+// ============================================================================
 
-    // Recreate
-    createUI();
+bool UIManager::cardUsesImage(const ButtonConfig& btnConfig) {
+    return btnConfig.type == ButtonType::FAN || isImageIcon(btnConfig.iconId);
+}
+
+void UIManager::recordLayout() {
+    rebuildCardIndex();
+
+    layout.valid = true;
+    layout.theme = themeEngine.getCurrentThemeId();
+    layout.themeRevision = themeEngine.getRevision(layout.theme);
+    layout.numButtons = numButtons;
+    layout.numScenes = numScenes;
+    layout.pages = plan.pages;
+    layout.background = backgroundAnim.isLoaded();
+
+    ConfigSnapshot snapshot;
+    const DeviceConfig& config = *snapshot;
+    layout.cardLayout = config.display.cardLayout;
+    layout.cardTiles = config.display.cardTiles;
+    for (int i = 0; i < numButtons && i < (int)config.buttons.size(); i++) {
+        layout.buttonTypes[i] = config.buttons[i].type;
+        layout.buttonImageIcons[i] = cardUsesImage(config.buttons[i]);
+    }
+    for (int i = 0; i < numScenes && i < (int)config.scenes.size(); i++) {
+        layout.sceneImageIcons[i] = isImageIcon(config.scenes[i].iconId);
+    }
+}
+
+bool UIManager::reconcileUI() {
+    if (!layout.valid || screen == nullptr || screen != lv_scr_act()) {
+        return false;
+    }
+
+    // Pinned so the counts compared here are the ones the cards are bound from
+    ConfigSnapshot snapshot;
+    const DeviceConfig& config = *snapshot;
+
+    // Resolve the theme the same way createUI() does before comparing
+    themeEngine.setCustomThemes(config.display.themes.begin(), config.display.themes.size());
+    if (!config.display.dayNight.enabled) {
+        themeEngine.setTheme(config.display.themeId);
+    }
+    // Themes with the same layout (e.g. light/dark) are hot-swapped by
+    // rebuilding the shared styles; only LCARS/Cyberpunk/grid changes rebuild.
+    // An edited custom theme counts as a change even though its id is the same.
+    ThemeId currentTheme = themeEngine.getCurrentThemeId();
+    bool themeChanged = currentTheme != layout.theme ||
+                        themeEngine.getRevision(currentTheme) != layout.themeRevision;
+    if (themeChanged && !themeEngine.sharesLayout(layout.theme, currentTheme)) {
+        return false;
+    }
+    // LCARS and Cyberpunk color their frame and decorations as they are built
+    if (themeChanged && (themeEngine.isLCARS() || themeEngine.isCyberpunk())) {
+        return false;
+    }
+
+    uint8_t newButtons = min((int)config.buttons.size(), MAX_BUTTONS);
+    uint8_t newScenes = min((int)config.scenes.size(), MAX_SCENES);
+
+    // Scene count drives card height and the action bar, so it is structural
+    if (newScenes != layout.numScenes) {
+        return false;
+    }
+    for (int i = 0; i < newScenes; i++) {
+        if (isImageIcon(config.scenes[i].iconId) != layout.sceneImageIcons[i]) {
+            return false;
+        }
+    }
+
+    // The page indicator is built for a page count
+    if (LayoutPlan::pageCount(newButtons, themeFamily()) != layout.pages) {
+        return false;
+    }
+
+    if (config.display.cardTiles != layout.cardTiles) {
+        return false;
+    }
+
+    // The background image is added (and tiles decided) as a screen is built
+    if (backgroundAnim.isLoaded() != layout.background) {
+        return false;
+    }
+
+    // A new count or display.layout re-places every card
+    bool countChanged = (newButtons != layout.numButtons) || config.display.cardLayout != layout.cardLayout;
+    if (countChanged) {
+        // LCARS positions its status block and scenes from the row count
+        if (themeEngine.isLCARS()) {
+            return false;
+        }
+    } else {
+        // Same slots: each card must keep its widget kinds (toggle, image vs symbol)
+        for (int i = 0; i < newButtons; i++) {
+            if (config.buttons[i].type != layout.buttonTypes[i] ||
+                cardUsesImage(config.buttons[i]) != layout.buttonImageIcons[i]) {
+                return false;
+            }
+        }
+    }
+
+    int overlayCard = fanOverlay.visible ? fanOverlay.cardIndex : -1;
+
+    if (themeChanged) {
+        // Rebuilds the shared styles and reports the change to every object
+        themeEngine.applyToScreen(screen);
+    }
+
+    if (countChanged) {
+        hideFanOverlay();
+        replaceButtonCards(config, newButtons);
+    } else {
+        for (int i = 0; i < numCards; i++) {
+            patchButtonCard(i, config.buttons[firstOnPage() + i], themeChanged);
+        }
+    }
+    if (themeChanged) {
+        updatePager();
+    }
+
+    for (int i = 0; i < numScenes; i++) {
+        patchSceneButton(i, config.scenes[i], themeChanged);
+    }
+
+    // Header / status text that depends on config
+    if (headerTitle) {
+        setLabelTextIfChanged(headerTitle, config.device.title.length() > 0 ? config.device.title.c_str() : "Home");
+    }
+    if (headerSubtitle) {
+        String subtitleText = String(numButtons) + " " + (numButtons == 1 ? "Light" : "Lights");
+        setLabelTextIfChanged(headerSubtitle, subtitleText.c_str());
+    }
+    if (ipLabel) {
+        // Built before WiFi is up at boot
+        String ipText = "IP::" + WiFi.localIP().toString();
+        setLabelTextIfChanged(ipLabel, ipText.c_str());
+    }
+    if (lcarsCountLabel) {
+        int activeCount = 0;
+        for (int i = 0; i < numButtons; i++) {
+            if (config.buttons[i].state) activeCount++;
+        }
+        char buf[8];
+        snprintf(buf, sizeof(buf), "%d", activeCount);
+        setLabelTextIfChanged(lcarsCountLabel, buf);
+    }
+
+    // Re-open the fan overlay so its title and slider range follow the config
+    if (!countChanged && overlayCard >= 0) {
+        showFanOverlay(overlayCard);
+    }
+
+    recordLayout();
+    LOG_I("UIManager: Patched UI in place (%d buttons, %d scenes%s%s)",
+                  numButtons, numScenes, countChanged ? ", cards replaced" : "",
+                  themeChanged ? ", theme swapped" : "");
+    return true;
+}
+
+void UIManager::patchButtonCard(int index, const ButtonConfig& btnConfig, bool restyle) {
+    UIButtonCard& card = buttonCards[index];
+    if (card.card == nullptr) return;
+
+    bool visualChanged = restyle ||
+                         (card.currentState != btnConfig.state ||
+                         card.speedSteps != btnConfig.speedSteps ||
+                         card.speedLevel != btnConfig.speedLevel);
+    // Anything but the on/off state makes the card's tiles stale
+    bool contentChanged = restyle || card.buttonId != btnConfig.id ||
+                          card.speedSteps != btnConfig.speedSteps ||
+                          card.speedLevel != btnConfig.speedLevel;
+
+    card.buttonId = btnConfig.id;
+    card.currentState = btnConfig.state;
+    card.speedSteps = btnConfig.speedSteps;
+    card.speedLevel = btnConfig.speedLevel;
+    if (!themeEngine.isLCARS()) {
+        // createLCARSCard() never binds scene fields; keep click behaviour identical
+        card.isSceneButton = (btnConfig.type == ButtonType::SCENE);
+        card.sceneId = btnConfig.sceneId;
+    }
+
+    // Icon source (kind is unchanged, reconcileUI() checked that)
+    if (card.iconIsImage) {
+        const void* src = (btnConfig.type == ButtonType::FAN) ? (const void*)&fan_icon
+                                                              : (const void*)getIconImage(btnConfig.iconId);
+        if (src && iconTintCache.baseOf(lv_img_get_src(card.icon)) != src) {
+            setIconImage(card.icon, src, lv_obj_get_style_img_recolor(card.icon, LV_PART_MAIN));
+            contentChanged = true;
+        }
+    } else {
+        contentChanged |= setLabelStaticIfChanged(card.icon, getIconSymbol(btnConfig.iconId));
+    }
+
+    contentChanged |= applyCardName(card, btnConfig.name.c_str(), lv_obj_get_style_width(card.card, LV_PART_MAIN));
+
+    if (card.chart) {
+        // A pooled card may have come from a slot of another size, and
+        // another sensor's history or unit
+        layoutSensorCard(card);
+        if (restyle) styleSensorCard(card);
+        refreshSensorCard(card);
+        return;
+    }
+    if (contentChanged) {
+        dropCardTiles(index);
+    }
+    if (visualChanged) {
+        updateCardVisual(card);
+    }
+}
+
+void UIManager::patchSceneButton(int index, const SceneConfig& scnConfig, bool restyle) {
+    UISceneButton& scene = sceneButtons[index];
+    if (scene.button == nullptr) return;
+
+    scene.sceneId = scnConfig.id;
+    setLabelTextIfChanged(scene.label, sceneLabelText(scnConfig).c_str());
+
+    if (scene.icon) {
+        const lv_img_dsc_t* src = getIconImage(scnConfig.iconId);
+        if (src && iconTintCache.baseOf(lv_img_get_src(scene.icon)) != src) {
+            setIconImage(scene.icon, src, lv_obj_get_style_img_recolor(scene.icon, LV_PART_MAIN));
+        }
+    }
+
+    // Hot-swapped themes only reach the standard action bar (see sharesLayout)
+    if (restyle && !themeEngine.isLCARS() && !themeEngine.isCyberpunk()) {
+        const ThemeDefinition& theme = themeEngine.getCurrentTheme();
+        bool isPrimary = (index != 0);
+        lv_color_t textColor = isPrimary ? lv_color_white() : theme.colors.textPrimary;
+        lv_obj_set_style_text_color(scene.label, textColor, 0);
+        if (scene.icon) {
+            setIconColor(scene.icon, textColor);
+        }
+    }
+}
+
+void UIManager::replaceButtonCards(const DeviceConfig& config, uint8_t count) {
+    // The grid geometry depends on the count, so every card is re-placed
+    // (re-bound from the pool where possible), but the header, action bar, decorations and overlays are kept
+    for (int i = 0; i < numCards; i++) {
+        releaseCard(buttonCards[i]);
+    }
+    clearCardTiles();
+
+    numButtons = count;
+    createButtonGrid(config);
+
+    // New cards were appended on top; keep the overlays above them
+    if (fanOverlay.overlay) {
+        lv_obj_move_foreground(fanOverlay.overlay);
+    }
+    if (serverChangeState.overlay) {
+        lv_obj_move_foreground(serverChangeState.overlay);
+    }
+}
+
+// ============================================================================
+// CARD POOL
+// ============================================================================
+
+uint8_t UIManager::cardKind(const ButtonConfig& btnConfig, const LayoutPlan& slots) {
+    // Layout family | type class | icon kind | card shape
+    uint8_t typeClass = btnConfig.type == ButtonType::SENSOR ? 3 :
+                        btnConfig.type == ButtonType::SCENE ? 2 :
+                        btnConfig.type == ButtonType::FAN ? 1 : 0;
+    return ((uint8_t)slots.family << 5) | (typeClass << 3) | (cardUsesImage(btnConfig) ? 4 : 0) | slots.shape;
+}
+
+bool UIManager::acquirePooledCard(int index, const ButtonConfig& btnConfig, uint8_t kind,
+                                  int x, int y, int w, int h) {
+    for (int i = 0; i < cardPoolCount; i++) {
+        if (cardPool[i].poolKind != kind) continue;
+
+        UIButtonCard& card = buttonCards[index];
+        card = cardPool[i];
+        cardPool[i] = cardPool[cardPoolCount - 1];
+        cardPool[--cardPoolCount] = UIButtonCard();
+
+        lv_obj_set_parent(card.card, screen);
+        lv_obj_set_size(card.card, w, h);
+        lv_obj_set_pos(card.card, x, y);
+        lv_obj_clear_flag(card.card, LV_OBJ_FLAG_HIDDEN);
+
+        // Event handlers carry the slot index, re-bind them to this slot
+        lv_obj_remove_event_cb(card.card, onCardClicked);
+        lv_obj_add_event_cb(card.card, onCardClicked, LV_EVENT_CLICKED, (void*)(intptr_t)index);
+        if (lv_obj_remove_event_cb(card.card, onCyberpunkCardDraw)) {
+            lv_obj_add_event_cb(card.card, onCyberpunkCardDraw, LV_EVENT_DRAW_MAIN_END, (void*)(intptr_t)index);
+        }
+        if (card.toggle) {
+            lv_obj_remove_event_cb(card.toggle, onToggleChanged);
+            lv_obj_add_event_cb(card.toggle, onToggleChanged, LV_EVENT_VALUE_CHANGED, (void*)(intptr_t)index);
+        }
+
+        patchButtonCard(index, btnConfig, true);
+
+        // Cyberpunk scene icons use the slot's neon colour rather than the state colour
+        if (themeEngine.isCyberpunk() && btnConfig.type == ButtonType::SCENE) {
+            lv_color_t neon = themeEngine.getCurrentTheme().colors.neonColors[index % 6];
+            if (card.iconIsImage) {
+                setIconColor(card.icon, neon);
+            } else {
+                lv_obj_set_style_text_color(card.icon, neon, 0);
+            }
+        }
+
+        LOG_D("UIManager: Re-bound pooled card to slot %d '%s'", index, btnConfig.name.c_str());
+        return true;
+    }
+    return false;
+}
+
+void UIManager::releaseCard(UIButtonCard& card) {
+    if (card.card == nullptr) return;
+
+    if (cardPoolCount < MAX_PAGE_CARDS) {
+        if (cardPoolParent == nullptr) {
+            cardPoolParent = lv_obj_create(NULL);  // Never loaded, just a holder
+        }
+        lv_anim_del(card.card, NULL);  // A failed action's outline may still be fading
+        lv_obj_clear_state(card.card, LV_STATE_PRESSED | LV_STATE_FOCUSED);
+        lv_obj_remove_local_style_prop(card.card, LV_STYLE_OPA, 0);  // Was standing behind a tile
+        lv_obj_add_flag(card.card, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_set_parent(card.card, cardPoolParent);
+        cardPool[cardPoolCount++] = card;
+    } else {
+        lv_obj_del(card.card);
+    }
+    card = UIButtonCard();
+}
+
+void UIManager::trimCardPool() {
+    uint8_t family = (uint8_t)themeFamily();
+    int kept = 0;
+    for (int i = 0; i < cardPoolCount; i++) {
+        if ((cardPool[i].poolKind >> 5) == family) {
+            if (kept != i) cardPool[kept] = cardPool[i];
+            kept++;
+        } else {
+            lv_obj_del(cardPool[i].card);
+        }
+    }
+    for (int i = kept; i < cardPoolCount; i++) {
+        cardPool[i] = UIButtonCard();
+    }
+    cardPoolCount = kept;
+}
+
+bool UIManager::applyCardName(UIButtonCard& card, const char* name, int cardWidth) {
+    // Names come folded for the fonts from the config (ConfigArena::internDisplay)
+    String upper;
+    if (themeEngine.isLCARS() || themeEngine.isCyberpunk()) {
+        upper = name;
+        upper.toUpperCase();
+        name = upper.c_str();
+    }
+    bool changed = setLabelTextIfChanged(card.nameLabel, name);
+
+    // Choose font size based on name length
+    size_t nameLen = strlen(name);
+    const lv_font_t* font;
+
+    if (card.chart) {
+        // One line, as wide as layoutSensorCard() leaves it
+        font = nameLen > 14 ? &lv_font_montserrat_12 : &lv_font_montserrat_14;
+        lv_label_set_long_mode(card.nameLabel, LV_LABEL_LONG_DOT);
+    } else if (themeEngine.isLCARS()) {
+        if (plan.shape == CARD_SHAPE_REGULAR) {
+            // Tall cards
+            font = nameLen > 18 ? &lv_font_montserrat_12 : nameLen > 14 ? &lv_font_montserrat_14 : &lv_font_montserrat_16;
+            lv_obj_set_width(card.nameLabel, cardWidth - 38);  // More room for text
+        } else {
+            // Short cards: use smaller fonts
+            font = nameLen > 16 ? &lv_font_montserrat_12 : &lv_font_montserrat_14;
+            lv_obj_set_width(card.nameLabel, cardWidth - 34);
+        }
+        lv_obj_set_style_max_height(card.nameLabel, 20, 0);  // Single line height
+        lv_label_set_long_mode(card.nameLabel, LV_LABEL_LONG_DOT);
+    } else if (themeEngine.isCyberpunk()) {
+        font = nameLen > 16 ? &lv_font_montserrat_12 : nameLen > 12 ? &lv_font_montserrat_14 : &lv_font_montserrat_16;
+        lv_obj_set_width(card.nameLabel, cardWidth - 20);  // Limit width with padding
+        lv_label_set_long_mode(card.nameLabel, LV_LABEL_LONG_DOT);  // Add ... if still too long
+    } else if (plan.shape == CARD_SHAPE_ROW) {
+        // One line between the icon and the toggle
+        font = nameLen > 18 ? &lv_font_montserrat_14 : &lv_font_montserrat_16;
+        lv_obj_set_width(card.nameLabel, cardWidth - ROW_NAME_X - (card.toggle ? 72 : 14));
+        lv_label_set_long_mode(card.nameLabel, LV_LABEL_LONG_DOT);
+    } else if (plan.shape == CARD_SHAPE_COMPACT) {
+        // Compact mode: larger fonts than before, allow wrapping
+        font = nameLen > 18 ? &lv_font_montserrat_14 : &lv_font_montserrat_16;
+        lv_obj_set_width(card.nameLabel, cardWidth - 16);  // More width in compact mode
+        lv_label_set_long_mode(card.nameLabel, LV_LABEL_LONG_WRAP);  // Allow wrap
+        lv_obj_set_style_text_line_space(card.nameLabel, -1, 0);  // Slightly tighter line spacing
+    } else {
+        font = nameLen > 16 ? &lv_font_montserrat_12 : nameLen > 12 ? &lv_font_montserrat_14 : &lv_font_montserrat_16;
+        lv_obj_set_width(card.nameLabel, cardWidth - 36);  // Limit width with padding
+        lv_label_set_long_mode(card.nameLabel, LV_LABEL_LONG_DOT);  // Add ... if still too long
+    }
+
+    if (lv_obj_get_style_text_font(card.nameLabel, LV_PART_MAIN) != font) {
+        lv_obj_set_style_text_font(card.nameLabel, font, 0);
+    }
+    return changed;
+}
+
+String UIManager::sceneLabelText(const SceneConfig& scnConfig) const {
+    String name = scnConfig.name;
+    if (themeEngine.isLCARS()) {
+        name.toUpperCase();
+        return name;
+    }
+    if (themeEngine.isCyberpunk()) {
+        // Bracketed uppercase text
+        name.toUpperCase();
+        return "[ " + name + " ]";
+    }
+    if (isImageIcon(scnConfig.iconId)) {
+        return name;
+    }
+    // Symbol icon and text in a single label
+    return String(getIconSymbol(scnConfig.iconId)) + " " + name;
 }
 
 void UIManager::createHeader() {
@@ -196,13 +1044,14 @@ void UIManager::createHeader() {
     lv_obj_set_pos(header, 0, 0);
     themeEngine.styleHeader(header);
 
-    Serial.printf("UIManager: Created header at (0, 0) size %dx70\n", SCREEN_WIDTH);
+    LOG_I("UIManager: Created header at (0, 0) size %dx70", SCREEN_WIDTH);
 
     if (themeEngine.isCyberpunk()) {
         // Cyberpunk style header with tech accents
-        lv_color_t neonCyan = lv_color_hex(0x00d4ff);
-        lv_color_t neonPink = lv_color_hex(0xff0080);
-        lv_color_t neonYellow = lv_color_hex(0xffff00);
+        lv_color_t neonCyan = theme.colors.neonColors[CYBERPUNK_CYAN];
+        lv_color_t neonPink = theme.colors.neonColors[CYBERPUNK_PINK];
+        lv_color_t neonYellow = theme.colors.neonColors[CYBERPUNK_YELLOW];
+        lv_color_t neonGreen = theme.colors.neonColors[CYBERPUNK_GREEN];
 
         // Left accent bar (vertical cyan line)
         lv_obj_t* leftAccent = lv_obj_create(header);
@@ -219,14 +1068,14 @@ void UIManager::createHeader() {
 
         // Title with glow
         lv_obj_t* title = lv_label_create(header);
-        lv_label_set_text(title, "// SMART_HOME");
+        lv_label_set_text_static(title, "// SMART_HOME");
         lv_obj_set_style_text_font(title, &lv_font_montserrat_24, 0);
         lv_obj_set_style_text_color(title, neonCyan, 0);
         lv_obj_align(title, LV_ALIGN_LEFT_MID, 22, -10);
 
         // Subtitle with version
         lv_obj_t* subtitle = lv_label_create(header);
-        lv_label_set_text(subtitle, "CTRL_PANEL v2.1 [ACTIVE]");
+        lv_label_set_text_static(subtitle, "CTRL_PANEL v2.1 [ACTIVE]");
         lv_obj_set_style_text_font(subtitle, &lv_font_montserrat_14, 0);
         lv_obj_set_style_text_color(subtitle, theme.colors.textSecondary, 0);
         lv_obj_align(subtitle, LV_ALIGN_LEFT_MID, 22, 12);
@@ -236,24 +1085,24 @@ void UIManager::createHeader() {
         lv_obj_clear_flag(statusDot, LV_OBJ_FLAG_SCROLLABLE);
         lv_obj_set_size(statusDot, 8, 8);
         lv_obj_align(statusDot, LV_ALIGN_RIGHT_MID, -80, -10);
-        lv_obj_set_style_bg_color(statusDot, lv_color_hex(0x00ff88), 0);
+        lv_obj_set_style_bg_color(statusDot, neonGreen, 0);
         lv_obj_set_style_bg_opa(statusDot, LV_OPA_COVER, 0);
         lv_obj_set_style_border_width(statusDot, 0, 0);
         lv_obj_set_style_radius(statusDot, LV_RADIUS_CIRCLE, 0);
         lv_obj_set_style_shadow_width(statusDot, 10, 0);
-        lv_obj_set_style_shadow_color(statusDot, lv_color_hex(0x00ff88), 0);
+        lv_obj_set_style_shadow_color(statusDot, neonGreen, 0);
         lv_obj_set_style_shadow_opa(statusDot, LV_OPA_80, 0);
 
         // Status text
         lv_obj_t* statusText = lv_label_create(header);
-        lv_label_set_text(statusText, "SYS_OK");
+        lv_label_set_text_static(statusText, "SYS_OK");
         lv_obj_set_style_text_font(statusText, &lv_font_montserrat_14, 0);
-        lv_obj_set_style_text_color(statusText, lv_color_hex(0x00ff88), 0);
+        lv_obj_set_style_text_color(statusText, neonGreen, 0);
         lv_obj_align(statusText, LV_ALIGN_RIGHT_MID, -15, -10);
 
         // Connection indicator
         lv_obj_t* connText = lv_label_create(header);
-        lv_label_set_text(connText, "NET::CONNECTED");
+        lv_label_set_text_static(connText, "NET::CONNECTED");
         lv_obj_set_style_text_font(connText, &lv_font_montserrat_14, 0);
         lv_obj_set_style_text_color(connText, theme.colors.textSecondary, 0);
         lv_obj_align(connText, LV_ALIGN_RIGHT_MID, -15, 10);
@@ -268,115 +1117,357 @@ void UIManager::createHeader() {
         lv_obj_set_style_border_width(scanLine, 0, 0);
     } else {
         // Standard style: device name with light count
-        lv_obj_t* title = lv_label_create(header);
-        String titleText = config.device.name.length() > 0 ? config.device.name : "Home";
-        lv_label_set_text(title, titleText.c_str());
-        lv_obj_set_style_text_font(title, &lv_font_montserrat_24, 0);
-        themeEngine.styleLabel(title, true);
-        lv_obj_align(title, LV_ALIGN_LEFT_MID, 20, 0);
-
-        lv_obj_t* subtitle = lv_label_create(header);
+        headerTitle = lv_label_create(header);
+        const char* titleText = config.device.title.length() > 0 ? config.device.title.c_str() : "Home";
+        lv_label_set_text(headerTitle, titleText);
+        lv_obj_set_style_text_font(headerTitle, &lv_font_montserrat_24, 0);
+        themeEngine.styleLabel(headerTitle, true);
+        lv_obj_align(headerTitle, LV_ALIGN_LEFT_MID, 20, 0);
+
+        headerSubtitle = lv_label_create(header);
         String subtitleText = String(numButtons) + " " + (numButtons == 1 ? "Light" : "Lights");
-        lv_label_set_text(subtitle, subtitleText.c_str());
-        lv_obj_set_style_text_font(subtitle, &lv_font_montserrat_14, 0);
-        themeEngine.styleLabel(subtitle, false);
-        lv_obj_align(subtitle, LV_ALIGN_RIGHT_MID, -20, 0);
-    }
-}
-
-void UIManager::calculateGridLayout(int numButtons, int& cols, int& rows,
-                                    int& cardWidth, int& cardHeight, int& gap) {
-    // Layout calculations based on button count
-    // Available area: 480x480, header=70px, content starts at y=90
-    // Action bar if present: 60px, at y=360 (leaving ~40px margin)
-
-    gap = 20;
-    int availableHeight = numScenes > 0 ? 250 : 340;  // Less height if action bar present
-    int startY = 90;
-
-    switch (numButtons) {
-        case 2:
-            cols = 2;
-            rows = 1;
-            cardWidth = 200;
-            cardHeight = 110;
-            break;
-        case 3:
-            cols = 3;
-            rows = 1;
-            cardWidth = 140;
-            cardHeight = 110;
-            break;
-        case 4:
-            cols = 2;
-            rows = 2;
-            cardWidth = 200;
-            cardHeight = 110;
-            break;
-        case 5:
-            cols = 3;
-            rows = 2;
-            cardWidth = 140;
-            cardHeight = 110;
-            break;
-        case 6:
-            cols = 3;
-            rows = 2;
-            cardWidth = 140;
-            cardHeight = 110;
-            break;
-        case 7:
-        case 8:
-        case 9:
-            // 3x3 grid for 7-9 buttons
-            cols = 3;
-            rows = 3;
-            gap = 12;  // Tighter gap for 3x3 grid
-            cardWidth = 130;
-            // Card height: 78px with scenes, 110px without - more room for text
-            cardHeight = numScenes > 0 ? 78 : 110;
-            break;
-        default:
-            // Fallback for 1 button or invalid count
-            cols = 1;
-            rows = 1;
-            cardWidth = 200;
-            cardHeight = 110;
-            break;
-    }
-}
-
-void UIManager::createButtonGrid() {
-    const DeviceConfig& config = configManager.getConfig();
+        lv_label_set_text(headerSubtitle, subtitleText.c_str());
+        lv_obj_set_style_text_font(headerSubtitle, &lv_font_montserrat_14, 0);
+        themeEngine.styleLabel(headerSubtitle, false);
+        lv_obj_align(headerSubtitle, LV_ALIGN_RIGHT_MID, -20, 0);
+    }
+}
+
+void UIManager::updateLayoutPlan() {
+    if (plan.update(numButtons, numScenes, themeFamily(), configManager.getConfig().display.cardLayout)) {
+        LOG_I("UIManager: Planned %s %ux%u layout, %u cards of %dx%d",
+                      cardLayoutName(plan.mode), plan.cols, plan.rows, plan.buttons,
+                      plan.cards[0].w, plan.cards[0].h);
+    }
+}
+
+void UIManager::createButtonGrid(const DeviceConfig& config) {
+    updateLayoutPlan();
+    if (currentPage >= plan.pages) {
+        currentPage = plan.pages - 1;
+    }
 
     if (numButtons == 0) {
-        Serial.println("UIManager: No buttons configured");
+        numCards = 0;
+        LOG_I("UIManager: No buttons configured");
         return;
     }
 
-    int cols, rows, cardWidth, cardHeight, gap;
-    calculateGridLayout(numButtons, cols, rows, cardWidth, cardHeight, gap);
+    // Other pages' buttons stay config entries until their page is shown
+    int count = min((int)numButtons, (int)config.buttons.size());
+    numCards = max(0, min(count - firstOnPage(), (int)plan.perPage));
+    for (int i = 0; i < numCards; i++) {
+        createGridCard(config, i);
+    }
+}
+
+void UIManager::createGridCard(const DeviceConfig& config, int index) {
+    const ButtonConfig& btnConfig = config.buttons[firstOnPage() + index];
+    if (btnConfig.type == ButtonType::SENSOR) {
+        createSensorCard(index, btnConfig);
+    } else if (themeEngine.isLCARS()) {
+        createLCARSCard(index, btnConfig);
+    } else {
+        createButtonCard(index, btnConfig);
+    }
+    bindCardPress(index);
+    scheduleCardTile(index);
+}
+
+// ============================================================================
+// PAGES
+// ============================================================================
+
+void UIManager::showPage(uint8_t page) {
+    // Mid-build the shown cards are shielded and buttonCards holds the next
+    // screen's; with a rebuild pending, numButtons and the pages are stale
+    if (screen == nullptr || isBuilding() || needsRebuild || page >= plan.pages || page == currentPage) return;
+
+    // The new page's cards are bound from one pinned config. One whose buttons
+    // no longer match the built layout was published after it; its rebuild
+    // request is on the way, so the flip waits for that.
+    ConfigSnapshot snapshot;
+    if (snapshot->buttons.size() != numButtons) return;
+
+    if (fanOverlay.visible) {
+        hideFanOverlay();
+    }
+
+    // The shown cards go back to the pool and are re-bound to the new page's buttons
+    currentPage = page;
+    replaceButtonCards(*snapshot, numButtons);
+    rebuildCardIndex();
+    updatePager();
+    LOG_I("UIManager: Showing page %u of %u (%u cards)", currentPage + 1, plan.pages, numCards);
+}
+
+void UIManager::createPager() {
+    const int dot = 8;
+    const int spacing = 16;
+    const int pad = 6;          // Around the dots, to make them easier to tap
+
+    pager = lv_obj_create(screen);
+    lv_obj_set_layout(pager, 0);
+    lv_obj_clear_flag(pager, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(pager, plan.pages * spacing, dot + 2 * pad);
+    lv_obj_set_pos(pager, plan.pagerX - plan.pages * spacing / 2, plan.pagerY - dot / 2 - pad);
+    lv_obj_set_style_bg_opa(pager, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(pager, 0, 0);
+    lv_obj_set_style_pad_all(pager, 0, 0);
+    lv_obj_add_event_cb(pager, onPagerClicked, LV_EVENT_CLICKED, nullptr);
+
+    for (int i = 0; i < plan.pages; i++) {
+        lv_obj_t* d = lv_obj_create(pager);
+        lv_obj_clear_flag(d, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_set_size(d, dot, dot);
+        lv_obj_set_pos(d, i * spacing + (spacing - dot) / 2, pad);
+        lv_obj_set_style_radius(d, LV_RADIUS_CIRCLE, 0);
+        lv_obj_set_style_border_width(d, 0, 0);
+        lv_obj_set_style_bg_opa(d, LV_OPA_COVER, 0);
+    }
+    updatePager();
+}
+
+void UIManager::updatePager() {
+    if (pager == nullptr) return;
+
+    const ThemeDefinition& theme = themeEngine.getCurrentTheme();
+    lv_color_t active = themeEngine.isLCARS() ? theme.colors.neonColors[LCARS_FRAME] : theme.colors.accent;
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(pager); i++) {
+        lv_obj_t* d = lv_obj_get_child(pager, i);
+        lv_obj_set_style_bg_color(d, i == currentPage ? active : theme.colors.textSecondary, 0);
+        lv_obj_set_style_bg_opa(d, i == currentPage ? LV_OPA_COVER : LV_OPA_50, 0);
+    }
+}
+
+void UIManager::onPagerClicked(lv_event_t* e) {
+    uiManager.showPage((uiManager.currentPage + 1) % uiManager.plan.pages);
+}
+
+// ============================================================================
+// CARD TILES
+// ============================================================================
 
-    // Calculate starting position to center the grid
-    int totalWidth = cols * cardWidth + (cols - 1) * gap;
-    int startX = (SCREEN_WIDTH - totalWidth) / 2;
-    // Cyberpunk with 7+ buttons needs to start higher to leave room for footer
-    int startY = (themeEngine.isCyberpunk() && numButtons >= 7) ? 75 : 90;
+// How long a card stays live after its last press or change
+static const uint32_t TILE_SETTLE_MS = 500;
 
-    Serial.printf("UIManager: Grid %dx%d, card %dx%d, gap %d, startX %d\n",
-                  cols, rows, cardWidth, cardHeight, gap, startX);
+bool UIManager::cardShowsTile(int index) const {
+    return cardTiles[index] != nullptr && !lv_obj_has_flag(cardTiles[index], LV_OBJ_FLAG_HIDDEN);
+}
 
-    for (int i = 0; i < numButtons && i < MAX_BUTTONS; i++) {
-        int col = i % cols;
-        int row = i / cols;
-        int x = startX + col * (cardWidth + gap);
-        int y = startY + row * (cardHeight + gap);
+bool UIManager::showCardTile(int index) {
+    UIButtonCard& card = buttonCards[index];
+    const CardTile* tile = cardTileCache.get(index, card.currentState);
+    if (tile == nullptr) {
+        // Snapshot the card as it is really drawn
+        showCardLive(index);
+        lv_color_t background = lv_obj_get_style_bg_color(screen, LV_PART_MAIN);
+        tile = cardTileCache.capture(index, card.currentState, card.card, plan.gap / 2, background);
+        if (tile == nullptr) {
+            return false;
+        }
+    }
+    placeCardTile(index, *tile);
+    return true;
+}
 
-        createButtonCard(i, config.buttons[i], x, y);
+void UIManager::placeCardTile(int index, const CardTile& tile) {
+    UIButtonCard& card = buttonCards[index];
+    lv_obj_t* img = cardTiles[index];
+    if (img == nullptr) {
+        // Just below its card, which stays on top to take input
+        img = lv_img_create(screen);
+        lv_obj_clear_flag(img, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_move_to_index(img, lv_obj_get_index(card.card));
+        cardTiles[index] = img;
     }
+    lv_img_set_src(img, &tile.dsc);
+    lv_obj_set_pos(img, lv_obj_get_x(card.card) - tile.margin, lv_obj_get_y(card.card) - tile.margin);
+    lv_obj_clear_flag(img, LV_OBJ_FLAG_HIDDEN);
+
+    // A transparent object isn't drawn at all, children included
+    lv_obj_set_style_opa(card.card, LV_OPA_TRANSP, 0);
+}
+
+void UIManager::showCardLive(int index) {
+    if (!cardShowsTile(index)) return;
+    lv_obj_add_flag(cardTiles[index], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_remove_local_style_prop(buttonCards[index].card, LV_STYLE_OPA, 0);
+}
+
+void UIManager::scheduleCardTile(int index) {
+    // Cards built off-screen are tiled once their screen is loaded; sensor
+    // cards change with every sample and always draw live
+    if (!tilesOn || isBuilding() || buttonCards[index].card == nullptr || buttonCards[index].chart) return;
+
+    tilePending |= 1 << index;
+    if (tileTimer == nullptr) {
+        tileTimer = lv_timer_create(onTileTimer, TILE_SETTLE_MS, nullptr);
+    }
+    lv_timer_reset(tileTimer);
+    lv_timer_resume(tileTimer);
+}
+
+void UIManager::settleCardTiles() {
+    uint16_t busy = 0;
+    for (int i = 0; i < numCards; i++) {
+        if (!(tilePending & (1 << i))) continue;
+
+        // Still pressed, flashing or sliding its toggle knob: try again later
+        UIButtonCard& card = buttonCards[i];
+        if (lv_obj_has_state(card.card, LV_STATE_PRESSED) || lv_anim_get(card.card, NULL) ||
+            (card.toggle && (lv_obj_has_state(card.toggle, LV_STATE_PRESSED) || lv_anim_get(card.toggle, NULL)))) {
+            busy |= 1 << i;
+            continue;
+        }
+        // Without room for a tile the card just stays live
+        showCardTile(i);
+    }
+    tilePending = busy;
+    if (tilePending == 0) {
+        lv_timer_pause(tileTimer);
+    }
+}
+
+void UIManager::dropCardTiles(int index) {
+    showCardLive(index);
+    if (isBuilding()) return;  // The cache still backs the shown screen's tiles
+    cardTileCache.invalidate(index);
+    scheduleCardTile(index);
+}
+
+void UIManager::flagActionFailed(uint8_t buttonId) {
+    UIButtonCard* card = findCard(buttonId);
+    if (card == nullptr) return;  // On another page; nothing to point at
+
+    // Drawn live while the outline fades; no theme styles the outline, so
+    // clearing it afterwards leaves the card as the theme drew it
+    int index = card - buttonCards;
+    showCardLive(index);
+    lv_obj_t* cardObj = card->card;
+    lv_obj_set_style_outline_color(cardObj, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_outline_width(cardObj, 2, 0);
+    lv_obj_set_style_outline_pad(cardObj, 2, 0);
+    lv_obj_set_style_outline_opa(cardObj, LV_OPA_COVER, 0);
+
+    static const lv_anim_exec_xcb_t fadeOutline = [](void* obj, int32_t val) {
+        lv_obj_set_style_outline_opa((lv_obj_t*)obj, val, 0);
+    };
+
+    // Restarting replaces a fade still running from an earlier failure
+    lv_anim_del(cardObj, fadeOutline);
+    lv_anim_t anim;
+    lv_anim_init(&anim);
+    lv_anim_set_var(&anim, cardObj);
+    lv_anim_set_time(&anim, ACTION_FAILED_FADE_MS);
+    lv_anim_set_delay(&anim, ACTION_FAILED_HOLD_MS);
+    lv_anim_set_exec_cb(&anim, fadeOutline);
+    lv_anim_set_values(&anim, LV_OPA_COVER, LV_OPA_TRANSP);
+    lv_anim_set_path_cb(&anim, lv_anim_path_ease_in);
+    lv_anim_set_ready_cb(&anim, [](lv_anim_t* a) {
+        lv_obj_t* obj = (lv_obj_t*)a->var;
+        lv_obj_remove_local_style_prop(obj, LV_STYLE_OUTLINE_COLOR, 0);
+        lv_obj_remove_local_style_prop(obj, LV_STYLE_OUTLINE_WIDTH, 0);
+        lv_obj_remove_local_style_prop(obj, LV_STYLE_OUTLINE_PAD, 0);
+        lv_obj_remove_local_style_prop(obj, LV_STYLE_OUTLINE_OPA, 0);
+
+        // Back to its tile, if the card is still shown
+        for (int i = 0; i < uiManager.numCards; i++) {
+            if (uiManager.buttonCards[i].card == obj) {
+                uiManager.scheduleCardTile(i);
+                break;
+            }
+        }
+    });
+    lv_anim_start(&anim);
+}
+
+void UIManager::flashCard(int index, lv_color_t color) {
+    lv_obj_t* cardObj = buttonCards[index].card;
+
+    // Kept on the screen (hidden) between flashes; a rebuild deletes it
+    if (pressFlash == nullptr) {
+        pressFlash = lv_obj_create(screen);
+        lv_obj_remove_style_all(pressFlash);
+        lv_obj_clear_flag(pressFlash, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    }
+    if (pressFlashTimer == nullptr) {
+        pressFlashTimer = lv_timer_create(onPressFlashTimer, PRESS_FLASH_STEP_MS, nullptr);
+    }
+
+    // No shadow or border, so it invalidates the card's box and nothing more
+    lv_obj_set_pos(pressFlash, lv_obj_get_x(cardObj), lv_obj_get_y(cardObj));
+    lv_obj_set_size(pressFlash, lv_obj_get_width(cardObj), lv_obj_get_height(cardObj));
+    lv_obj_set_style_radius(pressFlash, lv_obj_get_style_radius(cardObj, LV_PART_MAIN), 0);
+    lv_obj_set_style_bg_color(pressFlash, color, 0);
+    lv_obj_set_style_bg_opa(pressFlash, LV_OPA_80, 0);
+    lv_obj_clear_flag(pressFlash, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_move_foreground(pressFlash);
+
+    pressFlashStep = 0;
+    lv_timer_reset(pressFlashTimer);
+    lv_timer_resume(pressFlashTimer);
+}
+
+void UIManager::onPressFlashTimer(lv_timer_t* timer) {
+    uint8_t step = ++uiManager.pressFlashStep;
+    if (step <= PRESS_FLASH_HOLD_STEPS) {
+        return;
+    }
+
+    uint8_t fade = step - PRESS_FLASH_HOLD_STEPS;
+    if (fade >= PRESS_FLASH_FADE_STEPS || uiManager.pressFlash == nullptr) {
+        if (uiManager.pressFlash) {
+            lv_obj_add_flag(uiManager.pressFlash, LV_OBJ_FLAG_HIDDEN);
+        }
+        lv_timer_pause(timer);
+        return;
+    }
+    lv_obj_set_style_bg_opa(uiManager.pressFlash,
+                            LV_OPA_80 * (PRESS_FLASH_FADE_STEPS - fade) / PRESS_FLASH_FADE_STEPS, 0);
+}
+
+void UIManager::clearCardTiles() {
+    for (int i = 0; i < MAX_PAGE_CARDS; i++) {
+        if (cardTiles[i]) {
+            lv_obj_del(cardTiles[i]);
+            cardTiles[i] = nullptr;
+        }
+    }
+    cardTileCache.clear();
+    tilePending = 0;
+}
+
+void UIManager::bindCardPress(int index) {
+    // Pooled cards carry the handlers of their last slot
+    lv_obj_t* targets[] = {buttonCards[index].card, buttonCards[index].toggle};
+    for (lv_obj_t* obj : targets) {
+        if (obj == nullptr) continue;
+        while (lv_obj_remove_event_cb(obj, onCardPress)) {
+        }
+        lv_obj_add_event_cb(obj, onCardPress, LV_EVENT_PRESSED, (void*)(intptr_t)index);
+        lv_obj_add_event_cb(obj, onCardPress, LV_EVENT_RELEASED, (void*)(intptr_t)index);
+        lv_obj_add_event_cb(obj, onCardPress, LV_EVENT_PRESS_LOST, (void*)(intptr_t)index);
+    }
+}
+
+void UIManager::onCardPress(lv_event_t* e) {
+    int index = (int)(intptr_t)lv_event_get_user_data(e);
+    if (index < 0 || index >= uiManager.numCards) return;
+
+    // Pressed cards draw live, for their pressed style and whatever the tap starts
+    if (lv_event_get_code(e) == LV_EVENT_PRESSED) {
+        uiManager.showCardLive(index);
+    } else {
+        uiManager.scheduleCardTile(index);
+    }
+}
+
+void UIManager::onTileTimer(lv_timer_t* timer) {
+    uiManager.settleCardTiles();
 }
 
-void UIManager::createButtonCard(int index, const ButtonConfig& btnConfig, int gridX, int gridY) {
+void UIManager::createButtonCard(int index, const ButtonConfig& btnConfig) {
     const ThemeDefinition& theme = themeEngine.getCurrentTheme();
 
     UIButtonCard& card = buttonCards[index];
@@ -387,11 +1478,19 @@ void UIManager::createButtonCard(int index, const ButtonConfig& btnConfig, int g
     card.isSceneButton = (btnConfig.type == ButtonType::SCENE);
     card.sceneId = btnConfig.sceneId;
 
-    // Calculate card size
-    int cols, rows, cardWidth, cardHeight, gap;
-    calculateGridLayout(numButtons, cols, rows, cardWidth, cardHeight, gap);
+    const CardRect& rect = plan.cards[index];
+    int gridX = rect.x;
+    int gridY = rect.y;
+    int cardWidth = rect.w;
+    int cardHeight = rect.h;
 
-    Serial.printf("UIManager: Creating card %d '%s' at (%d, %d) size %dx%d\n",
+    uint8_t kind = cardKind(btnConfig, plan);
+    if (acquirePooledCard(index, btnConfig, kind, gridX, gridY, cardWidth, cardHeight)) {
+        return;
+    }
+    card.poolKind = kind;
+
+    LOG_D("UIManager: Creating card %d '%s' at (%d, %d) size %dx%d",
                   index, btnConfig.name.c_str(), gridX, gridY, cardWidth, cardHeight);
 
     // Create card container
@@ -411,61 +1510,27 @@ void UIManager::createButtonCard(int index, const ButtonConfig& btnConfig, int g
         // Cyberpunk style: centered icon, uppercase name, ONLINE/OFFLINE status
         lv_color_t cardNeonColor = theme.colors.neonColors[index % 6];
 
-        // Add corner accent decorations (top-left and bottom-right)
-        lv_obj_t* cornerTL = lv_obj_create(card.card);
-        lv_obj_clear_flag(cornerTL, LV_OBJ_FLAG_SCROLLABLE);
-        lv_obj_set_size(cornerTL, 12, 2);
-        lv_obj_set_pos(cornerTL, 4, 4);
-        lv_obj_set_style_bg_color(cornerTL, cardNeonColor, 0);
-        lv_obj_set_style_bg_opa(cornerTL, LV_OPA_80, 0);
-        lv_obj_set_style_border_width(cornerTL, 0, 0);
-
-        lv_obj_t* cornerTL2 = lv_obj_create(card.card);
-        lv_obj_clear_flag(cornerTL2, LV_OBJ_FLAG_SCROLLABLE);
-        lv_obj_set_size(cornerTL2, 2, 12);
-        lv_obj_set_pos(cornerTL2, 4, 4);
-        lv_obj_set_style_bg_color(cornerTL2, cardNeonColor, 0);
-        lv_obj_set_style_bg_opa(cornerTL2, LV_OPA_80, 0);
-        lv_obj_set_style_border_width(cornerTL2, 0, 0);
-
-        lv_obj_t* cornerBR = lv_obj_create(card.card);
-        lv_obj_clear_flag(cornerBR, LV_OBJ_FLAG_SCROLLABLE);
-        lv_obj_set_size(cornerBR, 12, 2);
-        lv_obj_set_pos(cornerBR, cardWidth - 16, cardHeight - 6);
-        lv_obj_set_style_bg_color(cornerBR, cardNeonColor, 0);
-        lv_obj_set_style_bg_opa(cornerBR, LV_OPA_80, 0);
-        lv_obj_set_style_border_width(cornerBR, 0, 0);
-
-        lv_obj_t* cornerBR2 = lv_obj_create(card.card);
-        lv_obj_clear_flag(cornerBR2, LV_OBJ_FLAG_SCROLLABLE);
-        lv_obj_set_size(cornerBR2, 2, 12);
-        lv_obj_set_pos(cornerBR2, cardWidth - 6, cardHeight - 16);
-        lv_obj_set_style_bg_color(cornerBR2, cardNeonColor, 0);
-        lv_obj_set_style_bg_opa(cornerBR2, LV_OPA_80, 0);
-        lv_obj_set_style_border_width(cornerBR2, 0, 0);
+        // Corner accent decorations (top-left and bottom-right), painted by the card itself
+        lv_obj_add_event_cb(card.card, onCyberpunkCardDraw, LV_EVENT_DRAW_MAIN_END, (void*)(intptr_t)index);
 
         // Large centered icon at top - use image for fans and custom icons, symbols for others
         if (btnConfig.type == ButtonType::FAN) {
             card.icon = lv_img_create(card.card);
-            lv_img_set_src(card.icon, &fan_icon);
-            lv_obj_set_style_img_recolor(card.icon, themeEngine.getIconColor(card.currentState, index), 0);
-            lv_obj_set_style_img_recolor_opa(card.icon, LV_OPA_COVER, 0);
+            setIconImage(card.icon, &fan_icon, themeEngine.getIconColor(card.currentState, index));
             lv_obj_align(card.icon, LV_ALIGN_TOP_MID, 0, 15);
             card.iconIsImage = true;
-        } else if (isImageIcon(btnConfig.icon)) {
+        } else if (isImageIcon(btnConfig.iconId)) {
             // Use custom image icon
             card.icon = lv_img_create(card.card);
-            lv_img_set_src(card.icon, getIconImage(btnConfig.icon));
             lv_color_t iconColor = (btnConfig.type == ButtonType::SCENE) ? cardNeonColor : themeEngine.getIconColor(card.currentState, index);
-            lv_obj_set_style_img_recolor(card.icon, iconColor, 0);
-            lv_obj_set_style_img_recolor_opa(card.icon, LV_OPA_COVER, 0);
+            setIconImage(card.icon, getIconImage(btnConfig.iconId), iconColor);
             lv_obj_align(card.icon, LV_ALIGN_TOP_MID, 0, 15);
             card.iconIsImage = true;
         } else {
             // Use text symbol
             card.icon = lv_label_create(card.card);
-            const char* iconSymbol = getIconSymbol(btnConfig.icon);
-            lv_label_set_text(card.icon, iconSymbol);
+            const char* iconSymbol = getIconSymbol(btnConfig.iconId);
+            lv_label_set_text_static(card.icon, iconSymbol);
             lv_obj_set_style_text_font(card.icon, &lv_font_montserrat_28, 0);
             lv_color_t iconColor = (btnConfig.type == ButtonType::SCENE) ? cardNeonColor : themeEngine.getIconColor(card.currentState, index);
             lv_obj_set_style_text_color(card.icon, iconColor, 0);
@@ -475,30 +1540,17 @@ void UIManager::createButtonCard(int index, const ButtonConfig& btnConfig, int g
 
         // Uppercase room name, centered - use smaller font for long names
         card.nameLabel = lv_label_create(card.card);
-        String upperName = sanitizeForDisplay(btnConfig.name);
-        upperName.toUpperCase();
-        lv_label_set_text(card.nameLabel, upperName.c_str());
-        // Choose font size based on name length
-        size_t nameLen = upperName.length();
-        if (nameLen > 16) {
-            lv_obj_set_style_text_font(card.nameLabel, &lv_font_montserrat_12, 0);
-        } else if (nameLen > 12) {
-            lv_obj_set_style_text_font(card.nameLabel, &lv_font_montserrat_14, 0);
-        } else {
-            lv_obj_set_style_text_font(card.nameLabel, &lv_font_montserrat_16, 0);
-        }
+        applyCardName(card, btnConfig.name.c_str(), cardWidth);
         themeEngine.styleLabel(card.nameLabel, true);
-        lv_obj_set_width(card.nameLabel, cardWidth - 20);  // Limit width with padding
-        lv_label_set_long_mode(card.nameLabel, LV_LABEL_LONG_DOT);  // Add ... if still too long
         lv_obj_set_style_text_align(card.nameLabel, LV_TEXT_ALIGN_CENTER, 0);
         lv_obj_align(card.nameLabel, LV_ALIGN_CENTER, 0, 10);
 
         // Status text: [ONLINE] / [OFFLINE] - scene buttons don't show status
         card.stateLabel = lv_label_create(card.card);
         if (btnConfig.type == ButtonType::SCENE) {
-            lv_label_set_text(card.stateLabel, "");  // No status text for scene buttons
+            lv_label_set_text_static(card.stateLabel, "");  // No status text for scene buttons
         } else {
-            lv_label_set_text(card.stateLabel, card.currentState ? "[ONLINE]" : "[OFFLINE]");
+            lv_label_set_text_static(card.stateLabel, card.currentState ? "[ONLINE]" : "[OFFLINE]");
         }
         lv_obj_set_style_text_font(card.stateLabel, &lv_font_montserrat_14, 0);
         lv_obj_set_style_text_color(card.stateLabel, themeEngine.getIconColor(card.currentState, index), 0);
@@ -508,38 +1560,38 @@ void UIManager::createButtonCard(int index, const ButtonConfig& btnConfig, int g
         card.toggle = nullptr;
     } else {
         // Standard style with toggle switch (except for scene buttons)
-        // Compact mode for 7+ buttons - smaller toggles, adjusted spacing
-        bool compactMode = (numButtons >= 7);
-        int iconPadding = compactMode ? 10 : 18;
-        int toggleWidth = compactMode ? 44 : 50;
-        int toggleHeight = compactMode ? 22 : 26;
-        int togglePadding = compactMode ? 8 : 15;
+        // Compact mode for dense grids - smaller toggles, adjusted spacing;
+        // list rows put icon, name and toggle on one line
+        bool compactMode = (plan.shape == CARD_SHAPE_COMPACT);
+        bool rowMode = (plan.shape == CARD_SHAPE_ROW);
+        int iconPadding = compactMode ? 10 : (rowMode ? 14 : 18);
+        int toggleWidth = (compactMode || rowMode) ? 44 : 50;
+        int toggleHeight = (compactMode || rowMode) ? 22 : 26;
+        int togglePadding = compactMode ? 8 : (rowMode ? 14 : 15);
+        lv_align_t iconAlign = rowMode ? LV_ALIGN_LEFT_MID : LV_ALIGN_TOP_LEFT;
+        int iconY = rowMode ? 0 : iconPadding;
 
         // Icon - use image for fans and custom icons, symbols for others
         // Note: Image icons keep full size in compact mode (scaling causes rendering issues)
         if (btnConfig.type == ButtonType::FAN) {
             card.icon = lv_img_create(card.card);
-            lv_img_set_src(card.icon, &fan_icon);
-            lv_obj_set_style_img_recolor(card.icon, themeEngine.getIconColor(card.currentState, index), 0);
-            lv_obj_set_style_img_recolor_opa(card.icon, LV_OPA_COVER, 0);
-            lv_obj_align(card.icon, LV_ALIGN_TOP_LEFT, iconPadding, iconPadding);
+            setIconImage(card.icon, &fan_icon, themeEngine.getIconColor(card.currentState, index));
+            lv_obj_align(card.icon, iconAlign, iconPadding, iconY);
             card.iconIsImage = true;
-        } else if (isImageIcon(btnConfig.icon)) {
+        } else if (isImageIcon(btnConfig.iconId)) {
             // Use custom image icon
             card.icon = lv_img_create(card.card);
-            lv_img_set_src(card.icon, getIconImage(btnConfig.icon));
-            lv_obj_set_style_img_recolor(card.icon, themeEngine.getIconColor(card.currentState, index), 0);
-            lv_obj_set_style_img_recolor_opa(card.icon, LV_OPA_COVER, 0);
-            lv_obj_align(card.icon, LV_ALIGN_TOP_LEFT, iconPadding, iconPadding);
+            setIconImage(card.icon, getIconImage(btnConfig.iconId), themeEngine.getIconColor(card.currentState, index));
+            lv_obj_align(card.icon, iconAlign, iconPadding, iconY);
             card.iconIsImage = true;
         } else {
             // Use text symbol - slightly smaller in compact mode
             card.icon = lv_label_create(card.card);
-            const char* iconSymbol = getIconSymbol(btnConfig.icon);
-            lv_label_set_text(card.icon, iconSymbol);
-            lv_obj_set_style_text_font(card.icon, compactMode ? &lv_font_montserrat_24 : &lv_font_montserrat_28, 0);
+            const char* iconSymbol = getIconSymbol(btnConfig.iconId);
+            lv_label_set_text_static(card.icon, iconSymbol);
+            lv_obj_set_style_text_font(card.icon, plan.iconFont, 0);
             lv_obj_set_style_text_color(card.icon, themeEngine.getIconColor(card.currentState, index), 0);
-            lv_obj_align(card.icon, LV_ALIGN_TOP_LEFT, iconPadding, iconPadding);
+            lv_obj_align(card.icon, iconAlign, iconPadding, iconY);
             card.iconIsImage = false;
         }
 
@@ -550,7 +1602,7 @@ void UIManager::createButtonCard(int index, const ButtonConfig& btnConfig, int g
         } else {
             card.toggle = lv_switch_create(card.card);
             lv_obj_set_size(card.toggle, toggleWidth, toggleHeight);
-            lv_obj_align(card.toggle, LV_ALIGN_TOP_RIGHT, -togglePadding, iconPadding);
+            lv_obj_align(card.toggle, rowMode ? LV_ALIGN_RIGHT_MID : LV_ALIGN_TOP_RIGHT, -togglePadding, iconY);
             themeEngine.styleSwitch(card.toggle);
 
             if (card.currentState) {
@@ -562,32 +1614,11 @@ void UIManager::createButtonCard(int index, const ButtonConfig& btnConfig, int g
 
         // Room name label - in compact mode use larger fonts and allow wrapping
         card.nameLabel = lv_label_create(card.card);
-        String sanitizedName = sanitizeForDisplay(btnConfig.name);
-        lv_label_set_text(card.nameLabel, sanitizedName.c_str());
-        size_t nameLen = sanitizedName.length();
-        if (compactMode) {
-            // Compact mode: larger fonts than before, allow wrapping
-            if (nameLen > 18) {
-                lv_obj_set_style_text_font(card.nameLabel, &lv_font_montserrat_14, 0);
-            } else {
-                lv_obj_set_style_text_font(card.nameLabel, &lv_font_montserrat_16, 0);
-            }
-            lv_obj_set_width(card.nameLabel, cardWidth - 16);  // More width in compact mode
-            lv_label_set_long_mode(card.nameLabel, LV_LABEL_LONG_WRAP);  // Allow wrap
-            lv_obj_set_style_text_line_space(card.nameLabel, -1, 0);  // Slightly tighter line spacing
-        } else {
-            if (nameLen > 16) {
-                lv_obj_set_style_text_font(card.nameLabel, &lv_font_montserrat_12, 0);
-            } else if (nameLen > 12) {
-                lv_obj_set_style_text_font(card.nameLabel, &lv_font_montserrat_14, 0);
-            } else {
-                lv_obj_set_style_text_font(card.nameLabel, &lv_font_montserrat_16, 0);
-            }
-            lv_obj_set_width(card.nameLabel, cardWidth - 36);  // Limit width with padding
-            lv_label_set_long_mode(card.nameLabel, LV_LABEL_LONG_DOT);  // Add ... if still too long
-        }
+        applyCardName(card, btnConfig.name.c_str(), cardWidth);
         themeEngine.styleLabel(card.nameLabel, true);
-        if (compactMode) {
+        if (rowMode) {
+            lv_obj_align(card.nameLabel, LV_ALIGN_LEFT_MID, ROW_NAME_X, 0);
+        } else if (compactMode) {
             // In compact mode, position text in the middle-lower area for better centering
             // Card is 110px, icon area is ~45px, so start text around y=50
             lv_obj_align(card.nameLabel, LV_ALIGN_TOP_LEFT, 10, 50);
@@ -595,13 +1626,13 @@ void UIManager::createButtonCard(int index, const ButtonConfig& btnConfig, int g
             lv_obj_align(card.nameLabel, LV_ALIGN_BOTTOM_LEFT, 18, -18);
         }
 
-        // Status text (for themes that show it) - hidden in compact mode to save space
-        if (themeEngine.showsStatusText() && !compactMode) {
+        // Status text (for themes that show it) - only on regular cards, to save space
+        if (themeEngine.showsStatusText() && plan.shape == CARD_SHAPE_REGULAR) {
             card.stateLabel = lv_label_create(card.card);
             if (btnConfig.type == ButtonType::SCENE) {
-                lv_label_set_text(card.stateLabel, "Tap to run");
+                lv_label_set_text_static(card.stateLabel, "Tap to run");
             } else {
-                lv_label_set_text(card.stateLabel, themeEngine.getStateText(card.currentState));
+                lv_label_set_text_static(card.stateLabel, themeEngine.getStateText(card.currentState));
             }
             lv_obj_set_style_text_font(card.stateLabel, &lv_font_montserrat_14, 0);
             lv_obj_set_style_text_color(card.stateLabel, themeEngine.getIconColor(card.currentState, index), 0);
@@ -624,10 +1655,10 @@ void UIManager::createActionBar() {
     lv_obj_set_pos(actionBar, 30, 360);
     themeEngine.styleActionBar(actionBar);
 
-    Serial.printf("UIManager: Created action bar at (30, 360) size 420x60\n");
+    LOG_I("UIManager: Created action bar at (30, 360) size 420x60");
 
-    // Create scene buttons
-    for (int i = 0; i < numScenes && i < MAX_SCENES; i++) {
+    // Create scene buttons (never past a config published since the count was taken)
+    for (int i = 0; i < numScenes && i < MAX_SCENES && i < (int)config.scenes.size(); i++) {
         bool isLeft = (i == 0);
         createSceneButton(i, config.scenes[i], isLeft);
     }
@@ -662,15 +1693,12 @@ void UIManager::createSceneButton(int index, const SceneConfig& scnConfig, bool
         lv_obj_set_style_radius(scene.button, theme.style.buttonRadius, 0);
 
         // Color based on primary/secondary
-        lv_color_t borderColor = isPrimary ? lv_color_hex(0x00ff88) : lv_color_hex(0xff0080);  // Green / Pink
+        lv_color_t borderColor = theme.colors.neonColors[isPrimary ? CYBERPUNK_GREEN : CYBERPUNK_PINK];
         lv_obj_set_style_border_color(scene.button, borderColor, 0);
 
         // Bracketed uppercase text
         scene.label = lv_label_create(scene.button);
-        String upperName = scnConfig.name;
-        upperName.toUpperCase();
-        String labelText = "[ " + upperName + " ]";
-        lv_label_set_text(scene.label, labelText.c_str());
+        lv_label_set_text(scene.label, sceneLabelText(scnConfig).c_str());
         lv_obj_set_style_text_color(scene.label, borderColor, 0);
         lv_obj_center(scene.label);
     } else {
@@ -679,23 +1707,20 @@ void UIManager::createSceneButton(int index, const SceneConfig& scnConfig, bool
 
         // For image-based icons, create an image + label side by side
         // For symbol icons, use a single label with icon + text
-        if (isImageIcon(scnConfig.icon)) {
+        if (isImageIcon(scnConfig.iconId)) {
             // Create a horizontal container for image + text
-            lv_obj_t* iconImg = lv_img_create(scene.button);
-            lv_img_set_src(iconImg, getIconImage(scnConfig.icon));
-            lv_obj_set_style_img_recolor(iconImg, isPrimary ? lv_color_white() : theme.colors.textPrimary, 0);
-            lv_obj_set_style_img_recolor_opa(iconImg, LV_OPA_COVER, 0);
-            lv_obj_align(iconImg, LV_ALIGN_LEFT_MID, 15, 0);
+            scene.icon = lv_img_create(scene.button);
+            setIconImage(scene.icon, getIconImage(scnConfig.iconId), isPrimary ? lv_color_white() : theme.colors.textPrimary);
+            lv_obj_align(scene.icon, LV_ALIGN_LEFT_MID, 15, 0);
 
             scene.label = lv_label_create(scene.button);
-            lv_label_set_text(scene.label, scnConfig.name.c_str());
+            lv_label_set_text(scene.label, sceneLabelText(scnConfig).c_str());
             lv_obj_set_style_text_color(scene.label, isPrimary ? lv_color_white() : theme.colors.textPrimary, 0);
             lv_obj_align(scene.label, LV_ALIGN_LEFT_MID, 55, 0);  // Offset for icon
         } else {
             // Label with symbol icon and text
             scene.label = lv_label_create(scene.button);
-            String labelText = String(getIconSymbol(scnConfig.icon)) + " " + scnConfig.name;
-            lv_label_set_text(scene.label, labelText.c_str());
+            lv_label_set_text(scene.label, sceneLabelText(scnConfig).c_str());
             // Use white text on primary (accent) buttons, dark text on secondary buttons
             lv_obj_set_style_text_color(scene.label, isPrimary ? lv_color_white() : theme.colors.textPrimary, 0);
             lv_obj_center(scene.label);
@@ -709,37 +1734,125 @@ void UIManager::createSceneButton(int index, const SceneConfig& scnConfig, bool
 // CYBERPUNK DECORATIONS
 // ============================================================================
 
-void UIManager::createCyberpunkDecorations() {
-    lv_color_t neonCyan = lv_color_hex(0x00d4ff);
-    lv_color_t neonPink = lv_color_hex(0xff0080);
-    lv_color_t neonGreen = lv_color_hex(0x00ff88);
-    lv_color_t gridColor = lv_color_hex(0x00d4ff);
+// Static background decor, painted onto the screen behind all children.
+// Drawing primitives directly avoids ~20 full lv_obj instances (and the
+// transformed layer rendering the rotated accents used to need).
+struct CyberpunkDot {
+    int16_t x, y;
+    uint8_t color;      // CyberpunkColorRole
+};
+
+static const CyberpunkDot CYBERPUNK_DOTS[] = {
+    {SCREEN_WIDTH - 20, 80, CYBERPUNK_PINK},
+    {20, 330, CYBERPUNK_CYAN},
+    {SCREEN_WIDTH - 25, 330, CYBERPUNK_GREEN},
+};
+
+void UIManager::onCyberpunkBackgroundDraw(lv_event_t* e) {
+    lv_draw_ctx_t* drawCtx = lv_event_get_draw_ctx(e);
+    lv_obj_t* scr = lv_event_get_target(e);
+    lv_area_t coords;
+    lv_obj_get_coords(scr, &coords);
+    const lv_color_t* neon = themeEngine.getCurrentTheme().colors.neonColors;
 
     // === Background grid lines (subtle tech grid) ===
-    // Vertical grid lines
+    lv_draw_rect_dsc_t gridDsc;
+    lv_draw_rect_dsc_init(&gridDsc);
+    gridDsc.bg_color = neon[CYBERPUNK_CYAN];
+    gridDsc.bg_opa = LV_OPA_10;
+
+    lv_area_t line;
     for (int x = 60; x < SCREEN_WIDTH; x += 80) {
-        lv_obj_t* vLine = lv_obj_create(screen);
-        lv_obj_clear_flag(vLine, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_set_size(vLine, 1, SCREEN_HEIGHT);
-        lv_obj_set_pos(vLine, x, 0);
-        lv_obj_set_style_bg_color(vLine, gridColor, 0);
-        lv_obj_set_style_bg_opa(vLine, LV_OPA_10, 0);
-        lv_obj_set_style_border_width(vLine, 0, 0);
-        lv_obj_move_to_index(vLine, 0);  // Send to back
+        line.x1 = coords.x1 + x;
+        line.x2 = line.x1;
+        line.y1 = coords.y1;
+        line.y2 = coords.y1 + SCREEN_HEIGHT - 1;
+        lv_draw_rect(drawCtx, &gridDsc, &line);
     }
-
-    // Horizontal grid lines
     for (int y = 80; y < SCREEN_HEIGHT; y += 80) {
-        lv_obj_t* hLine = lv_obj_create(screen);
-        lv_obj_clear_flag(hLine, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_set_size(hLine, SCREEN_WIDTH, 1);
-        lv_obj_set_pos(hLine, 0, y);
-        lv_obj_set_style_bg_color(hLine, gridColor, 0);
-        lv_obj_set_style_bg_opa(hLine, LV_OPA_10, 0);
-        lv_obj_set_style_border_width(hLine, 0, 0);
-        lv_obj_move_to_index(hLine, 0);  // Send to back
+        line.x1 = coords.x1;
+        line.x2 = coords.x1 + SCREEN_WIDTH - 1;
+        line.y1 = coords.y1 + y;
+        line.y2 = line.y1;
+        lv_draw_rect(drawCtx, &gridDsc, &line);
     }
 
+    // === Diagonal accent lines in corners (40px at +/-45 degrees) ===
+    lv_draw_line_dsc_t diagDsc;
+    lv_draw_line_dsc_init(&diagDsc);
+    diagDsc.width = 2;
+    diagDsc.opa = LV_OPA_60;
+
+    lv_point_t p1, p2;
+    diagDsc.color = neon[CYBERPUNK_PINK];  // Top-right
+    p1.x = coords.x1 + SCREEN_WIDTH - 55;  p1.y = coords.y1 + 75;
+    p2.x = p1.x + 28;                      p2.y = p1.y + 28;
+    lv_draw_line(drawCtx, &diagDsc, &p1, &p2);
+
+    diagDsc.color = neon[CYBERPUNK_CYAN];  // Bottom-left
+    p1.x = coords.x1 + 15;  p1.y = coords.y1 + 340;
+    p2.x = p1.x + 28;       p2.y = p1.y - 28;
+    lv_draw_line(drawCtx, &diagDsc, &p1, &p2);
+
+    // === Small glowing accent dots ===
+    lv_draw_rect_dsc_t dotDsc;
+    lv_draw_rect_dsc_init(&dotDsc);
+    dotDsc.bg_opa = LV_OPA_COVER;
+    dotDsc.radius = LV_RADIUS_CIRCLE;
+    dotDsc.shadow_width = 8;
+    dotDsc.shadow_opa = LV_OPA_70;
+
+    for (const CyberpunkDot& dot : CYBERPUNK_DOTS) {
+        dotDsc.bg_color = neon[dot.color];
+        dotDsc.shadow_color = dotDsc.bg_color;
+        lv_area_t area = {
+            (lv_coord_t)(coords.x1 + dot.x), (lv_coord_t)(coords.y1 + dot.y),
+            (lv_coord_t)(coords.x1 + dot.x + 3), (lv_coord_t)(coords.y1 + dot.y + 3)
+        };
+        lv_draw_rect(drawCtx, &dotDsc, &area);
+    }
+}
+
+void UIManager::onCyberpunkCardDraw(lv_event_t* e) {
+    int index = (int)(intptr_t)lv_event_get_user_data(e);
+    lv_obj_t* cardObj = lv_event_get_target(e);
+    lv_draw_ctx_t* drawCtx = lv_event_get_draw_ctx(e);
+
+    lv_area_t content;
+    lv_obj_get_content_coords(cardObj, &content);
+    lv_coord_t w = lv_obj_get_width(cardObj);
+    lv_coord_t h = lv_obj_get_height(cardObj);
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = themeEngine.getCurrentTheme().colors.neonColors[index % 6];
+    dsc.bg_opa = LV_OPA_80;
+
+    // {x, y, w, h} relative to the card content, matching the old accent objects
+    const lv_coord_t corners[4][4] = {
+        {4, 4, 12, 2}, {4, 4, 2, 12},
+        {(lv_coord_t)(w - 16), (lv_coord_t)(h - 6), 12, 2},
+        {(lv_coord_t)(w - 6), (lv_coord_t)(h - 16), 2, 12},
+    };
+    for (const auto& c : corners) {
+        lv_area_t area = {
+            (lv_coord_t)(content.x1 + c[0]), (lv_coord_t)(content.y1 + c[1]),
+            (lv_coord_t)(content.x1 + c[0] + c[2] - 1), (lv_coord_t)(content.y1 + c[1] + c[3] - 1)
+        };
+        lv_draw_rect(drawCtx, &dsc, &area);
+    }
+}
+
+void UIManager::createCyberpunkDecorations() {
+    const ThemeDefinition& theme = themeEngine.getCurrentTheme();
+    lv_color_t neonCyan = theme.colors.neonColors[CYBERPUNK_CYAN];
+    lv_color_t neonPink = theme.colors.neonColors[CYBERPUNK_PINK];
+
+    // Grid, diagonals and dots are painted by the screen itself
+    lv_obj_remove_event_cb(screen, onCyberpunkBackgroundDraw);
+    lv_obj_add_event_cb(screen, onCyberpunkBackgroundDraw, LV_EVENT_DRAW_MAIN_END, nullptr);
+    lv_obj_invalidate(screen);
+
     // === Bottom data ticker bar ===
     lv_obj_t* dataBar = lv_obj_create(screen);
     lv_obj_clear_flag(dataBar, LV_OBJ_FLAG_SCROLLABLE);
@@ -765,7 +1878,7 @@ void UIManager::createCyberpunkDecorations() {
     lv_obj_set_style_shadow_opa(glowLine, LV_OPA_50, 0);
 
     // Device IP address display
-    lv_obj_t* ipLabel = lv_label_create(dataBar);
+    ipLabel = lv_label_create(dataBar);
     String ipText = "IP::" + WiFi.localIP().toString();
     lv_label_set_text(ipLabel, ipText.c_str());
     lv_obj_set_style_text_font(ipLabel, &lv_font_montserrat_14, 0);
@@ -774,251 +1887,184 @@ void UIManager::createCyberpunkDecorations() {
 
     // Right side: blinking cursor effect (static) and hex data
     lv_obj_t* hexData = lv_label_create(dataBar);
-    lv_label_set_text(hexData, "0xC0DE::RDY");
+    lv_label_set_text_static(hexData, "0xC0DE::RDY");
     lv_obj_set_style_text_font(hexData, &lv_font_montserrat_14, 0);
     lv_obj_set_style_text_color(hexData, neonPink, 0);
     lv_obj_align(hexData, LV_ALIGN_RIGHT_MID, -15, 0);
 
-    // === Diagonal accent lines in corners ===
-    // Top-right corner diagonal
-    lv_obj_t* diagTR = lv_obj_create(screen);
-    lv_obj_clear_flag(diagTR, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-    lv_obj_set_size(diagTR, 40, 2);
-    lv_obj_set_pos(diagTR, SCREEN_WIDTH - 55, 75);
-    lv_obj_set_style_bg_color(diagTR, neonPink, 0);
-    lv_obj_set_style_bg_opa(diagTR, LV_OPA_60, 0);
-    lv_obj_set_style_border_width(diagTR, 0, 0);
-    lv_obj_set_style_transform_angle(diagTR, 450, 0);  // 45 degrees (in 0.1 deg units)
-
-    // Bottom-left corner diagonal
-    lv_obj_t* diagBL = lv_obj_create(screen);
-    lv_obj_clear_flag(diagBL, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-    lv_obj_set_size(diagBL, 40, 2);
-    lv_obj_set_pos(diagBL, 15, 340);
-    lv_obj_set_style_bg_color(diagBL, neonCyan, 0);
-    lv_obj_set_style_bg_opa(diagBL, LV_OPA_60, 0);
-    lv_obj_set_style_border_width(diagBL, 0, 0);
-    lv_obj_set_style_transform_angle(diagBL, -450, 0);  // -45 degrees
-
-    // === Small accent dots ===
-    // Add some small glowing dots at strategic positions
-    int dotPositions[][2] = {{SCREEN_WIDTH - 20, 80}, {20, 330}, {SCREEN_WIDTH - 25, 330}};
-    lv_color_t dotColors[] = {neonPink, neonCyan, neonGreen};
-
-    for (int i = 0; i < 3; i++) {
-        lv_obj_t* dot = lv_obj_create(screen);
-        lv_obj_clear_flag(dot, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_set_size(dot, 4, 4);
-        lv_obj_set_pos(dot, dotPositions[i][0], dotPositions[i][1]);
-        lv_obj_set_style_bg_color(dot, dotColors[i], 0);
-        lv_obj_set_style_bg_opa(dot, LV_OPA_COVER, 0);
-        lv_obj_set_style_border_width(dot, 0, 0);
-        lv_obj_set_style_radius(dot, LV_RADIUS_CIRCLE, 0);
-        lv_obj_set_style_shadow_width(dot, 8, 0);
-        lv_obj_set_style_shadow_color(dot, dotColors[i], 0);
-        lv_obj_set_style_shadow_opa(dot, LV_OPA_70, 0);
-    }
-
-    Serial.println("UIManager: Created Cyberpunk decorations");
+    LOG_I("UIManager: Created Cyberpunk decorations");
 }
 
 // ============================================================================
 // LCARS-SPECIFIC LAYOUT
 // ============================================================================
 
-void UIManager::createLCARSLayout() {
-    const DeviceConfig& config = configManager.getConfig();
+// The static frame (sidebar, elbow, bars, boxes) is painted by one object
+// instead of a dozen styled lv_obj rectangles, which each cost an object,
+// style resolution on every redraw and a hit test. {x, y, w, h} on the
+// screen; the status rows are relative to the plan's status section.
+struct LCARSFrameRect {
+    int16_t x, y, w, h;
+    uint8_t radius;
+    uint8_t color;      // LCARSColorRole
+    bool status;        // y is relative to plan.statusY
+};
+
+static const LCARSFrameRect LCARS_FRAME_RECTS[] = {
+    {0, 0, 50, 380, 0, LCARS_FRAME, false},        // Sidebar
+    {50, 430, 430, 50, 0, LCARS_FRAME, false},     // Bottom bar, from the elbow's horizontal on
+    {55, 8, 180, 35, 18, LCARS_FRAME, false},      // "LCARS" title box
+    {240, 23, 140, 4, 0, LCARS_FRAME, false},      // Line under LCARS
+    {330, 10, 95, 28, 14, LCARS_SCENE, false},     // "HOME CTRL" box
+    {425, 10, 50, 28, 14, LCARS_ACCENT, false},    // Blue accent
+    {70, 75, 400, 2, 0, LCARS_FRAME, false},       // Line under the section title
+    {70, 22, 45, 45, 8, LCARS_SCENE, true},        // Active count box
+    {130, 445, 85, 30, 12, LCARS_SCENE, false},    // Stardate box
+    {330, 445, 145, 30, 12, LCARS_SCENE, false},   // Deck/section box
+};
+
+static const lv_coord_t LCARS_ELBOW_Y = 380;    // Elbow image (100x100) bottom edge at 480
+
+void UIManager::onLCARSFrameDraw(lv_event_t* e) {
+    lv_draw_ctx_t* drawCtx = lv_event_get_draw_ctx(e);
+    lv_obj_t* frame = lv_event_get_target(e);
+    int statusY = (int)(intptr_t)lv_event_get_user_data(e);
+    lv_area_t coords;
+    lv_obj_get_coords(frame, &coords);
+    const lv_color_t* lcars = themeEngine.getCurrentTheme().colors.neonColors;
+
+    const lv_img_dsc_t* elbow = uiManager.lcarsElbow;
+    if (elbow) {
+        lv_draw_img_dsc_t imgDsc;
+        lv_draw_img_dsc_init(&imgDsc);
+        lv_area_t area = {
+            coords.x1, (lv_coord_t)(coords.y1 + LCARS_ELBOW_Y),
+            (lv_coord_t)(coords.x1 + elbow->header.w - 1), (lv_coord_t)(coords.y1 + LCARS_ELBOW_Y + elbow->header.h - 1)
+        };
+        if (_lv_area_is_on(&area, drawCtx->clip_area)) {
+            lv_draw_img(drawCtx, &imgDsc, &area, elbow);
+        }
+    }
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_opa = LV_OPA_COVER;
+    for (const LCARSFrameRect& r : LCARS_FRAME_RECTS) {
+        int y = r.status ? statusY + r.y : r.y;
+        lv_area_t area = {
+            (lv_coord_t)(coords.x1 + r.x), (lv_coord_t)(coords.y1 + y),
+            (lv_coord_t)(coords.x1 + r.x + r.w - 1), (lv_coord_t)(coords.y1 + y + r.h - 1)
+        };
+        if (!_lv_area_is_on(&area, drawCtx->clip_area)) continue;
+        dsc.bg_color = lcars[r.color];
+        dsc.radius = r.radius;
+        lv_draw_rect(drawCtx, &dsc, &area);
+    }
+}
+
+void UIManager::onLCARSFrameHitTest(lv_event_t* e) {
+    // Taps go through the frame to the screen, as they did between the old
+    // rectangles
+    lv_hit_test_info_t* info = (lv_hit_test_info_t*)lv_event_get_param(e);
+    info->res = false;
+}
+
+// A frame label in a w x h box at x, y: centered and clipped to the box,
+// as it was when the box was its parent. w = 0 for a plain label at x, y.
+static void placeLCARSLabel(lv_obj_t* label, const lv_font_t* font, lv_color_t color,
+                            int x, int y, int w, int h) {
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_obj_set_style_text_color(label, color, 0);
+    if (w > 0) {
+        lv_coord_t lineH = lv_font_get_line_height(font);
+        lv_label_set_long_mode(label, LV_LABEL_LONG_CLIP);
+        lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+        lv_obj_set_size(label, w, lineH);
+        y += (h - lineH) / 2;
+    }
+    lv_obj_set_pos(label, x, y);
+}
 
+void UIManager::createLCARSFrame() {
     // LCARS Colors
-    lv_color_t lcarsOrange = lv_color_hex(0xcc6600);
-    lv_color_t lcarsTan = lv_color_hex(0xffcc99);
-    lv_color_t lcarsBlue = lv_color_hex(0x6688cc);
-    lv_color_t lcarsPurpleActive = lv_color_hex(0x664477);
-    lv_color_t lcarsPurpleStandby = lv_color_hex(0x9977aa);
-    lv_color_t lcarsYellow = lv_color_hex(0xffcc66);
-
-    // === LEFT SIDEBAR with curved bottom (characteristic LCARS elbow) ===
-    // Sidebar - main vertical bar
-    lv_obj_t* sidebar = lv_obj_create(screen);
-    lv_obj_clear_flag(sidebar, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_size(sidebar, 50, 380);
-    lv_obj_set_pos(sidebar, 0, 0);
-    lv_obj_set_style_bg_color(sidebar, lcarsOrange, 0);
-    lv_obj_set_style_bg_opa(sidebar, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(sidebar, 0, 0);
-    lv_obj_set_style_border_width(sidebar, 0, 0);
-
-    // LCARS elbow curve image (100x100 pixels)
-    lv_obj_t* elbowImg = lv_img_create(screen);
-    lv_img_set_src(elbowImg, &lcars_elbow_img);
-    lv_obj_set_pos(elbowImg, 0, 380);  // Bottom edge at 480
-
-    // Bottom horizontal bar - connects to elbow, aligned with bottom of screen
-    lv_obj_t* bottomBar = lv_obj_create(screen);
-    lv_obj_clear_flag(bottomBar, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_size(bottomBar, 430, 50);  // Taller to match elbow height at bottom
-    lv_obj_set_pos(bottomBar, 50, 430);   // Starts where elbow's horizontal begins
-    lv_obj_set_style_bg_color(bottomBar, lcarsOrange, 0);
-    lv_obj_set_style_bg_opa(bottomBar, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(bottomBar, 0, 0);
-    lv_obj_set_style_border_width(bottomBar, 0, 0);
-
-    // Sidebar numbers
-    lv_obj_t* num01 = lv_label_create(sidebar);
-    lv_label_set_text(num01, "01");
-    lv_obj_set_style_text_color(num01, lv_color_black(), 0);
-    lv_obj_set_style_text_font(num01, &lv_font_montserrat_14, 0);
-    lv_obj_align(num01, LV_ALIGN_TOP_MID, 0, 15);
-
-    lv_obj_t* num07 = lv_label_create(sidebar);
-    lv_label_set_text(num07, "07");
-    lv_obj_set_style_text_color(num07, lv_color_black(), 0);
-    lv_obj_set_style_text_font(num07, &lv_font_montserrat_14, 0);
-    lv_obj_align(num07, LV_ALIGN_CENTER, 0, 0);
-
-    lv_obj_t* num42 = lv_label_create(sidebar);
-    lv_label_set_text(num42, "42");
-    lv_obj_set_style_text_color(num42, lv_color_black(), 0);
-    lv_obj_set_style_text_font(num42, &lv_font_montserrat_14, 0);
-    lv_obj_align(num42, LV_ALIGN_BOTTOM_MID, 0, -15);
+    lv_color_t lcarsOrange = themeEngine.getCurrentTheme().colors.neonColors[LCARS_FRAME];
+
+    // One full-screen object paints the frame (onLCARSFrameDraw, added with
+    // the status section's position in createLCARSStatus()); the labels are
+    // its children, drawn over it
+    lcarsFrame = lv_obj_create(screen);
+    lv_obj_remove_style_all(lcarsFrame);
+    lv_obj_clear_flag(lcarsFrame, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_flag(lcarsFrame, LV_OBJ_FLAG_ADV_HITTEST);
+    lv_obj_add_event_cb(lcarsFrame, onLCARSFrameHitTest, LV_EVENT_HIT_TEST, nullptr);
+    lv_obj_set_size(lcarsFrame, SCREEN_WIDTH, SCREEN_HEIGHT);
+    lv_obj_set_pos(lcarsFrame, 0, 0);
+
+    // LCARS elbow curve (unpacked once, see packed_image.h)
+    lcarsElbow = packedImages.acquire(lcarsFrame, lcars_elbow_img);
+
+    // Sidebar numbers, where the padded sidebar object used to put them
+    lv_coord_t numH = lv_font_get_line_height(&lv_font_montserrat_14);
+    lv_obj_t* num01 = createLCARSFieldLabel(lcarsFrame, LCARS_SIDEBAR_TOP);
+    placeLCARSLabel(num01, &lv_font_montserrat_14, lv_color_black(), 0, 31, 50, numH);
+
+    lv_obj_t* num07 = lv_label_create(lcarsFrame);
+    lv_label_set_text_static(num07, "07");
+    placeLCARSLabel(num07, &lv_font_montserrat_14, lv_color_black(), 0, 0, 50, 380);
+
+    lv_obj_t* num42 = createLCARSFieldLabel(lcarsFrame, LCARS_SIDEBAR_BOTTOM);
+    placeLCARSLabel(num42, &lv_font_montserrat_14, lv_color_black(), 0, 349 - numH, 50, numH);
 
     // === TOP HEADER BAR ===
-    // "LCARS" title box
-    lv_obj_t* lcarsBox = lv_obj_create(screen);
-    lv_obj_clear_flag(lcarsBox, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_size(lcarsBox, 180, 35);
-    lv_obj_set_pos(lcarsBox, 55, 8);
-    lv_obj_set_style_bg_color(lcarsBox, lcarsOrange, 0);
-    lv_obj_set_style_bg_opa(lcarsBox, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(lcarsBox, 18, 0);
-    lv_obj_set_style_border_width(lcarsBox, 0, 0);
-
-    lv_obj_t* lcarsTitle = lv_label_create(lcarsBox);
-    lv_label_set_text(lcarsTitle, "LCARS");
-    lv_obj_set_style_text_color(lcarsTitle, lv_color_black(), 0);
-    lv_obj_set_style_text_font(lcarsTitle, &lv_font_montserrat_20, 0);
-    lv_obj_center(lcarsTitle);
-
-    // Horizontal line under LCARS
-    lv_obj_t* hline1 = lv_obj_create(screen);
-    lv_obj_clear_flag(hline1, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_size(hline1, 140, 4);
-    lv_obj_set_pos(hline1, 240, 23);
-    lv_obj_set_style_bg_color(hline1, lcarsOrange, 0);
-    lv_obj_set_style_bg_opa(hline1, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(hline1, 0, 0);
-    lv_obj_set_style_border_width(hline1, 0, 0);
-
-    // "HOME CTRL" box
-    lv_obj_t* homeCtrlBox = lv_obj_create(screen);
-    lv_obj_clear_flag(homeCtrlBox, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_size(homeCtrlBox, 95, 28);
-    lv_obj_set_pos(homeCtrlBox, 330, 10);
-    lv_obj_set_style_bg_color(homeCtrlBox, lcarsTan, 0);
-    lv_obj_set_style_bg_opa(homeCtrlBox, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(homeCtrlBox, 14, 0);
-    lv_obj_set_style_border_width(homeCtrlBox, 0, 0);
-    lv_obj_set_style_pad_all(homeCtrlBox, 0, 0);
-
-    lv_obj_t* homeCtrlLabel = lv_label_create(homeCtrlBox);
-    lv_label_set_text(homeCtrlLabel, "HOME CTRL");
-    lv_obj_set_style_text_color(homeCtrlLabel, lv_color_black(), 0);
-    lv_obj_set_style_text_font(homeCtrlLabel, &lv_font_montserrat_14, 0);
-    lv_obj_center(homeCtrlLabel);
-
-    // Blue accent
-    lv_obj_t* blueAccent = lv_obj_create(screen);
-    lv_obj_clear_flag(blueAccent, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_size(blueAccent, 50, 28);
-    lv_obj_set_pos(blueAccent, 425, 10);
-    lv_obj_set_style_bg_color(blueAccent, lcarsBlue, 0);
-    lv_obj_set_style_bg_opa(blueAccent, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(blueAccent, 14, 0);
-    lv_obj_set_style_border_width(blueAccent, 0, 0);
+    lv_obj_t* lcarsTitle = createLCARSFieldLabel(lcarsFrame, LCARS_HEADER_LEFT);
+    placeLCARSLabel(lcarsTitle, &lv_font_montserrat_20, lv_color_black(), 55, 8, 180, 35);
+
+    lv_obj_t* homeCtrlLabel = createLCARSFieldLabel(lcarsFrame, LCARS_HEADER_RIGHT);
+    placeLCARSLabel(homeCtrlLabel, &lv_font_montserrat_14, lv_color_black(), 330, 10, 95, 28);
 
     // === "ILLUMINATION CONTROL" SECTION ===
-    lv_obj_t* sectionTitle = lv_label_create(screen);
-    lv_label_set_text(sectionTitle, "ILLUMINATION CONTROL");
-    lv_obj_set_style_text_color(sectionTitle, lcarsOrange, 0);
-    lv_obj_set_style_text_font(sectionTitle, &lv_font_montserrat_20, 0);
-    lv_obj_set_pos(sectionTitle, 70, 50);
-
-    // Horizontal line under section title
-    lv_obj_t* hline2 = lv_obj_create(screen);
-    lv_obj_clear_flag(hline2, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_size(hline2, 400, 2);
-    lv_obj_set_pos(hline2, 70, 75);
-    lv_obj_set_style_bg_color(hline2, lcarsOrange, 0);
-    lv_obj_set_style_bg_opa(hline2, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(hline2, 0, 0);
-    lv_obj_set_style_border_width(hline2, 0, 0);
-
-    // === BUTTON CARDS (2 or 3 columns based on count) ===
-    int cardStartX = 70;
-    int cardStartY = 90;
-    int cardGap = 8;
-    int cols = numButtons > 6 ? 3 : 2;  // 3 columns for 7+ buttons
-    int rows = (numButtons + cols - 1) / cols;  // Calculate actual rows needed
-
-    // Adjust card height based on available space (leave room for status section)
-    // Available height: from cardStartY (90) to bottom bar area (~300 for status)
-    int availableHeight = 210;  // Space for cards before status section
-    int cardHeight = (availableHeight - (rows - 1) * cardGap) / rows;
-    if (cardHeight > 95) cardHeight = 95;  // Max height
-    if (cardHeight < 50) cardHeight = 50;  // Min height
-    int cardWidth = numButtons > 6 ? 128 : 195;  // Narrower cards for 3 columns
-
-    for (int i = 0; i < numButtons && i < MAX_BUTTONS; i++) {
-        int col = i % cols;
-        int row = i / cols;
-        int x = cardStartX + col * (cardWidth + cardGap);
-        int y = cardStartY + row * (cardHeight + cardGap);
-        createLCARSCard(i, config.buttons[i], x, y, cardWidth, cardHeight);
-    }
+    lv_obj_t* sectionTitle = lv_label_create(lcarsFrame);
+    lv_label_set_text_static(sectionTitle, "ILLUMINATION CONTROL");
+    placeLCARSLabel(sectionTitle, &lv_font_montserrat_20, lcarsOrange, 70, 50, 0, 0);
+
+    // The button cards (2 or 3 columns based on count, see layout_plan.cpp)
+    // go between this and createLCARSStatus()
+}
+
+void UIManager::createLCARSStatus() {
+    const DeviceConfig& config = configManager.getConfig();
+    lv_color_t lcarsTan = themeEngine.getCurrentTheme().colors.neonColors[LCARS_SCENE];
 
     // === SYSTEM STATUS SECTION ===
-    int statusY = cardStartY + rows * (cardHeight + cardGap) + 5;
+    int statusY = plan.statusY;
+    lv_obj_add_event_cb(lcarsFrame, onLCARSFrameDraw, LV_EVENT_DRAW_MAIN, (void*)(intptr_t)statusY);
+    lv_obj_invalidate(lcarsFrame);
 
-    lv_obj_t* statusTitle = lv_label_create(screen);
-    lv_label_set_text(statusTitle, "SYSTEM STATUS");
-    lv_obj_set_style_text_color(statusTitle, lcarsTan, 0);
-    lv_obj_set_style_text_font(statusTitle, &lv_font_montserrat_14, 0);
-    lv_obj_set_pos(statusTitle, 70, statusY);
+    lv_obj_t* statusTitle = lv_label_create(lcarsFrame);
+    lv_label_set_text_static(statusTitle, "SYSTEM STATUS");
+    placeLCARSLabel(statusTitle, &lv_font_montserrat_14, lcarsTan, 70, statusY, 0, 0);
 
     // Count active systems
     int activeCount = 0;
-    for (int i = 0; i < numButtons; i++) {
+    for (int i = 0; i < numButtons && i < (int)config.buttons.size(); i++) {
         if (config.buttons[i].state) activeCount++;
     }
 
-    // Active count box
-    lv_obj_t* countBox = lv_obj_create(screen);
-    lv_obj_clear_flag(countBox, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_size(countBox, 45, 45);
-    lv_obj_set_pos(countBox, 70, statusY + 22);
-    lv_obj_set_style_bg_color(countBox, lcarsTan, 0);
-    lv_obj_set_style_bg_opa(countBox, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(countBox, 8, 0);
-    lv_obj_set_style_border_width(countBox, 0, 0);
-
-    lv_obj_t* countLabel = lv_label_create(countBox);
-    lv_label_set_text_fmt(countLabel, "%d", activeCount);
-    lv_obj_set_style_text_color(countLabel, lv_color_black(), 0);
-    lv_obj_set_style_text_font(countLabel, &lv_font_montserrat_24, 0);
-    lv_obj_center(countLabel);
-
-    lv_obj_t* activeLabel = lv_label_create(screen);
-    lv_label_set_text(activeLabel, "ACTIVE\nSYSTEMS");
-    lv_obj_set_style_text_color(activeLabel, lcarsTan, 0);
-    lv_obj_set_style_text_font(activeLabel, &lv_font_montserrat_14, 0);
-    lv_obj_set_pos(activeLabel, 120, statusY + 28);
+    // In the active count box
+    lcarsCountLabel = lv_label_create(lcarsFrame);
+    lv_label_set_text_fmt(lcarsCountLabel, "%d", activeCount);
+    placeLCARSLabel(lcarsCountLabel, &lv_font_montserrat_24, lv_color_black(), 70, statusY + 22, 45, 45);
+
+    lv_obj_t* activeLabel = lv_label_create(lcarsFrame);
+    lv_label_set_text_static(activeLabel, "ACTIVE\nSYSTEMS");
+    placeLCARSLabel(activeLabel, &lv_font_montserrat_14, lcarsTan, 120, statusY + 28, 0, 0);
 
     // === SCENE BUTTONS ===
     if (numScenes > 0) {
         int sceneY = statusY + 20;
         int sceneX = 230;
 
-        for (int i = 0; i < numScenes && i < MAX_SCENES; i++) {
+        for (int i = 0; i < numScenes && i < MAX_SCENES && i < (int)config.scenes.size(); i++) {
             UISceneButton& scene = sceneButtons[i];
             scene.sceneId = config.scenes[i].id;
 
@@ -1031,9 +2077,7 @@ void UIManager::createLCARSLayout() {
             lv_obj_set_style_shadow_width(scene.button, 0, 0);
 
             scene.label = lv_label_create(scene.button);
-            String upperName = config.scenes[i].name;
-            upperName.toUpperCase();
-            lv_label_set_text(scene.label, upperName.c_str());
+            lv_label_set_text(scene.label, sceneLabelText(config.scenes[i]).c_str());
             lv_obj_set_style_text_color(scene.label, lv_color_black(), 0);
             lv_obj_set_style_text_font(scene.label, &lv_font_montserrat_14, 0);
             lv_obj_center(scene.label);
@@ -1042,43 +2086,40 @@ void UIManager::createLCARSLayout() {
         }
     }
 
-    // === BOTTOM FOOTER (integrated with the curved bar) ===
-    // Stardate box (sits on the bottom bar)
-    lv_obj_t* stardateBox = lv_obj_create(screen);
-    lv_obj_clear_flag(stardateBox, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_size(stardateBox, 85, 30);
-    lv_obj_set_pos(stardateBox, 130, 445);
-    lv_obj_set_style_bg_color(stardateBox, lcarsTan, 0);
-    lv_obj_set_style_bg_opa(stardateBox, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(stardateBox, 12, 0);
-    lv_obj_set_style_border_width(stardateBox, 0, 0);
+    // === BOTTOM FOOTER (boxes on the bottom bar) ===
+    lv_obj_t* stardateLabel = createLCARSFieldLabel(lcarsFrame, LCARS_FOOTER_LEFT);
+    placeLCARSLabel(stardateLabel, &lv_font_montserrat_14, lv_color_black(), 130, 445, 85, 30);
+
+    lv_obj_t* deckLabel = createLCARSFieldLabel(lcarsFrame, LCARS_FOOTER_RIGHT);
+    placeLCARSLabel(deckLabel, &lv_font_montserrat_14, lv_color_black(), 330, 445, 145, 30);
 
-    lv_obj_t* stardateLabel = lv_label_create(stardateBox);
-    lv_label_set_text(stardateLabel, "47634.8");
-    lv_obj_set_style_text_color(stardateLabel, lv_color_black(), 0);
-    lv_obj_set_style_text_font(stardateLabel, &lv_font_montserrat_14, 0);
-    lv_obj_center(stardateLabel);
+    LOG_I("UIManager: LCARS layout created");
+}
 
-    // Deck/Section box
-    lv_obj_t* deckBox = lv_obj_create(screen);
-    lv_obj_clear_flag(deckBox, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_size(deckBox, 145, 30);
-    lv_obj_set_pos(deckBox, 330, 445);
-    lv_obj_set_style_bg_color(deckBox, lcarsTan, 0);
-    lv_obj_set_style_bg_opa(deckBox, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(deckBox, 12, 0);
-    lv_obj_set_style_border_width(deckBox, 0, 0);
+lv_obj_t* UIManager::createLCARSFieldLabel(lv_obj_t* parent, LCARSField field) {
+    lcarsFieldLabels[field] = lv_label_create(parent);
+    lv_label_set_text_static(lcarsFieldLabels[field], LCARS_FIELD_DEFAULTS[field]);
+    applyLCARSField(field);
+    return lcarsFieldLabels[field];
+}
 
-    lv_obj_t* deckLabel = lv_label_create(deckBox);
-    lv_label_set_text(deckLabel, "DECK 7 SECTION 4");
-    lv_obj_set_style_text_color(deckLabel, lv_color_black(), 0);
-    lv_obj_set_style_text_font(deckLabel, &lv_font_montserrat_14, 0);
-    lv_obj_center(deckLabel);
+void UIManager::applyLCARSField(uint8_t field) {
+    if (field >= LCARS_FIELD_COUNT || !lcarsFieldLabels[field]) {
+        return;     // Not an LCARS screen; the text is used when one is built
+    }
 
-    // Create fan overlay for LCARS theme
-    createFanOverlay();
+    char text[LCARS_FIELD_LEN];
+    portENTER_CRITICAL(&lcarsFieldMux);
+    memcpy(text, lcarsFieldText[field], sizeof(text));
+    portEXIT_CRITICAL(&lcarsFieldMux);
 
-    Serial.println("UIManager: LCARS layout created");
+    // A label only invalidates its own area, before and after; the box it
+    // sits in is fixed size and clips longer text
+    if (text[0]) {
+        setLabelTextIfChanged(lcarsFieldLabels[field], text);
+    } else {
+        setLabelStaticIfChanged(lcarsFieldLabels[field], LCARS_FIELD_DEFAULTS[field]);
+    }
 }
 
 // ============================================================================
@@ -1089,13 +2130,17 @@ void UIManager::createFanOverlay() {
     // Initialize overlay state
     fanOverlay.visible = false;
     fanOverlay.cardIndex = -1;
+    fanOverlay.backdrop = nullptr;
+    fanOverlay.backdropBuf = nullptr;
+    fanOverlay.backdropSize = 0;
 
     // LCARS theme colors
     bool isLCARS = themeEngine.isLCARS();
-    lv_color_t lcarsOrange = lv_color_hex(0xcc6600);
-    lv_color_t lcarsTan = lv_color_hex(0xffcc99);
-    lv_color_t lcarsBlue = lv_color_hex(0x6688cc);
-    lv_color_t lcarsPurple = lv_color_hex(0x9977aa);
+    const lv_color_t* lcars = themeEngine.getCurrentTheme().colors.neonColors;
+    lv_color_t lcarsOrange = lcars[LCARS_FRAME];
+    lv_color_t lcarsTan = lcars[LCARS_SCENE];
+    lv_color_t lcarsBlue = lcars[LCARS_ACCENT];
+    lv_color_t lcarsPurple = lcars[LCARS_STANDBY];
 
     // Create semi-transparent background overlay
     fanOverlay.overlay = lv_obj_create(screen);
@@ -1104,6 +2149,7 @@ void UIManager::createFanOverlay() {
     lv_obj_set_style_bg_color(fanOverlay.overlay, lv_color_black(), 0);
     lv_obj_set_style_bg_opa(fanOverlay.overlay, LV_OPA_80, 0);
     lv_obj_set_style_border_width(fanOverlay.overlay, 0, 0);
+    lv_obj_set_style_pad_all(fanOverlay.overlay, 0, 0);  // Backdrop image sits at (0, 0)
     lv_obj_clear_flag(fanOverlay.overlay, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_add_flag(fanOverlay.overlay, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_add_event_cb(fanOverlay.overlay, onFanOverlayClose, LV_EVENT_CLICKED, nullptr);
@@ -1147,7 +2193,7 @@ void UIManager::createFanOverlay() {
         lv_obj_set_style_border_width(headerBar, 0, 0);
 
         lv_obj_t* headerLabel = lv_label_create(headerBar);
-        lv_label_set_text(headerLabel, "ENVIRONMENTAL CTRL");
+        lv_label_set_text_static(headerLabel, "ENVIRONMENTAL CTRL");
         lv_obj_set_style_text_color(headerLabel, lv_color_black(), 0);
         lv_obj_set_style_text_font(headerLabel, &lv_font_montserrat_14, 0);
         lv_obj_center(headerLabel);
@@ -1155,7 +2201,7 @@ void UIManager::createFanOverlay() {
 
     // Title label (fan name)
     fanOverlay.titleLabel = lv_label_create(fanOverlay.panel);
-    lv_label_set_text(fanOverlay.titleLabel, "Fan");
+    lv_label_set_text_static(fanOverlay.titleLabel, "Fan");
     lv_obj_set_style_text_font(fanOverlay.titleLabel, &lv_font_montserrat_20, 0);
     if (isLCARS) {
         lv_obj_set_style_text_color(fanOverlay.titleLabel, lcarsOrange, 0);
@@ -1167,7 +2213,7 @@ void UIManager::createFanOverlay() {
 
     // Status label
     fanOverlay.statusLabel = lv_label_create(fanOverlay.panel);
-    lv_label_set_text(fanOverlay.statusLabel, "Off");
+    lv_label_set_text_static(fanOverlay.statusLabel, "Off");
     lv_obj_set_style_text_font(fanOverlay.statusLabel, &lv_font_montserrat_14, 0);
     if (isLCARS) {
         lv_obj_set_style_text_color(fanOverlay.statusLabel, lcarsTan, 0);
@@ -1238,14 +2284,11 @@ void UIManager::createFanOverlay() {
 
     // Fan icon below slider - use custom PNG image
     fanOverlay.fanIcon = lv_img_create(fanOverlay.panel);
-    lv_img_set_src(fanOverlay.fanIcon, &fan_icon);
     if (isLCARS) {
-        lv_obj_set_style_img_recolor(fanOverlay.fanIcon, lcarsPurple, 0);
-        lv_obj_set_style_img_recolor_opa(fanOverlay.fanIcon, LV_OPA_COVER, 0);
+        setIconImage(fanOverlay.fanIcon, &fan_icon, lcarsPurple);
         lv_obj_align(fanOverlay.fanIcon, LV_ALIGN_BOTTOM_MID, 0, -15);
     } else {
-        lv_obj_set_style_img_recolor(fanOverlay.fanIcon, lv_color_hex(0x32d74b), 0);
-        lv_obj_set_style_img_recolor_opa(fanOverlay.fanIcon, LV_OPA_COVER, 0);
+        setIconImage(fanOverlay.fanIcon, &fan_icon, lv_color_hex(0x32d74b));
         lv_obj_align(fanOverlay.fanIcon, LV_ALIGN_BOTTOM_MID, 0, -15);
     }
 
@@ -1263,7 +2306,7 @@ void UIManager::createFanOverlay() {
         lv_obj_set_style_radius(fanOverlay.closeBtn, 15, 0);
 
         lv_obj_t* closeLabel = lv_label_create(fanOverlay.closeBtn);
-        lv_label_set_text(closeLabel, "CLOSE");
+        lv_label_set_text_static(closeLabel, "CLOSE");
         lv_obj_set_style_text_color(closeLabel, lv_color_black(), 0);
         lv_obj_set_style_text_font(closeLabel, &lv_font_montserrat_14, 0);
         lv_obj_center(closeLabel);
@@ -1276,7 +2319,7 @@ void UIManager::createFanOverlay() {
         lv_obj_set_style_radius(fanOverlay.closeBtn, LV_RADIUS_CIRCLE, 0);
 
         lv_obj_t* closeIcon = lv_label_create(fanOverlay.closeBtn);
-        lv_label_set_text(closeIcon, LV_SYMBOL_CLOSE);
+        lv_label_set_text_static(closeIcon, LV_SYMBOL_CLOSE);
         lv_obj_set_style_text_color(closeIcon, lv_color_white(), 0);
         lv_obj_center(closeIcon);
     }
@@ -1286,133 +2329,331 @@ void UIManager::createFanOverlay() {
 }
 
 void UIManager::showFanOverlay(int cardIndex) {
-    if (cardIndex < 0 || cardIndex >= numButtons) return;
+    if (cardIndex < 0 || cardIndex >= numCards) return;
 
     UIButtonCard& card = buttonCards[cardIndex];
-    const DeviceConfig& config = configManager.getConfig();
 
-    // Create overlay if it doesn't exist
+    // Built on first use, then kept (hidden) until the next rebuild
     if (fanOverlay.overlay == nullptr) {
         createFanOverlay();
+        LOG_I("UIManager: Fan overlay created on first use");
     }
 
     fanOverlay.cardIndex = cardIndex;
     fanOverlay.visible = true;
 
-    // Update title
-    lv_label_set_text(fanOverlay.titleLabel, config.buttons[cardIndex].name.c_str());
+    {
+        ConfigSnapshot snapshot;
+        for (const ButtonConfig& b : snapshot->buttons) {
+            if (b.id == card.buttonId) {
+                setLabelTextIfChanged(fanOverlay.titleLabel, b.name.c_str());
+                break;
+            }
+        }
+    }
 
-    // Set slider range based on speed steps
+    // A fresh model: everything is applied once, later changes only as they come
     uint8_t steps = card.speedSteps > 0 ? card.speedSteps : 3;
-    lv_slider_set_range(fanOverlay.slider, 0, steps);
-    lv_slider_set_value(fanOverlay.slider, card.speedLevel, LV_ANIM_OFF);
-
-    // Update visuals
-    updateFanOverlayVisuals();
+    fanOverlay.steps = steps;
+    fanOverlay.level = card.speedLevel;
+    fanOverlay.dirty = FAN_DIRTY_ALL;
+    applyFanOverlay();
+    fanStream.start(card.buttonId, card.speedLevel);
+
+    // Composite over a static, pre-dimmed snapshot so dragging the slider
+    // doesn't re-blend the overlay over the live grid every frame
+    lv_obj_add_flag(fanOverlay.overlay, LV_OBJ_FLAG_HIDDEN);
+    bool composited = captureFanBackdrop();
+    lv_obj_set_style_bg_opa(fanOverlay.overlay, composited ? LV_OPA_TRANSP : LV_OPA_80, 0);
 
     // Show overlay
     lv_obj_clear_flag(fanOverlay.overlay, LV_OBJ_FLAG_HIDDEN);
     lv_obj_move_foreground(fanOverlay.overlay);
 
-    Serial.printf("UIManager: Showing fan overlay for card %d (steps=%d, level=%d)\n",
+    LOG_D("UIManager: Showing fan overlay for card %d (steps=%d, level=%d)",
                   cardIndex, steps, card.speedLevel);
 }
 
 void UIManager::hideFanOverlay() {
+    fanStream.flush();
     if (fanOverlay.overlay) {
         lv_obj_add_flag(fanOverlay.overlay, LV_OBJ_FLAG_HIDDEN);
     }
+    releaseFanBackdrop();
+
+    // The frames are only kept while the overlay is open
+    if (fanOverlay.spinning) {
+        stopFanSpin(lv_obj_get_style_img_recolor(fanOverlay.fanIcon, LV_PART_MAIN));
+    }
+    releaseFanSpin();
     fanOverlay.visible = false;
     fanOverlay.cardIndex = -1;
-    Serial.println("UIManager: Fan overlay hidden");
+    LOG_I("UIManager: Fan overlay hidden");
 }
 
-void UIManager::updateFanOverlayVisuals() {
-    if (!fanOverlay.visible || fanOverlay.cardIndex < 0) return;
+bool UIManager::captureFanBackdrop() {
+    releaseFanBackdrop();
 
-    UIButtonCard& card = buttonCards[fanOverlay.cardIndex];
-    int level = lv_slider_get_value(fanOverlay.slider);
-    bool isLCARS = themeEngine.isLCARS();
+    uint32_t size = lv_snapshot_buf_size_needed(screen, LV_IMG_CF_TRUE_COLOR);
+    fanOverlay.backdropBuf = (uint8_t*)psramBudget.alloc(PSRAM_UI_SNAPSHOT, size);
+    if (!fanOverlay.backdropBuf) {
+        LOG_W("UIManager: No memory for fan overlay backdrop, blending live");
+        return false;
+    }
+    fanOverlay.backdropSize = size;
 
-    // Update status text
-    const char* statusText;
-    if (level == 0) {
-        statusText = isLCARS ? "STANDBY" : "Off";
-    } else {
-        uint8_t steps = card.speedSteps > 0 ? card.speedSteps : 3;
-        if (steps == 3) {
-            if (isLCARS) {
-                const char* speedNames[] = {"STANDBY", "LOW", "MEDIUM", "HIGH"};
-                statusText = speedNames[level];
-            } else {
-                const char* speedNames[] = {"Off", "Low", "Medium", "High"};
-                statusText = speedNames[level];
-            }
-        } else if (steps == 4) {
-            if (isLCARS) {
-                const char* speedNames[] = {"STANDBY", "LOW", "MEDIUM", "HIGH", "TURBO"};
-                statusText = speedNames[level];
-            } else {
-                const char* speedNames[] = {"Off", "Low", "Medium", "High", "Turbo"};
-                statusText = speedNames[level];
-            }
+    if (lv_snapshot_take_to_buf(screen, LV_IMG_CF_TRUE_COLOR, &fanOverlay.backdropDsc,
+                                fanOverlay.backdropBuf, size) != LV_RES_OK) {
+        releaseFanBackdrop();
+        return false;
+    }
+
+    // Bake the 80% black dimming into the pixels once
+    lv_color_t* px = (lv_color_t*)fanOverlay.backdropBuf;
+    uint32_t count = fanOverlay.backdropDsc.header.w * fanOverlay.backdropDsc.header.h;
+    for (uint32_t i = 0; i < count; i++) {
+        px[i] = lv_color_mix(lv_color_black(), px[i], LV_OPA_80);
+    }
+
+    // Opaque full-screen image: LVGL stops drawing at it, so the grid below is skipped
+    fanOverlay.backdrop = lv_img_create(fanOverlay.overlay);
+    lv_img_set_src(fanOverlay.backdrop, &fanOverlay.backdropDsc);
+    lv_obj_set_pos(fanOverlay.backdrop, 0, 0);
+    lv_obj_clear_flag(fanOverlay.backdrop, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_move_to_index(fanOverlay.backdrop, 0);
+    return true;
+}
+
+void UIManager::releaseFanBackdrop() {
+    if (fanOverlay.backdrop) {
+        lv_obj_del(fanOverlay.backdrop);
+        fanOverlay.backdrop = nullptr;
+    }
+    if (fanOverlay.backdropBuf) {
+        psramBudget.release(PSRAM_UI_SNAPSHOT, fanOverlay.backdropBuf, fanOverlay.backdropSize);
+        fanOverlay.backdropBuf = nullptr;
+        fanOverlay.backdropSize = 0;
+    }
+}
+
+void UIManager::setFanOverlayLevel(uint8_t level, bool fromSlider) {
+    if (level == fanOverlay.level) return;
+
+    // The finger already put the slider there; the icon's rate follows every level
+    uint8_t dirty = FAN_DIRTY_STATUS | FAN_DIRTY_ICON;
+    if (!fromSlider) dirty |= FAN_DIRTY_SLIDER;
+    if ((level > 0) != (fanOverlay.level > 0)) dirty |= FAN_DIRTY_LIT;
+
+    fanOverlay.level = level;
+    fanOverlay.dirty |= dirty;
+}
+
+void UIManager::applyFanOverlay() {
+    uint8_t dirty = fanOverlay.dirty;
+    if (!fanOverlay.visible || dirty == 0) return;
+    fanOverlay.dirty = 0;
+
+    uint8_t level = fanOverlay.level;
+    uint8_t steps = fanOverlay.steps;
+    bool isLCARS = themeEngine.isLCARS();
+    const lv_color_t* lcars = themeEngine.getCurrentTheme().colors.neonColors;
+    lv_color_t litColor = isLCARS ? lcars[LCARS_STANDBY] : lv_color_hex(0x32d74b);
+
+    if (dirty & FAN_DIRTY_STATUS) {
+        static const char* const lcarsNames[] = {"STANDBY", "LOW", "MEDIUM", "HIGH", "TURBO"};
+        static const char* const names[] = {"Off", "Low", "Medium", "High", "Turbo"};
+        if (level == 0 || ((steps == 3 || steps == 4) && level <= steps)) {
+            setLabelStaticIfChanged(fanOverlay.statusLabel, (isLCARS ? lcarsNames : names)[level]);
         } else {
-            static char buf[16];
+            char buf[16];
             snprintf(buf, sizeof(buf), isLCARS ? "SPEED %d" : "Speed %d", level);
-            statusText = buf;
+            setLabelTextIfChanged(fanOverlay.statusLabel, buf);
         }
     }
-    lv_label_set_text(fanOverlay.statusLabel, statusText);
 
-    // LCARS colors
-    lv_color_t lcarsPurple = lv_color_hex(0x9977aa);
-    lv_color_t lcarsTan = lv_color_hex(0xffcc99);
+    // Both are no-ops in LVGL when nothing changes
+    if (dirty & FAN_DIRTY_SLIDER) {
+        lv_slider_set_range(fanOverlay.slider, 0, steps);
+        lv_slider_set_value(fanOverlay.slider, level, LV_ANIM_OFF);
+    }
 
-    // Update icon color
-    lv_color_t iconColor;
-    if (isLCARS) {
-        iconColor = level > 0 ? lcarsPurple : lv_color_hex(0x555555);
-    } else {
-        iconColor = level > 0 ? lv_color_hex(0x32d74b) : lv_color_hex(0x98989d);
+    if (dirty & FAN_DIRTY_LIT) {
+        lv_color_t offColor = isLCARS ? lv_color_hex(0x1a1a1a) : lv_color_hex(0x48484a);
+        lv_obj_set_style_bg_color(fanOverlay.slider, level > 0 ? litColor : offColor, LV_PART_INDICATOR);
     }
-    lv_obj_set_style_img_recolor(fanOverlay.fanIcon, iconColor, 0);
 
-    // Update slider indicator color
-    lv_color_t sliderColor;
-    if (isLCARS) {
-        sliderColor = level > 0 ? lcarsPurple : lv_color_hex(0x1a1a1a);
-    } else {
-        sliderColor = level > 0 ? lv_color_hex(0x32d74b) : lv_color_hex(0x48484a);
+    if (dirty & FAN_DIRTY_ICON) {
+        if (level > 0) {
+            updateFanSpin(litColor);
+        } else {
+            stopFanSpin(isLCARS ? lv_color_hex(0x555555) : lv_color_hex(0x98989d));
+        }
     }
-    lv_obj_set_style_bg_color(fanOverlay.slider, sliderColor, LV_PART_INDICATOR);
 }
 
-void UIManager::setFanSpeed(uint8_t buttonId, uint8_t speedLevel) {
-    for (int i = 0; i < numButtons; i++) {
-        if (buttonCards[i].buttonId == buttonId) {
-            buttonCards[i].speedLevel = speedLevel;
-            buttonCards[i].currentState = (speedLevel > 0);
+bool UIManager::buildFanSpinFrames(lv_color_t color) {
+    const uint16_t w = fan_icon.header.w;
+    const uint16_t h = fan_icon.header.h;
+    const uint32_t frameSize = (uint32_t)w * h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+
+    if (fanOverlay.spinBuf == nullptr) {
+        uint32_t size = frameSize * FAN_SPIN_FRAMES;
+        fanOverlay.spinBuf = (uint8_t*)psramBudget.alloc(PSRAM_UI_SNAPSHOT, size);
+        if (!fanOverlay.spinBuf) {
+            LOG_W("UIManager: No memory for fan spin frames, icon stays still");
+            return false;
+        }
+        fanOverlay.spinSize = size;
+    }
 
-            // Update card visual
-            updateCardVisual(buttonCards[i]);
+    // Each frame samples the icon's coverage rotated back by its angle
+    // (bilinear, about the icon's centre) and is tinted like iconTintCache's
+    // copies: color low byte, high byte, alpha
+    const uint8_t* alpha = fan_icon.data;
+    auto coverage = [&](int x, int y) -> float {
+        return (x < 0 || y < 0 || x >= w || y >= h) ? 0.0f : alpha[y * w + x];
+    };
+    const float cx = (w - 1) / 2.0f;
+    const float cy = (h - 1) / 2.0f;
+    const uint8_t lo = color.full & 0xff;
+    const uint8_t hi = color.full >> 8;
+
+    for (uint8_t f = 0; f < FAN_SPIN_FRAMES; f++) {
+        float angle = (float)f * FAN_SPIN_SPAN_DEG / FAN_SPIN_FRAMES * (float)M_PI / 180.0f;
+        float cosA = cosf(angle);
+        float sinA = sinf(angle);
+        uint8_t* out = fanOverlay.spinBuf + f * frameSize;
+
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                float dx = x - cx;
+                float dy = y - cy;
+                float sx = cx + dx * cosA + dy * sinA;
+                float sy = cy - dx * sinA + dy * cosA;
+                int x0 = (int)floorf(sx);
+                int y0 = (int)floorf(sy);
+                float fx = sx - x0;
+                float fy = sy - y0;
+                float top = coverage(x0, y0) + (coverage(x0 + 1, y0) - coverage(x0, y0)) * fx;
+                float bottom = coverage(x0, y0 + 1) + (coverage(x0 + 1, y0 + 1) - coverage(x0, y0 + 1)) * fx;
+                out[0] = lo;
+                out[1] = hi;
+                out[2] = (uint8_t)(top + (bottom - top) * fy + 0.5f);
+                out += LV_IMG_PX_SIZE_ALPHA_BYTE;
+            }
+        }
+
+        lv_img_dsc_t& dsc = fanOverlay.spinFrames[f];
+        dsc.header.always_zero = 0;
+        dsc.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+        dsc.header.w = w;
+        dsc.header.h = h;
+        dsc.data_size = frameSize;
+        dsc.data = fanOverlay.spinBuf + f * frameSize;
+        lv_img_cache_invalidate_src(&dsc);
+    }
 
-            // Update config
-            configManager.setButtonState(buttonId, speedLevel > 0);
-            // TODO: Save speed level to config
+    fanOverlay.spinColor = color.full;
+    return true;
+}
 
-            Serial.printf("UIManager: Fan %d speed set to %d\n", buttonId, speedLevel);
+void UIManager::updateFanSpin(lv_color_t litColor) {
+    if (fanOverlay.spinBuf == nullptr || fanOverlay.spinColor != litColor.full) {
+        if (!buildFanSpinFrames(litColor)) {
+            stopFanSpin(litColor);
             return;
         }
+        if (fanOverlay.spinning) {
+            lv_obj_invalidate(fanOverlay.fanIcon);
+        }
+    }
+
+    if (!fanOverlay.spinning) {
+        // The frames are tinted already; drop the icon's tinted copy
+        iconTintCache.release(lv_img_get_src(fanOverlay.fanIcon));
+        lv_obj_set_style_img_recolor_opa(fanOverlay.fanIcon, LV_OPA_TRANSP, 0);
+        lv_img_set_src(fanOverlay.fanIcon, &fanOverlay.spinFrames[fanOverlay.spinFrame]);
+        fanOverlay.spinning = true;
     }
+
+    // Faster with the level, never above one frame per FAN_SPIN_STEP_MS
+    uint8_t level = fanOverlay.level < fanOverlay.steps ? fanOverlay.level : fanOverlay.steps;
+    uint32_t period = FAN_SPIN_STEP_MS * fanOverlay.steps / (level > 0 ? level : 1);
+    if (fanSpinTimer == nullptr) {
+        fanSpinTimer = lv_timer_create(onFanSpinTimer, period, nullptr);
+    } else {
+        lv_timer_set_period(fanSpinTimer, period);
+    }
+    lv_timer_resume(fanSpinTimer);
 }
 
-uint8_t UIManager::getFanSpeed(uint8_t buttonId) const {
-    for (int i = 0; i < numButtons; i++) {
-        if (buttonCards[i].buttonId == buttonId) {
-            return buttonCards[i].speedLevel;
+void UIManager::stopFanSpin(lv_color_t color) {
+    if (fanSpinTimer) {
+        lv_timer_pause(fanSpinTimer);
+    }
+    fanOverlay.spinning = false;
+    if (fanOverlay.fanIcon) {
+        setIconImage(fanOverlay.fanIcon, &fan_icon, color);
+    }
+}
+
+void UIManager::releaseFanSpin() {
+    if (fanOverlay.spinBuf) {
+        psramBudget.release(PSRAM_UI_SNAPSHOT, fanOverlay.spinBuf, fanOverlay.spinSize);
+        fanOverlay.spinBuf = nullptr;
+        fanOverlay.spinSize = 0;
+    }
+}
+
+void UIManager::onFanSpinTimer(lv_timer_t* timer) {
+    FanOverlayState& fan = uiManager.fanOverlay;
+    if (!fan.visible || !fan.spinning) {
+        lv_timer_pause(timer);
+        return;
+    }
+
+    // Same size, so only the icon's area is redrawn
+    fan.spinFrame = (fan.spinFrame + 1) % FAN_SPIN_FRAMES;
+    lv_img_set_src(fan.fanIcon, &fan.spinFrames[fan.spinFrame]);
+}
+
+void UIManager::setFanSpeed(uint8_t buttonId, uint8_t speedLevel) {
+    UIButtonCard* card = findCard(buttonId);
+    if (card) {
+        if (card->speedLevel == speedLevel && card->currentState == (speedLevel > 0)) {
+            suppressedUpdates++;
+            return;
+        }
+
+        // Mid-drag the finger wins; its level goes out on release anyway
+        bool inOverlay = fanOverlay.visible && card == &buttonCards[fanOverlay.cardIndex];
+        if (inOverlay && lv_slider_is_dragged(fanOverlay.slider)) {
+            suppressedUpdates++;
+            return;
+        }
+
+        card->speedLevel = speedLevel;
+        card->currentState = (speedLevel > 0);
+
+        // Update card visual
+        updateCardVisual(*card);
+
+        // An open overlay takes the push too, touching only what changed
+        if (inOverlay) {
+            setFanOverlayLevel(speedLevel, false);
+            applyFanOverlay();
         }
+
+        LOG_D("UIManager: Fan %d speed set to %d", buttonId, speedLevel);
     }
-    return 0;
+
+    // Fans on other pages only change in the config; their card is built from it
+    configManager.setButtonSpeed(buttonId, speedLevel);
+}
+
+uint8_t UIManager::getFanSpeed(uint8_t buttonId) const {
+    const ButtonConfig* btn = configManager.findButton(buttonId);
+    return btn ? btn->speedLevel : 0;
 }
 
 // Static callbacks
@@ -1421,54 +2662,67 @@ void UIManager::onFanSliderChanged(lv_event_t* e) {
     int level = lv_slider_get_value(uiManager.fanOverlay.slider);
     int cardIndex = uiManager.fanOverlay.cardIndex;
 
-    if (cardIndex >= 0 && cardIndex < uiManager.numButtons) {
+    if (cardIndex >= 0 && cardIndex < uiManager.numCards) {
         UIButtonCard& card = uiManager.buttonCards[cardIndex];
 
-        // Always update overlay visuals for smooth feedback
-        uiManager.updateFanOverlayVisuals();
-
-        // Only do heavy operations on release to avoid sluggishness
-        if (code == LV_EVENT_VALUE_CHANGED) {
-            // Light update - just store the value
-            card.speedLevel = level;
-            card.currentState = (level > 0);
-        }
+        // Only the parts the new level changes; nothing while it stays put
+        uiManager.setFanOverlayLevel(level, true);
+        uiManager.applyFanOverlay();
+        card.speedLevel = level;
+        card.currentState = (level > 0);
 
         if (code == LV_EVENT_RELEASED || lv_slider_is_dragged(uiManager.fanOverlay.slider) == false) {
-            // Heavy operations only on release
-            card.speedLevel = level;
-            card.currentState = (level > 0);
-
-            // Update the card in the main UI
+            // The card under the overlay is only restyled on release
             uiManager.updateCardVisual(card);
+            configManager.setButtonSpeed(card.buttonId, level);
 
-            // Update config state
-            configManager.setButtonState(card.buttonId, level > 0);
-
-            // Notify callback (async HTTP, won't block UI)
-            if (uiManager.buttonCallback) {
-                uiManager.buttonCallback(card.buttonId, level > 0);
-            }
-
-            Serial.printf("UIManager: Fan speed set to %d\n", level);
+            // Trailing edge: the final level always goes out
+            uiManager.fanStream.finish(level);
+            LOG_I("UIManager: Fan speed set to %d", level);
+        } else {
+            // Mid-drag: throttled, coalesced in the action queue
+            uiManager.fanStream.update(level);
         }
     }
 }
 
+void UIManager::sendFanSpeed(uint8_t buttonId, int speedLevel) {
+    // Notify callback (async HTTP, won't block UI)
+    if (uiManager.fanSpeedCallback) {
+        uiManager.fanSpeedCallback(buttonId, speedLevel);
+    } else if (uiManager.buttonCallback) {
+        uiManager.buttonCallback(buttonId, speedLevel > 0);
+    }
+}
+
 void UIManager::onFanOverlayClose(lv_event_t* e) {
     uiManager.hideFanOverlay();
 }
 
-void UIManager::createLCARSCard(int index, const ButtonConfig& btnConfig, int x, int y, int w, int h) {
-    lv_color_t lcarsPurpleActive = lv_color_hex(0x664477);
-    lv_color_t lcarsPurpleStandby = lv_color_hex(0x9977aa);
-    lv_color_t lcarsYellow = lv_color_hex(0xffcc66);
+void UIManager::createLCARSCard(int index, const ButtonConfig& btnConfig) {
+    const lv_color_t* lcars = themeEngine.getCurrentTheme().colors.neonColors;
+    lv_color_t lcarsPurpleActive = lcars[LCARS_ACTIVE];
+    lv_color_t lcarsPurpleStandby = lcars[LCARS_STANDBY];
+    lv_color_t lcarsYellow = lcars[LCARS_STANDBY_TEXT];
+
+    const CardRect& rect = plan.cards[index];
+    int x = rect.x;
+    int y = rect.y;
+    int w = rect.w;
+    int h = rect.h;
+    bool tall = (plan.shape == CARD_SHAPE_REGULAR);
+
+    uint8_t kind = cardKind(btnConfig, plan);
+    if (acquirePooledCard(index, btnConfig, kind, x, y, w, h)) {
+        return;
+    }
 
     UIButtonCard& card = buttonCards[index];
     card.buttonId = btnConfig.id;
     card.currentState = btnConfig.state;
     card.speedSteps = btnConfig.speedSteps;
     card.speedLevel = btnConfig.speedLevel;
+    card.poolKind = kind;
 
     // Create card
     card.card = lv_obj_create(screen);
@@ -1489,27 +2743,23 @@ void UIManager::createLCARSCard(int index, const ButtonConfig& btnConfig, int x,
     // Icon - vertically centered on left side, use image for fans
     // Smaller icon for shorter cards
     int iconOffset = 0;  // Use card padding instead
-    const lv_font_t* iconFont = (h >= 80) ? &lv_font_montserrat_28 : &lv_font_montserrat_20;
+    const lv_font_t* iconFont = plan.iconFont;
 
     if (btnConfig.type == ButtonType::FAN) {
         card.icon = lv_img_create(card.card);
-        lv_img_set_src(card.icon, &fan_icon);
-        lv_obj_set_style_img_recolor(card.icon, card.currentState ? lv_color_white() : lcarsYellow, 0);
-        lv_obj_set_style_img_recolor_opa(card.icon, LV_OPA_COVER, 0);
+        setIconImage(card.icon, &fan_icon, card.currentState ? lv_color_white() : lcarsYellow);
         lv_obj_align(card.icon, LV_ALIGN_LEFT_MID, iconOffset, 0);
         card.iconIsImage = true;
-    } else if (isImageIcon(btnConfig.icon)) {
+    } else if (isImageIcon(btnConfig.iconId)) {
         // Use custom image icon
         card.icon = lv_img_create(card.card);
-        lv_img_set_src(card.icon, getIconImage(btnConfig.icon));
-        lv_obj_set_style_img_recolor(card.icon, card.currentState ? lv_color_white() : lcarsYellow, 0);
-        lv_obj_set_style_img_recolor_opa(card.icon, LV_OPA_COVER, 0);
+        setIconImage(card.icon, getIconImage(btnConfig.iconId), card.currentState ? lv_color_white() : lcarsYellow);
         lv_obj_align(card.icon, LV_ALIGN_LEFT_MID, iconOffset, 0);
         card.iconIsImage = true;
     } else {
         card.icon = lv_label_create(card.card);
-        const char* iconSymbol = getIconSymbol(btnConfig.icon);
-        lv_label_set_text(card.icon, iconSymbol);
+        const char* iconSymbol = getIconSymbol(btnConfig.iconId);
+        lv_label_set_text_static(card.icon, iconSymbol);
         lv_obj_set_style_text_font(card.icon, iconFont, 0);
         lv_obj_set_style_text_color(card.icon, card.currentState ? lv_color_white() : lcarsYellow, 0);
         lv_obj_align(card.icon, LV_ALIGN_LEFT_MID, iconOffset, 0);
@@ -1518,41 +2768,9 @@ void UIManager::createLCARSCard(int index, const ButtonConfig& btnConfig, int x,
 
     // Room name - on right side
     card.nameLabel = lv_label_create(card.card);
-    String upperName = sanitizeForDisplay(btnConfig.name);
-    upperName.toUpperCase();
-    lv_label_set_text(card.nameLabel, upperName.c_str());
     lv_obj_set_style_text_color(card.nameLabel, card.currentState ? lv_color_white() : lcarsYellow, 0);
-
-    // Dynamic font sizing based on name length for LCARS
-    size_t nameLen = upperName.length();
-    int textStartX;
-    int textWidth;
-
-    if (h >= 80) {
-        // Tall cards
-        textStartX = 32;
-        textWidth = w - 38;  // More room for text
-        if (nameLen > 18) {
-            lv_obj_set_style_text_font(card.nameLabel, &lv_font_montserrat_12, 0);
-        } else if (nameLen > 14) {
-            lv_obj_set_style_text_font(card.nameLabel, &lv_font_montserrat_14, 0);
-        } else {
-            lv_obj_set_style_text_font(card.nameLabel, &lv_font_montserrat_16, 0);
-        }
-    } else {
-        // Short cards: use smaller fonts
-        textStartX = 28;
-        textWidth = w - 34;
-        if (nameLen > 16) {
-            lv_obj_set_style_text_font(card.nameLabel, &lv_font_montserrat_12, 0);
-        } else {
-            lv_obj_set_style_text_font(card.nameLabel, &lv_font_montserrat_14, 0);
-        }
-    }
-
-    lv_obj_set_width(card.nameLabel, textWidth);
-    lv_obj_set_style_max_height(card.nameLabel, 20, 0);  // Single line height
-    lv_label_set_long_mode(card.nameLabel, LV_LABEL_LONG_DOT);
+    applyCardName(card, btnConfig.name.c_str(), w);
+    int textStartX = tall ? 32 : 28;
 
     // Status text - below name on right side
     card.stateLabel = lv_label_create(card.card);
@@ -1563,14 +2781,14 @@ void UIManager::createLCARSCard(int index, const ButtonConfig& btnConfig, int x,
         else if (card.speedLevel == 1) speedText = "LOW";
         else if (card.speedLevel == 2) speedText = "MEDIUM";
         else speedText = "HIGH";
-        lv_label_set_text(card.stateLabel, speedText);
+        lv_label_set_text_static(card.stateLabel, speedText);
     } else {
-        lv_label_set_text(card.stateLabel, card.currentState ? "ACTIVE" : "STANDBY");
+        lv_label_set_text_static(card.stateLabel, card.currentState ? "ACTIVE" : "STANDBY");
     }
     lv_obj_set_style_text_color(card.stateLabel, card.currentState ? lv_color_white() : lcarsYellow, 0);
 
     // Adjust layout based on card height
-    if (h >= 80) {
+    if (tall) {
         // Tall cards: stacked vertically
         lv_obj_set_style_text_font(card.stateLabel, &lv_font_montserrat_14, 0);
         lv_obj_align(card.nameLabel, LV_ALIGN_LEFT_MID, textStartX, -12);
@@ -1586,32 +2804,227 @@ void UIManager::createLCARSCard(int index, const ButtonConfig& btnConfig, int x,
     card.toggle = nullptr;
 }
 
-void UIManager::updateButtonState(uint8_t buttonId, bool state) {
-    for (int i = 0; i < numButtons; i++) {
-        if (buttonCards[i].buttonId == buttonId) {
-            buttonCards[i].currentState = state;
-            updateCardVisual(buttonCards[i]);
+// ============================================================================
+// SENSOR CARDS
+// ============================================================================
 
-            // Update config
-            configManager.setButtonState(buttonId, state);
-            return;
+static_assert(sizeof(lv_coord_t) == sizeof(int16_t), "SensorHistory::decimate() writes chart values directly");
+
+void UIManager::createSensorCard(int index, const ButtonConfig& btnConfig) {
+    const CardRect& rect = plan.cards[index];
+    uint8_t kind = cardKind(btnConfig, plan);
+    if (acquirePooledCard(index, btnConfig, kind, rect.x, rect.y, rect.w, rect.h)) {
+        return;
+    }
+
+    UIButtonCard& card = buttonCards[index];
+    card.buttonId = btnConfig.id;
+    card.currentState = btnConfig.state;
+    card.speedSteps = 0;
+    card.speedLevel = 0;
+    card.isSceneButton = false;
+    card.poolKind = kind;
+    card.toggle = nullptr;
+
+    card.card = lv_obj_create(screen);
+    lv_obj_clear_flag(card.card, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);  // Nothing to press
+    lv_obj_set_size(card.card, rect.w, rect.h);
+    lv_obj_set_pos(card.card, rect.x, rect.y);
+    lv_obj_set_style_pad_all(card.card, 0, 0);  // layoutSensorCard() places from the edges
+
+    if (isImageIcon(btnConfig.iconId)) {
+        card.icon = lv_img_create(card.card);
+        setIconImage(card.icon, getIconImage(btnConfig.iconId), themeEngine.getIconColor(true, index));
+        card.iconIsImage = true;
+    } else {
+        card.icon = lv_label_create(card.card);
+        lv_label_set_text_static(card.icon, getIconSymbol(btnConfig.iconId));
+        lv_obj_set_style_text_font(card.icon, plan.iconFont, 0);
+        card.iconIsImage = false;
+    }
+
+    // Value and unit
+    card.stateLabel = lv_label_create(card.card);
+    lv_label_set_text_static(card.stateLabel, "");
+
+    // History: a line, no dots, no grid; values arrive scaled to CHART_RANGE
+    card.chart = lv_chart_create(card.card);
+    lv_obj_clear_flag(card.chart, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_chart_set_type(card.chart, LV_CHART_TYPE_LINE);
+    lv_chart_set_range(card.chart, LV_CHART_AXIS_PRIMARY_Y, 0, SensorHistory::CHART_RANGE);
+    lv_chart_set_div_line_count(card.chart, 0, 0);
+    lv_obj_set_style_bg_opa(card.chart, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(card.chart, 0, 0);
+    lv_obj_set_style_pad_hor(card.chart, 0, 0);     // One point per pixel of its width
+    lv_obj_set_style_pad_ver(card.chart, 2, 0);     // Room for the line's width at the extremes
+    lv_obj_set_style_line_width(card.chart, 2, LV_PART_ITEMS);
+    lv_obj_set_style_size(card.chart, 0, LV_PART_INDICATOR);
+    lv_chart_add_series(card.chart, themeEngine.getIconColor(true, index), LV_CHART_AXIS_PRIMARY_Y);
+
+    card.nameLabel = lv_label_create(card.card);
+    applyCardName(card, btnConfig.name.c_str(), rect.w);
+
+    layoutSensorCard(card);
+    styleSensorCard(card);
+    refreshSensorCard(card);
+}
+
+void UIManager::layoutSensorCard(UIButtonCard& card) {
+    int w = lv_obj_get_style_width(card.card, LV_PART_MAIN);
+    int h = lv_obj_get_style_height(card.card, LV_PART_MAIN);
+
+    if (h >= 76) {
+        // Name and value stacked at the top, icon in the corner, chart below
+        int pad = h >= 100 ? 12 : 8;
+        lv_obj_clear_flag(card.icon, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_align(card.icon, LV_ALIGN_TOP_RIGHT, -pad, pad);
+        lv_obj_set_width(card.nameLabel, w - 2 * pad - 32);
+        lv_obj_align(card.nameLabel, LV_ALIGN_TOP_LEFT, pad, pad);
+        lv_obj_set_style_text_font(card.stateLabel, &lv_font_montserrat_20, 0);
+        lv_obj_align(card.stateLabel, LV_ALIGN_TOP_LEFT, pad, pad + 17);
+        int top = pad + 17 + 24;
+        lv_obj_set_size(card.chart, w - 2 * pad, h - top - pad);
+        lv_obj_align(card.chart, LV_ALIGN_BOTTOM_MID, 0, -pad);
+    } else {
+        // Rows and short cards: icon (if it fits), name over value, chart on the right
+        bool icon = w >= 180;
+        int textX = icon ? 48 : 10;
+        int column = (w - textX) / 2;
+        if (icon) {
+            lv_obj_clear_flag(card.icon, LV_OBJ_FLAG_HIDDEN);
+            lv_obj_align(card.icon, LV_ALIGN_LEFT_MID, 10, 0);
+        } else {
+            lv_obj_add_flag(card.icon, LV_OBJ_FLAG_HIDDEN);
         }
+        int nudge = h >= 48 ? 10 : 8;
+        lv_obj_set_width(card.nameLabel, column - 6);
+        lv_obj_align(card.nameLabel, LV_ALIGN_LEFT_MID, textX, -nudge);
+        lv_obj_set_style_text_font(card.stateLabel, &lv_font_montserrat_16, 0);
+        lv_obj_align(card.stateLabel, LV_ALIGN_LEFT_MID, textX, nudge);
+        lv_obj_set_size(card.chart, w - textX - column - 10, h - 12);
+        lv_obj_align(card.chart, LV_ALIGN_RIGHT_MID, -10, 0);
+    }
+}
+
+void UIManager::styleSensorCard(UIButtonCard& card) {
+    int index = &card - buttonCards;
+    lv_color_t ink;
+    if (themeEngine.isLCARS()) {
+        // Coloured like a card that is off
+        const lv_color_t* lcars = themeEngine.getCurrentTheme().colors.neonColors;
+        ink = lcars[LCARS_STANDBY_TEXT];
+        lv_obj_set_style_bg_color(card.card, lcars[LCARS_STANDBY], 0);
+        lv_obj_set_style_bg_opa(card.card, LV_OPA_COVER, 0);
+        lv_obj_set_style_radius(card.card, 20, 0);
+        lv_obj_set_style_border_width(card.card, 0, 0);
+        lv_obj_set_style_text_color(card.nameLabel, ink, 0);
+    } else {
+        ink = themeEngine.getIconColor(true, index);
+        themeEngine.styleCard(card.card, false, index);
+        themeEngine.styleLabel(card.nameLabel, true);
+    }
+
+    if (card.iconIsImage) {
+        setIconColor(card.icon, ink);
+    } else {
+        lv_obj_set_style_text_color(card.icon, ink, 0);
+    }
+    lv_obj_set_style_text_color(card.stateLabel, ink, 0);
+    lv_chart_get_series_next(card.chart, nullptr)->color = ink;
+    lv_chart_refresh(card.chart);
+}
+
+void UIManager::refreshSensorCard(UIButtonCard& card) {
+    const ButtonConfig* btn = configManager.findButton(card.buttonId);
+    const char* unit = btn ? btn->subtitle.c_str() : "";
+    float value;
+    char text[32];
+    if (sensorHistory.latest(card.buttonId, value)) {
+        snprintf(text, sizeof(text), "%.*f%s", fabsf(value) < 100 ? 1 : 0, value, unit);
+    } else {
+        snprintf(text, sizeof(text), "--%s", unit);
+    }
+    setLabelTextIfChanged(card.stateLabel, text);
+
+    // A point per pixel column at most, however long the history; the
+    // newest sample at the right edge
+    uint16_t points = lv_obj_get_style_width(card.chart, LV_PART_MAIN) & ~1;
+    if (points > SENSOR_CHART_MAX_POINTS) points = SENSOR_CHART_MAX_POINTS;
+    if (points < 2) points = 2;
+    if (lv_chart_get_point_count(card.chart) != points) {
+        lv_chart_set_point_count(card.chart, points);
+    }
+    lv_chart_series_t* series = lv_chart_get_series_next(card.chart, nullptr);
+    lv_coord_t* y = lv_chart_get_y_array(card.chart, series);
+    uint16_t count = sensorHistory.decimate(card.buttonId, y, points);
+    memmove(y + (points - count), y, count * sizeof(lv_coord_t));
+    for (uint16_t i = 0; i < points - count; i++) {
+        y[i] = LV_CHART_POINT_NONE;
+    }
+
+    // Invalidates only the chart's area
+    lv_chart_refresh(card.chart);
+}
+
+void UIManager::rebuildCardIndex() {
+    memset(cardIndexById, 0xFF, sizeof(cardIndexById));
+    for (int i = numCards - 1; i >= 0; i--) {
+        cardIndexById[buttonCards[i].buttonId] = i;
+    }
+}
+
+UIButtonCard* UIManager::findCard(uint8_t buttonId) {
+    uint8_t index = cardIndexById[buttonId];
+    return index < numCards ? &buttonCards[index] : nullptr;
+}
+
+const UIButtonCard* UIManager::findCard(uint8_t buttonId) const {
+    uint8_t index = cardIndexById[buttonId];
+    return index < numCards ? &buttonCards[index] : nullptr;
+}
+
+void UIManager::updateButtonState(uint8_t buttonId, bool state) {
+    UIButtonCard* card = findCard(buttonId);
+    if (card == nullptr) {
+        // On another page: its card is built from the config when the page is shown
+        configManager.setButtonState(buttonId, state);
+        return;
+    }
+
+    // Restyling an unchanged card still invalidates it; skip the redraw
+    if (card->currentState == state) {
+        suppressedUpdates++;
+        configManager.setButtonState(buttonId, state);
+        return;
     }
+
+    card->currentState = state;
+    updateCardVisual(*card);
+
+    // Update config
+    configManager.setButtonState(buttonId, state);
 }
 
 void UIManager::updateCardVisual(UIButtonCard& card) {
     int index = &card - buttonCards;  // Get index from pointer
 
+    if (card.chart) {
+        // No on/off look; only a theme change restyles a sensor card
+        styleSensorCard(card);
+        return;
+    }
+
     if (themeEngine.isLCARS()) {
         // LCARS-specific visual update
-        lv_color_t lcarsPurpleActive = lv_color_hex(0x664477);
-        lv_color_t lcarsPurpleStandby = lv_color_hex(0x9977aa);
-        lv_color_t lcarsYellow = lv_color_hex(0xffcc66);
+        const lv_color_t* lcars = themeEngine.getCurrentTheme().colors.neonColors;
+        lv_color_t lcarsPurpleActive = lcars[LCARS_ACTIVE];
+        lv_color_t lcarsPurpleStandby = lcars[LCARS_STANDBY];
+        lv_color_t lcarsYellow = lcars[LCARS_STANDBY_TEXT];
 
         lv_obj_set_style_bg_color(card.card, card.currentState ? lcarsPurpleActive : lcarsPurpleStandby, 0);
         // Update icon color - use img_recolor for images, text_color for labels
         if (card.iconIsImage) {
-            lv_obj_set_style_img_recolor(card.icon, card.currentState ? lv_color_white() : lcarsYellow, 0);
+            setIconColor(card.icon, card.currentState ? lv_color_white() : lcarsYellow);
         } else {
             lv_obj_set_style_text_color(card.icon, card.currentState ? lv_color_white() : lcarsYellow, 0);
         }
@@ -1625,9 +3038,9 @@ void UIManager::updateCardVisual(UIButtonCard& card) {
                 else if (card.speedLevel == 1) speedText = "LOW";
                 else if (card.speedLevel == 2) speedText = "MEDIUM";
                 else speedText = "HIGH";
-                lv_label_set_text(card.stateLabel, speedText);
+                lv_label_set_text_static(card.stateLabel, speedText);
             } else {
-                lv_label_set_text(card.stateLabel, card.currentState ? "ACTIVE" : "STANDBY");
+                lv_label_set_text_static(card.stateLabel, card.currentState ? "ACTIVE" : "STANDBY");
             }
             lv_obj_set_style_text_color(card.stateLabel, card.currentState ? lv_color_white() : lcarsYellow, 0);
         }
@@ -1636,7 +3049,7 @@ void UIManager::updateCardVisual(UIButtonCard& card) {
         themeEngine.styleCard(card.card, card.currentState, index);
         // Update icon color - use img_recolor for images, text_color for labels
         if (card.iconIsImage) {
-            lv_obj_set_style_img_recolor(card.icon, themeEngine.getIconColor(card.currentState, index), 0);
+            setIconColor(card.icon, themeEngine.getIconColor(card.currentState, index));
         } else {
             lv_obj_set_style_text_color(card.icon, themeEngine.getIconColor(card.currentState, index), 0);
         }
@@ -1653,17 +3066,27 @@ void UIManager::updateCardVisual(UIButtonCard& card) {
         // Update status text if present
         if (card.stateLabel) {
             if (themeEngine.isCyberpunk()) {
-                lv_label_set_text(card.stateLabel, card.currentState ? "[ONLINE]" : "[OFFLINE]");
+                lv_label_set_text_static(card.stateLabel, card.currentState ? "[ONLINE]" : "[OFFLINE]");
             } else {
-                lv_label_set_text(card.stateLabel, themeEngine.getStateText(card.currentState));
+                lv_label_set_text_static(card.stateLabel, themeEngine.getStateText(card.currentState));
             }
             lv_obj_set_style_text_color(card.stateLabel, themeEngine.getIconColor(card.currentState, index), 0);
         }
     }
+
+    // A tiled card flips straight to its other tile if there is one; else it
+    // draws live (a toggle knob may be sliding) and is tiled once it settles
+    const CardTile* tile = cardShowsTile(index) ? cardTileCache.get(index, card.currentState) : nullptr;
+    if (tile) {
+        placeCardTile(index, *tile);
+    } else {
+        showCardLive(index);
+        scheduleCardTile(index);
+    }
 }
 
 void UIManager::refreshAllButtons() {
-    for (int i = 0; i < numButtons; i++) {
+    for (int i = 0; i < numCards; i++) {
         updateCardVisual(buttonCards[i]);
     }
 }
@@ -1676,13 +3099,17 @@ void UIManager::setSceneCallback(UISceneCallback callback) {
     sceneCallback = callback;
 }
 
+void UIManager::setFanSpeedCallback(UIFanSpeedCallback callback) {
+    fanSpeedCallback = callback;
+}
+
 // Static event handlers
 void UIManager::onToggleChanged(lv_event_t* e) {
     int index = (int)(intptr_t)lv_event_get_user_data(e);
     lv_obj_t* toggle = lv_event_get_target(e);
     bool newState = lv_obj_has_state(toggle, LV_STATE_CHECKED);
 
-    if (index >= 0 && index < uiManager.numButtons) {
+    if (index >= 0 && index < uiManager.numCards) {
         UIButtonCard& card = uiManager.buttonCards[index];
         card.currentState = newState;
         uiManager.updateCardVisual(card);
@@ -1695,56 +3122,31 @@ void UIManager::onToggleChanged(lv_event_t* e) {
             uiManager.buttonCallback(card.buttonId, newState);
         }
 
-        Serial.printf("UIManager: Button %d toggled to %s\n", card.buttonId, newState ? "ON" : "OFF");
+        LOG_I("UIManager: Button %d toggled to %s", card.buttonId, newState ? "ON" : "OFF");
     }
 }
 
 void UIManager::onCardClicked(lv_event_t* e) {
     int index = (int)(intptr_t)lv_event_get_user_data(e);
 
-    if (index >= 0 && index < uiManager.numButtons) {
+    if (index >= 0 && index < uiManager.numCards) {
+        latencyTrace.begin();
         UIButtonCard& card = uiManager.buttonCards[index];
 
         // For scene buttons, call the scene callback with visual feedback
         if (card.isSceneButton) {
-            Serial.printf("UIManager: Scene button %d clicked, scene: %s\n", card.buttonId, card.sceneId.c_str());
-
-            // Visual feedback: flash the card with a brief highlight animation
-            lv_obj_t* cardObj = card.card;
-
-            // Store original background color and create flash effect
-            lv_color_t originalBg = lv_obj_get_style_bg_color(cardObj, 0);
-            lv_opa_t originalOpa = lv_obj_get_style_bg_opa(cardObj, 0);
+            LOG_I("UIManager: Scene button %d clicked, scene: %s", card.buttonId, card.sceneId.c_str());
 
-            // Flash with bright accent color (purple for scenes)
+            // Visual feedback: flash the card with a brief highlight
             lv_color_t flashColor = lv_color_hex(0xa855f7);  // Purple
+            const lv_color_t* neon = themeEngine.getCurrentTheme().colors.neonColors;
             if (themeEngine.isCyberpunk()) {
-                flashColor = lv_color_hex(0xff0080);  // Neon pink for cyberpunk
+                flashColor = neon[CYBERPUNK_PINK];
             } else if (themeEngine.isLCARS()) {
-                flashColor = lv_color_hex(0xCC7832);  // LCARS orange
+                flashColor = neon[LCARS_FRAME];
             }
-
-            // Apply flash effect
-            lv_obj_set_style_bg_color(cardObj, flashColor, 0);
-            lv_obj_set_style_bg_opa(cardObj, LV_OPA_80, 0);
-
-            // Create animation to restore original color
-            lv_anim_t anim;
-            lv_anim_init(&anim);
-            lv_anim_set_var(&anim, cardObj);
-            lv_anim_set_time(&anim, 200);  // 200ms flash duration
-            lv_anim_set_delay(&anim, 100); // Small delay to show flash
-            lv_anim_set_exec_cb(&anim, [](void* obj, int32_t val) {
-                lv_obj_set_style_bg_opa((lv_obj_t*)obj, val, 0);
-            });
-            lv_anim_set_values(&anim, LV_OPA_80, originalOpa);
-            lv_anim_set_path_cb(&anim, lv_anim_path_ease_out);
-            lv_anim_set_ready_cb(&anim, [](lv_anim_t* a) {
-                // Restore original background (in case theme changed)
-                lv_obj_t* obj = (lv_obj_t*)a->var;
-                themeEngine.styleCard(obj, false);  // Re-apply theme styling
-            });
-            lv_anim_start(&anim);
+            uiManager.flashCard(index, flashColor);
+            latencyTrace.mark(LAT_STYLE_UPDATE);
 
             // Use the button callback to trigger the scene
             if (uiManager.buttonCallback) {
@@ -1756,12 +3158,14 @@ void UIManager::onCardClicked(lv_event_t* e) {
         // For fans with speed control, show the overlay instead of toggling
         if (card.speedSteps > 0) {
             uiManager.showFanOverlay(index);
+            latencyTrace.mark(LAT_STYLE_UPDATE);
             return;
         }
 
         // Toggle state for non-fan devices
         card.currentState = !card.currentState;
         uiManager.updateCardVisual(card);
+        latencyTrace.mark(LAT_STYLE_UPDATE);
 
         // Update config
         configManager.setButtonState(card.buttonId, card.currentState);
@@ -1771,7 +3175,7 @@ void UIManager::onCardClicked(lv_event_t* e) {
             uiManager.buttonCallback(card.buttonId, card.currentState);
         }
 
-        Serial.printf("UIManager: Card %d clicked, now %s\n", card.buttonId, card.currentState ? "ON" : "OFF");
+        LOG_D("UIManager: Card %d clicked, now %s", card.buttonId, card.currentState ? "ON" : "OFF");
     }
 }
 
@@ -1786,99 +3190,115 @@ void UIManager::onSceneClicked(lv_event_t* e) {
             uiManager.sceneCallback(scene.sceneId);
         }
 
-        Serial.printf("UIManager: Scene %d activated\n", scene.sceneId);
-    }
-}
-
-const char* UIManager::getIconSymbol(const String& iconName) {
-    // Map icon names to LVGL symbols
-    if (iconName == "bolt" || iconName == "charge") {
-        return LV_SYMBOL_CHARGE;  // Lightning bolt
-    } else if (iconName == "light" || iconName == "bulb") {
-        return "\xEF\x83\xAB";  // Font Awesome lightbulb (U+F0EB) - falls back to charge if not in font
-    } else if (iconName == "moon") {
-        return LV_SYMBOL_EYE_CLOSE;  // Use eye-close as moon substitute
-    } else if (iconName == "sun") {
-        return LV_SYMBOL_IMAGE;  // Use image symbol as sun substitute (bright/display)
-    } else if (iconName == "fan" || iconName == "ventilation") {
-        return LV_SYMBOL_REFRESH;  // Use refresh as fan symbol (circular motion)
-    } else if (iconName == "power" || iconName == "off") {
-        return LV_SYMBOL_POWER;
-    } else if (iconName == "ok" || iconName == "check" || iconName == "on") {
-        return LV_SYMBOL_OK;
-    } else if (iconName == "home") {
-        return LV_SYMBOL_HOME;
-    } else if (iconName == "settings" || iconName == "gear") {
-        return LV_SYMBOL_SETTINGS;
-    } else if (iconName == "wifi") {
-        return LV_SYMBOL_WIFI;
-    } else if (iconName == "bell" || iconName == "notification") {
-        return LV_SYMBOL_BELL;
-    } else if (iconName == "eye") {
-        return LV_SYMBOL_EYE_OPEN;
-    } else if (iconName == "eye_close" || iconName == "sleep") {
-        return LV_SYMBOL_EYE_CLOSE;
-    } else if (iconName == "play") {
-        return LV_SYMBOL_PLAY;
-    } else if (iconName == "pause") {
-        return LV_SYMBOL_PAUSE;
-    } else if (iconName == "stop") {
-        return LV_SYMBOL_STOP;
-    } else if (iconName == "volume" || iconName == "audio") {
-        return LV_SYMBOL_VOLUME_MAX;
-    } else if (iconName == "mute") {
-        return LV_SYMBOL_MUTE;
-    } else if (iconName == "minus") {
-        return LV_SYMBOL_MINUS;
-    } else if (iconName == "plus") {
-        return LV_SYMBOL_PLUS;
-    } else if (iconName == "close" || iconName == "x") {
-        return LV_SYMBOL_CLOSE;
-    } else if (iconName == "refresh" || iconName == "sync") {
-        return LV_SYMBOL_REFRESH;
-    } else if (iconName == "edit" || iconName == "pen") {
-        return LV_SYMBOL_EDIT;
-    } else if (iconName == "trash" || iconName == "delete") {
-        return LV_SYMBOL_TRASH;
-    } else if (iconName == "tint" || iconName == "water" || iconName == "drop") {
-        return LV_SYMBOL_TINT;
-    } else if (iconName == "timer" || iconName == "clock" || iconName == "schedule") {
-        return LV_SYMBOL_LOOP;  // Loop/repeat symbol for timed actions
-    }
-
-    // Default
-    return LV_SYMBOL_CHARGE;
-}
-
-// Check if an icon name requires an image (custom icon) instead of a text symbol
-bool UIManager::isImageIcon(const String& iconName) {
-    return (iconName == "garage" ||
-            iconName == "sleep" ||
-            iconName == "ceiling_light" || iconName == "ceiling-light" ||
-            iconName == "bulb" ||
-            iconName == "door" ||
-            iconName == "moon" ||
-            iconName == "sun");
+        LOG_I("UIManager: Scene %d activated", scene.sceneId);
+    }
+}
+
+// LVGL symbol and, for icons drawn as images, their image; indexed by IconId
+struct IconDescriptor {
+    const char* symbol;
+    const lv_img_dsc_t* image;
+};
+
+// Font Awesome lightbulb (U+F0EB): only the subset fonts have it, LVGL's
+// own Montserrat would draw nothing
+#if PANEL_FONTS_SUBSET
+#define SYMBOL_BULB "\xEF\x83\xAB"
+#else
+#define SYMBOL_BULB LV_SYMBOL_CHARGE
+#endif
+
+static const IconDescriptor ICON_DESCRIPTORS[] = {
+    {LV_SYMBOL_CHARGE, nullptr},             // CHARGE: lightning bolt
+    {SYMBOL_BULB, nullptr},                  // LIGHT: lightbulb
+    {SYMBOL_BULB, &bulb_icon},               // BULB
+    {LV_SYMBOL_CHARGE, &ceiling_light_icon}, // CEILING_LIGHT
+    {LV_SYMBOL_EYE_CLOSE, &moon_icon},       // MOON: eye-close as the symbol substitute
+    {LV_SYMBOL_IMAGE, &sun_icon},            // SUN: image symbol (bright/display) as the substitute
+    {LV_SYMBOL_REFRESH, nullptr},            // FAN: circular motion
+    {LV_SYMBOL_POWER, nullptr},              // POWER
+    {LV_SYMBOL_OK, nullptr},                 // OK
+    {LV_SYMBOL_HOME, nullptr},               // HOME
+    {LV_SYMBOL_SETTINGS, nullptr},           // SETTINGS
+    {LV_SYMBOL_WIFI, nullptr},               // WIFI
+    {LV_SYMBOL_BELL, nullptr},               // BELL
+    {LV_SYMBOL_EYE_OPEN, nullptr},           // EYE
+    {LV_SYMBOL_EYE_CLOSE, nullptr},          // EYE_CLOSE
+    {LV_SYMBOL_EYE_CLOSE, &sleep_icon},      // SLEEP
+    {LV_SYMBOL_PLAY, nullptr},               // PLAY
+    {LV_SYMBOL_PAUSE, nullptr},              // PAUSE
+    {LV_SYMBOL_STOP, nullptr},               // STOP
+    {LV_SYMBOL_VOLUME_MAX, nullptr},         // VOLUME
+    {LV_SYMBOL_MUTE, nullptr},               // MUTE
+    {LV_SYMBOL_MINUS, nullptr},              // MINUS
+    {LV_SYMBOL_PLUS, nullptr},               // PLUS
+    {LV_SYMBOL_CLOSE, nullptr},              // CLOSE
+    {LV_SYMBOL_REFRESH, nullptr},            // REFRESH
+    {LV_SYMBOL_EDIT, nullptr},               // EDIT
+    {LV_SYMBOL_TRASH, nullptr},              // TRASH
+    {LV_SYMBOL_TINT, nullptr},               // TINT
+    {LV_SYMBOL_LOOP, nullptr},               // TIMER: loop/repeat for timed actions
+    {LV_SYMBOL_CHARGE, &garage_icon},        // GARAGE
+    {LV_SYMBOL_CHARGE, &door_icon},          // DOOR
+};
+
+static_assert(sizeof(ICON_DESCRIPTORS) / sizeof(ICON_DESCRIPTORS[0]) == (size_t)IconId::COUNT,
+              "ICON_DESCRIPTORS needs one entry per IconId");
+
+static const IconDescriptor& iconDescriptor(IconId icon) {
+    return ICON_DESCRIPTORS[icon < IconId::COUNT ? (size_t)icon : 0];
+}
+
+// Uploaded icons (icon_pack.h) are images only; the bolt stands in as
+// their symbol
+const char* UIManager::getIconSymbol(IconId icon) {
+    return iconDescriptor(icon).symbol;
+}
+
+// Check if an icon needs an image (custom icon) instead of a text symbol
+bool UIManager::isImageIcon(IconId icon) {
+    return getIconImage(icon) != nullptr;
 }
 
 // Get the image descriptor for an image-based icon
-const lv_img_dsc_t* UIManager::getIconImage(const String& iconName) {
-    if (iconName == "garage") {
-        return &garage_icon;
-    } else if (iconName == "sleep") {
-        return &sleep_icon;
-    } else if (iconName == "ceiling_light" || iconName == "ceiling-light") {
-        return &ceiling_light_icon;
-    } else if (iconName == "bulb") {
-        return &bulb_icon;
-    } else if (iconName == "door") {
-        return &door_icon;
-    } else if (iconName == "moon") {
-        return &moon_icon;
-    } else if (iconName == "sun") {
-        return &sun_icon;
-    }
-    return nullptr;
+const lv_img_dsc_t* UIManager::getIconImage(IconId icon) {
+    if ((uint8_t)icon >= ICON_PACK_FIRST) {
+        return iconPack.image(icon);
+    }
+    return iconDescriptor(icon).image;
+}
+
+void UIManager::setIconImage(lv_obj_t* img, const void* src, lv_color_t color) {
+    const lv_img_dsc_t* base = (const lv_img_dsc_t*)iconTintCache.baseOf(src);
+    bool alphaOnly = base && base->header.cf == LV_IMG_CF_ALPHA_8BIT;
+    const lv_img_dsc_t* tinted = alphaOnly ? iconTintCache.acquire(base, color) : nullptr;
+
+    // Take the new reference before dropping the old one, so a copy that is
+    // kept isn't evicted in between
+    const void* old = lv_img_get_src(img);
+    iconTintCache.release(old);
+    if (tinted) {
+        lv_obj_remove_event_cb(img, onTintedIconDeleted);
+        lv_obj_add_event_cb(img, onTintedIconDeleted, LV_EVENT_DELETE, nullptr);
+    }
+
+    const void* shown = tinted ? (const void*)tinted : (const void*)base;
+    if (old != shown) {
+        lv_img_set_src(img, shown);
+    }
+
+    // The color is kept on the object either way; setIconColor() and the
+    // patch paths read it back
+    lv_obj_set_style_img_recolor(img, color, 0);
+    lv_obj_set_style_img_recolor_opa(img, (alphaOnly && !tinted) ? LV_OPA_COVER : LV_OPA_TRANSP, 0);
+}
+
+void UIManager::setIconColor(lv_obj_t* img, lv_color_t color) {
+    setIconImage(img, lv_img_get_src(img), color);
+}
+
+void UIManager::onTintedIconDeleted(lv_event_t* e) {
+    iconTintCache.release(lv_img_get_src(lv_event_get_target(e)));
 }
 
 // ============================================================================
@@ -1908,21 +3328,21 @@ void UIManager::createServerChangeDialog() {
 
     // Warning icon
     lv_obj_t* warningIcon = lv_label_create(serverChangeState.panel);
-    lv_label_set_text(warningIcon, LV_SYMBOL_WARNING);
+    lv_label_set_text_static(warningIcon, LV_SYMBOL_WARNING);
     lv_obj_set_style_text_font(warningIcon, &lv_font_montserrat_28, 0);
     lv_obj_set_style_text_color(warningIcon, lv_color_hex(0xff9500), 0);
     lv_obj_align(warningIcon, LV_ALIGN_TOP_MID, 0, 15);
 
     // Title
     serverChangeState.titleLabel = lv_label_create(serverChangeState.panel);
-    lv_label_set_text(serverChangeState.titleLabel, "Server Change Request");
+    lv_label_set_text_static(serverChangeState.titleLabel, "Server Change Request");
     lv_obj_set_style_text_font(serverChangeState.titleLabel, &lv_font_montserrat_20, 0);
     lv_obj_set_style_text_color(serverChangeState.titleLabel, lv_color_white(), 0);
     lv_obj_align(serverChangeState.titleLabel, LV_ALIGN_TOP_MID, 0, 55);
 
     // Message
     serverChangeState.messageLabel = lv_label_create(serverChangeState.panel);
-    lv_label_set_text(serverChangeState.messageLabel, "A server is requesting to\nchange your connection to:");
+    lv_label_set_text_static(serverChangeState.messageLabel, "A server is requesting to\nchange your connection to:");
     lv_obj_set_style_text_font(serverChangeState.messageLabel, &lv_font_montserrat_14, 0);
     lv_obj_set_style_text_color(serverChangeState.messageLabel, lv_color_hex(0x8e8e93), 0);
     lv_obj_set_style_text_align(serverChangeState.messageLabel, LV_TEXT_ALIGN_CENTER, 0);
@@ -1930,7 +3350,11 @@ void UIManager::createServerChangeDialog() {
 
     // Server address display
     serverChangeState.serverLabel = lv_label_create(serverChangeState.panel);
-    lv_label_set_text(serverChangeState.serverLabel, serverChangeState.newReportingUrl.c_str());
+    String serverText = serverChangeState.newReportingUrl;
+    if (serverChangeState.changeCa) {
+        serverText += serverChangeState.newCaCert.length() > 0 ? "\n(new CA certificate)" : "\n(no CA certificate)";
+    }
+    lv_label_set_text(serverChangeState.serverLabel, serverText.c_str());
     lv_obj_set_style_text_font(serverChangeState.serverLabel, &lv_font_montserrat_16, 0);
     lv_obj_set_style_text_color(serverChangeState.serverLabel, lv_color_hex(0x32d74b), 0);
     lv_obj_set_width(serverChangeState.serverLabel, 340);
@@ -1948,7 +3372,7 @@ void UIManager::createServerChangeDialog() {
     lv_obj_add_event_cb(serverChangeState.acceptBtn, onServerChangeAccept, LV_EVENT_CLICKED, nullptr);
 
     lv_obj_t* acceptLabel = lv_label_create(serverChangeState.acceptBtn);
-    lv_label_set_text(acceptLabel, "Accept");
+    lv_label_set_text_static(acceptLabel, "Accept");
     lv_obj_set_style_text_font(acceptLabel, &lv_font_montserrat_16, 0);
     lv_obj_set_style_text_color(acceptLabel, lv_color_white(), 0);
     lv_obj_center(acceptLabel);
@@ -1963,21 +3387,28 @@ void UIManager::createServerChangeDialog() {
     lv_obj_add_event_cb(serverChangeState.rejectBtn, onServerChangeReject, LV_EVENT_CLICKED, nullptr);
 
     lv_obj_t* rejectLabel = lv_label_create(serverChangeState.rejectBtn);
-    lv_label_set_text(rejectLabel, "Reject");
+    lv_label_set_text_static(rejectLabel, "Reject");
     lv_obj_set_style_text_font(rejectLabel, &lv_font_montserrat_16, 0);
     lv_obj_set_style_text_color(rejectLabel, lv_color_white(), 0);
     lv_obj_center(rejectLabel);
 }
 
-void UIManager::showServerChangeConfirmation(const String& newReportingUrl) {
+void UIManager::showServerChangeConfirmation(const String& newReportingUrl, const char* caCert) {
+    // Replace a dialog that is still open rather than stacking a second one
+    if (serverChangeState.overlay) {
+        hideServerChangeConfirmation();
+    }
+
     // Store the pending change
     serverChangeState.pending = true;
     serverChangeState.newReportingUrl = newReportingUrl;
+    serverChangeState.changeCa = caCert != nullptr;
+    serverChangeState.newCaCert = caCert ? caCert : "";
 
     // Create and show the dialog
     createServerChangeDialog();
 
-    Serial.printf("UIManager: Showing server change confirmation for %s\n",
+    LOG_I("UIManager: Showing server change confirmation for %s",
                   newReportingUrl.c_str());
 }
 
@@ -1994,6 +3425,8 @@ void UIManager::hideServerChangeConfirmation() {
     }
     serverChangeState.pending = false;
     serverChangeState.newReportingUrl = "";
+    serverChangeState.changeCa = false;
+    serverChangeState.newCaCert = "";
 }
 
 bool UIManager::isServerChangePending() const {
@@ -2005,24 +3438,31 @@ String UIManager::getPendingReportingUrl() const {
 }
 
 void UIManager::onServerChangeAccept(lv_event_t* e) {
-    Serial.println("UIManager: Server change accepted by user");
+    LOG_I("UIManager: Server change accepted by user");
 
     // Get the pending server info
     String newUrl = uiManager.serverChangeState.newReportingUrl;
 
+    // The CA first, so no request to the new server goes out unverified
+    if (uiManager.serverChangeState.changeCa) {
+        configManager.setServerCa(uiManager.serverChangeState.newCaCert);
+    }
+
     // Update the config
-    configManager.setReportingUrl(newUrl);
-    configManager.saveConfig();
+    if (configManager.getConfig().server.reportingUrl != newUrl) {
+        configManager.setReportingUrl(newUrl);
+        configManager.markDirty(ConfigManager::DIRTY_SERVER);
+    }
 
     // Hide the dialog
     uiManager.hideServerChangeConfirmation();
 
-    Serial.printf("UIManager: Server reporting URL changed to %s and saved to NVS\n",
+    LOG_I("UIManager: Server reporting URL changed to %s (queued for NVS)",
                   newUrl.c_str());
 }
 
 void UIManager::onServerChangeReject(lv_event_t* e) {
-    Serial.println("UIManager: Server change rejected by user");
+    LOG_I("UIManager: Server change rejected by user");
 
     // Just hide the dialog, don't change anything
     uiManager.hideServerChangeConfirmation();
@@ -2033,7 +3473,12 @@ void UIManager::onServerChangeReject(lv_event_t* e) {
 // ============================================================================
 
 void UIManager::showOTAScreen() {
-    Serial.println("UIManager: Showing OTA update screen");
+    if (otaScreen) return;
+    LOG_I("UIManager: Showing OTA update screen");
+
+    // A fade's cover sits on the top layer, above every screen, and its
+    // frames are PSRAM the update wants
+    themeTransition.cancel();
 
     // Set brightness to full so user can see the update screen
     setBrightness(100);
@@ -2065,41 +3510,71 @@ void UIManager::showOTAScreen() {
 
     // Download arrow icon inside circle
     lv_obj_t* iconLabel = lv_label_create(iconCircle);
-    lv_label_set_text(iconLabel, LV_SYMBOL_DOWNLOAD);
+    lv_label_set_text_static(iconLabel, LV_SYMBOL_DOWNLOAD);
     lv_obj_set_style_text_font(iconLabel, &lv_font_montserrat_28, 0);
     lv_obj_set_style_text_color(iconLabel, lv_color_hex(0x00d4ff), 0);
     lv_obj_center(iconLabel);
 
     // Title label
     lv_obj_t* titleLabel = lv_label_create(container);
-    lv_label_set_text(titleLabel, "Updating Firmware");
+    lv_label_set_text_static(titleLabel, "Updating Firmware");
     lv_obj_align(titleLabel, LV_ALIGN_TOP_MID, 0, 105);
     lv_obj_set_style_text_font(titleLabel, &lv_font_montserrat_24, 0);
     lv_obj_set_style_text_color(titleLabel, lv_color_hex(0x00d4ff), 0);
 
     // Subtitle label
     lv_obj_t* subtitleLabel = lv_label_create(container);
-    lv_label_set_text(subtitleLabel, "Please wait...");
+    lv_label_set_text_static(subtitleLabel, "Please wait...");
     lv_obj_align(subtitleLabel, LV_ALIGN_TOP_MID, 0, 145);
     lv_obj_set_style_text_font(subtitleLabel, &lv_font_montserrat_16, 0);
     lv_obj_set_style_text_color(subtitleLabel, lv_color_hex(0x8e8e93), 0);
 
     // Warning label
     lv_obj_t* warningLabel = lv_label_create(container);
-    lv_label_set_text(warningLabel, "Do not power off");
+    lv_label_set_text_static(warningLabel, "Do not power off");
     lv_obj_align(warningLabel, LV_ALIGN_TOP_MID, 0, 185);
     lv_obj_set_style_text_font(warningLabel, &lv_font_montserrat_14, 0);
     lv_obj_set_style_text_color(warningLabel, lv_color_hex(0xff9500), 0);
 
+    // Progress: the only area redrawn while the update runs
+    otaProgressBar = lv_bar_create(container);
+    lv_obj_set_size(otaProgressBar, 240, 8);
+    lv_obj_align(otaProgressBar, LV_ALIGN_TOP_MID, 0, 222);
+    lv_bar_set_range(otaProgressBar, 0, 100);
+    lv_bar_set_value(otaProgressBar, 0, LV_ANIM_OFF);
+    lv_obj_set_style_bg_color(otaProgressBar, lv_color_hex(0x2c2c3e), LV_PART_MAIN);
+    lv_obj_set_style_bg_color(otaProgressBar, lv_color_hex(0x00d4ff), LV_PART_INDICATOR);
+
+    otaProgressLabel = lv_label_create(container);
+    lv_label_set_text_static(otaProgressLabel, "");
+    lv_obj_align(otaProgressLabel, LV_ALIGN_TOP_MID, 0, 240);
+    lv_obj_set_style_text_font(otaProgressLabel, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_color(otaProgressLabel, lv_color_hex(0x8e8e93), 0);
+
     // Load the OTA screen and force immediate refresh
     lv_scr_load(otaScreen);
     lv_refr_now(NULL);
 }
 
 void UIManager::updateOTAProgress(int percent) {
+    if (otaProgressBar) {
+        lv_bar_set_value(otaProgressBar, percent, LV_ANIM_OFF);
+    }
     if (otaProgressLabel) {
         char buf[32];
         snprintf(buf, sizeof(buf), "Progress: %d%%", percent);
         lv_label_set_text(otaProgressLabel, buf);
     }
 }
+
+void UIManager::hideOTAScreen() {
+    if (!otaScreen) return;
+    LOG_I("UIManager: Leaving OTA update screen");
+
+    // A rebuild still under way swaps its screen in when it completes
+    lv_scr_load(isBuilding() && liveScreen ? liveScreen : screen);
+    lv_obj_del(otaScreen);
+    otaScreen = nullptr;
+    otaProgressBar = nullptr;
+    otaProgressLabel = nullptr;
+}
@@ -0,0 +1,148 @@
+#include "ui_tree_diag.h"
+#include "ui_manager.h"
+#include "theme_engine.h"
+#include "psram_budget.h"
+#include "lvgl_task.h"
+
+// Global instance
+UITreeDiag uiTreeDiag;
+
+// ============================================================================
+// Counting
+// ============================================================================
+
+void UITreeDiag::measure(lv_obj_t* obj, Totals& totals) {
+    totals.objects++;
+    totals.heapBytes += obj->class_p->instance_size + ALLOC_OVERHEAD;
+
+    if (obj->spec_attr) {
+        totals.heapBytes += sizeof(*obj->spec_attr) + ALLOC_OVERHEAD;
+        if (obj->spec_attr->child_cnt) {
+            totals.heapBytes += obj->spec_attr->child_cnt * sizeof(lv_obj_t*) + ALLOC_OVERHEAD;
+        }
+        if (obj->spec_attr->event_dsc_cnt) {
+            totals.heapBytes += obj->spec_attr->event_dsc_cnt * EVENT_DSC_BYTES + ALLOC_OVERHEAD;
+        }
+    }
+
+    if (obj->style_cnt) {
+        totals.heapBytes += obj->style_cnt * sizeof(obj->styles[0]) + ALLOC_OVERHEAD;
+        for (uint32_t i = 0; i < obj->style_cnt; i++) {
+            const lv_style_t* style = obj->styles[i].style;
+            if (!obj->styles[i].is_local && !obj->styles[i].is_trans) continue;
+            // Local and transition styles belong to the object; shared
+            // (theme) styles are counted nowhere
+            totals.localStyles++;
+            totals.styleProps += style->prop_cnt;
+            totals.heapBytes += sizeof(lv_style_t) + ALLOC_OVERHEAD;
+            if (style->prop_cnt > 1) {
+                totals.heapBytes += style->prop_cnt * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t)) +
+                                    ALLOC_OVERHEAD;
+            }
+        }
+    }
+
+    if (lv_obj_check_type(obj, &lv_label_class)) {
+        const lv_label_t* label = (const lv_label_t*)obj;
+        if (label->text && !label->static_txt) {
+            totals.heapBytes += strlen(label->text) + 1 + ALLOC_OVERHEAD;
+        }
+    }
+
+    uint32_t children = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < children; i++) {
+        measure(lv_obj_get_child(obj, i), totals);
+    }
+}
+
+int32_t UITreeDiag::drawUs(lv_obj_t* obj) {
+    uint32_t size = lv_snapshot_buf_size_needed(obj, LV_IMG_CF_TRUE_COLOR);
+    if (size == 0) return -1;
+    void* buf = psramBudget.alloc(PSRAM_UI_SNAPSHOT, size);
+    if (!buf) return -1;
+
+    lv_img_dsc_t dsc;
+    uint32_t start = micros();
+    lv_res_t res = lv_snapshot_take_to_buf(obj, LV_IMG_CF_TRUE_COLOR, &dsc, buf, size);
+    uint32_t elapsed = micros() - start;
+    psramBudget.release(PSRAM_UI_SNAPSHOT, buf, size);
+    return res == LV_RES_OK ? (int32_t)elapsed : -1;
+}
+
+// ============================================================================
+// Roles
+// ============================================================================
+
+const char* UITreeDiag::roleOf(lv_obj_t* obj, int& id) const {
+    const UIManager& ui = uiManager;
+    id = -1;
+    if (obj == ui.header) return "header";
+    if (obj == ui.actionBar) return "action_bar";
+    if (obj == ui.lcarsFrame) return "lcars_frame";
+    if (obj == ui.pager) return "pager";
+    if (obj == ui.pressFlash) return "press_flash";
+    if (obj == ui.buildShield) return "build_shield";
+    if (obj == ui.fanOverlay.overlay) return "fan_overlay";
+    if (obj == ui.serverChangeState.overlay) return "server_dialog";
+    for (int i = 0; i < ui.numCards; i++) {
+        if (obj == ui.buttonCards[i].card) {
+            id = ui.buttonCards[i].buttonId;
+            return "card";
+        }
+        if (obj == ui.cardTiles[i]) {
+            id = ui.buttonCards[i].buttonId;
+            return "card_tile";
+        }
+    }
+    return lv_obj_check_type(obj, &lv_img_class) ? "image" : "decoration";
+}
+
+// ============================================================================
+// Report
+// ============================================================================
+
+void UITreeDiag::writeSubtree(Print& out, lv_obj_t* obj, const char* role, int id, bool withDraw, bool& first) {
+    Totals totals = {};
+    measure(obj, totals);
+    bool hidden = lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    int32_t us = withDraw && !hidden ? drawUs(obj) : -1;
+
+    out.printf("%s{\"role\":\"%s\"", first ? "" : ",", role);
+    if (id >= 0) out.printf(",\"id\":%d", id);
+    out.printf(",\"objects\":%u,\"local_styles\":%u,\"style_props\":%u,\"heap_bytes\":%u,\"hidden\":%s",
+               totals.objects, totals.localStyles, totals.styleProps, totals.heapBytes,
+               hidden ? "true" : "false");
+    if (us >= 0) {
+        out.printf(",\"draw_us\":%d}", us);
+    } else {
+        out.print(",\"draw_us\":null}");
+    }
+    first = false;
+}
+
+void UITreeDiag::writeJson(Print& out, bool withDraw) {
+    LVGLLock lock;
+    lv_obj_t* screen = lv_scr_act();
+
+    Totals all = {};
+    measure(screen, all);
+    out.printf("{\"theme\":\"%s\",\"building\":%s,\"objects\":%u,\"local_styles\":%u,\"style_props\":%u,"
+               "\"heap_bytes\":%u,\"subtrees\":[",
+               themeEngine.getCurrentThemeName().c_str(), uiManager.isBuilding() ? "true" : "false",
+               all.objects, all.localStyles, all.styleProps, all.heapBytes);
+
+    bool first = true;
+    uint32_t children = lv_obj_get_child_cnt(screen);
+    for (uint32_t i = 0; i < children; i++) {
+        lv_obj_t* child = lv_obj_get_child(screen, i);
+        int id;
+        const char* role = roleOf(child, id);
+        writeSubtree(out, child, role, id, withDraw, first);
+    }
+
+    // Parked cards aren't on screen but still hold their heap
+    if (uiManager.cardPoolParent) {
+        writeSubtree(out, uiManager.cardPoolParent, "card_pool", -1, false, first);
+    }
+    out.print("]}");
+}
@@ -0,0 +1,155 @@
+#include "warm_state.h"
+#include "config_manager.h"
+#include "device_controller.h"
+#include "ui_manager.h"
+#include "theme_engine.h"
+#include "event_scheduler.h"
+#include "panel_log.h"
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <esp_rom_crc.h>
+
+// Global instance
+WarmState warmState;
+
+struct WarmButton {
+    uint8_t id;
+    uint8_t state;
+    uint8_t speedLevel;
+};
+
+struct RtcWarmState {
+    uint32_t magic;
+    uint32_t crc;               // esp_rom_crc32_le(0, ...) of everything after it
+    uint32_t stateVersion;
+    uint8_t brightness;
+    uint8_t theme;              // ThemeId
+    uint8_t buttonCount;
+    uint8_t reserved;
+    WarmButton buttons[MAX_BUTTONS];
+};
+
+static const uint32_t RTC_WARM_MAGIC = 0x4d524157;     // "WARM"
+static RTC_NOINIT_ATTR RtcWarmState rtcWarm;
+
+static uint32_t warmCrc(const RtcWarmState& s) {
+    const uint8_t* body = (const uint8_t*)&s.stateVersion;
+    return esp_rom_crc32_le(0, body, sizeof(s) - offsetof(RtcWarmState, stateVersion));
+}
+
+WarmState::WarmState()
+    : job(-1)
+    , restored(false)
+    , restoredBrightness(0)
+    , restoredTheme(0)
+    , savedGeneration(0)
+    , savedVersion(0)
+    , savedBrightness(0)
+    , savedTheme(0)
+    , saved(false)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+{
+}
+
+bool WarmState::restore() {
+    // RTC slow memory only survives resets that keep the chip powered
+    esp_reset_reason_t reason = esp_reset_reason();
+    if (reason == ESP_RST_POWERON || reason == ESP_RST_BROWNOUT || reason == ESP_RST_UNKNOWN) {
+        return false;
+    }
+    if (rtcWarm.magic != RTC_WARM_MAGIC || rtcWarm.buttonCount > MAX_BUTTONS ||
+        rtcWarm.crc != warmCrc(rtcWarm)) {
+        return false;
+    }
+
+    // By id: a button the config no longer has is skipped
+    int applied = 0;
+    for (uint8_t i = 0; i < rtcWarm.buttonCount; i++) {
+        const WarmButton& b = rtcWarm.buttons[i];
+        const ButtonConfig* button = configManager.findButton(b.id);
+        if (!button) continue;
+        if (button->speedSteps > 0) {
+            configManager.setButtonSpeed(b.id, b.speedLevel);
+        } else {
+            configManager.setButtonState(b.id, b.state != 0);
+        }
+        applied++;
+    }
+    deviceController.setStateVersion(rtcWarm.stateVersion);
+
+    restoredBrightness = rtcWarm.brightness;
+    restoredTheme = rtcWarm.theme;
+    restored = true;
+    LOG_I("WarmState: Restored %d buttons at v%u from before the restart", applied, rtcWarm.stateVersion);
+    return true;
+}
+
+void WarmState::restoreDisplay() {
+    if (!restored) return;
+
+    // A dark screen stays up to the brightness schedule and a touch, as
+    // after a cold boot
+    if (restoredBrightness > 0) {
+        uiManager.setBrightness(restoredBrightness);
+    }
+
+    // Until the clock is set the day/night scheduler can't pick a theme; a
+    // static theme is set from the config again when the UI is built
+    themeEngine.setTheme((ThemeId)restoredTheme);
+}
+
+void WarmState::begin() {
+    job = eventScheduler.add("warm_state", onSaveTimer, this);
+    eventScheduler.schedule(job, SAVE_INTERVAL_MS);
+    esp_register_shutdown_handler(onShutdown);
+    save();
+}
+
+void WarmState::onSaveTimer(void* arg) {
+    WarmState* self = (WarmState*)arg;
+    eventScheduler.schedule(self->job, SAVE_INTERVAL_MS);
+    self->save();
+}
+
+void WarmState::onShutdown() {
+    warmState.save();
+}
+
+void WarmState::save() {
+    uint32_t generation = configManager.getGeneration();
+    uint32_t version = deviceController.getStateVersion();
+    uint8_t brightness = uiManager.getBrightness();
+    uint8_t theme = (uint8_t)themeEngine.getCurrentThemeId();
+
+    portENTER_CRITICAL(&mux);
+    bool unchanged = saved && generation == savedGeneration && version == savedVersion &&
+                     brightness == savedBrightness && theme == savedTheme;
+    portEXIT_CRITICAL(&mux);
+    if (unchanged) return;
+
+    RtcWarmState next;
+    memset(&next, 0, sizeof(next));
+    next.magic = RTC_WARM_MAGIC;
+    next.stateVersion = version;
+    next.brightness = brightness;
+    next.theme = theme;
+    {
+        ConfigSnapshot config;
+        for (const ButtonConfig& button : config->buttons) {
+            WarmButton& b = next.buttons[next.buttonCount++];
+            b.id = button.id;
+            b.state = button.state;
+            b.speedLevel = button.speedLevel;
+        }
+    }
+    next.crc = warmCrc(next);
+
+    portENTER_CRITICAL(&mux);
+    memcpy(&rtcWarm, &next, sizeof(rtcWarm));
+    savedGeneration = generation;
+    savedVersion = version;
+    savedBrightness = brightness;
+    savedTheme = theme;
+    saved = true;
+    portEXIT_CRITICAL(&mux);
+}
@@ -3,14 +3,54 @@
 #include "device_controller.h"
 #include "ui_manager.h"
 #include "theme_engine.h"
+#include "time_manager.h"
 #include "brightness_scheduler.h"
 #include "theme_scheduler.h"
-#include "time_manager.h"
+#include "solar_clock.h"
+#include "ambient_light.h"
+#include "lvgl_task.h"
+#include "lvgl_mem.h"
+#include "server_channel.h"
+#include "request_lane.h"
+#include "screen_stream.h"
+#include "perf_monitor.h"
+#include "latency_trace.h"
+#include "heap_monitor.h"
+#include "json_alloc.h"
+#include "panel_tuner.h"
+#include "crash_report.h"
+#include "boot_profile.h"
+#include "psram_budget.h"
+#include "static_memory.h"
+#include "task_monitor.h"
+#include "stall_monitor.h"
+#include "metrics_exporter.h"
+#include "event_scheduler.h"
+#include "ui_benchmark.h"
+#include "wifi_link.h"
+#include "wifi_scan.h"
+#include "mdns_service.h"
+#include "ota_stream.h"
+#include "icon_pack.h"
+#include "background_anim.h"
+#include "icon_tint_cache.h"
+#include "card_tile_cache.h"
+#include "packed_image.h"
+#include "theme_transition.h"
+#include "band_renderer.h"
+#include "img_cache_stats.h"
+#include "ui_tree_diag.h"
+#include "state_multicast.h"
+#include "peer_mirror.h"
+#include "http_pool.h"
+#include "panel_log.h"
+#include "index_html_gz.h"
 #include <ArduinoJson.h>
 #include <WiFi.h>
 #include <ElegantOTA.h>
 #include <Preferences.h>
 #include <esp_timer.h>
+#include <esp_heap_caps.h>
 
 // Global instance
 DisplayWebServer webServer;
@@ -19,10 +59,12 @@ DisplayWebServer::DisplayWebServer() : server(80) {
 }
 
 void DisplayWebServer::begin() {
+    // Worker for the heavy endpoints, up before the first request can arrive
+    heavyLane.begin();
     setupRoutes();
     setupOTA();
     server.begin();
-    Serial.println("Web server started on port 80");
+    LOG_I("Web server started on port 80");
 }
 
 String DisplayWebServer::getIPAddress() {
@@ -36,30 +78,33 @@ void DisplayWebServer::setupOTA() {
 
     // OTA progress callbacks
     ElegantOTA.onStart([]() {
-        Serial.println("\n========================================");
-        Serial.println("OTA Update Started");
-        Serial.println("========================================");
+        LOG_I("\n========================================");
+        LOG_I("OTA Update Started");
+        LOG_I("========================================");
 
-        // Show the OTA update screen with spinner
-        uiManager.showOTAScreen();
+        // OTA screen, slow render pass, power save off
+        OtaStream::enterUpdateMode();
     });
 
     ElegantOTA.onProgress([](size_t current, size_t total) {
         static int lastPercent = -1;
         int percent = (current * 100) / total;
-        // Only log every 10% - no UI updates during OTA to avoid tearing
+        if (percent == lastPercent) return;
+        // Only the progress bar is invalidated; log every 10%
         if (percent / 10 != lastPercent / 10) {
-            lastPercent = percent;
-            Serial.printf("OTA Progress: %d%% (%u / %u bytes)\n", percent, current, total);
+            LOG_I("OTA Progress: %d%% (%u / %u bytes)", percent, current, total);
         }
+        lastPercent = percent;
+        LVGLLock lvglLock;
+        uiManager.updateOTAProgress(percent);
     });
 
     ElegantOTA.onEnd([](bool success) {
-        Serial.println("\n========================================");
+        LOG_I("\n========================================");
         if (success) {
-            Serial.println("OTA Update Complete!");
-            Serial.println("Rebooting...");
-            Serial.println("========================================\n");
+            LOG_I("OTA Update Complete!");
+            LOG_I("Rebooting...");
+            LOG_I("========================================\n");
             // Delay reboot slightly to allow HTTP response to be sent
             // Can't use delay() here as it blocks the response, so schedule via timer
             static esp_timer_handle_t reboot_timer = nullptr;
@@ -71,34 +116,426 @@ void DisplayWebServer::setupOTA() {
             }
             esp_timer_start_once(reboot_timer, 100000); // 100ms delay
         } else {
-            Serial.println("OTA Update FAILED!");
-            Serial.println("========================================\n");
+            LOG_E("OTA Update FAILED!");
+            LOG_I("========================================\n");
+            OtaStream::leaveUpdateMode();
         }
     });
 
-    Serial.println("OTA updates available at /update");
+    LOG_I("OTA updates available at /update");
+}
+
+// Body handler shared by the state endpoints. Single-chunk bodies are parsed
+// in place from the request buffer; chunked ones are gathered into a bounded
+// per-request buffer (_tempObject, freed with the request) and parsed once.
+// The buffer is a web_body slot in the static build (static_memory.h).
+static void onStateBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+    HeapTagScope heapTag(HEAP_TAG_WEB);
+    if (total > MAX_STATE_PAYLOAD_SIZE) {
+        if (index == 0) {
+            request->send(413, "application/json", "{\"success\":false,\"error\":\"Payload too large\"}");
+        }
+        return;
+    }
+
+    char* json = (char*)data;
+    if (index != 0 || len != total) {
+        if (index == 0) {
+            request->_tempObject = poolMalloc(STATIC_POOL_WEB_BODY, total);
+            if (request->_tempObject == nullptr) {
+                request->send(500, "application/json", "{\"success\":false,\"error\":\"Out of memory\"}");
+                return;
+            }
+        }
+        if (request->_tempObject == nullptr) {
+            return;
+        }
+        memcpy((uint8_t*)request->_tempObject + index, data, len);
+        if (index + len < total) {
+            return;
+        }
+        json = (char*)request->_tempObject;
+    }
+
+    // MessagePack is opted into per request through Content-Type
+    bool msgpack = request->contentType().indexOf("msgpack") >= 0;
+    bool resync = false;
+    if (deviceController.processServerStateUpdate(json, total, msgpack, &resync)) {
+        // Report the applied version so the server can send deltas against it
+        char response[80];
+        snprintf(response, sizeof(response), "{\"success\":true,\"version\":%u%s}",
+                 deviceController.getStateVersion(), resync ? ",\"resync\":true" : "");
+        request->send(200, "application/json", response);
+    } else {
+        request->send(400, "application/json", "{\"success\":false,\"error\":\"Invalid state JSON\"}");
+    }
+}
+
+// ============================================================================
+// Conditional GET
+// ============================================================================
+// /api/config and /api/state carry ETags built from a per-boot nonce plus the
+// config generation (and, for state, the server state version and current
+// brightness), so idle panels answer fleet polling with a bodiless 304.
+// The state ETag deliberately ignores uptime, which changes every second.
+
+static uint32_t etagNonce = 0;
+
+// Sends 304 and returns true when the client already holds this ETag
+static bool sendNotModified(AsyncWebServerRequest *request, const char* etag) {
+    const AsyncWebHeader* match = request->getHeader("If-None-Match");
+    if (!match || match->value() != etag) {
+        return false;
+    }
+    AsyncWebServerResponse *response = request->beginResponse(304);
+    response->addHeader("ETag", etag);
+    request->send(response);
+    return true;
+}
+
+static void configETag(char* buf, size_t size) {
+    snprintf(buf, size, "\"c%08x-%u\"", etagNonce, configManager.getGeneration());
+}
+
+static void stateETag(char* buf, size_t size, bool msgpack) {
+    snprintf(buf, size, "\"s%08x-%u-%u-%u%s\"", etagNonce, configManager.getGeneration(),
+             deviceController.getStateVersion(), uiManager.getBrightness(), msgpack ? "m" : "");
+}
+
+// Last /api/config body, reused until the config generation moves
+// (only touched from the AsyncTCP task)
+static String cachedConfigJson;
+static uint32_t cachedConfigGeneration = 0;
+static bool cachedConfigValid = false;
+
+// Passes everything on but the first byte: a serialized object's opening
+// brace, when its members are appended to another object
+class SkipFirstPrint : public Print {
+public:
+    explicit SkipFirstPrint(Print& out) : out(out), skipped(false) {}
+    size_t write(uint8_t c) override {
+        if (!skipped) {
+            skipped = true;
+            return 1;
+        }
+        return out.write(c);
+    }
+    size_t write(const uint8_t* data, size_t size) override {
+        if (size == 0) return 0;
+        if (!skipped) {
+            skipped = true;
+            return 1 + out.write(data + 1, size - 1);
+        }
+        return out.write(data, size);
+    }
+
+private:
+    Print& out;
+    bool skipped;
+};
+
+// /api/info fields that only change with the config or the address,
+// serialized once as an object missing its closing brace; the live fields
+// are appended per request (only touched from the AsyncTCP task)
+static String cachedInfoHead;
+static uint32_t cachedInfoGeneration = 0;
+static uint32_t cachedInfoIp = 0;
+static bool cachedInfoValid = false;
+
+static void refreshInfoHead() {
+    uint32_t generation = configManager.getGeneration();
+    uint32_t ip = (uint32_t)WiFi.localIP();
+    if (cachedInfoValid && generation == cachedInfoGeneration && ip == cachedInfoIp) {
+        return;
+    }
+
+    StaticJsonDocument<768> doc;
+    doc["firmware"] = MDNSService::getFirmwareVersion();
+    doc["boot_id"] = mdnsService.getBootId();
+    // Delta patches name this as their source
+    {
+        const uint8_t* sha = otaStream.runningSha256();
+        char hex[65];
+        for (int i = 0; i < 32; i++) {
+            snprintf(hex + i * 2, 3, "%02x", sha[i]);
+        }
+        doc["app_sha256"] = hex;
+    }
+    // Bodies POST /api/ota understands
+    JsonArray otaFormats = doc.createNestedArray("ota_formats");
+    otaFormats.add("image");
+    otaFormats.add("delta");
+    otaFormats.add("gzip");
+    doc["chip_model"] = ESP.getChipModel();
+    doc["chip_revision"] = ESP.getChipRevision();
+    doc["flash_size"] = ESP.getFlashChipSize();
+    doc["total_psram"] = ESP.getPsramSize();
+    doc["ip_address"] = WiFi.localIP().toString();
+    doc["mac_address"] = WiFi.macAddress();
+    {
+        ConfigSnapshot config;
+        doc["reporting_url"] = config->server.reportingUrl.c_str();
+        cachedInfoHead = "";
+        serializeJson(doc, cachedInfoHead);
+    }
+    cachedInfoHead.remove(cachedInfoHead.length() - 1);
+    cachedInfoGeneration = generation;
+    cachedInfoIp = ip;
+    cachedInfoValid = true;
+}
+
+// The POST /api/ota request feeding otaStream; any other upload is refused
+static AsyncWebServerRequest* otaUploadRequest = nullptr;
+static AsyncWebServerRequest* iconUploadRequest = nullptr;
+static AsyncWebServerRequest* backgroundUploadRequest = nullptr;
+
+// ============================================================================
+// Heavy lane
+// ============================================================================
+// Screenshot, config apply, icon pack installs and background decodes run on heavyLane's worker and answer
+// 202; state, action and status endpoints stay inline on the AsyncTCP task.
+
+// Sends 503 + Retry-After and returns true when the lane refused the job
+static bool sendIfBusy(AsyncWebServerRequest *request, SubmitResult result) {
+    if (result != SUBMIT_BUSY) {
+        return false;
+    }
+    AsyncWebServerResponse *response = request->beginResponse(
+        503, "application/json", "{\"success\":false,\"error\":\"Busy, retry later\"}");
+    response->addHeader("Retry-After", String(HeavyRequestLane::RETRY_AFTER_S));
+    request->send(response);
+    return true;
+}
+
+static void addJobStatus(JsonObject obj, HeavyJob job) {
+    JobStatus status = heavyLane.getStatus(job);
+    obj["state"] = heavyLane.getStateName(job);
+    obj["runs"] = status.runs;
+    if (status.id) {
+        obj["last_id"] = status.id;
+    }
+    if (status.finishedAt) {
+        obj["age_ms"] = millis() - status.finishedAt;
+    }
+    if (status.state == JOB_FAILED && status.error) {
+        obj["error"] = status.error;
+    }
+}
+
+// ============================================================================
+// Partial config updates
+// ============================================================================
+// PATCH /api/config/buttons/<id>, /api/config/scenes/<id> and
+// /api/config/display change one record of the live config in place (see
+// ConfigManager::patchButton()). A few fields are parsed inline, the copy
+// is published, the write-behind task persists it and the UI patches the
+// cards that changed, with no full parse or rebuild.
+
+enum ConfigPatchTarget : uint8_t {
+    PATCH_TARGET_BUTTON,
+    PATCH_TARGET_SCENE,
+    PATCH_TARGET_DISPLAY
+};
+
+static void handleConfigPatch(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total,
+                              ConfigPatchTarget target) {
+    if (total > MAX_PATCH_PAYLOAD_SIZE) {
+        if (index == 0) {
+            request->send(413, "application/json", "{\"success\":false,\"error\":\"Patch too large\"}");
+        }
+        return;
+    }
+
+    // Scene action lists can span chunks: gather into a per-request buffer
+    char* json = (char*)data;
+    if (index != 0 || len != total) {
+        if (index == 0) {
+            request->_tempObject = poolMalloc(STATIC_POOL_WEB_BODY, total);
+            if (request->_tempObject == nullptr) {
+                request->send(500, "application/json", "{\"success\":false,\"error\":\"Out of memory\"}");
+                return;
+            }
+        }
+        if (request->_tempObject == nullptr) {
+            return;
+        }
+        memcpy((uint8_t*)request->_tempObject + index, data, len);
+        if (index + len < total) {
+            return;
+        }
+        json = (char*)request->_tempObject;
+    }
+
+    PsramJsonDocument doc(2 * total + 256);
+    DeserializationError error = deserializeJson(doc, json, total);
+    if (error || !doc.is<JsonObject>()) {
+        request->send(400, "application/json", "{\"success\":false,\"error\":\"Invalid JSON\"}");
+        return;
+    }
+    JsonObjectConst fields = doc.as<JsonObjectConst>();
+
+    // The record id is the last path segment
+    long id = 0;
+    if (target != PATCH_TARGET_DISPLAY) {
+        const String& url = request->url();
+        id = url.substring(url.lastIndexOf('/') + 1).toInt();
+    }
+
+    ConfigManager::PatchResult result;
+    uint8_t section;
+    switch (target) {
+        case PATCH_TARGET_BUTTON:
+            result = id > 0 && id < 256 ? configManager.patchButton(id, fields) : ConfigManager::PATCH_NOT_FOUND;
+            section = ConfigManager::DIRTY_BUTTONS;
+            break;
+        case PATCH_TARGET_SCENE:
+            result = id > 0 && id < 256 ? configManager.patchScene(id, fields) : ConfigManager::PATCH_NOT_FOUND;
+            section = ConfigManager::DIRTY_SCENES;
+            break;
+        default:
+            result = configManager.patchDisplay(fields);
+            section = ConfigManager::DIRTY_DISPLAY;
+            break;
+    }
+
+    if (result == ConfigManager::PATCH_NOT_FOUND) {
+        request->send(404, "application/json", "{\"success\":false,\"error\":\"No such button or scene\"}");
+        return;
+    }
+    if (result == ConfigManager::PATCH_INVALID) {
+        StaticJsonDocument<160> response;
+        response["success"] = false;
+        response["error"] = configManager.getLastParseError() ? configManager.getLastParseError() : "Invalid patch";
+        String body;
+        serializeJson(response, body);
+        request->send(400, "application/json", body);
+        return;
+    }
+
+    configManager.markDirty(section);
+    if (target == PATCH_TARGET_DISPLAY) {
+        // Same order as a full config: schedules first, so the patch below
+        // sees the right theme and brightness
+        brightnessScheduler.refresh();
+        themeScheduler.refresh();
+    }
+    // Reconciled in place unless the change is structural
+    uiManager.requestRebuild();
+    request->send(200, "application/json", "{\"success\":true}");
+}
+
+// Screenshots are encoded from the captured frame as the TCP window allows;
+// each response holds a reference so a recapture or delete can't free the
+// frame mid-transfer. ?format= picks the encoding:
+//   bmp     24-bit BMP (default, opens anywhere)
+//   qoi     QOI, typically 10-50x smaller on flat UIs (chunked, length unknown)
+//   rgb565  the raw little-endian frame, dimensions in X-Image-Width/Height
+static void sendScreenshot(AsyncWebServerRequest *request, const char* disposition) {
+    ScreenshotRef frame = getScreenshot();
+    if (!frame) {
+        request->send(404, "application/json", "{\"error\":\"No screenshot available\"}");
+        return;
+    }
+
+    String format = request->hasParam("format") ? request->getParam("format")->value() : String("bmp");
+    AsyncWebServerResponse *response;
+    if (format == "bmp") {
+        response = request->beginResponse("image/bmp", getScreenshotBmpSize(),
+            [frame](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+                return readScreenshotBmp(*frame, buffer, maxLen, index);
+            });
+    } else if (format == "qoi") {
+        std::shared_ptr<QoiScreenshotEncoder> encoder = std::make_shared<QoiScreenshotEncoder>(frame);
+        response = request->beginChunkedResponse("image/qoi",
+            [encoder](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+                return encoder->read(buffer, maxLen);
+            });
+    } else if (format == "rgb565") {
+        response = request->beginResponse("application/octet-stream", getScreenshotRgb565Size(),
+            [frame](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+                return readScreenshotRgb565(*frame, buffer, maxLen, index);
+            });
+        response->addHeader("X-Image-Width", String(getScreenshotWidth()));
+        response->addHeader("X-Image-Height", String(getScreenshotHeight()));
+    } else {
+        request->send(400, "application/json", "{\"error\":\"format must be bmp, qoi or rgb565\"}");
+        return;
+    }
+
+    char value[64];
+    snprintf(value, sizeof(value), "%s; filename=\"screenshot.%s\"", disposition,
+             format == "rgb565" ? "raw" : format.c_str());
+    response->addHeader("Content-Disposition", value);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
 }
 
 void DisplayWebServer::setupRoutes() {
+    etagNonce = esp_random();
+
     // Root page - simple dashboard
-    server.on("/", HTTP_GET, [this](AsyncWebServerRequest *request) {
-        request->send(200, "text/html", getIndexPage());
+    // Admin page: gzip blob in flash (web/index.html, embedded at build time),
+    // streamed without a heap copy. ETag + no-cache lets browsers revalidate
+    // with a 304 instead of re-downloading.
+    server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
+        if (sendNotModified(request, INDEX_HTML_ETAG)) {
+            return;
+        }
+
+        AsyncWebServerResponse *response = request->beginResponse_P(
+            200, "text/html", INDEX_HTML_GZ, INDEX_HTML_GZ_LEN);
+        response->addHeader("Content-Encoding", "gzip");
+        response->addHeader("ETag", INDEX_HTML_ETAG);
+        response->addHeader("Cache-Control", "no-cache");
+        request->send(response);
     });
 
     // API: Get device info
+    // The fixed fields come from refreshInfoHead(); only the live ones are
+    // serialized here
     server.on("/api/info", HTTP_GET, [](AsyncWebServerRequest *request) {
-        StaticJsonDocument<768> doc;
-        doc["chip_model"] = ESP.getChipModel();
-        doc["chip_revision"] = ESP.getChipRevision();
+        PsramJsonDocument doc(1024);
         doc["cpu_freq_mhz"] = ESP.getCpuFreqMHz();
-        doc["flash_size"] = ESP.getFlashChipSize();
         doc["free_heap"] = ESP.getFreeHeap();
         doc["free_psram"] = ESP.getFreePsram();
-        doc["total_psram"] = ESP.getPsramSize();
+
+#if !LVGL_MEM_BUILTIN
+        // LVGL allocator usage
+        {
+            lvgl_mem_stats_t mem;
+            lvgl_mem_get_stats(&mem);
+            JsonObject lvMem = doc.createNestedObject("lvgl_mem");
+            lvMem["internal_used"] = mem.internalUsed;
+            lvMem["internal_peak"] = mem.internalPeak;
+            lvMem["internal_budget"] = LVGL_MEM_INTERNAL_BUDGET;
+            lvMem["psram_arena"] = mem.psramArenaSize;
+            lvMem["psram_used"] = mem.psramUsed;
+            lvMem["psram_peak"] = mem.psramPeak;
+            lvMem["psram_largest_free"] = mem.psramLargestFree;
+            lvMem["allocations"] = mem.allocCount;
+            lvMem["failures"] = mem.failures;
+        }
+#endif
+        // No-op state updates skipped at ingest and in the UI
+        JsonObject suppressed = doc.createNestedObject("suppressed_updates");
+        suppressed["ingest"] = deviceController.getSuppressedUpdates();
+        suppressed["ui"] = uiManager.getSuppressedUpdates();
+
+        // Presses undone on screen because the server didn't take them
+        doc["action_rollbacks"] = deviceController.getActionRollbacks();
+
+        // Actions made without WiFi: waiting for the server, sent, pushed out
+        JsonObject journal = doc.createNestedObject("action_journal");
+        journal["pending"] = deviceController.getJournaled();
+        journal["replayed"] = deviceController.getJournalReplayed();
+        journal["dropped"] = deviceController.getJournalDropped();
+
+        // Actions sent to their direct control target, and those it failed
+        JsonObject direct = doc.createNestedObject("direct_actions");
+        direct["sent"] = deviceController.getDirectActions();
+        direct["fallbacks"] = deviceController.getDirectFallbacks();
+
         doc["uptime_seconds"] = millis() / 1000;
-        doc["ip_address"] = WiFi.localIP().toString();
-        doc["mac_address"] = WiFi.macAddress();
-        doc["reporting_url"] = configManager.getConfig().server.reportingUrl;
 
         // Time information
         doc["time_synced"] = timeManager.isSynced();
@@ -109,90 +546,68 @@ void DisplayWebServer::setupRoutes() {
             doc["current_time"] = timeStr;
         }
 
-        // Schedule information
-        const BrightnessScheduleConfig& schedule = configManager.getConfig().display.schedule;
+        // Schedule information; pinned until sent, since the doc borrows the
+        // period name
+        ConfigSnapshot snapshot;
+        const BrightnessScheduleConfig& schedule = snapshot->display.schedule;
         doc["schedule_enabled"] = schedule.enabled;
         doc["current_brightness"] = uiManager.getBrightness();
 
         if (schedule.enabled && timeManager.isSynced()) {
-            // Find active period
-            uint8_t hour = timeManager.getCurrentHour();
-            uint8_t minute = timeManager.getCurrentMinute();
-            uint16_t currentMinutes = hour * 60 + minute;
-
-            int8_t activePeriod = schedule.periodCount > 0 ? schedule.periodCount - 1 : -1;
-            for (uint8_t i = 0; i < schedule.periodCount; i++) {
-                uint16_t periodStart = schedule.periods[i].startHour * 60 + schedule.periods[i].startMinute;
-                if (periodStart <= currentMinutes) {
-                    activePeriod = i;
-                } else {
-                    break;
-                }
-            }
-
+            // Period the scheduler last evaluated (it re-evaluates only at transitions)
+            int8_t activePeriod = brightnessScheduler.getActivePeriod();
             if (activePeriod >= 0 && activePeriod < schedule.periodCount) {
-                doc["current_period"] = schedule.periods[activePeriod].name;
-                doc["scheduled_brightness"] = schedule.periods[activePeriod].brightness;
+                doc["current_period"] = schedule.periods[activePeriod].name.c_str();
+                doc["scheduled_brightness"] = brightnessScheduler.getScheduledBrightness();
             }
+            doc["schedule_mode"] = schedule.curve ? "curve" : "steps";
+            doc["next_schedule_event_s"] = brightnessScheduler.getNextEventInMs() / 1000;
         }
 
-        String response;
-        serializeJson(doc, response);
-        request->send(200, "application/json", response);
-    });
-
-    // API: Capture screenshot
-    server.on("/api/screenshot/capture", HTTP_POST, [](AsyncWebServerRequest *request) {
-        bool success = captureScreenshot();
+        const AmbientConfig& ambient = snapshot->display.ambient;
+        if (ambient.enabled || ambientLight.hasSensor()) {
+            JsonObject adaptive = doc.createNestedObject("adaptive_brightness");
+            adaptive["enabled"] = ambient.enabled;
+            adaptive["sensor"] = ambientLight.hasSensor();
+            adaptive["lux"] = ambientLight.getLux();
+            adaptive["level"] = ambientLight.getLevel();
+        }
 
-        StaticJsonDocument<128> doc;
-        doc["success"] = success;
-        if (success) {
-            doc["size"] = getScreenshotSize();
-            doc["message"] = "Screenshot captured";
-        } else {
-            doc["message"] = "Failed to capture screenshot";
+        SunTimes sun;
+        if (solarClock.today(schedule.latitude, schedule.longitude, sun) && sun.polar == 0) {
+            char sunStr[6];
+            snprintf(sunStr, sizeof(sunStr), "%02d:%02d", sun.sunrise / 60, sun.sunrise % 60);
+            doc["sunrise"] = sunStr;
+            snprintf(sunStr, sizeof(sunStr), "%02d:%02d", sun.sunset / 60, sun.sunset % 60);
+            doc["sunset"] = sunStr;
         }
 
-        String response;
-        serializeJson(doc, response);
-        request->send(success ? 200 : 500, "application/json", response);
+        refreshInfoHead();
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        response->print(cachedInfoHead);
+        response->print(',');
+        SkipFirstPrint live(*response);
+        serializeJson(doc, live);
+        request->send(response);
     });
 
-    // API: Download screenshot
-    server.on("/api/screenshot/download", HTTP_GET, [](AsyncWebServerRequest *request) {
-        if (!hasScreenshot()) {
-            request->send(404, "application/json", "{\"error\":\"No screenshot available\"}");
+    // API: Capture screenshot (runs on the heavy lane; poll /api/screenshot/status)
+    server.on("/api/screenshot/capture", HTTP_POST, [](AsyncWebServerRequest *request) {
+        if (sendIfBusy(request, heavyLane.submit(JOB_SCREENSHOT))) {
             return;
         }
+        request->send(202, "application/json",
+                      "{\"success\":true,\"pending\":true,\"message\":\"Screenshot queued\"}");
+    });
 
-        const uint8_t* data = getScreenshotData();
-        size_t size = getScreenshotSize();
-
-        // Send as downloadable BMP file
-        AsyncWebServerResponse *response = request->beginResponse(
-            200, "image/bmp", data, size
-        );
-        response->addHeader("Content-Disposition", "attachment; filename=\"screenshot.bmp\"");
-        request->send(response);
+    // API: Download screenshot
+    server.on("/api/screenshot/download", HTTP_GET, [](AsyncWebServerRequest *request) {
+        sendScreenshot(request, "attachment");
     });
 
     // API: View screenshot in browser
     server.on("/api/screenshot/view", HTTP_GET, [](AsyncWebServerRequest *request) {
-        if (!hasScreenshot()) {
-            request->send(404, "application/json", "{\"error\":\"No screenshot available\"}");
-            return;
-        }
-
-        const uint8_t* data = getScreenshotData();
-        size_t size = getScreenshotSize();
-
-        // Send as inline image (viewable in browser)
-        AsyncWebServerResponse *response = request->beginResponse(
-            200, "image/bmp", data, size
-        );
-        response->addHeader("Content-Disposition", "inline; filename=\"screenshot.bmp\"");
-        request->send(response);
+        sendScreenshot(request, "inline");
     });
 
     // API: Screenshot status
@@ -202,6 +617,8 @@ void DisplayWebServer::setupRoutes() {
         if (hasScreenshot()) {
             doc["size"] = getScreenshotSize();
         }
+        doc["pending"] = heavyLane.isPending(JOB_SCREENSHOT);
+        doc["last"] = heavyLane.getStateName(JOB_SCREENSHOT);
 
         String response;
         serializeJson(doc, response);
@@ -224,20 +641,26 @@ void DisplayWebServer::setupRoutes() {
     // API: Restart device
     server.on("/api/restart", HTTP_POST, [](AsyncWebServerRequest *request) {
         request->send(200, "application/json", "{\"message\":\"Restarting...\"}");
+        configManager.flush();
         delay(100);
         ESP.restart();
     });
 
     // API: Get WiFi status
     server.on("/api/wifi/status", HTTP_GET, [](AsyncWebServerRequest *request) {
-        StaticJsonDocument<256> doc;
+        StaticJsonDocument<384> doc;
         doc["connected"] = (WiFi.status() == WL_CONNECTED);
-        doc["mode"] = (WiFi.getMode() == WIFI_AP) ? "ap" : "station";
+        doc["mode"] = wifiLink.isAccessPointUp() ? "ap" : "station";
         doc["ssid"] = WiFi.SSID();
         doc["ip"] = WiFi.localIP().toString();
         doc["rssi"] = WiFi.RSSI();
+        doc["link"] = wifiLink.stateName();
+        doc["connect_ms"] = wifiLink.getLastConnectMs();
+        doc["directed"] = wifiLink.lastConnectWasDirected();
+        doc["reconnects"] = wifiLink.getReconnects();
+        doc["profile"] = wifiProfileName(wifiLink.getProfile());
 
-        if (WiFi.getMode() == WIFI_AP) {
+        if (wifiLink.isAccessPointUp()) {
             doc["ap_ip"] = WiFi.softAPIP().toString();
             doc["ap_ssid"] = "ESP32-Display";
         }
@@ -248,22 +671,12 @@ void DisplayWebServer::setupRoutes() {
     });
 
     // API: Scan WiFi networks
+    // Always answered at once from the last result; a stale one (or ?refresh)
+    // starts a background scan, and the caller polls while "scanning"
     server.on("/api/wifi/scan", HTTP_GET, [](AsyncWebServerRequest *request) {
-        int n = WiFi.scanNetworks();
-        StaticJsonDocument<2048> doc;
-        JsonArray networks = doc.createNestedArray("networks");
-
-        for (int i = 0; i < n && i < 20; i++) {
-            JsonObject net = networks.createNestedObject();
-            net["ssid"] = WiFi.SSID(i);
-            net["rssi"] = WiFi.RSSI(i);
-            net["secure"] = (WiFi.encryptionType(i) != WIFI_AUTH_OPEN);
-        }
-
-        WiFi.scanDelete();
-
+        wifiScanner.request(request->hasParam("refresh"));
         String response;
-        serializeJson(doc, response);
+        wifiScanner.writeJson(response);
         request->send(200, "application/json", response);
     });
 
@@ -306,6 +719,7 @@ void DisplayWebServer::setupRoutes() {
             request->send(200, "application/json", responseStr);
 
             // Restart to apply new WiFi settings
+            configManager.flush();
             delay(500);
             ESP.restart();
         }
@@ -315,68 +729,623 @@ void DisplayWebServer::setupRoutes() {
     // New API endpoints for configurable display system
     // ========================================================================
 
+    // WebSocket: persistent channel for server state pushes and panel actions
+    serverChannel.attach(server);
+
+    // WebSocket: live view of the display (changed tiles only)
+    screenStream.attach(server);
+
     // API: Simple ping endpoint for server connectivity check
     server.on("/api/ping", HTTP_GET, [](AsyncWebServerRequest *request) {
-        request->send(200, "application/json", "{\"pong\":true}");
+        // msgpack advertises that state pushes may be sent as MessagePack,
+        // configSchema the newest config wire schema this firmware reads
+        char body[64];
+        snprintf(body, sizeof(body), "{\"pong\":true,\"msgpack\":true,\"configSchema\":%d}", CONFIG_WIRE_SCHEMA);
+        request->send(200, "application/json", body);
+    });
+
+    // API: Outcome of one POST /api/config (?id= from its 202). Registered
+    // before /api/config, which would otherwise match it as a prefix
+    server.on("/api/config/job", HTTP_GET, [](AsyncWebServerRequest *request) {
+        uint32_t id = request->hasParam("id") ? request->getParam("id")->value().toInt() : 0;
+        JobState state = heavyLane.getJobState(JOB_APPLY_CONFIG, id);
+        if (state == JOB_IDLE) {
+            request->send(404, "application/json", "{\"error\":\"Unknown or expired job\"}");
+            return;
+        }
+
+        StaticJsonDocument<128> doc;
+        doc["id"] = id;
+        doc["state"] = HeavyRequestLane::stateName(state);
+        JobStatus status = heavyLane.getStatus(JOB_APPLY_CONFIG);
+        if (state == JOB_FAILED && status.id == id && status.error) {
+            doc["error"] = status.error;
+        }
+        char body[128];
+        serializeJson(doc, body, sizeof(body));
+        AsyncWebServerResponse *response = request->beginResponse(200, "application/json", body);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
     });
 
     // API: Get current configuration
     server.on("/api/config", HTTP_GET, [](AsyncWebServerRequest *request) {
-        String json = configManager.toJson();
-        request->send(200, "application/json", json);
+        // Read the generation before serializing: if the config moves on
+        // mid-request the next poll simply misses the cache
+        uint32_t generation = configManager.getGeneration();
+        char etag[32];
+        configETag(etag, sizeof(etag));
+        if (sendNotModified(request, etag)) {
+            return;
+        }
+
+        // The server asking whether we still hold the config it pushed
+        // with this hash; if so its push would change nothing
+        uint32_t serverHash = configManager.getServerConfigHash();
+        const AsyncWebHeader* match = request->getHeader("If-None-Match");
+        if (serverHash && match) {
+            char hashTag[12];
+            snprintf(hashTag, sizeof(hashTag), "\"h%08x\"", serverHash);
+            if (match->value() == hashTag) {
+                request->send(304);
+                return;
+            }
+        }
+
+        if (!cachedConfigValid || cachedConfigGeneration != generation) {
+            cachedConfigJson = configManager.toJson();
+            cachedConfigGeneration = generation;
+            cachedConfigValid = true;
+        }
+
+        AsyncWebServerResponse *response = request->beginResponse(200, "application/json", cachedConfigJson);
+        response->addHeader("ETag", etag);
+        response->addHeader("Cache-Control", "no-cache");
+        request->send(response);
     });
 
     // API: Receive new configuration from server (POST)
-    // Static buffer to accumulate chunked body data
-    static String configBodyBuffer;
-
+    // Each request gathers its body into its own PSRAM buffer (_tempObject),
+    // which is handed to the heavy lane and parsed in place on its worker
     server.on("/api/config", HTTP_POST,
         [](AsyncWebServerRequest *request) {
             // Called when request completes - process accumulated body
-            if (configBodyBuffer.length() > 0) {
-                Serial.printf("WebServer: Processing config (%d bytes)\n", configBodyBuffer.length());
-
-                if (configManager.parseConfigJson(configBodyBuffer)) {
-                    configManager.saveConfig();
+            char* body = (char*)request->_tempObject;
+            size_t length = request->contentLength();
+            if (length > MAX_CONFIG_PAYLOAD_SIZE) {
+                return;  // 413 already sent from the body handler
+            }
+            if (body == nullptr && length > 0) {
+                request->send(500, "application/json", "{\"success\":false,\"error\":\"Out of memory\"}");
+                return;
+            }
+            if (body == nullptr) {
+                request->send(400, "application/json", "{\"success\":false,\"error\":\"No config data received\"}");
+                return;
+            }
 
-                    // Refresh schedulers BEFORE requesting rebuild so theme/brightness
-                    // are set correctly when the UI rebuilds
-                    brightnessScheduler.refresh();
-                    themeScheduler.refresh();
+            // The lane owns the buffer from here on (frees it after parsing)
+            request->_tempObject = nullptr;
+            uint32_t jobId = 0;
+            if (sendIfBusy(request, heavyLane.submit(JOB_APPLY_CONFIG, body, length, &jobId))) {
+                return;
+            }
 
-                    // Request UI rebuild (will be done in main loop for thread safety)
-                    uiManager.requestRebuild();
+            // Parsed and applied on the heavy lane; outcome at /api/config/job
+            char accepted[96];
+            snprintf(accepted, sizeof(accepted),
+                     "{\"success\":true,\"status\":\"queued\",\"job\":%u}", jobId);
+            AsyncWebServerResponse *response = request->beginResponse(202, "application/json", accepted);
+            char location[40];
+            snprintf(location, sizeof(location), "/api/config/job?id=%u", jobId);
+            response->addHeader("Location", location);
+            request->send(response);
+        },
+        NULL,
+        [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+            if (total > MAX_CONFIG_PAYLOAD_SIZE) {
+                if (index == 0) {
+                    request->send(413, "application/json", "{\"success\":false,\"error\":\"Config too large\"}");
+                }
+                return;
+            }
 
-                    request->send(200, "application/json", "{\"success\":true,\"message\":\"Config applied\"}");
-                } else {
-                    request->send(400, "application/json", "{\"success\":false,\"error\":\"Invalid config JSON\"}");
+            HeapTagScope heapTag(HEAP_TAG_WEB);
+            if (index == 0) {
+                request->_tempObject = poolMalloc(STATIC_POOL_CONFIG_BODY, total, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+                if (request->_tempObject == nullptr) {
+                    request->_tempObject = malloc(total);
                 }
-                configBodyBuffer = "";  // Clear buffer
-            } else {
-                request->send(400, "application/json", "{\"success\":false,\"error\":\"No config data received\"}");
+            }
+            if (request->_tempObject == nullptr || index + len > total) {
+                return;
+            }
+
+            memcpy((uint8_t*)request->_tempObject + index, data, len);
+        }
+    );
+
+    // API: Partial config updates (PATCH), see handleConfigPatch()
+    server.on("/api/config/buttons", HTTP_PATCH,
+        [](AsyncWebServerRequest *request) {
+            // Response sent after body processed
+            if (request->contentLength() == 0) {
+                request->send(400, "application/json", "{\"success\":false,\"error\":\"Empty patch\"}");
             }
         },
         NULL,
         [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
-            // Accumulate body chunks
+            handleConfigPatch(request, data, len, index, total, PATCH_TARGET_BUTTON);
+        }
+    );
+    server.on("/api/config/scenes", HTTP_PATCH,
+        [](AsyncWebServerRequest *request) {
+            // Response sent after body processed
+            if (request->contentLength() == 0) {
+                request->send(400, "application/json", "{\"success\":false,\"error\":\"Empty patch\"}");
+            }
+        },
+        NULL,
+        [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+            handleConfigPatch(request, data, len, index, total, PATCH_TARGET_SCENE);
+        }
+    );
+    server.on("/api/config/display", HTTP_PATCH,
+        [](AsyncWebServerRequest *request) {
+            // Response sent after body processed
+            if (request->contentLength() == 0) {
+                request->send(400, "application/json", "{\"success\":false,\"error\":\"Empty patch\"}");
+            }
+        },
+        NULL,
+        [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+            handleConfigPatch(request, data, len, index, total, PATCH_TARGET_DISPLAY);
+        }
+    );
+
+    // API: Touch-to-photon / touch-to-webhook latency per stage. Registered
+    // before /api/perf, which would otherwise match it as a prefix
+    server.on("/api/perf/latency", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncWebServerResponse *response = request->beginResponse(200, "application/json", latencyTrace.toJson());
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Frame timing and loop profile (p50/p95/p99 over the last samples)
+    server.on("/api/perf", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncWebServerResponse *response = request->beginResponse(200, "application/json", perfMonitor.toJson());
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Start a fresh perf window (e.g. right before a test run)
+    server.on("/api/perf/reset", HTTP_POST, [](AsyncWebServerRequest *request) {
+        perfMonitor.reset();
+        latencyTrace.reset();
+        request->send(200, "application/json", "{\"success\":true}");
+    });
+
+    // API: Heap/PSRAM history with per-subsystem tags (see heap_monitor.h)
+    server.on("/api/diag/heap", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        heapMonitor.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Recent log lines; poll with ?since=<next> to follow (see panel_log.h)
+    server.on("/api/logs", HTTP_GET, [](AsyncWebServerRequest *request) {
+        uint32_t since = request->hasParam("since") ? request->getParam("since")->value().toInt() : 0;
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        panelLog.writeJson(*response, since);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Large PSRAM buffers by client and priority (see psram_budget.h)
+    server.on("/api/diag/psram", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        psramBudget.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Pre-tinted icon copies (see icon_tint_cache.h)
+    server.on("/api/diag/icon_tint", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        iconTintCache.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Unpacked decoration images (see packed_image.h)
+    server.on("/api/diag/packed_images", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        packedImages.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Objects, local styles, heap and draw time per screen subtree
+    // (see ui_tree_diag.h); ?draw=0 skips the draw timing
+    server.on("/api/diag/ui_tree", HTTP_GET, [](AsyncWebServerRequest *request) {
+        bool withDraw = !(request->hasParam("draw") && request->getParam("draw")->value() == "0");
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        uiTreeDiag.writeJson(*response, withDraw);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: LVGL image cache hit rates per image (see img_cache_stats.h)
+    server.on("/api/diag/img_cache", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        imageCacheStats.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Resize the image cache until restart (?size=N) and/or zero its
+    // counters (?reset=1), to compare sizes on the same screen
+    server.on("/api/diag/img_cache", HTTP_POST, [](AsyncWebServerRequest *request) {
+        LVGLLock lvglLock;
+        if (request->hasParam("size")) {
+            long size = request->getParam("size")->value().toInt();
+            if (size < 0 || !imageCacheStats.setCacheSize(size)) {
+                request->send(400, "application/json", "{\"success\":false,\"error\":\"Invalid cache size\"}");
+                return;
+            }
+            imageCacheStats.reset();
+        } else if (request->hasParam("reset")) {
+            imageCacheStats.reset();
+        }
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        imageCacheStats.writeJson(*response);
+        request->send(response);
+    });
+
+    // API: Pre-rendered card tiles (see card_tile_cache.h)
+    server.on("/api/diag/card_tiles", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        cardTileCache.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Theme cross-fades (see theme_transition.h)
+    server.on("/api/diag/theme_transition", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        themeTransition.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Blends split across both cores (see band_renderer.h)
+    server.on("/api/diag/bands", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        bandRenderer.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Server state multicast (see state_multicast.h)
+    server.on("/api/diag/multicast", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        stateMulticast.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Presses mirrored over ESP-NOW (see peer_mirror.h)
+    server.on("/api/diag/peers", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        peerMirror.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Stage timings of this boot and the ones before it (see boot_profile.h)
+    server.on("/api/diag/boot", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        bootProfile.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Previous boot's crash, until the server has it (see crash_report.h)
+    server.on("/api/diag/crash", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        crashReport.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Per-task CPU, stack high-water marks and core affinity (see task_monitor.h)
+    server.on("/api/diag/tasks", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        taskMonitor.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Loop/LVGL task stalls with tag and backtrace, newest first (see stall_monitor.h)
+    server.on("/api/diag/stalls", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        stallMonitor.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Counters, gauges and histograms in Prometheus text format (see metrics_exporter.h)
+    server.on("/metrics", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("text/plain; version=0.0.4");
+        writeMetrics(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: loop() jobs with next deadline, run count and worst lateness (see event_scheduler.h)
+    server.on("/api/diag/scheduler", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        eventScheduler.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Run the UI benchmark (report at GET /api/bench)
+    server.on("/api/bench", HTTP_POST, [](AsyncWebServerRequest *request) {
+        if (!uiBenchmark.start()) {
+            request->send(409, "application/json", "{\"success\":false,\"error\":\"Benchmark already running\"}");
+            return;
+        }
+        request->send(202, "application/json", "{\"success\":true,\"status\":\"running\"}");
+    });
+
+    server.on("/api/bench", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        uiBenchmark.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Find the fastest stable pixel clock and save it (see panel_tuner.h);
+    // progress and results at GET, DELETE returns to the build's timing
+    server.on("/api/display/calibrate", HTTP_POST, [](AsyncWebServerRequest *request) {
+        if (!panelTuner.start()) {
+            request->send(409, "application/json", "{\"success\":false,\"error\":\"Calibration running or unavailable\"}");
+            return;
+        }
+        request->send(202, "application/json", "{\"success\":true,\"status\":\"running\"}");
+    });
+
+    server.on("/api/display/calibrate", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        panelTuner.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    server.on("/api/display/calibrate", HTTP_DELETE, [](AsyncWebServerRequest *request) {
+        if (!panelTuner.reset()) {
+            request->send(409, "application/json", "{\"success\":false,\"error\":\"Calibration running or unavailable\"}");
+            return;
+        }
+        request->send(200, "application/json", "{\"success\":true}");
+    });
+
+    // API: Streaming firmware update (image, delta patch or gzip body,
+    // ?md5=<hex of the image>&size=<image bytes>); the fast path next to
+    // /update, see ota_stream.h. 202 once the image is
+    // staged, the writer flashes and reboots; progress at GET /api/ota
+    server.on("/api/ota", HTTP_POST,
+        [](AsyncWebServerRequest *request) {
+            if (request->contentLength() == 0) {
+                request->send(400, "application/json", "{\"success\":false,\"error\":\"No image received\"}");
+                return;
+            }
+            if (request != otaUploadRequest) {
+                return;  // Refused from the body handler
+            }
+            otaUploadRequest = nullptr;
+            if (otaStream.getState() == OtaStream::State::FAILED) {
+                AsyncResponseStream* response = request->beginResponseStream("application/json");
+                response->setCode(500);
+                otaStream.writeJson(*response);
+                request->send(response);
+                return;
+            }
+            request->send(202, "application/json", "{\"success\":true,\"status\":\"flashing\"}");
+        },
+        NULL,
+        [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
             if (index == 0) {
-                configBodyBuffer = "";  // Reset on first chunk
-                configBodyBuffer.reserve(total);  // Pre-allocate
+                const char* md5 = request->hasParam("md5") ? request->getParam("md5")->value().c_str() : nullptr;
+                size_t imageSize = request->hasParam("size") ? request->getParam("size")->value().toInt() : 0;
+                const char* reason = nullptr;
+                int status = 500;
+                if (!otaStream.begin(total, imageSize, md5, reason, status)) {
+                    StaticJsonDocument<128> doc;
+                    doc["success"] = false;
+                    doc["error"] = reason;
+                    String body;
+                    serializeJson(doc, body);
+                    request->send(status, "application/json", body);
+                    return;
+                }
+                otaUploadRequest = request;
+                request->onDisconnect([request]() {
+                    if (otaUploadRequest == request) {
+                        otaUploadRequest = nullptr;
+                        otaStream.abortUpload();
+                    }
+                });
+            }
+            if (request == otaUploadRequest) {
+                otaStream.feed(data, len);
             }
+        }
+    );
+
+    server.on("/api/ota", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        otaStream.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
 
-            // Append this chunk
-            for (size_t i = 0; i < len; i++) {
-                configBodyBuffer += (char)data[i];
+    // API: Upload an icon pack (raw body, format in icon_pack.h). 202 once
+    // it is staged, the heavy lane writes it to flash and switches the UI
+    // over; progress and the installed icons at GET /api/icons
+    server.on("/api/icons", HTTP_POST,
+        [](AsyncWebServerRequest *request) {
+            if (request->contentLength() == 0) {
+                request->send(400, "application/json", "{\"success\":false,\"error\":\"No icon pack received\"}");
+                return;
+            }
+            if (request != iconUploadRequest) {
+                return;  // Refused from the body handler
+            }
+            iconUploadRequest = nullptr;
+            if (!iconPack.isStaged()) {
+                iconPack.abortUpload();
+                request->send(400, "application/json", "{\"success\":false,\"error\":\"Incomplete icon pack\"}");
+                return;
+            }
+            if (sendIfBusy(request, heavyLane.submit(JOB_ICON_PACK))) {
+                iconPack.abortUpload();
+                return;
+            }
+            request->send(202, "application/json", "{\"success\":true,\"status\":\"installing\"}");
+        },
+        NULL,
+        [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+            if (index == 0) {
+                const char* reason = nullptr;
+                if (!iconPack.beginUpload(total, reason)) {
+                    StaticJsonDocument<128> doc;
+                    doc["success"] = false;
+                    doc["error"] = reason;
+                    String body;
+                    serializeJson(doc, body);
+                    request->send(iconPack.isBusy() ? 409 : 507, "application/json", body);
+                    return;
+                }
+                iconUploadRequest = request;
+                request->onDisconnect([request]() {
+                    if (iconUploadRequest == request) {
+                        iconUploadRequest = nullptr;
+                        iconPack.abortUpload();
+                    }
+                });
             }
+            if (request == iconUploadRequest) {
+                iconPack.feed(data, len);
+            }
+        }
+    );
 
-            Serial.printf("WebServer: Received config chunk %d-%d of %d\n", index, index + len, total);
+    server.on("/api/icons", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        iconPack.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Upload an animated background or a JPEG photo (raw body, format
+    // in background_anim.h). 202 once it is staged, the heavy lane decodes it
+    // and swaps it in; progress and the loaded animation at GET /api/background
+    server.on("/api/background", HTTP_POST,
+        [](AsyncWebServerRequest *request) {
+            if (request->contentLength() == 0) {
+                request->send(400, "application/json", "{\"success\":false,\"error\":\"No animation received\"}");
+                return;
+            }
+            if (request != backgroundUploadRequest) {
+                return;  // Refused from the body handler
+            }
+            backgroundUploadRequest = nullptr;
+            if (!backgroundAnim.isStaged()) {
+                backgroundAnim.abortUpload();
+                request->send(400, "application/json", "{\"success\":false,\"error\":\"Incomplete animation\"}");
+                return;
+            }
+            if (sendIfBusy(request, heavyLane.submit(JOB_BACKGROUND))) {
+                backgroundAnim.abortUpload();
+                return;
+            }
+            request->send(202, "application/json", "{\"success\":true,\"status\":\"decoding\"}");
+        },
+        NULL,
+        [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+            if (index == 0) {
+                const char* reason = nullptr;
+                if (!backgroundAnim.beginUpload(total, reason)) {
+                    StaticJsonDocument<128> doc;
+                    doc["success"] = false;
+                    doc["error"] = reason;
+                    String body;
+                    serializeJson(doc, body);
+                    request->send(backgroundAnim.isBusy() ? 409 : 507, "application/json", body);
+                    return;
+                }
+                backgroundUploadRequest = request;
+                request->onDisconnect([request]() {
+                    if (backgroundUploadRequest == request) {
+                        backgroundUploadRequest = nullptr;
+                        backgroundAnim.abortUpload();
+                    }
+                });
+            }
+            if (request == backgroundUploadRequest) {
+                backgroundAnim.feed(data, len);
+            }
         }
     );
 
+    server.on("/api/background", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        backgroundAnim.writeJson(*response);
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // API: Back to the theme's plain background
+    server.on("/api/background", HTTP_DELETE, [](AsyncWebServerRequest *request) {
+        backgroundAnim.remove();
+        request->send(200, "application/json", "{\"success\":true}");
+    });
+
+    // API: Heavy lane job status
+    server.on("/api/jobs", HTTP_GET, [](AsyncWebServerRequest *request) {
+        StaticJsonDocument<512> doc;
+        addJobStatus(doc.createNestedObject("screenshot"), JOB_SCREENSHOT);
+        addJobStatus(doc.createNestedObject("apply_config"), JOB_APPLY_CONFIG);
+        addJobStatus(doc.createNestedObject("icon_pack"), JOB_ICON_PACK);
+        addJobStatus(doc.createNestedObject("background"), JOB_BACKGROUND);
+
+        String response;
+        serializeJson(doc, response);
+        request->send(200, "application/json", response);
+    });
+
     // API: Get current device state
     server.on("/api/state", HTTP_GET, [](AsyncWebServerRequest *request) {
-        String json = deviceController.getStateJson();
-        request->send(200, "application/json", json);
+        // Compact MessagePack when the caller asks for it
+        const AsyncWebHeader* accept = request->getHeader("Accept");
+        bool msgpack = accept && accept->value().indexOf("msgpack") >= 0;
+
+        char etag[48];
+        stateETag(etag, sizeof(etag), msgpack);
+        if (sendNotModified(request, etag)) {
+            return;
+        }
+
+        AsyncResponseStream* response = request->beginResponseStream(
+            msgpack ? "application/msgpack" : "application/json");
+        deviceController.writeState(*response, msgpack);
+        response->addHeader("ETag", etag);
+        response->addHeader("Cache-Control", "no-cache");
+        response->addHeader("Vary", "Accept");
+        request->send(response);
     });
 
     // API: Receive state update from server (POST)
@@ -385,11 +1354,7 @@ void DisplayWebServer::setupRoutes() {
             // Response sent after body processed
         },
         NULL,
-        [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
-            String json = String((char*)data).substring(0, len);
-            deviceController.processServerStateUpdate(json);
-            request->send(200, "application/json", "{\"success\":true}");
-        }
+        onStateBody
     );
 
     // API: Receive button state updates (POST) - for state sync from server
@@ -398,11 +1363,7 @@ void DisplayWebServer::setupRoutes() {
             // Response sent after body processed
         },
         NULL,
-        [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
-            String json = String((char*)data).substring(0, len);
-            deviceController.processServerStateUpdate(json);
-            request->send(200, "application/json", "{\"success\":true}");
-        }
+        onStateBody
     );
 
     // API: Set brightness (POST)
@@ -426,8 +1387,9 @@ void DisplayWebServer::setupRoutes() {
                 return;
             }
 
-            uiManager.setBrightness(brightness);
-            configManager.getConfigMutable().display.brightness = brightness;
+            uiManager.postBrightness(brightness);
+            configManager.setBrightness(brightness);
+            configManager.markDirty(ConfigManager::DIRTY_DISPLAY);
 
             StaticJsonDocument<64> response;
             response["success"] = true;
@@ -439,6 +1401,32 @@ void DisplayWebServer::setupRoutes() {
         }
     );
 
+    // API: Room light level for adaptive brightness (POST), when the panel has no sensor
+    server.on("/api/ambient", HTTP_POST,
+        [](AsyncWebServerRequest *request) {
+            // Response sent after body processed
+        },
+        NULL,
+        [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+            StaticJsonDocument<64> doc;
+            DeserializationError error = deserializeJson(doc, data, len);
+
+            if (error) {
+                request->send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
+                return;
+            }
+
+            long lux = doc["lux"] | -1L;
+            if (lux < 0) {
+                request->send(400, "application/json", "{\"error\":\"lux must be >= 0\"}");
+                return;
+            }
+
+            ambientLight.submitLux((uint32_t)lux);
+            request->send(200, "application/json", "{\"success\":true}");
+        }
+    );
+
     // API: Change theme (POST)
     server.on("/api/theme", HTTP_POST,
         [](AsyncWebServerRequest *request) {
@@ -467,7 +1455,8 @@ void DisplayWebServer::setupRoutes() {
             }
 
             // Update config and request UI rebuild
-            configManager.getConfigMutable().display.theme = theme;
+            configManager.setTheme(theme);
+            configManager.markDirty(ConfigManager::DIRTY_DISPLAY);
             uiManager.requestRebuild();
 
             StaticJsonDocument<128> response;
@@ -487,8 +1476,36 @@ void DisplayWebServer::setupRoutes() {
         },
         NULL,
         [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+            if (total > MAX_SERVER_PAYLOAD_SIZE) {
+                if (index == 0) {
+                    request->send(413, "application/json", "{\"error\":\"Payload too large\"}");
+                }
+                return;
+            }
+
+            // A CA PEM can span chunks: gather into a per-request buffer
+            char* json = (char*)data;
+            if (index != 0 || len != total) {
+                if (index == 0) {
+                    request->_tempObject = poolMalloc(STATIC_POOL_WEB_BODY, total);
+                    if (request->_tempObject == nullptr) {
+                        request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+                        return;
+                    }
+                }
+                if (request->_tempObject == nullptr) {
+                    return;
+                }
+                memcpy((uint8_t*)request->_tempObject + index, data, len);
+                if (index + len < total) {
+                    return;
+                }
+                json = (char*)request->_tempObject;
+            }
+
+            // Parsed in place, so the PEM isn't copied into the document
             StaticJsonDocument<256> doc;
-            DeserializationError error = deserializeJson(doc, data, len);
+            DeserializationError error = deserializeJson(doc, json, total);
 
             if (error) {
                 request->send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
@@ -496,6 +1513,8 @@ void DisplayWebServer::setupRoutes() {
             }
 
             const char* reportingUrl = doc["reportingUrl"];
+            // Optional: the CA for an https:// server, "" to remove the stored one
+            const char* caCert = doc["caCert"];
 
             if (!reportingUrl || strlen(reportingUrl) == 0) {
                 request->send(400, "application/json", "{\"error\":\"reportingUrl required\"}");
@@ -509,9 +1528,21 @@ void DisplayWebServer::setupRoutes() {
                 return;
             }
 
-            // Check if URL matches current configuration - no change needed
-            const DeviceConfig& config = configManager.getConfig();
-            if (url == config.server.reportingUrl) {
+            if (caCert && *caCert && strncmp(caCert, "-----BEGIN CERTIFICATE-----", 27) != 0) {
+                request->send(400, "application/json", "{\"error\":\"caCert must be a PEM certificate\"}");
+                return;
+            }
+
+            // Check if URL (and CA) match current configuration - no change needed
+            if (caCert && configManager.getServerCa() == caCert) {
+                caCert = nullptr;
+            }
+            bool sameUrl;
+            {
+                ConfigSnapshot config;
+                sameUrl = config->server.reportingUrl == url;
+            }
+            if (sameUrl && caCert == nullptr) {
                 request->send(200, "application/json", "{\"success\":true,\"message\":\"URL already configured\"}");
                 return;
             }
@@ -523,7 +1554,10 @@ void DisplayWebServer::setupRoutes() {
             }
 
             // Show confirmation dialog to user
-            uiManager.showServerChangeConfirmation(url);
+            {
+                LVGLLock lvglLock;
+                uiManager.showServerChangeConfirmation(url, caCert);
+            }
 
             StaticJsonDocument<256> response;
             response["success"] = true;
@@ -538,10 +1572,11 @@ void DisplayWebServer::setupRoutes() {
 
     // API: Get current server configuration
     server.on("/api/server", HTTP_GET, [](AsyncWebServerRequest *request) {
-        const DeviceConfig& config = configManager.getConfig();
+        ConfigSnapshot config;
 
         StaticJsonDocument<256> doc;
-        doc["reportingUrl"] = config.server.reportingUrl;
+        doc["reportingUrl"] = config->server.reportingUrl.c_str();
+        doc["caCert"] = httpPool.hasCACert();
 
         String response;
         serializeJson(doc, response);
@@ -550,406 +1585,10 @@ void DisplayWebServer::setupRoutes() {
 
     // Log 404 errors
     server.onNotFound([](AsyncWebServerRequest *request) {
-        Serial.printf("WebServer: 404 Not Found - %s %s\n",
+        LOG_I("WebServer: 404 Not Found - %s %s",
             request->methodToString(),
             request->url().c_str());
         request->send(404, "application/json", "{\"error\":\"Not found\"}");
     });
 }
 
-String DisplayWebServer::getIndexPage() {
-    return R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>ESP32 Display Controller</title>
-    <style>
-        * { margin: 0; padding: 0; box-sizing: border-box; }
-        body {
-            font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif;
-            background: #1a1a2e;
-            color: #eee;
-            min-height: 100vh;
-            padding: 20px;
-        }
-        .container { max-width: 800px; margin: 0 auto; }
-        h1 { color: #00d4ff; margin-bottom: 20px; }
-        .card {
-            background: #16213e;
-            border-radius: 12px;
-            padding: 20px;
-            margin-bottom: 20px;
-            border: 1px solid #0f3460;
-        }
-        .card h2 { color: #00d4ff; margin-bottom: 15px; font-size: 1.2em; }
-        .info-grid { display: grid; grid-template-columns: repeat(auto-fit, minmax(180px, 1fr)); gap: 15px; }
-        .info-item { background: #0f3460; padding: 12px; border-radius: 8px; }
-        .info-label { color: #888; font-size: 0.85em; margin-bottom: 4px; }
-        .info-value { font-size: 1.1em; font-weight: 500; }
-        .btn {
-            background: #00d4ff;
-            color: #1a1a2e;
-            border: none;
-            padding: 12px 24px;
-            border-radius: 8px;
-            font-size: 1em;
-            cursor: pointer;
-            margin-right: 10px;
-            margin-bottom: 10px;
-            transition: background 0.2s;
-        }
-        .btn:hover { background: #00b8e6; }
-        .btn-secondary { background: #0f3460; color: #eee; }
-        .btn-secondary:hover { background: #1a4a7a; }
-        .btn-danger { background: #e94560; }
-        .btn-danger:hover { background: #d13550; }
-        .screenshot-container { text-align: center; margin-top: 15px; }
-        .screenshot-container img {
-            max-width: 100%;
-            border-radius: 8px;
-            border: 2px solid #0f3460;
-        }
-        .status { padding: 8px 16px; border-radius: 4px; display: inline-block; margin-top: 10px; }
-        .status-success { background: #0f5132; color: #75b798; }
-        .status-error { background: #5c1a1a; color: #ea868f; }
-        #screenshot-status { margin-bottom: 15px; }
-        .form-group { margin-bottom: 15px; }
-        .form-group label { display: block; color: #888; margin-bottom: 5px; }
-        .form-group input, .form-group select {
-            width: 100%;
-            padding: 10px;
-            border: 1px solid #0f3460;
-            border-radius: 6px;
-            background: #0f3460;
-            color: #eee;
-            font-size: 1em;
-        }
-        .form-group input:focus, .form-group select:focus {
-            outline: none;
-            border-color: #00d4ff;
-        }
-        .network-list { max-height: 200px; overflow-y: auto; margin-bottom: 15px; }
-        .network-item {
-            padding: 10px;
-            background: #0f3460;
-            border-radius: 6px;
-            margin-bottom: 8px;
-            cursor: pointer;
-            display: flex;
-            justify-content: space-between;
-            align-items: center;
-        }
-        .network-item:hover { background: #1a4a7a; }
-        .signal { font-size: 0.9em; color: #888; }
-    </style>
-</head>
-<body>
-    <div class="container">
-        <h1>ESP32 Display Controller</h1>
-
-        <div class="card">
-            <h2>Device Information</h2>
-            <div class="info-grid" id="device-info">
-                <div class="info-item">
-                    <div class="info-label">Loading...</div>
-                </div>
-            </div>
-        </div>
-
-        <div class="card">
-            <h2>Server Configuration</h2>
-            <div class="form-group">
-                <label>Reporting URL</label>
-                <div style="display: flex; gap: 8px;">
-                    <input type="text" id="reporting-url-input" placeholder="http://server:port">
-                    <button class="btn" onclick="saveReportingUrl()" style="margin: 0; white-space: nowrap;">Update</button>
-                </div>
-            </div>
-            <div id="reporting-url-status"></div>
-        </div>
-
-        <div class="card">
-            <h2>Screenshot</h2>
-            <div id="screenshot-status"></div>
-            <button class="btn" onclick="captureScreenshot()">Capture Screenshot</button>
-            <button class="btn btn-secondary" onclick="viewScreenshot()">View</button>
-            <button class="btn btn-secondary" onclick="downloadScreenshot()">Download</button>
-            <div class="screenshot-container" id="screenshot-container"></div>
-        </div>
-
-        <div class="card">
-            <h2>WiFi Configuration</h2>
-            <div id="wifi-status" style="margin-bottom: 15px;"></div>
-            <button class="btn btn-secondary" onclick="scanNetworks()">Scan Networks</button>
-            <div id="network-list" class="network-list" style="display:none;"></div>
-            <div class="form-group">
-                <label>SSID</label>
-                <input type="text" id="wifi-ssid" placeholder="Network name">
-            </div>
-            <div class="form-group">
-                <label>Password</label>
-                <input type="password" id="wifi-password" placeholder="Password (leave empty for open networks)">
-            </div>
-            <button class="btn" onclick="connectWifi()">Save & Connect</button>
-        </div>
-
-        <div class="card">
-            <h2>Firmware Update</h2>
-            <p style="margin-bottom: 15px; color: #888;">
-                Upload new firmware via the OTA update interface.
-            </p>
-            <a href="/update" class="btn">Open OTA Update</a>
-        </div>
-
-        <div class="card">
-            <h2>System</h2>
-            <button class="btn btn-danger" onclick="restartDevice()">Restart Device</button>
-        </div>
-    </div>
-
-    <script>
-        async function loadDeviceInfo() {
-            try {
-                const response = await fetch('/api/info');
-                const data = await response.json();
-
-                const grid = document.getElementById('device-info');
-                let scheduleHtml = '';
-                if (data.schedule_enabled) {
-                    const periodInfo = data.current_period ?
-                        `<span style="color: #4a4;">● ${data.current_period}</span> (${data.scheduled_brightness}%)` :
-                        'No active period';
-                    scheduleHtml = `
-                    <div class="info-item">
-                        <div class="info-label">Device Time</div>
-                        <div class="info-value">${data.time_synced ? data.current_time : '<span style="color: #f0ad4e;">Syncing...</span>'}</div>
-                    </div>
-                    <div class="info-item">
-                        <div class="info-label">Schedule Period</div>
-                        <div class="info-value">${periodInfo}</div>
-                    </div>`;
-                }
-                grid.innerHTML = `
-                    <div class="info-item">
-                        <div class="info-label">Chip</div>
-                        <div class="info-value">${data.chip_model} Rev ${data.chip_revision}</div>
-                    </div>
-                    <div class="info-item">
-                        <div class="info-label">CPU Frequency</div>
-                        <div class="info-value">${data.cpu_freq_mhz} MHz</div>
-                    </div>
-                    <div class="info-item">
-                        <div class="info-label">Free Heap</div>
-                        <div class="info-value">${(data.free_heap / 1024).toFixed(1)} KB</div>
-                    </div>
-                    <div class="info-item">
-                        <div class="info-label">PSRAM</div>
-                        <div class="info-value">${(data.free_psram / 1024 / 1024).toFixed(1)} / ${(data.total_psram / 1024 / 1024).toFixed(1)} MB</div>
-                    </div>
-                    <div class="info-item">
-                        <div class="info-label">Uptime</div>
-                        <div class="info-value">${formatUptime(data.uptime_seconds)}</div>
-                    </div>
-                    <div class="info-item">
-                        <div class="info-label">IP Address</div>
-                        <div class="info-value">${data.ip_address}</div>
-                    </div>
-                    ${scheduleHtml}
-                    <div class="info-item">
-                        <div class="info-label">Brightness</div>
-                        <div class="info-value">${data.current_brightness}%${data.schedule_enabled ? ' <span style="color: #888; font-size: 0.8em;">(scheduled)</span>' : ''}</div>
-                    </div>
-                    <div class="info-item" style="grid-column: span 2;">
-                        <div class="info-label">Reporting URL</div>
-                        <div class="info-value" style="font-size: 0.9em; word-break: break-all;">${data.reporting_url || 'Not configured'}</div>
-                    </div>
-                `;
-            } catch (e) {
-                console.error('Failed to load device info:', e);
-            }
-        }
-
-        function formatUptime(seconds) {
-            const h = Math.floor(seconds / 3600);
-            const m = Math.floor((seconds % 3600) / 60);
-            const s = seconds % 60;
-            return `${h}h ${m}m ${s}s`;
-        }
-
-        async function captureScreenshot() {
-            try {
-                const response = await fetch('/api/screenshot/capture', { method: 'POST' });
-                const data = await response.json();
-
-                const status = document.getElementById('screenshot-status');
-                if (data.success) {
-                    status.innerHTML = `<span class="status status-success">Screenshot captured (${(data.size / 1024).toFixed(1)} KB)</span>`;
-                    viewScreenshot();
-                } else {
-                    status.innerHTML = `<span class="status status-error">${data.message}</span>`;
-                }
-            } catch (e) {
-                console.error('Failed to capture screenshot:', e);
-            }
-        }
-
-        function viewScreenshot() {
-            const container = document.getElementById('screenshot-container');
-            container.innerHTML = `<img src="/api/screenshot/view?t=${Date.now()}" alt="Screenshot" onerror="this.parentElement.innerHTML='<p style=\\'color:#888\\'>No screenshot available</p>'">`;
-        }
-
-        function downloadScreenshot() {
-            window.location.href = '/api/screenshot/download';
-        }
-
-        async function restartDevice() {
-            if (confirm('Are you sure you want to restart the device?')) {
-                await fetch('/api/restart', { method: 'POST' });
-                alert('Device is restarting...');
-            }
-        }
-
-        async function loadWifiStatus() {
-            try {
-                const response = await fetch('/api/wifi/status');
-                const data = await response.json();
-
-                const status = document.getElementById('wifi-status');
-                if (data.connected) {
-                    status.innerHTML = `<span class="status status-success">Connected to ${data.ssid} (${data.rssi} dBm)</span>`;
-                } else if (data.mode === 'ap') {
-                    status.innerHTML = `<span class="status status-error">AP Mode: Connect to "${data.ap_ssid}" to configure</span>`;
-                } else {
-                    status.innerHTML = `<span class="status status-error">Disconnected</span>`;
-                }
-            } catch (e) {
-                console.error('Failed to load WiFi status:', e);
-            }
-        }
-
-        async function scanNetworks() {
-            const list = document.getElementById('network-list');
-            list.style.display = 'block';
-            list.innerHTML = '<div style="padding: 10px; color: #888;">Scanning...</div>';
-
-            try {
-                const response = await fetch('/api/wifi/scan');
-                const data = await response.json();
-
-                if (data.networks.length === 0) {
-                    list.innerHTML = '<div style="padding: 10px; color: #888;">No networks found</div>';
-                    return;
-                }
-
-                list.innerHTML = data.networks.map(net =>
-                    `<div class="network-item" onclick="selectNetwork('${net.ssid}')">
-                        <span>${net.ssid} ${net.secure ? '🔒' : ''}</span>
-                        <span class="signal">${net.rssi} dBm</span>
-                    </div>`
-                ).join('');
-            } catch (e) {
-                list.innerHTML = '<div style="padding: 10px; color: #ea868f;">Scan failed</div>';
-            }
-        }
-
-        function selectNetwork(ssid) {
-            document.getElementById('wifi-ssid').value = ssid;
-            document.getElementById('network-list').style.display = 'none';
-            document.getElementById('wifi-password').focus();
-        }
-
-        async function connectWifi() {
-            const ssid = document.getElementById('wifi-ssid').value;
-            const password = document.getElementById('wifi-password').value;
-
-            if (!ssid) {
-                alert('Please enter an SSID');
-                return;
-            }
-
-            try {
-                const response = await fetch('/api/wifi/connect', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({ ssid, password })
-                });
-                const data = await response.json();
-
-                if (data.success) {
-                    alert('WiFi credentials saved. Device will restart and connect to the new network.');
-                } else {
-                    alert('Error: ' + data.error);
-                }
-            } catch (e) {
-                console.error('Failed to save WiFi:', e);
-            }
-        }
-
-        async function loadReportingUrl() {
-            try {
-                const response = await fetch('/api/server');
-                const data = await response.json();
-                document.getElementById('reporting-url-input').value = data.reportingUrl || '';
-            } catch (e) {
-                console.error('Failed to load reporting URL:', e);
-            }
-        }
-
-        async function saveReportingUrl() {
-            const url = document.getElementById('reporting-url-input').value.trim();
-            const status = document.getElementById('reporting-url-status');
-
-            if (!url) {
-                status.innerHTML = '<span class="status status-error">URL is required</span>';
-                return;
-            }
-
-            if (!url.startsWith('http://') && !url.startsWith('https://')) {
-                status.innerHTML = '<span class="status status-error">URL must start with http:// or https://</span>';
-                return;
-            }
-
-            try {
-                const response = await fetch('/api/server', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({ reportingUrl: url })
-                });
-                const data = await response.json();
-
-                if (response.status === 200) {
-                    status.innerHTML = '<span class="status status-success">' + data.message + '</span>';
-                } else if (response.status === 202) {
-                    status.innerHTML = '<span class="status" style="background: #5c4b00; color: #ffc107;">Confirm on device display</span>';
-                } else {
-                    status.innerHTML = '<span class="status status-error">' + (data.error || 'Failed') + '</span>';
-                }
-            } catch (e) {
-                status.innerHTML = '<span class="status status-error">Connection error</span>';
-            }
-        }
-
-        // Load data on page load
-        loadDeviceInfo();
-        loadWifiStatus();
-        loadReportingUrl();
-        setInterval(loadDeviceInfo, 5000);
-        setInterval(loadWifiStatus, 10000);
-
-        // Check for existing screenshot
-        fetch('/api/screenshot/status')
-            .then(r => r.json())
-            .then(data => {
-                if (data.available) {
-                    document.getElementById('screenshot-status').innerHTML =
-                        `<span class="status status-success">Screenshot available (${(data.size / 1024).toFixed(1)} KB)</span>`;
-                    viewScreenshot();
-                }
-            });
-    </script>
-</body>
-</html>
-)rawliteral";
-}
@@ -0,0 +1,338 @@
+#include "wifi_link.h"
+#include "event_scheduler.h"
+#include <Preferences.h>
+#include <esp_random.h>
+#include <esp_wifi.h>
+
+// Optional: include secrets.h for default WiFi credentials
+#if __has_include("secrets.h")
+#include "secrets.h"
+#define HAS_DEFAULT_WIFI 1
+#else
+#define HAS_DEFAULT_WIFI 0
+#endif
+
+// Global instance
+WiFiLink wifiLink;
+
+static const char* PREFS_NAMESPACE = "wifi";
+static const char* AP_SSID = "ESP32-Display";
+static const char* AP_PASSWORD = "configure";
+
+// Our own WiFi.disconnect() before a retry; not a failure of the new attempt
+static const uint8_t REASON_ASSOC_LEAVE = 8;
+
+WiFiLink::WiFiLink()
+    : cachedChannel(0)
+    , job(-1)
+    , state(State::IDLE)
+    , attemptDirected(false)
+    , everConnected(false)
+    , apStarted(false)
+    , failures(0)
+    , attemptStartedAt(0)
+    , retryAt(0)
+    , lastConnectMs(0)
+    , lastConnectDirected(false)
+    , reconnects(0)
+    , dim(false)
+    , boost(false)
+    , appliedProfile(WifiProfile::BALANCED)
+    , profileApplied(false)
+    , profileMux(portMUX_INITIALIZER_UNLOCKED)
+    , mux(portMUX_INITIALIZER_UNLOCKED)
+    , gotIp(false)
+    , lost(false)
+    , lostReason(0)
+{
+    memset(cachedBssid, 0, sizeof(cachedBssid));
+}
+
+void WiFiLink::begin() {
+    Serial.println("WiFiLink: Setting up WiFi...");
+
+    Preferences prefs;
+    prefs.begin(PREFS_NAMESPACE, true);
+    ssid = prefs.getString("ssid", "");
+    password = prefs.getString("password", "");
+    String cachedFor = prefs.getString("ap_ssid", "");
+    if (prefs.getBytes("ap_bssid", cachedBssid, sizeof(cachedBssid)) == sizeof(cachedBssid)) {
+        cachedChannel = prefs.getUChar("ap_channel", 0);
+    }
+    prefs.end();
+
+    // If no saved credentials, try default from secrets.h
+#if HAS_DEFAULT_WIFI
+    if (ssid.length() == 0) {
+        Serial.println("WiFiLink: No saved credentials, using defaults from secrets.h");
+        ssid = WIFI_SSID;
+        password = WIFI_PASSWORD;
+    }
+#endif
+
+    // The cached AP belongs to whichever network it was learned on
+    if (cachedFor != ssid) {
+        cachedChannel = 0;
+    }
+
+    job = eventScheduler.add("wifi_link", onLinkTimer, this);
+
+    if (ssid.length() == 0) {
+        startAccessPoint();
+        return;
+    }
+
+    // Retries are ours; don't let the driver rewrite its NVS copy each attempt
+    WiFi.persistent(false);
+    WiFi.setAutoReconnect(false);
+    WiFi.onEvent(onEvent);
+    WiFi.mode(WIFI_STA);
+    applyProfile();
+    startAttempt();
+}
+
+const char* WiFiLink::stateName() const {
+    switch (state) {
+        case State::IDLE:       return "idle";
+        case State::CONNECTING: return "connecting";
+        case State::CONNECTED:  return "connected";
+        case State::BACKOFF:    return "backoff";
+    }
+    return "unknown";
+}
+
+// ============================================================================
+// Power profiles
+// ============================================================================
+
+void WiFiLink::setDim(bool isDim) {
+    if (isDim == dim) return;
+    dim = isDim;
+    applyProfile();
+}
+
+void WiFiLink::setBoost(bool isBoost) {
+    if (isBoost == boost) return;
+    boost = isBoost;
+    applyProfile();
+}
+
+void WiFiLink::applyProfile() {
+    WifiProfile profile;
+    {
+        ConfigSnapshot snapshot;
+        profile = dim ? snapshot->network.dimProfile : snapshot->network.wifiProfile;
+    }
+    if (boost) {
+        profile = WifiProfile::LOW_LATENCY;
+    }
+
+    portENTER_CRITICAL(&profileMux);
+    bool unchanged = profileApplied && profile == appliedProfile;
+    appliedProfile = profile;
+    profileApplied = true;
+    portEXIT_CRITICAL(&profileMux);
+    if (unchanged) return;
+
+    wifi_ps_type_t ps = WIFI_PS_MIN_MODEM;
+    if (profile == WifiProfile::LOW_LATENCY) {
+        ps = WIFI_PS_NONE;
+    } else if (profile == WifiProfile::LOW_POWER) {
+        ps = WIFI_PS_MAX_MODEM;
+    }
+    // Stored by the Arduino layer too, so it survives mode changes
+    WiFi.setSleep(ps);
+    Serial.printf("WiFiLink: Profile %s%s\n", wifiProfileName(profile),
+                  boost ? " (update)" : (dim ? " (dim)" : ""));
+}
+
+// ============================================================================
+// Events
+// ============================================================================
+
+void WiFiLink::onEvent(arduino_event_id_t event, arduino_event_info_t info) {
+    WiFiLink* self = &wifiLink;
+
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+        portENTER_CRITICAL(&self->mux);
+        self->gotIp = true;
+        portEXIT_CRITICAL(&self->mux);
+        eventScheduler.post(self->job);
+    } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+        uint8_t reason = info.wifi_sta_disconnected.reason;
+        if (reason == REASON_ASSOC_LEAVE && self->state != State::CONNECTED) {
+            return;
+        }
+        portENTER_CRITICAL(&self->mux);
+        self->lost = true;
+        self->lostReason = reason;
+        portEXIT_CRITICAL(&self->mux);
+        eventScheduler.post(self->job);
+    }
+}
+
+void WiFiLink::onLinkTimer(void* arg) {
+    WiFiLink* self = (WiFiLink*)arg;
+
+    portENTER_CRITICAL(&self->mux);
+    bool gotIp = self->gotIp;
+    bool lost = self->lost;
+    uint8_t reason = self->lostReason;
+    self->gotIp = false;
+    self->lost = false;
+    portEXIT_CRITICAL(&self->mux);
+
+    unsigned long now = millis();
+    switch (self->state) {
+        case State::CONNECTING: {
+            if (gotIp) {
+                self->connected();
+                break;
+            }
+            uint32_t timeout = self->attemptDirected ? DIRECTED_TIMEOUT_MS : SCAN_TIMEOUT_MS;
+            unsigned long elapsed = now - self->attemptStartedAt;
+            if (lost || elapsed >= timeout) {
+                self->attemptFailed(lost ? reason : 0);
+            } else {
+                eventScheduler.schedule(self->job, timeout - elapsed);
+            }
+            break;
+        }
+
+        case State::CONNECTED:
+            if (lost) {
+                // Straight back to the AP we just had, no scan
+                Serial.printf("WiFiLink: Link lost (reason %u), reconnecting\n", reason);
+                self->startAttempt();
+            }
+            break;
+
+        case State::BACKOFF:
+            if ((long)(self->retryAt - now) > 0) {
+                eventScheduler.schedule(self->job, self->retryAt - now);
+            } else {
+                self->startAttempt();
+            }
+            break;
+
+        case State::IDLE:
+            break;
+    }
+}
+
+// ============================================================================
+// Attempts
+// ============================================================================
+
+void WiFiLink::startAttempt() {
+    // The cache is tried once after each drop; a failure falls back to a scan
+    attemptDirected = cachedChannel != 0 && failures == 0;
+    attemptStartedAt = millis();
+    state = State::CONNECTING;
+
+    if (WiFi.status() != WL_DISCONNECTED && WiFi.status() != WL_IDLE_STATUS) {
+        WiFi.disconnect(false);
+    }
+
+    if (attemptDirected) {
+        Serial.printf("WiFiLink: Connecting to %s on channel %u (%02X:%02X:%02X:%02X:%02X:%02X)\n",
+                      ssid.c_str(), cachedChannel, cachedBssid[0], cachedBssid[1], cachedBssid[2],
+                      cachedBssid[3], cachedBssid[4], cachedBssid[5]);
+        WiFi.begin(ssid.c_str(), password.c_str(), cachedChannel, cachedBssid, false);
+    } else {
+        Serial.printf("WiFiLink: Scanning for %s\n", ssid.c_str());
+        WiFi.begin(ssid.c_str(), password.c_str(), 0, nullptr, false);
+    }
+
+    // The listen interval is fixed at association; MAX_MODEM sleep uses it,
+    // the other profiles ignore it, so profiles can switch without a reconnect
+    wifi_config_t sta;
+    if (esp_wifi_get_config(WIFI_IF_STA, &sta) == ESP_OK) {
+        sta.sta.listen_interval = LISTEN_INTERVAL;
+        esp_wifi_set_config(WIFI_IF_STA, &sta);
+    }
+    esp_wifi_connect();
+    eventScheduler.schedule(job, attemptDirected ? DIRECTED_TIMEOUT_MS : SCAN_TIMEOUT_MS);
+}
+
+void WiFiLink::attemptFailed(uint8_t reason) {
+    failures++;
+    if (reason) {
+        Serial.printf("WiFiLink: %s attempt failed (reason %u)\n", attemptDirected ? "Directed" : "Scan", reason);
+    } else {
+        Serial.printf("WiFiLink: %s attempt timed out\n", attemptDirected ? "Directed" : "Scan");
+    }
+    WiFi.disconnect(false);
+
+    if (attemptDirected) {
+        startAttempt();
+        return;
+    }
+
+    // Never got on the network this boot: offer the configuration AP meanwhile
+    if (!everConnected && !apStarted) {
+        startAccessPoint();
+    }
+
+    uint8_t shift = failures > 7 ? 6 : failures - 1;
+    uint32_t delayMs = RETRY_MIN_MS << shift;
+    if (delayMs > RETRY_MAX_MS) delayMs = RETRY_MAX_MS;
+    delayMs = delayMs / 2 + esp_random() % (delayMs / 2 + 1);
+
+    state = State::BACKOFF;
+    retryAt = millis() + delayMs;
+    Serial.printf("WiFiLink: Retrying in %lu ms\n", delayMs);
+    eventScheduler.schedule(job, delayMs);
+}
+
+void WiFiLink::connected() {
+    lastConnectMs = millis() - attemptStartedAt;
+    lastConnectDirected = attemptDirected;
+    if (everConnected) {
+        reconnects++;
+    }
+    everConnected = true;
+    failures = 0;
+    state = State::CONNECTED;
+
+    Serial.printf("WiFiLink: Connected in %lu ms (%s), channel %d, IP %s\n",
+                  lastConnectMs, attemptDirected ? "directed" : "scan", (int)WiFi.channel(),
+                  WiFi.localIP().toString().c_str());
+
+    rememberAccessPoint();
+
+    if (apStarted) {
+        WiFi.softAPdisconnect(true);
+        apStarted = false;
+        Serial.println("WiFiLink: Configuration AP stopped");
+    }
+}
+
+void WiFiLink::rememberAccessPoint() {
+    const uint8_t* bssid = WiFi.BSSID();
+    uint8_t channel = WiFi.channel();
+    if (!bssid || channel == 0) return;
+    if (channel == cachedChannel && memcmp(bssid, cachedBssid, sizeof(cachedBssid)) == 0) {
+        return;   // Roams are rare; don't wear the flash on every reconnect
+    }
+
+    memcpy(cachedBssid, bssid, sizeof(cachedBssid));
+    cachedChannel = channel;
+
+    Preferences prefs;
+    prefs.begin(PREFS_NAMESPACE, false);
+    prefs.putString("ap_ssid", ssid);
+    prefs.putBytes("ap_bssid", cachedBssid, sizeof(cachedBssid));
+    prefs.putUChar("ap_channel", cachedChannel);
+    prefs.end();
+}
+
+void WiFiLink::startAccessPoint() {
+    // No saved credentials or connection failed - start AP mode for configuration
+    Serial.println("WiFiLink: Starting AP mode for WiFi configuration...");
+    WiFi.mode(ssid.length() > 0 ? WIFI_AP_STA : WIFI_AP);
+    WiFi.softAP(AP_SSID, AP_PASSWORD);
+    apStarted = true;
+    Serial.printf("WiFiLink: AP started. Connect to '%s' and visit http://%s\n",
+                  AP_SSID, WiFi.softAPIP().toString().c_str());
+}
@@ -0,0 +1,168 @@
+#include "wifi_scan.h"
+#include "event_scheduler.h"
+#include "lvgl_task.h"
+#include "touch_input.h"
+#include "panel_log.h"
+#include "json_alloc.h"
+#include <ArduinoJson.h>
+#include <WiFi.h>
+
+// Global instance
+WifiScanner wifiScanner;
+
+WifiScanner::WifiScanner()
+    : scanJob(-1)
+    , wanted(false)
+    , scanning(false)
+    , startedAt(0)
+    , mutex(nullptr)
+    , networks("[]")
+    , scannedAt(0)
+    , skipped(nullptr)
+{
+}
+
+void WifiScanner::begin() {
+    mutex = xSemaphoreCreateMutex();
+    scanJob = eventScheduler.add("wifi_scan", onScanTimer, this);
+}
+
+void WifiScanner::onScanTimer(void* arg) {
+    WifiScanner* self = (WifiScanner*)arg;
+    self->run();
+}
+
+const char* WifiScanner::blocker() const {
+    if (lvglTask.isUpdateMode()) {
+        return "ota";
+    }
+    unsigned long touchAt = touchInput.getLastTouchAt();
+    if (touchAt != 0 && millis() - touchAt < UI_QUIET_MS) {
+        return "ui";
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// Requests (any task)
+// ============================================================================
+
+void WifiScanner::request(bool refresh) {
+    if (scanning || wanted || scanJob < 0) {
+        return;
+    }
+    unsigned long now = millis();
+    if (startedAt != 0 && now - startedAt < MIN_INTERVAL_MS) {
+        return;
+    }
+    if (!refresh && scannedAt != 0 && now - scannedAt < FRESH_MS) {
+        return;
+    }
+    wanted = true;
+    eventScheduler.post(scanJob);
+}
+
+void WifiScanner::writeJson(String& out) {
+    out = "{\"networks\":";
+    if (mutex == nullptr) {
+        out += "[],\"age_ms\":null,\"scanning\":false,\"skipped\":null}";
+        return;
+    }
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    out += networks;
+    unsigned long at = scannedAt;
+    const char* reason = skipped;
+    xSemaphoreGive(mutex);
+
+    out += ",\"age_ms\":";
+    out += at != 0 ? String(millis() - at) : String("null");
+    out += ",\"scanning\":";
+    out += (scanning || wanted) ? "true" : "false";
+    out += ",\"skipped\":";
+    if (reason) {
+        out += '"';
+        out += reason;
+        out += '"';
+    } else {
+        out += "null";
+    }
+    out += '}';
+}
+
+// ============================================================================
+// Scan job (loop task)
+// ============================================================================
+
+void WifiScanner::run() {
+    if (!scanning) {
+        if (wanted) {
+            start();
+        }
+        return;
+    }
+
+    int16_t count = WiFi.scanComplete();
+    if (count == WIFI_SCAN_RUNNING) {
+        if (millis() - startedAt < SCAN_TIMEOUT_MS) {
+            eventScheduler.schedule(scanJob, POLL_MS);
+            return;
+        }
+        LOG_W("WifiScan: Scan timed out");
+    }
+    finish(count);
+}
+
+void WifiScanner::start() {
+    const char* reason = blocker();
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    skipped = reason;
+    xSemaphoreGive(mutex);
+    if (reason) {
+        // The next request asks again once the panel is left alone
+        wanted = false;
+        return;
+    }
+
+    startedAt = millis();
+    scanning = true;
+    wanted = false;
+    // async: returns at once, completion is polled
+    int16_t result = WiFi.scanNetworks(true, false, false, SCAN_DWELL_MS);
+    if (result == WIFI_SCAN_FAILED) {
+        LOG_W("WifiScan: Scan refused (link busy)");
+        finish(result);
+        return;
+    }
+    eventScheduler.schedule(scanJob, POLL_MS);
+}
+
+void WifiScanner::finish(int count) {
+    scanning = false;
+    if (count < 0) {
+        WiFi.scanDelete();
+        return;
+    }
+
+    PsramJsonDocument doc(2048);
+    JsonArray list = doc.to<JsonArray>();
+    for (int i = 0; i < count && i < MAX_NETWORKS; i++) {
+        JsonObject net = list.createNestedObject();
+        net["ssid"] = WiFi.SSID(i);
+        net["rssi"] = WiFi.RSSI(i);
+        net["secure"] = (WiFi.encryptionType(i) != WIFI_AUTH_OPEN);
+    }
+    WiFi.scanDelete();
+
+    String json;
+    serializeJson(doc, json);
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    networks = json;
+    scannedAt = millis();
+    if (scannedAt == 0) {
+        scannedAt = 1;
+    }
+    xSemaphoreGive(mutex);
+    LOG_I("WifiScan: %d networks in %lu ms", count, millis() - startedAt);
+}